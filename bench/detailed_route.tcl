@@ -0,0 +1,7 @@
+source [file join [file dirname [info script]] helpers.tcl]
+
+bench_read_design global_route.odb
+read_guides [bench_file route.guide]
+bench_run detailed_route {
+  detailed_route -verbose 0
+}
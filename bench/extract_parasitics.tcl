@@ -0,0 +1,6 @@
+source [file join [file dirname [info script]] helpers.tcl]
+
+bench_read_design route.odb
+bench_run extract_parasitics {
+  extract_parasitics -ext_model_file [bench_file rcx_patterns.rules]
+}
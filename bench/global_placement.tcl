@@ -0,0 +1,6 @@
+source [file join [file dirname [info script]] helpers.tcl]
+
+bench_read_design floorplan.odb
+bench_run global_placement {
+  global_placement -skip_io
+}
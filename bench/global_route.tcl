@@ -0,0 +1,6 @@
+source [file join [file dirname [info script]] helpers.tcl]
+
+bench_read_design place.odb
+bench_run global_route {
+  global_route -congestion_iterations 30
+}
@@ -0,0 +1,38 @@
+# Helpers shared by the stage benchmarks.  run_bench.py passes the design
+# through the environment:
+#   BENCH_DIR   directory holding the stage checkpoints of the design
+#   BENCH_LIBS  liberty files, relative to BENCH_DIR
+#   BENCH_SDC   constraints file, relative to BENCH_DIR
+
+proc bench_file { name } {
+  return [file join $::env(BENCH_DIR) $name]
+}
+
+# Reads the libraries, the stage input checkpoint and the constraints.
+# A setup.tcl in the design directory, if any, is sourced last for the
+# platform settings the checkpoint does not hold (wire RC, routing layers,
+# layer adjustments).
+proc bench_read_design { checkpoint } {
+  foreach lib $::env(BENCH_LIBS) {
+    read_liberty [bench_file $lib]
+  }
+  read_db [bench_file $checkpoint]
+  if { $::env(BENCH_SDC) != "" } {
+    read_sdc [bench_file $::env(BENCH_SDC)]
+  }
+  if { [file exists [bench_file setup.tcl]] } {
+    source [bench_file setup.tcl]
+  }
+}
+
+# Runs body in the caller's scope and records its wall time as the
+# bench__<stage>__runtime metric.  utl::ProfileScopes hit by the stage are
+# reported as profile__* metrics.
+proc bench_run { stage body } {
+  utl::start_profiling ""
+  set start [clock milliseconds]
+  uplevel 1 $body
+  set runtime [expr { ([clock milliseconds] - $start) / 1000.0 }]
+  utl::stop_profiling
+  utl::metric_float "bench__${stage}__runtime" $runtime
+}
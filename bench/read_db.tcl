@@ -0,0 +1,5 @@
+source [file join [file dirname [info script]] helpers.tcl]
+
+bench_run read_db {
+  read_db [bench_file route.odb]
+}
@@ -0,0 +1,7 @@
+source [file join [file dirname [info script]] helpers.tcl]
+
+bench_read_design cts.odb
+estimate_parasitics -placement
+bench_run repair_timing {
+  repair_timing -setup
+}
@@ -0,0 +1,254 @@
+#!/usr/bin/env python3
+"""Runs the OpenROAD stage benchmarks and compares them to baselines.
+
+Each stage of each reference design in designs.json is run once per
+thread count in a fresh openroad process.  The stage runtime comes from
+the bench__<stage>__runtime metric the stage script records; the peak
+memory is the resident set high water mark of the process.  Results are
+written as JSON and compared against bench/baselines/<stage>.json.
+A runtime or memory increase above the tolerance is a regression and
+makes the script exit with status 1.
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+
+BENCH_DIR = os.path.dirname(os.path.abspath(__file__))
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--openroad", required=True, help="openroad executable")
+    parser.add_argument(
+        "--stage",
+        action="append",
+        help="stage to run, may be repeated (default: all stages)",
+    )
+    parser.add_argument(
+        "--designs-dir",
+        default=os.environ.get("OPENROAD_BENCH_DESIGNS"),
+        help="root of the design checkpoints (default: $OPENROAD_BENCH_DESIGNS)",
+    )
+    parser.add_argument(
+        "--size",
+        choices=["medium", "large", "all"],
+        default="all",
+        help="only run designs of this size",
+    )
+    parser.add_argument(
+        "--threads",
+        help="comma separated thread counts (default: 1, 2, 4, ... up to "
+        "the number of processors)",
+    )
+    parser.add_argument(
+        "--results-dir",
+        default="bench_results",
+        help="where results and logs are written",
+    )
+    parser.add_argument(
+        "--baseline-dir",
+        default=os.path.join(BENCH_DIR, "baselines"),
+        help="directory of the <stage>.json baselines",
+    )
+    parser.add_argument(
+        "--update-baseline",
+        action="store_true",
+        help="store this run as the new baseline instead of comparing",
+    )
+    parser.add_argument(
+        "--runtime-tolerance",
+        type=float,
+        default=0.10,
+        help="allowed relative runtime increase (default: 0.10)",
+    )
+    parser.add_argument(
+        "--memory-tolerance",
+        type=float,
+        default=0.10,
+        help="allowed relative peak memory increase (default: 0.10)",
+    )
+    parser.add_argument(
+        "--min-runtime",
+        type=float,
+        default=1.0,
+        help="runtime increases below this many seconds are noise",
+    )
+    return parser.parse_args()
+
+
+def thread_counts(arg):
+    if arg:
+        return [int(count) for count in arg.split(",")]
+    counts = [1]
+    while counts[-1] * 2 <= os.cpu_count():
+        counts.append(counts[-1] * 2)
+    if counts[-1] != os.cpu_count():
+        counts.append(os.cpu_count())
+    return counts
+
+
+def run_stage(args, stage, script, design, threads):
+    """Returns the result of one run, or None if it failed."""
+    design_dir = os.path.join(args.designs_dir, design["name"])
+    log_dir = os.path.join(args.results_dir, stage, design["name"])
+    os.makedirs(log_dir, exist_ok=True)
+    log_file = os.path.join(log_dir, f"threads{threads}.log")
+    metrics_file = os.path.join(log_dir, f"threads{threads}.json")
+
+    env = dict(os.environ)
+    env["BENCH_DIR"] = design_dir
+    env["BENCH_LIBS"] = " ".join(design.get("libs", []))
+    env["BENCH_SDC"] = design.get("sdc", "")
+    command = [
+        args.openroad,
+        "-no_init",
+        "-no_splash",
+        "-exit",
+        "-threads",
+        str(threads),
+        "-log",
+        log_file,
+        "-metrics",
+        metrics_file,
+        os.path.join(BENCH_DIR, script),
+    ]
+    with open(os.devnull, "w") as devnull:
+        process = subprocess.Popen(command, env=env, stdout=devnull)
+        # wait4 gives the resource usage of this child alone.
+        _, status, usage = os.wait4(process.pid, 0)
+    if os.waitstatus_to_exitcode(status) != 0:
+        print(f"  {design['name']} threads {threads}: failed, see {log_file}")
+        return None
+
+    with open(metrics_file) as file:
+        metrics = json.load(file)
+    result = {
+        "runtime": metrics[f"bench__{stage}__runtime"],
+        # ru_maxrss is in KB on Linux.
+        "peak_memory_mb": usage.ru_maxrss / 1024,
+        "profile": {
+            key: value
+            for key, value in metrics.items()
+            if key.startswith("profile__")
+        },
+    }
+    print(
+        f"  {design['name']} threads {threads}: {result['runtime']:.2f} s "
+        f"{result['peak_memory_mb']:.0f} MB"
+    )
+    return result
+
+
+def report_scaling(stage_results):
+    for name, runs in stage_results.items():
+        counts = sorted(runs, key=int)
+        base = runs[counts[0]]["runtime"]
+        speedups = ", ".join(
+            f"{count}: {base / max(runs[count]['runtime'], 1e-9):.2f}x"
+            for count in counts
+        )
+        print(f"  {name} speedup over {counts[0]} thread(s): {speedups}")
+
+
+def compare(args, stage, stage_results, baseline):
+    """Returns the list of regressions against the baseline."""
+    regressions = []
+    for name, runs in stage_results.items():
+        for threads, result in runs.items():
+            base = baseline.get(name, {}).get(threads)
+            if base is None:
+                continue
+            runtime = result["runtime"]
+            base_runtime = base["runtime"]
+            if (
+                runtime > base_runtime * (1 + args.runtime_tolerance)
+                and runtime - base_runtime > args.min_runtime
+            ):
+                regressions.append(
+                    f"{stage} {name} threads {threads}: runtime "
+                    f"{base_runtime:.2f} s -> {runtime:.2f} s"
+                )
+            memory = result["peak_memory_mb"]
+            base_memory = base["peak_memory_mb"]
+            if memory > base_memory * (1 + args.memory_tolerance):
+                regressions.append(
+                    f"{stage} {name} threads {threads}: peak memory "
+                    f"{base_memory:.0f} MB -> {memory:.0f} MB"
+                )
+    return regressions
+
+
+def main():
+    args = parse_args()
+    if not args.designs_dir or not os.path.isdir(args.designs_dir):
+        sys.exit(
+            "Set --designs-dir or OPENROAD_BENCH_DESIGNS to the directory "
+            "of the benchmark designs (see bench/README.md)."
+        )
+
+    with open(os.path.join(BENCH_DIR, "designs.json")) as file:
+        config = json.load(file)
+    stages = args.stage or list(config["stages"])
+    for stage in stages:
+        if stage not in config["stages"]:
+            sys.exit(f"Unknown stage {stage}.")
+    designs = [
+        design
+        for design in config["designs"]
+        if args.size in ("all", design["size"])
+    ]
+    counts = thread_counts(args.threads)
+
+    failed = False
+    regressions = []
+    for stage in stages:
+        print(f"{stage}:")
+        stage_results = {}
+        for design in designs:
+            if not os.path.isdir(os.path.join(args.designs_dir, design["name"])):
+                print(f"  {design['name']}: not found, skipped")
+                continue
+            for threads in counts:
+                result = run_stage(
+                    args, stage, config["stages"][stage], design, threads
+                )
+                if result is None:
+                    failed = True
+                    continue
+                stage_results.setdefault(design["name"], {})[str(threads)] = result
+        report_scaling(stage_results)
+
+        os.makedirs(args.results_dir, exist_ok=True)
+        results_file = os.path.join(args.results_dir, f"{stage}.json")
+        with open(results_file, "w") as file:
+            json.dump(stage_results, file, indent=2)
+
+        baseline_file = os.path.join(args.baseline_dir, f"{stage}.json")
+        baseline = {}
+        if os.path.exists(baseline_file):
+            with open(baseline_file) as file:
+                baseline = json.load(file)
+        if args.update_baseline:
+            # Designs and thread counts not run this time keep their values.
+            for name, runs in stage_results.items():
+                baseline.setdefault(name, {}).update(runs)
+            os.makedirs(args.baseline_dir, exist_ok=True)
+            with open(baseline_file, "w") as file:
+                json.dump(baseline, file, indent=2)
+            print(f"  baseline written to {baseline_file}")
+        elif baseline:
+            regressions += compare(args, stage, stage_results, baseline)
+        else:
+            print(f"  no baseline {baseline_file}")
+
+    for regression in regressions:
+        print(f"Regression: {regression}")
+    if failed or regressions:
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -137,6 +137,7 @@ class ICeWall;
 
 namespace utl {
 class Logger;
+class MemoryRegistration;
 }
 
 namespace dst {
@@ -155,6 +156,7 @@ namespace ord {
 using std::string;
 
 class dbVerilogNetwork;
+class QueryServer;
 
 // Only pointers to components so the header has no dependents.
 class OpenRoad
@@ -195,17 +197,22 @@ class OpenRoad
   dst::Distributed* getDistributed() { return distributer_; }
   stt::SteinerTreeBuilder* getSteinerTreeBuilder() { return stt_builder_; }
   dft::Dft* getDft() { return dft_; }
+  QueryServer* getQueryServer() { return query_server_; }
 
   // Return the bounding box of the db rows.
   odb::Rect getCore();
   // Return true if the command units have been initialized.
   bool unitsInitialized();
 
+  // With a cache_dir, a LEF read into an empty database is saved there as
+  // an odb file keyed by a hash of the LEF contents and the arguments.
+  // Later reads of the same LEF load that file instead of parsing it.
   void readLef(const char* filename,
                const char* lib_name,
                const char* tech_name,
                bool make_tech,
-               bool make_library);
+               bool make_library,
+               const char* cache_dir = "");
 
   void readDef(const char* filename,
                odb::dbTech* tech,
@@ -243,6 +250,10 @@ class OpenRoad
 
   void setThreadCount(int threads, bool printInfo = true);
   void setThreadCount(const char* threads, bool printInfo = true);
+  // Pins worker threads to cores ("close", "spread" or "none") and turns
+  // NUMA interleaving of the large shared structures on or off.  Takes
+  // effect at the next setThreadCount.
+  void setThreadBinding(const char* binding, bool interleave);
   int getThreadCount();
 
   void addObserver(OpenRoadObserver* observer);
@@ -262,6 +273,8 @@ class OpenRoad
  private:
   OpenRoad();
 
+  void bindOpenMPThreads();
+
   Tcl_Interp* tcl_interp_ = nullptr;
   utl::Logger* logger_ = nullptr;
   odb::dbDatabase* db_ = nullptr;
@@ -289,10 +302,13 @@ class OpenRoad
   dst::Distributed* distributer_ = nullptr;
   stt::SteinerTreeBuilder* stt_builder_ = nullptr;
   dft::Dft* dft_ = nullptr;
+  QueryServer* query_server_ = nullptr;
+  utl::MemoryRegistration* db_memory_ = nullptr;
 
   std::set<OpenRoadObserver*> observers_;
 
   int threads_ = 1;
+  bool omp_threads_bound_ = false;
 };
 
 int tclAppInit(Tcl_Interp* interp);
@@ -0,0 +1,142 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// BSD 3-Clause License
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace odb {
+class dbDatabase;
+}
+
+namespace sta {
+class dbSta;
+}
+
+namespace utl {
+class Logger;
+}
+
+namespace ord {
+
+// Serves read-only queries about the loaded design over HTTP with JSON
+// replies, from its own threads so clients don't go through the Tcl
+// interpreter and don't block the flow.  Queries are answered from a
+// snapshot of the db and timing taken by updateSnapshot() on the thread
+// running the flow; the served threads never touch the db or the STA.
+//
+//   GET /design                  name, dbu, die area, counts
+//   GET /inst?name=<name>        master, location, orientation, status
+//   GET /insts?bbox=x0,y0,x1,y1  names of the instances overlapping it
+//   GET /net?name=<name>         signal type, pin counts, wire length
+//   GET /timing                  worst and total negative slack
+class QueryServer
+{
+ public:
+  QueryServer(odb::dbDatabase* db, sta::dbSta* sta, utl::Logger* logger);
+  ~QueryServer();
+
+  // Listens on 127.0.0.1:port with the given number of threads, port 0
+  // picks a free one.  Takes the first snapshot and returns the port.
+  int start(int port, int threads);
+  void stop();
+  bool isRunning() const { return listener_ != nullptr; }
+
+  // Takes a new snapshot.  Queries in flight keep the one they started
+  // with.
+  void updateSnapshot();
+
+  struct Inst
+  {
+    std::string name;
+    std::string master;
+    int x_min;
+    int y_min;
+    int x_max;
+    int y_max;
+    std::string orient;
+    std::string status;
+  };
+  struct Net
+  {
+    std::string sig_type;
+    int iterm_count;
+    int bterm_count;
+    int64_t wire_length;
+  };
+  struct Snapshot
+  {
+    int version = 0;
+    std::string design;
+    int dbu = 0;
+    int die[4] = {0, 0, 0, 0};
+    std::vector<Inst> insts;
+    std::map<std::string, int> inst_index;
+    std::map<std::string, Net> nets;
+    bool has_timing = false;
+    float worst_slack = 0;
+    float total_negative_slack = 0;
+  };
+
+  // Returns the status code and sets the JSON reply for a request target
+  // such as "/inst?name=u1".
+  static int answer(const Snapshot& snapshot,
+                    const std::string& target,
+                    std::string& reply);
+
+ private:
+  struct Listener;
+
+  void accept();
+  std::shared_ptr<const Snapshot> getSnapshot();
+
+  odb::dbDatabase* db_;
+  sta::dbSta* sta_;
+  utl::Logger* logger_;
+
+  std::unique_ptr<Listener> listener_;
+
+  // Replaced as a whole by updateSnapshot; readers copy the pointer under
+  // the mutex and then read without it.
+  std::mutex snapshot_mutex_;
+  std::shared_ptr<const Snapshot> snapshot_;
+};
+
+}  // namespace ord
@@ -99,6 +99,28 @@ class Timing
   bool isEndpoint(odb::dbITerm* db_pin);
   bool isEndpoint(odb::dbBTerm* db_pin);
 
+  // Bulk versions of the pin queries that return one value per pin to
+  // avoid a Python/Tcl round trip per pin.
+  std::vector<float> getPinArrivals(const std::vector<odb::dbITerm*>& db_pins,
+                                    RiseFall rf,
+                                    MinMax minmax = Max);
+  std::vector<float> getPinArrivals(const std::vector<odb::dbBTerm*>& db_pins,
+                                    RiseFall rf,
+                                    MinMax minmax = Max);
+  std::vector<float> getPinSlews(const std::vector<odb::dbITerm*>& db_pins,
+                                 MinMax minmax = Max);
+  std::vector<float> getPinSlews(const std::vector<odb::dbBTerm*>& db_pins,
+                                 MinMax minmax = Max);
+  std::vector<float> getPinSlacks(const std::vector<odb::dbITerm*>& db_pins,
+                                  RiseFall rf,
+                                  MinMax minmax = Max);
+  std::vector<float> getPinSlacks(const std::vector<odb::dbBTerm*>& db_pins,
+                                  RiseFall rf,
+                                  MinMax minmax = Max);
+  std::vector<float> getNetCaps(const std::vector<odb::dbNet*>& nets,
+                                sta::Corner* corner,
+                                MinMax minmax);
+
   float getNetCap(odb::dbNet* net, sta::Corner* corner, MinMax minmax);
   float getPortCap(odb::dbITerm* pin, sta::Corner* corner, MinMax minmax);
   float getMaxCapLimit(odb::dbMTerm* pin);
@@ -122,6 +144,20 @@ class Timing
   bool isEndpoint(sta::Pin* sta_pin);
   float getPinSlew(sta::Pin* sta_pin, MinMax minmax);
   float getPinArrival(sta::Pin* sta_pin, RiseFall rf, MinMax minmax);
+  float getPinArrival(sta::Pin* sta_pin,
+                      RiseFall rf,
+                      MinMax minmax,
+                      const sta::ClockSeq& clks);
+  template <typename T>
+  std::vector<sta::Pin*> staPins(const std::vector<T*>& db_pins);
+  std::vector<float> getPinArrivals(const std::vector<sta::Pin*>& sta_pins,
+                                    RiseFall rf,
+                                    MinMax minmax);
+  std::vector<float> getPinSlews(const std::vector<sta::Pin*>& sta_pins,
+                                 MinMax minmax);
+  std::vector<float> getPinSlacks(const std::vector<sta::Pin*>& sta_pins,
+                                  RiseFall rf,
+                                  MinMax minmax);
   float getPinSlack(sta::Pin* sta_pin, RiseFall rf, MinMax minmax);
   float slewAllCorners(sta::Vertex* vertex, sta::MinMax* minmax);
   std::vector<float> arrivalsClk(const sta::RiseFall* rf,
@@ -81,6 +81,10 @@ get_db_block();
 %template(Corners) std::vector<sta::Corner*>;
 %template(MTerms) std::vector<odb::dbMTerm*>;
 %template(Masters) std::vector<odb::dbMaster*>;
+%template(ITerms) std::vector<odb::dbITerm*>;
+%template(BTerms) std::vector<odb::dbBTerm*>;
+%template(Nets) std::vector<odb::dbNet*>;
+%template(Floats) std::vector<float>;
 
 %include "Exception-py.i"
 %include "ord/Tech.h"
@@ -35,9 +35,14 @@
 
 #include "ord/OpenRoad.hh"
 
+#include <cstdint>
 #include <fstream>
 #include <iostream>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include <thread>
+#include <vector>
 
 #include "ord/Version.hh"
 #ifdef ENABLE_PYTHON3
@@ -69,6 +74,7 @@
 #include "odb/lefin.h"
 #include "odb/lefout.h"
 #include "ord/InitOpenRoad.hh"
+#include "ord/QueryServer.h"
 #include "pad/MakeICeWall.h"
 #include "par/MakePartitionMgr.h"
 #include "pdn/MakePdnGen.hh"
@@ -84,7 +90,10 @@
 #include "triton_route/MakeTritonRoute.h"
 #include "utl/Logger.h"
 #include "utl/MakeLogger.h"
+#include "utl/MemoryRegistry.h"
+#include "utl/Numa.h"
 #include "utl/ScopedTemporaryFile.h"
+#include "utl/ThreadPool.h"
 
 namespace sta {
 extern const char* openroad_swig_tcl_inits[];
@@ -122,6 +131,10 @@ OpenRoad::OpenRoad()
 
 OpenRoad::~OpenRoad()
 {
+  // Stops the server threads before the db goes away.
+  delete query_server_;
+  // Leaves the registry of the logger deleted below.
+  delete db_memory_;
   deleteDbVerilogNetwork(verilog_network_);
   // Temporarily removed until a crash can be resolved
   // deleteDbSta(sta_);
@@ -202,6 +215,9 @@ void OpenRoad::init(Tcl_Interp* tcl_interp)
   distributer_ = makeDistributed();
   stt_builder_ = makeSteinerTreeBuilder();
   dft_ = dft::makeDft();
+  query_server_ = new QueryServer(db_, sta_, logger_);
+  db_memory_ = new utl::MemoryRegistration(logger_->getMemoryRegistry()->add(
+      utl::ODB, "tables", [] { return dbDatabase::getTableMemoryUsage(); }));
 
   // Init components.
   Openroad_swig_Init(tcl_interp);
@@ -254,15 +270,99 @@ void OpenRoad::init(Tcl_Interp* tcl_interp)
 
 ////////////////////////////////////////////////////////////////
 
+// FNV-1a hash of the LEF contents, the read_lef arguments and the build,
+// so a changed file or a rebuilt binary misses the cache.
+static std::string lefCacheKey(const char* filename,
+                               const char* lib_name,
+                               const char* tech_name,
+                               bool make_tech,
+                               bool make_library)
+{
+  uint64_t hash = 14695981039346656037ULL;
+  auto add = [&hash](const char* begin, const char* end) {
+    for (const char* c = begin; c != end; ++c) {
+      hash = (hash ^ static_cast<unsigned char>(*c)) * 1099511628211ULL;
+    }
+  };
+  auto add_string = [&add](const std::string& str) {
+    add(str.data(), str.data() + str.size() + 1);
+  };
+
+  std::ifstream lef(filename, std::ios::binary);
+  if (!lef) {
+    return "";
+  }
+  std::vector<char> buffer(1 << 20);
+  while (lef.read(buffer.data(), buffer.size()) || lef.gcount() > 0) {
+    add(buffer.data(), buffer.data() + lef.gcount());
+  }
+
+  add_string(OPENROAD_GIT_DESCRIBE);
+  add_string(lib_name);
+  add_string(tech_name);
+  add_string(make_tech ? "tech" : "");
+  add_string(make_library ? "library" : "");
+  return fmt::format("{:016x}", hash);
+}
+
 void OpenRoad::readLef(const char* filename,
                        const char* lib_name,
                        const char* tech_name,
                        bool make_tech,
-                       bool make_library)
+                       bool make_library,
+                       const char* cache_dir)
 {
-  odb::lefin lef_reader(db_, logger_, false);
   dbLib* lib = nullptr;
   dbTech* tech = nullptr;
+
+  // The cache holds the whole database, so it is only used while the
+  // database is empty.
+  std::string cache_file;
+  if (cache_dir[0] != '\0' && db_->getTechs().empty() && db_->getLibs().empty()
+      && db_->getChip() == nullptr) {
+    const std::string key
+        = lefCacheKey(filename, lib_name, tech_name, make_tech, make_library);
+    if (!key.empty()) {
+      cache_file = fmt::format("{}/{}.odb", cache_dir, key);
+    }
+  }
+
+  if (!cache_file.empty()) {
+    std::vector<char> buffer(1 << 20);
+    std::ifstream stream;
+    stream.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+    stream.open(cache_file, std::ios::binary);
+    if (stream) {
+      try {
+        stream.exceptions(std::ifstream::failbit | std::ifstream::badbit
+                          | std::ios::eofbit);
+        db_->read(stream);
+        if (make_tech) {
+          tech = db_->findTech(tech_name);
+        }
+        if (make_library) {
+          lib = db_->findLib(lib_name);
+        }
+      } catch (const std::exception& e) {
+        logger_->warn(ORD,
+                      55,
+                      "Ignoring invalid LEF cache file {}: {}",
+                      cache_file,
+                      e.what());
+      }
+      if (lib != nullptr || tech != nullptr) {
+        logger_->info(
+            ORD, 56, "Loaded {} from LEF cache {}.", filename, cache_file);
+        for (OpenRoadObserver* observer : observers_) {
+          observer->postReadLef(tech, lib);
+        }
+        return;
+      }
+      db_->clear();
+    }
+  }
+
+  odb::lefin lef_reader(db_, logger_, false);
   if (make_tech && make_library) {
     lib = lef_reader.createTechAndLib(tech_name, lib_name, filename);
     tech = db_->findTech(tech_name);
@@ -282,6 +382,17 @@ void OpenRoad::readLef(const char* filename,
 
   // both are null on parser failure
   if (lib != nullptr || tech != nullptr) {
+    if (!cache_file.empty()) {
+      try {
+        writeDb(cache_file.c_str());
+      } catch (const std::exception& e) {
+        logger_->warn(ORD,
+                      57,
+                      "Unable to write LEF cache file {}: {}",
+                      cache_file,
+                      e.what());
+      }
+    }
     for (OpenRoadObserver* observer : observers_) {
       observer->postReadLef(tech, lib);
     }
@@ -439,7 +550,11 @@ void OpenRoad::writeCdl(const char* outFilename,
 
 void OpenRoad::readDb(const char* filename)
 {
+  // The db is read as many small fields; a large buffer keeps the number
+  // of reads from the file down.  It must be set before the file is opened.
+  std::vector<char> buffer(1 << 20);
   std::ifstream stream;
+  stream.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
   stream.open(filename, std::ios::binary);
   try {
     readDb(stream);
@@ -581,6 +696,50 @@ void OpenRoad::setThreadCount(int threads, bool printInfo)
 
   // place limits on tools with threads
   sta_->setThreadCount(threads_);
+  utl::ThreadPool::get().setThreadCount(threads_);
+  bindOpenMPThreads();
+}
+
+void OpenRoad::bindOpenMPThreads()
+{
+  const utl::Numa::Binding binding = utl::Numa::getBinding();
+  if (binding == utl::Numa::Binding::NONE && !omp_threads_bound_) {
+    return;
+  }
+#ifdef _OPENMP
+  // The OpenMP runtime keeps its workers between parallel regions, so a
+  // team of threads_ pins the workers the tools' loops run on.  The main
+  // thread stays unpinned so the threads it starts keep the full mask.
+#pragma omp parallel num_threads(threads_)
+  {
+    const int tid = omp_get_thread_num();
+    if (tid != 0) {
+      utl::Numa::bindCurrentThread(utl::Numa::cpuForThread(tid, binding));
+    }
+  }
+#endif
+  omp_threads_bound_ = binding != utl::Numa::Binding::NONE;
+}
+
+void OpenRoad::setThreadBinding(const char* binding, bool interleave)
+{
+  if (strcmp(binding, "close") == 0) {
+    utl::Numa::setBinding(utl::Numa::Binding::CLOSE);
+  } else if (strcmp(binding, "spread") == 0) {
+    utl::Numa::setBinding(utl::Numa::Binding::SPREAD);
+  } else if (strcmp(binding, "none") == 0) {
+    utl::Numa::setBinding(utl::Numa::Binding::NONE);
+  } else {
+    logger_->error(ORD,
+                   61,
+                   "Unknown thread binding {}, expected close, spread or "
+                   "none.",
+                   binding);
+  }
+  utl::Numa::setInterleave(interleave);
+  if (interleave && utl::Numa::nodeCount() < 2) {
+    logger_->info(ORD, 62, "Only one NUMA node found, -numa has no effect.");
+  }
 }
 
 void OpenRoad::setThreadCount(const char* threads, bool printInfo)
@@ -46,6 +46,7 @@
 #include "db_sta/dbReadVerilog.hh"
 #include "utl/Logger.h"
 #include "ord/OpenRoad.hh"
+#include "ord/QueryServer.h"
 
 #include <vector>
 
@@ -332,10 +333,12 @@ read_lef_cmd(const char *filename,
 	     const char *lib_name,
 	     const char *tech_name,
 	     bool make_tech,
-	     bool make_library)
+	     bool make_library,
+	     const char *cache_dir)
 {
   OpenRoad *ord = getOpenRoad();
-  ord->readLef(filename, lib_name, tech_name, make_tech, make_library);
+  ord->readLef(filename, lib_name, tech_name, make_tech, make_library,
+	       cache_dir);
 }
 
 void
@@ -601,6 +604,13 @@ set_thread_count(const char* threads)
   ord->setThreadCount(threads);
 }
 
+void
+set_thread_binding(const char* binding, bool interleave)
+{
+  OpenRoad *ord = getOpenRoad();
+  ord->setThreadBinding(binding, interleave);
+}
+
 int
 thread_count()
 {
@@ -614,6 +624,27 @@ void design_created()
   ord->designCreated();
 }
 
+int
+start_query_server_cmd(int port, int threads)
+{
+  OpenRoad *ord = getOpenRoad();
+  return ord->getQueryServer()->start(port, threads);
+}
+
+void
+update_query_server_cmd()
+{
+  OpenRoad *ord = getOpenRoad();
+  ord->getQueryServer()->updateSnapshot();
+}
+
+void
+stop_query_server_cmd()
+{
+  OpenRoad *ord = getOpenRoad();
+  ord->getQueryServer()->stop();
+}
+
 }
 
 %} // inline
@@ -34,10 +34,12 @@
 ############################################################################
 
 # -library is the default
-sta::define_cmd_args "read_lef" {[-tech] [-library] [-tech_name name] filename}
+sta::define_cmd_args "read_lef" {[-tech] [-library] [-tech_name name]\
+                                  [-cache_dir dir] filename}
 
 proc read_lef { args } {
-  sta::parse_key_args "read_lef" args keys {-tech_name} flags {-tech -library}
+  sta::parse_key_args "read_lef" args keys {-tech_name -cache_dir} \
+    flags {-tech -library}
   sta::check_argc_eq1 "read_lef" $args
 
   set filename [file nativename [lindex $args 0]]
@@ -67,7 +69,16 @@ proc read_lef { args } {
     set tech_name $lib_name
   }
 
-  ord::read_lef_cmd $filename $lib_name $tech_name $make_tech $make_lib
+  set cache_dir ""
+  if { [info exists keys(-cache_dir)] } {
+    set cache_dir [file nativename $keys(-cache_dir)]
+    if { ![file isdirectory $cache_dir] } {
+      utl::error "ORD" 9 "$cache_dir is not a directory."
+    }
+  }
+
+  ord::read_lef_cmd $filename $lib_name $tech_name $make_tech $make_lib \
+    $cache_dir
 }
 
 sta::define_cmd_args "read_def" {[-floorplan_initialize|-incremental|-child]\
@@ -258,14 +269,76 @@ proc unsuppress_message {args} {
   utl::unsuppress_message $tool $id
 }
 
-proc set_thread_count { count } {
-  ord::set_thread_count $count
+sta::define_cmd_args "report_memory_usage" {}
+proc report_memory_usage { args } {
+  sta::check_argc_eq0 "report_memory_usage" $args
+  utl::report_memory_usage
+}
+
+sta::define_cmd_args "set_release_memory_on_exit" { true|false }
+proc set_release_memory_on_exit { args } {
+  sta::check_argc_eq1 "set_release_memory_on_exit" $args
+  utl::set_release_memory_on_exit [expr [lindex $args 0] ? 1 : 0]
+}
+
+sta::define_cmd_args "set_thread_count" {[-bind close|spread|none]\
+                                          [-numa] count}
+
+proc set_thread_count { args } {
+  sta::parse_key_args "set_thread_count" args \
+    keys {-bind} flags {-numa}
+  sta::check_argc_eq1 "set_thread_count" $args
+
+  if { [info exists keys(-bind)] || [info exists flags(-numa)] } {
+    set bind "none"
+    if { [info exists keys(-bind)] } {
+      set bind $keys(-bind)
+    }
+    ord::set_thread_binding $bind [info exists flags(-numa)]
+  }
+  ord::set_thread_count [lindex $args 0]
 }
 
 proc thread_count { } {
   return [ord::thread_count]
 }
 
+sta::define_cmd_args "start_query_server" {[-port port] [-threads count]}
+
+proc start_query_server { args } {
+  sta::parse_key_args "start_query_server" args \
+    keys {-port -threads} flags {}
+  sta::check_argc_eq0 "start_query_server" $args
+
+  set port 8765
+  if { [info exists keys(-port)] } {
+    set port $keys(-port)
+    sta::check_cardinal "-port" $port
+  }
+  set threads 2
+  if { [info exists keys(-threads)] } {
+    set threads $keys(-threads)
+    sta::check_positive_integer "-threads" $threads
+  }
+  ord::start_query_server_cmd $port $threads
+}
+
+sta::define_cmd_args "update_query_server" {}
+
+proc update_query_server { args } {
+  sta::parse_key_args "update_query_server" args keys {} flags {}
+  sta::check_argc_eq0 "update_query_server" $args
+  ord::update_query_server_cmd
+}
+
+sta::define_cmd_args "stop_query_server" {}
+
+proc stop_query_server { args } {
+  sta::parse_key_args "stop_query_server" args keys {} flags {}
+  sta::check_argc_eq0 "stop_query_server" $args
+  ord::stop_query_server_cmd
+}
+
 sta::define_cmd_args "global_connect" {}
 proc global_connect {} {
   [ord::get_db_block] globalConnect
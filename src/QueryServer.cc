@@ -0,0 +1,496 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// BSD 3-Clause License
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "ord/QueryServer.h"
+
+#include <boost/asio.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <istream>
+#include <memory>
+#include <thread>
+#include <utility>
+
+#include "db_sta/dbNetwork.hh"
+#include "db_sta/dbSta.hh"
+#include "odb/db.h"
+#include "sta/MinMax.hh"
+#include "utl/Logger.h"
+
+namespace ord {
+
+namespace asio = boost::asio;
+using asio::ip::tcp;
+using utl::ORD;
+
+struct QueryServer::Listener
+{
+  asio::io_context io_context;
+  tcp::acceptor acceptor{io_context};
+  std::vector<std::thread> threads;
+};
+
+namespace {
+
+std::string jsonString(const std::string& value)
+{
+  std::string json = "\"";
+  for (const char c : value) {
+    switch (c) {
+      case '"':
+        json += "\\\"";
+        break;
+      case '\\':
+        json += "\\\\";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          json += fmt::format("\\u{:04x}", static_cast<int>(c));
+        } else {
+          json += c;
+        }
+    }
+  }
+  return json + "\"";
+}
+
+std::string jsonError(const std::string& message)
+{
+  return fmt::format("{{\"error\": {}}}", jsonString(message));
+}
+
+// Splits "a=1&b=%20x" into its decoded parameters.
+std::map<std::string, std::string> parseQuery(const std::string& query)
+{
+  auto decode = [](const std::string& text) {
+    std::string decoded;
+    for (size_t i = 0; i < text.size(); i++) {
+      int code;
+      if (text[i] == '%' && i + 2 < text.size()
+          && std::sscanf(text.substr(i + 1, 2).c_str(), "%2x", &code) == 1) {
+        decoded += static_cast<char>(code);
+        i += 2;
+      } else if (text[i] == '+') {
+        decoded += ' ';
+      } else {
+        decoded += text[i];
+      }
+    }
+    return decoded;
+  };
+  std::map<std::string, std::string> params;
+  size_t begin = 0;
+  while (begin < query.size()) {
+    size_t end = query.find('&', begin);
+    if (end == std::string::npos) {
+      end = query.size();
+    }
+    const std::string param = query.substr(begin, end - begin);
+    const size_t equal = param.find('=');
+    if (equal == std::string::npos) {
+      params[decode(param)] = "";
+    } else {
+      params[decode(param.substr(0, equal))] = decode(param.substr(equal + 1));
+    }
+    begin = end + 1;
+  }
+  return params;
+}
+
+const char* statusText(int status)
+{
+  switch (status) {
+    case 200:
+      return "OK";
+    case 400:
+      return "Bad Request";
+    case 404:
+      return "Not Found";
+    case 405:
+      return "Method Not Allowed";
+  }
+  return "Internal Server Error";
+}
+
+// A client is given this long to send its request and read the reply.
+constexpr std::chrono::seconds session_timeout(10);
+
+// Answers one request and closes the connection.  Every operation on the
+// socket is asynchronous and bounded by a deadline, so an idle or half-open
+// client never holds an io thread and stop() only has to stop the
+// io_context.  The socket is accepted onto its own strand, which the timer
+// shares, so the deadline can't close it while a read or write completes
+// on another io thread.
+class Session : public std::enable_shared_from_this<Session>
+{
+ public:
+  Session(tcp::socket socket,
+          std::shared_ptr<const QueryServer::Snapshot> snapshot)
+      : socket_(std::move(socket)),
+        deadline_(socket_.get_executor()),
+        request_(8192),  // Requests are a single line and a few headers.
+        snapshot_(std::move(snapshot))
+  {
+  }
+
+  void start()
+  {
+    auto self = shared_from_this();
+    deadline_.expires_after(session_timeout);
+    deadline_.async_wait([self](const boost::system::error_code& ec) {
+      if (!ec) {
+        boost::system::error_code ignored;
+        self->socket_.close(ignored);
+      }
+    });
+    asio::async_read_until(
+        socket_,
+        request_,
+        "\r\n\r\n",
+        [self](const boost::system::error_code& ec, std::size_t) {
+          self->onRead(ec);
+        });
+  }
+
+ private:
+  void onRead(const boost::system::error_code& ec)
+  {
+    if (ec) {
+      deadline_.cancel();
+      return;
+    }
+    std::istream stream(&request_);
+    std::string method, target;
+    stream >> method >> target;
+    std::string body;
+    int status;
+    if (method == "GET") {
+      status = QueryServer::answer(*snapshot_, target, body);
+    } else {
+      status = 405;
+      body = jsonError("only GET is supported");
+    }
+    reply_ = fmt::format(
+        "HTTP/1.1 {} {}\r\n"
+        "Content-Type: application/json\r\n"
+        "Content-Length: {}\r\n"
+        "Connection: close\r\n"
+        "\r\n"
+        "{}",
+        status,
+        statusText(status),
+        body.size(),
+        body);
+    auto self = shared_from_this();
+    asio::async_write(
+        socket_,
+        asio::buffer(reply_),
+        [self](const boost::system::error_code& ec, std::size_t) {
+          self->deadline_.cancel();
+          boost::system::error_code ignored;
+          self->socket_.shutdown(tcp::socket::shutdown_both, ignored);
+        });
+  }
+
+  tcp::socket socket_;
+  asio::steady_timer deadline_;
+  asio::streambuf request_;
+  std::string reply_;
+  std::shared_ptr<const QueryServer::Snapshot> snapshot_;
+};
+
+}  // namespace
+
+QueryServer::QueryServer(odb::dbDatabase* db,
+                         sta::dbSta* sta,
+                         utl::Logger* logger)
+    : db_(db), sta_(sta), logger_(logger)
+{
+}
+
+QueryServer::~QueryServer()
+{
+  stop();
+}
+
+int QueryServer::start(const int port, const int threads)
+{
+  if (isRunning()) {
+    logger_->error(ORD, 63, "The query server is already running.");
+  }
+  updateSnapshot();
+
+  auto listener = std::make_unique<Listener>();
+  const tcp::endpoint endpoint(asio::ip::address_v4::loopback(), port);
+  boost::system::error_code ec;
+  listener->acceptor.open(endpoint.protocol(), ec);
+  if (!ec) {
+    listener->acceptor.set_option(tcp::acceptor::reuse_address(true), ec);
+    listener->acceptor.bind(endpoint, ec);
+  }
+  if (!ec) {
+    listener->acceptor.listen(asio::socket_base::max_listen_connections, ec);
+  }
+  if (ec) {
+    logger_->error(
+        ORD, 58, "Unable to listen on port {}: {}.", port, ec.message());
+  }
+  const int bound_port = listener->acceptor.local_endpoint().port();
+  listener_ = std::move(listener);
+  accept();
+  for (int i = 0; i < threads; i++) {
+    listener_->threads.emplace_back(
+        [this]() { listener_->io_context.run(); });
+  }
+  logger_->info(ORD,
+                59,
+                "Query server listening on 127.0.0.1:{} with {} threads.",
+                bound_port,
+                threads);
+  return bound_port;
+}
+
+void QueryServer::stop()
+{
+  if (!isRunning()) {
+    return;
+  }
+  listener_->io_context.stop();
+  for (auto& thread : listener_->threads) {
+    thread.join();
+  }
+  listener_.reset();
+  logger_->info(ORD, 60, "Query server stopped.");
+}
+
+void QueryServer::accept()
+{
+  listener_->acceptor.async_accept(
+      asio::make_strand(listener_->io_context),
+      [this](const boost::system::error_code& ec, tcp::socket socket) {
+        if (ec == asio::error::operation_aborted) {
+          return;
+        }
+        accept();
+        if (!ec) {
+          std::make_shared<Session>(std::move(socket), getSnapshot())
+              ->start();
+        }
+      });
+}
+
+std::shared_ptr<const QueryServer::Snapshot> QueryServer::getSnapshot()
+{
+  std::lock_guard<std::mutex> lock(snapshot_mutex_);
+  return snapshot_;
+}
+
+void QueryServer::updateSnapshot()
+{
+  auto snapshot = std::make_shared<Snapshot>();
+  {
+    std::lock_guard<std::mutex> lock(snapshot_mutex_);
+    snapshot->version = snapshot_ ? snapshot_->version + 1 : 1;
+  }
+  odb::dbChip* chip = db_->getChip();
+  odb::dbBlock* block = chip ? chip->getBlock() : nullptr;
+  if (block) {
+    snapshot->design = block->getName();
+    snapshot->dbu = block->getDbUnitsPerMicron();
+    const odb::Rect die = block->getDieArea();
+    snapshot->die[0] = die.xMin();
+    snapshot->die[1] = die.yMin();
+    snapshot->die[2] = die.xMax();
+    snapshot->die[3] = die.yMax();
+
+    snapshot->insts.reserve(block->getInsts().size());
+    for (odb::dbInst* inst : block->getInsts()) {
+      const odb::Rect bbox = inst->getBBox()->getBox();
+      snapshot->inst_index[inst->getName()] = snapshot->insts.size();
+      snapshot->insts.push_back({inst->getName(),
+                                 inst->getMaster()->getName(),
+                                 bbox.xMin(),
+                                 bbox.yMin(),
+                                 bbox.xMax(),
+                                 bbox.yMax(),
+                                 inst->getOrient().getString(),
+                                 inst->getPlacementStatus().getString()});
+    }
+    for (odb::dbNet* net : block->getNets()) {
+      odb::dbWire* wire = net->getWire();
+      snapshot->nets[net->getName()]
+          = {net->getSigType().getString(),
+             static_cast<int>(net->getITerms().size()),
+             static_cast<int>(net->getBTerms().size()),
+             wire ? static_cast<int64_t>(wire->getLength()) : 0};
+    }
+
+    if (sta_ && sta_->getDbNetwork()->isLinked()) {
+      snapshot->has_timing = true;
+      snapshot->worst_slack = sta_->worstSlack(sta::MinMax::max());
+      snapshot->total_negative_slack
+          = sta_->totalNegativeSlack(sta::MinMax::max());
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(snapshot_mutex_);
+  snapshot_ = std::move(snapshot);
+}
+
+int QueryServer::answer(const Snapshot& snapshot,
+                        const std::string& target,
+                        std::string& reply)
+{
+  const size_t question = target.find('?');
+  const std::string path = target.substr(0, question);
+  const auto params = parseQuery(
+      question == std::string::npos ? "" : target.substr(question + 1));
+  auto param = [&params](const char* name) -> const std::string* {
+    auto it = params.find(name);
+    return it == params.end() ? nullptr : &it->second;
+  };
+
+  if (path == "/design") {
+    reply = fmt::format(
+        "{{\"design\": {}, \"snapshot\": {}, \"dbu\": {}, "
+        "\"die\": [{}, {}, {}, {}], \"insts\": {}, \"nets\": {}}}",
+        jsonString(snapshot.design),
+        snapshot.version,
+        snapshot.dbu,
+        snapshot.die[0],
+        snapshot.die[1],
+        snapshot.die[2],
+        snapshot.die[3],
+        snapshot.insts.size(),
+        snapshot.nets.size());
+    return 200;
+  }
+  if (path == "/inst") {
+    const std::string* name = param("name");
+    if (name == nullptr) {
+      reply = jsonError("missing name");
+      return 400;
+    }
+    auto it = snapshot.inst_index.find(*name);
+    if (it == snapshot.inst_index.end()) {
+      reply = jsonError("no instance " + *name);
+      return 404;
+    }
+    const Inst& inst = snapshot.insts[it->second];
+    reply = fmt::format(
+        "{{\"name\": {}, \"master\": {}, \"bbox\": [{}, {}, {}, {}], "
+        "\"orient\": {}, \"status\": {}}}",
+        jsonString(inst.name),
+        jsonString(inst.master),
+        inst.x_min,
+        inst.y_min,
+        inst.x_max,
+        inst.y_max,
+        jsonString(inst.orient),
+        jsonString(inst.status));
+    return 200;
+  }
+  if (path == "/insts") {
+    const std::string* bbox = param("bbox");
+    int x0, y0, x1, y1;
+    if (bbox == nullptr
+        || std::sscanf(bbox->c_str(), "%d,%d,%d,%d", &x0, &y0, &x1, &y1)
+               != 4) {
+      reply = jsonError("bbox=x0,y0,x1,y1 is required");
+      return 400;
+    }
+    const std::string* limit_param = param("limit");
+    const size_t limit
+        = limit_param ? std::strtoul(limit_param->c_str(), nullptr, 10) : 1000;
+    std::string names;
+    size_t count = 0;
+    bool truncated = false;
+    for (const Inst& inst : snapshot.insts) {
+      if (inst.x_max < x0 || inst.x_min > x1 || inst.y_max < y0
+          || inst.y_min > y1) {
+        continue;
+      }
+      if (count == limit) {
+        truncated = true;
+        break;
+      }
+      if (count++ > 0) {
+        names += ", ";
+      }
+      names += jsonString(inst.name);
+    }
+    reply = fmt::format(
+        "{{\"insts\": [{}], \"truncated\": {}}}", names, truncated);
+    return 200;
+  }
+  if (path == "/net") {
+    const std::string* name = param("name");
+    if (name == nullptr) {
+      reply = jsonError("missing name");
+      return 400;
+    }
+    auto it = snapshot.nets.find(*name);
+    if (it == snapshot.nets.end()) {
+      reply = jsonError("no net " + *name);
+      return 404;
+    }
+    const Net& net = it->second;
+    reply = fmt::format(
+        "{{\"name\": {}, \"sig_type\": {}, \"iterms\": {}, \"bterms\": {}, "
+        "\"wire_length\": {}}}",
+        jsonString(*name),
+        jsonString(net.sig_type),
+        net.iterm_count,
+        net.bterm_count,
+        net.wire_length);
+    return 200;
+  }
+  if (path == "/timing") {
+    if (!snapshot.has_timing) {
+      reply = jsonError("the design is not linked");
+      return 404;
+    }
+    // Slacks are in seconds like the STA API.
+    reply = fmt::format("{{\"worst_slack\": {}, \"tns\": {}}}",
+                        snapshot.worst_slack,
+                        snapshot.total_negative_slack);
+    return 200;
+  }
+  reply = jsonError("unknown query " + path);
+  return 404;
+}
+
+}  // namespace ord
@@ -231,6 +231,15 @@ float Timing::getPinArrival(odb::dbBTerm* db_pin, RiseFall rf, MinMax minmax)
 }
 
 float Timing::getPinArrival(sta::Pin* sta_pin, RiseFall rf, MinMax minmax)
+{
+  return getPinArrival(
+      sta_pin, rf, minmax, findClocksMatching("*", false, false));
+}
+
+float Timing::getPinArrival(sta::Pin* sta_pin,
+                            RiseFall rf,
+                            MinMax minmax,
+                            const sta::ClockSeq& clks)
 {
   auto vertex_array = vertices(sta_pin);
   float delay = (minmax == Max) ? -sta::INF : sta::INF;
@@ -247,7 +256,7 @@ float Timing::getPinArrival(sta::Pin* sta_pin, RiseFall rf, MinMax minmax)
     d2 = getPinArrivalTime(defaultArrivalClock, clk_r, vertex, arrive_hold);
     delay = (minmax == Max) ? std::max({d1, d2, delay})
                             : std::min({d1, d2, delay});
-    for (auto clk : findClocksMatching("*", false, false)) {
+    for (auto clk : clks) {
       d1 = getPinArrivalTime(clk, clk_r, vertex, arrive_hold);
       d2 = getPinArrivalTime(clk, clk_f, vertex, arrive_hold);
       delay = (minmax == Max) ? std::max({d1, d2, delay})
@@ -257,6 +266,103 @@ float Timing::getPinArrival(sta::Pin* sta_pin, RiseFall rf, MinMax minmax)
   return delay;
 }
 
+template <typename T>
+std::vector<sta::Pin*> Timing::staPins(const std::vector<T*>& db_pins)
+{
+  sta::dbNetwork* network = getSta()->getDbNetwork();
+  std::vector<sta::Pin*> sta_pins;
+  sta_pins.reserve(db_pins.size());
+  for (T* db_pin : db_pins) {
+    sta_pins.push_back(network->dbToSta(db_pin));
+  }
+  return sta_pins;
+}
+
+std::vector<float> Timing::getPinArrivals(
+    const std::vector<odb::dbITerm*>& db_pins,
+    RiseFall rf,
+    MinMax minmax)
+{
+  return getPinArrivals(staPins(db_pins), rf, minmax);
+}
+
+std::vector<float> Timing::getPinArrivals(
+    const std::vector<odb::dbBTerm*>& db_pins,
+    RiseFall rf,
+    MinMax minmax)
+{
+  return getPinArrivals(staPins(db_pins), rf, minmax);
+}
+
+std::vector<float> Timing::getPinArrivals(
+    const std::vector<sta::Pin*>& sta_pins,
+    RiseFall rf,
+    MinMax minmax)
+{
+  // Find the clocks once rather than per pin.
+  const sta::ClockSeq clks = findClocksMatching("*", false, false);
+  std::vector<float> arrivals;
+  arrivals.reserve(sta_pins.size());
+  for (sta::Pin* sta_pin : sta_pins) {
+    arrivals.push_back(getPinArrival(sta_pin, rf, minmax, clks));
+  }
+  return arrivals;
+}
+
+std::vector<float> Timing::getPinSlews(
+    const std::vector<odb::dbITerm*>& db_pins,
+    MinMax minmax)
+{
+  return getPinSlews(staPins(db_pins), minmax);
+}
+
+std::vector<float> Timing::getPinSlews(
+    const std::vector<odb::dbBTerm*>& db_pins,
+    MinMax minmax)
+{
+  return getPinSlews(staPins(db_pins), minmax);
+}
+
+std::vector<float> Timing::getPinSlews(const std::vector<sta::Pin*>& sta_pins,
+                                       MinMax minmax)
+{
+  std::vector<float> slews;
+  slews.reserve(sta_pins.size());
+  for (sta::Pin* sta_pin : sta_pins) {
+    slews.push_back(getPinSlew(sta_pin, minmax));
+  }
+  return slews;
+}
+
+std::vector<float> Timing::getPinSlacks(
+    const std::vector<odb::dbITerm*>& db_pins,
+    RiseFall rf,
+    MinMax minmax)
+{
+  return getPinSlacks(staPins(db_pins), rf, minmax);
+}
+
+std::vector<float> Timing::getPinSlacks(
+    const std::vector<odb::dbBTerm*>& db_pins,
+    RiseFall rf,
+    MinMax minmax)
+{
+  return getPinSlacks(staPins(db_pins), rf, minmax);
+}
+
+std::vector<float> Timing::getPinSlacks(
+    const std::vector<sta::Pin*>& sta_pins,
+    RiseFall rf,
+    MinMax minmax)
+{
+  std::vector<float> slacks;
+  slacks.reserve(sta_pins.size());
+  for (sta::Pin* sta_pin : sta_pins) {
+    slacks.push_back(getPinSlack(sta_pin, rf, minmax));
+  }
+  return slacks;
+}
+
 std::vector<sta::Corner*> Timing::getCorners()
 {
   sta::Corners* corners = getSta()->corners();
@@ -353,6 +459,18 @@ float Timing::getNetCap(odb::dbNet* net, sta::Corner* corner, MinMax minmax)
   return pin_cap + wire_cap;
 }
 
+std::vector<float> Timing::getNetCaps(const std::vector<odb::dbNet*>& nets,
+                                      sta::Corner* corner,
+                                      MinMax minmax)
+{
+  std::vector<float> caps;
+  caps.reserve(nets.size());
+  for (odb::dbNet* net : nets) {
+    caps.push_back(getNetCap(net, corner, minmax));
+  }
+  return caps;
+}
+
 float Timing::getPortCap(odb::dbITerm* pin, sta::Corner* corner, MinMax minmax)
 {
   sta::dbSta* sta = getSta();
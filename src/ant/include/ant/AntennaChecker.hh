@@ -32,8 +32,10 @@
 #pragma once
 
 #include <map>
+#include <memory>
 #include <queue>
 #include <set>
+#include <unordered_map>
 
 #include "odb/db.h"
 #include "odb/dbWireGraph.h"
@@ -53,6 +55,7 @@ struct AntennaModel;
 
 ///////////////////////////////////////
 struct GraphNode;
+class NetChangeTracker;
 
 struct NodeInfo
 {
@@ -108,6 +111,13 @@ struct ViolationReport
   ViolationReport() { violated = false; }
 };
 
+// Result of the last full check of a net, reused until the net changes.
+struct NetCheckResult
+{
+  int pin_violations;
+  ViolationReport report;
+};
+
 class GlobalRouteSource
 {
  public:
@@ -125,6 +135,13 @@ struct Violation
   int diode_count_per_gate;
 };
 
+// Gate and diffusion areas of a master terminal (max over its layers).
+struct MTermAreas
+{
+  double gate_area;
+  double diff_area;
+};
+
 using LayerToNodeInfo = std::map<odb::dbTechLayer*, NodeInfo>;
 using GraphNodes = std::vector<std::unique_ptr<GraphNode>>;
 using LayerToGraphNodes = std::map<odb::dbTechLayer*, GraphNodes>;
@@ -161,6 +178,9 @@ class AntennaChecker
                       double def);
   double diffArea(odb::dbMTerm* mterm);
   double gateArea(odb::dbMTerm* mterm);
+  double computeDiffArea(odb::dbMTerm* mterm);
+  double computeGateArea(odb::dbMTerm* mterm);
+  void initMTermAreas();
   std::vector<std::pair<double, std::vector<odb::dbITerm*>>> parMaxWireLength(
       odb::dbNet* net,
       int layer);
@@ -230,10 +250,17 @@ class AntennaChecker
   GlobalRouteSource* global_route_source_{nullptr};
   utl::Logger* logger_{nullptr};
   std::map<odb::dbTechLayer*, AntennaModel> layer_info_;
+  // Read-only while checking nets in parallel.
+  std::unordered_map<odb::dbMTerm*, MTermAreas> mterm_areas_;
   int net_violation_count_{0};
   std::string report_file_name_;
   std::vector<odb::dbNet*> nets_;
   std::map<odb::dbNet*, ViolationReport> net_to_report_;
+  // Incremental state of checkAntennas() over all nets.
+  std::unique_ptr<NetChangeTracker> net_tracker_;
+  std::map<odb::dbNet*, NetCheckResult> net_results_;
+  odb::dbBlock* net_results_block_{nullptr};
+  bool net_results_verbose_{false};
   // consts
   static constexpr int max_diode_count_per_gate = 10;
 };
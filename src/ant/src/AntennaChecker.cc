@@ -42,6 +42,7 @@
 #include <queue>
 #include <utility>
 
+#include "NetChangeTracker.hh"
 #include "Polygon.hh"
 #include "odb/db.h"
 #include "odb/dbShape.h"
@@ -108,6 +109,10 @@ void AntennaChecker::initAntennaRules()
     }
   }
 
+  if (mterm_areas_.empty()) {
+    initMTermAreas();
+  }
+
   if (!layer_info_.empty()) {
     return;
   }
@@ -186,7 +191,27 @@ void AntennaChecker::initAntennaRules()
   }
 }
 
+void AntennaChecker::initMTermAreas()
+{
+  for (odb::dbLib* lib : db_->getLibs()) {
+    for (odb::dbMaster* master : lib->getMasters()) {
+      for (odb::dbMTerm* mterm : master->getMTerms()) {
+        mterm_areas_[mterm] = {computeGateArea(mterm), computeDiffArea(mterm)};
+      }
+    }
+  }
+}
+
 double AntennaChecker::gateArea(odb::dbMTerm* mterm)
+{
+  auto it = mterm_areas_.find(mterm);
+  if (it != mterm_areas_.end()) {
+    return it->second.gate_area;
+  }
+  return computeGateArea(mterm);
+}
+
+double AntennaChecker::computeGateArea(odb::dbMTerm* mterm)
 {
   double max_gate_area = 0;
   if (mterm->hasDefaultAntennaModel()) {
@@ -1092,28 +1117,63 @@ int AntennaChecker::checkAntennas(odb::dbNet* net,
           ANT, 14, "Skipped net {} because it is special.", net->getName());
     }
   } else {
+    // Only nets changed since the previous full check are checked again.
+    if (!net_tracker_) {
+      net_tracker_ = std::make_unique<NetChangeTracker>();
+    }
+    if (net_results_block_ != block_ || net_results_verbose_ != verbose) {
+      net_results_.clear();
+      net_tracker_->addOwner(block_);
+      net_results_block_ = block_;
+      net_results_verbose_ = verbose;
+    }
+
     nets_.clear();
     for (odb::dbNet* net : block_->getNets()) {
-      if (!net->isSpecial()) {
+      if (!net->isSpecial()
+          && (net_tracker_->isDirty(net)
+              || net_results_.find(net) == net_results_.end())) {
         nets_.push_back(net);
       }
     }
+    std::vector<int> net_pin_violations(nets_.size(), 0);
     omp_set_num_threads(num_threads);
-#pragma omp parallel for schedule(dynamic) \
-    reduction(+ : net_violation_count, pin_violation_count)
+#pragma omp parallel for schedule(dynamic)
     for (int i = 0; i < nets_.size(); i++) {
       odb::dbNet* net = nets_[i];
       Violations antenna_violations;
+      int net_violations = 0;
       checkNet(net,
                verbose,
                false,
                report_file,
                nullptr,
                0,
-               net_violation_count,
-               pin_violation_count,
+               net_violations,
+               net_pin_violations[i],
                antenna_violations);
     }
+    for (int i = 0; i < nets_.size(); i++) {
+      net_results_[nets_[i]] = {net_pin_violations[i], net_to_report_[nets_[i]]};
+    }
+    net_tracker_->clear();
+
+    // Drop destroyed nets and restore the reports of the unchanged ones.
+    std::map<odb::dbNet*, NetCheckResult> net_results;
+    for (odb::dbNet* net : block_->getNets()) {
+      auto it = net_results_.find(net);
+      if (net->isSpecial() || it == net_results_.end()) {
+        continue;
+      }
+      const NetCheckResult& result = it->second;
+      if (result.pin_violations > 0) {
+        net_violation_count++;
+        pin_violation_count += result.pin_violations;
+      }
+      net_to_report_[net] = result.report;
+      net_results[net] = std::move(it->second);
+    }
+    net_results_ = std::move(net_results);
   }
 
   if (verbose) {
@@ -1156,6 +1216,15 @@ bool AntennaChecker::haveRoutedNets()
 }
 
 double AntennaChecker::diffArea(odb::dbMTerm* mterm)
+{
+  auto it = mterm_areas_.find(mterm);
+  if (it != mterm_areas_.end()) {
+    return it->second.diff_area;
+  }
+  return computeDiffArea(mterm);
+}
+
+double AntennaChecker::computeDiffArea(odb::dbMTerm* mterm)
 {
   double max_diff_area = 0.0;
   std::vector<std::pair<double, odb::dbTechLayer*>> diff_areas;
@@ -0,0 +1,129 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2020, MICL, DD-Lab, University of Michigan
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "NetChangeTracker.hh"
+
+namespace ant {
+
+bool NetChangeTracker::isDirty(odb::dbNet* net) const
+{
+  return dirty_nets_.find(net) != dirty_nets_.end();
+}
+
+void NetChangeTracker::markNet(odb::dbNet* net)
+{
+  if (net != nullptr) {
+    dirty_nets_.insert(net);
+  }
+}
+
+void NetChangeTracker::markWire(odb::dbWire* wire)
+{
+  markNet(wire->getNet());
+}
+
+void NetChangeTracker::markInst(odb::dbInst* inst)
+{
+  for (odb::dbITerm* iterm : inst->getITerms()) {
+    markNet(iterm->getNet());
+  }
+}
+
+void NetChangeTracker::inDbNetCreate(odb::dbNet* net)
+{
+  markNet(net);
+}
+
+void NetChangeTracker::inDbNetDestroy(odb::dbNet* net)
+{
+  // A new net may reuse the address; inDbNetCreate marks it again.
+  markNet(net);
+}
+
+void NetChangeTracker::inDbWireCreate(odb::dbWire* wire)
+{
+  markWire(wire);
+}
+
+void NetChangeTracker::inDbWireDestroy(odb::dbWire* wire)
+{
+  markWire(wire);
+}
+
+void NetChangeTracker::inDbWirePostModify(odb::dbWire* wire)
+{
+  markWire(wire);
+}
+
+void NetChangeTracker::inDbWirePostAttach(odb::dbWire* wire)
+{
+  markWire(wire);
+}
+
+void NetChangeTracker::inDbWirePostDetach(odb::dbWire* /* unused: wire */,
+                                          odb::dbNet* net)
+{
+  markNet(net);
+}
+
+void NetChangeTracker::inDbWirePostAppend(odb::dbWire* /* unused: src */,
+                                          odb::dbWire* dst)
+{
+  markWire(dst);
+}
+
+void NetChangeTracker::inDbWirePostCopy(odb::dbWire* /* unused: src */,
+                                        odb::dbWire* dst)
+{
+  markWire(dst);
+}
+
+void NetChangeTracker::inDbITermPostConnect(odb::dbITerm* iterm)
+{
+  markNet(iterm->getNet());
+}
+
+void NetChangeTracker::inDbITermPreDisconnect(odb::dbITerm* iterm)
+{
+  markNet(iterm->getNet());
+}
+
+void NetChangeTracker::inDbInstSwapMasterAfter(odb::dbInst* inst)
+{
+  markInst(inst);
+}
+
+void NetChangeTracker::inDbPostMoveInst(odb::dbInst* inst)
+{
+  markInst(inst);
+}
+
+}  // namespace ant
@@ -0,0 +1,72 @@
+// BSD 3-Clause License
+//
+// Copyright (c) 2020, MICL, DD-Lab, University of Michigan
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <unordered_set>
+
+#include "odb/db.h"
+#include "odb/dbBlockCallBackObj.h"
+
+namespace ant {
+
+// Records the nets whose wires or pin connections changed since the last
+// clear() so the antenna checker only rechecks those nets.
+class NetChangeTracker : public odb::dbBlockCallBackObj
+{
+ public:
+  bool isDirty(odb::dbNet* net) const;
+  void clear() { dirty_nets_.clear(); }
+
+  // from dbBlockCallBackObj API
+  void inDbNetCreate(odb::dbNet* net) override;
+  void inDbNetDestroy(odb::dbNet* net) override;
+  void inDbWireCreate(odb::dbWire* wire) override;
+  void inDbWireDestroy(odb::dbWire* wire) override;
+  void inDbWirePostModify(odb::dbWire* wire) override;
+  void inDbWirePostAttach(odb::dbWire* wire) override;
+  void inDbWirePostDetach(odb::dbWire* wire, odb::dbNet* net) override;
+  void inDbWirePostAppend(odb::dbWire* src, odb::dbWire* dst) override;
+  void inDbWirePostCopy(odb::dbWire* src, odb::dbWire* dst) override;
+  void inDbITermPostConnect(odb::dbITerm* iterm) override;
+  void inDbITermPreDisconnect(odb::dbITerm* iterm) override;
+  void inDbInstSwapMasterAfter(odb::dbInst* inst) override;
+  void inDbPostMoveInst(odb::dbInst* inst) override;
+
+ private:
+  void markNet(odb::dbNet* net);
+  void markWire(odb::dbWire* wire);
+  void markInst(odb::dbInst* inst);
+
+  std::unordered_set<odb::dbNet*> dirty_nets_;
+};
+
+}  // namespace ant
@@ -55,10 +55,14 @@ std::vector<int> findNodesWithIntersection(const GraphNodes& graph_nodes,
   obj += pol;
   obj += 1;
   Polygon& scaled_pol = obj[0];
+  Rectangle scaled_bbox;
+  gtl::extents(scaled_bbox, scaled_pol);
   int index = 0;
   std::vector<int> ids;
   for (const auto& node : graph_nodes) {
-    if (gtl::area(node->pol & scaled_pol) > 0) {
+    // only build the intersection of nodes whose extents overlap
+    if (gtl::intersects(node->bbox, scaled_bbox, false)
+        && gtl::area(node->pol & scaled_pol) > 0) {
       ids.push_back(index);
     }
     index++;
@@ -45,12 +45,14 @@ using namespace gtl::operators;
 using Polygon = gtl::polygon_90_data<int>;
 using PolygonSet = std::vector<Polygon>;
 using Point = gtl::polygon_traits<Polygon>::point_type;
+using Rectangle = gtl::rectangle_data<int>;
 
 struct GraphNode
 {
   int id;
   bool isVia;
   Polygon pol;
+  Rectangle bbox;
   std::vector<int> low_adj;
   std::set<PinType, PinTypeCmp> gates;
   GraphNode() = default;
@@ -59,6 +61,7 @@ struct GraphNode
     id = id_;
     isVia = isVia_;
     pol = pol_;
+    gtl::extents(bbox, pol);
   }
 };
 
@@ -43,11 +43,14 @@
 #include <algorithm>
 #include <array>
 #include <cfloat>
+#include <cmath>
 #include <cstdio>
 #include <cstdlib>
+#include <cstdint>
 #include <ctime>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <list>
 #include <map>
 #include <stack>
@@ -296,6 +299,10 @@ void Clustering::minCostFlow(const std::vector<std::pair<float, float>>& means,
                              const float dist,
                              const unsigned power)
 {
+  if (means.size() == 2 && assignToTwoMeans(means, cap, dist, power)) {
+    return;
+  }
+
   // Builds src -> [sink nodes] -> [cluster nodes] - > target
   ListDigraph graph;
 
@@ -425,6 +432,68 @@ void Clustering::minCostFlow(const std::vector<std::pair<float, float>>& means,
   }
 }
 
+// Solves the flow of minCostFlow directly for the common case of two means
+// that every sink can reach and whose capacities add up to the sink count.
+// Both means are then filled exactly, so the optimum sends to the first mean
+// the sinks that are cheapest there relative to the second one.  Returns false
+// when the case does not apply and the general flow has to be solved.
+bool Clustering::assignToTwoMeans(
+    const std::vector<std::pair<float, float>>& means,
+    const unsigned cap,
+    const float dist,
+    const unsigned power)
+{
+  const int remaining = sinks_.size() % means.size();
+  const size_t firstCap = remaining > 0 ? cap + 1 : cap;
+  if (firstCap + cap != sinks_.size()) {
+    return false;
+  }
+
+  // Same integer costs as the flow arcs.
+  std::vector<std::pair<int, int>> costs(sinks_.size());
+  for (size_t i = 0; i < sinks_.size(); ++i) {
+    int sinkCosts[2];
+    for (int j = 0; j < 2; ++j) {
+      float d = calcDist(means[j], &sinks_[i]);
+      if (d > dist) {
+        return false;
+      }
+      d = std::pow(d, power);
+      if (d >= std::numeric_limits<int>::max()) {
+        return false;
+      }
+      sinkCosts[j] = d;
+    }
+    costs[i] = {sinkCosts[0], sinkCosts[1]};
+  }
+
+  std::vector<unsigned> order(sinks_.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    order[i] = i;
+  }
+  auto firstMeanGain = [&costs](const unsigned i) {
+    return (int64_t) costs[i].first - costs[i].second;
+  };
+  std::stable_sort(
+      order.begin(),
+      order.end(),
+      [&firstMeanGain](const unsigned a, const unsigned b) {
+        return firstMeanGain(a) < firstMeanGain(b);
+      });
+
+  for (size_t i = 0; i < order.size(); ++i) {
+    sinks_[order[i]].cluster_idx = i < firstCap ? 0 : 1;
+  }
+
+  debugPrint(logger_,
+             CTS,
+             "clustering",
+             1,
+             "Assigned {} sinks to two means without a flow graph",
+             sinks_.size());
+  return true;
+}
+
 void Clustering::getClusters(
     std::vector<std::vector<unsigned>>& newClusters) const
 {
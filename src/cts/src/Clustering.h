@@ -76,6 +76,10 @@ class Clustering
                    unsigned cap,
                    float dist,
                    unsigned power);
+  bool assignToTwoMeans(const std::vector<std::pair<float, float>>& means,
+                        unsigned cap,
+                        float dist,
+                        unsigned power);
   void fixSegmentLengths(std::vector<std::pair<float, float>>& means);
   void fixSegment(const std::pair<float, float>& fixedPoint,
                   float targetDist,
@@ -133,6 +133,8 @@ class CtsOptions
     metricFile_ = metricFile;
   }
   std::string getMetricsFile() const { return metricFile_; }
+  void setCharCacheFile(const std::string& file) { charCacheFile_ = file; }
+  std::string getCharCacheFile() const { return charCacheFile_; }
   void setNumClockRoots(unsigned roots) { clockRoots_ = roots; }
   int getNumClockRoots() const { return clockRoots_; }
   void setNumClockSubnets(int nets) { clockSubnets_ = nets; }
@@ -256,6 +258,7 @@ class CtsOptions
   std::string sinkBuffer_ = "";
   std::string treeBuffer_ = "";
   std::string metricFile_ = "";
+  std::string charCacheFile_ = "";
   int dbUnits_ = -1;
   unsigned wireSegmentUnit_ = 0;
   bool plotSolution_ = false;
@@ -35,15 +35,19 @@
 
 #include "HTreeBuilder.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <vector>
 
 #include "Clustering.h"
 #include "SinkClustering.h"
+#include "ord/OpenRoad.hh"
 #include "utl/Logger.h"
+#include "utl/exception.h"
 
 namespace cts {
 
@@ -1467,73 +1471,73 @@ unsigned HTreeBuilder::computeMinDelaySegment(const unsigned length,
                                               unsigned& outputSlew,
                                               unsigned& outputCap) const
 {
-  unsigned minKey = std::numeric_limits<unsigned>::max();
-  unsigned minDelay = std::numeric_limits<unsigned>::max();
-  unsigned minBufKey = std::numeric_limits<unsigned>::max();
-  unsigned minBufDelay = std::numeric_limits<unsigned>::max();
+  // The search retries with a growing input cap/slew tolerance until a
+  // segment is found.  Rather than rescanning the characterization for
+  // every tolerance, a single scan keeps the best segment of each one.
+  // A segment that matches within a tolerance matches all larger ones.
+  const unsigned MAX_TOLERANCE = 10;
+  const unsigned maxTolerance = std::max(tolerance, MAX_TOLERANCE);
+  const unsigned numTolerances = maxTolerance - tolerance + 1;
+  const unsigned noKey = std::numeric_limits<unsigned>::max();
+  std::vector<unsigned> minKey(numTolerances, noKey);
+  std::vector<unsigned> minDelay(numTolerances, noKey);
+  std::vector<unsigned> minBufKey(numTolerances, noKey);
+  std::vector<unsigned> minBufDelay(numTolerances, noKey);
 
   for (int load = 1; load <= techChar_->getMaxCapacitance(); ++load) {
     for (int outSlew = 1; outSlew <= techChar_->getMaxSlew(); ++outSlew) {
       techChar_->forEachWireSegment(
           length, load, outSlew, [&](unsigned key, const WireSegment& seg) {
-            if (std::abs((int) seg.getInputCap() - (int) inputCap) > tolerance
-                || std::abs((int) seg.getInputSlew() - (int) inputSlew)
-                       > tolerance) {
-              return;
-            }
-
-            if (seg.getDelay() < minDelay) {
-              minDelay = seg.getDelay();
-              minKey = key;
-            }
-
-            if (seg.isBuffered() && seg.getDelay() < minBufDelay) {
-              minBufDelay = seg.getDelay();
-              minBufKey = key;
+            const unsigned diff = std::max(
+                std::abs((int) seg.getInputCap() - (int) inputCap),
+                std::abs((int) seg.getInputSlew() - (int) inputSlew));
+            for (unsigned i = std::max(diff, tolerance) - tolerance;
+                 i < numTolerances;
+                 ++i) {
+              if (seg.getDelay() < minDelay[i]) {
+                minDelay[i] = seg.getDelay();
+                minKey[i] = key;
+              }
+              if (seg.isBuffered() && seg.getDelay() < minBufDelay[i]) {
+                minBufDelay[i] = seg.getDelay();
+                minBufKey[i] = key;
+              }
             }
           });
     }
   }
 
-  const unsigned MAX_TOLERANCE = 10;
-  if (inputSlew >= slewThreshold) {
-    if (minBufKey < std::numeric_limits<unsigned>::max()) {
-      const WireSegment& bestBufSegment = techChar_->getWireSegment(minBufKey);
-      outputSlew = bestBufSegment.getOutputSlew();
-      outputCap = bestBufSegment.getLoad();
-      return minBufKey;
+  for (unsigned i = 0; i < numTolerances; ++i) {
+    const bool lastTolerance = tolerance + i >= MAX_TOLERANCE;
+    if (inputSlew >= slewThreshold) {
+      if (minBufKey[i] != noKey) {
+        const WireSegment& bestBufSegment
+            = techChar_->getWireSegment(minBufKey[i]);
+        outputSlew = bestBufSegment.getOutputSlew();
+        outputCap = bestBufSegment.getLoad();
+        return minBufKey[i];
+      }
+      if (!lastTolerance) {
+        // Increasing tolerance
+        continue;
+      }
     }
-    if (tolerance < MAX_TOLERANCE) {
+
+    if (minKey[i] == noKey) {
+      if (lastTolerance) {
+        return noKey;
+      }
       // Increasing tolerance
-      return computeMinDelaySegment(length,
-                                    inputSlew,
-                                    inputCap,
-                                    slewThreshold,
-                                    tolerance + 1,
-                                    outputSlew,
-                                    outputCap);
+      continue;
     }
-  }
 
-  if (minKey == std::numeric_limits<unsigned>::max()) {
-    if (tolerance >= MAX_TOLERANCE) {
-      return minKey;
-    }
-    // Increasing tolerance
-    return computeMinDelaySegment(length,
-                                  inputSlew,
-                                  inputCap,
-                                  slewThreshold,
-                                  tolerance + 1,
-                                  outputSlew,
-                                  outputCap);
+    const WireSegment& bestSegment = techChar_->getWireSegment(minKey[i]);
+    outputSlew
+        = std::max((unsigned) bestSegment.getOutputSlew(), inputSlew + 1);
+    outputCap = bestSegment.getLoad();
+    return minKey[i];
   }
-
-  const WireSegment& bestSegment = techChar_->getWireSegment(minKey);
-  outputSlew = std::max((unsigned) bestSegment.getOutputSlew(), inputSlew + 1);
-  outputCap = bestSegment.getLoad();
-
-  return minKey;
+  return noKey;
 }
 
 unsigned HTreeBuilder::computeMinDelaySegment(const unsigned length,
@@ -1630,6 +1634,14 @@ void HTreeBuilder::computeBranchingPoints(const unsigned level,
   }
 
   LevelTopology& parentTopology = topologyForEachLevel_[level - 2];
+  struct Split
+  {
+    unsigned parentIdx;
+    Point<double> clockRoot;
+    unsigned branchPtIdx1;
+    unsigned branchPtIdx2;
+  };
+  std::vector<Split> splits;
   parentTopology.forEachBranchingPoint(
       [&](unsigned idx, Point<double> clockRoot) {
         Point<double> low(clockRoot);
@@ -1643,12 +1655,32 @@ void HTreeBuilder::computeBranchingPoints(const unsigned level,
         }
         const unsigned branchPtIdx1 = topology.addBranchingPoint(low, idx);
         const unsigned branchPtIdx2 = topology.addBranchingPoint(high, idx);
-
-        std::vector<std::pair<float, float>> sinks;
-        computeBranchSinks(parentTopology, idx, sinks);
-        refineBranchingPointsWithClustering(
-            topology, level, branchPtIdx1, branchPtIdx2, clockRoot, sinks);
+        splits.push_back({idx, clockRoot, branchPtIdx1, branchPtIdx2});
       });
+
+  // Each split clusters the sinks of one parent branch into its own two
+  // branching points, so the splits are independent once all the points
+  // have been added.
+  const int thread_count = ord::OpenRoad::openRoad()->getThreadCount();
+  const int split_count = splits.size();
+  utl::ThreadException exception;
+#pragma omp parallel for schedule(dynamic) num_threads(thread_count)
+  for (int i = 0; i < split_count; ++i) {  // NOLINT
+    try {
+      const Split& split = splits[i];
+      std::vector<std::pair<float, float>> sinks;
+      computeBranchSinks(parentTopology, split.parentIdx, sinks);
+      refineBranchingPointsWithClustering(topology,
+                                          level,
+                                          split.branchPtIdx1,
+                                          split.branchPtIdx2,
+                                          split.clockRoot,
+                                          sinks);
+    } catch (...) {
+      exception.capture();
+    }
+  }
+  exception.rethrow();
 }
 
 void HTreeBuilder::initTopLevelSinks(
@@ -38,6 +38,7 @@
 #include <algorithm>
 #include <fstream>
 #include <iomanip>
+#include <limits>
 #include <ostream>
 #include <sstream>
 
@@ -1541,10 +1542,117 @@ unsigned TechChar::normalizeCharResults(float value,
   return normVal;
 }
 
-void TechChar::create()
+// Describes every input of the characterization sweep. Two runs with the same
+// key produce the same results.
+std::string TechChar::characterizationKey() const
+{
+  std::stringstream key;
+  key << std::setprecision(std::numeric_limits<double>::max_digits10);
+  key << "buf " << charBuf_->getName();
+  for (const std::string& masterName : masterNames_) {
+    key << " " << masterName;
+    odb::dbMaster* master = db_->findMaster(masterName.c_str());
+    sta::LibertyCell* libertyCell
+        = db_network_->libertyCell(db_network_->dbToSta(master));
+    if (libertyCell) {
+      key << "@" << libertyCell->libertyLibrary()->filename();
+    }
+  }
+  key << "; res " << resPerDBU_ << " cap " << capPerDBU_;
+  key << "; wl";
+  for (float wirelength : wirelengthsToTest_) {
+    key << " " << wirelength;
+  }
+  key << "; load";
+  for (float load : loadsToTest_) {
+    key << " " << load;
+  }
+  key << "; slew";
+  for (float slew : slewsToTest_) {
+    key << " " << slew;
+  }
+  return key.str();
+}
+
+bool TechChar::loadCharacterization(const std::string& key)
+{
+  if (!cachedCharKey_.empty() && cachedCharKey_ == key) {
+    solutionMap_ = cachedSolutionMap_;
+    return true;
+  }
+
+  const std::string fileName = options_->getCharCacheFile();
+  if (fileName.empty()) {
+    return false;
+  }
+  std::ifstream file(fileName);
+  std::string fileKey;
+  if (!file.is_open() || !std::getline(file, fileKey) || fileKey != key) {
+    return false;
+  }
+
+  std::map<CharKey, std::vector<ResultData>> solutionMap;
+  ResultData results;
+  size_t topologySize;
+  while (file >> results.load >> results.inSlew >> results.wirelength
+         >> results.pinSlew >> results.pinArrival >> results.totalcap
+         >> results.totalPower >> results.isPureWire >> topologySize) {
+    results.topology.resize(topologySize);
+    for (std::string& node : results.topology) {
+      file >> node;
+    }
+    CharKey solutionKey;
+    solutionKey.wirelength = results.wirelength;
+    solutionKey.pinSlew = results.pinSlew;
+    solutionKey.load = results.load;
+    solutionKey.totalcap = results.totalcap;
+    solutionMap[solutionKey].push_back(results);
+  }
+  if (!file.eof() || solutionMap.empty()) {
+    return false;
+  }
+
+  logger_->info(CTS, 126, "Loaded characterization from {}.", fileName);
+  solutionMap_ = std::move(solutionMap);
+  cachedCharKey_ = key;
+  cachedSolutionMap_ = solutionMap_;
+  return true;
+}
+
+void TechChar::saveCharacterization(const std::string& key)
+{
+  cachedCharKey_ = key;
+  cachedSolutionMap_ = solutionMap_;
+
+  const std::string fileName = options_->getCharCacheFile();
+  if (fileName.empty()) {
+    return;
+  }
+  std::ofstream file(fileName);
+  if (!file.is_open()) {
+    logger_->warn(
+        CTS, 127, "Could not write characterization cache {}.", fileName);
+    return;
+  }
+  file << std::setprecision(std::numeric_limits<float>::max_digits10);
+  file << key << "\n";
+  for (const auto& [solutionKey, resultGroup] : solutionMap_) {
+    for (const ResultData& results : resultGroup) {
+      file << results.load << " " << results.inSlew << " "
+           << results.wirelength << " " << results.pinSlew << " "
+           << results.pinArrival << " " << results.totalcap << " "
+           << results.totalPower << " " << results.isPureWire << " "
+           << results.topology.size();
+      for (const std::string& node : results.topology) {
+        file << " " << node;
+      }
+      file << "\n";
+    }
+  }
+}
+
+void TechChar::characterizeSegments()
 {
-  // Setup of the attributes required to run the characterization.
-  initCharacterization();
   long unsigned int topologiesCreated = 0;
   for (unsigned setupWirelength : wirelengthsToTest_) {
     // Creates the topologies for the current wirelength.
@@ -1678,6 +1786,20 @@ void TechChar::create()
     logger_->info(
         CTS, 39, "Number of created patterns = {}.", topologiesCreated);
   }
+}
+
+void TechChar::create()
+{
+  // Setup of the attributes required to run the characterization.
+  initCharacterization();
+  // The sweep results depend only on its inputs, so reuse them when those
+  // match an earlier run in this session or the cache file.
+  solutionMap_.clear();
+  const std::string charKey = characterizationKey();
+  if (!loadCharacterization(charKey)) {
+    characterizeSegments();
+    saveCharacterization(charKey);
+  }
   // Post-processing of the results.
   const std::vector<ResultData> convertedSolutions
       = characterizationPostProcess();
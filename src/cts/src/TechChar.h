@@ -45,6 +45,7 @@
 #include <deque>
 #include <functional>
 #include <iostream>
+#include <map>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -302,6 +303,10 @@ class TechChar
                           unsigned nodeIndex,
                           const std::string& newMasterName);
   std::vector<ResultData> characterizationPostProcess();
+  void characterizeSegments();
+  std::string characterizationKey() const;
+  bool loadCharacterization(const std::string& key);
+  void saveCharacterization(const std::string& key);
   unsigned normalizeCharResults(float value,
                                 float iter,
                                 unsigned* min,
@@ -351,6 +356,9 @@ class TechChar
   std::vector<float> slewsToTest_;
 
   std::map<CharKey, std::vector<ResultData>> solutionMap_;
+  // sweep results of the last characterization, reused while its key matches
+  std::string cachedCharKey_;
+  std::map<CharKey, std::vector<ResultData>> cachedSolutionMap_;
   // keep track of acceptable buffering combinations in topology
   boost::unordered_map<std::pair<size_t, size_t>, unsigned, PairHash, PairEqual>
       bufferingComboTable_;
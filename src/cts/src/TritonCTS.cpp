@@ -59,6 +59,7 @@
 #include "sta/PatternMatch.hh"
 #include "sta/Sdc.hh"
 #include "utl/Logger.h"
+#include "utl/exception.h"
 
 namespace cts {
 
@@ -227,7 +228,36 @@ void TritonCTS::buildClockTrees()
     builder->setDb(db_);
     builder->setLogger(logger_);
     builder->initBlockages();
-    builder->run();
+  }
+
+  // Each tree is built on its own Clock and only written to the db later by
+  // writeDataToDb, so the builds are independent.  Fake LUT entries extend
+  // the shared TechChar, and plots and the observer are not thread safe, so
+  // those keep the serial order.
+  const int thread_count = ord::OpenRoad::openRoad()->getThreadCount();
+  const bool parallel = thread_count > 1 && builders_->size() > 1
+                        && !options_->isFakeLutEntriesEnabled()
+                        && !options_->getPlotSolution()
+                        && options_->getObserver() == nullptr
+                        && !logger_->debugCheck(CTS, "HTree", 2);
+  if (parallel) {
+    const int builder_count = builders_->size();
+    // The builders report errors by throwing, which must not leave the
+    // parallel region.
+    utl::ThreadException exception;
+#pragma omp parallel for schedule(dynamic) num_threads(thread_count)
+    for (int i = 0; i < builder_count; i++) {  // NOLINT
+      try {
+        (*builders_)[i]->run();
+      } catch (...) {
+        exception.capture();
+      }
+    }
+    exception.rethrow();
+  } else {
+    for (TreeBuilder* builder : *builders_) {
+      builder->run();
+    }
   }
 
   if (options_->getBalanceLevels()) {
@@ -1998,16 +2028,26 @@ void TritonCTS::balanceMacroRegisterLatencies()
     return;
   }
 
+  // Measure every tree pair before inserting any delay buffer.  The pairs are
+  // independent, so this brings timing up to date once instead of after each
+  // pair's edits.
+  std::vector<std::pair<TreeBuilder*, TreeBuilder*>> treePairs;
   for (TreeBuilder* registerBuilder : *builders_) {
     if (registerBuilder->getTreeType() == TreeType::RegisterTree) {
       TreeBuilder* macroBuilder = registerBuilder->getParent();
       if (macroBuilder) {
         computeAveSinkArrivals(registerBuilder);
         computeAveSinkArrivals(macroBuilder);
-        adjustLatencies(macroBuilder, registerBuilder);
+        computeTopBufferDelay(registerBuilder);
+        computeTopBufferDelay(macroBuilder);
+        treePairs.emplace_back(macroBuilder, registerBuilder);
       }
     }
   }
+
+  for (const auto& [macroBuilder, registerBuilder] : treePairs) {
+    adjustLatencies(macroBuilder, registerBuilder);
+  }
 }
 
 void TritonCTS::computeAveSinkArrivals(TreeBuilder* builder)
@@ -2057,14 +2097,11 @@ void TritonCTS::computeAveSinkArrivals(TreeBuilder* builder)
 }
 
 // Balance latencies between macro tree and register tree
-// by adding delay buffers to one tree
+// by adding delay buffers to one tree.  Both trees must have been measured
+// with computeAveSinkArrivals and computeTopBufferDelay.
 void TritonCTS::adjustLatencies(TreeBuilder* macroBuilder,
                                 TreeBuilder* registerBuilder)
 {
-  // compute top buffer delays
-  computeTopBufferDelay(registerBuilder);
-  computeTopBufferDelay(macroBuilder);
-
   float latencyDiff = macroBuilder->getAveSinkArrival()
                       - registerBuilder->getAveSinkArrival();
   int numBuffers = 0;
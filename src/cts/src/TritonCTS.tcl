@@ -89,6 +89,7 @@ sta::define_cmd_args "clock_tree_synthesis" {[-wire_unit unit]
                                              [-sink_buffer_max_cap_derate] \
                                              [-dont_use_dummy_load] \
                                              [-delay_buffer_derate] \
+                                             [-char_cache_file file] \
 };# checker off
 
 proc clock_tree_synthesis { args } {
@@ -99,7 +100,7 @@ proc clock_tree_synthesis { args } {
           -clustering_exponent \
           -clustering_unbalance_ratio -sink_clustering_max_diameter \
           -sink_clustering_levels -tree_buf \
-          -sink_buffer_max_cap_derate -delay_buffer_derate} \
+          -sink_buffer_max_cap_derate -delay_buffer_derate -char_cache_file} \
     flags {-post_cts_disable -sink_clustering_enable -balance_levels \
            -obstruction_aware -apply_ndr -dont_use_dummy_load
   };# checker off
@@ -209,6 +210,12 @@ proc clock_tree_synthesis { args } {
     cts::set_delay_buffer_derate $buffer_derate
   }
 
+  if { [info exists keys(-char_cache_file)] } {
+    cts::set_char_cache_file $keys(-char_cache_file)
+  } else {
+    cts::set_char_cache_file ""
+  }
+
   cts::set_obstruction_aware [info exists flags(-obstruction_aware)]
 
   if { [info exists flags(-dont_use_dummy_load)] } {
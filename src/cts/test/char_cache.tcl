@@ -0,0 +1,40 @@
+# clock_tree_synthesis -char_cache_file saves the characterization, and a
+# second run with the same setup reuses it and builds the same tree
+source "helpers.tcl"
+read_lef Nangate45/Nangate45.lef
+read_liberty Nangate45/Nangate45_typ.lib
+read_def "16sinks.def"
+
+create_clock -period 5 clk
+
+set_wire_rc -clock -layer metal3
+
+set cache_file [make_result_file char_cache.txt]
+file delete $cache_file
+
+clock_tree_synthesis -root_buf CLKBUF_X3 \
+                     -buf_list CLKBUF_X3 \
+                     -wire_unit 20 \
+                     -char_cache_file $cache_file
+
+puts "cache written: [expr [file exists $cache_file] && [file size $cache_file] > 0]"
+set def_file1 [make_result_file char_cache1.def]
+write_def $def_file1
+
+clear
+read_lef Nangate45/Nangate45.lef
+read_liberty Nangate45/Nangate45_typ.lib
+read_def "16sinks.def"
+
+create_clock -period 5 clk
+
+set_wire_rc -clock -layer metal3
+
+clock_tree_synthesis -root_buf CLKBUF_X3 \
+                     -buf_list CLKBUF_X3 \
+                     -wire_unit 20 \
+                     -char_cache_file $cache_file
+
+set def_file2 [make_result_file char_cache2.def]
+write_def $def_file2
+diff_files $def_file1 $def_file2
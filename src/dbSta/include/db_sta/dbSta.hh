@@ -35,7 +35,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "odb/db.h"
 #include "odb/dbBlockCallBackObj.h"
@@ -172,13 +176,26 @@ class dbSta : public Sta, public ord::OpenRoadObserver
   InstType getInstanceType(odb::dbInst* inst);
   void report_cell_usage(bool verbose);
 
+  // Make parasitics for corner from the RC network extracted into the
+  // block for ext_corner without writing and reading SPEF.
+  void readDbParasitics(const Corner* corner, int ext_corner);
+
   using Sta::netSlack;
   using Sta::replaceCell;
 
+  // The liberty reader parses one file at a time.  Reading the files
+  // into the page cache on a background thread keeps it from waiting on
+  // the file system.
+  void prefetchFiles(const std::vector<std::string>& filenames);
+  void stopPrefetch();
+
  private:
   void makeReport() override;
   void makeNetwork() override;
   void makeSdcNetwork() override;
+  InstType getInstanceType(odb::dbMaster* master,
+                           odb::dbSourceType source_type);
+  InstType clockTreeType(odb::dbInst* inst, InstType type);
 
   void replaceCell(Instance* inst,
                    Cell* to_cell,
@@ -194,6 +211,9 @@ class dbSta : public Sta, public ord::OpenRoadObserver
 
   std::unique_ptr<AbstractPathRenderer> path_renderer_;
   std::unique_ptr<AbstractPowerDensityDataSource> power_density_data_source_;
+
+  std::thread prefetch_thread_;
+  std::atomic<bool> prefetch_stop_{false};
 };
 
 }  // namespace sta
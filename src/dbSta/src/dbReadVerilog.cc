@@ -194,6 +194,9 @@ class Verilog2db
   // We have to store dont_touch instances and apply the attribute after
   // creating iterms; as iterms can't be added to a dont_touch inst
   std::vector<dbInst*> dont_touch_insts;
+  // Leaf instances made by makeDbModule so makeDbNets can connect pins
+  // without rebuilding and looking up each hierarchical path name.
+  std::map<const Instance*, dbInst*> inst_map_;
   bool hierarchy_ = false;
 };
 
@@ -470,6 +473,7 @@ void Verilog2db::makeDbModule(
         continue;
       }
       auto db_inst = dbInst::create(block_, master, child_name, false, module);
+      inst_map_[child] = db_inst;
 
       // Yosys writes a src attribute on sequential instances to give the
       // Verilog source info.
@@ -650,9 +654,9 @@ void Verilog2db::makeDbNets(const Instance* inst)
         } else if (network_->isLeaf(pin)) {
           const char* port_name = network_->portName(pin);
           Instance* inst = network_->instance(pin);
-          const char* inst_name = network_->pathName(inst);
-          dbInst* db_inst = block_->findInst(inst_name);
-          if (db_inst) {
+          auto inst_iter = inst_map_.find(inst);
+          if (inst_iter != inst_map_.end()) {
+            dbInst* db_inst = inst_iter->second;
             dbMaster* master = db_inst->getMaster();
             dbMTerm* mterm = master->findMTerm(block_, port_name);
             if (mterm) {
@@ -44,6 +44,7 @@
 #include <tcl.h>
 
 #include <algorithm>  // min
+#include <fstream>
 #include <mutex>
 
 #include "AbstractPathRenderer.h"
@@ -53,11 +54,14 @@
 #include "db_sta/dbNetwork.hh"
 #include "odb/db.h"
 #include "ord/OpenRoad.hh"
+#include "sta/ArcDelayCalc.hh"
 #include "sta/Bfs.hh"
 #include "sta/Clock.hh"
+#include "sta/Corner.hh"
 #include "sta/EquivCells.hh"
 #include "sta/Graph.hh"
 #include "sta/Liberty.hh"
+#include "sta/Parasitics.hh"
 #include "sta/PathExpanded.hh"
 #include "sta/PathRef.hh"
 #include "sta/ReportTcl.hh"
@@ -173,7 +177,35 @@ dbStaState::~dbStaState()
 
 ////////////////////////////////////////////////////////////////
 
-dbSta::~dbSta() = default;
+dbSta::~dbSta()
+{
+  stopPrefetch();
+}
+
+void dbSta::prefetchFiles(const std::vector<std::string>& filenames)
+{
+  stopPrefetch();
+  prefetch_thread_ = std::thread([this, filenames] {
+    std::vector<char> buffer(1 << 20);
+    for (const std::string& filename : filenames) {
+      std::ifstream file(filename, std::ios::binary);
+      while (!prefetch_stop_ && file.read(buffer.data(), buffer.size())) {
+      }
+      if (prefetch_stop_) {
+        return;
+      }
+    }
+  });
+}
+
+void dbSta::stopPrefetch()
+{
+  if (prefetch_thread_.joinable()) {
+    prefetch_stop_ = true;
+    prefetch_thread_.join();
+  }
+  prefetch_stop_ = false;
+}
 
 void dbSta::initVars(Tcl_Interp* tcl_interp,
                      odb::dbDatabase* db,
@@ -228,6 +260,9 @@ std::unique_ptr<dbSta> dbSta::makeBlockSta(odb::dbBlock* block)
   clone->getDbNetwork()->setDefaultLibertyLibrary(
       network_->defaultLibertyLibrary());
   clone->copyUnits(units());
+  // Propagate the thread count so the block's dcalc and search run on the
+  // same threads as the top level sta.
+  clone->setThreadCount(threadCount());
   return clone;
 }
 
@@ -387,9 +422,36 @@ std::string dbSta::getInstanceTypeText(InstType type)
 
 dbSta::InstType dbSta::getInstanceType(odb::dbInst* inst)
 {
-  odb::dbMaster* master = inst->getMaster();
+  const InstType type
+      = getInstanceType(inst->getMaster(), inst->getSourceType());
+  return clockTreeType(inst, type);
+}
+
+// Timing repair buffers and inverters driving or loading a clock net are
+// clock tree cells.
+dbSta::InstType dbSta::clockTreeType(odb::dbInst* inst, const InstType type)
+{
+  if (type != STD_INV_TIMING_REPAIR && type != STD_BUF_TIMING_REPAIR) {
+    return type;
+  }
+  for (auto* iterm : inst->getITerms()) {
+    // look through iterms and check for clock nets
+    auto* net = iterm->getNet();
+    if (net == nullptr) {
+      continue;
+    }
+    if (net->getSigType() == odb::dbSigType::CLOCK) {
+      return type == STD_INV_TIMING_REPAIR ? STD_INV_CLK_TREE
+                                           : STD_BUF_CLK_TREE;
+    }
+  }
+  return type;
+}
+
+dbSta::InstType dbSta::getInstanceType(odb::dbMaster* master,
+                                       const odb::dbSourceType source_type)
+{
   const auto master_type = master->getType();
-  const auto source_type = inst->getSourceType();
   if (master->isBlock()) {
     return BLOCK;
   }
@@ -458,16 +520,6 @@ dbSta::InstType dbSta::getInstanceType(odb::dbInst* inst)
   const bool is_inverter = lib_cell->isInverter();
   if (is_inverter || lib_cell->isBuffer()) {
     if (source_type == odb::dbSourceType::TIMING) {
-      for (auto* iterm : inst->getITerms()) {
-        // look through iterms and check for clock nets
-        auto* net = iterm->getNet();
-        if (net == nullptr) {
-          continue;
-        }
-        if (net->getSigType() == odb::dbSigType::CLOCK) {
-          return is_inverter ? STD_INV_CLK_TREE : STD_BUF_CLK_TREE;
-        }
-      }
       return is_inverter ? STD_INV_TIMING_REPAIR : STD_BUF_TIMING_REPAIR;
     }
     return is_inverter ? STD_INV : STD_BUF;
@@ -492,9 +544,19 @@ std::map<dbSta::InstType, dbSta::TypeStats> dbSta::countInstancesByType()
 {
   auto insts = db_->getChip()->getBlock()->getInsts();
   std::map<InstType, TypeStats> inst_type_stats;
+  // The master and liberty checks only depend on the master and source
+  // type, so do them once per pair instead of once per instance.
+  std::map<std::pair<dbMaster*, odb::dbSourceType::Value>, InstType>
+      master_types;
 
   for (auto inst : insts) {
-    InstType type = getInstanceType(inst);
+    auto [type_iter, inserted] = master_types.try_emplace(
+        {inst->getMaster(), inst->getSourceType().getValue()});
+    if (inserted) {
+      type_iter->second
+          = getInstanceType(inst->getMaster(), inst->getSourceType());
+    }
+    InstType type = clockTreeType(inst, type_iter->second);
     auto& stats = inst_type_stats[type];
     stats.count++;
     auto master = inst->getMaster();
@@ -541,6 +603,91 @@ void dbSta::report_cell_usage(const bool verbose)
 
 ////////////////////////////////////////////////////////////////
 
+void dbSta::readDbParasitics(const Corner* corner, const int ext_corner)
+{
+  dbBlock* block = db_network_->block();
+  int net_count, rseg_count, cap_node_count, cc_count;
+  block->getExtCount(net_count, rseg_count, cap_node_count, cc_count);
+  if (rseg_count == 0 || cap_node_count == 0) {
+    logger_->warn(STA, 2030, "No extracted parasitics in the block.");
+    return;
+  }
+  if (ext_corner < 0 || ext_corner >= block->getCornerCount()) {
+    logger_->error(STA,
+                   2031,
+                   "Extraction corner {} is not in [0, {}).",
+                   ext_corner,
+                   block->getCornerCount());
+  }
+  // rcx keeps node caps read from SPEF as is, otherwise each segment's
+  // cap is split between its ends as write_spef does.
+  const bool node_caps = block->getExtControl()->_foreign;
+  // rcx RC values are in fF and ohms.
+  constexpr double cap_unit = 1e-15;
+  const ParasiticAnalysisPt* parasitic_ap
+      = corner->findParasiticAnalysisPt(MinMax::max());
+  int parasitic_count = 0;
+  for (dbNet* db_net : block->getNets()) {
+    if (db_net->getSigType().isSupply() || db_net->getRSegs().empty()) {
+      continue;
+    }
+    Net* net = db_network_->dbToSta(db_net);
+    Parasitic* parasitic = makeParasiticNetwork(net, false, parasitic_ap);
+    auto ensure_node = [&](odb::dbCapNode* cap_node) -> ParasiticNode* {
+      if (cap_node->isITerm()) {
+        return parasitics_->ensureParasiticNode(
+            parasitic, db_network_->dbToSta(cap_node->getITerm()), network_);
+      }
+      if (cap_node->isBTerm()) {
+        return parasitics_->ensureParasiticNode(
+            parasitic, db_network_->dbToSta(cap_node->getBTerm()), network_);
+      }
+      return parasitics_->ensureParasiticNode(
+          parasitic, net, cap_node->getId(), network_);
+    };
+    for (odb::dbCapNode* cap_node : db_net->getCapNodes()) {
+      double cap = node_caps ? cap_node->getCapacitance(ext_corner) : 0.0;
+      // Coupling caps are grounded like read_spef without
+      // -keep_capacitive_coupling.
+      for (odb::dbCCSeg* cc_seg : cap_node->getCCSegs()) {
+        cap += cc_seg->getCapacitance(ext_corner);
+      }
+      if (cap > 0.0) {
+        parasitics_->incrCap(ensure_node(cap_node), cap * cap_unit);
+      }
+    }
+    size_t resistor_id = 1;
+    for (odb::dbRSeg* rseg : db_net->getRSegs()) {
+      odb::dbCapNode* src_node = rseg->getSourceCapNode();
+      odb::dbCapNode* tgt_node = rseg->getTargetCapNode();
+      if (src_node == nullptr || tgt_node == nullptr) {
+        continue;
+      }
+      ParasiticNode* n1 = ensure_node(src_node);
+      ParasiticNode* n2 = ensure_node(tgt_node);
+      if (!node_caps) {
+        const double cap = rseg->getCapacitance(ext_corner) * cap_unit;
+        parasitics_->incrCap(n1, cap / 2.0);
+        parasitics_->incrCap(n2, cap / 2.0);
+      }
+      parasitics_->makeResistor(
+          parasitic, resistor_id++, rseg->getResistance(ext_corner), n1, n2);
+    }
+    arc_delay_calc_->reduceParasitic(
+        parasitic, net, corner, MinMaxAll::all());
+    parasitics_->deleteParasiticNetworks(net);
+    parasitic_count++;
+  }
+  delaysInvalid();
+  logger_->info(STA,
+                2032,
+                "Made parasitics for {} nets from extraction corner {}.",
+                parasitic_count,
+                ext_corner);
+}
+
+////////////////////////////////////////////////////////////////
+
 // Network edit functions.
 // These override the default sta functions that call sta before/after
 // functions because the db calls them via callbacks.
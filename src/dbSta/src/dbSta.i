@@ -1,5 +1,9 @@
 %{
 
+#include <sstream>
+#include <string>
+#include <vector>
+
 #include "odb/db.h"
 #include "db_sta/dbSta.hh"
 #include "db_sta/dbNetwork.hh"
@@ -173,6 +177,41 @@ report_cell_usage_cmd(const bool verbose)
   sta->report_cell_usage(verbose);
 }
 
+void
+prefetch_files_cmd(const char *filenames)
+{
+  ord::OpenRoad *openroad = ord::getOpenRoad();
+  sta::dbSta *sta = openroad->getSta();
+  // newline separated so names may hold spaces
+  std::vector<std::string> files;
+  std::istringstream stream(filenames);
+  std::string filename;
+  while (std::getline(stream, filename)) {
+    if (!filename.empty()) {
+      files.push_back(filename);
+    }
+  }
+  sta->prefetchFiles(files);
+}
+
+void
+stop_prefetch_cmd()
+{
+  ord::OpenRoad *openroad = ord::getOpenRoad();
+  sta::dbSta *sta = openroad->getSta();
+  sta->stopPrefetch();
+}
+
+void
+read_db_parasitics_cmd(const Corner *corner,
+                       int ext_corner)
+{
+  cmdLinkedNetwork();
+  ord::OpenRoad *openroad = ord::getOpenRoad();
+  sta::dbSta *sta = openroad->getSta();
+  sta->readDbParasitics(corner, ext_corner);
+}
+
 // Copied from sta/verilog/Verilog.i because we don't want sta::read_verilog
 // that is in the same file.
 void
@@ -92,6 +92,63 @@ proc report_cell_usage { args } {
   report_cell_usage_cmd [info exists flags(-verbose)]
 }
 
+define_cmd_args "read_db_parasitics" {[-corner corner]\
+                                       [-ext_corner ext_corner]}
+
+proc read_db_parasitics { args } {
+  parse_key_args "read_db_parasitics" args \
+    keys {-corner -ext_corner} flags {}
+  check_argc_eq0 "read_db_parasitics" $args
+
+  if { [ord::get_db_block] == "NULL" } {
+    sta_error "No design block found."
+  }
+  set corner [parse_corner_or_default keys]
+  set ext_corner 0
+  if { [info exists keys(-ext_corner)] } {
+    set ext_corner $keys(-ext_corner)
+    check_positive_integer "-ext_corner" $ext_corner
+  }
+  read_db_parasitics_cmd $corner $ext_corner
+}
+
+define_cmd_args "read_liberty_files" {[-corner corner] [-min] [-max]\
+                                       filenames}
+
+proc read_liberty_files { args } {
+  parse_key_args "read_liberty_files" args \
+    keys {-corner} flags {-min -max}
+  check_argc_eq1 "read_liberty_files" $args
+
+  set options {}
+  if { [info exists keys(-corner)] } {
+    lappend options -corner $keys(-corner)
+  }
+  if { [info exists flags(-min)] } {
+    lappend options -min
+  }
+  if { [info exists flags(-max)] } {
+    lappend options -max
+  }
+
+  set filenames {}
+  foreach filename [lindex $args 0] {
+    lappend filenames [file nativename $filename]
+  }
+  # The first file is read by the liberty reader right away.
+  prefetch_files_cmd [join [lrange $filenames 1 end] "\n"]
+  # Stop the prefetch also when a file can't be read.
+  set failed [catch {
+    foreach filename $filenames {
+      read_liberty {*}$options $filename
+    }
+  } error]
+  stop_prefetch_cmd
+  if { $failed } {
+    error $error
+  }
+}
+
 # redefine sta::sta_warn/error to call utl::warn/error
 proc sta_error { id msg } {
   utl::error STA $id $msg
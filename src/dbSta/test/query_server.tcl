@@ -0,0 +1,48 @@
+# Query the db and timing of a loaded design through the query server
+source "helpers.tcl"
+
+read_lef liberty1.lef
+read_liberty liberty1.lib
+read_def reg1.def
+create_clock -name clk -period 10 {clk1 clk2 clk3}
+set_input_delay -clock clk 0 {in1 in2}
+set_output_delay -clock clk 0 out
+
+# The port is picked by the system so parallel runs don't collide; the
+# message naming it would make the log differ from run to run.
+suppress_message ORD 59
+set port [start_query_server -port 0 -threads 2]
+
+proc query { port target } {
+  set sock [socket 127.0.0.1 $port]
+  fconfigure $sock -translation binary
+  puts -nonewline $sock "GET $target HTTP/1.1\r\nHost: 127.0.0.1\r\n\r\n"
+  flush $sock
+  set reply [read $sock]
+  close $sock
+  set status [lindex [split $reply "\r\n"] 0]
+  set body_start [expr { [string first "\r\n\r\n" $reply] + 4 }]
+  puts "$target: $status"
+  puts [string range $reply $body_start end]
+}
+
+query $port /design
+query $port /inst?name=r1
+query $port /inst?name=none
+query $port /insts?bbox=0,0,1000000,1000000&limit=2
+query $port /net?name=r1q
+query $port /timing
+query $port /unknown
+
+# Queries see the design as of the last snapshot until it is updated.
+set r1 [[ord::get_db_block] findInst r1]
+$r1 setLocation 20000 20000
+query $port /inst?name=r1
+update_query_server
+query $port /design
+query $port /inst?name=r1
+
+# A client that never sends its request must not keep stop from returning.
+set idle [socket 127.0.0.1 $port]
+stop_query_server
+close $idle
@@ -0,0 +1,55 @@
+# read_liberty_files loads the same libraries as read_liberty one file at a
+# time, and stops on a file it can't read
+source "helpers.tcl"
+
+set lib_files {Nangate45/Nangate45_typ.lib Nangate45/Nangate45_fast.lib \
+                 Nangate45/Nangate45_slow.lib}
+
+define_corners sequential prefetch
+foreach lib_file $lib_files {
+  read_liberty -corner sequential $lib_file
+}
+read_liberty_files -corner prefetch $lib_files
+
+# Returns the libraries in the order they were read, each as its name and
+# the names and areas of its cells.
+proc liberty_summaries {} {
+  set summaries {}
+  set lib_iter [sta::liberty_library_iterator]
+  while { [$lib_iter has_next] } {
+    set lib [$lib_iter next]
+    set cells {}
+    set cell_iter [$lib liberty_cell_iterator]
+    while { [$cell_iter has_next] } {
+      set cell [$cell_iter next]
+      lappend cells [list [$cell name] [get_property $cell area]]
+    }
+    $cell_iter finish
+    lappend summaries [list [$lib name] $cells]
+  }
+  $lib_iter finish
+  return $summaries
+}
+
+set summaries [liberty_summaries]
+set lib_count [llength $lib_files]
+set sequential [lrange $summaries 0 [expr $lib_count - 1]]
+set prefetched [lrange $summaries $lib_count end]
+foreach summary $prefetched {
+  puts "[lindex $summary 0]: [llength [lindex $summary 1]] cells"
+}
+if { $sequential == $prefetched } {
+  puts "read_liberty_files matches read_liberty"
+} else {
+  puts "read_liberty_files differs from read_liberty"
+}
+
+catch {
+  read_liberty_files -corner prefetch {Nangate45/Nangate45_typ.lib \
+                                       missing_lib.lib}
+} error
+puts $error
+
+# the prefetch stopped with the error, so reading can go on
+read_liberty_files -corner prefetch $lib_files
+puts "[llength [liberty_summaries]] libraries read"
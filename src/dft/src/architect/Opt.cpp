@@ -32,26 +32,166 @@
 
 #include "Opt.hh"
 
-#include <boost/geometry.hpp>
-#include <boost/geometry/geometries/register/point.hpp>
-#include <boost/geometry/index/rtree.hpp>
-#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
 
 #include "ClockDomain.hh"
 
-namespace bg = boost::geometry;
-namespace bgi = boost::geometry::index;
-
 namespace dft {
 
 namespace {
-// Max number of cells we assume could be placed at the same point (hopefully,
-// after DP, this is never more than one)
-constexpr int kMaxCellsToSearch = 10;
+// Average number of cells per bin of the search grid
+constexpr int kCellsPerBin = 2;
+// How far ahead in the chain 2-opt looks for a segment to reverse
+constexpr int kTwoOptWindow = 32;
+// 2-opt passes over the chain stop after this many or once nothing improves
+constexpr int kMaxTwoOptPasses = 8;
+
+int64_t Distance(const odb::Point& a, const odb::Point& b)
+{
+  return std::abs(static_cast<int64_t>(a.x()) - b.x())
+         + std::abs(static_cast<int64_t>(a.y()) - b.y());
+}
+
+// A uniform grid of bins over the cells, from which visited cells are
+// removed, to find the nearest unvisited cell by searching rings of bins
+// around the current one.
+class NeighborGrid
+{
+ public:
+  explicit NeighborGrid(const std::vector<odb::Point>& points)
+      : points_(points), position_(points.size())
+  {
+    int64_t x_min = std::numeric_limits<int64_t>::max();
+    int64_t y_min = std::numeric_limits<int64_t>::max();
+    int64_t x_max = std::numeric_limits<int64_t>::min();
+    int64_t y_max = std::numeric_limits<int64_t>::min();
+    for (const odb::Point& point : points_) {
+      x_min = std::min<int64_t>(x_min, point.x());
+      y_min = std::min<int64_t>(y_min, point.y());
+      x_max = std::max<int64_t>(x_max, point.x());
+      y_max = std::max<int64_t>(y_max, point.y());
+    }
+    x_min_ = x_min;
+    y_min_ = y_min;
+    // Square bins sized for kCellsPerBin if the cells were spread evenly
+    const int64_t area = std::max<int64_t>(1, (x_max - x_min + 1))
+                         * std::max<int64_t>(1, (y_max - y_min + 1));
+    bin_size_ = std::max<int64_t>(
+        1,
+        std::llround(std::sqrt(static_cast<double>(area) * kCellsPerBin
+                               / points_.size())));
+    cols_ = (x_max - x_min) / bin_size_ + 1;
+    rows_ = (y_max - y_min) / bin_size_ + 1;
+    bins_.resize(cols_ * rows_);
+    for (size_t i = 0; i < points_.size(); i++) {
+      std::vector<size_t>& bin = bins_[binIndex(col(i), row(i))];
+      position_[i] = bin.size();
+      bin.push_back(i);
+    }
+  }
+
+  void remove(size_t i)
+  {
+    std::vector<size_t>& bin = bins_[binIndex(col(i), row(i))];
+    const size_t last = bin.back();
+    bin[position_[i]] = last;
+    position_[last] = position_[i];
+    bin.pop_back();
+  }
+
+  // The nearest cell still in the grid, ties going to the lower index
+  size_t nearest(const odb::Point& from) const
+  {
+    const int64_t from_col = std::clamp<int64_t>(
+        (from.x() - x_min_) / bin_size_, 0, cols_ - 1);
+    const int64_t from_row = std::clamp<int64_t>(
+        (from.y() - y_min_) / bin_size_, 0, rows_ - 1);
+    size_t best = points_.size();
+    int64_t best_dist = std::numeric_limits<int64_t>::max();
+    const int64_t max_ring = std::max(cols_, rows_);
+    for (int64_t ring = 0; ring <= max_ring; ring++) {
+      for (int64_t c = from_col - ring; c <= from_col + ring; c++) {
+        if (c < 0 || c >= cols_) {
+          continue;
+        }
+        // Only the border of the ring, the inside was searched before
+        const bool border_col = c == from_col - ring || c == from_col + ring;
+        const int64_t step = border_col ? 1 : std::max<int64_t>(1, 2 * ring);
+        for (int64_t r = from_row - ring; r <= from_row + ring; r += step) {
+          if (r < 0 || r >= rows_) {
+            continue;
+          }
+          for (size_t i : bins_[binIndex(c, r)]) {
+            const int64_t dist = Distance(from, points_[i]);
+            if (dist < best_dist || (dist == best_dist && i < best)) {
+              best = i;
+              best_dist = dist;
+            }
+          }
+        }
+      }
+      // Cells beyond this ring are at least ring whole bins away
+      if (best != points_.size() && best_dist <= ring * bin_size_) {
+        break;
+      }
+    }
+    return best;
+  }
+
+ private:
+  int64_t col(size_t i) const { return (points_[i].x() - x_min_) / bin_size_; }
+  int64_t row(size_t i) const { return (points_[i].y() - y_min_) / bin_size_; }
+  size_t binIndex(int64_t c, int64_t r) const { return r * cols_ + c; }
+
+  const std::vector<odb::Point>& points_;
+  std::vector<std::vector<size_t>> bins_;
+  // Index of every cell in its bin
+  std::vector<size_t> position_;
+  int64_t x_min_;
+  int64_t y_min_;
+  int64_t bin_size_;
+  int64_t cols_;
+  int64_t rows_;
+};
+
+// Reverses segments of the open path when that shortens it. The first cell
+// stays in place as it is the start of the chain.
+void TwoOpt(const std::vector<odb::Point>& points, std::vector<size_t>& order)
+{
+  const size_t n = order.size();
+  auto dist = [&](size_t a, size_t b) {
+    return Distance(points[order[a]], points[order[b]]);
+  };
+  for (int pass = 0; pass < kMaxTwoOptPasses; pass++) {
+    bool improved = false;
+    for (size_t i = 0; i + 2 < n; i++) {
+      const size_t last = std::min(n - 1, i + kTwoOptWindow);
+      for (size_t j = i + 2; j <= last; j++) {
+        // Edges (i, i + 1) and (j, j + 1) become (i, j) and (i + 1, j + 1)
+        int64_t delta = dist(i, j) - dist(i, i + 1);
+        if (j + 1 < n) {
+          delta += dist(i + 1, j + 1) - dist(j, j + 1);
+        }
+        if (delta < 0) {
+          std::reverse(order.begin() + i + 1, order.begin() + j + 1);
+          improved = true;
+        }
+      }
+    }
+    if (!improved) {
+      break;
+    }
+  }
+}
 }  // namespace
 
-void OptimizeScanWirelength(std::vector<std::unique_ptr<ScanCell>>& cells,
-                            utl::Logger* logger)
+void OptimizeScanWirelength(std::vector<std::unique_ptr<ScanCell>>& cells)
 {
   // Nothing to order
   if (cells.empty()) {
@@ -67,52 +207,43 @@ void OptimizeScanWirelength(std::vector<std::unique_ptr<ScanCell>>& cells,
   // start somewhere in the middle
   size_t start_index = 0;
   int64_t lowest_dist = std::numeric_limits<int64_t>::max();
-  // Get points in a form ready to insert into index
-  typedef bg::model::point<int, 2, bg::cs::cartesian> bg_point;
-  std::vector<std::pair<bg_point, size_t>> transformed;
+  std::vector<odb::Point> points;
+  points.reserve(cells.size());
 
   for (size_t i = 0; i < cells.size(); i++) {
     // Find the lower leftmost cell by looking for the cell with the lowest
     // manhattan distance to the origin
     auto origin = cells[i]->getOrigin();
-    const int64_t dist = origin.x() + origin.y();
+    const int64_t dist = static_cast<int64_t>(origin.x()) + origin.y();
     if (dist < lowest_dist) {
       start_index = i;
       lowest_dist = dist;
     }
-    // Add the point to the set of points
-    transformed.emplace_back(bg_point(origin.x(), origin.y()), i);
+    points.push_back(origin);
   }
-  // Update the index
-  bgi::rtree<std::pair<bg_point, size_t>, bgi::rstar<4>> rtree(transformed);
-  auto cursor = transformed[start_index];
 
   // Search nearest neighbours
-  std::vector<std::unique_ptr<ScanCell>> result;
-  result.emplace_back(std::move(cells[cursor.second]));
-  while (result.size() < cells.size()) {
-    // Search for next nearest
-    auto next = cursor;
-    for (auto it = rtree.qbegin(bgi::nearest(cursor.first, kMaxCellsToSearch));
-         it != rtree.qend();
-         ++it) {
-      next = *it;
-      if (next.second != cursor.second) {
-        break;
-      }
-    }
-    if (next.second == cursor.second) {
-      logger->error(
-          utl::DFT,
-          10,
-          "Couldn't find nearest neighbor, too many overlapping cells");
-    }
+  NeighborGrid grid(points);
+  std::vector<size_t> order;
+  order.reserve(cells.size());
+  size_t cursor = start_index;
+  grid.remove(cursor);
+  order.push_back(cursor);
+  while (order.size() < cells.size()) {
+    cursor = grid.nearest(points[cursor]);
     // Make sure we only visit things once
-    rtree.remove(cursor);
-    cursor = std::move(next);
-    result.emplace_back(std::move(cells[cursor.second]));
+    grid.remove(cursor);
+    order.push_back(cursor);
   }
+
+  TwoOpt(points, order);
+
   // Replace with sorted vector
+  std::vector<std::unique_ptr<ScanCell>> result;
+  result.reserve(cells.size());
+  for (size_t i : order) {
+    result.emplace_back(std::move(cells[i]));
+  }
   std::swap(cells, result);
 }
 
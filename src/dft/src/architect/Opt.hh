@@ -32,12 +32,12 @@
 #pragma once
 
 #include "ScanArchitect.hh"
-#include "utl/Logger.h"
 
 namespace dft {
 
-// Order scan cells to reduce wirelength
-void OptimizeScanWirelength(std::vector<std::unique_ptr<ScanCell>>& cells,
-                            utl::Logger* logger);
+// Order scan cells to reduce wirelength: a nearest neighbor walk from the
+// lower left cell, refined with 2-opt. Safe to call on different vectors
+// concurrently.
+void OptimizeScanWirelength(std::vector<std::unique_ptr<ScanCell>>& cells);
 
 }  // namespace dft
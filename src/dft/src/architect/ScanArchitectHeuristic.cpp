@@ -38,6 +38,7 @@
 #include "ClockDomain.hh"
 #include "Opt.hh"
 #include "ScanArchitect.hh"
+#include "utl/ThreadPool.h"
 
 namespace dft {
 
@@ -51,6 +52,7 @@ ScanArchitectHeuristic::ScanArchitectHeuristic(
 
 void ScanArchitectHeuristic::architect()
 {
+  std::vector<ScanChain*> chains;
   // For each hash_domain, lets distribute the scan cells over the scan chains
   for (auto& [hash_domain, scan_chains] : hash_domain_scan_chains_) {
     for (auto& current_chain : scan_chains) {
@@ -62,22 +64,25 @@ void ScanArchitectHeuristic::architect()
             = scan_cells_bucket_->pop(hash_domain);
         current_chain->add(std::move(scan_cell));
       }
-
-      current_chain->sortScanCells(
-          [this](std::vector<std::unique_ptr<ScanCell>>& falling,
-                 std::vector<std::unique_ptr<ScanCell>>& rising,
-                 std::vector<std::unique_ptr<ScanCell>>& sorted) {
-            sorted.reserve(falling.size() + rising.size());
-            // Sort to reduce wire length
-            OptimizeScanWirelength(falling, logger_);
-            OptimizeScanWirelength(rising, logger_);
-            // Falling edge first
-            std::move(
-                falling.begin(), falling.end(), std::back_inserter(sorted));
-            std::move(rising.begin(), rising.end(), std::back_inserter(sorted));
-          });
+      chains.push_back(current_chain.get());
     }
   }
+
+  // The chains are ordered independently of each other
+  utl::ThreadPool::get().parallelFor(0, chains.size(), [&chains](int i) {
+    chains[i]->sortScanCells(
+        [](std::vector<std::unique_ptr<ScanCell>>& falling,
+           std::vector<std::unique_ptr<ScanCell>>& rising,
+           std::vector<std::unique_ptr<ScanCell>>& sorted) {
+          sorted.reserve(falling.size() + rising.size());
+          // Sort to reduce wire length
+          OptimizeScanWirelength(falling);
+          OptimizeScanWirelength(rising);
+          // Falling edge first
+          std::move(falling.begin(), falling.end(), std::back_inserter(sorted));
+          std::move(rising.begin(), rising.end(), std::back_inserter(sorted));
+        });
+  });
 }
 
 }  // namespace dft
@@ -34,6 +34,9 @@
 
 #include <iostream>
 #include <limits>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "Utils.hh"
 #include "db_sta/dbNetwork.hh"
@@ -338,13 +341,10 @@ void ScanReplace::scanReplace()
 // one) replacing the cells with scan equivalent
 void ScanReplace::scanReplace(odb::dbBlock* block)
 {
-  std::unordered_set<odb::dbInst*> already_replaced;
+  // The cells are collected first and replaced all at once, so the new scan
+  // cells are not visited again
+  std::vector<std::pair<odb::dbInst*, odb::dbMaster*>> replacements;
   for (odb::dbInst* inst : block->getInsts()) {
-    // The instances already scan replaced are skipped
-    if (already_replaced.find(inst) != already_replaced.end()) {
-      continue;
-    }
-
     if (inst->isDoNotTouch()) {
       // Do not scan replace dont_touch
       continue;
@@ -394,13 +394,20 @@ void ScanReplace::scanReplace(odb::dbBlock* block)
     sta::LibertyCell* scan_cell = scan_candidate->getScanCell();
     odb::dbMaster* master_scan_cell = db_network_->staToDb(scan_cell);
 
-    odb::dbInst* new_cell = utils::ReplaceCell(
-        block, inst, master_scan_cell, scan_candidate->getPortMapping());
-
-    already_replaced.insert(new_cell);
+    replacements.emplace_back(inst, master_scan_cell);
     addCellForRollback(master, master_scan_cell, scan_candidate);
   }
 
+  utils::ReplaceCells(
+      block,
+      replacements,
+      [this](odb::dbMaster* master)
+          -> const std::unordered_map<std::string, std::string>& {
+        sta::LibertyCell* liberty_cell
+            = db_network_->libertyCell(db_network_->dbToSta(master));
+        return non_scan_to_scan_lib_cells_.at(liberty_cell)->getPortMapping();
+      });
+
   // Recursive iterate inside the block to look for inside hiers
   for (odb::dbBlock* next_block : block->getChildren()) {
     scanReplace(next_block);
@@ -430,6 +437,7 @@ void ScanReplace::rollbackScanReplace()
 
 void ScanReplace::rollbackScanReplace(odb::dbBlock* block)
 {
+  std::vector<std::pair<odb::dbInst*, odb::dbMaster*>> replacements;
   for (odb::dbInst* inst : block->getInsts()) {
     auto found = rollback_candidates_.find(inst->getMaster());
     if (found == rollback_candidates_.end()) {
@@ -437,13 +445,17 @@ void ScanReplace::rollbackScanReplace(odb::dbBlock* block)
       continue;
     }
 
-    RollbackCandidate& rollback_candidate = *found->second;
-    utils::ReplaceCell(block,
-                       inst,
-                       rollback_candidate.getMaster(),
-                       rollback_candidate.getPortMapping());
+    replacements.emplace_back(inst, found->second->getMaster());
   }
 
+  utils::ReplaceCells(
+      block,
+      replacements,
+      [this](odb::dbMaster* master)
+          -> const std::unordered_map<std::string, std::string>& {
+        return rollback_candidates_.at(master)->getPortMapping();
+      });
+
   // Recursive iterate inside the block to look for inside hiers
   for (odb::dbBlock* next_block : block->getChildren()) {
     rollbackScanReplace(next_block);
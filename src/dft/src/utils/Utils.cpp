@@ -39,34 +39,6 @@
 
 namespace dft::utils {
 
-namespace {
-
-void PopulatePortNameToNet(
-    odb::dbInst* instance,
-    std::vector<std::tuple<std::string, odb::dbNet*>>& port_name_to_net)
-{
-  for (odb::dbITerm* iterm : instance->getITerms()) {
-    port_name_to_net.emplace_back(iterm->getMTerm()->getName(),
-                                  iterm->getNet());
-  }
-}
-
-void ConnectPinsToNets(
-    odb::dbInst* instance,
-    const std::vector<std::tuple<std::string, odb::dbNet*>>& port_name_to_net,
-    const std::unordered_map<std::string, std::string>& port_mapping)
-{
-  for (const auto& [port_name_old, net] : port_name_to_net) {
-    if (net == nullptr) {
-      continue;
-    }
-    std::string port_name_new = port_mapping.find(port_name_old)->second;
-    instance->findITerm(port_name_new.c_str())->connect(net);
-  }
-}
-
-}  // namespace
-
 bool IsSequentialCell(sta::dbNetwork* db_network, odb::dbInst* instance)
 {
   odb::dbMaster* master = instance->getMaster();
@@ -75,29 +47,23 @@ bool IsSequentialCell(sta::dbNetwork* db_network, odb::dbInst* instance)
   return liberty_cell->hasSequentials();
 }
 
-odb::dbInst* ReplaceCell(
+std::vector<odb::dbInst*> ReplaceCells(
     odb::dbBlock* top_block,
-    odb::dbInst* old_instance,
-    odb::dbMaster* new_master,
-    const std::unordered_map<std::string, std::string>& port_mapping)
+    const std::vector<std::pair<odb::dbInst*, odb::dbMaster*>>& replacements,
+    const std::function<const std::unordered_map<std::string, std::string>&(
+        odb::dbMaster*)>& port_mapping)
 {
-  std::vector<std::tuple<std::string, odb::dbNet*>> port_name_to_net;
-  PopulatePortNameToNet(old_instance, port_name_to_net);
-
-  odb::dbInst* new_instance
-      = odb::dbInst::create(top_block, new_master, /*name=*/"tmp_scan_flop");
-  std::string old_cell_name = old_instance->getName();
-
-  // Delete the old cell
-  odb::dbInst::destroy(old_instance);
-
-  // Connect the new cell to the old instance's nets
-  ConnectPinsToNets(new_instance, port_name_to_net, port_mapping);
-
-  // Rename as the old cell
-  new_instance->rename(old_cell_name.c_str());
-
-  return new_instance;
+  auto map_mterm = [&](odb::dbMTerm* old_mterm,
+                       odb::dbMaster* new_master) -> odb::dbMTerm* {
+    const std::unordered_map<std::string, std::string>& mapping
+        = port_mapping(old_mterm->getMaster());
+    auto found = mapping.find(old_mterm->getName());
+    if (found == mapping.end()) {
+      return nullptr;
+    }
+    return new_master->findMTerm(found->second.c_str());
+  };
+  return odb::dbInst::swapMasters(top_block, replacements, map_mterm);
 }
 
 std::vector<odb::dbITerm*> GetClockPin(odb::dbInst* inst)
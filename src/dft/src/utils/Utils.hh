@@ -31,7 +31,12 @@
 // POSSIBILITY OF SUCH DAMAGE.
 #pragma once
 
+#include <functional>
 #include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "db_sta/dbSta.hh"
 #include "odb/db.h"
@@ -40,15 +45,16 @@
 
 namespace dft::utils {
 
-// Replace the old_instance cell with a new master. The connections of the old
-// cell will be preserved by using the given port mapping from
-// <old_port_name, new_port_name>. Returns the new instance and deletes the old
-// one. The name of the new instance is going to be the same as the old one.
-odb::dbInst* ReplaceCell(
+// Replace the cells of many instances with new masters at once, see
+// odb::dbInst::swapMasters. The connections of the old cells are preserved by
+// the <old_port_name, new_port_name> mapping that port_mapping returns for
+// the old master. Returns the new instances, in the order of replacements,
+// which keep the names of the old ones.
+std::vector<odb::dbInst*> ReplaceCells(
     odb::dbBlock* top_block,
-    odb::dbInst* old_instance,
-    odb::dbMaster* new_master,
-    const std::unordered_map<std::string, std::string>& port_mapping);
+    const std::vector<std::pair<odb::dbInst*, odb::dbMaster*>>& replacements,
+    const std::function<const std::unordered_map<std::string, std::string>&(
+        odb::dbMaster*)>& port_mapping);
 
 // Returns true if the given instance cell's is a sequential cell, false
 // otherwise
@@ -12,6 +12,14 @@ ScanCellMock::ScanCellMock(const std::string& name,
 {
 }
 
+ScanCellMock::ScanCellMock(const std::string& name,
+                           std::unique_ptr<ClockDomain> clock_domain,
+                           utl::Logger* logger,
+                           const odb::Point& origin)
+    : ScanCell(name, std::move(clock_domain), logger), origin_(origin)
+{
+}
+
 uint64_t ScanCellMock::getBits() const
 {
   return 1;
@@ -36,12 +44,12 @@ ScanDriver ScanCellMock::getScanOut() const
 
 odb::Point ScanCellMock::getOrigin() const
 {
-  return odb::Point();
+  return origin_.value_or(odb::Point());
 }
 
 bool ScanCellMock::isPlaced() const
 {
-  return false;
+  return origin_.has_value();
 }
 
 }  // namespace test
@@ -1,3 +1,5 @@
+#include <optional>
+
 #include "ScanCell.hh"
 #pragma once
 
@@ -10,6 +12,11 @@ class ScanCellMock : public ScanCell
   ScanCellMock(const std::string& name,
                std::unique_ptr<ClockDomain> clock_domain,
                utl::Logger* logger);
+  // A cell placed at origin
+  ScanCellMock(const std::string& name,
+               std::unique_ptr<ClockDomain> clock_domain,
+               utl::Logger* logger,
+               const odb::Point& origin);
   ~ScanCellMock() override = default;
 
   uint64_t getBits() const override;
@@ -19,6 +26,9 @@ class ScanCellMock : public ScanCell
   ScanDriver getScanOut() const override;
   odb::Point getOrigin() const override;
   bool isPlaced() const override;
+
+ private:
+  std::optional<odb::Point> origin_;
 };
 
 }  // namespace test
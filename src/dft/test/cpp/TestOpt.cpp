@@ -0,0 +1,106 @@
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "ClockDomain.hh"
+#include "Opt.hh"
+#include "ScanCellMock.hh"
+#include "gtest/gtest.h"
+
+namespace dft::test {
+namespace {
+
+std::vector<std::unique_ptr<ScanCell>> CreatePlacedCells(
+    const std::vector<odb::Point>& origins,
+    utl::Logger* logger)
+{
+  std::vector<std::unique_ptr<ScanCell>> cells;
+  for (size_t i = 0; i < origins.size(); ++i) {
+    cells.push_back(std::make_unique<ScanCellMock>(
+        "scan_cell" + std::to_string(i),
+        std::make_unique<ClockDomain>("clk1", ClockEdge::Rising),
+        logger,
+        origins[i]));
+  }
+  return cells;
+}
+
+int64_t Wirelength(const std::vector<std::unique_ptr<ScanCell>>& cells)
+{
+  int64_t wirelength = 0;
+  for (size_t i = 1; i < cells.size(); ++i) {
+    const odb::Point a = cells[i - 1]->getOrigin();
+    const odb::Point b = cells[i]->getOrigin();
+    wirelength += std::abs(a.x() - b.x()) + std::abs(a.y() - b.y());
+  }
+  return wirelength;
+}
+
+TEST(TestOpt, OrdersCellsOnALine)
+{
+  utl::Logger* logger = new utl::Logger();
+
+  std::vector<odb::Point> origins;
+  for (int i = 0; i < 50; ++i) {
+    origins.emplace_back(i * 100, 0);
+  }
+  std::shuffle(origins.begin(), origins.end(), std::mt19937(1));
+  std::vector<std::unique_ptr<ScanCell>> cells
+      = CreatePlacedCells(origins, logger);
+
+  OptimizeScanWirelength(cells);
+
+  ASSERT_EQ(cells.size(), 50);
+  for (size_t i = 0; i < cells.size(); ++i) {
+    EXPECT_EQ(cells[i]->getOrigin(), odb::Point(i * 100, 0));
+  }
+}
+
+TEST(TestOpt, OrdersOverlappingCells)
+{
+  utl::Logger* logger = new utl::Logger();
+
+  // More cells at the same point than a nearest neighbor query used to
+  // return
+  std::vector<odb::Point> origins(20, odb::Point(500, 500));
+  origins.emplace_back(0, 0);
+  origins.emplace_back(1000, 1000);
+  std::vector<std::unique_ptr<ScanCell>> cells
+      = CreatePlacedCells(origins, logger);
+
+  OptimizeScanWirelength(cells);
+
+  ASSERT_EQ(cells.size(), origins.size());
+  EXPECT_EQ(cells.front()->getOrigin(), odb::Point(0, 0));
+  EXPECT_EQ(cells.back()->getOrigin(), odb::Point(1000, 1000));
+  EXPECT_EQ(Wirelength(cells), 2000);
+}
+
+TEST(TestOpt, OrdersGridCloseToSerpentine)
+{
+  utl::Logger* logger = new utl::Logger();
+
+  std::vector<odb::Point> origins;
+  for (int x = 0; x < 40; ++x) {
+    for (int y = 0; y < 40; ++y) {
+      origins.emplace_back(x * 100, y * 100);
+    }
+  }
+  std::shuffle(origins.begin(), origins.end(), std::mt19937(1));
+  std::vector<std::unique_ptr<ScanCell>> cells
+      = CreatePlacedCells(origins, logger);
+
+  OptimizeScanWirelength(cells);
+
+  ASSERT_EQ(cells.size(), origins.size());
+  EXPECT_EQ(cells.front()->getOrigin(), odb::Point(0, 0));
+  // A serpentine through the grid is the shortest chain
+  const int64_t serpentine = (origins.size() - 1) * 100;
+  EXPECT_LE(Wirelength(cells), serpentine * 13 / 10);
+}
+
+}  // namespace
+}  // namespace dft::test
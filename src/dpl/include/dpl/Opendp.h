@@ -85,6 +85,7 @@ struct Pixel;
 
 class DplObserver;
 class Grid;
+class GridChangeTracker;
 class GridInfo;
 class Padding;
 class PixelPt;
@@ -115,6 +116,7 @@ using dbMasterSeq = vector<dbMaster*>;
 
 using IRDropByPoint = std::map<odb::Point, double>;
 struct GapInfo;
+struct FillerGap;
 struct DecapCell;
 struct IRDrop;
 ////////////////////////////////////////////////////////////////
@@ -144,6 +146,8 @@ class Opendp
   void setPadding(dbMaster* master, int left, int right);
   void setPadding(dbInst* inst, int left, int right);
   void setDebug(std::unique_ptr<dpl::DplObserver>& observer);
+  // Designs with fewer single row cells are placed without row bands.
+  void setRowBandMinCells(int min_cells) { row_band_min_cells_ = min_cells; }
 
   // Global padding.
   int padGlobalLeft() const;
@@ -152,9 +156,12 @@ class Opendp
   int padLeft(dbInst* inst) const;
   int padRight(dbInst* inst) const;
 
+  // With incremental, the grid of the resizer legalizer session is reused
+  // when no row, padding or fixed cell changed since initMacrosAndGrid.
   void checkPlacement(bool verbose,
                       bool disallow_one_site_gaps = false,
-                      const string& report_file_name = "");
+                      const string& report_file_name = "",
+                      bool incremental = false);
   void fillerPlacement(dbMasterSeq* filler_masters, const char* prefix);
   void removeFillers();
   void optimizeMirroring();
@@ -190,6 +197,8 @@ class Opendp
                               const std::vector<Cell*>& failures,
                               const std::string& violation_type = "") const;
   void importDb();
+  // importDb without deleting the pixel grid.
+  void importCells();
   void importClear();
   Rect getBbox(dbInst* inst);
   void makeMacros();
@@ -255,6 +264,7 @@ class Opendp
   void prePlace();
   void prePlaceGroups();
   void place();
+  void placeRowBands(const vector<Cell*>& sorted_cells);
   void placeGroups2();
   void brickPlace1(const Group* group);
   void brickPlace2(const Group* group);
@@ -316,11 +326,16 @@ class Opendp
   dbMasterSeq& gapFillers(dbTechLayer* implant,
                           GridX gap,
                           const MasterByImplant& filler_masters_by_implant);
+  vector<FillerGap> findRowFillerGaps(
+      GridY row,
+      const MasterByImplant& filler_masters,
+      const GridInfo& grid_info) const;
   void placeRowFillers(GridY row,
                        const char* prefix,
                        const MasterByImplant& filler_masters,
                        DbuY row_height,
-                       const GridInfo& grid_info);
+                       const GridInfo& grid_info,
+                       const vector<FillerGap>& gaps);
   static bool isFiller(odb::dbInst* db_inst);
   bool isOneSiteCell(odb::dbMaster* db_master) const;
   const char* gridInstName(GridY row, GridX col, const GridInfo& grid_info);
@@ -340,7 +355,10 @@ class Opendp
                         double& total,
                         const double& target);
   void findGaps();
-  void findGapsInRow(GridY row, DbuY row_height, const GridInfo& grid_info);
+  void findGapsInRow(GridY row,
+                     DbuY row_height,
+                     const GridInfo& grid_info,
+                     vector<GapInfo*>& gaps) const;
   void mapToVectorIRDrops(IRDropByPoint& psm_ir_drops,
                           std::vector<IRDrop>& ir_drops);
   void prepareDecapAndGaps();
@@ -359,11 +377,14 @@ class Opendp
   bool have_multi_row_cells_ = false;
   int max_displacement_x_ = 0;  // sites
   int max_displacement_y_ = 0;  // sites
+  int row_band_min_cells_ = 50000;
   bool disallow_one_site_gaps_ = false;
   vector<Cell*> placement_failures_;
 
   // 3D pixel grid
   std::unique_ptr<Grid> grid_;
+  // Tells initMacrosAndGrid when the fixed cell grid must be rebuilt.
+  std::unique_ptr<GridChangeTracker> grid_tracker_;
   RtreeBox regions_rtree_;
 
   // Filler placement.
@@ -392,6 +413,8 @@ class Opendp
   static constexpr double group_refine_percent_ = .05;
   static constexpr double refine_percent_ = .02;
   static constexpr int rand_seed_ = 777;
+  // Band height as a multiple of the diamond search height.
+  static constexpr int row_band_search_heights_ = 4;
 };
 
 int divRound(int dividend, int divisor);
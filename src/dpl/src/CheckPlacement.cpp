@@ -35,13 +35,16 @@
 #include <boost/property_tree/json_parser.hpp>
 #include <boost/property_tree/ptree.hpp>
 #include <cmath>
+#include <cstdint>
 #include <fstream>
 #include <limits>
 
 #include "Grid.h"
+#include "GridChangeTracker.h"
 #include "Objects.h"
 #include "Padding.h"
 #include "dpl/Opendp.h"
+#include "ord/OpenRoad.hh"
 #include "utl/Logger.h"
 namespace dpl {
 
@@ -54,58 +57,121 @@ using utl::format_as;
 
 void Opendp::checkPlacement(const bool verbose,
                             const bool disallow_one_site_gaps,
-                            const string& report_file_name)
+                            const string& report_file_name,
+                            const bool incremental)
 {
-  importDb();
-
-  vector<Cell*> placed_failures;
-  vector<Cell*> in_rows_failures;
-  vector<Cell*> overlap_failures;
-  vector<Cell*> one_site_gap_failures;
-  vector<Cell*> site_align_failures;
-  vector<Cell*> region_placement_failures;
-
-  initGrid();
+  // The grid of the resizer legalizer session only holds rows, sites and
+  // fixed cells, so it is reused if none of them changed since it was made.
+  const bool reuse_grid
+      = incremental && grid_tracker_->isValid(db_->getChip()->getBlock());
+  if (reuse_grid) {
+    importCells();
+    grid_->clearCells();
+  } else {
+    importDb();
+    initGrid();
+  }
   groupAssignCellRegions();
-  const auto& row_coords = grid_->getRowCoordinates();
-  for (Cell& cell : cells_) {
+
+  // Every cell is checked on its own and the failures are collected in
+  // cell order, so the report does not depend on the thread count.
+  enum Failure : uint8_t
+  {
+    kPlaced = 1 << 0,
+    kInRows = 1 << 1,
+    kOverlap = 1 << 2,
+    kOneSiteGap = 1 << 3,
+    kSiteAlign = 1 << 4,
+    kRegionPlacement = 1 << 5
+  };
+  const int cell_count = cells_.size();
+  vector<uint8_t> failures(cell_count, 0);
+  const int thread_count = ord::OpenRoad::openRoad()->getThreadCount();
+
+  const auto row_coords = grid_->getRowCoordinates();
+#pragma omp parallel for schedule(dynamic, 1024) num_threads(thread_count)
+  for (int i = 0; i < cell_count; i++) {
+    const Cell& cell = cells_[i];
     if (cell.isStdCell()) {
       // Site alignment check
       if (cell.x_ % grid_->getSiteWidth() != 0
           || row_coords.find(cell.y_.v) == row_coords.end()) {
-        site_align_failures.push_back(&cell);
+        failures[i] = kSiteAlign;
         continue;
       }
 
       if (!checkInRows(cell)) {
-        in_rows_failures.push_back(&cell);
+        failures[i] |= kInRows;
       }
       if (!checkRegionPlacement(&cell)) {
-        region_placement_failures.push_back(&cell);
+        failures[i] |= kRegionPlacement;
       }
     }
     // Placed check
     if (!isPlaced(&cell)) {
-      placed_failures.push_back(&cell);
+      failures[i] |= kPlaced;
+    }
+  }
+
+  // Each pixel belongs to the first cell covering it.  Assigning the
+  // pixels up front leaves checkOverlap nothing to write, so the overlap
+  // checks run in parallel and find the same cells as a serial pass.
+  // Cells that are not site aligned are not checked for overlaps.
+  for (int i = 0; i < cell_count; i++) {
+    if (failures[i] & kSiteAlign) {
+      continue;
     }
+    Cell& cell = cells_[i];
+    grid_->visitCellPixels(cell, true, [&](Pixel* pixel) {
+      if (pixel->cell == nullptr) {
+        pixel->cell = &cell;
+      }
+    });
+  }
+  // The one site gap check also needs the pixels of every cell assigned,
+  // otherwise it would miss the pixels that could have resulted in one-site
+  // gap violations as null.
+#pragma omp parallel for schedule(dynamic, 1024) num_threads(thread_count)
+  for (int i = 0; i < cell_count; i++) {
+    Cell& cell = cells_[i];
     // Overlap check
-    if (checkOverlap(cell)) {
-      overlap_failures.push_back(&cell);
+    if (!(failures[i] & kSiteAlign) && checkOverlap(cell)) {
+      failures[i] |= kOverlap;
+    }
+    // One site gap check
+    if (disallow_one_site_gaps && checkOneSiteGaps(cell)) {
+      failures[i] |= kOneSiteGap;
     }
   }
-  // This loop is separate because it needs to be done after the overlap check
-  // The overlap check assigns the overlap cell to its pixel
-  // Thus, the one site gap check needs to be done after the overlap check
-  // Otherwise, this check will miss the pixels that could have resulted in
-  // one-site gap violations as null
-  if (disallow_one_site_gaps) {
-    for (Cell& cell : cells_) {
-      // One site gap check
-      if (checkOneSiteGaps(cell)) {
-        one_site_gap_failures.push_back(&cell);
-      }
+
+  vector<Cell*> placed_failures;
+  vector<Cell*> in_rows_failures;
+  vector<Cell*> overlap_failures;
+  vector<Cell*> one_site_gap_failures;
+  vector<Cell*> site_align_failures;
+  vector<Cell*> region_placement_failures;
+  for (int i = 0; i < cell_count; i++) {
+    Cell* cell = &cells_[i];
+    if (failures[i] & kPlaced) {
+      placed_failures.push_back(cell);
+    }
+    if (failures[i] & kInRows) {
+      in_rows_failures.push_back(cell);
+    }
+    if (failures[i] & kOverlap) {
+      overlap_failures.push_back(cell);
+    }
+    if (failures[i] & kOneSiteGap) {
+      one_site_gap_failures.push_back(cell);
+    }
+    if (failures[i] & kSiteAlign) {
+      site_align_failures.push_back(cell);
+    }
+    if (failures[i] & kRegionPlacement) {
+      region_placement_failures.push_back(cell);
     }
   }
+
   if (!report_file_name.empty()) {
     writeJsonReport(report_file_name,
                     placed_failures,
@@ -126,6 +192,13 @@ void Opendp::checkPlacement(const bool verbose,
   reportFailures(one_site_gap_failures, 7, "One site gap", verbose);
   reportFailures(region_placement_failures, 8, "Region placement", verbose);
 
+  if (reuse_grid) {
+    // Leave the grid as the legalizer session made it.
+    grid_->clearCells();
+    setFixedGridCells();
+    grid_tracker_->track(block_);
+  }
+
   logger_->metric("design__violations",
                   placed_failures.size() + in_rows_failures.size()
                       + overlap_failures.size() + site_align_failures.size());
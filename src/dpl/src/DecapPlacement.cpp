@@ -39,6 +39,7 @@
 #include "Padding.h"
 #include "dpl/Opendp.h"
 #include "odb/dbShape.h"
+#include "ord/OpenRoad.hh"
 #include "utl/Logger.h"
 
 namespace dpl {
@@ -254,27 +255,38 @@ void Opendp::findGaps()
     }
   }
   const auto& chosen_grid_info = grid_->getInfoMap().at(chosen_grid_key);
-  GridY chosen_row_count = chosen_grid_info.getRowCount();
-  if (!chosen_grid_info.isHybrid()) {
-    DbuY site_height = min_height;
-    for (GridY row{0}; row < chosen_row_count; row++) {
-      findGapsInRow(row, site_height, chosen_grid_info);
+  const int chosen_row_count = chosen_grid_info.getRowCount().v;
+  const auto& hybrid_sites_vec = chosen_grid_info.getSites();
+  const int hybrid_sites_num = hybrid_sites_vec.size();
+
+  // Rows are scanned in parallel and merged in row order.
+  vector<vector<GapInfo*>> row_gaps(chosen_row_count);
+  vector<int> row_gap_y(chosen_row_count);
+  const int thread_count = ord::OpenRoad::openRoad()->getThreadCount();
+#pragma omp parallel for schedule(dynamic) num_threads(thread_count)
+  for (int row = 0; row < chosen_row_count; row++) {
+    DbuY row_height = min_height;
+    if (chosen_grid_info.isHybrid()) {
+      dbSite* site = hybrid_sites_vec[row % hybrid_sites_num].site;
+      row_height = DbuY{static_cast<int>(site->getHeight())};
     }
-  } else {
-    const auto& hybrid_sites_vec = chosen_grid_info.getSites();
-    const int hybrid_sites_num = hybrid_sites_vec.size();
-    for (GridY row{0}; row < chosen_row_count; row++) {
-      const int index = row.v % hybrid_sites_num;
-      dbSite* site = hybrid_sites_vec[index].site;
-      DbuY row_height{static_cast<int>(site->getHeight())};
-      findGapsInRow(row, row_height, chosen_grid_info);
+    row_gap_y[row]
+        = grid_->getCore().yMin() + gridToDbu(GridY{row}, row_height).v;
+    findGapsInRow(GridY{row}, row_height, chosen_grid_info, row_gaps[row]);
+  }
+
+  for (int row = 0; row < chosen_row_count; row++) {
+    if (!row_gaps[row].empty()) {
+      vector<GapInfo*>& gaps = gaps_[row_gap_y[row]];
+      gaps.insert(gaps.end(), row_gaps[row].begin(), row_gaps[row].end());
     }
   }
 }
 
 void Opendp::findGapsInRow(GridY row,
                            DbuY row_height,
-                           const GridInfo& grid_info)
+                           const GridInfo& grid_info,
+                           vector<GapInfo*>& gaps) const
 {
   GridX j{0};
 
@@ -296,8 +308,7 @@ void Opendp::findGapsInRow(GridY row,
       DbuX gap_x{core.xMin() + gridToDbu(j, site_width)};
       DbuY gap_y{core.yMin() + gridToDbu(row, DbuY{row_height})};
       DbuX gap_width{gridToDbu(k, site_width) - gridToDbu(j, site_width)};
-      gaps_[gap_y.v].emplace_back(
-          new GapInfo(gap_x.v, orient, gap_width.v, row_height.v));
+      gaps.push_back(new GapInfo(gap_x.v, orient, gap_width.v, row_height.v));
 
       j += (k - j);
     } else {
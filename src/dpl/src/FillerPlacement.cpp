@@ -37,6 +37,7 @@
 #include "Grid.h"
 #include "Objects.h"
 #include "dpl/Opendp.h"
+#include "ord/OpenRoad.hh"
 #include "utl/Logger.h"
 
 namespace dpl {
@@ -50,6 +51,15 @@ using odb::dbPlacementStatus;
 
 using utl::format_as;
 
+// A run of empty sites in a row to be filled, [start, end).
+struct FillerGap
+{
+  GridX start;
+  GridX end;
+  dbTechLayer* implant;
+  dbOrientType orient;
+};
+
 static dbTechLayer* getImplant(dbMaster* master)
 {
   if (!master) {
@@ -110,7 +120,19 @@ void Opendp::fillerPlacement(dbMasterSeq* filler_masters, const char* prefix)
       }
     }
     const auto& chosen_grid_info = grid_->getInfoMap().at(chosen_grid_key);
-    GridY chosen_row_count = chosen_grid_info.getRowCount();
+    const int chosen_row_count = chosen_grid_info.getRowCount().v;
+
+    // Finding the gaps only reads the grid, so rows are scanned in parallel.
+    // The fillers are then created serially in row order to keep the
+    // instance names and creation order unchanged.
+    vector<vector<FillerGap>> row_gaps(chosen_row_count);
+    const int thread_count = ord::OpenRoad::openRoad()->getThreadCount();
+#pragma omp parallel for schedule(dynamic) num_threads(thread_count)
+    for (int row = 0; row < chosen_row_count; row++) {
+      row_gaps[row] = findRowFillerGaps(
+          GridY{row}, filler_masters_by_implant, chosen_grid_info);
+    }
+
     if (!chosen_grid_info.isHybrid()) {
       DbuY site_height = min_height;
       for (GridY row{0}; row < chosen_row_count; row++) {
@@ -118,7 +140,8 @@ void Opendp::fillerPlacement(dbMasterSeq* filler_masters, const char* prefix)
                         prefix,
                         filler_masters_by_implant,
                         site_height,
-                        chosen_grid_info);
+                        chosen_grid_info,
+                        row_gaps[row.v]);
       }
     } else {
       const auto& hybrid_sites_vec = chosen_grid_info.getSites();
@@ -131,7 +154,8 @@ void Opendp::fillerPlacement(dbMasterSeq* filler_masters, const char* prefix)
                         prefix,
                         filler_masters_by_implant,
                         row_height,
-                        chosen_grid_info);
+                        chosen_grid_info,
+                        row_gaps[row.v]);
       }
     }
   }
@@ -147,12 +171,12 @@ void Opendp::setGridCells()
   }
 }
 
-void Opendp::placeRowFillers(GridY row,
-                             const char* prefix,
-                             const MasterByImplant& filler_masters_by_implant,
-                             DbuY row_height,
-                             const GridInfo& grid_info)
+vector<FillerGap> Opendp::findRowFillerGaps(
+    GridY row,
+    const MasterByImplant& filler_masters_by_implant,
+    const GridInfo& grid_info) const
 {
+  vector<FillerGap> gaps;
   GridX j{0};
 
   const DbuX site_width = grid_->getSiteWidth();
@@ -184,48 +208,63 @@ void Opendp::placeRowFillers(GridY row,
         implant = filler_masters_by_implant.begin()->first;
       }
 
-      GridX gap = k - j;
-      dbMasterSeq& fillers
-          = gapFillers(implant, gap, filler_masters_by_implant);
-      const Rect core = grid_->getCore();
-      if (fillers.empty()) {
-        DbuX x{core.xMin() + gridToDbu(j, site_width)};
-        DbuY y{core.yMin() + gridToDbu(row, DbuY{row_height})};
-        logger_->error(
-            DPL,
-            2,
-            "could not fill gap of size {} at {},{} dbu between {} and {}",
-            gap,
-            x,
-            y,
-            gridInstName(row, j - 1, grid_info),
-            gridInstName(row, k + 1, grid_info));
-      } else {
-        k = j;
-        debugPrint(
-            logger_, DPL, "filler", 2, "fillers size is {}.", fillers.size());
-        for (dbMaster* master : fillers) {
-          string inst_name = prefix + to_string(grid_info.getGridIndex()) + "_"
-                             + to_string(row.v) + "_" + to_string(k.v);
-          dbInst* inst = dbInst::create(block_,
-                                        master,
-                                        inst_name.c_str(),
-                                        /* physical_only */ true);
-          DbuX x{core.xMin() + gridToDbu(k, site_width)};
-          DbuY y{core.yMin() + gridToDbu(row, DbuY{row_height})};
-          inst->setOrient(orient);
-          inst->setLocation(x.v, y.v);
-          inst->setPlacementStatus(dbPlacementStatus::PLACED);
-          inst->setSourceType(odb::dbSourceType::DIST);
-          filler_count_++;
-          k += master->getWidth() / site_width.v;
-        }
-        j += gap;
-      }
+      gaps.push_back({j, k, implant, orient});
+      j = k;
     } else {
       j++;
     }
   }
+  return gaps;
+}
+
+void Opendp::placeRowFillers(GridY row,
+                             const char* prefix,
+                             const MasterByImplant& filler_masters_by_implant,
+                             DbuY row_height,
+                             const GridInfo& grid_info,
+                             const vector<FillerGap>& gaps)
+{
+  const DbuX site_width = grid_->getSiteWidth();
+  const Rect core = grid_->getCore();
+  for (const FillerGap& filler_gap : gaps) {
+    const GridX j = filler_gap.start;
+    GridX k = filler_gap.end;
+    GridX gap = k - j;
+    dbMasterSeq& fillers
+        = gapFillers(filler_gap.implant, gap, filler_masters_by_implant);
+    if (fillers.empty()) {
+      DbuX x{core.xMin() + gridToDbu(j, site_width)};
+      DbuY y{core.yMin() + gridToDbu(row, DbuY{row_height})};
+      logger_->error(
+          DPL,
+          2,
+          "could not fill gap of size {} at {},{} dbu between {} and {}",
+          gap,
+          x,
+          y,
+          gridInstName(row, j - 1, grid_info),
+          gridInstName(row, k + 1, grid_info));
+    }
+    k = j;
+    debugPrint(
+        logger_, DPL, "filler", 2, "fillers size is {}.", fillers.size());
+    for (dbMaster* master : fillers) {
+      string inst_name = prefix + to_string(grid_info.getGridIndex()) + "_"
+                         + to_string(row.v) + "_" + to_string(k.v);
+      dbInst* inst = dbInst::create(block_,
+                                    master,
+                                    inst_name.c_str(),
+                                    /* physical_only */ true);
+      DbuX x{core.xMin() + gridToDbu(k, site_width)};
+      DbuY y{core.yMin() + gridToDbu(row, DbuY{row_height})};
+      inst->setOrient(filler_gap.orient);
+      inst->setLocation(x.v, y.v);
+      inst->setPlacementStatus(dbPlacementStatus::PLACED);
+      inst->setSourceType(odb::dbSourceType::DIST);
+      filler_count_++;
+      k += master->getWidth() / site_width.v;
+    }
+  }
 }
 
 const char* Opendp::gridInstName(GridY row,
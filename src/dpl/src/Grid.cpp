@@ -329,33 +329,21 @@ void Grid::initGrid(dbDatabase* db,
   // Make pixel grid
   if (pixels_.empty()) {
     resize(getInfoMap().size());
-    for (auto& [gmk, grid_info] : getInfoMap()) {
-      resize(grid_info.getGridIndex(), grid_info.getRowCount());
-    }
   }
 
   for (auto& [gmk, grid_info] : getInfoMap()) {
     const GridY layer_row_count = grid_info.getRowCount();
     const GridX layer_row_site_count = grid_info.getSiteCount();
     const int index = grid_info.getGridIndex();
-    resize(index, layer_row_count);
+    resize(index, layer_row_count, layer_row_site_count);
+    const auto& grid_sites = grid_info.getSites();
+    if (grid_sites.empty()) {
+      continue;
+    }
     for (GridY j{0}; j < layer_row_count; j++) {
-      resize(index, j, layer_row_site_count);
-      const auto& grid_sites = grid_info.getSites();
-      dbSite* row_site = nullptr;
-      if (!grid_sites.empty()) {
-        row_site = grid_sites[j.v % grid_sites.size()].site;
-      }
-
+      dbSite* row_site = grid_sites[j.v % grid_sites.size()].site;
       for (GridX k{0}; k < layer_row_site_count; k++) {
-        Pixel& pixel = pixels_[index][j.v][k.v];
-        pixel.cell = nullptr;
-        pixel.group = nullptr;
-        pixel.util = 0.0;
-        pixel.is_valid = false;
-        pixel.is_hopeless = false;
-        pixel.site = nullptr;
-        pixel.site = row_site;
+        pixel(index, j, k).site = row_site;
       }
     }
   }
@@ -446,14 +434,19 @@ void Grid::initGrid(dbDatabase* db,
     for (const auto& rect : rects) {
       for (int y = gtl::yl(rect); y < gtl::yh(rect); y++) {
         for (int x = gtl::xl(rect); x < gtl::xh(rect); x++) {
-          Pixel& pixel = pixels_[h_index][y][x];
-          pixel.is_hopeless = true;
+          pixel(h_index, GridY{y}, GridX{x}).is_hopeless = true;
         }
       }
     }
   }
 }
 
+void Grid::resize(int g, GridY row_count, GridX site_count)
+{
+  row_strides_[g] = site_count.v;
+  pixels_[g].assign(static_cast<size_t>(row_count.v) * site_count.v, Pixel());
+}
+
 Pixel* Grid::gridPixel(int grid_idx, GridX grid_x, GridY grid_y) const
 {
   if (grid_idx < 0 || grid_idx >= grid_info_vector_.size()) {
@@ -462,7 +455,7 @@ Pixel* Grid::gridPixel(int grid_idx, GridX grid_x, GridY grid_y) const
   const GridInfo* grid_info = grid_info_vector_[grid_idx];
   if (grid_x >= 0 && grid_x < grid_info->getSiteCount() && grid_y >= 0
       && grid_y < grid_info->getRowCount()) {
-    return const_cast<Pixel*>(&pixels_[grid_idx][grid_y.v][grid_x.v]);
+    return const_cast<Pixel*>(&pixel(grid_idx, grid_y, grid_x));
   }
   return nullptr;
 }
@@ -184,16 +184,37 @@ class Grid
                          bool start) const;
 
   Pixel* gridPixel(int grid_idx, GridX x, GridY y) const;
-  Pixel& pixel(int g, GridY y, GridX x) { return pixels_[g][y.v][x.v]; }
+  Pixel& pixel(int g, GridY y, GridX x)
+  {
+    return pixels_[g][pixelIndex(g, y, x)];
+  }
   const Pixel& pixel(int g, GridY y, GridX x) const
   {
-    return pixels_[g][y.v][x.v];
+    return pixels_[g][pixelIndex(g, y, x)];
   }
 
-  void resize(int size) { pixels_.resize(size); }
-  void resize(int g, GridY size) { pixels_[g].resize(size.v); }
-  void resize(int g, GridY y, GridX size) { pixels_[g][y.v].resize(size.v); }
-  void clear() { pixels_.clear(); }
+  void resize(int size)
+  {
+    pixels_.resize(size);
+    row_strides_.resize(size);
+  }
+  // Reset layer g to row_count x site_count default pixels.
+  void resize(int g, GridY row_count, GridX site_count);
+  void clear()
+  {
+    pixels_.clear();
+    row_strides_.clear();
+  }
+  // Remove the cells from all pixels, keeping rows, sites and blockages.
+  void clearCells()
+  {
+    for (std::vector<Pixel>& layer : pixels_) {
+      for (Pixel& pixel : layer) {
+        pixel.cell = nullptr;
+        pixel.util = 0.0;
+      }
+    }
+  }
 
   GridInfo& infoMap(const GridMapKey& key) { return grid_info_map_.at(key); }
   const GridInfo& infoMap(const GridMapKey& key) const
@@ -225,11 +246,17 @@ class Grid
   void addInfoMap(const GridMapKey& key, const GridInfo& info);
   void visitDbRows(dbBlock* block,
                    const std::function<void(odb::dbRow*)>& func) const;
+  size_t pixelIndex(int g, GridY y, GridX x) const
+  {
+    return static_cast<size_t>(y.v) * row_strides_[g] + x.v;
+  }
 
   Logger* logger_ = nullptr;
   dbBlock* block_ = nullptr;
   std::shared_ptr<Padding> padding_;
-  std::vector<std::vector<std::vector<Pixel>>> pixels_;
+  // One row-major pixel array per grid layer.
+  std::vector<std::vector<Pixel>> pixels_;
+  std::vector<int> row_strides_;  // sites per row, per grid layer
   std::vector<const GridInfo*> grid_info_vector_;
   map<GridMapKey, GridInfo> grid_info_map_;
   std::unordered_map<dbSite*, dbSite*> hybrid_parent_;  // child -> parent
@@ -0,0 +1,71 @@
+/////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2024, Precision Innovations Inc.
+// All rights reserved.
+//
+// BSD 3-Clause License
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "odb/db.h"
+#include "odb/dbBlockCallBackObj.h"
+
+namespace dpl {
+
+// Watches the block for edits that change the fixed cell pixels painted by
+// Opendp::initMacrosAndGrid so resizer can reuse the grid across calls.
+// Placed (non-fixed) cell edits do not touch the grid and are ignored.
+class GridChangeTracker : public odb::dbBlockCallBackObj
+{
+ public:
+  void track(odb::dbBlock* block);
+  void invalidate() { valid_ = false; }
+  bool isValid(odb::dbBlock* block) const
+  {
+    return valid_ && block == block_;
+  }
+
+  // from dbBlockCallBackObj API
+  void inDbInstDestroy(odb::dbInst* inst) override;
+  void inDbInstPlacementStatusBefore(
+      odb::dbInst* inst,
+      const odb::dbPlacementStatus& status) override;
+  void inDbInstSwapMasterAfter(odb::dbInst* inst) override;
+  void inDbPreMoveInst(odb::dbInst* inst) override;
+  void inDbRowCreate(odb::dbRow* row) override;
+  void inDbRowDestroy(odb::dbRow* row) override;
+
+ private:
+  void checkInst(odb::dbInst* inst);
+
+  odb::dbBlock* block_ = nullptr;
+  bool valid_ = false;
+};
+
+}  // namespace dpl
@@ -49,9 +49,11 @@
 
 #include "DplObserver.h"
 #include "Grid.h"
+#include "GridChangeTracker.h"
 #include "Objects.h"
 #include "Padding.h"
 #include "dpl/OptMirror.h"
+#include "odb/dbBlockCallBackObj.h"
 #include "odb/util.h"
 #include "utl/Logger.h"
 
@@ -80,6 +82,7 @@ Opendp::Opendp()
 {
   dummy_cell_ = std::make_unique<Cell>();
   dummy_cell_->is_placed_ = true;
+  grid_tracker_ = std::make_unique<GridChangeTracker>();
 }
 
 Opendp::~Opendp() = default;
@@ -91,20 +94,24 @@ void Opendp::init(dbDatabase* db, Logger* logger)
   padding_ = std::make_shared<Padding>();
   grid_ = std::make_unique<Grid>();
   grid_->init(logger);
+  grid_tracker_->invalidate();
 }
 
 void Opendp::setPaddingGlobal(const int left, const int right)
 {
+  grid_tracker_->invalidate();
   padding_->setPaddingGlobal(GridX{left}, GridX{right});
 }
 
 void Opendp::setPadding(dbInst* inst, const int left, const int right)
 {
+  grid_tracker_->invalidate();
   padding_->setPadding(inst, GridX{left}, GridX{right});
 }
 
 void Opendp::setPadding(dbMaster* master, const int left, const int right)
 {
+  grid_tracker_->invalidate();
   padding_->setPadding(master, GridX{left}, GridX{right});
 }
 
@@ -168,6 +175,7 @@ void Opendp::detailedPlacement(const int max_displacement_x,
 
 void Opendp::updateDbInstLocations()
 {
+  odb::dbInstMoveBatch move_batch(block_);
   for (Cell& cell : cells_) {
     if (!cell.isFixed() && cell.isStdCell()) {
       dbInst* db_inst_ = cell.db_inst_;
@@ -276,6 +284,7 @@ int Opendp::padRight(dbInst* inst) const
 
 void Opendp::initGrid()
 {
+  grid_tracker_->invalidate();
   grid_->initGrid(
       db_, block_, padding_, max_displacement_x_, max_displacement_y_);
 }
@@ -111,10 +111,10 @@ report_legalization_stats()
 }
 
 void
-check_placement_cmd(bool verbose, bool disallow_one_site_gaps, const char* report_file_name)
+check_placement_cmd(bool verbose, bool disallow_one_site_gaps, const char* report_file_name, bool incremental)
 {
   dpl::Opendp *opendp = ord::OpenRoad::openRoad()->getOpendp();
-  opendp->checkPlacement(verbose, disallow_one_site_gaps, std::string(report_file_name));
+  opendp->checkPlacement(verbose, disallow_one_site_gaps, std::string(report_file_name), incremental);
 }
 
 
@@ -178,6 +178,13 @@ set_debug_cmd(float min_displacement,
   }
 }
 
+void
+set_row_band_min_cells(int min_cells)
+{
+  dpl::Opendp* opendp = ord::OpenRoad::openRoad()->getOpendp();
+  opendp->setRowBandMinCells(min_cells);
+}
+
 } // namespace
 
 %} // inline
@@ -149,6 +149,7 @@ proc remove_fillers { args } {
 
 sta::define_cmd_args "check_placement" {[-verbose] \
                                         [-disallow_one_site_gaps] \
+                                        [-incremental] \
                                         [-report_file_name file_name]}
 
 proc check_placement { args } {
@@ -158,15 +159,18 @@ proc check_placement { args } {
   }
 
   sta::parse_key_args "check_placement" args \
-    keys {-report_file_name} flags {-verbose -disallow_one_site_gaps}
+    keys {-report_file_name} \
+    flags {-verbose -disallow_one_site_gaps -incremental}
   set verbose [info exists flags(-verbose)]
   set disallow_one_site_gaps [info exists flags(-disallow_one_site_gaps)]
+  set incremental [info exists flags(-incremental)]
   sta::check_argc_eq0 "check_placement" $args
   set file_name ""
   if { [info exists keys(-report_file_name) ] } {
     set file_name $keys(-report_file_name)
   }
-  dpl::check_placement_cmd $verbose $disallow_one_site_gaps $file_name
+  dpl::check_placement_cmd $verbose $disallow_one_site_gaps $file_name \
+    $incremental
 }
 
 sta::define_cmd_args "optimize_mirroring" {}
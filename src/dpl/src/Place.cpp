@@ -45,9 +45,11 @@
 
 #include "DplObserver.h"
 #include "Grid.h"
+#include "GridChangeTracker.h"
 #include "Objects.h"
 #include "Padding.h"
 #include "dpl/Opendp.h"
+#include "ord/OpenRoad.hh"
 #include "utl/Logger.h"
 
 // #define ODP_DEBUG
@@ -343,12 +345,81 @@ void Opendp::place()
       }
     }
   }
+  placeRowBands(sorted_cells);
+}
+
+// Single row cells are split into horizontal bands of rows.  A cell is
+// assigned to a band only if every pixel its diamond search can read or
+// paint lies inside the band, so bands are independent and can be placed
+// concurrently.  Cells that straddle a band boundary, or that the band pass
+// fails to map, are placed serially afterwards with shiftMove as fallback.
+// Every band is processed in sorted order and the band boundaries only
+// depend on the design, so the result is the same for any thread count.
+void Opendp::placeRowBands(const vector<Cell*>& sorted_cells)
+{
+  vector<Cell*> single_row_cells;
+  single_row_cells.reserve(sorted_cells.size());
   for (Cell* cell : sorted_cells) {
     if (!isMultiRow(cell)) {
-      if (!mapMove(cell)) {
-        shiftMove(cell);
+      single_row_cells.push_back(cell);
+    }
+  }
+
+  const int thread_count = ord::OpenRoad::openRoad()->getThreadCount();
+  const int row_count = grid_->getRowCount().v;
+  // The search window spans the displacement limit on both sides of the
+  // cell plus the cell height; one extra row of slack on each side.
+  const int search_height = 2 * (max_displacement_y_ + 1);
+  const int band_height = row_band_search_heights_ * search_height;
+  const int band_count = divCeil(row_count, band_height);
+  // Hybrid rows paint into several grid layers at once and the debug
+  // observer is not thread safe, so those always go serial.
+  const bool use_bands
+      = band_count > 1 && debug_observer_ == nullptr
+        && grid_->getInfoMap().size() == 1
+        && single_row_cells.size() >= static_cast<size_t>(row_band_min_cells_);
+
+  vector<Cell*> serial_cells;
+  if (use_bands) {
+    vector<vector<Cell*>> band_cells(band_count);
+    for (Cell* cell : single_row_cells) {
+      const GridY y = legalGridPt(cell, true).y;
+      const int lo = y.v - max_displacement_y_ - 1;
+      const int hi = y.v + max_displacement_y_ + grid_->gridHeight(cell).v + 1;
+      const int band = max(lo, 0) / band_height;
+      if (band < band_count
+          && (band == band_count - 1 || hi < (band + 1) * band_height)) {
+        band_cells[band].push_back(cell);
+      } else {
+        serial_cells.push_back(cell);
       }
     }
+
+    vector<vector<Cell*>> band_failures(band_count);
+#pragma omp parallel for schedule(dynamic) num_threads(thread_count)
+    for (int band = 0; band < band_count; band++) {
+      for (Cell* cell : band_cells[band]) {
+        if (!mapMove(cell)) {
+          band_failures[band].push_back(cell);
+        }
+      }
+    }
+
+    for (const vector<Cell*>& failures : band_failures) {
+      serial_cells.insert(serial_cells.end(), failures.begin(), failures.end());
+    }
+    // Restore the global placement order for the serial pass.
+    sort(serial_cells.begin(),
+         serial_cells.end(),
+         CellPlaceOrderLess(grid_->getCore()));
+  } else {
+    serial_cells = std::move(single_row_cells);
+  }
+
+  for (Cell* cell : serial_cells) {
+    if (!mapMove(cell)) {
+      shiftMove(cell);
+    }
   }
 }
 
@@ -1237,9 +1308,16 @@ bool Opendp::moveHopeless(const Cell* cell, GridX& grid_x, GridY& grid_y) const
 
 void Opendp::initMacrosAndGrid()
 {
+  // Only fixed cells are painted, so the grid stays usable across resizer
+  // edits to placed cells and is rebuilt once a fixed cell or row changes.
+  dbBlock* block = db_->getChip()->getBlock();
+  if (grid_tracker_->isValid(block)) {
+    return;
+  }
   importDb();
   initGrid();
   setFixedGridCells();
+  grid_tracker_->track(block_);
 }
 
 void Opendp::convertDbToCell(dbInst* db_inst, Cell& cell)
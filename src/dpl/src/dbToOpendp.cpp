@@ -39,6 +39,7 @@
 #include <unordered_set>
 
 #include "Grid.h"
+#include "GridChangeTracker.h"
 #include "Objects.h"
 #include "dpl/Opendp.h"
 #include "utl/Logger.h"
@@ -57,6 +58,13 @@ using odb::dbRegion;
 using odb::Rect;
 
 void Opendp::importDb()
+{
+  grid_tracker_->invalidate();
+  deleteGrid();
+  importCells();
+}
+
+void Opendp::importCells()
 {
   block_ = db_->getChip()->getBlock();
   grid_->initBlock(block_);
@@ -77,7 +85,6 @@ void Opendp::importClear()
   cells_.clear();
   groups_.clear();
   db_inst_map_.clear();
-  deleteGrid();
   have_multi_row_cells_ = false;
 }
 
@@ -0,0 +1,11 @@
+source "helpers.tcl"
+# check_placement -incremental reports the same overlap as a full check,
+# both when it builds the grid and when it reuses it
+read_lef Nangate45/Nangate45.lef
+read_def check2.def
+catch {check_placement -verbose} error
+puts $error
+catch {check_placement -verbose -incremental} error
+puts $error
+catch {check_placement -verbose -incremental} error
+puts $error
@@ -0,0 +1,36 @@
+# single row cells placed in row bands give the same placement with one and
+# four threads
+source "helpers.tcl"
+read_lef Nangate45/Nangate45.lef
+read_def aes_cipher_top_replace.def
+dpl::set_row_band_min_cells 0
+
+set block [ord::get_db_block]
+set placement {}
+foreach inst [$block getInsts] {
+  if { ![$inst isFixed] } {
+    lappend placement [list $inst [$inst getOrient] [$inst getOrigin] \
+                         [$inst getPlacementStatus]]
+  }
+}
+
+set_thread_count 1
+detailed_placement
+check_placement
+set def_file1 [make_result_file row_bands_t1.def]
+write_def $def_file1
+
+foreach inst_placement $placement {
+  lassign $inst_placement inst orient origin status
+  $inst setOrient $orient
+  $inst setOrigin {*}$origin
+  $inst setPlacementStatus $status
+}
+
+set_thread_count 4
+detailed_placement
+check_placement
+set def_file4 [make_result_file row_bands_t4.def]
+write_def $def_file4
+
+diff_files $def_file1 $def_file4
@@ -42,6 +42,7 @@
 #include <map>
 
 #include "dpl/Opendp.h"
+#include "odb/dbBlockCallBackObj.h"
 #include "odb/util.h"
 #include "ord/OpenRoad.hh"  // closestPtInRect
 #include "utl/Logger.h"
@@ -199,7 +200,9 @@ void Optdp::import()
 ////////////////////////////////////////////////////////////////
 void Optdp::updateDbInstLocations()
 {
-  for (dbInst* inst : db_->getChip()->getBlock()->getInsts()) {
+  dbBlock* block = db_->getChip()->getBlock();
+  odb::dbInstMoveBatch move_batch(block);
+  for (dbInst* inst : block->getInsts()) {
     if (!inst->getMaster()->isCoreAutoPlaceable() || inst->isFixed()) {
       continue;
     }
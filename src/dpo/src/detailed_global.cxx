@@ -185,9 +185,11 @@ void DetailedGlobalSwap::globalSwap()
 
     if (nextHpwl <= currHpwl) {
       mgr_->acceptMove();
+      hpwlObj.accept();
       currHpwl = nextHpwl;
     } else {
       mgr_->rejectMove();
+      hpwlObj.reject();
     }
   }
 }
@@ -66,6 +66,11 @@ void DetailedHPWL::init()
   traversal_ = 0;
   edgeMask_.resize(network_->getNumEdges());
   std::fill(edgeMask_.begin(), edgeMask_.end(), traversal_);
+
+  edgeBox_.resize(network_->getNumEdges());
+  edgeBoxValid_.assign(network_->getNumEdges(), 0);
+  edgeSlot_.resize(network_->getNumEdges());
+  moveEdges_.clear();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -126,7 +131,7 @@ double DetailedHPWL::delta(const int n,
   double x, y;
   double old_wl = 0.;
   double new_wl = 0.;
-  Rectangle old_box, new_box;
+  const bool useCache = (orientPtr_ == nullptr);
 
   // Put cells into their "old positions and orientations".
   for (int i = 0; i < n; i++) {
@@ -137,7 +142,9 @@ double DetailedHPWL::delta(const int n,
     }
   }
 
+  // Find the affected nets, in the order they are first seen.
   ++traversal_;
+  moveEdges_.clear();
   for (int i = 0; i < n; i++) {
     Node* ndi = nodes[i];
     for (Pin* pini : ndi->getPins()) {
@@ -151,20 +158,42 @@ double DetailedHPWL::delta(const int n,
         continue;
       }
       edgeMask_[edi->getId()] = traversal_;
+      edgeSlot_[edi->getId()] = moveEdges_.size();
+      moveEdges_.push_back(edi);
+    }
+  }
+  const int nedges = moveEdges_.size();
+  moveOldBox_.resize(nedges);
+  moveNewBox_.resize(nedges);
+  moveFull_.assign(nedges, useCache ? 0 : 1);
+
+  for (int e = 0; e < nedges; e++) {
+    const int id = moveEdges_[e]->getId();
+    if (useCache && edgeBoxValid_[id]) {
+      moveOldBox_[e] = edgeBox_[id];
+    } else {
+      moveOldBox_[e] = edgeBox(moveEdges_[e]);
+    }
+  }
 
-      old_box.reset();
-      for (int pj = 0; pj < edi->getNumPins(); pj++) {
-        Pin* pinj = edi->getPins()[pj];
-
-        Node* curr = pinj->getNode();
-
-        x = curr->getLeft() + 0.5 * curr->getWidth() + pinj->getOffsetX();
-        y = curr->getBottom() + 0.5 * curr->getHeight() + pinj->getOffsetY();
-
-        old_box.addPt(x, y);
+  // A moved pin strictly inside the old box does not bound it.  If that holds
+  // for every moved pin of a net, the new box is the old one grown by the new
+  // pin locations; otherwise it has to be recomputed from all the pins.
+  if (useCache) {
+    for (int i = 0; i < n; i++) {
+      for (Pin* pini : nodes[i]->getPins()) {
+        const Edge* edi = pini->getEdge();
+        if (edgeMask_[edi->getId()] != traversal_) {
+          continue;
+        }
+        const int e = edgeSlot_[edi->getId()];
+        const Rectangle& box = moveOldBox_[e];
+        pinLocation(pini, x, y);
+        if (x <= box.xmin() || x >= box.xmax() || y <= box.ymin()
+            || y >= box.ymax()) {
+          moveFull_[e] = 1;
+        }
       }
-
-      old_wl += (old_box.getWidth() + old_box.getHeight());
     }
   }
 
@@ -177,39 +206,36 @@ double DetailedHPWL::delta(const int n,
     }
   }
 
-  ++traversal_;
-  for (int i = 0; i < n; i++) {
-    Node* ndi = nodes[i];
-    for (int pi = 0; pi < ndi->getNumPins(); pi++) {
-      Pin* pini = ndi->getPins()[pi];
-
-      Edge* edi = pini->getEdge();
-
-      int npins = edi->getNumPins();
-      if (npins <= 1 || npins >= skipNetsLargerThanThis_) {
-        continue;
-      }
-      if (edgeMask_[edi->getId()] == traversal_) {
-        continue;
-      }
-      edgeMask_[edi->getId()] = traversal_;
-
-      new_box.reset();
-      for (int pj = 0; pj < edi->getNumPins(); pj++) {
-        Pin* pinj = edi->getPins()[pj];
-
-        Node* curr = pinj->getNode();
-
-        x = curr->getLeft() + 0.5 * curr->getWidth() + pinj->getOffsetX();
-        y = curr->getBottom() + 0.5 * curr->getHeight() + pinj->getOffsetY();
-
-        new_box.addPt(x, y);
+  for (int e = 0; e < nedges; e++) {
+    if (moveFull_[e]) {
+      moveNewBox_[e] = edgeBox(moveEdges_[e]);
+    } else {
+      moveNewBox_[e] = moveOldBox_[e];
+    }
+  }
+  if (useCache) {
+    for (int i = 0; i < n; i++) {
+      for (Pin* pini : nodes[i]->getPins()) {
+        const Edge* edi = pini->getEdge();
+        if (edgeMask_[edi->getId()] != traversal_) {
+          continue;
+        }
+        const int e = edgeSlot_[edi->getId()];
+        if (!moveFull_[e]) {
+          pinLocation(pini, x, y);
+          moveNewBox_[e].addPt(x, y);
+        }
       }
-
-      new_wl += (new_box.getWidth() + new_box.getHeight());
     }
   }
 
+  for (int e = 0; e < nedges; e++) {
+    old_wl += (moveOldBox_[e].getWidth() + moveOldBox_[e].getHeight());
+  }
+  for (int e = 0; e < nedges; e++) {
+    new_wl += (moveNewBox_[e].getWidth() + moveNewBox_[e].getHeight());
+  }
+
   // Put cells into their "old positions and orientations" before returning
   // (leave things as they were provided to us...).
   for (int i = 0; i < n; i++) {
@@ -224,6 +250,50 @@ double DetailedHPWL::delta(const int n,
   return old_wl - new_wl;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+void DetailedHPWL::accept()
+{
+  // The last evaluated move was applied; its new boxes are now current.
+  if (orientPtr_ == nullptr) {
+    for (size_t e = 0; e < moveEdges_.size(); e++) {
+      const int id = moveEdges_[e]->getId();
+      edgeBox_[id] = moveNewBox_[e];
+      edgeBoxValid_[id] = 1;
+    }
+  }
+  moveEdges_.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+void DetailedHPWL::reject()
+{
+  moveEdges_.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+void DetailedHPWL::pinLocation(const Pin* pin, double& x, double& y) const
+{
+  const Node* nd = pin->getNode();
+  x = nd->getLeft() + 0.5 * nd->getWidth() + pin->getOffsetX();
+  y = nd->getBottom() + 0.5 * nd->getHeight() + pin->getOffsetY();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+Rectangle DetailedHPWL::edgeBox(const Edge* edi) const
+{
+  Rectangle box;
+  double x, y;
+  for (const Pin* pinj : edi->getPins()) {
+    pinLocation(pinj, x, y);
+    box.addPt(x, y);
+  }
+  return box;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 double DetailedHPWL::delta(Node* ndi, double new_x, double new_y)
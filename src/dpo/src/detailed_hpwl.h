@@ -42,6 +42,7 @@
 #include <vector>
 
 #include "detailed_objective.h"
+#include "rectangle.h"
 
 namespace dpo {
 
@@ -75,6 +76,8 @@ class DetailedHPWL : public DetailedObjective
                const std::vector<int>& newLeft,
                const std::vector<int>& newBottom,
                const std::vector<unsigned>& newOri) override;
+  void accept() override;
+  void reject() override;
 
   void getCandidates(std::vector<Node*>& candidates);
 
@@ -92,6 +95,9 @@ class DetailedHPWL : public DetailedObjective
   ////////////////////////////////////////////////////////////////////////////////
 
  private:
+  Rectangle edgeBox(const Edge* edi) const;
+  void pinLocation(const Pin* pin, double& x, double& y) const;
+
   Network* network_;
 
   DetailedMgr* mgrPtr_ = nullptr;
@@ -101,6 +107,19 @@ class DetailedHPWL : public DetailedObjective
   int skipNetsLargerThanThis_ = 100;
   int traversal_ = 0;
   std::vector<int> edgeMask_;
+
+  // Net boxes kept up to date by accept() so the move delta need not
+  // recompute them.  Only used without orientation changes since
+  // DetailedMgr::acceptMove does not apply those.
+  std::vector<Rectangle> edgeBox_;
+  std::vector<char> edgeBoxValid_;
+  std::vector<int> edgeSlot_;
+
+  // Nets touched by the last evaluated move and their boxes.
+  std::vector<Edge*> moveEdges_;
+  std::vector<Rectangle> moveOldBox_;
+  std::vector<Rectangle> moveNewBox_;
+  std::vector<char> moveFull_;
 };
 
 }  // namespace dpo
@@ -203,10 +203,10 @@ void DetailedReorderer::reorder(const std::vector<Node*>& nodes,
   const int size = jstop - jstrt + 1;
 
   // XXX: Node positions still doubles!
-  std::unordered_map<const Node*, int> origLeft;
+  std::vector<std::pair<Node*, int>> origLeft(size);
   for (int i = 0; i < size; i++) {
-    const Node* ndi = nodes[jstrt + i];
-    origLeft[ndi] = ndi->getLeft();
+    Node* ndi = nodes[jstrt + i];
+    origLeft[i] = {ndi, ndi->getLeft()};
   }
 
   // Changed...  I want to work entirely with the left edge of
@@ -262,7 +262,10 @@ void DetailedReorderer::reorder(const std::vector<Node*>& nodes,
   // might be different.  So, just consider the first permutation
   // like all the others.
 
-  double bestCost = cost(nodes, jstrt, jstop);
+  // The window's nets do not change between permutations, only the cell
+  // positions do, so gather them once.
+  collectEdges(nodes, jstrt, jstop);
+  double bestCost = cost();
   const double origCost = bestCost;
 
   std::vector<int> bestPosn(size, 0);  // Current positions.
@@ -291,7 +294,7 @@ void DetailedReorderer::reorder(const std::vector<Node*>& nodes,
       }
     }
     if (dispOkay) {
-      const double currCost = cost(nodes, jstrt, jstop);
+      const double currCost = cost();
       if (currCost < bestCost) {
         bestPosn = currPosn;
         bestCost = currCost;
@@ -303,9 +306,8 @@ void DetailedReorderer::reorder(const std::vector<Node*>& nodes,
 
   if (!found) {
     // No improvement.  Restore positions and return.
-    for (size_t i = 0; i < size; i++) {
-      Node* ndi = nodes[jstrt + i];
-      ndi->setLeft(origLeft[ndi]);
+    for (const auto& [ndi, x] : origLeft) {
+      ndi->setLeft(x);
     }
     return;
   }
@@ -349,7 +351,7 @@ void DetailedReorderer::reorder(const std::vector<Node*>& nodes,
       // interval.  However, we might have shifted something.
       if (shifted) {
         // Recost.  The shifting might have changed the cost.
-        const double lastCost = cost(nodes, jstrt, jstop);
+        const double lastCost = cost();
         if (lastCost >= origCost) {
           failed = true;
         }
@@ -358,9 +360,8 @@ void DetailedReorderer::reorder(const std::vector<Node*>& nodes,
 
     if (failed) {
       // Restore original placement.
-      for (int i = 0; i < size; i++) {
-        Node* ndi = nodes[jstrt + i];
-        ndi->setLeft(origLeft[ndi]);
+      for (const auto& [ndi, x] : origLeft) {
+        ndi->setLeft(x);
       }
       mgrPtr_->sortCellsInSeg(segId, jstrt, jstop + 1);
     }
@@ -369,15 +370,15 @@ void DetailedReorderer::reorder(const std::vector<Node*>& nodes,
 
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
-double DetailedReorderer::cost(const std::vector<Node*>& nodes,
-                               const int istrt,
-                               const int istop)
+void DetailedReorderer::collectEdges(const std::vector<Node*>& nodes,
+                                     const int istrt,
+                                     const int istop)
 {
-  // Compute hpwl for the specified sequence of cells.
+  // Find the nets, each once, touching the specified sequence of cells.
 
   ++traversal_;
 
-  double cost = 0.;
+  edges_.clear();
   for (int i = istrt; i <= istop; i++) {
     const Node* ndi = nodes[i];
 
@@ -394,22 +395,33 @@ double DetailedReorderer::cost(const std::vector<Node*>& nodes,
         continue;
       }
       edgeMask_[edi->getId()] = traversal_;
+      edges_.push_back(edi);
+    }
+  }
+}
 
-      double xmin = std::numeric_limits<double>::max();
-      double xmax = -std::numeric_limits<double>::max();
-      for (int pj = 0; pj < edi->getNumPins(); pj++) {
-        const Pin* pinj = edi->getPins()[pj];
+////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////
+double DetailedReorderer::cost() const
+{
+  // Compute hpwl for the nets gathered by collectEdges.
 
-        const Node* ndj = pinj->getNode();
+  double cost = 0.;
+  for (const Edge* edi : edges_) {
+    double xmin = std::numeric_limits<double>::max();
+    double xmax = -std::numeric_limits<double>::max();
+    for (int pj = 0; pj < edi->getNumPins(); pj++) {
+      const Pin* pinj = edi->getPins()[pj];
 
-        const double x
-            = ndj->getLeft() + 0.5 * ndj->getWidth() + pinj->getOffsetX();
+      const Node* ndj = pinj->getNode();
 
-        xmin = std::min(xmin, x);
-        xmax = std::max(xmax, x);
-      }
-      cost += xmax - xmin;
+      const double x
+          = ndj->getLeft() + 0.5 * ndj->getWidth() + pinj->getOffsetX();
+
+      xmin = std::min(xmin, x);
+      xmax = std::max(xmax, x);
     }
+    cost += xmax - xmin;
   }
   return cost;
 }
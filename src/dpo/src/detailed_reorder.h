@@ -39,6 +39,7 @@ namespace dpo {
 
 class Architecture;
 class DetailedMgr;
+class Edge;
 class Network;
 class Node;
 
@@ -60,7 +61,8 @@ class DetailedReorderer
                int rightLimit,
                int segId,
                int rowId);
-  double cost(const std::vector<Node*>& nodes, int istrt, int istop);
+  void collectEdges(const std::vector<Node*>& nodes, int istrt, int istop);
+  double cost() const;
 
   // Standard stuff.
   Architecture* arch_;
@@ -72,6 +74,7 @@ class DetailedReorderer
   // Other.
   int skipNetsLargerThanThis_ = 100;
   std::vector<int> edgeMask_;
+  std::vector<const Edge*> edges_;  // Nets of the current window.
   int traversal_ = 0;
   int windowSize_ = 3;
 };
@@ -190,10 +190,12 @@ void DetailedVerticalSwap::verticalSwap()
 
     if (nextHpwl <= currHpwl) {
       mgr_->acceptMove();
+      hpwlObj.accept();
 
       currHpwl = nextHpwl;
     } else {
       mgr_->rejectMove();
+      hpwlObj.reject();
     }
   }
 }
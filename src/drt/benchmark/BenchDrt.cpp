@@ -0,0 +1,119 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Microbenchmarks of the detailed routing DRC engine and region query on
+// synthetic designs built with the unit test fixture.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+
+#include "fixture.h"
+#include "frDesign.h"
+#include "frRegionQuery.h"
+#include "gc/FlexGC.h"
+
+namespace drt {
+
+// Spacing checks of a state.range(0) x state.range(0) window of parallel
+// m1 wires from different nets at the layer pitch, with every seventh
+// wire pulled in below the minimum spacing.  The window is checked the
+// way a DR worker does at the end of each iteration.
+static void BM_GCSpacing(benchmark::State& state)
+{
+  const frCoord size = state.range(0);
+  Fixture fixture;
+  fixture.makeSpacingConstraint(2);
+
+  constexpr frCoord pitch = 200;
+  int wire = 0;
+  for (frCoord y = 0; y + 100 < size; y += pitch) {
+    frNet* net = fixture.makeNet(("n" + std::to_string(wire)).c_str());
+    const frCoord offset = wire % 7 == 6 ? -30 : 0;
+    fixture.makePathseg(net, 2, {0, y + offset}, {size, y + offset});
+    wire++;
+  }
+  fixture.initRegionQuery();
+
+  const Rect work(0, 0, size, size);
+  size_t markers = 0;
+  for (auto _ : state) {
+    FlexGCWorker worker(fixture.design->getTech(), fixture.logger.get());
+    worker.setExtBox(work);
+    worker.setDrcBox(work);
+    worker.init(fixture.design.get());
+    worker.main();
+    markers = worker.getMarkers().size();
+    worker.end();
+  }
+  state.counters["markers"] = markers;
+}
+BENCHMARK(BM_GCSpacing)
+    ->Arg(2000)
+    ->Arg(20000)
+    ->Unit(benchmark::kMillisecond);
+
+// Random window queries of the fixed shapes of a state.range(0) x
+// state.range(0) array of cells, each with a m1 obstruction.
+static void BM_RegionQuery(benchmark::State& state)
+{
+  const int array_size = state.range(0);
+  Fixture fixture;
+  constexpr frCoord cell_size = 1000;
+  frMaster* master = fixture.makeMacro("cell", 0, 0, cell_size, cell_size);
+  fixture.makeMacroObs(master, 100, 100, 900, 400);
+  for (int x = 0; x < array_size; x++) {
+    for (int y = 0; y < array_size; y++) {
+      const std::string name
+          = "i" + std::to_string(x) + "_" + std::to_string(y);
+      fixture.makeInst(name.c_str(), master, x * cell_size, y * cell_size);
+    }
+  }
+  fixture.initRegionQuery();
+  frRegionQuery* region_query = fixture.design->getRegionQuery();
+
+  std::mt19937 rng(1);
+  std::uniform_int_distribution<frCoord> dist(0, array_size * cell_size);
+  frRegionQuery::Objects<frBlockObject> result;
+  for (auto _ : state) {
+    const frCoord x = dist(rng);
+    const frCoord y = dist(rng);
+    result.clear();
+    region_query->query(Rect(x, y, x + 4000, y + 4000), 2, result);
+    benchmark::DoNotOptimize(result.data());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RegionQuery)->Arg(100)->Arg(1000);
+
+}  // namespace drt
@@ -31,15 +31,19 @@
 #include <tcl.h>
 
 #include <boost/asio/thread_pool.hpp>
+#include <functional>
+#include <iosfwd>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <queue>
+#include <set>
 #include <string>
 #include <vector>
 
 #include "odb/geom.h"
+#include "utl/MemoryRegistry.h"
 
 namespace odb {
 class dbDatabase;
@@ -99,6 +103,19 @@ struct ParamStruct
   int minAccessPoints = -1;
   bool saveGuideUpdates = false;
   std::string repairPDNLayerName;
+  bool drTaskScheduler = false;
+  bool incrementalGC = false;
+  bool paCache = false;
+  bool rpCache = false;
+  bool radixMazeQueue = false;
+  bool taSubpanels = false;
+  bool distSharedMemory = false;
+  bool overlapDRInit = false;
+  bool profile = false;
+  std::string profileTraceFile;
+  std::string checkpointFile;
+  int checkpointIter = 0;
+  bool resume = false;
 };
 
 class TritonRoute
@@ -165,6 +182,7 @@ class TritonRoute
   // This runs a serialized worker from file_name.  It is intended
   // for debugging and not general usage.
   std::string runDRWorker(const std::string& workerStr, FlexDRViaData* viaData);
+  std::string runDRWorker(std::istream& workerStream, FlexDRViaData* viaData);
   void debugSingleWorker(const std::string& dumpDir, const std::string& drcRpt);
   void updateGlobals(const char* file_name);
   void resetDb(const char* file_name);
@@ -183,7 +201,19 @@ class TritonRoute
   void reportDRC(const std::string& file_name,
                  const std::list<std::unique_ptr<frMarker>>& markers,
                  odb::Rect drcBox = odb::Rect(0, 0, 0, 0));
-  void checkDRC(const char* filename, int x1, int y1, int x2, int y2);
+  // Checks the tiles of tile_size gcells that meet the box, or the whole
+  // design if it is empty, and writes the markers to filename as the
+  // tiles complete.  halo is how far around a tile (dbu) its markers are
+  // reported, -1 for the default.  If rules is not empty only violations
+  // of those names are reported.
+  void checkDRC(const char* filename,
+                int x1,
+                int y1,
+                int x2,
+                int y2,
+                int halo = -1,
+                int tile_size = 7,
+                const std::set<std::string>& rules = {});
   bool initGuide();
   void prep();
   void processBTermsAboveTopLayer(bool has_routing = false);
@@ -196,6 +226,7 @@ class TritonRoute
   std::unique_ptr<DesignCallBack> db_callback_;
   odb::dbDatabase* db_{nullptr};
   utl::Logger* logger_{nullptr};
+  utl::MemoryRegistration memory_registration_;
   std::unique_ptr<FlexDR> dr_;  // kept for single stepping
   stt::SteinerTreeBuilder* stt_builder_{nullptr};
   int num_drvs_{-1};
@@ -210,14 +241,33 @@ class TritonRoute
   int results_sz_{0};
   unsigned int cloud_sz_{0};
   boost::asio::thread_pool dist_pool_{1};
+  // Every design message sent to the workers bumps the version.  The
+  // updates since the last full design stay on the shared volume so a
+  // worker that missed some can catch up.
+  int dist_version_{0};
+  int dist_base_version_{0};
+  std::string dist_base_path_;
+  std::vector<std::string> dist_update_files_;
 
   void initDesign();
+  int64_t getDesignMemoryUsage() const;
   void gr();
   void ta();
+  void createDR();
   void dr();
   void applyUpdates(const std::vector<std::vector<drUpdate>>& updates);
+  // Called after each batch of tiles with the markers it added.
+  using DRCBatchCallback
+      = std::function<void(const std::vector<frMarker*>& new_markers,
+                           int checked_tiles,
+                           int total_tiles)>;
   void getDRCMarkers(std::list<std::unique_ptr<frMarker>>& markers,
-                     const odb::Rect& requiredDrcBox);
+                     const odb::Rect& requiredDrcBox,
+                     int halo = -1,
+                     int tile_size = 7,
+                     const std::set<std::string>& rules = {},
+                     const DRCBatchCallback& batch_done = nullptr);
+  void writeDRCMarker(std::ostream& out, const frMarker* marker);
   void stackVias(odb::dbBTerm* bterm,
                  int top_layer_idx,
                  int bterm_bottom_layer_idx,
@@ -30,8 +30,11 @@
 
 #include <boost/asio/post.hpp>
 #include <boost/bind/bind.hpp>
+#include <algorithm>
+#include <cstdio>
 #include <fstream>
 #include <iostream>
+#include <sstream>
 
 #include "DesignCallBack.h"
 #include "db/tech/frTechObject.h"
@@ -58,6 +61,7 @@
 #include "sta/StaMain.hh"
 #include "stt/SteinerTreeBuilder.h"
 #include "ta/FlexTA.h"
+#include "utl/Numa.h"
 
 namespace sta {
 // Tcl files encoded into strings.
@@ -210,14 +214,23 @@ int TritonRoute::getNumDRVs() const
 
 std::string TritonRoute::runDRWorker(const std::string& workerStr,
                                      FlexDRViaData* viaData)
+{
+  std::stringstream stream(
+      workerStr,
+      std::ios_base::binary | std::ios_base::in | std::ios_base::out);
+  return runDRWorker(stream, viaData);
+}
+
+std::string TritonRoute::runDRWorker(std::istream& workerStream,
+                                     FlexDRViaData* viaData)
 {
   bool on = debug_->debugDR;
   std::unique_ptr<FlexDRGraphics> graphics_
       = on && FlexDRGraphics::guiActive() ? std::make_unique<FlexDRGraphics>(
             debug_.get(), design_.get(), db_, logger_)
                                           : nullptr;
-  auto worker
-      = FlexDRWorker::load(workerStr, logger_, design_.get(), graphics_.get());
+  auto worker = FlexDRWorker::load(
+      workerStream, logger_, design_.get(), graphics_.get());
   worker->setViaData(viaData);
   worker->setSharedVolume(shared_volume_);
   worker->setDebugSettings(debug_.get());
@@ -324,15 +337,33 @@ void TritonRoute::clearDesign()
   design_ = std::make_unique<frDesign>(logger_);
 }
 
+int64_t TritonRoute::getDesignMemoryUsage() const
+{
+  const frBlock* block = design_->getTopBlock();
+  if (block == nullptr) {
+    return 0;
+  }
+  int64_t bytes = 0;
+  for (const auto& net : block->getNets()) {
+    bytes += sizeof(frNet);
+    bytes += (net->getShapes().size() + net->getPatchWires().size())
+             * sizeof(frPathSeg);
+    bytes += net->getVias().size() * sizeof(frVia);
+  }
+  for (const auto& inst : block->getInsts()) {
+    bytes += sizeof(frInst);
+    bytes += inst->getInstTerms().size() * sizeof(frInstTerm);
+  }
+  bytes += block->getMarkers().size() * sizeof(frMarker);
+  return bytes;
+}
+
 static void deserializeUpdate(frDesign* design,
                               const std::string& updateStr,
                               std::vector<drUpdate>& updates)
 {
-  std::ifstream file(updateStr.c_str());
-  frIArchive ar(file);
-  ar.setDesign(design);
-  registerTypes(ar);
-  ar >> updates;
+  std::ifstream file(updateStr.c_str(), std::ios::binary);
+  drUpdate::deserializeBatch(design, file, updates);
   file.close();
 }
 
@@ -533,7 +564,10 @@ void TritonRoute::init(Tcl_Interp* tcl_interp,
   logger_ = logger;
   dist_ = dist;
   stt_builder_ = stt_builder;
+  ProfileTask::setLogger(logger_);
   design_ = std::make_unique<frDesign>(logger_);
+  memory_registration_ = logger_->getMemoryRegistry()->add(
+      utl::DRT, "design", [this] { return getDesignMemoryUsage(); });
   dist->addCallBack(new RoutingCallBack(this, dist, logger));
   // Define swig TCL commands.
   Drt_Init(tcl_interp);
@@ -561,6 +595,8 @@ void TritonRoute::initDesign()
     parser.updateDesign();
     return;
   }
+  // The design and its region query are shared by all worker threads.
+  utl::ScopedInterleave interleave;
   parser.readTechAndLibs(db_);
   processBTermsAboveTopLayer();
   parser.readDesign(db_);
@@ -605,6 +641,7 @@ void TritonRoute::initDesign()
 
 void TritonRoute::prep()
 {
+  utl::ScopedInterleave interleave;
   FlexRP rp(getDesign(), getDesign()->getTech(), logger_);
   rp.main();
 }
@@ -622,7 +659,7 @@ void TritonRoute::ta()
   ta.main();
 }
 
-void TritonRoute::dr()
+void TritonRoute::createDR()
 {
   num_drvs_ = -1;
   dr_ = std::make_unique<FlexDR>(this, getDesign(), logger_, db_);
@@ -630,6 +667,10 @@ void TritonRoute::dr()
   if (distributed_) {
     dr_->setDistributed(dist_, dist_ip_, dist_port_, shared_volume_);
   }
+}
+
+void TritonRoute::dr()
+{
   if (SINGLE_STEP_DR) {
     dr_->init();
   } else {
@@ -826,10 +867,20 @@ void TritonRoute::sendDesignDist()
         = std::make_unique<RoutingJobDescription>();
     RoutingJobDescription* rjd
         = static_cast<RoutingJobDescription*>(desc.get());
+    // The workers reload the whole design, the updates on top of the
+    // previous one are obsolete.
+    for (const auto& file : dist_update_files_) {
+      std::remove(file.c_str());
+    }
+    dist_update_files_.clear();
+    dist_base_version_ = ++dist_version_;
+    dist_base_path_ = design_path;
     rjd->setDesignPath(design_path);
     rjd->setSharedDir(shared_volume_);
     rjd->setGlobalsPath(globals_path);
     rjd->setDesignUpdate(false);
+    rjd->setDesignVersion(dist_version_);
+    rjd->setBase(dist_base_version_, dist_base_path_);
     msg.setJobDescription(std::move(desc));
     bool ok = dist_->sendJob(msg, dist_ip_.c_str(), dist_port_, result);
     if (!ok) {
@@ -841,10 +892,8 @@ void TritonRoute::sendDesignDist()
 static void serializeUpdatesBatch(const std::vector<drUpdate>& batch,
                                   const std::string& file_name)
 {
-  std::ofstream file(file_name.c_str());
-  frOArchive ar(file);
-  registerTypes(ar);
-  ar << batch;
+  std::ofstream file(file_name.c_str(), std::ios::binary);
+  drUpdate::serializeBatch(batch, file);
   file.close();
 }
 
@@ -886,13 +935,24 @@ void TritonRoute::sendDesignUpdates(const std::string& globals_path)
     serializeTask = std::make_unique<ProfileTask>("DIST: SERIALIZE_UPDATES");
   }
   const auto& designUpdates = design_->getUpdates();
+  const int version = ++dist_version_;
   omp_set_num_threads(MAX_THREADS);
   std::vector<std::string> updates(designUpdates.size());
 #pragma omp parallel for schedule(dynamic)
   for (int i = 0; i < designUpdates.size(); i++) {
-    updates[i] = fmt::format("{}updates_{}.bin", shared_volume_, i);
+    updates[i] = fmt::format("{}updates_{}_{}.bin", shared_volume_, version, i);
     serializeUpdatesBatch(designUpdates.at(i), updates[i]);
   }
+  // The list of files of this version, for workers that fall behind.
+  const std::string manifest = updatesManifestPath(shared_volume_, version);
+  std::ofstream manifest_file(manifest);
+  for (const auto& update : updates) {
+    manifest_file << update << '\n';
+  }
+  manifest_file.close();
+  dist_update_files_.insert(
+      dist_update_files_.end(), updates.begin(), updates.end());
+  dist_update_files_.push_back(manifest);
   serializeTask->done();
   std::unique_ptr<ProfileTask> task;
   if (design_->getVersion() == 0) {
@@ -910,6 +970,8 @@ void TritonRoute::sendDesignUpdates(const std::string& globals_path)
   rjd->setGlobalsPath(globals_path);
   rjd->setSharedDir(shared_volume_);
   rjd->setDesignUpdate(true);
+  rjd->setDesignVersion(version);
+  rjd->setBase(dist_base_version_, dist_base_path_);
   msg.setJobDescription(std::move(desc));
   bool ok = dist_->sendJob(msg, dist_ip_.c_str(), dist_port_, result);
   if (!ok) {
@@ -920,8 +982,40 @@ void TritonRoute::sendDesignUpdates(const std::string& globals_path)
   design_->incrementVersion();
 }
 
+namespace {
+
+// Profiles one detailed_route run for -profile and -profile_trace_file.  If
+// the logger is already profiling (utl::start_profiling) the tasks are
+// recorded there and reported when that stops instead.
+class RouteProfiling
+{
+ public:
+  RouteProfiling(Logger* logger, bool profile, const std::string& trace_file)
+      : logger_(logger),
+        started_((profile || !trace_file.empty()) && !logger->isProfiling())
+  {
+    if (started_) {
+      logger_->startProfiling(trace_file.empty() ? nullptr
+                                                 : trace_file.c_str());
+    }
+  }
+  ~RouteProfiling()
+  {
+    if (started_) {
+      logger_->stopProfiling();
+    }
+  }
+
+ private:
+  Logger* logger_;
+  const bool started_;
+};
+
+}  // namespace
+
 int TritonRoute::main()
 {
+  RouteProfiling profiling(logger_, PROFILE, PROFILE_TRACE_FILE);
   if (DBPROCESSNODE == "GF14_13M_3Mx_2Cx_4Kx_2Hx_2Gx_LB") {
     USENONPREFTRACKS = false;
   }
@@ -997,7 +1091,25 @@ int TritonRoute::main()
     guide_processor.processGuides();
   }
   prep();
-  ta();
+  if (RESUME_DR) {
+    if (distributed_) {
+      logger_->error(
+          DRT, 636, "-resume is not supported with distributed routing.");
+    }
+    // The checkpoint holds the track assignment result as well.
+    createDR();
+  } else if (OVERLAP_DR_INIT) {
+    // the part of the DR preparation that doesn't read the TA results runs
+    // alongside TA
+    asio::thread_pool dr_init_pool(1);
+    createDR();
+    asio::post(dr_init_pool, [this]() { dr_->initBeforeTA(); });
+    ta();
+    dr_init_pool.join();
+  } else {
+    ta();
+    createDR();
+  }
   if (distributed_) {
     asio::post(dist_pool_,
                boost::bind(&TritonRoute::sendDesignUpdates, this, ""));
@@ -1005,6 +1117,10 @@ int TritonRoute::main()
   dr();
   if (!SINGLE_STEP_DR) {
     endFR();
+    // The routing is in the db; a later command reads the design again.
+    if (logger_->getMemoryRegistry()->releaseOnExit()) {
+      clearDesign();
+    }
   }
   return 0;
 }
@@ -1051,16 +1167,44 @@ void TritonRoute::fixMaxSpacing()
   writer.updateDb(db_);
 }
 
+static std::string getViolName(frTechObject* tech, const frMarker* marker)
+{
+  auto con = marker->getConstraint();
+  if (!con) {
+    return "nullptr";
+  }
+  if (con->typeId() == frConstraintTypeEnum::frcShortConstraint
+      && tech->getLayer(marker->getLayerNum())->getType()
+             == dbTechLayerType::CUT) {
+    return "Cut Short";
+  }
+  return con->getViolName();
+}
+
 void TritonRoute::getDRCMarkers(frList<std::unique_ptr<frMarker>>& markers,
-                                const Rect& requiredDrcBox)
+                                const Rect& requiredDrcBox,
+                                int halo,
+                                int tile_size,
+                                const std::set<std::string>& rules,
+                                const DRCBatchCallback& batch_done)
 {
   MAX_THREADS = ord::OpenRoad::openRoad()->getThreadCount();
+  if (halo < 0) {
+    halo = DRCSAFEDIST;
+  }
+  // Corner spacing is the only check a worker can skip.
+  const bool check_corner_spacing
+      = rules.empty()
+        || std::any_of(rules.begin(), rules.end(), [](const std::string& r) {
+             return r.find("Corner") != std::string::npos;
+           });
   std::vector<std::vector<std::unique_ptr<FlexGCWorker>>> workersBatches(1);
-  auto size = 7;
+  auto size = std::max(tile_size, 1);
   auto offset = 0;
   auto gCellPatterns = design_->getTopBlock()->getGCellPatterns();
   auto& xgp = gCellPatterns.at(0);
   auto& ygp = gCellPatterns.at(1);
+  int total_tiles = 0;
   for (int i = offset; i < (int) xgp.getCount(); i += size) {
     for (int j = offset; j < (int) ygp.getCount(); j += size) {
       Rect routeBox1 = design_->getTopBlock()->getGCellBox(Point(i, j));
@@ -1073,8 +1217,8 @@ void TritonRoute::getDRCMarkers(frList<std::unique_ptr<frMarker>>& markers,
                     routeBox2.yMax());
       Rect extBox;
       Rect drcBox;
-      routeBox.bloat(DRCSAFEDIST, drcBox);
-      routeBox.bloat(MTSAFEDIST, extBox);
+      routeBox.bloat(halo, drcBox);
+      routeBox.bloat(std::max(MTSAFEDIST, halo), extBox);
       if (!drcBox.intersects(requiredDrcBox)) {
         continue;
       }
@@ -1082,26 +1226,37 @@ void TritonRoute::getDRCMarkers(frList<std::unique_ptr<frMarker>>& markers,
           = std::make_unique<FlexGCWorker>(design_->getTech(), logger_);
       gcWorker->setDrcBox(drcBox);
       gcWorker->setExtBox(extBox);
+      if (!check_corner_spacing) {
+        gcWorker->setIgnoreCornerSpacing();
+      }
       if (workersBatches.back().size() >= BATCHSIZE) {
         workersBatches.emplace_back();
       }
       workersBatches.back().push_back(std::move(gcWorker));
+      total_tiles++;
     }
   }
   std::map<MarkerId, frMarker*> mapMarkers;
   omp_set_num_threads(MAX_THREADS);
+  int checked_tiles = 0;
   for (auto& workers : workersBatches) {
 #pragma omp parallel for schedule(dynamic)
     for (int i = 0; i < workers.size(); i++) {  // NOLINT
       workers[i]->init(design_.get());
       workers[i]->main();
     }
+    std::vector<frMarker*> new_markers;
     for (const auto& worker : workers) {
       for (auto& marker : worker->getMarkers()) {
         Rect bbox = marker->getBBox();
         if (!bbox.intersects(requiredDrcBox)) {
           continue;
         }
+        if (!rules.empty()
+            && rules.find(getViolName(design_->getTech(), marker.get()))
+                   == rules.end()) {
+          continue;
+        }
         auto layerNum = marker->getLayerNum();
         auto con = marker->getConstraint();
         if (mapMarkers.find({bbox, layerNum, con, marker->getSrcs()})
@@ -1111,13 +1266,25 @@ void TritonRoute::getDRCMarkers(frList<std::unique_ptr<frMarker>>& markers,
         markers.push_back(std::make_unique<frMarker>(*marker));
         mapMarkers[{bbox, layerNum, con, marker->getSrcs()}]
             = markers.back().get();
+        new_markers.push_back(markers.back().get());
       }
     }
+    checked_tiles += workers.size();
     workers.clear();
+    if (batch_done) {
+      batch_done(new_markers, checked_tiles, total_tiles);
+    }
   }
 }
 
-void TritonRoute::checkDRC(const char* filename, int x1, int y1, int x2, int y2)
+void TritonRoute::checkDRC(const char* filename,
+                           int x1,
+                           int y1,
+                           int x2,
+                           int y2,
+                           int halo,
+                           int tile_size,
+                           const std::set<std::string>& rules)
 {
   GC_IGNORE_PDN_LAYER_NUM = -1;
   REPAIR_PDN_LAYER_NUM = -1;
@@ -1135,9 +1302,47 @@ void TritonRoute::checkDRC(const char* filename, int x1, int y1, int x2, int y2)
   if (requiredDrcBox.area() == 0) {
     requiredDrcBox = design_->getTopBlock()->getBBox();
   }
+
+  if (!rules.empty()) {
+    auto tech = design_->getTech();
+    std::set<std::string> known_rules{"Cut Short"};
+    for (int i = 0; tech->getConstraint(i) != nullptr; i++) {
+      known_rules.insert(tech->getConstraint(i)->getViolName());
+    }
+    for (const std::string& rule : rules) {
+      if (known_rules.find(rule) == known_rules.end()) {
+        logger_->warn(
+            DRT, 641, "No {} rule in the technology to check.", rule);
+      }
+    }
+  }
+
+  // The markers are written as each batch of tiles completes so a long
+  // check can be followed and the partial report inspected.
+  std::ofstream drcRpt(filename);
+  if (!drcRpt.is_open()) {
+    logger_->error(DRT, 642, "Unable to open DRC report {}.", filename);
+  }
   frList<std::unique_ptr<frMarker>> markers;
-  getDRCMarkers(markers, requiredDrcBox);
-  reportDRC(filename, markers, requiredDrcBox);
+  getDRCMarkers(markers,
+                requiredDrcBox,
+                halo,
+                tile_size,
+                rules,
+                [&](const std::vector<frMarker*>& new_markers,
+                    int checked_tiles,
+                    int total_tiles) {
+                  for (const frMarker* marker : new_markers) {
+                    writeDRCMarker(drcRpt, marker);
+                  }
+                  drcRpt.flush();
+                  logger_->info(DRT,
+                                643,
+                                "Checked {} of {} tiles, {} violations.",
+                                checked_tiles,
+                                total_tiles,
+                                markers.size());
+                });
 }
 
 void TritonRoute::processBTermsAboveTopLayer(bool has_routing)
@@ -1356,6 +1561,19 @@ void TritonRoute::setParams(const ParamStruct& params)
   }
   SAVE_GUIDE_UPDATES = params.saveGuideUpdates;
   REPAIR_PDN_LAYER_NAME = params.repairPDNLayerName;
+  DR_TASK_SCHEDULER = params.drTaskScheduler;
+  DR_INCREMENTAL_GC = params.incrementalGC;
+  PA_CACHE = params.paCache;
+  RP_CACHE = params.rpCache;
+  DR_RADIX_MAZE_QUEUE = params.radixMazeQueue;
+  TA_SUBPANELS = params.taSubpanels;
+  DIST_SHARED_MEMORY = params.distSharedMemory;
+  OVERLAP_DR_INIT = params.overlapDRInit;
+  PROFILE = params.profile;
+  PROFILE_TRACE_FILE = params.profileTraceFile;
+  CHECKPOINT_FILE = params.checkpointFile;
+  CHECKPOINT_ITER = params.checkpointIter;
+  RESUME_DR = params.resume;
 }
 
 void TritonRoute::addWorkerResults(
@@ -1389,8 +1607,6 @@ void TritonRoute::reportDRC(const std::string& file_name,
                             const frList<std::unique_ptr<frMarker>>& markers,
                             Rect drcBox)
 {
-  double dbu = getDesign()->getTech()->getDBUPerUU();
-
   if (file_name == std::string("")) {
     if (VERBOSE > 0) {
       logger_->warn(
@@ -1408,77 +1624,69 @@ void TritonRoute::reportDRC(const std::string& file_name,
       if (drcBox != Rect() && !drcBox.intersects(bbox)) {
         continue;
       }
-      auto tech = getDesign()->getTech();
-      auto layer = tech->getLayer(marker->getLayerNum());
-      auto layerType = layer->getType();
-
-      auto con = marker->getConstraint();
-      drcRpt << "  violation type: ";
-      if (con) {
-        std::string violName;
-        if (con->typeId() == frConstraintTypeEnum::frcShortConstraint
-            && layerType == dbTechLayerType::CUT) {
-          violName = "Cut Short";
-        } else {
-          violName = con->getViolName();
+      writeDRCMarker(drcRpt, marker.get());
+    }
+  } else {
+    std::cout << "Error: Fail to open DRC report file\n";
+  }
+}
+
+void TritonRoute::writeDRCMarker(std::ostream& out, const frMarker* marker)
+{
+  double dbu = getDesign()->getTech()->getDBUPerUU();
+  Rect bbox = marker->getBBox();
+  auto tech = getDesign()->getTech();
+  auto layer = tech->getLayer(marker->getLayerNum());
+
+  out << "  violation type: " << getViolName(tech, marker) << std::endl;
+  // get source(s) of violation
+  // format: type:name/identifier
+  out << "    srcs: ";
+  for (auto src : marker->getSrcs()) {
+    if (src) {
+      switch (src->typeId()) {
+        case frcNet:
+          out << "net:" << (static_cast<frNet*>(src))->getName() << " ";
+          break;
+        case frcInstTerm: {
+          frInstTerm* instTerm = (static_cast<frInstTerm*>(src));
+          out << "iterm:" << instTerm->getInst()->getName() << "/"
+              << instTerm->getTerm()->getName() << " ";
+          break;
         }
-        drcRpt << violName;
-      } else {
-        drcRpt << "nullptr";
-      }
-      drcRpt << std::endl;
-      // get source(s) of violation
-      // format: type:name/identifier
-      drcRpt << "    srcs: ";
-      for (auto src : marker->getSrcs()) {
-        if (src) {
-          switch (src->typeId()) {
-            case frcNet:
-              drcRpt << "net:" << (static_cast<frNet*>(src))->getName() << " ";
-              break;
-            case frcInstTerm: {
-              frInstTerm* instTerm = (static_cast<frInstTerm*>(src));
-              drcRpt << "iterm:" << instTerm->getInst()->getName() << "/"
-                     << instTerm->getTerm()->getName() << " ";
-              break;
-            }
-            case frcBTerm: {
-              frBTerm* bterm = (static_cast<frBTerm*>(src));
-              drcRpt << "bterm:" << bterm->getName() << " ";
-              break;
-            }
-            case frcInstBlockage: {
-              frInst* inst = (static_cast<frInstBlockage*>(src))->getInst();
-              drcRpt << "inst:" << inst->getName() << " ";
-              break;
-            }
-            case frcInst: {
-              frInst* inst = (static_cast<frInst*>(src));
-              drcRpt << "inst:" << inst->getName() << " ";
-              break;
-            }
-            case frcBlockage: {
-              drcRpt << "obstruction: ";
-              break;
-            }
-            default:
-              logger_->error(DRT,
-                             291,
-                             "Unexpected source type in marker: {}",
-                             src->typeId());
-          }
+        case frcBTerm: {
+          frBTerm* bterm = (static_cast<frBTerm*>(src));
+          out << "bterm:" << bterm->getName() << " ";
+          break;
+        }
+        case frcInstBlockage: {
+          frInst* inst = (static_cast<frInstBlockage*>(src))->getInst();
+          out << "inst:" << inst->getName() << " ";
+          break;
+        }
+        case frcInst: {
+          frInst* inst = (static_cast<frInst*>(src));
+          out << "inst:" << inst->getName() << " ";
+          break;
         }
+        case frcBlockage: {
+          out << "obstruction: ";
+          break;
+        }
+        default:
+          logger_->error(DRT,
+                         291,
+                         "Unexpected source type in marker: {}",
+                         src->typeId());
       }
-      drcRpt << "\n";
-
-      drcRpt << "    bbox = ( " << bbox.xMin() / dbu << ", "
-             << bbox.yMin() / dbu << " ) - ( " << bbox.xMax() / dbu << ", "
-             << bbox.yMax() / dbu << " ) on Layer ";
-      drcRpt << layer->getName() << "\n";
     }
-  } else {
-    std::cout << "Error: Fail to open DRC report file\n";
   }
+  out << "\n";
+
+  out << "    bbox = ( " << bbox.xMin() / dbu << ", " << bbox.yMin() / dbu
+      << " ) - ( " << bbox.xMax() / dbu << ", " << bbox.yMax() / dbu
+      << " ) on Layer ";
+  out << layer->getName() << "\n";
 }
 
 }  // namespace drt
@@ -36,6 +36,9 @@
 %{
 
 #include <cstring>
+#include <set>
+#include <sstream>
+#include <string>
 #include "ord/OpenRoad.hh"
 #include "triton_route/TritonRoute.h"
 #include "utl/Logger.h"
@@ -95,7 +98,20 @@ void detailed_route_cmd(const char* outputMazeFile,
                         int minAccessPoints,
                         bool saveGuideUpdates,
                         const char* repairPDNLayerName,
-                        int drcReportIterStep)
+                        int drcReportIterStep,
+                        bool drTaskScheduler,
+                        bool incrementalGC,
+                        bool paCache,
+                        bool rpCache,
+                        bool radixMazeQueue,
+                        bool taSubpanels,
+                        bool distSharedMemory,
+                        bool overlapDRInit,
+                        bool profile,
+                        const char* profileTraceFile,
+                        const char* checkpointFile,
+                        int checkpointIter,
+                        bool resume)
 {
   auto* router = ord::OpenRoad::openRoad()->getTritonRoute();
   std::optional<int> drcReportIterStepOpt;
@@ -122,7 +138,20 @@ void detailed_route_cmd(const char* outputMazeFile,
                     singleStepDR,
                     minAccessPoints,
                     saveGuideUpdates,
-                    repairPDNLayerName});
+                    repairPDNLayerName,
+                    drTaskScheduler,
+                    incrementalGC,
+                    paCache,
+                    rpCache,
+                    radixMazeQueue,
+                    taSubpanels,
+                    distSharedMemory,
+                    overlapDRInit,
+                    profile,
+                    profileTraceFile,
+                    checkpointFile,
+                    checkpointIter,
+                    resume});
   router->main();
   router->setDistributed(false);
 }
@@ -131,7 +160,8 @@ void pin_access_cmd(const char* dbProcessNode,
                     const char* bottomRoutingLayer,
                     const char* topRoutingLayer,
                     int verbose,
-                    int minAccessPoints)
+                    int minAccessPoints,
+                    bool paCache)
 {
   auto* router = ord::OpenRoad::openRoad()->getTritonRoute();
   drt::ParamStruct params;
@@ -140,6 +170,7 @@ void pin_access_cmd(const char* dbProcessNode,
   params.topRoutingLayer = topRoutingLayer;
   params.verbose = verbose;
   params.minAccessPoints = minAccessPoints;
+  params.paCache = paCache;
   router->setParams(params);
   router->pinAccess();
   router->setDistributed(false);
@@ -238,9 +269,25 @@ void step_end()
   router->endFR();
 }
 
-void check_drc_cmd(const char* drc_file, int x1, int y1, int x2, int y2)
+void check_drc_cmd(const char* drc_file,
+                   int x1,
+                   int y1,
+                   int x2,
+                   int y2,
+                   int halo,
+                   int tile_size,
+                   const char* rules)
 {
   auto* router = ord::OpenRoad::openRoad()->getTritonRoute();
-  router->checkDRC(drc_file, x1, y1, x2, y2);
+  // rules are newline separated as the names hold spaces
+  std::set<std::string> rule_set;
+  std::istringstream rule_stream(rules);
+  std::string rule;
+  while (std::getline(rule_stream, rule)) {
+    if (!rule.empty()) {
+      rule_set.insert(rule);
+    }
+  }
+  router->checkDRC(drc_file, x1, y1, x2, y2, halo, tile_size, rule_set);
 }
 %} // inline
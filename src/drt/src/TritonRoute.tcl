@@ -60,6 +60,19 @@ sta::define_cmd_args "detailed_route" {
     [-save_guide_updates]
     [-repair_pdn_vias layer]
     [-single_step_dr]
+    [-dr_task_scheduler]
+    [-incremental_gc]
+    [-pa_cache]
+    [-rp_cache]
+    [-radix_maze_queue]
+    [-ta_subpanels]
+    [-dist_shared_memory]
+    [-overlap_dr_init]
+    [-profile]
+    [-profile_trace_file filename]
+    [-checkpoint_file filename]
+    [-checkpoint_iter iter]
+    [-resume]
 }
 
 proc detailed_route { args } {
@@ -68,9 +81,12 @@ proc detailed_route { args } {
       -db_process_node -droute_end_iter -via_in_pin_bottom_layer \
       -via_in_pin_top_layer -or_seed -or_k -bottom_routing_layer \
       -top_routing_layer -verbose -remote_host -remote_port -shared_volume \
-      -cloud_size -min_access_points -repair_pdn_vias -drc_report_iter_step} \
+      -cloud_size -min_access_points -repair_pdn_vias -drc_report_iter_step \
+      -profile_trace_file -checkpoint_file -checkpoint_iter} \
     flags {-disable_via_gen -distributed -clean_patches -no_pin_access \
-           -single_step_dr -save_guide_updates}
+           -single_step_dr -save_guide_updates -dr_task_scheduler \
+           -incremental_gc -pa_cache -rp_cache -radix_maze_queue -ta_subpanels \
+           -dist_shared_memory -overlap_dr_init -profile -resume}
   sta::check_argc_eq0 "detailed_route" $args
 
   set enable_via_gen [expr ![info exists flags(-disable_via_gen)]]
@@ -80,12 +96,45 @@ proc detailed_route { args } {
   # development.  It is not listed in the help string intentionally.
   set single_step_dr [expr [info exists flags(-single_step_dr)]]
   set save_guide_updates [expr [info exists flags(-save_guide_updates)]]
+  set dr_task_scheduler [expr [info exists flags(-dr_task_scheduler)]]
+  set incremental_gc [expr [info exists flags(-incremental_gc)]]
+  set pa_cache [expr [info exists flags(-pa_cache)]]
+  set rp_cache [expr [info exists flags(-rp_cache)]]
+  set radix_maze_queue [expr [info exists flags(-radix_maze_queue)]]
+  set ta_subpanels [expr [info exists flags(-ta_subpanels)]]
+  set dist_shared_memory [expr [info exists flags(-dist_shared_memory)]]
+  set overlap_dr_init [expr [info exists flags(-overlap_dr_init)]]
+  set profile [expr [info exists flags(-profile)]]
+  set resume [expr [info exists flags(-resume)]]
 
   if { [info exists keys(-repair_pdn_vias)] } {
     set repair_pdn_vias $keys(-repair_pdn_vias)
   } else {
     set repair_pdn_vias ""
   }
+  if { [info exists keys(-profile_trace_file)] } {
+    set profile_trace_file $keys(-profile_trace_file)
+  } else {
+    set profile_trace_file ""
+  }
+  if { [info exists keys(-checkpoint_file)] } {
+    set checkpoint_file $keys(-checkpoint_file)
+  } else {
+    set checkpoint_file ""
+  }
+  if { [info exists keys(-checkpoint_iter)] } {
+    sta::check_positive_integer "-checkpoint_iter" $keys(-checkpoint_iter)
+    set checkpoint_iter $keys(-checkpoint_iter)
+  } else {
+    set checkpoint_iter 0
+  }
+  if { $checkpoint_file == "" && ($checkpoint_iter > 0 || $resume) } {
+    utl::error DRT 639 \
+      "-checkpoint_iter and -resume require -checkpoint_file."
+  }
+  if { $checkpoint_file != "" && !$resume && $checkpoint_iter == 0 } {
+    set checkpoint_iter 1
+  }
   if { [info exists keys(-output_maze)] } {
     set output_maze $keys(-output_maze)
   } else {
@@ -197,7 +246,10 @@ proc detailed_route { args } {
     $via_in_pin_bottom_layer $via_in_pin_top_layer \
     $or_seed $or_k $bottom_routing_layer $top_routing_layer $verbose \
     $clean_patches $no_pin_access $single_step_dr $min_access_points \
-    $save_guide_updates $repair_pdn_vias $drc_report_iter_step
+    $save_guide_updates $repair_pdn_vias $drc_report_iter_step \
+    $dr_task_scheduler $incremental_gc $pa_cache $rp_cache $radix_maze_queue \
+    $ta_subpanels $dist_shared_memory $overlap_dr_init $profile \
+    $profile_trace_file $checkpoint_file $checkpoint_iter $resume
 }
 
 proc detailed_route_num_drvs { args } {
@@ -298,12 +350,13 @@ sta::define_cmd_args "pin_access" {
     [-remote_port rport]
     [-shared_volume vol]
     [-cloud_size sz]
+    [-pa_cache]
 }
 proc pin_access { args } {
   sta::parse_key_args "pin_access" args \
     keys {-db_process_node -bottom_routing_layer -top_routing_layer -verbose \
           -min_access_points -remote_host -remote_port -shared_volume -cloud_size } \
-    flags {-distributed}
+    flags {-distributed -pa_cache}
   sta::check_argc_eq0 "detailed_route_debug" $args
   if {[info exists keys(-db_process_node)]} {
     set db_process_node $keys(-db_process_node)
@@ -355,8 +408,9 @@ proc pin_access { args } {
     }
     drt::detailed_route_distributed $rhost $rport $vol $cloudsz
   }
+  set pa_cache [expr [info exists flags(-pa_cache)]]
   drt::pin_access_cmd $db_process_node $bottom_routing_layer \
-    $top_routing_layer $verbose $min_access_points
+    $top_routing_layer $verbose $min_access_points $pa_cache
 }
 
 sta::define_cmd_args "detailed_route_run_worker" {
@@ -474,10 +528,13 @@ proc step_dr { args } {
 sta::define_cmd_args "check_drc" {
     [-box box]
     [-output_file filename]
+    [-halo distance]
+    [-tile_size gcells]
+    [-rules rule_names]
 };# checker off
 proc check_drc { args } {
   sta::parse_key_args "check_drc" args \
-    keys { -box -output_file } \
+    keys { -box -output_file -halo -tile_size -rules } \
     flags {};# checker off
   sta::check_argc_eq0 "check_drc" $args
   set box { 0 0 0 0 }
@@ -493,7 +550,21 @@ proc check_drc { args } {
   } else {
     utl::error DRT 613 "-output_file is required for check_drc command"
   }
-  drt::check_drc_cmd $output_file $x1 $y1 $x2 $y2
+  set halo -1
+  if { [info exists keys(-halo)] } {
+    set halo $keys(-halo)
+    sta::check_positive_integer "-halo" $halo
+  }
+  set tile_size 7
+  if { [info exists keys(-tile_size)] } {
+    set tile_size $keys(-tile_size)
+    sta::check_positive_integer "-tile_size" $tile_size
+  }
+  set rules ""
+  if { [info exists keys(-rules)] } {
+    set rules [join $keys(-rules) "\n"]
+  }
+  drt::check_drc_cmd $output_file $x1 $y1 $x2 $y2 $halo $tile_size $rules
 }
 
 proc fix_max_spacing { args } {
@@ -44,6 +44,12 @@ class frTime
   frTime() : t0_(std::chrono::high_resolution_clock::now()), t_(clock()) {}
   std::chrono::high_resolution_clock::time_point getT0() const { return t0_; }
   void print(Logger* logger);
+  double getElapsedTime() const  // in seconds
+  {
+    return std::chrono::duration<double>(
+               std::chrono::high_resolution_clock::now() - t0_)
+        .count();
+  }
   bool isExceed(double in)
   {
     auto t1 = std::chrono::high_resolution_clock::now();
@@ -95,6 +95,12 @@ class frMaster : public frBlockObject
     return nullptr;
   }
   dbMasterType getMasterType() { return masterType_; }
+  // key of the unique instance class behind each pin access index, empty if
+  // the pin access is not reusable
+  const std::vector<std::string>& getPinAccessKeys() const
+  {
+    return pinAccessKeys_;
+  }
 
   // setters
   void addTerm(std::unique_ptr<frMTerm> in)
@@ -133,6 +139,10 @@ class frMaster : public frBlockObject
     blockages_.push_back(std::move(in));
   }
   void setMasterType(const dbMasterType& in) { masterType_ = in; }
+  void setPinAccessKeys(std::vector<std::string> in)
+  {
+    pinAccessKeys_ = std::move(in);
+  }
   // others
   frBlockObjectEnum typeId() const override { return frcMaster; }
 
@@ -143,6 +153,7 @@ class frMaster : public frBlockObject
   Rect dieBox_;
   frString name_;
   dbMasterType masterType_{dbMasterType::NONE};
+  std::vector<std::string> pinAccessKeys_;
 
   friend class io::Parser;
 };
@@ -32,8 +32,13 @@
 #include <boost/asio/post.hpp>
 #include <boost/asio/thread_pool.hpp>
 #include <boost/bind/bind.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/stream.hpp>
 #include <cstdio>
 #include <cstdlib>
+#include <fstream>
 #include <iostream>
 #include <mutex>
 
@@ -81,7 +86,17 @@ class RoutingCallBack : public dst::JobCallBack
       init_ = false;
       omp_set_num_threads(ord::OpenRoad::openRoad()->getThreadCount());
     }
-    auto workers = desc->getWorkers();
+    const auto& workers = desc->getWorkers();
+    // the workers were written to a file on this host, map it and read them
+    // in place
+    std::unique_ptr<boost::interprocess::mapped_region> region;
+    if (!desc->getWorkersPath().empty()) {
+      boost::interprocess::file_mapping file(
+          desc->getWorkersPath().c_str(), boost::interprocess::read_only);
+      region = std::make_unique<boost::interprocess::mapped_region>(
+          file, boost::interprocess::read_only);
+    }
+    const auto& offsets = desc->getWorkerOffsets();
     int size = workers.size();
     std::vector<std::pair<int, std::string>> results;
     asio::thread_pool reply_pool(1);
@@ -89,9 +104,18 @@ class RoutingCallBack : public dst::JobCallBack
     int cnt = 0;
 #pragma omp parallel for schedule(dynamic)
     for (int i = 0; i < workers.size(); i++) {  // NOLINT
-      std::pair<int, std::string> result
-          = {workers.at(i).first,
-             router_->runDRWorker(workers.at(i).second, &via_data_)};
+      std::pair<int, std::string> result;
+      if (region) {
+        const char* begin
+            = static_cast<const char*>(region->get_address()) + offsets.at(i);
+        boost::iostreams::stream<boost::iostreams::array_source> stream(
+            begin, offsets.at(i + 1) - offsets.at(i));
+        result
+            = {workers.at(i).first, router_->runDRWorker(stream, &via_data_)};
+      } else {
+        result = {workers.at(i).first,
+                  router_->runDRWorker(workers.at(i).second, &via_data_)};
+      }
 #pragma omp critical
       {
         results.push_back(result);
@@ -130,15 +154,36 @@ class RoutingCallBack : public dst::JobCallBack
         router_->updateGlobals(desc->getGlobalsPath().c_str());
       }
     }
-    if ((desc->isDesignUpdate() && !desc->getUpdates().empty())
-        || !desc->getDesignPath().empty()) {
-      frTime t;
-      logger_->report("Design Update");
-      if (desc->isDesignUpdate()) {
+    if (desc->isDesignUpdate() && !desc->getUpdates().empty()) {
+      // The design is kept between jobs and only the updates since the
+      // version this worker has are applied.  Updates whose files are gone
+      // were superseded by a later full design, as when the balancer
+      // replays old broadcasts to a new worker.
+      const std::string manifest = updatesManifestPath(
+          desc->getSharedDir(), desc->getDesignVersion());
+      const bool superseded = !std::ifstream(manifest).good();
+      if (desc->getDesignVersion() > design_version_ && !superseded) {
+        frTime t;
+        logger_->report("Design Update");
+        if (design_version_ < desc->getBaseVersion()) {
+          router_->resetDb(desc->getBasePath().c_str());
+          design_version_ = desc->getBaseVersion();
+        }
+        for (int version = design_version_ + 1;
+             version < desc->getDesignVersion();
+             version++) {
+          router_->updateDesign(
+              readUpdatesManifest(desc->getSharedDir(), version));
+        }
         router_->updateDesign(desc->getUpdates());
-      } else {
-        router_->resetDb(desc->getDesignPath().c_str());
+        design_version_ = desc->getDesignVersion();
+        t.print(logger_);
       }
+    } else if (!desc->getDesignPath().empty()) {
+      frTime t;
+      logger_->report("Design Update");
+      router_->resetDb(desc->getDesignPath().c_str());
+      design_version_ = desc->getDesignVersion();
       t.print(logger_);
     }
     if (!desc->getViaData().empty()) {
@@ -149,7 +194,6 @@ class RoutingCallBack : public dst::JobCallBack
       ar >> via_data_;
     }
     dist_->sendResult(result, sock);
-    sock.close();
   }
 
   void onPinAccessJobReceived(dst::JobMessage& msg, dst::socket& sock) override
@@ -207,7 +251,6 @@ class RoutingCallBack : public dst::JobCallBack
     }
 
     dist_->sendResult(result, sock);
-    sock.close();
   }
   void onGRDRInitJobReceived(dst::JobMessage& msg, dst::socket& sock) override
   {
@@ -219,7 +262,6 @@ class RoutingCallBack : public dst::JobCallBack
     router_->getDesign()->getRegionQuery()->initDRObj();
     dst::JobMessage result(dst::JobMessage::SUCCESS);
     dist_->sendResult(result, sock);
-    sock.close();
   }
 
  private:
@@ -238,10 +280,24 @@ class RoutingCallBack : public dst::JobCallBack
     auto resultDesc = static_cast<RoutingJobDescription*>(uResultDesc.get());
     resultDesc->setWorkers(results);
     result.setJobDescription(std::move(uResultDesc));
-    dist_->sendResult(result, sock);
-    if (finish) {
-      sock.close();
+    dist_->sendResult(result, sock, !finish);
+  }
+
+  std::vector<std::string> readUpdatesManifest(const std::string& shared_dir,
+                                               int version)
+  {
+    const std::string path = updatesManifestPath(shared_dir, version);
+    std::ifstream file(path);
+    if (!file.good()) {
+      logger_->error(
+          utl::DRT, 623, "Missing updates of design version {}.", version);
+    }
+    std::vector<std::string> updates;
+    std::string update;
+    while (std::getline(file, update)) {
+      updates.push_back(update);
     }
+    return updates;
   }
 
   std::vector<std::vector<frInst*>> deserializeInstRows(
@@ -259,6 +315,8 @@ class RoutingCallBack : public dst::JobCallBack
   utl::Logger* logger_;
   std::string design_path_;
   std::string globals_path_;
+  // Version of the design this worker holds, 0 before the first one.
+  int design_version_{0};
   bool init_;
   FlexDRViaData via_data_;
   FlexPA pa_;
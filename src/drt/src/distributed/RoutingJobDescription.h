@@ -28,7 +28,9 @@
 
 #pragma once
 #include <boost/serialization/base_object.hpp>
+#include <cstdint>
 #include <string>
+#include <vector>
 
 #include "dst/JobMessage.h"
 namespace boost::serialization {
@@ -47,6 +49,14 @@ class RoutingJobDescription : public dst::JobDescription
   {
     workers_ = workers;
   }
+  // workers serialized back to back into path, worker i spans
+  // [offsets[i], offsets[i + 1])
+  void setWorkersFile(const std::string& path,
+                      const std::vector<uint64_t>& offsets)
+  {
+    workers_path_ = path;
+    worker_offsets_ = offsets;
+  }
   void setUpdates(const std::vector<std::string>& updates)
   {
     updates_ = updates;
@@ -54,6 +64,14 @@ class RoutingJobDescription : public dst::JobDescription
   void setSendEvery(int val) { send_every_ = val; }
   void setViaData(const std::string& val) { via_data_ = val; }
   void setDesignUpdate(const bool& value) { design_update_ = value; }
+  // Version of the design after this message.  Updates apply on top of the
+  // full design of base_version at base_path.
+  void setDesignVersion(int version) { design_version_ = version; }
+  void setBase(int version, const std::string& path)
+  {
+    base_version_ = version;
+    base_path_ = path;
+  }
   const std::string& getGlobalsPath() const { return globals_path_; }
   const std::string& getSharedDir() const { return shared_dir_; }
   const std::string& getDesignPath() const { return design_path_; }
@@ -62,10 +80,18 @@ class RoutingJobDescription : public dst::JobDescription
   {
     return workers_;
   }
+  const std::string& getWorkersPath() const { return workers_path_; }
+  const std::vector<uint64_t>& getWorkerOffsets() const
+  {
+    return worker_offsets_;
+  }
   const std::vector<std::string>& getUpdates() { return updates_; }
   bool isDesignUpdate() const { return design_update_; }
   int getSendEvery() const { return send_every_; }
   const std::string& getViaData() const { return via_data_; }
+  int getDesignVersion() const { return design_version_; }
+  int getBaseVersion() const { return base_version_; }
+  const std::string& getBasePath() const { return base_path_; }
 
  private:
   std::string globals_path_;
@@ -73,10 +99,15 @@ class RoutingJobDescription : public dst::JobDescription
   std::string shared_dir_;
   std::string guide_path_;
   std::vector<std::pair<int, std::string>> workers_;
+  std::string workers_path_;
+  std::vector<uint64_t> worker_offsets_;
   std::vector<std::string> updates_;
   std::string via_data_;
   bool design_update_{false};
   int send_every_{10};
+  int design_version_{0};
+  int base_version_{0};
+  std::string base_path_;
 
   template <class Archive>
   void serialize(Archive& ar, const unsigned int version)
@@ -91,8 +122,21 @@ class RoutingJobDescription : public dst::JobDescription
     (ar) & via_data_;
     (ar) & design_update_;
     (ar) & send_every_;
+    (ar) & workers_path_;
+    (ar) & worker_offsets_;
+    (ar) & design_version_;
+    (ar) & base_version_;
+    (ar) & base_path_;
   }
   friend class boost::serialization::access;
 };
 
+// The file on the shared volume listing the update files of a design
+// version.
+inline std::string updatesManifestPath(const std::string& shared_dir,
+                                       int version)
+{
+  return shared_dir + "updates_" + std::to_string(version) + ".txt";
+}
+
 }  // namespace drt
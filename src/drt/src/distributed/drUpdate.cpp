@@ -28,12 +28,136 @@
 
 #include "distributed/drUpdate.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
 #include "db/obj/frNet.h"
 #include "distributed/frArchive.h"
 #include "serialization.h"
 
 namespace drt {
 
+namespace {
+
+// Batch layout: magic, version, count, then per update a header byte
+// (type | object << 3 | same net << 6), the net code unless it repeats,
+// the index in owner and the object fields.  Bump kBatchVersion whenever
+// the layout changes.
+constexpr char kBatchMagic[4] = {'D', 'R', 'U', 'P'};
+constexpr uint64_t kBatchVersion = 1;
+
+enum ObjCode : uint8_t
+{
+  kNoObj,
+  kPathSegObj,
+  kPatchWireObj,
+  kViaObj,
+  kMarkerObj
+};
+
+// low two bits of a net code, bit 2 is the modified flag
+enum NetKind : uint64_t
+{
+  kNoNet,
+  kRegularNet,
+  kSpecialNet,
+  kFakeNet
+};
+
+void writeVarint(std::ostream& os, uint64_t val)
+{
+  while (val >= 0x80) {
+    os.put(static_cast<char>((val & 0x7f) | 0x80));
+    val >>= 7;
+  }
+  os.put(static_cast<char>(val));
+}
+
+uint64_t readVarint(std::istream& is)
+{
+  uint64_t val = 0;
+  for (int shift = 0; shift < 64; shift += 7) {
+    const int byte = is.get();
+    if (byte == std::istream::traits_type::eof()) {
+      throw std::runtime_error("truncated drUpdate batch");
+    }
+    val |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) {
+      break;
+    }
+  }
+  return val;
+}
+
+void writeSigned(std::ostream& os, int64_t val)
+{
+  writeVarint(os, (static_cast<uint64_t>(val) << 1) ^ (val >> 63));
+}
+
+int64_t readSigned(std::istream& is)
+{
+  const uint64_t val = readVarint(is);
+  return static_cast<int64_t>(val >> 1) ^ -static_cast<int64_t>(val & 1);
+}
+
+void writePoint(std::ostream& os, const Point& pt, const Point& ref)
+{
+  writeSigned(os, static_cast<int64_t>(pt.x()) - ref.x());
+  writeSigned(os, static_cast<int64_t>(pt.y()) - ref.y());
+}
+
+Point readPoint(std::istream& is, const Point& ref)
+{
+  const int64_t dx = readSigned(is);
+  const int64_t dy = readSigned(is);
+  return Point(ref.x() + dx, ref.y() + dy);
+}
+
+uint64_t getNetCode(frNet* net)
+{
+  if (net == nullptr) {
+    return kNoNet;
+  }
+  uint64_t kind = net->isSpecial() ? kSpecialNet : kRegularNet;
+  uint64_t id = net->getId();
+  if (net->isFake()) {
+    kind = kFakeNet;
+    id = net->getType() == odb::dbSigType::GROUND ? 0 : 1;
+  }
+  return (id << 3) | (static_cast<uint64_t>(net->isModified()) << 2) | kind;
+}
+
+frNet* getNetFromCode(frDesign* design, uint64_t code)
+{
+  auto block = design->getTopBlock();
+  const int id = code >> 3;
+  frNet* net = nullptr;
+  switch (code & 3) {
+    case kNoNet:
+      return nullptr;
+    case kRegularNet:
+      net = block->getNet(id);
+      break;
+    case kSpecialNet:
+      net = block->getSNet(id);
+      break;
+    default:
+      net = id == 0 ? block->getFakeVSSNet() : block->getFakeVDDNet();
+      break;
+  }
+  if (net != nullptr && (code & 4)) {
+    net->setModified(true);
+  }
+  return net;
+}
+
+}  // namespace
+
 void drUpdate::setPathSeg(const frPathSeg& seg)
 {
   obj_type_ = frcPathSeg;
@@ -137,6 +261,194 @@ void drUpdate::serialize(Archive& ar, const unsigned int version)
   }
 }
 
+void drUpdate::serializeBatch(const std::vector<drUpdate>& updates,
+                              std::ostream& os)
+{
+  os.write(kBatchMagic, sizeof(kBatchMagic));
+  writeVarint(os, kBatchVersion);
+  writeVarint(os, updates.size());
+  uint64_t prevNetCode = kNoNet;
+  Point prevPoint;
+  for (const auto& update : updates) {
+    uint8_t obj = kNoObj;
+    switch (update.obj_type_) {
+      case frcPathSeg:
+        obj = kPathSegObj;
+        break;
+      case frcPatchWire:
+        obj = kPatchWireObj;
+        break;
+      case frcVia:
+        obj = kViaObj;
+        break;
+      case frcMarker:
+        obj = kMarkerObj;
+        break;
+      default:
+        break;
+    }
+    const uint64_t netCode = getNetCode(update.net_);
+    const bool sameNet = (netCode == prevNetCode);
+    os.put(static_cast<char>(update.type_ | (obj << 3) | (sameNet << 6)));
+    if (!sameNet) {
+      writeVarint(os, netCode);
+      prevNetCode = netCode;
+    }
+    writeSigned(os, update.index_in_owner_);
+    switch (obj) {
+      case kPathSegObj: {
+        writeVarint(os, update.layer_);
+        writePoint(os, update.begin_, prevPoint);
+        writePoint(os, update.end_, update.begin_);
+        const frSegStyle& style = update.style_;
+        writeVarint(os, style.getWidth());
+        writeVarint(os, style.getBeginExt());
+        writeVarint(os, style.getEndExt());
+        os.put(static_cast<char>(
+            static_cast<frEndStyleEnum>(style.getBeginStyle())
+            | (static_cast<frEndStyleEnum>(style.getEndStyle()) << 4)));
+        os.put(static_cast<char>(update.tapered_));
+        break;
+      }
+      case kPatchWireObj:
+        writeVarint(os, update.layer_);
+        writePoint(os, update.begin_, prevPoint);
+        writeSigned(os, update.offsetBox_.xMin());
+        writeSigned(os, update.offsetBox_.yMin());
+        writeSigned(os, update.offsetBox_.xMax());
+        writeSigned(os, update.offsetBox_.yMax());
+        break;
+      case kViaObj: {
+        writePoint(os, update.begin_, prevPoint);
+        const int viaDefId
+            = update.viaDef_ == nullptr ? -1 : update.viaDef_->getId();
+        writeVarint(os, viaDefId + 1);
+        os.put(static_cast<char>(update.bottomConnected_
+                                 | (update.topConnected_ << 1)
+                                 | (update.tapered_ << 2)));
+        break;
+      }
+      case kMarkerObj: {
+        // markers are rare, keep their full archive form
+        std::stringstream stream(std::ios_base::binary | std::ios_base::in
+                                 | std::ios_base::out);
+        {
+          frOArchive ar(stream);
+          registerTypes(ar);
+          ar << update.marker_;
+        }
+        const std::string markerStr = stream.str();
+        writeVarint(os, markerStr.size());
+        os.write(markerStr.data(), markerStr.size());
+        break;
+      }
+      default:
+        break;
+    }
+    if (obj != kNoObj && obj != kMarkerObj) {
+      prevPoint = update.begin_;
+    }
+  }
+}
+
+void drUpdate::deserializeBatch(frDesign* design,
+                                std::istream& is,
+                                std::vector<drUpdate>& updates)
+{
+  char magic[sizeof(kBatchMagic)] = {};
+  is.read(magic, sizeof(magic));
+  if (!is || !std::equal(magic, magic + sizeof(magic), kBatchMagic)) {
+    is.clear();
+    is.seekg(0);
+    frIArchive ar(is);
+    ar.setDesign(design);
+    registerTypes(ar);
+    ar >> updates;
+    return;
+  }
+  const uint64_t version = readVarint(is);
+  if (version > kBatchVersion) {
+    throw std::runtime_error("unsupported drUpdate batch version "
+                             + std::to_string(version));
+  }
+  const uint64_t count = readVarint(is);
+  updates.clear();
+  updates.reserve(count);
+  frNet* net = nullptr;
+  Point prevPoint;
+  for (uint64_t i = 0; i < count; i++) {
+    const int header = is.get();
+    if (header == std::istream::traits_type::eof()) {
+      throw std::runtime_error("truncated drUpdate batch");
+    }
+    if ((header & (1 << 6)) == 0) {
+      net = getNetFromCode(design, readVarint(is));
+    }
+    drUpdate& update = updates.emplace_back(
+        static_cast<UpdateType>(header & 0x7), net, readSigned(is));
+    switch ((header >> 3) & 0x7) {
+      case kPathSegObj: {
+        update.obj_type_ = frcPathSeg;
+        update.layer_ = readVarint(is);
+        update.begin_ = readPoint(is, prevPoint);
+        update.end_ = readPoint(is, update.begin_);
+        update.style_.setWidth(readVarint(is));
+        const frUInt4 beginExt = readVarint(is);
+        const frUInt4 endExt = readVarint(is);
+        const int styles = is.get();
+        update.style_.setBeginStyle(
+            frEndStyle(static_cast<frEndStyleEnum>(styles & 0xf)), beginExt);
+        update.style_.setEndStyle(
+            frEndStyle(static_cast<frEndStyleEnum>(styles >> 4)), endExt);
+        update.tapered_ = is.get() & 1;
+        break;
+      }
+      case kPatchWireObj: {
+        update.obj_type_ = frcPatchWire;
+        update.layer_ = readVarint(is);
+        update.begin_ = readPoint(is, prevPoint);
+        const frCoord xl = readSigned(is);
+        const frCoord yl = readSigned(is);
+        const frCoord xh = readSigned(is);
+        const frCoord yh = readSigned(is);
+        update.offsetBox_ = Rect(xl, yl, xh, yh);
+        break;
+      }
+      case kViaObj: {
+        update.obj_type_ = frcVia;
+        update.begin_ = readPoint(is, prevPoint);
+        const int viaDefId = static_cast<int>(readVarint(is)) - 1;
+        update.viaDef_ = viaDefId < 0
+                             ? nullptr
+                             : design->getTech()->getVias().at(viaDefId).get();
+        const int flags = is.get();
+        update.bottomConnected_ = flags & 1;
+        update.topConnected_ = flags & 2;
+        update.tapered_ = flags & 4;
+        break;
+      }
+      case kMarkerObj: {
+        update.obj_type_ = frcMarker;
+        std::string markerStr(readVarint(is), '\0');
+        is.read(markerStr.data(), markerStr.size());
+        std::stringstream stream(
+            markerStr,
+            std::ios_base::binary | std::ios_base::in | std::ios_base::out);
+        frIArchive ar(stream);
+        ar.setDesign(design);
+        registerTypes(ar);
+        ar >> update.marker_;
+        break;
+      }
+      default:
+        break;
+    }
+    if (update.obj_type_ != frcBlock && update.obj_type_ != frcMarker) {
+      prevPoint = update.begin_;
+    }
+  }
+}
+
 template void drUpdate::serialize<frIArchive>(frIArchive& ar,
                                               const unsigned int file_version);
 
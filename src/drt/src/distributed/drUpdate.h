@@ -27,12 +27,16 @@
  */
 
 #pragma once
+#include <iosfwd>
+#include <vector>
+
 #include "db/obj/frMarker.h"
 #include "db/obj/frShape.h"
 #include "db/obj/frVia.h"
 namespace drt {
 
 class frNet;
+class frDesign;
 
 class drUpdate
 {
@@ -70,6 +74,15 @@ class drUpdate
   frBlockObjectEnum getObjTypeId() const { return obj_type_; }
   frMarker getMarker() const { return marker_; }
 
+  // Compact, versioned encoding of an update batch: varint fields, points
+  // as deltas and the net only written when it changes.  The reader also
+  // accepts a boost archive of the batch.
+  static void serializeBatch(const std::vector<drUpdate>& updates,
+                             std::ostream& os);
+  static void deserializeBatch(frDesign* design,
+                               std::istream& is,
+                               std::vector<drUpdate>& updates);
+
  private:
   frNet* net_{nullptr};
   int index_in_owner_{0};
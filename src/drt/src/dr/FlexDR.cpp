@@ -31,14 +31,19 @@
 #include <dst/JobMessage.h>
 #include <omp.h>
 
+#include <algorithm>
 #include <boost/archive/text_iarchive.hpp>
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/io/ios_state.hpp>
 #include <chrono>
+#include <condition_variable>
 #include <cstdio>
 #include <fstream>
+#include <functional>
 #include <iomanip>
+#include <mutex>
 #include <numeric>
+#include <queue>
 #include <sstream>
 
 #include "db/infra/KDTree.hpp"
@@ -47,7 +52,6 @@
 #include "distributed/frArchive.h"
 #include "dr/FlexDR_conn.h"
 #include "dr/FlexDR_graphics.h"
-#include "dst/BalancerJobDescription.h"
 #include "dst/Distributed.h"
 #include "frProfileTask.h"
 #include "gc/FlexGC.h"
@@ -68,29 +72,41 @@ enum class SerializationType
   WRITE
 };
 
-void serializeWorker(FlexDRWorker* worker, std::string& workerStr)
+void serializeWorker(FlexDRWorker* worker, std::ostream& stream)
 {
-  std::stringstream stream(std::ios_base::binary | std::ios_base::in
-                           | std::ios_base::out);
   frOArchive ar(stream);
   registerTypes(ar);
   ar << *worker;
+}
+
+void serializeWorker(FlexDRWorker* worker, std::string& workerStr)
+{
+  std::stringstream stream(std::ios_base::binary | std::ios_base::in
+                           | std::ios_base::out);
+  serializeWorker(worker, stream);
   workerStr = stream.str();
 }
 
 void deserializeWorker(FlexDRWorker* worker,
                        frDesign* design,
-                       const std::string& workerStr)
+                       std::istream& stream)
 {
-  std::stringstream stream(
-      workerStr,
-      std::ios_base::binary | std::ios_base::in | std::ios_base::out);
   frIArchive ar(stream);
   ar.setDesign(design);
   registerTypes(ar);
   ar >> *worker;
 }
 
+void deserializeWorker(FlexDRWorker* worker,
+                       frDesign* design,
+                       const std::string& workerStr)
+{
+  std::stringstream stream(
+      workerStr,
+      std::ios_base::binary | std::ios_base::in | std::ios_base::out);
+  deserializeWorker(worker, design, stream);
+}
+
 void serializeViaData(const FlexDRViaData& viaData, std::string& serializedStr)
 {
   std::stringstream stream(std::ios_base::binary | std::ios_base::in
@@ -110,6 +126,7 @@ FlexDR::FlexDR(TritonRoute* router,
       logger_(loggerIn),
       db_(dbIn),
       numWorkUnits_(0),
+      numMazeExpansions_(0),
       dist_(nullptr),
       dist_on_(false),
       dist_port_(0),
@@ -201,6 +218,14 @@ void FlexDRWorker::writeUpdates(const std::string& file_name)
   file.close();
 }
 
+std::shared_lock<std::shared_mutex> FlexDRWorker::lockDesignShared() const
+{
+  if (design_mutex_ == nullptr) {
+    return std::shared_lock<std::shared_mutex>();
+  }
+  return std::shared_lock<std::shared_mutex>(*design_mutex_);
+}
+
 int FlexDRWorker::main(frDesign* design)
 {
   ProfileTask profile("DRW:main");
@@ -214,7 +239,10 @@ int FlexDRWorker::main(frDesign* design)
                     routeBox_.xMax() * micronPerDBU,
                     routeBox_.yMax() * micronPerDBU);
   }
-  initMarkers(design);
+  {
+    auto design_lock = lockDesignShared();
+    initMarkers(design);
+  }
   if (getDRIter() && getInitNumMarkers() == 0 && !needRecheck_) {
     skipRouting_ = true;
   }
@@ -266,6 +294,7 @@ int FlexDRWorker::main(frDesign* design)
     }
   }
   if (!skipRouting_) {
+    auto design_lock = lockDesignShared();
     init(design);
   }
   high_resolution_clock::time_point t1 = high_resolution_clock::now();
@@ -275,6 +304,7 @@ int FlexDRWorker::main(frDesign* design)
   high_resolution_clock::time_point t2 = high_resolution_clock::now();
   const int num_markers = getNumMarkers();
   cleanup();
+  endPrepare();
   high_resolution_clock::time_point t3 = high_resolution_clock::now();
 
   using std::chrono::duration;
@@ -456,6 +486,14 @@ void FlexDR::init_halfViaEncArea()
   }
 }
 
+void FlexDR::initBeforeTA()
+{
+  ProfileTask profile("DR:initBeforeTA");
+  getRegionQuery()->initDRObj();  // first init in postProcess
+  init_halfViaEncArea();
+  initBeforeTADone_ = true;
+}
+
 void FlexDR::init()
 {
   ProfileTask profile("DR:init");
@@ -464,9 +502,9 @@ void FlexDR::init()
     logger_->info(DRT, 187, "Start routing data preparation.");
   }
   initGCell2BoundaryPin();
-  getRegionQuery()->initDRObj();  // first init in postProcess
-
-  init_halfViaEncArea();
+  if (!initBeforeTADone_) {
+    initBeforeTA();
+  }
 
   if (VERBOSE > 0) {
     t.print(logger_);
@@ -679,10 +717,79 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
     xIdx++;
   }
 
+  auto reportProgress = [&]() {
+#pragma omp critical
+    {
+      cnt++;
+      if (VERBOSE > 0) {
+        if (cnt * 1.0 / tot >= prev_perc / 100.0 + 0.1 && prev_perc < 90) {
+          if (prev_perc == 0 && t.isExceed(0)) {
+            isExceed = true;
+          }
+          prev_perc += 10;
+          if (isExceed) {
+            logger_->report("    Completing {}% with {} violations.",
+                            prev_perc,
+                            getDesign()->getTopBlock()->getNumMarkers());
+            logger_->report("    {}.", t);
+          }
+        }
+      }
+    }
+  };
+
   omp_set_num_threads(MAX_THREADS);
+  while (gridGraphArenas_.size() < MAX_THREADS) {
+    gridGraphArenas_.push_back(std::make_unique<FlexGridGraph::Arena>());
+  }
   int version = 0;
   increaseClipsize_ = false;
   numWorkUnits_ = 0;
+  numMazeExpansions_ = 0;
+  if (DR_TASK_SCHEDULER && !dist_on_) {
+    // Flatten the checkerboard batches.  The resulting order is the write
+    // back order of the batched flow and every worker depends on its
+    // neighbors that come earlier in that order.
+    std::vector<std::unique_ptr<FlexDRWorker>> flatWorkers;
+    for (auto& workerBatch : workers) {
+      for (auto& workersInBatch : workerBatch) {
+        for (auto& worker : workersInBatch) {
+          flatWorkers.push_back(std::move(worker));
+        }
+      }
+    }
+    workers.clear();
+    const int numX = xIdx;
+    const int numY = (((int) ygp.getCount() - 1 - offset) / size + 1);
+    std::vector<std::vector<int>> grid(numX, std::vector<int>(numY, -1));
+    for (int idx = 0; idx < (int) flatWorkers.size(); idx++) {
+      const Rect& gcellBox = flatWorkers[idx]->getGCellBox();
+      grid[(gcellBox.xMin() - offset) / size]
+          [(gcellBox.yMin() - offset) / size]
+          = idx;
+    }
+    std::vector<std::vector<int>> successors(flatWorkers.size());
+    std::vector<int> numPendingDeps(flatWorkers.size(), 0);
+    for (int x = 0; x < numX; x++) {
+      for (int y = 0; y < numY; y++) {
+        const int idx = grid[x][y];
+        for (int nx = std::max(0, x - 1); nx <= std::min(numX - 1, x + 1);
+             nx++) {
+          for (int ny = std::max(0, y - 1); ny <= std::min(numY - 1, y + 1);
+               ny++) {
+            const int nbrIdx = grid[nx][ny];
+            if (nbrIdx < idx) {
+              successors[nbrIdx].push_back(idx);
+              numPendingDeps[idx]++;
+            }
+          }
+        }
+      }
+    }
+    ProfileTask profile("DR:task_graph");
+    processWorkersTaskGraph(
+        flatWorkers, successors, std::move(numPendingDeps), reportProgress);
+  }
   // parallel execution
   for (auto& workerBatch : workers) {
     ProfileTask profile("DR:checkerboard");
@@ -712,49 +819,46 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
               if (dist_on_) {
                 workersInBatch[i]->distributedMain(getDesign());
               } else {
+                workersInBatch[i]->setGridGraphArena(
+                    getThreadGridGraphArena());
                 workersInBatch[i]->main(getDesign());
               }
-#pragma omp critical
-              {
-                cnt++;
-                if (VERBOSE > 0) {
-                  if (cnt * 1.0 / tot >= prev_perc / 100.0 + 0.1
-                      && prev_perc < 90) {
-                    if (prev_perc == 0 && t.isExceed(0)) {
-                      isExceed = true;
-                    }
-                    prev_perc += 10;
-                    if (isExceed) {
-                      logger_->report(
-                          "    Completing {}% with {} violations.",
-                          prev_perc,
-                          getDesign()->getTopBlock()->getNumMarkers());
-                      logger_->report("    {}.", t);
-                    }
-                  }
-                }
-              }
+              reportProgress();
             } catch (...) {
               exception.capture();
             }
           }
           exception.rethrow();
           if (dist_on_) {
-            int j = 0;
-            std::vector<std::vector<std::pair<int, FlexDRWorker*>>>
-                distWorkerBatches(router_->getCloudSize());
+            // Longest job first onto the cheapest batch, so the batches
+            // the balancer spreads over the cloud are of similar cost.
+            std::vector<std::pair<double, int>> workerCosts;
             for (int i = 0; i < workersInBatch.size(); i++) {
               auto worker = workersInBatch.at(i).get();
               if (!worker->isSkipRouting()) {
-                distWorkerBatches[j].push_back({i, worker});
-                j = (j + 1) % router_->getCloudSize();
+                workerCosts.emplace_back(getDistWorkerCost(worker), i);
               }
             }
+            std::sort(workerCosts.begin(),
+                      workerCosts.end(),
+                      std::greater<std::pair<double, int>>());
+            std::vector<std::vector<std::pair<int, FlexDRWorker*>>>
+                distWorkerBatches(router_->getCloudSize());
+            std::vector<double> distBatchCosts(router_->getCloudSize(), 0);
+            for (const auto& [cost, i] : workerCosts) {
+              const int j = std::min_element(distBatchCosts.begin(),
+                                             distBatchCosts.end())
+                            - distBatchCosts.begin();
+              distWorkerBatches[j].push_back({i, workersInBatch[i].get()});
+              distBatchCosts[j] += cost;
+            }
             {
               ProfileTask task("DIST: SERIALIZE+SEND");
 #pragma omp parallel for schedule(dynamic)
               for (int i = 0; i < distWorkerBatches.size(); i++)  // NOLINT
-                sendWorkers(distWorkerBatches.at(i), workersInBatch);
+                sendWorkers(distWorkerBatches.at(i),
+                            workersInBatch,
+                            distBatchCosts.at(i));
             }
             logger_->report("    Received Batches:{}.", t);
             std::vector<std::pair<int, std::string>> workers;
@@ -779,6 +883,7 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
           if (worker->end(getDesign())) {
             numWorkUnits_ += 1;
           }
+          numMazeExpansions_ += worker->getNumMazeExpansions();
           if (worker->isCongested()) {
             increaseClipsize_ = true;
           }
@@ -819,6 +924,13 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
              1,
              "Number of work units = {}.",
              numWorkUnits_);
+  debugPrint(logger_,
+             utl::DRT,
+             "maze",
+             1,
+             "Number of maze node expansions = {}.",
+             numMazeExpansions_);
+  reportGridGraphArenas();
   if (VERBOSE > 0) {
     logger_->info(DRT,
                   199,
@@ -868,6 +980,11 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
     std::cout << std::flush;
   }
   end();
+  logger_->metricSeries(
+      "route__iteration",
+      {{"iteration", iter},
+       {"drc_errors", getDesign()->getTopBlock()->getNumMarkers()},
+       {"runtime", t.getElapsedTime()}});
   if ((DRC_RPT_ITER_STEP && iter > 0 && iter % DRC_RPT_ITER_STEP.value() == 0)
       || logger_->debugCheck(DRT, "autotuner", 1)
       || logger_->debugCheck(DRT, "report", 1)) {
@@ -876,8 +993,149 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
   }
 }
 
+void FlexDR::processWorkersTaskGraph(
+    std::vector<std::unique_ptr<FlexDRWorker>>& workers,
+    const std::vector<std::vector<int>>& successors,
+    std::vector<int> numPendingDeps,
+    const std::function<void()>& onWorkerDone)
+{
+  const int numWorkers = workers.size();
+  // Routing threads hold this shared while they read the design; the write
+  // back of a worker holds it exclusively.
+  std::shared_mutex designMutex;
+  std::mutex queueMutex;
+  std::condition_variable queueCV;
+  // Lowest index first so the write back sequence is never starved.
+  std::priority_queue<int, std::vector<int>, std::greater<>> ready;
+  std::vector<char> routed(numWorkers, false);
+  int nextEnd = 0;
+  bool ending = false;
+  bool aborted = false;
+  for (int i = 0; i < numWorkers; i++) {
+    workers[i]->setDesignMutex(&designMutex);
+    if (numPendingDeps[i] == 0) {
+      ready.push(i);
+    }
+  }
+
+  ThreadException exception;
+#pragma omp parallel
+  {
+    while (true) {
+      int idx;
+      {
+        std::unique_lock<std::mutex> lock(queueMutex);
+        queueCV.wait(lock, [&] {
+          return !ready.empty() || nextEnd == numWorkers || aborted;
+        });
+        if (ready.empty() || aborted) {
+          break;
+        }
+        idx = ready.top();
+        ready.pop();
+      }
+      try {
+        workers[idx]->setGridGraphArena(getThreadGridGraphArena());
+        workers[idx]->main(getDesign());
+        onWorkerDone();
+      } catch (...) {
+        exception.capture();
+        std::unique_lock<std::mutex> lock(queueMutex);
+        aborted = true;
+        queueCV.notify_all();
+        break;
+      }
+
+      // Write back every routed worker that is next in sequence.  Only one
+      // thread does this at a time; the others go back to routing.
+      std::unique_lock<std::mutex> lock(queueMutex);
+      routed[idx] = true;
+      if (ending) {
+        continue;
+      }
+      ending = true;
+      while (!aborted && nextEnd < numWorkers && routed[nextEnd]) {
+        const int endIdx = nextEnd;
+        lock.unlock();
+        try {
+          std::unique_lock<std::shared_mutex> designLock(designMutex);
+          auto& worker = workers[endIdx];
+          if (worker->end(getDesign())) {
+            numWorkUnits_ += 1;
+          }
+          numMazeExpansions_ += worker->getNumMazeExpansions();
+          if (worker->isCongested()) {
+            increaseClipsize_ = true;
+          }
+          worker.reset();
+        } catch (...) {
+          exception.capture();
+          lock.lock();
+          aborted = true;
+          break;
+        }
+        lock.lock();
+        nextEnd++;
+        for (const int succ : successors[endIdx]) {
+          if (--numPendingDeps[succ] == 0) {
+            ready.push(succ);
+          }
+        }
+        queueCV.notify_all();
+      }
+      ending = false;
+      queueCV.notify_all();
+    }
+  }
+  exception.rethrow();
+  workers.clear();
+}
+
+FlexGridGraph::Arena* FlexDR::getThreadGridGraphArena()
+{
+  const int tid = omp_get_thread_num();
+  if (tid >= (int) gridGraphArenas_.size()) {
+    return nullptr;
+  }
+  return gridGraphArenas_[tid].get();
+}
+
+void FlexDR::reportGridGraphArenas() const
+{
+  if (!logger_->debugCheck(DRT, "workers", 1)) {
+    return;
+  }
+  size_t total = 0;
+  size_t peak = 0;
+  for (size_t tid = 0; tid < gridGraphArenas_.size(); tid++) {
+    const auto& arena = gridGraphArenas_[tid];
+    total += arena->getSize();
+    peak = std::max(peak, arena->highWaterMark);
+    debugPrint(logger_,
+               DRT,
+               "workers",
+               2,
+               "Thread {} grid graph arena {:.2f} MB (high water mark {:.2f} "
+               "MB).",
+               tid,
+               arena->getSize() / 1e6,
+               arena->highWaterMark / 1e6);
+  }
+  debugPrint(logger_,
+             DRT,
+             "workers",
+             1,
+             "Grid graph arenas hold {:.2f} MB, per thread high water mark "
+             "{:.2f} MB.",
+             total / 1e6,
+             peak / 1e6);
+}
+
 void FlexDR::end(bool done)
 {
+  if (done) {
+    gridGraphArenas_.clear();
+  }
   if (done && DRC_RPT_FILE != std::string("")) {
     router_->reportDRC(DRC_RPT_FILE, design_->getTopBlock()->getMarkers());
   }
@@ -1405,7 +1663,13 @@ int FlexDR::main()
       break;
     }
   }
-  for (auto& args : strategy()) {
+  int startIter = 0;
+  if (RESUME_DR) {
+    startIter = readCheckpoint(incremental, hasFixed);
+  }
+  auto strategies = strategy();
+  for (int i = startIter; i < (int) strategies.size(); i++) {
+    auto& args = strategies[i];
     int clipSize = args.size;
     if (args.ripupMode != RipUpMode::ALL) {
       if (increaseClipsize_) {
@@ -1438,6 +1702,9 @@ int FlexDR::main()
       ord::OpenRoad::openRoad()->writeDb(
           fmt::format("drt_iter{}.odb", iter_ - 1).c_str());
     }
+    if (CHECKPOINT_ITER > 0 && iter_ % CHECKPOINT_ITER == 0) {
+      writeCheckpoint(incremental, hasFixed);
+    }
   }
 
   end(/* done */ true);
@@ -1451,36 +1718,51 @@ int FlexDR::main()
   return 0;
 }
 
+double FlexDR::getDistWorkerCost(FlexDRWorker* worker) const
+{
+  // The routing effort of a worker grows with the guides it rips up and
+  // reroutes; markers force extra iterations of the search.
+  std::vector<frGuide*> guides;
+  getRegionQuery()->queryGuide(worker->getRouteBox(), guides);
+  return 1 + guides.size() + worker->getInitNumMarkers();
+}
+
 void FlexDR::sendWorkers(
     const std::vector<std::pair<int, FlexDRWorker*>>& remote_batch,
-    std::vector<std::unique_ptr<FlexDRWorker>>& batch)
+    std::vector<std::unique_ptr<FlexDRWorker>>& batch,
+    double cost)
 {
   if (remote_batch.empty()) {
     return;
   }
   std::vector<std::pair<int, std::string>> workers;
+  // With DIST_SHARED_MEMORY the batch is written once to the shared volume
+  // (ideally memory backed) and the remote maps it; only the offsets go
+  // through the socket.
+  std::string workersPath;
+  std::vector<uint64_t> workerOffsets;
   {
     ProfileTask task("DIST: SERIALIZE_BATCH");
-    for (auto& [idx, worker] : remote_batch) {
-      std::string workerStr;
-      serializeWorker(worker, workerStr);
-      workers.emplace_back(idx, workerStr);
-    }
-  }
-  std::string remote_ip = dist_ip_;
-  uint16_t remote_port = dist_port_;
-  if (router_->getCloudSize() > 1) {
-    dst::JobMessage msg(dst::JobMessage::BALANCER),
-        result(dst::JobMessage::NONE);
-    bool ok = dist_->sendJob(msg, dist_ip_.c_str(), dist_port_, result);
-    if (!ok) {
-      logger_->error(utl::DRT, 7461, "Balancer failed");
+    if (DIST_SHARED_MEMORY) {
+      workersPath = fmt::format(
+          "{}workers_{}_{}.bin", dist_dir_, iter_, remote_batch.front().first);
+      std::ofstream file(workersPath, std::ios::binary);
+      if (!file) {
+        logger_->error(
+            utl::DRT, 509, "Unable to open {} for writing.", workersPath);
+      }
+      for (auto& [idx, worker] : remote_batch) {
+        workerOffsets.push_back(file.tellp());
+        serializeWorker(worker, file);
+        workers.emplace_back(idx, std::string());
+      }
+      workerOffsets.push_back(file.tellp());
     } else {
-      dst::BalancerJobDescription* desc
-          = static_cast<dst::BalancerJobDescription*>(
-              result.getJobDescription());
-      remote_ip = desc->getWorkerIP();
-      remote_port = desc->getWorkerPort();
+      for (auto& [idx, worker] : remote_batch) {
+        std::string workerStr;
+        serializeWorker(worker, workerStr);
+        workers.emplace_back(idx, workerStr);
+      }
     }
   }
   {
@@ -1491,12 +1773,15 @@ void FlexDR::sendWorkers(
     RoutingJobDescription* rjd
         = static_cast<RoutingJobDescription*>(desc.get());
     rjd->setWorkers(workers);
+    rjd->setWorkersFile(workersPath, workerOffsets);
     rjd->setSharedDir(dist_dir_);
     rjd->setSendEvery(20);
+    rjd->setCost(cost);
     msg.setJobDescription(std::move(desc));
     ProfileTask task("DIST: SENDJOB");
+    // The balancer picks the worker from the cost and its load.
     bool ok = dist_->sendJobMultiResult(
-        msg, remote_ip.c_str(), remote_port, result);
+        msg, dist_ip_.c_str(), dist_port_, result);
     if (!ok) {
       logger_->error(utl::DRT, 500, "Sending worker {} failed");
     }
@@ -1506,6 +1791,9 @@ void FlexDR::sendWorkers(
       router_->addWorkerResults(result_desc->getWorkers());
     }
   }
+  if (!workersPath.empty()) {
+    std::remove(workersPath.c_str());
+  }
 }
 
 template <class Archive>
@@ -1544,6 +1832,7 @@ void FlexDRWorker::serialize(Archive& ar, const unsigned int version)
   (ar) & markers_;
   (ar) & bestMarkers_;
   (ar) & isCongested_;
+  (ar) & numMazeExpansions_;
   if (is_loading(ar)) {
     gridGraph_.setTech(design_->getTech());
     gridGraph_.setWorker(this);
@@ -1578,9 +1867,20 @@ std::unique_ptr<FlexDRWorker> FlexDRWorker::load(const std::string& workerStr,
                                                  utl::Logger* logger,
                                                  frDesign* design,
                                                  FlexDRGraphics* graphics)
+{
+  std::stringstream stream(
+      workerStr,
+      std::ios_base::binary | std::ios_base::in | std::ios_base::out);
+  return load(stream, logger, design, graphics);
+}
+
+std::unique_ptr<FlexDRWorker> FlexDRWorker::load(std::istream& workerStream,
+                                                 utl::Logger* logger,
+                                                 frDesign* design,
+                                                 FlexDRGraphics* graphics)
 {
   auto worker = std::make_unique<FlexDRWorker>();
-  deserializeWorker(worker.get(), design, workerStr);
+  deserializeWorker(worker.get(), design, workerStream);
 
   // We need to fix up the fields we want from the current run rather
   // than the stored ones.
@@ -33,7 +33,9 @@
 #include <boost/polygon/polygon.hpp>
 #include <boost/serialization/export.hpp>
 #include <deque>
+#include <functional>
 #include <memory>
+#include <shared_mutex>
 
 #include "db/drObj/drMarker.h"
 #include "db/drObj/drNet.h"
@@ -102,6 +104,9 @@ class FlexDR
   frRegionQuery* getRegionQuery() const { return design_->getRegionQuery(); }
   // others
   void init();
+  // The part of init() that doesn't depend on track assignment.  It may run
+  // while TA is in progress; init() skips it if it already ran.
+  void initBeforeTA();
   int main();
   void searchRepair(const SearchRepairArgs& args);
   void end(bool done = false);
@@ -125,9 +130,12 @@ class FlexDR
     dist_port_ = remote_port;
     dist_dir_ = dir;
   }
+  // Estimated routing effort of a worker, used to balance distributed jobs.
+  double getDistWorkerCost(FlexDRWorker* worker) const;
   void sendWorkers(
       const std::vector<std::pair<int, FlexDRWorker*>>& remote_batch,
-      std::vector<std::unique_ptr<FlexDRWorker>>& batch);
+      std::vector<std::unique_ptr<FlexDRWorker>>& batch,
+      double cost);
 
   void reportGuideCoverage();
   void setIter(int iterNum) { iter_ = iterNum; }
@@ -149,6 +157,8 @@ class FlexDR
   std::unique_ptr<FlexDRGraphics> graphics_;
   std::string debugNetName_;
   int numWorkUnits_;
+  int64_t numMazeExpansions_;
+  bool initBeforeTADone_{false};
 
   // distributed
   dst::Distributed* dist_;
@@ -160,15 +170,31 @@ class FlexDR
   bool increaseClipsize_;
   float clipSizeInc_;
   int iter_;
+  // one per thread, kept across iterations
+  std::vector<std::unique_ptr<FlexGridGraph::Arena>> gridGraphArenas_;
 
   // others
   void initFromTA();
   void initGCell2BoundaryPin();
   void getBatchInfo(int& batchStepX, int& batchStepY);
+  // Runs the workers as a dependency graph: a worker starts as soon as the
+  // neighbors it depends on are written back.  Workers are written back in
+  // their index order so the result matches for every thread schedule.
+  void processWorkersTaskGraph(
+      std::vector<std::unique_ptr<FlexDRWorker>>& workers,
+      const std::vector<std::vector<int>>& successors,
+      std::vector<int> numPendingDeps,
+      const std::function<void()>& onWorkerDone);
 
   void init_halfViaEncArea();
+  FlexGridGraph::Arena* getThreadGridGraphArena();
+  void reportGridGraphArenas() const;
 
   void removeGCell2BoundaryPin();
+  // Checkpoint of the iteration state and the route to CHECKPOINT_FILE.
+  void writeCheckpoint(bool incremental, bool hasFixed) const;
+  // Restores a checkpoint and returns the iteration to continue from.
+  int readCheckpoint(bool& incremental, bool& hasFixed);
   std::map<frNet*, std::set<std::pair<Point, frLayerNum>>, frBlockObjectComp>
   initDR_mergeBoundaryPin(int startX,
                           int startY,
@@ -278,6 +304,8 @@ class FlexDRWorker
     boundaryPin_ = std::move(bp);
   }
   bool isCongested() const { return isCongested_; }
+  // total nodes expanded by the maze searches of this worker
+  int64_t getNumMazeExpansions() const { return numMazeExpansions_; }
   void setBoundaryPins(std::map<frNet*,
                                 std::set<std::pair<Point, frLayerNum>>,
                                 frBlockObjectComp>& bp)
@@ -349,6 +377,12 @@ class FlexDRWorker
     gridGraph_.setGraphics(in);
   }
   void setViaData(FlexDRViaData* viaData) { via_data_ = viaData; }
+  // Set when workers run concurrently with the write back of other workers.
+  void setDesignMutex(std::shared_mutex* mutex) { design_mutex_ = mutex; }
+  void setGridGraphArena(FlexGridGraph::Arena* arena)
+  {
+    gridGraph_.setArena(arena);
+  }
   // getters
   frTechObject* getTech() const { return design_->getTech(); }
   void getRouteBox(Rect& boxIn) const { boxIn = routeBox_; }
@@ -408,6 +442,10 @@ class FlexDRWorker
                                             utl::Logger* logger,
                                             frDesign* design,
                                             FlexDRGraphics* graphics);
+  static std::unique_ptr<FlexDRWorker> load(std::istream& workerStream,
+                                            utl::Logger* logger,
+                                            frDesign* design,
+                                            FlexDRGraphics* graphics);
 
   // distributed
   void setDistributed(dst::Distributed* dist,
@@ -513,9 +551,34 @@ class FlexDRWorker
   std::string dist_dir_;
   bool dist_on_ = false;
   bool isCongested_ = false;
+  int64_t numMazeExpansions_ = 0;
   bool save_updates_ = false;
+  std::shared_mutex* design_mutex_ = nullptr;  // owned by FlexDR
+  // The write back of end(), built from the best route by endPrepare() so
+  // that committing it to the design is all that is left to end().
+  struct EndChanges
+  {
+    // A new route figure; exactly one of shape and via is set.
+    struct Fig
+    {
+      frNet* net;
+      std::unique_ptr<frShape> shape;  // path seg or patch wire
+      std::unique_ptr<frVia> via;
+    };
+    bool prepared = false;
+    bool write_back = false;
+    std::set<frNet*, frBlockObjectComp> mod_nets;
+    // in the order they are added to their nets
+    std::vector<Fig> figs;
+    std::vector<std::unique_ptr<frMarker>> markers;
+  };
+  EndChanges end_changes_;
+  // region query updates of end(), applied per layer by endFlushDRObjs()
+  frRegionQuery::ObjectsByLayer<frBlockObject> end_removed_dr_objs_;
+  frRegionQuery::ObjectsByLayer<frBlockObject> end_added_dr_objs_;
 
   // hellpers
+  std::shared_lock<std::shared_mutex> lockDesignShared() const;
   bool isRoutePatchWire(const frPatchWire* pwire) const;
   bool isRouteVia(const frVia* via) const;
   // init
@@ -1024,7 +1087,15 @@ class FlexDRWorker
   // end
   void cleanup();
   void identifyCongestionLevel();
+  // Builds end_changes_ from the worker alone; it doesn't touch the design
+  // so it runs with the routing, in parallel to the write back of others.
+  void endPrepare();
   void endGetModNets(std::set<frNet*, frBlockObjectComp>& modNets);
+  void endRemoveDRObj(frShape* shape);
+  void endRemoveDRObj(frVia* via);
+  void endAddDRObj(frShape* shape);
+  void endAddDRObj(frVia* via);
+  void endFlushDRObjs(frDesign* design);
   void endRemoveNets(frDesign* design,
                      std::set<frNet*, frBlockObjectComp>& modNets,
                      std::map<frNet*,
@@ -1039,9 +1110,9 @@ class FlexDRWorker
                   std::map<frNet*,
                            std::set<std::pair<Point, frLayerNum>>,
                            frBlockObjectComp>& boundPts);
-  void endAddNets_pathSeg(frDesign* design, drPathSeg* pathSeg);
-  void endAddNets_via(frDesign* design, drVia* via);
-  void endAddNets_patchWire(frDesign* design, drPatchWire* pwire);
+  void endAddNets_pathSeg(frNet* net, std::unique_ptr<frShape> uShape);
+  void endAddNets_via(frNet* net, std::unique_ptr<frVia> uVia);
+  void endAddNets_patchWire(frNet* net, std::unique_ptr<frShape> uShape);
   void endAddNets_merge(frDesign* design,
                         frNet* net,
                         std::set<std::pair<Point, frLayerNum>>& boundPts);
@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2024, The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Checkpoints of the detailed routing iterations.  A checkpoint holds the
+// iteration state of FlexDR followed by the route shapes and markers as one
+// drUpdate batch, the same compact encoding the distributed flow sends.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "distributed/drUpdate.h"
+#include "dr/FlexDR.h"
+#include "frProfileTask.h"
+
+namespace drt {
+
+namespace {
+
+constexpr char kCheckpointMagic[] = {'D', 'R', 'C', 'K'};
+constexpr int32_t kCheckpointVersion = 2;
+// Far above any real iteration count; a larger count means a corrupt file.
+constexpr int32_t kMaxCheckpointIters = 1 << 16;
+
+template <typename T>
+void writeValue(std::ostream& os, const T& value)
+{
+  os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+void readValue(std::istream& is, T& value)
+{
+  is.read(reinterpret_cast<char*>(&value), sizeof(T));
+}
+
+void writeString(std::ostream& os, const std::string& str)
+{
+  writeValue(os, static_cast<int32_t>(str.size()));
+  os.write(str.data(), str.size());
+}
+
+void readString(std::istream& is, std::string& str)
+{
+  int32_t size = 0;
+  readValue(is, size);
+  if (!is || size < 0 || size > (1 << 20)) {
+    is.setstate(std::ios::failbit);
+    return;
+  }
+  str.resize(size);
+  is.read(str.data(), size);
+}
+
+// FNV-1a hash of the net names in order, so a checkpoint isn't applied to
+// a design whose nets merely have the same count.
+uint64_t hashNetNames(frBlock* block)
+{
+  uint64_t hash = 14695981039346656037ULL;
+  for (const auto& net : block->getNets()) {
+    for (const char c : net->getName()) {
+      hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ULL;
+    }
+    hash = (hash ^ 0xff) * 1099511628211ULL;
+  }
+  return hash;
+}
+
+}  // namespace
+
+void FlexDR::writeCheckpoint(const bool incremental, const bool hasFixed) const
+{
+  ProfileTask profile("DR:checkpoint");
+  auto topBlock = getDesign()->getTopBlock();
+  std::vector<drUpdate> updates;
+  for (const auto& net : topBlock->getNets()) {
+    for (const auto& shape : net->getShapes()) {
+      if (shape->typeId() != frcPathSeg) {
+        continue;
+      }
+      drUpdate& update = updates.emplace_back(drUpdate::ADD_SHAPE, net.get());
+      update.setPathSeg(*static_cast<frPathSeg*>(shape.get()));
+    }
+    for (const auto& via : net->getVias()) {
+      drUpdate& update = updates.emplace_back(drUpdate::ADD_SHAPE, net.get());
+      update.setVia(*via);
+    }
+    for (const auto& pwire : net->getPatchWires()) {
+      drUpdate& update = updates.emplace_back(drUpdate::ADD_SHAPE, net.get());
+      update.setPatchWire(*static_cast<frPatchWire*>(pwire.get()));
+    }
+  }
+  for (const auto& marker : topBlock->getMarkers()) {
+    updates.emplace_back(drUpdate::ADD_SHAPE).setMarker(*marker);
+  }
+
+  // Written aside and renamed so a crash while writing keeps the previous
+  // checkpoint intact.
+  const std::string tmpFile = CHECKPOINT_FILE + ".tmp";
+  {
+    std::ofstream file(tmpFile, std::ios::binary);
+    if (!file) {
+      logger_->error(DRT, 630, "Unable to open {} for writing.", tmpFile);
+    }
+    file.write(kCheckpointMagic, sizeof(kCheckpointMagic));
+    writeValue(file, kCheckpointVersion);
+    writeString(file, topBlock->getName());
+    writeValue(file, static_cast<int32_t>(topBlock->getNets().size()));
+    writeValue(file, hashNetNames(topBlock));
+    writeValue(file, static_cast<int32_t>(iter_));
+    writeValue(file, clipSizeInc_);
+    writeValue(file, increaseClipsize_);
+    writeValue(file, incremental);
+    writeValue(file, hasFixed);
+    writeValue(file, static_cast<int32_t>(numViols_.size()));
+    for (const int numViols : numViols_) {
+      writeValue(file, static_cast<int32_t>(numViols));
+    }
+    drUpdate::serializeBatch(updates, file);
+    if (!file) {
+      logger_->error(DRT, 631, "Writing checkpoint {} failed.", tmpFile);
+    }
+  }
+  if (std::rename(tmpFile.c_str(), CHECKPOINT_FILE.c_str()) != 0) {
+    logger_->error(DRT,
+                   632,
+                   "Unable to rename {} to {}.",
+                   tmpFile,
+                   CHECKPOINT_FILE);
+  }
+  if (VERBOSE > 0) {
+    logger_->info(DRT,
+                  633,
+                  "Wrote checkpoint {} after iteration {}.",
+                  CHECKPOINT_FILE,
+                  iter_ - 1);
+  }
+}
+
+int FlexDR::readCheckpoint(bool& incremental, bool& hasFixed)
+{
+  ProfileTask profile("DR:resume");
+  auto topBlock = getDesign()->getTopBlock();
+  std::ifstream file(CHECKPOINT_FILE, std::ios::binary);
+  if (!file) {
+    logger_->error(DRT, 634, "Unable to open checkpoint {}.", CHECKPOINT_FILE);
+  }
+  char magic[sizeof(kCheckpointMagic)] = {};
+  file.read(magic, sizeof(magic));
+  int32_t version = 0;
+  readValue(file, version);
+  if (!file || !std::equal(magic, magic + sizeof(magic), kCheckpointMagic)
+      || version != kCheckpointVersion) {
+    logger_->error(
+        DRT, 635, "{} is not a detailed routing checkpoint.", CHECKPOINT_FILE);
+  }
+  std::string designName;
+  int32_t numNets = 0;
+  uint64_t netsHash = 0;
+  readString(file, designName);
+  readValue(file, numNets);
+  readValue(file, netsHash);
+  if (!file) {
+    logger_->error(
+        DRT, 635, "{} is not a detailed routing checkpoint.", CHECKPOINT_FILE);
+  }
+  const int designNets = topBlock->getNets().size();
+  if (designName != topBlock->getName() || numNets != designNets) {
+    logger_->error(DRT,
+                   640,
+                   "Checkpoint {} is for design {} with {} nets, not for "
+                   "design {} with {} nets.",
+                   CHECKPOINT_FILE,
+                   designName,
+                   numNets,
+                   topBlock->getName(),
+                   designNets);
+  }
+  if (netsHash != hashNetNames(topBlock)) {
+    logger_->error(DRT,
+                   644,
+                   "Checkpoint {} does not match the nets of design {}.",
+                   CHECKPOINT_FILE,
+                   designName);
+  }
+  int32_t iter = 0;
+  int32_t numIters = 0;
+  readValue(file, iter);
+  readValue(file, clipSizeInc_);
+  readValue(file, increaseClipsize_);
+  readValue(file, incremental);
+  readValue(file, hasFixed);
+  readValue(file, numIters);
+  if (!file || iter < 0 || numIters < 0 || numIters > kMaxCheckpointIters) {
+    logger_->error(
+        DRT, 645, "Checkpoint {} is truncated or corrupt.", CHECKPOINT_FILE);
+  }
+  numViols_.resize(numIters);
+  for (int& numViols : numViols_) {
+    int32_t value = 0;
+    readValue(file, value);
+    numViols = value;
+  }
+  if (!file) {
+    logger_->error(
+        DRT, 645, "Checkpoint {} is truncated or corrupt.", CHECKPOINT_FILE);
+  }
+  std::vector<std::vector<drUpdate>> updates(1);
+  try {
+    drUpdate::deserializeBatch(getDesign(), file, updates[0]);
+  } catch (const std::exception& e) {
+    logger_->error(DRT,
+                   637,
+                   "Reading checkpoint {} failed: {}",
+                   CHECKPOINT_FILE,
+                   e.what());
+  }
+
+  // The checkpoint holds the complete route state, replace what init()
+  // built.
+  auto regionQuery = getRegionQuery();
+  for (const auto& net : topBlock->getNets()) {
+    while (!net->getShapes().empty()) {
+      auto shape = net->getShapes().front().get();
+      regionQuery->removeDRObj(shape);
+      net->removeShape(shape);
+    }
+    while (!net->getVias().empty()) {
+      auto via = net->getVias().front().get();
+      regionQuery->removeDRObj(via);
+      net->removeVia(via);
+    }
+    while (!net->getPatchWires().empty()) {
+      auto pwire = net->getPatchWires().front().get();
+      regionQuery->removeDRObj(pwire);
+      net->removePatchWire(pwire);
+    }
+  }
+  std::vector<frMarker*> markers;
+  for (const auto& marker : topBlock->getMarkers()) {
+    markers.push_back(marker.get());
+  }
+  for (auto marker : markers) {
+    regionQuery->removeMarker(marker);
+    topBlock->removeMarker(marker);
+  }
+  if (!updates[0].empty()) {
+    router_->applyUpdates(updates);
+  }
+
+  iter_ = iter;
+  if (iter_ > 0) {
+    removeGCell2BoundaryPin();
+  }
+  logger_->info(DRT,
+                638,
+                "Resuming detailed routing at iteration {} with {} "
+                "violations.",
+                iter_,
+                topBlock->getNumMarkers());
+  return iter_;
+}
+
+}  // namespace drt
@@ -53,7 +53,6 @@ void FlexDRWorker::endRemoveNets_pathSeg(
   auto [begin, end] = pathSeg->getPoints();
   auto routeBox = getRouteBox();
   auto net = pathSeg->getNet();
-  auto regionQuery = design->getRegionQuery();
   // vertical seg
   if (begin.x() == end.x()) {
     // if cross routeBBox
@@ -96,7 +95,7 @@ void FlexDRWorker::endRemoveNets_pathSeg(
         std::unique_ptr<frShape> uShape(std::move(uPathSeg));
         auto sptr = uShape.get();
         net->addShape(std::move(uShape));
-        regionQuery->addDRObj(sptr);
+        endAddDRObj(sptr);
         // add cutSegs
         auto lNum = sptr->getLayerNum();
 
@@ -127,7 +126,7 @@ void FlexDRWorker::endRemoveNets_pathSeg(
         std::unique_ptr<frShape> uShape(std::move(uPathSeg));
         auto sptr = uShape.get();
         net->addShape(std::move(uShape));
-        regionQuery->addDRObj(sptr);
+        endAddDRObj(sptr);
         // add cutSegs
         auto lNum = sptr->getLayerNum();
 
@@ -142,8 +141,8 @@ void FlexDRWorker::endRemoveNets_pathSeg(
         update.setIndexInOwner(pathSeg->getIndexInOwner());
         design_->addUpdate(update);
       }
-      regionQuery->removeDRObj(pathSeg);  // delete rq
-      net->removeShape(pathSeg);          // delete segment
+      endRemoveDRObj(pathSeg);    // delete rq
+      net->removeShape(pathSeg);  // delete segment
     }
     // horizontal seg
   } else if (begin.y() == end.y()) {
@@ -181,7 +180,7 @@ void FlexDRWorker::endRemoveNets_pathSeg(
         std::unique_ptr<frShape> uShape(std::move(uPathSeg));
         auto sptr = uShape.get();
         net->addShape(std::move(uShape));
-        regionQuery->addDRObj(sptr);
+        endAddDRObj(sptr);
         // add cutSegs
         auto lNum = sptr->getLayerNum();
 
@@ -212,7 +211,7 @@ void FlexDRWorker::endRemoveNets_pathSeg(
         std::unique_ptr<frShape> uShape(std::move(uPathSeg));
         auto sptr = uShape.get();
         net->addShape(std::move(uShape));
-        regionQuery->addDRObj(sptr);
+        endAddDRObj(sptr);
         // add cutSegs
         auto lNum = sptr->getLayerNum();
 
@@ -227,8 +226,8 @@ void FlexDRWorker::endRemoveNets_pathSeg(
         update.setIndexInOwner(pathSeg->getIndexInOwner());
         design_->addUpdate(update);
       }
-      regionQuery->removeDRObj(pathSeg);  // delete rq
-      net->removeShape(pathSeg);          // delete segment
+      endRemoveDRObj(pathSeg);    // delete rq
+      net->removeShape(pathSeg);  // delete segment
     }
   }
 }
@@ -243,8 +242,7 @@ void FlexDRWorker::endRemoveNets_via(frDesign* design, frVia* via)
       update.setIndexInOwner(via->getIndexInOwner());
       design_->addUpdate(update);
     }
-    auto regionQuery = design->getRegionQuery();
-    regionQuery->removeDRObj(via);  // delete rq
+    endRemoveDRObj(via);  // delete rq
     net->removeVia(via);
   }
 }
@@ -259,8 +257,7 @@ void FlexDRWorker::endRemoveNets_patchWire(frDesign* design, frPatchWire* pwire)
       update.setIndexInOwner(pwire->getIndexInOwner());
       design_->addUpdate(update);
     }
-    auto regionQuery = design->getRegionQuery();
-    regionQuery->removeDRObj(pwire);  // delete rq
+    endRemoveDRObj(pwire);  // delete rq
     net->removePatchWire(pwire);
   }
 }
@@ -307,47 +304,43 @@ void FlexDRWorker::endRemoveNets(
   }
 }
 
-void FlexDRWorker::endAddNets_pathSeg(frDesign* design, drPathSeg* pathSeg)
+void FlexDRWorker::endAddNets_pathSeg(frNet* net,
+                                      std::unique_ptr<frShape> uShape)
 {
-  auto net = pathSeg->getNet()->getFrNet();
-  std::unique_ptr<frShape> uShape = std::make_unique<frPathSeg>(*pathSeg);
-  auto rptr = uShape.get();
+  auto rptr = static_cast<frPathSeg*>(uShape.get());
   net->addShape(std::move(uShape));
-  design->getRegionQuery()->addDRObj(rptr);
+  endAddDRObj(rptr);
   if (save_updates_) {
     drUpdate update(drUpdate::ADD_SHAPE);
     update.setNet(net);
-    update.setPathSeg(*pathSeg);
+    update.setPathSeg(*rptr);
     design_->addUpdate(update);
   }
 }
 
-void FlexDRWorker::endAddNets_via(frDesign* design, drVia* via)
+void FlexDRWorker::endAddNets_via(frNet* net, std::unique_ptr<frVia> uVia)
 {
-  auto net = via->getNet()->getFrNet();
-  std::unique_ptr<frVia> uVia = std::make_unique<frVia>(*via);
   auto rptr = uVia.get();
   net->addVia(std::move(uVia));
-  design->getRegionQuery()->addDRObj(rptr);
+  endAddDRObj(rptr);
   if (save_updates_) {
     drUpdate update(drUpdate::ADD_SHAPE);
     update.setNet(net);
-    update.setVia(*via);
+    update.setVia(*rptr);
     design_->addUpdate(update);
   }
 }
 
-void FlexDRWorker::endAddNets_patchWire(frDesign* design, drPatchWire* pwire)
+void FlexDRWorker::endAddNets_patchWire(frNet* net,
+                                        std::unique_ptr<frShape> uShape)
 {
-  auto net = pwire->getNet()->getFrNet();
-  std::unique_ptr<frShape> uShape = std::make_unique<frPatchWire>(*pwire);
-  auto rptr = uShape.get();
+  auto rptr = static_cast<frPatchWire*>(uShape.get());
   net->addPatchWire(std::move(uShape));
-  design->getRegionQuery()->addDRObj(rptr);
+  endAddDRObj(rptr);
   if (save_updates_) {
     drUpdate update(drUpdate::ADD_SHAPE);
     update.setNet(net);
-    update.setPatchWire(*pwire);
+    update.setPatchWire(*rptr);
     design_->addUpdate(update);
   }
 }
@@ -598,23 +591,20 @@ void FlexDRWorker::endAddNets(
     std::map<frNet*, std::set<std::pair<Point, frLayerNum>>, frBlockObjectComp>&
         boundPts)
 {
-  for (auto& net : nets_) {
-    if (!net->isModified()) {
-      continue;
-    }
-    for (auto& connFig : net->getBestRouteConnFigs()) {
-      if (connFig->typeId() == drcPathSeg) {
-        endAddNets_pathSeg(
-            design, static_cast<drPathSeg*>(connFig.get()) /*, cutSegs[fNet]*/);
-      } else if (connFig->typeId() == drcVia) {
-        endAddNets_via(design, static_cast<drVia*>(connFig.get()));
-      } else if (connFig->typeId() == drcPatchWire) {
-        endAddNets_patchWire(design, static_cast<drPatchWire*>(connFig.get()));
-      } else {
-        std::cout << "Error: endAddNets unsupported type" << std::endl;
-      }
+  for (auto& fig : end_changes_.figs) {
+    if (fig.via) {
+      endAddNets_via(fig.net, std::move(fig.via));
+    } else if (fig.shape->typeId() == frcPathSeg) {
+      endAddNets_pathSeg(fig.net, std::move(fig.shape));
+    } else {
+      endAddNets_patchWire(fig.net, std::move(fig.shape));
     }
-    if (net->hasExtFigUpdates()) {
+  }
+  end_changes_.figs.clear();
+  // the ext fig updates and merges query the new shapes
+  endFlushDRObjs(design);
+  for (auto& net : nets_) {
+    if (net->isModified() && net->hasExtFigUpdates()) {
       endAddNets_updateExtFigs(net.get());
     }
   }
@@ -644,20 +634,17 @@ void FlexDRWorker::endAddMarkers(frDesign* design)
 {
   auto regionQuery = design->getRegionQuery();
   auto topBlock = design->getTopBlock();
-  // for (auto &m: getMarkers()) {
-  for (auto& m : getBestMarkers()) {
-    if (getDrcBox().intersects(m.getBBox())) {
-      auto uptr = std::make_unique<frMarker>(m);
-      auto ptr = uptr.get();
-      regionQuery->addMarker(ptr);
-      topBlock->addMarker(std::move(uptr));
-      if (save_updates_) {
-        drUpdate update(drUpdate::ADD_SHAPE);
-        update.setMarker(*ptr);
-        design_->addUpdate(update);
-      }
+  for (auto& uptr : end_changes_.markers) {
+    auto ptr = uptr.get();
+    regionQuery->addMarker(ptr);
+    topBlock->addMarker(std::move(uptr));
+    if (save_updates_) {
+      drUpdate update(drUpdate::ADD_SHAPE);
+      update.setMarker(*ptr);
+      design_->addUpdate(update);
     }
   }
+  end_changes_.markers.clear();
 }
 
 void FlexDRWorker::cleanup()
@@ -678,15 +665,17 @@ void FlexDRWorker::cleanup()
   specialAccessAPs.clear();
 }
 
-bool FlexDRWorker::end(frDesign* design)
+void FlexDRWorker::endPrepare()
 {
+  end_changes_ = EndChanges();
+  end_changes_.prepared = true;
   if (skipRouting_ == true) {
-    return false;
+    return;
   }
   // skip if current clip does not have input DRCs
   // ripupMode = 0 must have enableDRC = true in previous iteration
   if (getDRIter() && getInitNumMarkers() == 0 && !needRecheck_) {
-    return false;
+    return;
     // do not write back if current clip is worse than input
   }
   if ((getRipupMode() == RipUpMode::DRC || getRipupMode() == RipUpMode::NEARDRC
@@ -694,24 +683,104 @@ bool FlexDRWorker::end(frDesign* design)
       && getBestNumMarkers() > getInitNumMarkers()) {
     // cout <<"skip clip with #init/final = " <<getInitNumMarkers() <<"/"
     // <<getNumMarkers() <<endl;
-    return false;
+    return;
   }
   if (getDRIter() && getRipupMode() == RipUpMode::ALL
       && getBestNumMarkers() > 5 * getInitNumMarkers()) {
+    return;
+  }
+  end_changes_.write_back = true;
+  endGetModNets(end_changes_.mod_nets);
+  for (auto& net : nets_) {
+    if (!net->isModified()) {
+      continue;
+    }
+    frNet* fr_net = net->getFrNet();
+    for (auto& connFig : net->getBestRouteConnFigs()) {
+      EndChanges::Fig fig{fr_net};
+      if (connFig->typeId() == drcPathSeg) {
+        fig.shape = std::make_unique<frPathSeg>(
+            *static_cast<drPathSeg*>(connFig.get()));
+      } else if (connFig->typeId() == drcVia) {
+        fig.via = std::make_unique<frVia>(*static_cast<drVia*>(connFig.get()));
+      } else if (connFig->typeId() == drcPatchWire) {
+        fig.shape = std::make_unique<frPatchWire>(
+            *static_cast<drPatchWire*>(connFig.get()));
+      } else {
+        std::cout << "Error: endAddNets unsupported type" << std::endl;
+        continue;
+      }
+      end_changes_.figs.push_back(std::move(fig));
+    }
+  }
+  // for (auto &m: getMarkers()) {
+  for (auto& m : getBestMarkers()) {
+    if (getDrcBox().intersects(m.getBBox())) {
+      end_changes_.markers.push_back(std::make_unique<frMarker>(m));
+    }
+  }
+}
+
+void FlexDRWorker::endRemoveDRObj(frShape* shape)
+{
+  end_removed_dr_objs_.at(shape->getLayerNum())
+      .emplace_back(shape->getBBox(), shape);
+}
+
+void FlexDRWorker::endRemoveDRObj(frVia* via)
+{
+  end_removed_dr_objs_.at(via->getViaDef()->getCutLayerNum())
+      .emplace_back(via->getBBox(), via);
+}
+
+void FlexDRWorker::endAddDRObj(frShape* shape)
+{
+  end_added_dr_objs_.at(shape->getLayerNum())
+      .emplace_back(shape->getBBox(), shape);
+}
+
+void FlexDRWorker::endAddDRObj(frVia* via)
+{
+  end_added_dr_objs_.at(via->getViaDef()->getCutLayerNum())
+      .emplace_back(via->getBBox(), via);
+}
+
+void FlexDRWorker::endFlushDRObjs(frDesign* design)
+{
+  design->getRegionQuery()->updateDRObjs(end_removed_dr_objs_,
+                                         end_added_dr_objs_);
+  for (auto& objs : end_removed_dr_objs_) {
+    objs.clear();
+  }
+  for (auto& objs : end_added_dr_objs_) {
+    objs.clear();
+  }
+}
+
+bool FlexDRWorker::end(frDesign* design)
+{
+  // distributed workers come back without their changes
+  if (!end_changes_.prepared) {
+    endPrepare();
+  }
+  if (!end_changes_.write_back) {
+    end_changes_ = EndChanges();
     return false;
   }
   save_updates_ = dist_on_;
-  std::set<frNet*, frBlockObjectComp> modNets;
-  endGetModNets(modNets);
+  const int num_layers = getTech()->getLayers().size();
+  end_removed_dr_objs_.resize(num_layers);
+  end_added_dr_objs_.resize(num_layers);
   // get lock
   std::map<frNet*, std::set<std::pair<Point, frLayerNum>>, frBlockObjectComp>
       boundPts;
-  endRemoveNets(design, modNets, boundPts);
+  endRemoveNets(design, end_changes_.mod_nets, boundPts);
   endAddNets(design, boundPts);  // if two subnets have diff isModified()
                                  // status, then should always write back
   endRemoveMarkers(design);
   endAddMarkers(design);
   // release lock
+  end_changes_ = EndChanges();
   return true;
 }
 
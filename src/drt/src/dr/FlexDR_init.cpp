@@ -3685,6 +3685,7 @@ void FlexDRWorker::init(const frDesign* design)
   gcWorker->setDrcBox(getDrcBox());
   gcWorker->init(design);
   gcWorker->setEnableSurgicalFix(true);
+  gcWorker->setEnableIncremental(DR_INCREMENTAL_GC);
   setGCWorker(std::move(gcWorker));
   initMazeCost(design);
 }
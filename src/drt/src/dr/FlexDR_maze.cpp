@@ -2997,7 +2997,10 @@ bool FlexDRWorker::hasAccessPoint(const Point& pt, frLayerNum lNum, frNet* net)
 {
   frRegionQuery::Objects<frBlockObject> result;
   Rect bx(pt.x(), pt.y(), pt.x(), pt.y());
-  design_->getRegionQuery()->query(bx, lNum, result);
+  {
+    auto design_lock = lockDesignShared();
+    design_->getRegionQuery()->query(bx, lNum, result);
+  }
   for (auto& rqObj : result) {
     switch (rqObj.second->typeId()) {
       case frcInstTerm: {
@@ -3267,13 +3270,25 @@ bool FlexDRWorker::routeNet(drNet* net, std::vector<FlexMazeIdx>& paths)
     auto nextPin = routeNet_getNextDst(
         ccMazeIdx1, ccMazeIdx2, mazeIdx2unConnPins, pinTaperBoxes);
     path.clear();
-    if (gridGraph_.search(connComps,
-                          nextPin,
-                          path,
-                          ccMazeIdx1,
-                          ccMazeIdx2,
-                          centerPt,
-                          mazeIdx2TaperBox)) {
+    const bool found = gridGraph_.search(connComps,
+                                         nextPin,
+                                         path,
+                                         ccMazeIdx1,
+                                         ccMazeIdx2,
+                                         centerPt,
+                                         mazeIdx2TaperBox);
+    numMazeExpansions_ += gridGraph_.getNumExpandedNodes();
+    debugPrint(logger_,
+               DRT,
+               "maze",
+               2,
+               "Net {} pin {}: {} sources, {} nodes expanded, {} pushed.",
+               net->getFrNet()->getName(),
+               nextPin->getName(),
+               connComps.size(),
+               gridGraph_.getNumExpandedNodes(),
+               gridGraph_.getNumPushedNodes());
+    if (found) {
       routeNet_postAstarUpdate(
           path, connComps, unConnPins, mazeIdx2unConnPins, isFirstConn);
       routeNet_postAstarWritePath(
@@ -70,8 +70,12 @@ void FlexGridGraph::initGrids(
   getDim(xDim, yDim, zDim);
   const int capacity = xDim * yDim * zDim;
 
+  if (arena_ && nodes_.capacity() == 0) {
+    acquireFromArena();
+  }
   nodes_.clear();
   nodes_.resize(capacity, Node());
+  ndrNodes_.clear();
   // new
   prevDirs_.clear();
   srcs_.clear();
@@ -88,6 +92,46 @@ void FlexGridGraph::initGrids(
   }
 }
 
+size_t FlexGridGraph::Arena::getSize() const
+{
+  return nodes.capacity() * sizeof(Node) + ndrNodes.capacity() * sizeof(NDRNode)
+         + (prevDirs.capacity() + srcs.capacity() + dsts.capacity()
+            + guides.capacity())
+               / 8
+         + wavefront.capacity() * sizeof(FlexWavefrontGrid);
+}
+
+void FlexGridGraph::acquireFromArena()
+{
+  nodes_.swap(arena_->nodes);
+  ndrNodes_.swap(arena_->ndrNodes);
+  prevDirs_.swap(arena_->prevDirs);
+  srcs_.swap(arena_->srcs);
+  dsts_.swap(arena_->dsts);
+  guides_.swap(arena_->guides);
+  wavefront_.swapBuffer(arena_->wavefront);
+}
+
+void FlexGridGraph::releaseToArena()
+{
+  wavefront_.cleanup();
+  // Clear before swapping so the arena never holds stale node state.
+  nodes_.clear();
+  ndrNodes_.clear();
+  prevDirs_.clear();
+  srcs_.clear();
+  dsts_.clear();
+  guides_.clear();
+  nodes_.swap(arena_->nodes);
+  ndrNodes_.swap(arena_->ndrNodes);
+  prevDirs_.swap(arena_->prevDirs);
+  srcs_.swap(arena_->srcs);
+  dsts_.swap(arena_->dsts);
+  guides_.swap(arena_->guides);
+  wavefront_.swapBuffer(arena_->wavefront);
+  arena_->highWaterMark = std::max(arena_->highWaterMark, arena_->getSize());
+}
+
 bool FlexGridGraph::outOfDieVia(frMIdx x,
                                 frMIdx y,
                                 frMIdx z,
@@ -257,32 +257,31 @@ class FlexGridGraph
     frUInt4 sol = 0;
     if (dir != frDirEnum::D && dir != frDirEnum::U) {
       reverse(x, y, z, dir);
-      const Node& node = nodes_[getIdx(x, y, z)];
+      const auto idx = getIdx(x, y, z);
+      const Node& node = nodes_[idx];
+      const NDRNode* ndr_node = consider_ndr ? getNDRNode(idx) : nullptr;
       if (dir == frDirEnum::W || dir == frDirEnum::E) {
-        if (consider_ndr) {
-          sol = std::max(node.fixedShapeCostPlanarHorz,
-                         node.fixedShapeCostPlanarHorzNDR);
-        } else {
-          sol = node.fixedShapeCostPlanarHorz;
+        sol = node.fixedShapeCostPlanarHorz;
+        if (ndr_node) {
+          sol = std::max(sol, (frUInt4) ndr_node->fixedShapeCostPlanarHorz);
         }
       } else {
-        if (consider_ndr) {
-          sol = std::max(node.fixedShapeCostPlanarVert,
-                         node.fixedShapeCostPlanarVertNDR);
-        } else {
-          sol = node.fixedShapeCostPlanarVert;
+        sol = node.fixedShapeCostPlanarVert;
+        if (ndr_node) {
+          sol = std::max(sol, (frUInt4) ndr_node->fixedShapeCostPlanarVert);
         }
       }
     } else {
       correctU(x, y, z, dir);
-      const Node& node = nodes_[getIdx(x, y, z)];
-      if (isOverrideShapeCost(x, y, z, dir)) {
+      const auto idx = getIdx(x, y, z);
+      const Node& node = nodes_[idx];
+      if (node.overrideShapeCostVia) {
         sol = 0;
       } else {
-        if (consider_ndr) {
-          sol = std::max(node.fixedShapeCostVia, node.fixedShapeCostViaNDR);
-        } else {
-          sol = node.fixedShapeCostVia;
+        sol = node.fixedShapeCostVia;
+        const NDRNode* ndr_node = consider_ndr ? getNDRNode(idx) : nullptr;
+        if (ndr_node) {
+          sol = std::max(sol, (frUInt4) ndr_node->fixedShapeCostVia);
         }
       }
     }
@@ -316,20 +315,18 @@ class FlexGridGraph
     if (dir != frDirEnum::D && dir != frDirEnum::U) {
       reverse(x, y, z, dir);
       auto idx = getIdx(x, y, z);
-      if (consider_ndr) {
-        sol = std::max(nodes_[idx].routeShapeCostPlanar,
-                       nodes_[idx].routeShapeCostPlanarNDR);
-      } else {
-        sol = nodes_[idx].routeShapeCostPlanar;
+      sol = nodes_[idx].routeShapeCostPlanar;
+      const NDRNode* ndr_node = consider_ndr ? getNDRNode(idx) : nullptr;
+      if (ndr_node) {
+        sol = std::max(sol, (frUInt4) ndr_node->routeShapeCostPlanar);
       }
     } else {
       correctU(x, y, z, dir);
       auto idx = getIdx(x, y, z);
-      if (consider_ndr) {
-        sol = std::max(nodes_[idx].routeShapeCostVia,
-                       nodes_[idx].routeShapeCostViaNDR);
-      } else {
-        sol = nodes_[idx].routeShapeCostVia;
+      sol = nodes_[idx].routeShapeCostVia;
+      const NDRNode* ndr_node = consider_ndr ? getNDRNode(idx) : nullptr;
+      if (ndr_node) {
+        sol = std::max(sol, (frUInt4) ndr_node->routeShapeCostVia);
       }
     }
     return (sol);
@@ -513,7 +510,9 @@ class FlexGridGraph
   {
     auto& node = nodes_[getIdx(x, y, z)];
     if (ndr) {
-      node.routeShapeCostPlanarNDR = addToByte(node.routeShapeCostPlanarNDR, 1);
+      auto& ndr_node = getNDRNodeForWrite(getIdx(x, y, z));
+      ndr_node.routeShapeCostPlanar
+          = addToByte(ndr_node.routeShapeCostPlanar, 1);
     } else {
       node.routeShapeCostPlanar = addToByte(node.routeShapeCostPlanar, 1);
     }
@@ -522,7 +521,8 @@ class FlexGridGraph
   {
     auto& node = nodes_[getIdx(x, y, z)];
     if (ndr) {
-      node.routeShapeCostViaNDR = addToByte(node.routeShapeCostViaNDR, 1);
+      auto& ndr_node = getNDRNodeForWrite(getIdx(x, y, z));
+      ndr_node.routeShapeCostVia = addToByte(ndr_node.routeShapeCostVia, 1);
     } else {
       node.routeShapeCostVia = addToByte(node.routeShapeCostVia, 1);
     }
@@ -531,8 +531,9 @@ class FlexGridGraph
   {
     auto& node = nodes_[getIdx(x, y, z)];
     if (ndr) {
-      node.routeShapeCostPlanarNDR
-          = subFromByte(node.routeShapeCostPlanarNDR, 1);
+      auto& ndr_node = getNDRNodeForWrite(getIdx(x, y, z));
+      ndr_node.routeShapeCostPlanar
+          = subFromByte(ndr_node.routeShapeCostPlanar, 1);
     } else {
       node.routeShapeCostPlanar = subFromByte(node.routeShapeCostPlanar, 1);
     }
@@ -541,7 +542,8 @@ class FlexGridGraph
   {
     auto& node = nodes_[getIdx(x, y, z)];
     if (ndr) {
-      node.routeShapeCostViaNDR = subFromByte(node.routeShapeCostViaNDR, 1);
+      auto& ndr_node = getNDRNodeForWrite(getIdx(x, y, z));
+      ndr_node.routeShapeCostVia = subFromByte(ndr_node.routeShapeCostVia, 1);
     } else {
       node.routeShapeCostVia = subFromByte(node.routeShapeCostVia, 1);
     }
@@ -550,7 +552,9 @@ class FlexGridGraph
   {
     auto idx = getIdx(x, y, z);
     if (ndr) {
-      nodes_[idx].routeShapeCostViaNDR = 0;
+      if (!ndrNodes_.empty()) {
+        ndrNodes_[idx].routeShapeCostVia = 0;
+      }
     } else {
       nodes_[idx].routeShapeCostVia = 0;
     }
@@ -654,10 +658,11 @@ class FlexGridGraph
     if (isValid(x, y, z)) {
       auto& node = nodes_[getIdx(x, y, z)];
       if (ndr) {
-        node.fixedShapeCostPlanarHorzNDR
-            = addToByte(node.fixedShapeCostPlanarHorzNDR, 1);
-        node.fixedShapeCostPlanarVertNDR
-            = addToByte(node.fixedShapeCostPlanarVertNDR, 1);
+        auto& ndr_node = getNDRNodeForWrite(getIdx(x, y, z));
+        ndr_node.fixedShapeCostPlanarHorz
+            = addToByte(ndr_node.fixedShapeCostPlanarHorz, 1);
+        ndr_node.fixedShapeCostPlanarVert
+            = addToByte(ndr_node.fixedShapeCostPlanarVert, 1);
       } else {
         node.fixedShapeCostPlanarHorz
             = addToByte(node.fixedShapeCostPlanarHorz, 1);
@@ -675,7 +680,7 @@ class FlexGridGraph
     if (isValid(x, y, z)) {
       auto& node = nodes_[getIdx(x, y, z)];
       if (ndr) {
-        node.fixedShapeCostPlanarVertNDR = c;
+        getNDRNodeForWrite(getIdx(x, y, z)).fixedShapeCostPlanarVert = c;
       } else {
         node.fixedShapeCostPlanarVert = c;
       }
@@ -690,7 +695,7 @@ class FlexGridGraph
     if (isValid(x, y, z)) {
       auto& node = nodes_[getIdx(x, y, z)];
       if (ndr) {
-        node.fixedShapeCostPlanarHorzNDR = c;
+        getNDRNodeForWrite(getIdx(x, y, z)).fixedShapeCostPlanarHorz = c;
       } else {
         node.fixedShapeCostPlanarHorz = c;
       }
@@ -701,7 +706,8 @@ class FlexGridGraph
     if (isValid(x, y, z)) {
       auto& node = nodes_[getIdx(x, y, z)];
       if (ndr) {
-        node.fixedShapeCostViaNDR = addToByte(node.fixedShapeCostViaNDR, 1);
+        auto& ndr_node = getNDRNodeForWrite(getIdx(x, y, z));
+        ndr_node.fixedShapeCostVia = addToByte(ndr_node.fixedShapeCostVia, 1);
       } else {
         node.fixedShapeCostVia = addToByte(node.fixedShapeCostVia, 1);
       }
@@ -716,7 +722,7 @@ class FlexGridGraph
     if (isValid(x, y, z)) {
       auto& node = nodes_[getIdx(x, y, z)];
       if (ndr) {
-        node.fixedShapeCostViaNDR = c;
+        getNDRNodeForWrite(getIdx(x, y, z)).fixedShapeCostVia = c;
       } else {
         node.fixedShapeCostVia = c;
       }
@@ -727,10 +733,11 @@ class FlexGridGraph
     if (isValid(x, y, z)) {
       auto& node = nodes_[getIdx(x, y, z)];
       if (ndr) {
-        node.fixedShapeCostPlanarHorzNDR
-            = subFromByte(node.fixedShapeCostPlanarHorzNDR, 1);
-        node.fixedShapeCostPlanarVertNDR
-            = subFromByte(node.fixedShapeCostPlanarVertNDR, 1);
+        auto& ndr_node = getNDRNodeForWrite(getIdx(x, y, z));
+        ndr_node.fixedShapeCostPlanarHorz
+            = subFromByte(ndr_node.fixedShapeCostPlanarHorz, 1);
+        ndr_node.fixedShapeCostPlanarVert
+            = subFromByte(ndr_node.fixedShapeCostPlanarVert, 1);
       } else {
         node.fixedShapeCostPlanarHorz
             = subFromByte(node.fixedShapeCostPlanarHorz, 1);
@@ -744,7 +751,8 @@ class FlexGridGraph
     if (isValid(x, y, z)) {
       auto& node = nodes_[getIdx(x, y, z)];
       if (ndr) {
-        node.fixedShapeCostViaNDR = subFromByte(node.fixedShapeCostViaNDR, 1);
+        auto& ndr_node = getNDRNodeForWrite(getIdx(x, y, z));
+        ndr_node.fixedShapeCostVia = subFromByte(ndr_node.fixedShapeCostVia, 1);
       } else {
         node.fixedShapeCostVia = subFromByte(node.fixedShapeCostVia, 1);
       }
@@ -938,6 +946,9 @@ class FlexGridGraph
               FlexMazeIdx& ccMazeIdx2,
               const Point& centerPt,
               std::map<FlexMazeIdx, frBox3D*>& mazeIdx2TaperBox);
+  // number of nodes popped and pushed by the last search
+  int getNumExpandedNodes() const { return numExpandedNodes_; }
+  int getNumPushedNodes() const { return numPushedNodes_; }
   void setCost(frUInt4 drcCostIn,
                frUInt4 markerCostIn,
                frUInt4 FixedShapeCostIn)
@@ -955,8 +966,13 @@ class FlexGridGraph
   int nTracksY() { return yCoords_.size(); }
   void cleanup()
   {
+    if (arena_) {
+      releaseToArena();
+    }
     nodes_.clear();
     nodes_.shrink_to_fit();
+    ndrNodes_.clear();
+    ndrNodes_.shrink_to_fit();
     srcs_.clear();
     srcs_.shrink_to_fit();
     dsts_.clear();
@@ -1051,21 +1067,51 @@ class FlexGridGraph
     frUInt4 fixedShapeCostPlanarHorz : cost_bits;
     // Byte8
     frUInt4 fixedShapeCostPlanarVert : cost_bits;
-    // Byte9
-    frUInt4 routeShapeCostPlanarNDR : cost_bits;
-    // Byte10
-    frUInt4 routeShapeCostViaNDR : cost_bits;
-    // Byte 11
-    frUInt4 fixedShapeCostViaNDR : cost_bits;
-    // Byte 12
-    frUInt4 fixedShapeCostPlanarHorzNDR : cost_bits;
-    // Byte 13
-    frUInt4 fixedShapeCostPlanarVertNDR : cost_bits;
   };
 #ifndef DEBUG_DRT_UNDERFLOW
-  static_assert(sizeof(Node) == 16);
+  static_assert(sizeof(Node) == 12);
 #endif
+  // The NDR costs are only read when routing a net with a non default rule
+  // so they are kept out of the Node array the search walks over.
+  struct NDRNode
+  {
+    NDRNode() { std::memset(this, 0, sizeof(NDRNode)); }
+    // Byte 0
+    frUInt4 routeShapeCostPlanar : cost_bits;
+    // Byte 1
+    frUInt4 routeShapeCostVia : cost_bits;
+    // Byte 2
+    frUInt4 fixedShapeCostVia : cost_bits;
+    // Byte 3
+    frUInt4 fixedShapeCostPlanarHorz : cost_bits;
+    // Byte 4
+    frUInt4 fixedShapeCostPlanarVert : cost_bits;
+  };
+
+ public:
+  // Keeps the per node buffers of the grid graphs routed by one thread so
+  // the next worker on that thread reuses the allocations instead of
+  // growing them again.
+  struct Arena
+  {
+    frVector<Node> nodes;
+    frVector<NDRNode> ndrNodes;
+    std::vector<bool> prevDirs;
+    std::vector<bool> srcs;
+    std::vector<bool> dsts;
+    std::vector<bool> guides;
+    std::vector<FlexWavefrontGrid> wavefront;
+    // Largest footprint in bytes handed out by this arena.
+    size_t highWaterMark = 0;
+
+    size_t getSize() const;
+  };
+  void setArena(Arena* arena) { arena_ = arena; }
+
+ private:
   frVector<Node> nodes_;
+  // Empty until the first NDR cost is written, otherwise sized as nodes_.
+  frVector<NDRNode> ndrNodes_;
   std::vector<bool> prevDirs_;
   std::vector<bool> srcs_;
   std::vector<bool> dsts_;
@@ -1081,15 +1127,21 @@ class FlexGridGraph
   frUInt4 ggFixedShapeCost_ = 0;
   // temporary variables
   FlexWavefront wavefront_;
+  int numExpandedNodes_ = 0;
+  int numPushedNodes_ = 0;
   const std::vector<std::pair<frCoord, frCoord>>* halfViaEncArea_
       = nullptr;  // std::pair<layer1area, layer2area>
   // ndr related
   frNonDefaultRule* ndr_ = nullptr;
   const frBox3D* dstTaperBox
       = nullptr;  // taper box for the current dest pin in the search
+  Arena* arena_ = nullptr;  // owned by FlexDR
 
   FlexGridGraph() = default;
 
+  void acquireFromArena();
+  void releaseToArena();
+
   // unsafe access, no idx check
   void setPrevAstarNodeDir(frMIdx x, frMIdx y, frMIdx z, frDirEnum dir)
   {
@@ -1127,6 +1179,17 @@ class FlexGridGraph
   }
 
   // internal getters
+  const NDRNode* getNDRNode(frMIdx idx) const
+  {
+    return ndrNodes_.empty() ? nullptr : &ndrNodes_[idx];
+  }
+  NDRNode& getNDRNodeForWrite(frMIdx idx)
+  {
+    if (ndrNodes_.empty()) {
+      ndrNodes_.resize(nodes_.size());
+    }
+    return ndrNodes_[idx];
+  }
   frMIdx getIdx(frMIdx xIdx, frMIdx yIdx, frMIdx zIdx) const
   {
     auto xSize = xCoords_.size();
@@ -1314,6 +1377,7 @@ class FlexGridGraph
     }
     (ar) & drWorker_;
     (ar) & nodes_;
+    (ar) & ndrNodes_;
     (ar) & prevDirs_;
     (ar) & srcs_;
     (ar) & dsts_;
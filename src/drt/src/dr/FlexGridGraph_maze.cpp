@@ -686,6 +686,8 @@ bool FlexGridGraph::search(std::vector<FlexMazeIdx>& connComps,
   }
 
   wavefront_.cleanup();
+  numExpandedNodes_ = 0;
+  numPushedNodes_ = connComps.size();
   // init wavefront
   Point currPt;
   for (auto& idx : connComps) {
@@ -735,7 +737,10 @@ bool FlexGridGraph::search(std::vector<FlexMazeIdx>& connComps,
       return true;
     }
     // expand and update wavefront
+    numExpandedNodes_++;
+    const int prevSize = wavefront_.size();
     expandWavefront(currGrid, dstMazeIdx1, dstMazeIdx2, centerPt);
+    numPushedNodes_ += wavefront_.size() - prevSize;
   }
   return false;
 }
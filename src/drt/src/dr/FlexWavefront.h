@@ -28,6 +28,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <bitset>
 #include <memory>
 #include <queue>
@@ -148,20 +149,176 @@ class myPriorityQueue : public std::priority_queue<FlexWavefrontGrid>
     this->c.clear();
     this->c.shrink_to_fit();
   }
+  void swapContainer(std::vector<FlexWavefrontGrid>& other)
+  {
+    this->c.swap(other);
+  }
+  size_t capacity() const { return this->c.capacity(); }
+};
+
+// Monotone radix heap keyed on the total cost.  Bucket 0 holds the grids
+// whose cost equals last_, the smallest cost in the queue, kept in a heap so
+// the remaining tie breakers of FlexWavefrontGrid apply.  Bucket i > 0 holds
+// the grids whose cost first differs from last_ in bit i - 1.  Pushes below
+// last_ (the estimate is not always consistent) go to a separate heap that
+// is drained before the buckets, as all of its grids cost less than last_.
+class radixWavefrontQueue
+{
+ public:
+  bool empty() const { return size_ == 0; }
+  size_t size() const { return size_; }
+  const FlexWavefrontGrid& top() const
+  {
+    return below_.empty() ? bucket0_.top() : below_.top();
+  }
+  void pop()
+  {
+    size_--;
+    if (!below_.empty()) {
+      below_.pop();
+      return;
+    }
+    bucket0_.pop();
+    if (bucket0_.empty() && size_ > 0) {
+      refill();
+    }
+  }
+  void push(const FlexWavefrontGrid& in)
+  {
+    if (size_ == 0) {
+      last_ = in.getCost();
+    }
+    if (in.getCost() < last_) {
+      below_.push(in);
+    } else {
+      insert(in);
+    }
+    size_++;
+  }
+  void cleanup()
+  {
+    bucket0_.cleanup();
+    below_.cleanup();
+    for (auto& bucket : buckets_) {
+      bucket.clear();
+    }
+    size_ = 0;
+    last_ = 0;
+  }
+  void fit()
+  {
+    cleanup();
+    bucket0_.fit();
+    below_.fit();
+    for (auto& bucket : buckets_) {
+      bucket.shrink_to_fit();
+    }
+  }
+  myPriorityQueue& getBucket0() { return bucket0_; }
+
+ private:
+  static constexpr int kNumBuckets = sizeof(frCost) * 8 + 1;
+
+  int getBucketIdx(frCost cost) const
+  {
+    return cost == last_ ? 0 : kNumBuckets - __builtin_clz(cost ^ last_) - 1;
+  }
+  void insert(const FlexWavefrontGrid& in)
+  {
+    const int idx = getBucketIdx(in.getCost());
+    if (idx == 0) {
+      bucket0_.push(in);
+    } else {
+      buckets_[idx].push_back(in);
+    }
+  }
+  // moves the smallest non-empty bucket down once bucket 0 runs out
+  void refill()
+  {
+    int idx = 1;
+    while (buckets_[idx].empty()) {
+      idx++;
+    }
+    std::vector<FlexWavefrontGrid> bucket;
+    bucket.swap(buckets_[idx]);
+    last_ = std::min_element(bucket.begin(),
+                             bucket.end(),
+                             [](const auto& a, const auto& b) {
+                               return a.getCost() < b.getCost();
+                             })
+                ->getCost();
+    for (const auto& grid : bucket) {
+      insert(grid);
+    }
+    bucket.clear();
+    bucket.swap(buckets_[idx]);
+  }
+
+  myPriorityQueue bucket0_;
+  myPriorityQueue below_;
+  std::vector<FlexWavefrontGrid> buckets_[kNumBuckets];
+  size_t size_ = 0;
+  frCost last_ = 0;
 };
 
+// Open list of the maze search.  Uses the binary heap unless
+// DR_RADIX_MAZE_QUEUE selects the radix queue when the graph is built.  The
+// radix queue pops grids that tie on every key in a different order than
+// the heap, so it is opt-in to keep routing results stable.
 class FlexWavefront
 {
  public:
-  bool empty() const { return wavefrontPQ_.empty(); }
-  const FlexWavefrontGrid& top() const { return wavefrontPQ_.top(); }
-  void pop() { wavefrontPQ_.pop(); }
-  void push(const FlexWavefrontGrid& in) { wavefrontPQ_.push(in); }
-  unsigned int size() const { return wavefrontPQ_.size(); }
-  void cleanup() { wavefrontPQ_.cleanup(); }
-  void fit() { wavefrontPQ_.fit(); }
+  bool empty() const
+  {
+    return useRadix_ ? radixPQ_.empty() : wavefrontPQ_.empty();
+  }
+  const FlexWavefrontGrid& top() const
+  {
+    return useRadix_ ? radixPQ_.top() : wavefrontPQ_.top();
+  }
+  void pop()
+  {
+    if (useRadix_) {
+      radixPQ_.pop();
+    } else {
+      wavefrontPQ_.pop();
+    }
+  }
+  void push(const FlexWavefrontGrid& in)
+  {
+    if (useRadix_) {
+      radixPQ_.push(in);
+    } else {
+      wavefrontPQ_.push(in);
+    }
+  }
+  unsigned int size() const
+  {
+    return useRadix_ ? radixPQ_.size() : wavefrontPQ_.size();
+  }
+  void cleanup()
+  {
+    wavefrontPQ_.cleanup();
+    radixPQ_.cleanup();
+  }
+  void fit()
+  {
+    wavefrontPQ_.fit();
+    radixPQ_.fit();
+  }
+  // hands over the heap storage, the queue is empty at that point
+  void swapBuffer(std::vector<FlexWavefrontGrid>& other)
+  {
+    if (useRadix_) {
+      radixPQ_.getBucket0().swapContainer(other);
+    } else {
+      wavefrontPQ_.swapContainer(other);
+    }
+  }
 
  private:
   myPriorityQueue wavefrontPQ_;
+  radixWavefrontQueue radixPQ_;
+  bool useRadix_ = DR_RADIX_MAZE_QUEUE;
 };
 }  // namespace drt
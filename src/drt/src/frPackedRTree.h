@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2024, The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "db/infra/frBox.h"
+
+namespace drt {
+
+// Read-only R-tree that is bulk loaded once and stored in flat arrays.
+// Values are sorted along a Hilbert curve through their centers and packed
+// kNodeSize to a node, bottom up.  Queries don't modify the tree, so they are
+// safe from any number of threads.  remove() only marks the value as deleted
+// and must not run concurrently with queries.
+template <typename T>
+class PackedRTree
+{
+ public:
+  using Value = std::pair<Rect, T>;
+
+  PackedRTree() = default;
+  explicit PackedRTree(std::vector<Value> values) { build(std::move(values)); }
+
+  size_t size() const { return values_.size() - numRemoved_; }
+  bool empty() const { return size() == 0; }
+
+  // Appends every value whose box intersects (or touches) box to out.  The
+  // order only depends on the values the tree was built from.
+  template <typename OutputIterator>
+  void query(const Rect& box, OutputIterator out) const
+  {
+    visit(box, [this, &out](int pos) { *out++ = values_[pos]; });
+  }
+
+  // Returns false if the value is not in the tree.
+  bool remove(const Value& value)
+  {
+    int found = -1;
+    visit(value.first, [this, &value, &found](int pos) {
+      if (found == -1 && values_[pos] == value) {
+        found = pos;
+      }
+    });
+    if (found == -1) {
+      return false;
+    }
+    removed_[found] = true;
+    numRemoved_++;
+    return true;
+  }
+
+  template <typename Func>
+  void forEach(Func func) const
+  {
+    for (size_t i = 0; i < values_.size(); i++) {
+      if (!removed_[i]) {
+        func(values_[i]);
+      }
+    }
+  }
+
+ private:
+  static constexpr int kNodeSize = 16;
+
+  void build(std::vector<Value> values)
+  {
+    const int numValues = values.size();
+    if (numValues == 0) {
+      return;
+    }
+    Rect extent;
+    extent.mergeInit();
+    for (const auto& value : values) {
+      extent.merge(value.first);
+    }
+    std::vector<uint32_t> hilbert(numValues);
+    for (int i = 0; i < numValues; i++) {
+      hilbert[i] = getHilbertValue(values[i].first, extent);
+    }
+    std::vector<int> order(numValues);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&hilbert](int a, int b) {
+      return hilbert[a] < hilbert[b];
+    });
+    values_.reserve(numValues);
+    for (int idx : order) {
+      values_.push_back(values[idx]);
+    }
+    removed_.assign(numValues, false);
+
+    // the parents of level l - 1 make up level l
+    levelBounds_.push_back(numValues);
+    int levelBegin = 0;
+    int levelEnd = numValues;
+    while (levelEnd - levelBegin > 1) {
+      for (int pos = levelBegin; pos < levelEnd; pos += kNodeSize) {
+        Rect bbox = getBox(pos);
+        for (int child = pos + 1; child < std::min(pos + kNodeSize, levelEnd);
+             child++) {
+          bbox.merge(getBox(child));
+        }
+        nodeBoxes_.push_back(bbox);
+      }
+      levelBegin = levelEnd;
+      levelEnd = numValues + nodeBoxes_.size();
+      levelBounds_.push_back(levelEnd);
+    }
+  }
+
+  // Calls func with the position of every live value intersecting box.
+  template <typename Func>
+  void visit(const Rect& box, Func func) const
+  {
+    if (values_.empty()) {
+      return;
+    }
+    const int numValues = values_.size();
+    std::vector<std::pair<int, int>> stack;  // first child, level
+    const int rootLevel = levelBounds_.size() - 1;
+    stack.emplace_back(getLevelBegin(rootLevel), rootLevel);
+    while (!stack.empty()) {
+      const auto [begin, level] = stack.back();
+      stack.pop_back();
+      const int end = std::min(begin + kNodeSize, levelBounds_[level]);
+      for (int pos = begin; pos < end; pos++) {
+        if (!getBox(pos).intersects(box)) {
+          continue;
+        }
+        if (pos < numValues) {
+          if (!removed_[pos]) {
+            func(pos);
+          }
+        } else {
+          const int firstChild = getLevelBegin(level - 1)
+                                 + (pos - getLevelBegin(level)) * kNodeSize;
+          stack.emplace_back(firstChild, level - 1);
+        }
+      }
+    }
+  }
+
+  int getLevelBegin(int level) const
+  {
+    return level == 0 ? 0 : levelBounds_[level - 1];
+  }
+
+  const Rect& getBox(int pos) const
+  {
+    const int numValues = values_.size();
+    return pos < numValues ? values_[pos].first : nodeBoxes_[pos - numValues];
+  }
+
+  // Position of the box center along a 2^16 x 2^16 Hilbert curve over extent.
+  static uint32_t getHilbertValue(const Rect& box, const Rect& extent)
+  {
+    constexpr uint32_t kMax = (1 << 16) - 1;
+    const double width = std::max(1, extent.dx());
+    const double height = std::max(1, extent.dy());
+    uint32_t x = kMax * ((box.xCenter() - (double) extent.xMin()) / width);
+    uint32_t y = kMax * ((box.yCenter() - (double) extent.yMin()) / height);
+    uint32_t d = 0;
+    for (uint32_t s = 1 << 15; s > 0; s >>= 1) {
+      const uint32_t rx = (x & s) > 0;
+      const uint32_t ry = (y & s) > 0;
+      d += s * s * ((3 * rx) ^ ry);
+      // rotate the quadrant
+      if (ry == 0) {
+        if (rx == 1) {
+          x = kMax - x;
+          y = kMax - y;
+        }
+        std::swap(x, y);
+      }
+    }
+    return d;
+  }
+
+  std::vector<Value> values_;    // level 0, in Hilbert order
+  std::vector<Rect> nodeBoxes_;  // levels 1 and up
+  // end position of each level, counting values_ then nodeBoxes_
+  std::vector<int> levelBounds_;
+  std::vector<bool> removed_;
+  int numRemoved_ = 0;
+};
+
+}  // namespace drt
@@ -28,30 +28,44 @@
 
 #pragma once
 
+#include <optional>
+
 #ifdef HAS_VTUNE
 #include <ittnotify.h>
 #endif
 
+#include "utl/Logger.h"
+#include "utl/Profiler.h"
+
 namespace drt {
 
-#ifdef HAS_VTUNE
-// This class make a VTune task in its scope (RAII).  This is useful
-// in VTune to see where the runtime is going with more domain specific
-// display.
+// This class makes a profiling task in its scope (RAII).  It is recorded as
+// a utl::ProfileScope of DRT while the logger is profiling and in VTune when
+// built with it.  This is useful to see where the runtime is going with more
+// domain specific display.
 class ProfileTask
 {
  public:
+  // Logger whose profiler records the tasks; set by TritonRoute::init.
+  static void setLogger(utl::Logger* logger) { logger_ = logger; }
+
+  // name must outlive the task
   ProfileTask(const char* name) : done_(false)
   {
+    if (logger_ != nullptr) {
+      scope_.emplace(logger_, utl::DRT, name);
+    }
+#ifdef HAS_VTUNE
     domain_ = __itt_domain_create("TritonRoute");
-    name_ = __itt_string_handle_create(name);
-    __itt_task_begin(domain_, __itt_null, __itt_null, name_);
+    vtune_name_ = __itt_string_handle_create(name);
+    __itt_task_begin(domain_, __itt_null, __itt_null, vtune_name_);
+#endif
   }
 
   ~ProfileTask()
   {
     if (!done_) {
-      __itt_task_end(domain_);
+      end();
     }
   }
 
@@ -60,24 +74,26 @@ class ProfileTask
   void done()
   {
     done_ = true;
-    __itt_task_end(domain_);
+    end();
   }
 
  private:
-  __itt_domain* domain_;
-  __itt_string_handle* name_;
-  bool done_;
-};
+  void end()
+  {
+#ifdef HAS_VTUNE
+    __itt_task_end(domain_);
+#endif
+    scope_.reset();
+  }
 
-#else
+  static inline utl::Logger* logger_ = nullptr;
 
-// No-op version
-class ProfileTask
-{
- public:
-  ProfileTask(const char* name) {}
-  void done() {}
-};
+  std::optional<utl::ProfileScope> scope_;
+  bool done_;
+#ifdef HAS_VTUNE
+  __itt_domain* domain_;
+  __itt_string_handle* vtune_name_;
 #endif
+};
 
 }  // namespace drt
@@ -28,10 +28,13 @@
 
 #include "frRegionQuery.h"
 
+#include <omp.h>
+
 #include <boost/polygon/polygon.hpp>
 #include <iostream>
 
 #include "frDesign.h"
+#include "frPackedRTree.h"
 #include "frRTree.h"
 #include "global.h"
 #include "utl/algorithms.h"
@@ -48,12 +51,11 @@ struct frRegionQuery::Impl
   template <typename T>
   using RTreesByLayer = std::vector<RTree<T>>;
 
-  template <typename T>
-  using ObjectsByLayer = std::vector<Objects<T>>;
-
   frDesign* design_;
   Logger* logger_;
-  // only for pin shapes, obs and snet
+  // only for pin shapes, obs and snet.  The shapes known at init() are in
+  // the read-only fixedShapes_; shapes_ holds those added since.
+  std::vector<PackedRTree<frBlockObject*>> fixedShapes_;
   RTreesByLayer<frBlockObject*> shapes_;
   RTreesByLayer<frGuide*> guides_;
   RTreesByLayer<frNet*> origGuides_;  // non-processed guides;
@@ -67,6 +69,7 @@ struct frRegionQuery::Impl
 
   Impl() = default;
   void init();
+  void removeShape(frLayerNum layerNum, const Rect& box, frBlockObject* obj);
   void initOrigGuide(
       std::map<frNet*, std::vector<frRect>, frBlockObjectComp>& tmpGuides);
   void initGuide();
@@ -163,12 +166,25 @@ void frRegionQuery::removeDRObj(frShape* shape)
   }
 }
 
+void frRegionQuery::Impl::removeShape(frLayerNum layerNum,
+                                      const Rect& box,
+                                      frBlockObject* obj)
+{
+  if (!fixedShapes_.at(layerNum).remove(std::make_pair(box, obj))) {
+    shapes_.at(layerNum).remove(std::make_pair(box, obj));
+  }
+}
+
 std::vector<std::pair<frBlockObject*, Rect>> frRegionQuery::getVias(
     frLayerNum layer_num)
 {
   std::vector<std::pair<frBlockObject*, Rect>> result;
-  result.reserve(impl_->shapes_.at(layer_num).size()
+  result.reserve(impl_->fixedShapes_.at(layer_num).size()
+                 + impl_->shapes_.at(layer_num).size()
                  + impl_->drObjs_.at(layer_num).size());
+  impl_->fixedShapes_.at(layer_num).forEach([&result](const auto& value) {
+    result.emplace_back(value.second, value.first);
+  });
   for (auto [box, obj] : impl_->shapes_.at(layer_num)) {
     result.emplace_back(obj, box);
   }
@@ -262,8 +278,8 @@ void frRegionQuery::removeBlockObj(frBlockObject* obj)
           auto shape = uFig.get();
           Rect frb = shape->getBBox();
           xform.apply(frb);
-          impl_->shapes_.at(static_cast<frShape*>(shape)->getLayerNum())
-              .remove(std::make_pair(frb, instTerm));
+          impl_->removeShape(
+              static_cast<frShape*>(shape)->getLayerNum(), frb, instTerm);
         }
       }
       break;
@@ -278,8 +294,8 @@ void frRegionQuery::removeBlockObj(frBlockObject* obj)
         if (shape->typeId() == frcPathSeg || shape->typeId() == frcRect) {
           Rect frb = shape->getBBox();
           xform.apply(frb);
-          impl_->shapes_.at(static_cast<frShape*>(shape)->getLayerNum())
-              .remove(std::make_pair(frb, instBlk));
+          impl_->removeShape(
+              static_cast<frShape*>(shape)->getLayerNum(), frb, instBlk);
         } else if (shape->typeId() == frcPolygon) {
           // Decompose the polygon to rectangles and store those
           // Convert the frPolygon to a Boost polygon
@@ -302,8 +318,8 @@ void frRegionQuery::removeBlockObj(frBlockObject* obj)
           // Store the rectangles with this blockage
           for (auto& rect : rects) {
             Rect box(xl(rect), yl(rect), xh(rect), yh(rect));
-            impl_->shapes_.at(static_cast<frShape*>(shape)->getLayerNum())
-                .remove(std::make_pair(box, instBlk));
+            impl_->removeShape(
+                static_cast<frShape*>(shape)->getLayerNum(), box, instBlk);
           }
         }
       }
@@ -444,6 +460,21 @@ void frRegionQuery::removeDRObj(frVia* via)
       .remove(std::make_pair(frb, via));
 }
 
+void frRegionQuery::updateDRObjs(const ObjectsByLayer<frBlockObject>& removed,
+                                 const ObjectsByLayer<frBlockObject>& added)
+{
+  for (frLayerNum layer_num = 0; layer_num < (int) impl_->drObjs_.size();
+       layer_num++) {
+    auto& rtree = impl_->drObjs_[layer_num];
+    if (layer_num < (int) removed.size()) {
+      rtree.remove(removed[layer_num].begin(), removed[layer_num].end());
+    }
+    if (layer_num < (int) added.size()) {
+      rtree.insert(added[layer_num].begin(), added[layer_num].end());
+    }
+  }
+}
+
 void frRegionQuery::addGRObj(grVia* via)
 {
   Rect frb = via->getBBox();
@@ -580,14 +611,18 @@ void frRegionQuery::query(const box_t& boostb,
                           const frLayerNum layerNum,
                           Objects<frBlockObject>& result) const
 {
-  impl_->shapes_.at(layerNum).query(bgi::intersects(boostb),
-                                    back_inserter(result));
+  Rect box(boostb.min_corner().x(),
+           boostb.min_corner().y(),
+           boostb.max_corner().x(),
+           boostb.max_corner().y());
+  query(box, layerNum, result);
 }
 
 void frRegionQuery::query(const Rect& box,
                           const frLayerNum layerNum,
                           Objects<frBlockObject>& result) const
 {
+  impl_->fixedShapes_.at(layerNum).query(box, back_inserter(result));
   impl_->shapes_.at(layerNum).query(bgi::intersects(box),
                                     back_inserter(result));
 }
@@ -730,6 +765,8 @@ void frRegionQuery::init()
 void frRegionQuery::Impl::init()
 {
   const frLayerNum numLayers = design_->getTech()->getLayers().size();
+  fixedShapes_.clear();
+  fixedShapes_.resize(numLayers);
   shapes_.clear();
   shapes_.resize(numLayers);
 
@@ -803,10 +840,15 @@ void frRegionQuery::Impl::init()
     }
   }
 
+  // The layers are bulk loaded independently.
+  omp_set_num_threads(MAX_THREADS);
+#pragma omp parallel for schedule(dynamic)
+  for (int i = 0; i < numLayers; i++) {  // NOLINT
+    fixedShapes_[i] = PackedRTree<frBlockObject*>(std::move(allShapes[i]));
+    allShapes[i].clear();
+    allShapes[i].shrink_to_fit();
+  }
   for (auto i = 0; i < numLayers; i++) {
-    shapes_.at(i) = boost::move(RTree<frBlockObject*>(allShapes.at(i)));
-    allShapes.at(i).clear();
-    allShapes.at(i).shrink_to_fit();
     if (VERBOSE > 0) {
       logger_->info(DRT,
                     24,
@@ -975,10 +1017,12 @@ void frRegionQuery::Impl::initDRObj()
     }
   }
 
-  for (auto i = 0; i < numLayers; i++) {
-    drObjs_.at(i) = boost::move(RTree<frBlockObject*>(allShapes.at(i)));
-    allShapes.at(i).clear();
-    allShapes.at(i).shrink_to_fit();
+  omp_set_num_threads(MAX_THREADS);
+#pragma omp parallel for schedule(dynamic)
+  for (int i = 0; i < numLayers; i++) {  // NOLINT
+    drObjs_[i] = boost::move(RTree<frBlockObject*>(allShapes[i]));
+    allShapes[i].clear();
+    allShapes[i].shrink_to_fit();
   }
 }
 
@@ -1036,7 +1080,8 @@ void frRegionQuery::print()
                          33,
                          "{} shape region query size = {}.",
                          layerName,
-                         impl_->shapes_.at(i).size());
+                         impl_->fixedShapes_.at(i).size()
+                             + impl_->shapes_.at(i).size());
   }
 }
 
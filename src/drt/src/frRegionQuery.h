@@ -57,6 +57,8 @@ class frRegionQuery
  public:
   template <typename T>
   using Objects = std::vector<rq_box_value_t<T*>>;
+  template <typename T>
+  using ObjectsByLayer = std::vector<Objects<T>>;
 
   frRegionQuery(frDesign* design, Logger* logger);
   ~frRegionQuery();
@@ -114,6 +116,11 @@ class frRegionQuery
   void clearGuides();
   void removeDRObj(frShape* shape);
   void removeDRObj(frVia* via);
+  // Applies drObj updates in bulk, layer by layer with the removals of a
+  // layer before its additions.  The boxes are the ones the objects were
+  // added with, so the removed objects may already be destroyed.
+  void updateDRObjs(const ObjectsByLayer<frBlockObject>& removed,
+                    const ObjectsByLayer<frBlockObject>& added);
   void removeGRObj(grShape* shape);
   void removeGRObj(grVia* via);
   void removeMarker(frMarker* in);
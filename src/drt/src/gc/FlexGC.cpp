@@ -61,7 +61,10 @@ FlexGCWorker::Impl::Impl(frTechObject* techIn,
       ignoreMinArea_(false),
       ignoreLongSideEOL_(false),
       ignoreCornerSpacing_(false),
-      surgicalFixEnabled_(false)
+      surgicalFixEnabled_(false),
+      incremental_(false),
+      hasFullCheck_(false),
+      incrementalCheck_(false)
 {
 }
 
@@ -103,6 +106,11 @@ void FlexGCWorker::updateGCWorker()
   impl_->updateGCWorker();
 }
 
+void FlexGCWorker::setEnableIncremental(bool in)
+{
+  impl_->incremental_ = in;
+}
+
 void FlexGCWorker::end()
 {
   impl_->end();
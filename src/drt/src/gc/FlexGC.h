@@ -60,6 +60,9 @@ class FlexGCWorker
   void setIgnoreLongSideEOL();
   void setIgnoreCornerSpacing();
   void setEnableSurgicalFix(bool in);
+  // After the first full check, later full checks only re-check the nets
+  // near shapes that changed and keep the other markers.
+  void setEnableIncremental(bool in);
   void addPAObj(frConnFig* obj, frBlockObject* owner);
   // getters
   std::vector<std::unique_ptr<gcNet>>& getNets();
@@ -676,6 +676,9 @@ void FlexGCWorker::Impl::checkMetalWidthViaTable()
         continue;
       }
       for (auto& net : getNets()) {
+        if (skipIncrementalNet(net.get())) {
+          continue;
+        }
         // There is no need to check vias in nets we don't route
         auto fr_net = net->getFrNet();
         if (fr_net && (fr_net->isSpecial() || fr_net->getType().isSupply())) {
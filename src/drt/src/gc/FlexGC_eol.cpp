@@ -1361,6 +1361,9 @@ void FlexGCWorker::Impl::checkMetalEndOfLine()
         continue;
       }
       for (auto& net : getNets()) {
+        if (skipIncrementalNet(net.get())) {
+          continue;
+        }
         for (auto& pin : net->getPins(i)) {
           checkMetalEndOfLine_main(pin.get());
         }
@@ -168,8 +168,36 @@ class FlexGCWorker::Impl
   bool ignoreCornerSpacing_;
   bool surgicalFixEnabled_;
 
+  // incremental check
+  bool incremental_;
+  bool hasFullCheck_;
+  bool incrementalCheck_;  // the running check only covers recheckNets_
+  std::vector<std::unique_ptr<frMarker>> fullCheckMarkers_;
+  std::vector<Rect> dirtyRects_;  // changed shapes since the last full check
+  std::vector<Rect> haloRects_;   // dirtyRects_ bloated by the DRC distance
+  std::set<const gcNet*> recheckNets_;
+
+  // scratch buffers for the batched spacing prefilter, kept as separate
+  // coordinate arrays so the distance loop vectorizes
+  struct SpcCandidates
+  {
+    std::vector<frCoord> xl, yl, xh, yh;
+    std::vector<char> keep;
+  };
+  SpcCandidates spcCandidates_;
+
   FlexGCWorkerRegionQuery& getWorkerRegionQuery() { return rq_; }
 
+  // incremental check
+  void addDirtyNet(const gcNet* net);
+  bool initIncrementalCheck();
+  void addIncrementalMarkers();
+  void endFullCheck();
+  bool skipIncrementalNet(const gcNet* net) const
+  {
+    return incrementalCheck_ && recheckNets_.find(net) == recheckNets_.end();
+  }
+
   void modifyMarkers();
   // init
   gcNet* getNet(frBlockObject* obj);
@@ -227,12 +255,20 @@ class FlexGCWorker::Impl
   void checkMetalSpacing_wrongDir(gcPin* pin, frLayer* layer);
   frCoord checkMetalSpacing_getMaxSpcVal(frLayerNum layerNum,
                                          bool checkNDRs = true);
+  frCoord checkMetalSpacing_getMaxReqSpcVal(frLayerNum layerNum,
+                                            bool checkNDRs);
+  void checkMetalSpacing_filterByDist(
+      const gcRect* rect,
+      frCoord maxReqSpcVal,
+      std::vector<rq_box_value_t<gcRect*>>& result);
   void myBloat(const gtl::rectangle_data<frCoord>& rect,
                frCoord val,
                box_t& box);
   bool hasRoute(gcRect* rect, gtl::rectangle_data<frCoord> markerRect);
+  // maxReqSpcVal is checkMetalSpacing_getMaxReqSpcVal of the rect layer
   void checkMetalSpacing_main(gcRect* rect,
-                              bool checkNDRs = true,
+                              frCoord maxReqSpcVal,
+                              bool checkNDRs,
                               bool isSpcRect = false);
   void checkMetalSpacing_main(gcRect* rect1,
                               gcRect* rect2,
@@ -247,6 +247,9 @@ void FlexGCWorker::Impl::checkMetalSpacingTableInfluence()
         continue;
       }
       for (auto& uNet : getNets()) {
+        if (skipIncrementalNet(uNet.get())) {
+          continue;
+        }
         for (auto& pin : uNet->getPins(i)) {
           checkPinMetSpcTblInf(pin.get());
         }
@@ -936,6 +936,8 @@ void FlexGCWorker::Impl::init(const frDesign* design)
   }
   initNets();
   initRegionQuery();
+  hasFullCheck_ = false;
+  dirtyRects_.clear();
 }
 
 // init initializes all nets from frDesign if no drWorker is provided
@@ -977,6 +979,7 @@ void FlexGCWorker::Impl::updateGCWorker()
   // start init from dr objs
   for (auto fnet : fnets) {
     auto net = owner2nets_[fnet];
+    addDirtyNet(net);
     getWorkerRegionQuery().removeFromRegionQuery(
         net);      // delete all region queries
     net->clear();  // delete all pins and routeXXX
@@ -1013,6 +1016,7 @@ void FlexGCWorker::Impl::updateGCWorker()
     // init gc net
     initNet(net);
     getWorkerRegionQuery().addToRegionQuery(net);
+    addDirtyNet(net);
   }
 }
 
@@ -844,7 +844,86 @@ void FlexGCWorker::Impl::checkMetalSpacing_main(gcRect* rect1,
   }
 }
 
+// Upper bound of checkMetalSpacing_prl_getReqSpcVal (plus NDR spacing) over
+// all rect pairs on the layer.  Pairs at least this far apart cannot
+// produce a spacing marker.
+frCoord FlexGCWorker::Impl::checkMetalSpacing_getMaxReqSpcVal(
+    frLayerNum layerNum,
+    bool checkNDRs)
+{
+  auto currLayer = getTech()->getLayer(layerNum);
+  frCoord maxReqSpcVal = checkMetalSpacing_getMaxSpcVal(layerNum, false);
+  if (currLayer->hasSpacingSamenet()) {
+    maxReqSpcVal = std::max(maxReqSpcVal,
+                            currLayer->getSpacingSamenet()->getMinSpacing());
+  }
+  for (const auto& con : currLayer->getSpacingRangeConstraints()) {
+    maxReqSpcVal = std::max(maxReqSpcVal, con->getMinSpacing());
+  }
+  if (checkNDRs) {
+    maxReqSpcVal = std::max(
+        maxReqSpcVal, getTech()->getMaxNondefaultSpacing(layerNum / 2 - 1));
+  }
+  return maxReqSpcVal;
+}
+
+// Drops the query results that are too far (euclidean) from rect to be
+// shorts or spacing violations.  The query box is a bloated rectangle, so
+// its corners hold candidates that checkMetalSpacing_main would reject
+// anyway after the boost distance computation.  The order of the kept
+// results is preserved.
+void FlexGCWorker::Impl::checkMetalSpacing_filterByDist(
+    const gcRect* rect,
+    frCoord maxReqSpcVal,
+    std::vector<rq_box_value_t<gcRect*>>& result)
+{
+  const int size = result.size();
+  auto& cands = spcCandidates_;
+  cands.xl.resize(size);
+  cands.yl.resize(size);
+  cands.xh.resize(size);
+  cands.yh.resize(size);
+  cands.keep.resize(size);
+  for (int i = 0; i < size; i++) {
+    const gcRect* ptr = result[i].second;
+    cands.xl[i] = gtl::xl(*ptr);
+    cands.yl[i] = gtl::yl(*ptr);
+    cands.xh[i] = gtl::xh(*ptr);
+    cands.yh[i] = gtl::yh(*ptr);
+  }
+
+  const frCoord xl = gtl::xl(*rect);
+  const frCoord yl = gtl::yl(*rect);
+  const frCoord xh = gtl::xh(*rect);
+  const frCoord yh = gtl::yh(*rect);
+  const frSquaredDistance reqSpcValSquare
+      = maxReqSpcVal * (frSquaredDistance) maxReqSpcVal;
+  const frCoord* cxl = cands.xl.data();
+  const frCoord* cyl = cands.yl.data();
+  const frCoord* cxh = cands.xh.data();
+  const frCoord* cyh = cands.yh.data();
+  char* keep = cands.keep.data();
+  // branch free so the compiler can vectorize it
+  for (int i = 0; i < size; i++) {
+    const frCoord distX = std::max(std::max(cxl[i] - xh, xl - cxh[i]), 0);
+    const frCoord distY = std::max(std::max(cyl[i] - yh, yl - cyh[i]), 0);
+    const frSquaredDistance distSquare
+        = distX * (frSquaredDistance) distX + distY * (frSquaredDistance) distY;
+    // touching or overlapping rects are always kept for the short check
+    keep[i] = (distSquare < reqSpcValSquare) | (distSquare == 0);
+  }
+
+  int cnt = 0;
+  for (int i = 0; i < size; i++) {
+    if (keep[i]) {
+      result[cnt++] = result[i];
+    }
+  }
+  result.resize(cnt);
+}
+
 void FlexGCWorker::Impl::checkMetalSpacing_main(gcRect* rect,
+                                                const frCoord maxReqSpcVal,
                                                 bool checkNDRs,
                                                 bool isSpcRect)
 {
@@ -870,6 +949,7 @@ void FlexGCWorker::Impl::checkMetalSpacing_main(gcRect* rect,
       checkMetalSpacing_main(rect, &ptr, checkNDRs, isSpcRect);
     }
   }
+  checkMetalSpacing_filterByDist(rect, maxReqSpcVal, result);
   // Short, metSpc, NSMetal here
   for (auto& [objBox, ptr] : result) {
     checkMetalSpacing_main(rect, ptr, checkNDRs, isSpcRect);
@@ -889,13 +969,15 @@ void FlexGCWorker::Impl::checkMetalSpacing()
       if (currLayer->getType() != dbTechLayerType::ROUTING) {
         continue;
       }
+      const bool checkNDRs = getDRWorker() || !AUTO_TAPER_NDR_NETS;
+      const frCoord maxReqSpcVal
+          = checkMetalSpacing_getMaxReqSpcVal(i, checkNDRs);
       for (auto& pin : targetNet_->getPins(i)) {
         if (currLayer->hasLef58SpacingWrongDirConstraints()) {
           checkMetalSpacing_wrongDir(pin.get(), currLayer);
         }
         for (auto& maxrect : pin->getMaxRectangles()) {
-          checkMetalSpacing_main(maxrect.get(),
-                                 getDRWorker() || !AUTO_TAPER_NDR_NETS);
+          checkMetalSpacing_main(maxrect.get(), maxReqSpcVal, checkNDRs);
           if (currLayer->hasTwoWiresForbiddenSpacingConstraints()) {
             for (auto con :
                  currLayer->getTwoWiresForbiddenSpacingConstraints()) {
@@ -909,9 +991,13 @@ void FlexGCWorker::Impl::checkMetalSpacing()
           }
         }
       }
+      // special spacing rects may be on another layer
       for (auto& sr : targetNet_->getSpecialSpcRects()) {
         checkMetalSpacing_main(
-            sr.get(), getDRWorker() || !AUTO_TAPER_NDR_NETS, true);
+            sr.get(),
+            checkMetalSpacing_getMaxReqSpcVal(sr->getLayerNum(), checkNDRs),
+            checkNDRs,
+            true);
       }
     }
   } else {
@@ -925,15 +1011,20 @@ void FlexGCWorker::Impl::checkMetalSpacing()
       if (currLayer->getType() != dbTechLayerType::ROUTING) {
         continue;
       }
+      const bool checkNDRs = getDRWorker() || !AUTO_TAPER_NDR_NETS;
+      const frCoord maxReqSpcVal
+          = checkMetalSpacing_getMaxReqSpcVal(i, checkNDRs);
       for (auto& net : getNets()) {
+        if (skipIncrementalNet(net.get())) {
+          continue;
+        }
         for (auto& pin : net->getPins(i)) {
           if (currLayer->hasLef58SpacingWrongDirConstraints()) {
             checkMetalSpacing_wrongDir(pin.get(), currLayer);
           }
           for (auto& maxrect : pin->getMaxRectangles()) {
             // Short, NSMetal, metSpc
-            checkMetalSpacing_main(maxrect.get(),
-                                   getDRWorker() || !AUTO_TAPER_NDR_NETS);
+            checkMetalSpacing_main(maxrect.get(), maxReqSpcVal, checkNDRs);
             if (currLayer->hasTwoWiresForbiddenSpacingConstraints()) {
               for (auto con :
                    currLayer->getTwoWiresForbiddenSpacingConstraints()) {
@@ -947,9 +1038,13 @@ void FlexGCWorker::Impl::checkMetalSpacing()
             }
           }
         }
+        // special spacing rects may be on another layer
         for (auto& sr : net->getSpecialSpcRects()) {
           checkMetalSpacing_main(
-              sr.get(), getDRWorker() || !AUTO_TAPER_NDR_NETS, true);
+              sr.get(),
+              checkMetalSpacing_getMaxReqSpcVal(sr->getLayerNum(), checkNDRs),
+              checkNDRs,
+              true);
         }
       }
     }
@@ -1387,6 +1482,9 @@ void FlexGCWorker::Impl::checkMetalCornerSpacing()
         continue;
       }
       for (auto& net : getNets()) {
+        if (skipIncrementalNet(net.get())) {
+          continue;
+        }
         for (auto& pin : net->getPins(i)) {
           for (auto& corners : pin->getPolygonCorners()) {
             for (auto& corner : corners) {
@@ -2328,6 +2426,9 @@ void FlexGCWorker::Impl::checkMetalShape(bool allow_patching)
         continue;
       }
       for (auto& net : getNets()) {
+        if (skipIncrementalNet(net.get())) {
+          continue;
+        }
         for (auto& pin : net->getPins(i)) {
           checkMetalShape_main(pin.get(), allow_patching);
         }
@@ -3554,6 +3655,9 @@ void FlexGCWorker::Impl::checkCutSpacing()
         continue;
       }
       for (auto& net : getNets()) {
+        if (skipIncrementalNet(net.get())) {
+          continue;
+        }
         for (auto& pin : net->getPins(i)) {
           for (auto& maxrect : pin->getMaxRectangles()) {
             checkCutSpacing_main(maxrect.get());
@@ -3942,6 +4046,9 @@ void FlexGCWorker::Impl::checkMinimumCut()
         continue;
       }
       for (auto& net : getNets()) {
+        if (skipIncrementalNet(net.get())) {
+          continue;
+        }
         for (auto& pin : net->getPins(i)) {
           for (auto& maxrect : pin->getMaxRectangles()) {
             checkMinimumCut_main(maxrect.get());
@@ -4083,6 +4190,90 @@ void FlexGCWorker::Impl::modifyMarkers()
   }
 }
 
+void FlexGCWorker::Impl::addDirtyNet(const gcNet* net)
+{
+  if (!incremental_ || !hasFullCheck_) {
+    return;
+  }
+  for (const auto& layerPins : net->getPins()) {
+    Rect bbox;
+    bbox.mergeInit();
+    for (const auto& pin : layerPins) {
+      for (const auto& maxrect : pin->getMaxRectangles()) {
+        bbox.merge(Rect(gtl::xl(*maxrect),
+                        gtl::yl(*maxrect),
+                        gtl::xh(*maxrect),
+                        gtl::yh(*maxrect)));
+      }
+    }
+    if (bbox.xMin() <= bbox.xMax()) {
+      dirtyRects_.push_back(bbox);
+    }
+  }
+}
+
+// Returns false if this check has to cover the whole worker.
+bool FlexGCWorker::Impl::initIncrementalCheck()
+{
+  recheckNets_.clear();
+  haloRects_.clear();
+  if (targetNet_ || !incremental_ || !hasFullCheck_) {
+    return false;
+  }
+  // Markers in the halo of a change are recomputed.  Their sources may reach
+  // one more halo out, so every net with a shape there is checked again.
+  std::vector<rq_box_value_t<gcRect*>> result;
+  for (const Rect& dirtyRect : dirtyRects_) {
+    Rect haloRect;
+    dirtyRect.bloat(DRCSAFEDIST, haloRect);
+    haloRects_.push_back(haloRect);
+    Rect queryRect;
+    haloRect.bloat(DRCSAFEDIST, queryRect);
+    for (frLayerNum lNum = getMinLayerNum(); lNum <= getMaxLayerNum();
+         lNum++) {
+      result.clear();
+      getWorkerRegionQuery().queryMaxRectangle(queryRect, lNum, result);
+      for (auto& [box, rect] : result) {
+        recheckNets_.insert(rect->getNet());
+      }
+    }
+  }
+  return true;
+}
+
+// Carries over the markers of the last full check that are away from any
+// change.
+void FlexGCWorker::Impl::addIncrementalMarkers()
+{
+  for (const auto& marker : fullCheckMarkers_) {
+    const Rect bbox = marker->getBBox();
+    bool inHalo = false;
+    for (const Rect& haloRect : haloRects_) {
+      if (haloRect.intersects(bbox)) {
+        inHalo = true;
+        break;
+      }
+    }
+    if (!inHalo) {
+      addMarker(std::make_unique<frMarker>(*marker));
+    }
+  }
+}
+
+void FlexGCWorker::Impl::endFullCheck()
+{
+  incrementalCheck_ = false;
+  if (!incremental_ || targetNet_) {
+    return;
+  }
+  fullCheckMarkers_.clear();
+  for (const auto& marker : markers_) {
+    fullCheckMarkers_.push_back(std::make_unique<frMarker>(*marker));
+  }
+  dirtyRects_.clear();
+  hasFullCheck_ = true;
+}
+
 int FlexGCWorker::Impl::main()
 {
   // incremental updates
@@ -4101,8 +4292,12 @@ int FlexGCWorker::Impl::main()
       updateGCWorker();
     }
   }
+  incrementalCheck_ = initIncrementalCheck();
   // clear existing markers
   clearMarkers();
+  if (incrementalCheck_) {
+    addIncrementalMarkers();
+  }
   // check LEF58CornerSpacing
   checkMetalCornerSpacing();
   // check Short, NSMet, MetSpc based on max rectangles
@@ -4119,6 +4314,7 @@ int FlexGCWorker::Impl::main()
   checkMinimumCut();
   // check LEF58_METALWIDTHVIATABLE
   checkMetalWidthViaTable();
+  endFullCheck();
   // modify markers for pwires
   modifyMarkers();
   return 0;
@@ -70,6 +70,19 @@ bool CLEAN_PATCHES = false;
 bool DO_PA = true;
 bool SINGLE_STEP_DR = false;
 bool SAVE_GUIDE_UPDATES = false;
+bool DR_TASK_SCHEDULER = false;
+bool DR_INCREMENTAL_GC = false;
+bool PA_CACHE = false;
+bool RP_CACHE = false;
+bool DR_RADIX_MAZE_QUEUE = false;
+bool TA_SUBPANELS = false;
+bool DIST_SHARED_MEMORY = false;
+bool OVERLAP_DR_INIT = false;
+bool PROFILE = false;
+std::string PROFILE_TRACE_FILE;
+std::string CHECKPOINT_FILE;
+int CHECKPOINT_ITER = 0;
+bool RESUME_DR = false;
 
 std::string VIAINPIN_BOTTOMLAYER_NAME;
 std::string VIAINPIN_TOPLAYER_NAME;
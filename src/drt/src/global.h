@@ -73,6 +73,19 @@ extern bool CLEAN_PATCHES;
 extern bool DO_PA;
 extern bool SINGLE_STEP_DR;
 extern bool SAVE_GUIDE_UPDATES;
+extern bool DR_TASK_SCHEDULER;
+extern bool DR_INCREMENTAL_GC;
+extern bool PA_CACHE;
+extern bool RP_CACHE;
+extern bool DR_RADIX_MAZE_QUEUE;
+extern bool TA_SUBPANELS;
+extern bool DIST_SHARED_MEMORY;
+extern bool OVERLAP_DR_INIT;
+extern bool PROFILE;
+extern std::string PROFILE_TRACE_FILE;
+extern std::string CHECKPOINT_FILE;
+extern int CHECKPOINT_ITER;
+extern bool RESUME_DR;
 extern std::string VIAINPIN_BOTTOMLAYER_NAME;
 extern std::string VIAINPIN_TOPLAYER_NAME;
 extern frLayerNum VIAINPIN_BOTTOMLAYERNUM;
@@ -32,10 +32,18 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "GuideProcessor.h"
 
+#include <omp.h>
+
 #include "frProfileTask.h"
+#include "odb/dbGuideStore.h"
+#include "utl/exception.h"
 namespace drt::io {
 using Interval = boost::icl::interval<frCoord>;
+using utl::ThreadException;
 namespace {
+// Messages of the net that the thread is processing in processGuides.
+thread_local std::vector<std::function<void()>>* net_messages = nullptr;
+
 /**
  * @brief Returns the closest point on the perimeter of the rectangle r to the
  * point p
@@ -408,7 +416,7 @@ void logGuidesRead(const int num_guides, utl::Logger* logger)
 /**
  * @brief Checks the validity of the odb guide layer
  *
- * The db_guide layer is invalid if it is any of the following conditions:
+ * The guide layer is invalid if it is any of the following conditions:
  * - Not in the DRT layer database
  * - Above the sepecified top routing layer
  * - Below the specified bottom routing layer and the via access layer
@@ -421,16 +429,15 @@ void logGuidesRead(const int num_guides, utl::Logger* logger)
  * @returns True if the guide is valid by the previous criteria and False
  * if above top routing layer for a net with bterms above top routing layer
  */
-bool isValidGuideLayerNum(odb::dbGuide* db_guide,
+bool isValidGuideLayerNum(odb::dbTechLayer* db_layer,
                           frTechObject* tech,
                           frNet* net,
                           utl::Logger* logger,
                           frLayerNum& layer_num)
 {
-  frLayer* layer = tech->getLayer(db_guide->getLayer()->getName());
+  frLayer* layer = tech->getLayer(db_layer->getName());
   if (layer == nullptr) {
-    logger->error(
-        DRT, 154, "Cannot find layer {}.", db_guide->getLayer()->getName());
+    logger->error(DRT, 154, "Cannot find layer {}.", db_layer->getName());
   }
   layer_num = layer->getLayerNum();
 
@@ -625,22 +632,34 @@ bool GuideProcessor::readGuides()
   ProfileTask profile("IO:readGuide");
   int num_guides = 0;
   const auto block = db_->getChip()->getBlock();
+  // Guides saved by global_route in this session are still packed in the
+  // guide store; reading them there avoids making dbGuides of them.
+  const odb::dbGuideStore* store = block->getGuideStore();
+  auto addGuide = [&](frNet* net, odb::dbTechLayer* layer, const Rect& box) {
+    frLayerNum layer_num;
+    if (!isValidGuideLayerNum(layer, getTech(), net, logger_, layer_num)) {
+      return;
+    }
+    frRect rect;
+    rect.setBBox(box);
+    rect.setLayerNum(layer_num);
+    tmp_guides_[net].emplace_back(rect);
+    ++num_guides;
+    logGuidesRead(num_guides, logger_);
+  };
   for (const auto db_net : block->getNets()) {
     frNet* net = getDesign()->getTopBlock()->findNet(db_net->getName());
     if (net == nullptr) {
       logger_->error(DRT, 153, "Cannot find net {}.", db_net->getName());
     }
-    for (auto db_guide : db_net->getGuides()) {
-      frLayerNum layer_num;
-      if (!isValidGuideLayerNum(db_guide, getTech(), net, logger_, layer_num)) {
-        continue;
+    if (store->hasGuides(db_net)) {
+      for (const auto& guide : store->getGuides(db_net)) {
+        addGuide(net, store->getLayer(guide), store->getBox(guide));
       }
-      frRect rect;
-      rect.setBBox(db_guide->getBox());
-      rect.setLayerNum(layer_num);
-      tmp_guides_[net].emplace_back(rect);
-      ++num_guides;
-      logGuidesRead(num_guides, logger_);
+      continue;
+    }
+    for (auto db_guide : db_net->getGuides()) {
+      addGuide(net, db_guide->getLayer(), db_guide->getBox());
     }
   }
   if (VERBOSE > 0) {
@@ -901,11 +920,13 @@ void GuideProcessor::patchGuides(frNet* net,
   // the guides
 
   const std::string name = getPinName(pin);
-  logger_->info(DRT,
-                1000,
-                "Pin {} not in any guide. Attempting to patch guides to cover "
-                "(at least part of) the pin.",
-                name);
+  logNetMessage([this, name] {
+    logger_->info(DRT,
+                  1000,
+                  "Pin {} not in any guide. Attempting to patch guides to "
+                  "cover (at least part of) the pin.",
+                  name);
+  });
   std::set<int> candidate_guides_indices;
   const Point3D best_pin_loc_idx
       = findBestPinLocation(getDesign(), pin, guides, candidate_guides_indices);
@@ -914,7 +935,9 @@ void GuideProcessor::patchGuides(frNet* net,
       getDesign()->getTopBlock()->getGCellCenter(best_pin_loc_idx),
       best_pin_loc_idx.z());
   if (candidate_guides_indices.empty()) {
-    logger_->warn(DRT, 1001, "No guide in the pin neighborhood");
+    logNetMessage([this] {
+      logger_->warn(DRT, 1001, "No guide in the pin neighborhood");
+    });
     return;
   }
   // get the guide that is closest to the gCell
@@ -1149,11 +1172,13 @@ void GuideProcessor::genGuides_gCell2TermMap(
               frString name = (origTerm->typeId() == frcInstTerm)
                                   ? ((frInstTerm*) origTerm)->getName()
                                   : term->getName();
-              logger_->warn(DRT,
-                            230,
-                            "genGuides_gCell2TermMap avoid condition2, may "
-                            "result in guide open: {}.",
-                            name);
+              logNetMessage([this, name] {
+                logger_->warn(DRT,
+                              230,
+                              "genGuides_gCell2TermMap avoid condition2, may "
+                              "result in guide open: {}.",
+                              name);
+              });
             }
           } else if (condition3
                      && ((x == tmpIdx.x() - 1
@@ -1165,11 +1190,13 @@ void GuideProcessor::genGuides_gCell2TermMap(
               frString name = (origTerm->typeId() == frcInstTerm)
                                   ? ((frInstTerm*) origTerm)->getName()
                                   : term->getName();
-              logger_->warn(DRT,
-                            231,
-                            "genGuides_gCell2TermMap avoid condition3, may "
-                            "result in guide open: {}.",
-                            name);
+              logNetMessage([this, name] {
+                logger_->warn(DRT,
+                              231,
+                              "genGuides_gCell2TermMap avoid condition3, may "
+                              "result in guide open: {}.",
+                              name);
+              });
             }
           } else {
             gCell2PinMap[std::make_pair(Point(x, y), lNum)].insert(origTerm);
@@ -1369,7 +1396,10 @@ void GuideProcessor::genGuides_addCoverGuide_helper(frInstTerm* term,
   }
 }
 
-void GuideProcessor::genGuides(frNet* net, std::vector<frRect>& rects)
+void GuideProcessor::genGuides(
+    frNet* net,
+    std::vector<frRect>& rects,
+    std::vector<std::pair<frBlockObject*, Point>>& grPins)
 {
   net->clearGuides();
 
@@ -1407,7 +1437,8 @@ void GuideProcessor::genGuides(frNet* net, std::vector<frRect>& rects)
     // filter pin2GCellMap with aps
 
     if (pin2GCellMap.empty()) {
-      logger_->warn(DRT, 214, "genGuides empty pin2GCellMap.");
+      logNetMessage(
+          [this] { logger_->warn(DRT, 214, "genGuides empty pin2GCellMap."); });
       debugPrint(
           logger_, DRT, "io", 1, "gcell2pin.size() = {}", gCell2PinMap.size());
     }
@@ -1416,21 +1447,26 @@ void GuideProcessor::genGuides(frNet* net, std::vector<frRect>& rects)
         switch (obj->typeId()) {
           case frcInstTerm: {
             auto ptr = static_cast<frInstTerm*>(obj);
-            logger_->warn(DRT,
-                          215,
-                          "Pin {}/{} not covered by guide.",
-                          ptr->getInst()->getName(),
-                          ptr->getTerm()->getName());
+            logNetMessage([this, ptr] {
+              logger_->warn(DRT,
+                            215,
+                            "Pin {}/{} not covered by guide.",
+                            ptr->getInst()->getName(),
+                            ptr->getTerm()->getName());
+            });
             break;
           }
           case frcBTerm: {
             auto ptr = static_cast<frBTerm*>(obj);
-            logger_->warn(
-                DRT, 216, "Pin PIN/{} not covered by guide.", ptr->getName());
+            logNetMessage([this, ptr] {
+              logger_->warn(
+                  DRT, 216, "Pin PIN/{} not covered by guide.", ptr->getName());
+            });
             break;
           }
           default: {
-            logger_->warn(DRT, 217, "genGuides unknown type.");
+            logNetMessage(
+                [this] { logger_->warn(DRT, 217, "genGuides unknown type."); });
             break;
           }
         }
@@ -1450,7 +1486,14 @@ void GuideProcessor::genGuides(frNet* net, std::vector<frRect>& rects)
             net, adjVisited, adjPrevIdx, nodeMap, gCnt, nCnt, false, retry)) {
       // std::cout <<"astar done" <<std::endl <<std::flush;
       genGuides_final(
-          net, rects, adjVisited, adjPrevIdx, gCnt, nCnt, pin2GCellMap);
+          net,
+          rects,
+          adjVisited,
+          adjPrevIdx,
+          gCnt,
+          nCnt,
+          pin2GCellMap,
+          grPins);
       break;
     }
     if (retry) {
@@ -1464,7 +1507,14 @@ void GuideProcessor::genGuides(frNet* net, std::vector<frRect>& rects)
                             true,
                             retry)) {
           genGuides_final(
-              net, rects, adjVisited, adjPrevIdx, gCnt, nCnt, pin2GCellMap);
+              net,
+              rects,
+              adjVisited,
+              adjPrevIdx,
+              gCnt,
+              nCnt,
+              pin2GCellMap,
+              grPins);
           break;
         }
         logger_->error(DRT, 218, "Guide is not connected to design.");
@@ -1486,7 +1536,8 @@ void GuideProcessor::genGuides_final(
     int nCnt,
     std::map<frBlockObject*,
              std::set<std::pair<Point, frLayerNum>>,
-             frBlockObjectComp>& pin2GCellMap)
+             frBlockObjectComp>& pin2GCellMap,
+    std::vector<std::pair<frBlockObject*, Point>>& grPins)
 {
   std::vector<frBlockObject*> pin2ptr;
   pin2ptr.reserve(pin2GCellMap.size());
@@ -1516,8 +1567,10 @@ void GuideProcessor::genGuides_final(
                  != pin2GCellMap[obj].end()) {
         pinIdx2GCellUpdated[pinIdx].push_back(std::make_pair(box.ur(), lNum));
       } else {
-        logger_->warn(
-            DRT, 220, "genGuides_final net {} error 1.", net->getName());
+        logNetMessage([this, net] {
+          logger_->warn(
+              DRT, 220, "genGuides_final net {} error 1.", net->getName());
+        });
       }
       guideIdx2Pins[guideIdx].push_back(pinIdx);
     } else if (i >= gCnt && adjPrevIdx[i] >= 0 && adjPrevIdx[i] < gCnt) {
@@ -1535,18 +1588,22 @@ void GuideProcessor::genGuides_final(
                  != pin2GCellMap[obj].end()) {
         pinIdx2GCellUpdated[pinIdx].push_back(std::make_pair(box.ur(), lNum));
       } else {
-        logger_->warn(
-            DRT, 221, "genGuides_final net {} error 2.", net->getName());
+        logNetMessage([this, net] {
+          logger_->warn(
+              DRT, 221, "genGuides_final net {} error 2.", net->getName());
+        });
       }
       guideIdx2Pins[guideIdx].push_back(pinIdx);
     }
   }
   for (auto& guides : pinIdx2GCellUpdated) {
     if (guides.empty()) {
-      logger_->warn(DRT,
-                    222,
-                    "genGuides_final net {} pin not in any guide.",
-                    net->getName());
+      logNetMessage([this, net] {
+        logger_->warn(DRT,
+                      222,
+                      "genGuides_final net {} pin not in any guide.",
+                      net->getName());
+      });
     }
   }
 
@@ -1556,7 +1613,7 @@ void GuideProcessor::genGuides_final(
     auto obj = pin2ptr[i];
     for (auto& [pt, lNum] : pinIdx2GCellUpdated[i]) {
       Point absPt = getDesign()->getTopBlock()->getGCellCenter(pt);
-      tmpGRPins_.emplace_back(obj, absPt);
+      grPins.emplace_back(obj, absPt);
       updatedNodeMap[std::make_pair(pt, lNum)].insert(i + gCnt);
     }
   }
@@ -1802,21 +1859,25 @@ bool GuideProcessor::genGuides_astar(
   // true error when allowing feedthrough
   if (pinVisited != nCnt - gCnt
       && (ALLOW_PIN_AS_FEEDTHROUGH || forceFeedThrough) && retry) {
-    logger_->warn(DRT,
-                  224,
-                  "{} {} pin not visited, number of guides = {}.",
-                  net->getName(),
-                  nCnt - gCnt - pinVisited,
-                  gCnt);
+    logNetMessage([this, net, unvisited = nCnt - gCnt - pinVisited, gCnt] {
+      logger_->warn(DRT,
+                    224,
+                    "{} {} pin not visited, number of guides = {}.",
+                    net->getName(),
+                    unvisited,
+                    gCnt);
+    });
   }
   // fallback to feedthrough in next iter
   if (pinVisited != nCnt - gCnt && !ALLOW_PIN_AS_FEEDTHROUGH
       && !forceFeedThrough && retry) {
-    logger_->warn(DRT,
-                  225,
-                  "{} {} pin not visited, fall back to feedthrough mode.",
-                  net->getName(),
-                  nCnt - gCnt - pinVisited);
+    logNetMessage([this, net, unvisited = nCnt - gCnt - pinVisited] {
+      logger_->warn(DRT,
+                    225,
+                    "{} {} pin not visited, fall back to feedthrough mode.",
+                    net->getName(),
+                    unvisited);
+    });
   }
   if (pinVisited == nCnt - gCnt) {
     return true;
@@ -1866,6 +1927,15 @@ void GuideProcessor::saveGuidesUpdates()
   }
 }
 
+void GuideProcessor::logNetMessage(std::function<void()> msg) const
+{
+  if (net_messages != nullptr) {
+    net_messages->push_back(std::move(msg));
+  } else {
+    msg();
+  }
+}
+
 void GuideProcessor::processGuides()
 {
   if (tmp_guides_.empty()) {
@@ -1878,23 +1948,58 @@ void GuideProcessor::processGuides()
   buildGCellPatterns();
 
   getDesign()->getRegionQuery()->initOrigGuide(tmp_guides_);
-  int cnt = 0;
+  // Nets only touch their own guides, so they are processed in parallel.  The
+  // gr pins are collected per net and merged in net order afterwards to keep
+  // the result independent of the thread count.  So are the messages about
+  // the nets.
+  std::vector<std::pair<frNet*, std::vector<frRect>*>> nets;
+  nets.reserve(tmp_guides_.size());
   for (auto& [net, rects] : tmp_guides_) {
-    net->setOrigGuides(rects);
-    genGuides(net, rects);
-    cnt++;
-    if (VERBOSE > 0) {
-      if (cnt < 1000000) {
-        if (cnt % 100000 == 0) {
-          logger_->report("  complete {} nets.", cnt);
-        }
-      } else {
-        if (cnt % 1000000 == 0) {
-          logger_->report("  complete {} nets.", cnt);
+    nets.emplace_back(net, &rects);
+  }
+  std::vector<std::vector<std::pair<frBlockObject*, Point>>> netGRPins(
+      nets.size());
+  std::vector<std::vector<std::function<void()>>> netMessages(nets.size());
+  int cnt = 0;
+  omp_set_num_threads(MAX_THREADS);
+  ThreadException exception;
+#pragma omp parallel for schedule(dynamic)
+  for (int i = 0; i < (int) nets.size(); i++) {  // NOLINT
+    try {
+      auto [net, rects] = nets[i];
+      net->setOrigGuides(*rects);
+      net_messages = &netMessages[i];
+      genGuides(net, *rects, netGRPins[i]);
+      net_messages = nullptr;
+#pragma omp critical
+      {
+        cnt++;
+        if (VERBOSE > 0) {
+          if (cnt < 1000000) {
+            if (cnt % 100000 == 0) {
+              logger_->report("  complete {} nets.", cnt);
+            }
+          } else {
+            if (cnt % 1000000 == 0) {
+              logger_->report("  complete {} nets.", cnt);
+            }
+          }
         }
       }
+    } catch (...) {
+      net_messages = nullptr;
+      exception.capture();
     }
   }
+  for (auto& messages : netMessages) {
+    for (auto& msg : messages) {
+      msg();
+    }
+  }
+  exception.rethrow();
+  for (auto& grPins : netGRPins) {
+    tmpGRPins_.insert(tmpGRPins_.end(), grPins.begin(), grPins.end());
+  }
 
   // global unique id for guides
   int currId = 0;
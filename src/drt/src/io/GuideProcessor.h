@@ -32,6 +32,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 #pragma once
 #include <boost/icl/interval_set.hpp>
+#include <functional>
 
 #include "db/tech/frTechObject.h"
 #include "frDesign.h"
@@ -73,7 +74,13 @@ class GuideProcessor
                                  frCoord& GCELLOFFSETX,
                                  frCoord& GCELLOFFSETY);
 
-  void genGuides(frNet* net, std::vector<frRect>& rects);
+  // Runs msg, a logger call about the net being processed, right away or,
+  // inside the parallel loop of processGuides, after all nets are done.
+  void logNetMessage(std::function<void()> msg) const;
+  // Appends the global routing pin locations of net to grPins
+  void genGuides(frNet* net,
+                 std::vector<frRect>& rects,
+                 std::vector<std::pair<frBlockObject*, Point>>& grPins);
   void genGuides_addCoverGuide(frNet* net, std::vector<frRect>& rects);
   void genGuides_addCoverGuide_helper(frInstTerm* term,
                                       std::vector<frRect>& rects);
@@ -198,7 +205,8 @@ class GuideProcessor
                        int nCnt,
                        std::map<frBlockObject*,
                                 std::set<std::pair<Point, frLayerNum>>,
-                                frBlockObjectComp>& pin2GCellMap);
+                                frBlockObjectComp>& pin2GCellMap,
+                       std::vector<std::pair<frBlockObject*, Point>>& grPins);
   // write guide
   void saveGuidesUpdates();
 
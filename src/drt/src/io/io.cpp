@@ -28,6 +28,8 @@
 
 #include "io/io.h"
 
+#include <omp.h>
+
 #include <exception>
 #include <fstream>
 #include <iostream>
@@ -42,6 +44,7 @@
 #include "odb/dbWireCodec.h"
 #include "triton_route/TritonRoute.h"
 #include "utl/Logger.h"
+#include "utl/exception.h"
 
 namespace drt {
 
@@ -120,6 +123,12 @@ void io::Parser::setTracks(odb::dbBlock* block)
 void io::Parser::setInst(odb::dbInst* inst)
 {
   frMaster* master = design_->name2master_.at(inst->getMaster()->getName());
+  getBlock()->addInst(makeInst(inst, master));
+}
+
+std::unique_ptr<frInst> io::Parser::makeInst(odb::dbInst* inst,
+                                             frMaster* master)
+{
   auto uInst = std::make_unique<frInst>(inst->getName(), master);
   auto tmpInst = uInst.get();
 
@@ -144,22 +153,42 @@ void io::Parser::setInst(odb::dbInst* inst)
         = std::make_unique<frInstBlockage>(tmpInst, blk);
     tmpInst->addInstBlockage(std::move(instBlk));
   }
-  getBlock()->addInst(std::move(uInst));
+  return uInst;
 }
 
 void io::Parser::setInsts(odb::dbBlock* block)
 {
+  // The masters are looked up serially, the frInsts are built in parallel
+  // and then added in db order so the ids don't depend on the thread count.
+  std::vector<odb::dbInst*> db_insts;
+  std::vector<frMaster*> masters;
+  db_insts.reserve(block->getInsts().size());
+  masters.reserve(block->getInsts().size());
   for (auto inst : block->getInsts()) {
-    if (design_->name2master_.find(inst->getMaster()->getName())
-        == design_->name2master_.end()) {
+    auto it = design_->name2master_.find(inst->getMaster()->getName());
+    if (it == design_->name2master_.end()) {
       logger_->error(
           DRT, 95, "Library cell {} not found.", inst->getMaster()->getName());
     }
+    db_insts.push_back(inst);
+    masters.push_back(it->second);
+  }
+
+  const int num_insts = db_insts.size();
+  std::vector<std::unique_ptr<frInst>> insts(num_insts);
+  omp_set_num_threads(MAX_THREADS);
+#pragma omp parallel for schedule(dynamic, 1024)
+  for (int i = 0; i < num_insts; i++) {  // NOLINT
+    insts[i] = makeInst(db_insts[i], masters[i]);
+  }
+
+  getBlock()->insts_.reserve(getBlock()->insts_.size() + num_insts);
+  for (auto& inst : insts) {
     if (getBlock()->name2inst_.find(inst->getName())
         != getBlock()->name2inst_.end()) {
       logger_->error(DRT, 96, "Same cell name: {}.", inst->getName());
     }
-    setInst(inst);
+    getBlock()->addInst(std::move(inst));
   }
 }
 
@@ -563,11 +592,11 @@ void io::Parser::updateNetRouting(frNet* netIn, odb::dbNet* net)
                      term->getName(),
                      term->getSigType().getString());
     }
-    if (getBlock()->name2term_.find(term->getName())
-        == getBlock()->name2term_.end()) {
+    auto term_it = getBlock()->name2term_.find(term->getName());
+    if (term_it == getBlock()->name2term_.end()) {
       logger_->error(DRT, 104, "Terminal {} not found.", term->getName());
     }
-    auto frbterm = getBlock()->name2term_[term->getName()];  // frBTerm*
+    frBTerm* frbterm = term_it->second;
     frbterm->addToNet(netIn);
     netIn->addBTerm(frbterm);
     if (!net->isSpecial()) {
@@ -589,12 +618,12 @@ void io::Parser::updateNetRouting(frNet* netIn, odb::dbNet* net)
                      term->getName(),
                      term->getSigType().getString());
     }
-    if (getBlock()->name2inst_.find(term->getInst()->getName())
-        == getBlock()->name2inst_.end()) {
+    auto inst_it = getBlock()->name2inst_.find(term->getInst()->getName());
+    if (inst_it == getBlock()->name2inst_.end()) {
       logger_->error(
           DRT, 105, "Component {} not found.", term->getInst()->getName());
     }
-    auto inst = getBlock()->name2inst_[term->getInst()->getName()];
+    frInst* inst = inst_it->second;
     // gettin inst term
     auto frterm = inst->getMaster()->getTerm(term->getMTerm()->getName());
     if (frterm == nullptr) {
@@ -811,7 +840,7 @@ void io::Parser::updateNetRouting(frNet* netIn, odb::dbNet* net)
           endpath = true;
         }
       } while (!endpath);
-      auto layerNum = tech_->name2layer_[layerName]->getLayerNum();
+      auto layerNum = tech_->name2layer_.at(layerName)->getLayerNum();
       if (hasRect) {
         auto tmpPWire = std::make_unique<frPatchWire>();
         tmpPWire->setLayerNum(layerNum);
@@ -830,7 +859,7 @@ void io::Parser::updateNetRouting(frNet* netIn, odb::dbNet* net)
         }
         tmpP->addToNet(netIn);
         tmpP->setLayerNum(layerNum);
-        auto layer = tech_->name2layer_[layerName];
+        auto layer = tech_->name2layer_.at(layerName);
         auto styleWidth = width;
         if (!(styleWidth)) {
           if ((layer->isHorizontal() && beginY != endY)
@@ -840,7 +869,7 @@ void io::Parser::updateNetRouting(frNet* netIn, odb::dbNet* net)
             styleWidth = layer->getWidth();
           }
         }
-        width = tech_->name2layer_[layerName]->getWidth();
+        width = tech_->name2layer_.at(layerName)->getWidth();
         auto defaultBeginExt = width / 2;
         auto defaultEndExt = width / 2;
 
@@ -885,7 +914,7 @@ void io::Parser::updateNetRouting(frNet* netIn, odb::dbNet* net)
           } else {
             p = {beginX, beginY};
           }
-          auto viaDef = tech_->name2via_[viaName];
+          auto viaDef = tech_->name2via_.at(viaName);
           auto tmpP = std::make_unique<frVia>(viaDef);
           tmpP->setOrigin(p);
           tmpP->addToNet(netIn);
@@ -900,13 +929,14 @@ void io::Parser::updateNetRouting(frNet* netIn, odb::dbNet* net)
       for (auto box : swire->getWires()) {
         if (!box->isVia()) {
           getSBoxCoords(box, beginX, beginY, endX, endY, width);
-          auto layerNum = tech_->name2layer_[box->getTechLayer()->getName()]
+          auto layerNum = tech_->name2layer_.at(box->getTechLayer()->getName())
                               ->getLayerNum();
           auto tmpP = std::make_unique<frPathSeg>();
           tmpP->setPoints(Point(beginX, beginY), Point(endX, endY));
           tmpP->addToNet(netIn);
           tmpP->setLayerNum(layerNum);
-          width = (width) ? width : tech_->name2layer_[layerName]->getWidth();
+          width = (width) ? width
+                          : tech_->name2layer_.at(layerName)->getWidth();
           auto defaultExt = width / 2;
 
           frEndStyleEnum tmpBeginEnum;
@@ -946,7 +976,7 @@ void io::Parser::updateNetRouting(frNet* netIn, odb::dbNet* net)
             int x, y;
             box->getViaXY(x, y);
             Point p(x, y);
-            auto viaDef = tech_->name2via_[viaName];
+            auto viaDef = tech_->name2via_.at(viaName);
             auto tmpP = std::make_unique<frVia>(viaDef);
             tmpP->setOrigin(p);
             tmpP->addToNet(netIn);
@@ -959,6 +989,10 @@ void io::Parser::updateNetRouting(frNet* netIn, odb::dbNet* net)
 }
 void io::Parser::setNets(odb::dbBlock* block)
 {
+  std::vector<odb::dbNet*> db_nets;
+  std::vector<std::unique_ptr<frNet>> nets;
+  db_nets.reserve(block->getNets().size());
+  nets.reserve(block->getNets().size());
   for (auto net : block->getNets()) {
     bool is_special = net->isSpecial();
     if (!is_special && net->getSigType().isSupply()) {
@@ -970,7 +1004,6 @@ void io::Parser::setNets(odb::dbBlock* block)
                      net->getSigType().getString());
     }
     std::unique_ptr<frNet> uNetIn = std::make_unique<frNet>(net->getName());
-    auto netIn = uNetIn.get();
     if (net->getNonDefaultRule()) {
       uNetIn->updateNondefaultRule(design_->getTech()->getNondefaultRule(
           net->getNonDefaultRule()->getName()));
@@ -981,12 +1014,31 @@ void io::Parser::setNets(odb::dbBlock* block)
     if (is_special) {
       uNetIn->setIsSpecial(true);
     }
-    updateNetRouting(netIn, net);
-    netIn->setType(net->getSigType());
-    if (is_special) {
-      getBlock()->addSNet(std::move(uNetIn));
+    uNetIn->setType(net->getSigType());
+    db_nets.push_back(net);
+    nets.push_back(std::move(uNetIn));
+  }
+
+  // Every term and wire belongs to a single net so the nets are converted
+  // independently.  They are added in db order to keep the ids stable.
+  const int num_nets = nets.size();
+  omp_set_num_threads(MAX_THREADS);
+  utl::ThreadException exception;
+#pragma omp parallel for schedule(dynamic, 64)
+  for (int i = 0; i < num_nets; i++) {  // NOLINT
+    try {
+      updateNetRouting(nets[i].get(), db_nets[i]);
+    } catch (...) {
+      exception.capture();
+    }
+  }
+  exception.rethrow();
+
+  for (auto& net : nets) {
+    if (net->isSpecial()) {
+      getBlock()->addSNet(std::move(net));
     } else {
-      getBlock()->addNet(std::move(uNetIn));
+      getBlock()->addNet(std::move(net));
     }
   }
 }
@@ -1215,6 +1267,16 @@ void io::Parser::setAccessPoints(odb::dbDatabase* db)
         }
       }
     }
+    auto keys_prop = odb::dbStringProperty::find(db_master, "drt_pa_keys");
+    if (keys_prop != nullptr) {
+      std::vector<std::string> keys;
+      std::stringstream keys_stream(keys_prop->getValue());
+      std::string key;
+      while (std::getline(keys_stream, key)) {
+        keys.push_back(key);
+      }
+      master->setPinAccessKeys(std::move(keys));
+    }
   }
   for (auto db_inst : db->getChip()->getBlock()->getInsts()) {
     auto inst = getBlock()->findInst(db_inst->getName());
@@ -3430,9 +3492,24 @@ void io::Writer::updateDbConn(odb::dbBlock* block,
                               bool snapshot)
 {
   odb::dbWireEncoder _wire_encoder;
+  // Layer and via names are resolved once rather than per shape, as the
+  // odb lookups compare names linearly.
+  std::vector<odb::dbTechLayer*> db_layers(getTech()->getLayers().size(),
+                                           nullptr);
+  auto getDbLayer = [&](frLayerNum layer_num) {
+    odb::dbTechLayer*& layer = db_layers[layer_num];
+    if (layer == nullptr) {
+      layer = db_tech->findLayer(
+          getTech()->getLayer(layer_num)->getName().c_str());
+    }
+    return layer;
+  };
+  std::map<frViaDef*, std::pair<odb::dbTechVia*, odb::dbVia*>> db_vias;
   for (auto net : block->getNets()) {
-    if (connFigs_.find(net->getName()) != connFigs_.end()) {
-      if (getDesign()->getTopBlock()->findNet(net->getName())->isFixed()) {
+    const std::string net_name = net->getName();
+    auto conn_figs = connFigs_.find(net_name);
+    if (conn_figs != connFigs_.end()) {
+      if (getDesign()->getTopBlock()->findNet(net_name)->isFixed()) {
         continue;
       }
       odb::dbWire* wire = net->getWire();
@@ -3445,19 +3522,17 @@ void io::Writer::updateDbConn(odb::dbBlock* block,
         _wire_encoder.begin(wire);
       }
 
-      for (auto& connFig : connFigs_.at(net->getName())) {
+      for (auto& connFig : conn_figs->second) {
         switch (connFig->typeId()) {
           case frcPathSeg: {
-            auto pathSeg = std::dynamic_pointer_cast<frPathSeg>(connFig);
-            auto layerName
-                = getTech()->getLayer(pathSeg->getLayerNum())->getName();
-            auto layer = db_tech->findLayer(layerName.c_str());
+            auto pathSeg = std::static_pointer_cast<frPathSeg>(connFig);
+            auto layer = getDbLayer(pathSeg->getLayerNum());
             if (pathSeg->isTapered() || !net->getNonDefaultRule()) {
-              _wire_encoder.newPath(layer, odb::dbWireType("ROUTED"));
+              _wire_encoder.newPath(layer, odb::dbWireType::ROUTED);
             } else {
               _wire_encoder.newPath(
                   layer,
-                  odb::dbWireType("ROUTED"),
+                  odb::dbWireType::ROUTED,
                   net->getNonDefaultRule()->getLayerRule(layer));
             }
             auto [begin, end] = pathSeg->getPoints();
@@ -3494,38 +3569,41 @@ void io::Writer::updateDbConn(odb::dbBlock* block,
             break;
           }
           case frcVia: {
-            auto via = std::dynamic_pointer_cast<frVia>(connFig);
-            auto layerName = getTech()
-                                 ->getLayer(via->getViaDef()->getLayer1Num())
-                                 ->getName();
-            auto viaName = via->getViaDef()->getName();
-            auto layer = db_tech->findLayer(layerName.c_str());
+            auto via = std::static_pointer_cast<frVia>(connFig);
+            frViaDef* via_def = via->getViaDef();
+            auto layer = getDbLayer(via_def->getLayer1Num());
             if (!net->getNonDefaultRule() || via->isTapered()) {
-              _wire_encoder.newPath(layer, odb::dbWireType("ROUTED"));
+              _wire_encoder.newPath(layer, odb::dbWireType::ROUTED);
             } else {
               _wire_encoder.newPath(
                   layer,
-                  odb::dbWireType("ROUTED"),
+                  odb::dbWireType::ROUTED,
                   net->getNonDefaultRule()->getLayerRule(layer));
             }
             Point origin = via->getOrigin();
             _wire_encoder.addPoint(origin.x(), origin.y());
-            odb::dbTechVia* tech_via = db_tech->findVia(viaName.c_str());
-            if (tech_via != nullptr) {
-              _wire_encoder.addTechVia(tech_via);
+            auto db_via = db_vias.find(via_def);
+            if (db_via == db_vias.end()) {
+              const std::string& viaName = via_def->getName();
+              odb::dbTechVia* tech_via = db_tech->findVia(viaName.c_str());
+              odb::dbVia* block_via = nullptr;
+              if (tech_via == nullptr) {
+                writeViaDefToODB(block, db_tech, via_def);
+                block_via = block->findVia(viaName.c_str());
+              }
+              db_via = db_vias.insert({via_def, {tech_via, block_via}}).first;
+            }
+            if (db_via->second.first != nullptr) {
+              _wire_encoder.addTechVia(db_via->second.first);
             } else {
-              writeViaDefToODB(block, db_tech, via->getViaDef());
-              odb::dbVia* db_via = block->findVia(viaName.c_str());
-              _wire_encoder.addVia(db_via);
+              _wire_encoder.addVia(db_via->second.second);
             }
             break;
           }
           case frcPatchWire: {
-            auto pwire = std::dynamic_pointer_cast<frPatchWire>(connFig);
-            auto layerName
-                = getTech()->getLayer(pwire->getLayerNum())->getName();
-            auto layer = db_tech->findLayer(layerName.c_str());
-            _wire_encoder.newPath(layer, odb::dbWireType("ROUTED"));
+            auto pwire = std::static_pointer_cast<frPatchWire>(connFig);
+            auto layer = getDbLayer(pwire->getLayerNum());
+            _wire_encoder.newPath(layer, odb::dbWireType::ROUTED);
             Point origin = pwire->getOrigin();
             Rect offsetBox = pwire->getOffsetBox();
             _wire_encoder.addPoint(origin.x(), origin.y());
@@ -3658,6 +3736,18 @@ void io::Writer::updateDbAccessPoints(odb::dbBlock* block, odb::dbTech* db_tech)
         }
       }
     }
+    if (PA_CACHE) {
+      std::string keys;
+      for (const auto& key : master->getPinAccessKeys()) {
+        keys += key + '\n';
+      }
+      auto keys_prop = odb::dbStringProperty::find(db_master, "drt_pa_keys");
+      if (keys_prop == nullptr) {
+        odb::dbStringProperty::create(db_master, "drt_pa_keys", keys.c_str());
+      } else {
+        keys_prop->setValue(keys.c_str());
+      }
+    }
   }
   for (auto& inst : getDesign()->getTopBlock()->getInsts()) {
     auto db_inst = block->findInst(inst->getName().c_str());
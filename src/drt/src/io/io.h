@@ -98,6 +98,9 @@ class Parser
   void setTracks(odb::dbBlock*);
   void setInsts(odb::dbBlock*);
   void setInst(odb::dbInst*);
+  // Builds the frInst of inst without adding it to the block, safe to call
+  // from several threads.
+  std::unique_ptr<frInst> makeInst(odb::dbInst* inst, frMaster* master);
   void setObstructions(odb::dbBlock*);
   void setBTerms(odb::dbBlock*);
   odb::Rect getViaBoxForTermAboveMaxLayer(odb::dbBTerm* term,
@@ -75,6 +75,7 @@ void FlexPA::setDebug(frDebugSettings* settings, odb::dbDatabase* db)
 void FlexPA::init()
 {
   ProfileTask profile("PA:init");
+  initPinAccessCache();
   for (auto& master : design_->getMasters()) {
     for (auto& term : master->getTerms()) {
       for (auto& pin : term->getPins()) {
@@ -154,6 +155,7 @@ void FlexPA::prep()
     }
   }
   prepPattern();
+  savePinAccessKeys();
 }
 
 void FlexPA::setTargetInstances(const frCollection<odb::dbInst*>& insts)
@@ -99,6 +99,11 @@ class FlexPA
       unique_inst_patterns_;
 
   UniqueInsts unique_insts_;
+  // access points of a previous run by unique instance key (PA_CACHE)
+  std::map<std::string, std::vector<std::unique_ptr<frPinAccess>>>
+      pin_access_cache_;
+  // unique instances whose access points came from pin_access_cache_
+  std::set<frInst*, frBlockObjectComp> cached_unique_insts_;
   using UniqueMTerm = std::pair<const UniqueInsts::InstSet*, frMTerm*>;
   std::map<UniqueMTerm, bool> skip_unique_inst_term_;
 
@@ -132,6 +137,10 @@ class FlexPA
   void initTrackCoords();
   void initViaRawPriority();
   void initSkipInstTerm();
+  void initPinAccessCache();
+  std::string getPinAccessCacheKey(frInst* unique_inst);
+  bool restorePinAccess(frInst* unique_inst);
+  void savePinAccessKeys();
   // prep
   void prep();
   void prepPoint();
@@ -203,4 +203,117 @@ void FlexPA::initSkipInstTerm()
   }
 }
 
+// Collects the pin access of the previous run, as read from the db, by the
+// unique instance key it was computed for.
+void FlexPA::initPinAccessCache()
+{
+  pin_access_cache_.clear();
+  cached_unique_insts_.clear();
+  if (!PA_CACHE) {
+    return;
+  }
+  for (auto& master : design_->getMasters()) {
+    const auto& keys = master->getPinAccessKeys();
+    bool valid = true;
+    for (auto& term : master->getTerms()) {
+      for (auto& pin : term->getPins()) {
+        valid &= pin->getNumPinAccess() == (int) keys.size();
+      }
+    }
+    if (!valid) {
+      continue;
+    }
+    for (int pa_idx = 0; pa_idx < (int) keys.size(); pa_idx++) {
+      if (keys[pa_idx].empty()) {
+        continue;
+      }
+      auto& cached = pin_access_cache_[keys[pa_idx]];
+      for (auto& term : master->getTerms()) {
+        for (auto& pin : term->getPins()) {
+          cached.push_back(
+              std::make_unique<frPinAccess>(*pin->getPinAccess(pa_idx)));
+        }
+      }
+    }
+  }
+  debugPrint(logger_,
+             DRT,
+             "pa_cache",
+             1,
+             "{} cached unique instances.",
+             pin_access_cache_.size());
+}
+
+// The key covers everything the access points of a unique instance depend
+// on: its class, which of its terms are skipped, the master geometry and the
+// PA settings.
+std::string FlexPA::getPinAccessCacheKey(frInst* unique_inst)
+{
+  std::string key = unique_insts_.getKey(unique_inst);
+  if (key.empty()) {
+    return key;
+  }
+  key += '|';
+  for (auto& inst_term : unique_inst->getInstTerms()) {
+    key += isSkipInstTerm(inst_term.get()) ? '1' : '0';
+  }
+
+  std::stringstream desc;
+  desc << DBPROCESSNODE << ' ' << ENABLE_VIA_GEN << ' ' << VIA_ACCESS_LAYERNUM
+       << ' ' << MINNUMACCESSPOINT_STDCELLPIN << ' '
+       << MINNUMACCESSPOINT_MACROCELLPIN << ' ' << BOTTOM_ROUTING_LAYER << ' '
+       << TOP_ROUTING_LAYER << ' ' << AUTO_TAPER_NDR_NETS << ' '
+       << getTech()->getLayers().size() << ' ' << getTech()->getVias().size();
+  frMaster* master = unique_inst->getMaster();
+  for (auto& term : master->getTerms()) {
+    for (auto& pin : term->getPins()) {
+      for (auto& fig : pin->getFigs()) {
+        desc << ' ' << static_cast<frShape*>(fig.get())->getLayerNum() << ' '
+             << fig->getBBox();
+      }
+    }
+  }
+  for (auto& blk : master->getBlockages()) {
+    for (auto& fig : blk->getPin()->getFigs()) {
+      desc << ' ' << static_cast<frShape*>(fig.get())->getLayerNum() << ' '
+           << fig->getBBox();
+    }
+  }
+  // FNV-1a, which unlike std::hash is stable across builds
+  uint64_t hash = 14695981039346656037ULL;
+  for (const char c : desc.str()) {
+    hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ULL;
+  }
+  return fmt::format("{}|{:016x}", key, hash);
+}
+
+// Records the key behind each pin access index on the masters so the writer
+// can store it with the access points.
+void FlexPA::savePinAccessKeys()
+{
+  if (!PA_CACHE) {
+    return;
+  }
+  std::map<frMaster*, std::vector<std::string>, frBlockObjectComp> keys;
+  for (auto& master : design_->getMasters()) {
+    int num_pin_access = 0;
+    for (auto& term : master->getTerms()) {
+      for (auto& pin : term->getPins()) {
+        num_pin_access = std::max(num_pin_access, pin->getNumPinAccess());
+      }
+    }
+    keys[master.get()].resize(num_pin_access);
+  }
+  for (frInst* inst : unique_insts_.getUnique()) {
+    auto& master_keys = keys[inst->getMaster()];
+    const int pa_idx = unique_insts_.getPAIndex(inst);
+    if (pa_idx < (int) master_keys.size()) {
+      master_keys[pa_idx] = getPinAccessCacheKey(inst);
+    }
+  }
+  for (auto& [master, master_keys] : keys) {
+    master->setPinAccessKeys(std::move(master_keys));
+  }
+}
+
 }  // namespace drt
@@ -31,6 +31,7 @@
 #include <chrono>
 #include <fstream>
 #include <iostream>
+#include <numeric>
 #include <sstream>
 
 #include "FlexPA.h"
@@ -1576,6 +1577,9 @@ void FlexPA::prepPoint()
           && masterType != dbMasterType::RING) {
         continue;
       }
+      if (restorePinAccess(inst)) {
+        continue;
+      }
       ProfileTask profile("PA:uniqueInstance");
       for (auto& inst_term : inst->getInstTerms()) {
         // only do for normal and clock terms
@@ -1676,6 +1680,11 @@ void FlexPA::prepPatternInstRows(std::vector<std::vector<frInst*>> inst_rows)
             = std::make_unique<PinAccessJobDescription>();
         uDesc->setPath(path);
         uDesc->setType(PinAccessJobDescription::INST_ROWS);
+        int num_insts = 0;
+        for (const auto& row : batch) {
+          num_insts += row.size();
+        }
+        uDesc->setCost(num_insts);
         msg.setJobDescription(std::move(uDesc));
         const bool ok
             = dist_->sendJob(msg, remote_host_.c_str(), remote_port_, result);
@@ -1775,12 +1784,37 @@ void FlexPA::prepPattern()
 
   int cnt = 0;
 
+  // The pattern DP of a unique instance grows with the product of the access
+  // point counts of neighboring pins.  Start the most expensive instances
+  // first so they don't run as a single threaded tail.  Results are stored
+  // by unique index so the order doesn't affect them.
+  std::vector<int64_t> costs(unique.size(), 0);
+  for (int i = 0; i < (int) unique.size(); i++) {
+    const int pin_access_idx = unique_insts_.getPAIndex(unique[i]);
+    for (auto& inst_term : unique[i]->getInstTerms()) {
+      if (isSkipInstTerm(inst_term.get())) {
+        continue;
+      }
+      for (auto& pin : inst_term->getTerm()->getPins()) {
+        const int64_t n_aps
+            = pin->getPinAccess(pin_access_idx)->getAccessPoints().size();
+        costs[i] += n_aps * n_aps;
+      }
+    }
+  }
+  std::vector<int> unique_order(unique.size());
+  std::iota(unique_order.begin(), unique_order.end(), 0);
+  std::stable_sort(
+      unique_order.begin(), unique_order.end(), [&costs](int a, int b) {
+        return costs[a] > costs[b];
+      });
+
   omp_set_num_threads(MAX_THREADS);
   ThreadException exception;
 #pragma omp parallel for schedule(dynamic)
-  for (int curr_unique_inst_idx = 0; curr_unique_inst_idx < (int) unique.size();
-       curr_unique_inst_idx++) {
+  for (int i = 0; i < (int) unique_order.size(); i++) {
     try {
+      const int curr_unique_inst_idx = unique_order[i];
       auto& inst = unique[curr_unique_inst_idx];
       // only do for core and block cells
       // TODO the above comment says "block cells" but that's not what the code
@@ -1891,10 +1925,40 @@ void FlexPA::prepPattern()
   prepPatternInstRows(std::move(inst_rows));
 }
 
+// Copies the cached access points of the unique instance into its pin access
+// index.  Cached access points are already relative to the instance origin.
+bool FlexPA::restorePinAccess(frInst* unique_inst)
+{
+  if (pin_access_cache_.empty()) {
+    return false;
+  }
+  auto it = pin_access_cache_.find(getPinAccessCacheKey(unique_inst));
+  if (it == pin_access_cache_.end()) {
+    return false;
+  }
+  const int pin_access_idx = unique_insts_.getPAIndex(unique_inst);
+  auto cached = it->second.begin();
+  for (auto& term : unique_inst->getMaster()->getTerms()) {
+    for (auto& pin : term->getPins()) {
+      for (auto& ap : (*cached)->getAccessPoints()) {
+        pin->getPinAccess(pin_access_idx)
+            ->addAccessPoint(std::make_unique<frAccessPoint>(*ap));
+      }
+      ++cached;
+    }
+  }
+#pragma omp critical
+  cached_unique_insts_.insert(unique_inst);
+  return true;
+}
+
 void FlexPA::revertAccessPoints()
 {
   const auto& unique = unique_insts_.getUnique();
   for (auto& inst : unique) {
+    if (cached_unique_insts_.find(inst) != cached_unique_insts_.end()) {
+      continue;
+    }
     const dbTransform xform = inst->getTransform();
     const Point offset(xform.getOffset());
     dbTransform revertXform;
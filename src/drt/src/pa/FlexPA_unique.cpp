@@ -188,6 +188,12 @@ void UniqueInsts::computeUnique(
       for (auto& [vec, insts] : offsetMap) {
         auto unique_inst = *(insts.begin());
         unique_.push_back(unique_inst);
+        std::string key
+            = fmt::format("{}|{}", master->getName(), orient.getString());
+        for (frCoord coord : vec) {
+          key += fmt::format("|{}", coord);
+        }
+        unique_to_key_[unique_inst] = std::move(key);
         for (auto i : insts) {
           inst_to_unique_[i] = unique_inst;
           inst_to_class_[i] = &insts;
@@ -310,6 +316,15 @@ int UniqueInsts::getIndex(frInst* inst)
   return unique_to_idx_[unique_inst];
 }
 
+std::string UniqueInsts::getKey(frInst* unique_inst) const
+{
+  auto it = unique_to_key_.find(unique_inst);
+  if (it == unique_to_key_.end()) {
+    return "";
+  }
+  return it->second;
+}
+
 int UniqueInsts::getPAIndex(frInst* inst) const
 {
   return unique_to_pa_idx_.at(inst);
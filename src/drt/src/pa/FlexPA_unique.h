@@ -60,6 +60,9 @@ class UniqueInsts
 
   // Gets the instances in the equivalence set of the given inst
   InstSet* getClass(frInst* inst) const;
+  // Gets the master/orientation/track-offset key of the unique inst.  Empty
+  // for insts that are unique on their own (NDR insts).
+  std::string getKey(frInst* unique_inst) const;
 
   const std::vector<frInst*>& getUnique() const;
   frInst* getUnique(int idx) const;
@@ -103,6 +106,8 @@ class UniqueInsts
   std::map<frInst*, int, frBlockObjectComp> unique_to_pa_idx_;
   // Maps a unique instance to its index in unique_
   std::map<frInst*, int, frBlockObjectComp> unique_to_idx_;
+  // Maps a unique instance to its equivalence class key
+  std::map<frInst*, std::string, frBlockObjectComp> unique_to_key_;
   // master orient track-offset to instances
   std::map<frMaster*,
            std::map<dbOrientType, std::map<std::vector<frCoord>, InstSet>>,
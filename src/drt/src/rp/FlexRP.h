@@ -57,6 +57,16 @@ class FlexRP
   // prep
   void prep();
 
+  // The via2via and via turn tables of every rule, the bulk of the prep.
+  // Every (rule, layer) entry is independent so they are built in parallel.
+  void prep_viaForbiddenTables();
+  // rule cache (RP_CACHE): the tables above are stored on the dbTech under
+  // a hash of everything they are computed from.
+  std::string getRuleCacheKey() const;
+  bool restoreRuleCache(const std::string& key);
+  void saveRuleCache(const std::string& key) const;
+  odb::dbTech* getDbTech() const;
+
   // functions
   void prep_viaForbiddenThrough();
   void prep_minStepViasCheck();
@@ -95,7 +105,9 @@ class FlexRP
                                           frViaDef* viaDef,
                                           bool isCurrDirX,
                                           ForbiddenRanges& forbiddenRanges);
-  void prep_viaForbiddenTurnLen(frNonDefaultRule* ndr = nullptr);
+  void prep_viaForbiddenTurnLen(frNonDefaultRule* ndr,
+                                frLayerNum lNum,
+                                int tableLayerIdx);
   void prep_viaForbiddenTurnLen_helper(const frLayerNum& lNum,
                                        const int& tableLayerIdx,
                                        const int& tableEntryIdx,
@@ -107,7 +119,9 @@ class FlexRP
                                        bool isCurrDirX,
                                        ForbiddenRanges& forbiddenRanges,
                                        frNonDefaultRule* ndr = nullptr);
-  void prep_via2viaForbiddenLen(frNonDefaultRule* ndr = nullptr);
+  void prep_via2viaForbiddenLen(frNonDefaultRule* ndr,
+                                frLayerNum lNum,
+                                int tableLayerIdx);
   void prep_via2viaForbiddenLen_helper(const frLayerNum& lNum,
                                        const int& tableLayerIdx,
                                        const int& tableEntryIdx,
@@ -26,6 +26,8 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <omp.h>
+
 #include <iostream>
 #include <sstream>
 
@@ -37,24 +39,242 @@
 #include "frProfileTask.h"
 #include "gc/FlexGC.h"
 #include "odb/db.h"
+#include "odb/lefout.h"
+#include "utl/exception.h"
 
 namespace drt {
 
+using utl::ThreadException;
+
 void FlexRP::prep()
 {
   ProfileTask profile("RP:prep");
-  prep_via2viaForbiddenLen();
-  prep_viaForbiddenTurnLen();
+  const std::string cache_key = RP_CACHE ? getRuleCacheKey() : "";
+  if (!RP_CACHE || !restoreRuleCache(cache_key)) {
+    prep_viaForbiddenTables();
+    if (RP_CACHE) {
+      saveRuleCache(cache_key);
+    }
+  }
   prep_viaForbiddenPlanarLen();
   prep_lineForbiddenLen();
   prep_eolForbiddenLen();
   prep_cutSpcTbl();
   prep_viaForbiddenThrough();
+  prep_minStepViasCheck();
+}
+
+void FlexRP::prep_viaForbiddenTables()
+{
+  ProfileTask profile("RP:viaForbiddenTables");
+  const auto bottomLayerNum = getDesign()->getTech()->getBottomLayerNum();
+  const auto topLayerNum = getDesign()->getTech()->getTopLayerNum();
+  std::vector<frLayerNum> layerNums;
+  for (auto lNum = bottomLayerNum; lNum <= topLayerNum; lNum++) {
+    if (tech_->getLayer(lNum)->getType() == dbTechLayerType::ROUTING) {
+      layerNums.push_back(lNum);
+    }
+  }
+  std::vector<frNonDefaultRule*> rules{nullptr};
   for (auto& ndr : tech_->nonDefaultRules_) {
-    prep_via2viaForbiddenLen(ndr.get());
-    prep_viaForbiddenTurnLen(ndr.get());
+    rules.push_back(ndr.get());
+  }
+
+  const int numLayers = layerNums.size();
+  const int numEntries = rules.size() * numLayers;
+  omp_set_num_threads(MAX_THREADS);
+  ThreadException exception;
+#pragma omp parallel for schedule(dynamic)
+  for (int i = 0; i < numEntries; i++) {  // NOLINT
+    try {
+      frNonDefaultRule* ndr = rules[i / numLayers];
+      const int tableLayerIdx = i % numLayers;
+      const frLayerNum lNum = layerNums[tableLayerIdx];
+      prep_via2viaForbiddenLen(ndr, lNum, tableLayerIdx);
+      prep_viaForbiddenTurnLen(ndr, lNum, tableLayerIdx);
+    } catch (...) {
+      exception.capture();
+    }
+  }
+  exception.rethrow();
+}
+
+namespace {
+
+void writeRanges(std::ostream& out, const ForbiddenRanges& ranges)
+{
+  out << ranges.size();
+  for (const auto& [begin, end] : ranges) {
+    out << ' ' << begin << ' ' << end;
+  }
+  out << '\n';
+}
+
+bool readRanges(std::istream& in, ForbiddenRanges& ranges)
+{
+  size_t size = 0;
+  if (!(in >> size)) {
+    return false;
+  }
+  ranges.resize(size);
+  for (auto& [begin, end] : ranges) {
+    in >> begin >> end;
+  }
+  return !in.fail();
+}
+
+}  // namespace
+
+odb::dbTech* FlexRP::getDbTech() const
+{
+  for (auto& layer : tech_->getLayers()) {
+    if (layer->getDbLayer() != nullptr) {
+      return layer->getDbLayer()->getTech();
+    }
+  }
+  return nullptr;
+}
+
+// The key covers everything the tables depend on: the tech rules (as LEF),
+// the vias chosen for each layer and the non default rules.
+std::string FlexRP::getRuleCacheKey() const
+{
+  odb::dbTech* db_tech = getDbTech();
+  if (db_tech == nullptr) {
+    return "";
+  }
+  std::stringstream desc;
+  odb::lefout writer(logger_, desc);
+  writer.writeTech(db_tech);
+
+  desc << BOTTOM_ROUTING_LAYER;
+  for (auto& layer : tech_->getLayers()) {
+    const frViaDef* via_def = layer->getDefaultViaDef();
+    desc << ' ' << (via_def ? via_def->getName() : "-");
+  }
+  const int num_z = tech_->getLayers().size() / 2;
+  for (auto& ndr : tech_->nonDefaultRules_) {
+    desc << '\n' << ndr->getName();
+    for (int z = 0; z < num_z; z++) {
+      const frViaDef* via_def = ndr->getPrefVia(z);
+      desc << ' ' << ndr->getWidth(z) << ' ' << ndr->getSpacing(z) << ' '
+           << (via_def ? via_def->getName() : "-");
+    }
+  }
+  // FNV-1a, which unlike std::hash is stable across builds
+  uint64_t hash = 14695981039346656037ULL;
+  for (const char c : desc.str()) {
+    hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ULL;
+  }
+  return fmt::format("{:016x}", hash);
+}
+
+bool FlexRP::restoreRuleCache(const std::string& key)
+{
+  odb::dbTech* db_tech = getDbTech();
+  if (key.empty() || db_tech == nullptr) {
+    return false;
+  }
+  auto prop = odb::dbStringProperty::find(db_tech, "drt_rp_cache");
+  if (prop == nullptr) {
+    return false;
+  }
+  std::stringstream in(prop->getValue());
+  std::string cached_key;
+  if (!std::getline(in, cached_key) || cached_key != key) {
+    debugPrint(logger_, DRT, "rp_cache", 1, "Rule cache is stale.");
+    return false;
+  }
+
+  // read into copies so a truncated cache leaves the tables untouched
+  auto via2ViaForbiddenLen = tech_->via2ViaForbiddenLen_;
+  auto via2ViaPrlLen = tech_->via2ViaPrlLen_;
+  auto viaForbiddenTurnLen = tech_->viaForbiddenTurnLen_;
+  std::vector<decltype(via2ViaForbiddenLen)> ndrVia2ViaForbiddenLen;
+  std::vector<decltype(viaForbiddenTurnLen)> ndrViaForbiddenTurnLen;
+  auto read = [&in](auto& via2via, auto* prl, auto& turn) {
+    for (size_t i = 0; i < via2via.size(); i++) {
+      for (auto& ranges : via2via[i]) {
+        if (!readRanges(in, ranges)) {
+          return false;
+        }
+      }
+      if (prl != nullptr) {
+        for (auto& len : (*prl)[i]) {
+          in >> len;
+        }
+      }
+      for (auto& ranges : turn[i]) {
+        if (!readRanges(in, ranges)) {
+          return false;
+        }
+      }
+    }
+    return !in.fail();
+  };
+  if (!read(via2ViaForbiddenLen, &via2ViaPrlLen, viaForbiddenTurnLen)) {
+    return false;
+  }
+  for (auto& ndr : tech_->nonDefaultRules_) {
+    ndrVia2ViaForbiddenLen.push_back(ndr->via2ViaForbiddenLen_);
+    ndrViaForbiddenTurnLen.push_back(ndr->viaForbiddenTurnLen_);
+    if (!read(ndrVia2ViaForbiddenLen.back(),
+              (decltype(via2ViaPrlLen)*) nullptr,
+              ndrViaForbiddenTurnLen.back())) {
+      return false;
+    }
+  }
+
+  tech_->via2ViaForbiddenLen_ = std::move(via2ViaForbiddenLen);
+  tech_->via2ViaPrlLen_ = std::move(via2ViaPrlLen);
+  tech_->viaForbiddenTurnLen_ = std::move(viaForbiddenTurnLen);
+  for (size_t i = 0; i < tech_->nonDefaultRules_.size(); i++) {
+    auto& ndr = tech_->nonDefaultRules_[i];
+    ndr->via2ViaForbiddenLen_ = std::move(ndrVia2ViaForbiddenLen[i]);
+    ndr->viaForbiddenTurnLen_ = std::move(ndrViaForbiddenTurnLen[i]);
+  }
+  debugPrint(logger_, DRT, "rp_cache", 1, "Restored the rule cache.");
+  return true;
+}
+
+void FlexRP::saveRuleCache(const std::string& key) const
+{
+  odb::dbTech* db_tech = getDbTech();
+  if (key.empty() || db_tech == nullptr) {
+    return;
+  }
+  std::stringstream out;
+  out << key << '\n';
+  auto write = [&out](const auto& via2via, const auto* prl, const auto& turn) {
+    for (size_t i = 0; i < via2via.size(); i++) {
+      for (const auto& ranges : via2via[i]) {
+        writeRanges(out, ranges);
+      }
+      if (prl != nullptr) {
+        for (const auto len : (*prl)[i]) {
+          out << len << ' ';
+        }
+        out << '\n';
+      }
+      for (const auto& ranges : turn[i]) {
+        writeRanges(out, ranges);
+      }
+    }
+  };
+  write(tech_->via2ViaForbiddenLen_,
+        &tech_->via2ViaPrlLen_,
+        tech_->viaForbiddenTurnLen_);
+  for (auto& ndr : tech_->nonDefaultRules_) {
+    write(ndr->via2ViaForbiddenLen_,
+          (decltype(tech_->via2ViaPrlLen_)*) nullptr,
+          ndr->viaForbiddenTurnLen_);
+  }
+  auto prop = odb::dbStringProperty::find(db_tech, "drt_rp_cache");
+  if (prop == nullptr) {
+    odb::dbStringProperty::create(db_tech, "drt_rp_cache", out.str().c_str());
+  } else {
+    prop->setValue(out.str().c_str());
   }
-  prep_minStepViasCheck();
 }
 
 void FlexRP::prep_minStepViasCheck()
@@ -533,39 +753,31 @@ void FlexRP::prep_viaForbiddenPlanarLen_minStep(
 {
 }
 
-void FlexRP::prep_viaForbiddenTurnLen(frNonDefaultRule* ndr)
+void FlexRP::prep_viaForbiddenTurnLen(frNonDefaultRule* ndr,
+                                      const frLayerNum lNum,
+                                      const int tableLayerIdx)
 {
-  auto bottomLayerNum = getDesign()->getTech()->getBottomLayerNum();
-  auto topLayerNum = getDesign()->getTech()->getTopLayerNum();
   int bottom = BOTTOM_ROUTING_LAYER;
-  int i = 0;
-  for (auto lNum = bottomLayerNum; lNum <= topLayerNum; lNum++) {
-    if (getDesign()->getTech()->getLayer(lNum)->getType()
-        != dbTechLayerType::ROUTING) {
-      continue;
-    }
-    frViaDef* downVia = nullptr;
-    frViaDef* upVia = nullptr;
-    if (ndr && bottom < lNum && ndr->getPrefVia((lNum - 2) / 2 - 1)) {
-      downVia = ndr->getPrefVia((lNum - 2) / 2 - 1);
-    } else if (getDesign()->getTech()->getBottomLayerNum() <= lNum - 1) {
-      downVia = getDesign()->getTech()->getLayer(lNum - 1)->getDefaultViaDef();
-    }
+  frViaDef* downVia = nullptr;
+  frViaDef* upVia = nullptr;
+  if (ndr && bottom < lNum && ndr->getPrefVia((lNum - 2) / 2 - 1)) {
+    downVia = ndr->getPrefVia((lNum - 2) / 2 - 1);
+  } else if (getDesign()->getTech()->getBottomLayerNum() <= lNum - 1) {
+    downVia = getDesign()->getTech()->getLayer(lNum - 1)->getDefaultViaDef();
+  }
 
-    if (getDesign()->getTech()->getTopLayerNum() >= lNum + 1) {
-      if (ndr && ndr->getPrefVia(lNum / 2 - 1)) {
-        upVia = ndr->getPrefVia(lNum / 2 - 1);
-      } else {
-        upVia = getDesign()->getTech()->getLayer(lNum + 1)->getDefaultViaDef();
-      }
+  if (getDesign()->getTech()->getTopLayerNum() >= lNum + 1) {
+    if (ndr && ndr->getPrefVia(lNum / 2 - 1)) {
+      upVia = ndr->getPrefVia(lNum / 2 - 1);
+    } else {
+      upVia = getDesign()->getTech()->getLayer(lNum + 1)->getDefaultViaDef();
     }
-    prep_viaForbiddenTurnLen_helper(lNum, i, 0, downVia, true, ndr);
-    prep_viaForbiddenTurnLen_helper(lNum, i, 1, downVia, false, ndr);
-    prep_viaForbiddenTurnLen_helper(lNum, i, 2, upVia, true, ndr);
-    prep_viaForbiddenTurnLen_helper(lNum, i, 3, upVia, false, ndr);
-
-    i++;
   }
+  const int i = tableLayerIdx;
+  prep_viaForbiddenTurnLen_helper(lNum, i, 0, downVia, true, ndr);
+  prep_viaForbiddenTurnLen_helper(lNum, i, 1, downVia, false, ndr);
+  prep_viaForbiddenTurnLen_helper(lNum, i, 2, upVia, true, ndr);
+  prep_viaForbiddenTurnLen_helper(lNum, i, 3, upVia, false, ndr);
 }
 
 // forbidden turn length range from via
@@ -666,42 +878,34 @@ void FlexRP::prep_viaForbiddenTurnLen_minSpc(const frLayerNum& lNum,
   }
 }
 
-void FlexRP::prep_via2viaForbiddenLen(frNonDefaultRule* ndr)
+void FlexRP::prep_via2viaForbiddenLen(frNonDefaultRule* ndr,
+                                      const frLayerNum lNum,
+                                      const int tableLayerIdx)
 {
-  auto bottomLayerNum = getDesign()->getTech()->getBottomLayerNum();
-  auto topLayerNum = getDesign()->getTech()->getTopLayerNum();
   int bottom = BOTTOM_ROUTING_LAYER;
-  int i = 0;
-  for (auto lNum = bottomLayerNum; lNum <= topLayerNum; lNum++) {
-    if (getDesign()->getTech()->getLayer(lNum)->getType()
-        != dbTechLayerType::ROUTING) {
-      continue;
-    }
-    frViaDef* downVia = nullptr;
-    frViaDef* upVia = nullptr;
-    if (ndr && bottom < lNum && ndr->getPrefVia((lNum - 2) / 2 - 1)) {
-      downVia = ndr->getPrefVia((lNum - 2) / 2 - 1);
-    } else if (getDesign()->getTech()->getBottomLayerNum() <= lNum - 1) {
-      downVia = getDesign()->getTech()->getLayer(lNum - 1)->getDefaultViaDef();
-    }
-    if (getDesign()->getTech()->getTopLayerNum() >= lNum + 1) {
-      if (ndr && ndr->getPrefVia(lNum / 2 - 1)) {
-        upVia = ndr->getPrefVia(lNum / 2 - 1);
-      } else {
-        upVia = getDesign()->getTech()->getLayer(lNum + 1)->getDefaultViaDef();
-      }
+  frViaDef* downVia = nullptr;
+  frViaDef* upVia = nullptr;
+  if (ndr && bottom < lNum && ndr->getPrefVia((lNum - 2) / 2 - 1)) {
+    downVia = ndr->getPrefVia((lNum - 2) / 2 - 1);
+  } else if (getDesign()->getTech()->getBottomLayerNum() <= lNum - 1) {
+    downVia = getDesign()->getTech()->getLayer(lNum - 1)->getDefaultViaDef();
+  }
+  if (getDesign()->getTech()->getTopLayerNum() >= lNum + 1) {
+    if (ndr && ndr->getPrefVia(lNum / 2 - 1)) {
+      upVia = ndr->getPrefVia(lNum / 2 - 1);
+    } else {
+      upVia = getDesign()->getTech()->getLayer(lNum + 1)->getDefaultViaDef();
     }
-    prep_via2viaForbiddenLen_helper(lNum, i, 0, downVia, downVia, true, ndr);
-    prep_via2viaForbiddenLen_helper(lNum, i, 1, downVia, downVia, false, ndr);
-    prep_via2viaForbiddenLen_helper(lNum, i, 2, downVia, upVia, true, ndr);
-    prep_via2viaForbiddenLen_helper(lNum, i, 3, downVia, upVia, false, ndr);
-    prep_via2viaForbiddenLen_helper(lNum, i, 4, upVia, downVia, true, ndr);
-    prep_via2viaForbiddenLen_helper(lNum, i, 5, upVia, downVia, false, ndr);
-    prep_via2viaForbiddenLen_helper(lNum, i, 6, upVia, upVia, true, ndr);
-    prep_via2viaForbiddenLen_helper(lNum, i, 7, upVia, upVia, false, ndr);
-
-    i++;
   }
+  const int i = tableLayerIdx;
+  prep_via2viaForbiddenLen_helper(lNum, i, 0, downVia, downVia, true, ndr);
+  prep_via2viaForbiddenLen_helper(lNum, i, 1, downVia, downVia, false, ndr);
+  prep_via2viaForbiddenLen_helper(lNum, i, 2, downVia, upVia, true, ndr);
+  prep_via2viaForbiddenLen_helper(lNum, i, 3, downVia, upVia, false, ndr);
+  prep_via2viaForbiddenLen_helper(lNum, i, 4, upVia, downVia, true, ndr);
+  prep_via2viaForbiddenLen_helper(lNum, i, 5, upVia, downVia, false, ndr);
+  prep_via2viaForbiddenLen_helper(lNum, i, 6, upVia, upVia, true, ndr);
+  prep_via2viaForbiddenLen_helper(lNum, i, 7, upVia, upVia, false, ndr);
 }
 
 // assume via is always centered at (0,0) for shapes on all three layers
@@ -117,68 +117,79 @@ int FlexTA::initTA_helper(int iter,
   auto gCellPatterns = getDesign()->getTopBlock()->getGCellPatterns();
   auto& xgp = gCellPatterns.at(0);
   auto& ygp = gCellPatterns.at(1);
-  int sol = 0;
   numPanels = 0;
-  std::vector<std::vector<std::unique_ptr<FlexTAWorker>>> workers;
-  if (isH) {
-    for (int i = offset; i < (int) ygp.getCount(); i += size) {
-      auto uworker
-          = std::make_unique<FlexTAWorker>(getDesign(), logger_, save_updates_);
-      auto& worker = *(uworker.get());
-      Rect beginBox = getDesign()->getTopBlock()->getGCellBox(Point(0, i));
-      Rect endBox = getDesign()->getTopBlock()->getGCellBox(
-          Point((int) xgp.getCount() - 1,
-                std::min(i + size - 1, (int) ygp.getCount() - 1)));
-      Rect routeBox(
-          beginBox.xMin(), beginBox.yMin(), endBox.xMax(), endBox.yMax());
-      Rect extBox;
-      routeBox.bloat(ygp.getSpacing() / 2, extBox);
-      worker.setRouteBox(routeBox);
-      worker.setExtBox(extBox);
-      worker.setDir(dbTechLayerDir::HORIZONTAL);
-      worker.setTAIter(iter);
-      if (workers.empty() || (int) workers.back().size() >= BATCHSIZETA) {
-        workers.emplace_back(std::vector<std::unique_ptr<FlexTAWorker>>());
-      }
-      workers.back().emplace_back(std::move(uworker));
+  const int numPanelGCells = isH ? ygp.getCount() : xgp.getCount();
+  const int numLengthGCells = isH ? xgp.getCount() : ygp.getCount();
+  // With TA_SUBPANELS a panel is cut into sub-panels of size gcells along
+  // its direction.  Guides crossing a cut are assigned afterwards by a worker
+  // over the whole panel that sees the sub-panel results as ext iroutes, so
+  // no two workers ever own overlapping guides.
+  const int subPanelLength = TA_SUBPANELS ? size : numLengthGCells;
+  auto getPanelBox = [&](int panelBegin, int lengthBegin) {
+    const int panelEnd = std::min(panelBegin + size, numPanelGCells) - 1;
+    const int lengthEnd
+        = std::min(lengthBegin + subPanelLength, numLengthGCells) - 1;
+    Rect beginBox = getDesign()->getTopBlock()->getGCellBox(
+        isH ? Point(lengthBegin, panelBegin) : Point(panelBegin, lengthBegin));
+    Rect endBox = getDesign()->getTopBlock()->getGCellBox(
+        isH ? Point(lengthEnd, panelEnd) : Point(panelEnd, lengthEnd));
+    return Rect(beginBox.xMin(), beginBox.yMin(), endBox.xMax(), endBox.yMax());
+  };
+  auto makeWorker = [&](const Rect& routeBox) {
+    auto worker
+        = std::make_unique<FlexTAWorker>(getDesign(), logger_, save_updates_);
+    Rect extBox;
+    routeBox.bloat((isH ? ygp : xgp).getSpacing() / 2, extBox);
+    worker->setRouteBox(routeBox);
+    worker->setExtBox(extBox);
+    worker->setDir(isH ? dbTechLayerDir::HORIZONTAL : dbTechLayerDir::VERTICAL);
+    worker->setTAIter(iter);
+    return worker;
+  };
+  std::vector<std::unique_ptr<FlexTAWorker>> workers;
+  std::vector<std::unique_ptr<FlexTAWorker>> boundaryWorkers;
+  for (int i = offset; i < numPanelGCells; i += size) {
+    std::vector<Rect> subPanels;
+    for (int j = 0; j < numLengthGCells; j += subPanelLength) {
+      subPanels.push_back(getPanelBox(i, j));
+      workers.push_back(makeWorker(subPanels.back()));
     }
-  } else {
-    for (int i = offset; i < (int) xgp.getCount(); i += size) {
-      auto uworker
-          = std::make_unique<FlexTAWorker>(getDesign(), logger_, save_updates_);
-      auto& worker = *(uworker.get());
-      Rect beginBox = getDesign()->getTopBlock()->getGCellBox(Point(i, 0));
-      Rect endBox = getDesign()->getTopBlock()->getGCellBox(
-          Point(std::min(i + size - 1, (int) xgp.getCount() - 1),
-                (int) ygp.getCount() - 1));
-      Rect routeBox(
-          beginBox.xMin(), beginBox.yMin(), endBox.xMax(), endBox.yMax());
-      Rect extBox;
-      routeBox.bloat(xgp.getSpacing() / 2, extBox);
-      worker.setRouteBox(routeBox);
-      worker.setExtBox(extBox);
-      worker.setDir(dbTechLayerDir::VERTICAL);
-      worker.setTAIter(iter);
-      if (workers.empty() || (int) workers.back().size() >= BATCHSIZETA) {
-        workers.emplace_back(std::vector<std::unique_ptr<FlexTAWorker>>());
-      }
-      workers.back().push_back(std::move(uworker));
+    if (subPanels.size() > 1) {
+      Rect panelBox = subPanels.front();
+      panelBox.merge(subPanels.back());
+      auto worker = makeWorker(panelBox);
+      worker->setSubPanels(std::move(subPanels));
+      boundaryWorkers.push_back(std::move(worker));
     }
   }
 
-  omp_set_num_threads(std::min(8, MAX_THREADS));
+  const int sol = runWorkers(workers, numPanels)
+                  + runWorkers(boundaryWorkers, numPanels);
+  return sol;
+}
+
+int FlexTA::runWorkers(std::vector<std::unique_ptr<FlexTAWorker>>& workers,
+                       int& numPanels)
+{
+  // sub-panels are small enough to keep every thread busy
+  const int numThreads = TA_SUBPANELS ? MAX_THREADS : std::min(8, MAX_THREADS);
+  const int batchSize
+      = TA_SUBPANELS ? std::max(BATCHSIZETA, MAX_THREADS) : BATCHSIZETA;
+  int sol = 0;
+  omp_set_num_threads(numThreads);
   // parallel execution
   // multi thread
-  for (auto& workerBatch : workers) {
+  for (int begin = 0; begin < (int) workers.size(); begin += batchSize) {
+    const int end = std::min(begin + batchSize, (int) workers.size());
     ProfileTask profile("TA:batch");
     utl::ThreadException exception;
 #pragma omp parallel for schedule(dynamic)
-    for (int i = 0; i < (int) workerBatch.size(); i++) {
+    for (int i = begin; i < end; i++) {
       try {
-        workerBatch[i]->main_mt();
+        workers[i]->main_mt();
 #pragma omp critical
         {
-          sol += workerBatch[i]->getNumAssigned();
+          sol += workers[i]->getNumAssigned();
           numPanels++;
         }
       } catch (...) {
@@ -186,10 +197,10 @@ int FlexTA::initTA_helper(int iter,
       }
     }
     exception.rethrow();
-    for (auto& worker : workerBatch) {
-      worker->end();
+    for (int i = begin; i < end; i++) {
+      workers[i]->end();
+      workers[i].reset();
     }
-    workerBatch.clear();
   }
   return sol;
 }
@@ -37,6 +37,7 @@
 
 namespace drt {
 class FlexTAGraphics;
+class FlexTAWorker;
 
 class FlexTA
 {
@@ -62,9 +63,10 @@ class FlexTA
   void initTA(int size);
   void searchRepair(int iter, int size, int offset);
   int initTA_helper(int iter, int size, int offset, bool isH, int& numPanels);
+  int runWorkers(std::vector<std::unique_ptr<FlexTAWorker>>& workers,
+                 int& numPanels);
 };
 
-class FlexTAWorker;
 class FlexTAWorkerRegionQuery
 {
  public:
@@ -133,6 +135,8 @@ class FlexTAWorker
   void setExtBox(const Rect& boxIn) { extBox_ = boxIn; }
   void setDir(const dbTechLayerDir& in) { dir_ = in; }
   void setTAIter(int in) { taIter_ = in; }
+  // guides contained in one of these boxes belong to other workers
+  void setSubPanels(std::vector<Rect> in) { subPanels_ = std::move(in); }
   void addIroute(std::unique_ptr<taPin> in, bool isExt = false)
   {
     in->setId(iroutes_.size() + extIroutes_.size());
@@ -201,6 +205,7 @@ class FlexTAWorker
   Rect extBox_;
   dbTechLayerDir dir_;
   int taIter_;
+  std::vector<Rect> subPanels_;
   FlexTAWorkerRegionQuery rq_;
 
   std::vector<std::unique_ptr<taPin>> iroutes_;  // unsorted iroutes
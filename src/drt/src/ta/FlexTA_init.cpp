@@ -433,6 +433,12 @@ void FlexTAWorker::initIroute(frGuide* guide)
   Rect guideBox = guide->getBBox();
   auto layerNum = guide->getBeginLayerNum();
   bool isExt = !(getRouteBox().contains(guideBox));
+  for (const Rect& subPanel : subPanels_) {
+    if (isExt) {
+      break;
+    }
+    isExt = subPanel.contains(guideBox);
+  }
   if (isExt) {
     // extIroute empty, skip
     if (guide->getRoutes().empty()) {
@@ -0,0 +1,60 @@
+# check_drc -rules, -tile_size and -halo filters on the drc_test design
+source "helpers.tcl"
+read_lef Nangate45/Nangate45_tech.lef
+read_lef Nangate45/Nangate45_stdcell.lef
+read_def drc_test.def
+
+# Returns the sorted markers of a DRC report, each one as its type, sources
+# and bbox lines.
+proc read_markers { filename } {
+  set stream [open $filename r]
+  set lines [split [string trim [read $stream]] "\n"]
+  close $stream
+  set markers {}
+  foreach {type srcs bbox} $lines {
+    lappend markers [list [string trim $type] [string trim $srcs] \
+                       [string trim $bbox]]
+  }
+  return [lsort $markers]
+}
+
+proc report_marker_counts { markers } {
+  set counts [dict create]
+  foreach marker $markers {
+    dict incr counts [lindex $marker 0]
+  }
+  foreach type [lsort [dict keys $counts]] {
+    puts "$type: [dict get $counts $type]"
+  }
+}
+
+proc check_same_markers { name markers1 markers2 } {
+  if { $markers1 == $markers2 } {
+    puts "$name: same markers"
+  } else {
+    puts "$name: [llength $markers1] and [llength $markers2] markers differ"
+  }
+}
+
+# The streamed report matches the report written at the end.
+set all_file [make_result_file check_drc_filters_all.drc]
+drt::check_drc -output_file $all_file
+diff_files $all_file drc_test.drcok
+set all_markers [read_markers $all_file]
+report_marker_counts $all_markers
+
+set short_file [make_result_file check_drc_filters_short.drc]
+drt::check_drc -output_file $short_file -rules {Short}
+report_marker_counts [read_markers $short_file]
+
+set spacing_file [make_result_file check_drc_filters_spacing.drc]
+drt::check_drc -output_file $spacing_file -rules {{Metal Spacing} {Cut Spacing}}
+report_marker_counts [read_markers $spacing_file]
+
+set tile_file [make_result_file check_drc_filters_tile.drc]
+drt::check_drc -output_file $tile_file -tile_size 3
+check_same_markers "-tile_size 3" $all_markers [read_markers $tile_file]
+
+set halo_file [make_result_file check_drc_filters_halo.drc]
+drt::check_drc -output_file $halo_file -halo 0
+report_marker_counts [read_markers $halo_file]
@@ -0,0 +1,25 @@
+# A checkpoint is rejected when the nets of the design have changed
+source "helpers.tcl"
+
+read_lef testcase/ispd18_sample/ispd18_sample.input.lef
+read_def testcase/ispd18_sample/ispd18_sample.input.def
+read_guides testcase/ispd18_sample/ispd18_sample.input.guide
+
+set checkpoint_file [make_result_file checkpoint_mismatch.ckpt]
+
+detailed_route -droute_end_iter 1 \
+               -checkpoint_file $checkpoint_file \
+               -checkpoint_iter 1 \
+               -verbose 0
+
+foreach net [[ord::get_db_block] getNets] {
+  if { ![$net isSpecial] } {
+    $net rename "[$net getName]_renamed"
+    break
+  }
+}
+
+catch {
+  detailed_route -checkpoint_file $checkpoint_file -resume -verbose 0
+} error
+puts $error
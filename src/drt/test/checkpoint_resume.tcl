@@ -0,0 +1,25 @@
+# Routing resumed from a checkpoint gives the same result as a run that
+# wasn't interrupted (ispd18_sample)
+source "helpers.tcl"
+
+read_lef testcase/ispd18_sample/ispd18_sample.input.lef
+read_def testcase/ispd18_sample/ispd18_sample.input.def
+read_guides testcase/ispd18_sample/ispd18_sample.input.guide
+
+set checkpoint_file [make_result_file checkpoint_resume.ckpt]
+
+# stop after the first iteration, which leaves the checkpoint of iteration 0
+detailed_route -droute_end_iter 1 \
+               -checkpoint_file $checkpoint_file \
+               -checkpoint_iter 1 \
+               -verbose 0
+
+detailed_route -output_drc results/checkpoint_resume.output.drc.rpt \
+               -checkpoint_file $checkpoint_file \
+               -resume \
+               -verbose 0
+puts "violations: [detailed_route_num_drvs]"
+
+set def_file [make_result_file checkpoint_resume.def]
+write_def $def_file
+diff_files ispd18_sample.defok $def_file
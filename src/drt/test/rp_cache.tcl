@@ -0,0 +1,19 @@
+# detailed_route -rp_cache saves the via forbidden tables in the tech and
+# a later run on the same tech restores them instead of building them
+source "helpers.tcl"
+read_lef Nangate45/Nangate45_tech.lef
+read_lef Nangate45/Nangate45_stdcell.lef
+read_def gcd_nangate45_preroute.def
+read_guides gcd_nangate45.route_guide
+
+set_debug_level DRT rp_cache 1
+detailed_route -rp_cache -droute_end_iter 1 -verbose 0
+puts "cache saved: [expr {[odb::dbStringProperty_find \
+  [ord::get_db_tech] drt_rp_cache] != "NULL"}]"
+
+set db_file [make_result_file rp_cache.odb]
+write_db $db_file
+clear
+
+read_db $db_file
+detailed_route -rp_cache -droute_end_iter 1 -verbose 0
@@ -31,7 +31,9 @@
 #include <tcl.h>
 
 #include <boost/asio.hpp>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -54,7 +56,11 @@ class Distributed
   Distributed(utl::Logger* logger = nullptr);
   ~Distributed();
   void init(Tcl_Interp* tcl_interp, utl::Logger* logger);
-  void runWorker(const char* ip, unsigned short port, bool interactive);
+  // threads is the capacity the worker reports to the load balancer.
+  void runWorker(const char* ip,
+                 unsigned short port,
+                 bool interactive,
+                 int threads = 1);
   void runLoadBalancer(const char* ip,
                        unsigned short port,
                        const char* workers_domain);
@@ -67,7 +73,23 @@ class Distributed
                           const char* ip,
                           unsigned short port,
                           JobMessage& result);
-  bool sendResult(JobMessage& msg, socket& sock);
+  // Sends the REGION jobs concurrently through the load balancer at ip and
+  // port.  results[i] is the reply to msgs[i]; a job that could not be
+  // sent gets a reply of type ERROR.  Returns true if all jobs succeeded.
+  bool runRegionJobs(std::vector<JobMessage>& msgs,
+                     const char* ip,
+                     unsigned short port,
+                     std::vector<JobMessage>& results);
+  // A result with more set is partial, more results of the job follow on
+  // the same connection.
+  bool sendResult(JobMessage& msg, socket& sock, bool more = false);
+  // Sends a serialized message over a pooled connection and collects the
+  // frames of the reply, retrying on a new connection if the exchange
+  // fails.  Returns false with the reason in error if all tries failed.
+  bool exchange(const tcp::endpoint& end_point,
+                const std::string& msg,
+                std::vector<std::string>& replies,
+                std::string& error);
   void addCallBack(JobCallBack* cb);
   const std::vector<JobCallBack*>& getCallBacks() const { return callbacks_; }
 
@@ -81,8 +103,18 @@ class Distributed
     {
     }
   };
+  // Connections are kept open after a job and reused by the next job to
+  // the same end point.  Each connection serves one job at a time.
+  std::unique_ptr<socket> getConnection(const tcp::endpoint& end_point);
+  void releaseConnection(const tcp::endpoint& end_point,
+                         std::unique_ptr<socket> sock);
+
   utl::Logger* logger_;
   std::vector<EndPoint> end_points_;
+  asio::io_service connections_service_;
+  std::mutex connections_mutex_;
+  std::map<tcp::endpoint, std::vector<std::unique_ptr<socket>>>
+      idle_connections_;
   std::vector<JobCallBack*> callbacks_;
   std::vector<std::unique_ptr<Worker>> workers_;
 };
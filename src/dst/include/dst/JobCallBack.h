@@ -37,6 +37,12 @@ class JobCallBack
   virtual void onFrDesignUpdated(JobMessage& msg, socket& sock) = 0;
   virtual void onPinAccessJobReceived(JobMessage& msg, socket& sock) = 0;
   virtual void onGRDRInitJobReceived(JobMessage& msg, socket& sock) = 0;
+  // Returns true if the callback handled the REGION job, which is the case
+  // when the tool of the job is the tool of the callback.
+  virtual bool onRegionJobReceived(JobMessage& msg, socket& sock)
+  {
+    return false;
+  }
   virtual ~JobCallBack() {}
 };
 }  // namespace dst
@@ -38,6 +38,7 @@ namespace dst {
 class Distributed;
 class WorkerConnection;
 class BalancerConnection;
+class LoadBalancer;
 
 class JobDescription
 {
@@ -45,10 +46,19 @@ class JobDescription
   JobDescription() {}
   virtual ~JobDescription() {}
 
+  // Estimated cost of the job in units chosen by the job type.  The load
+  // balancer learns the runtime per unit of cost of each worker and sends a
+  // job to the worker that should finish it first.
+  void setCost(double cost) { cost_ = cost; }
+  double getCost() const { return cost_; }
+
  private:
+  double cost_{1};
+
   template <class Archive>
   void serialize(Archive& ar, const unsigned int version)
   {
+    (ar) & cost_;
   }
   friend class boost::serialization::access;
 };
@@ -63,6 +73,8 @@ class JobMessage
     BALANCER,
     PIN_ACCESS,
     GRDR_INIT,
+    WORKER_STATUS,
+    REGION,
     SUCCESS,
     ERROR,
     NONE
@@ -101,9 +113,6 @@ class JobMessage
   std::unique_ptr<JobDescription> desc_;
   std::vector<std::unique_ptr<JobDescription>> descs_;
 
-  static constexpr const char* EOP
-      = "\r\nENDOFPACKET\r\n";  // ENDOFPACKET SEQUENCE
-
   template <class Archive>
   void serialize(Archive& ar, const unsigned int version);
 
@@ -120,6 +129,7 @@ class JobMessage
   friend class dst::Distributed;
   friend class dst::WorkerConnection;
   friend class dst::BalancerConnection;
+  friend class dst::LoadBalancer;
 };
 
 }  // namespace dst
\ No newline at end of file
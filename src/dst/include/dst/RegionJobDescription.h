@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2024, The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+#include <boost/serialization/base_object.hpp>
+#include <boost/serialization/string.hpp>
+#include <string>
+
+#include "dst/JobMessage.h"
+namespace boost::serialization {
+class access;
+}
+namespace dst {
+
+// A sub-problem of a tool confined to a region of the die.  The leader
+// writes the design and the state the tool needs to the shared volume and
+// sends one REGION job per region; the worker callback of the tool rebuilds
+// the state, solves the region and replies with the result in the payload
+// of a RegionJobDescription.  The encoding of the payload is private to the
+// tool.
+class RegionJobDescription : public JobDescription
+{
+ public:
+  void setTool(const std::string& tool) { tool_ = tool; }
+  void setRegion(int xlo, int ylo, int xhi, int yhi)
+  {
+    xlo_ = xlo;
+    ylo_ = ylo;
+    xhi_ = xhi;
+    yhi_ = yhi;
+  }
+  void setDesign(const std::string& path, int version)
+  {
+    design_path_ = path;
+    design_version_ = version;
+  }
+  void setStatePath(const std::string& path) { state_path_ = path; }
+  void setPayload(const std::string& payload) { payload_ = payload; }
+
+  const std::string& getTool() const { return tool_; }
+  int getXlo() const { return xlo_; }
+  int getYlo() const { return ylo_; }
+  int getXhi() const { return xhi_; }
+  int getYhi() const { return yhi_; }
+  const std::string& getDesignPath() const { return design_path_; }
+  // Bumped by the leader whenever the design at the path is rewritten, so
+  // a worker only reloads the design when it changed.
+  int getDesignVersion() const { return design_version_; }
+  const std::string& getStatePath() const { return state_path_; }
+  const std::string& getPayload() const { return payload_; }
+
+ private:
+  std::string tool_;
+  int xlo_{0};
+  int ylo_{0};
+  int xhi_{0};
+  int yhi_{0};
+  std::string design_path_;
+  int design_version_{0};
+  std::string state_path_;
+  std::string payload_;
+
+  template <class Archive>
+  void serialize(Archive& ar, const unsigned int version)
+  {
+    (ar) & boost::serialization::base_object<dst::JobDescription>(*this);
+    (ar) & tool_;
+    (ar) & xlo_;
+    (ar) & ylo_;
+    (ar) & xhi_;
+    (ar) & yhi_;
+    (ar) & design_path_;
+    (ar) & design_version_;
+    (ar) & state_path_;
+    (ar) & payload_;
+  }
+  friend class boost::serialization::access;
+};
+}  // namespace dst
@@ -36,6 +36,7 @@
 #include <boost/bind/bind.hpp>
 #include <boost/serialization/export.hpp>
 #include <boost/thread/thread.hpp>
+#include <chrono>
 #include <mutex>
 #include <thread>
 
@@ -43,12 +44,16 @@
 #include "dst/BalancerJobDescription.h"
 #include "dst/BroadcastJobDescription.h"
 #include "dst/Distributed.h"
+#include "dst/RegionJobDescription.h"
+#include "dst/WorkerStatusJobDescription.h"
 #include "utl/Logger.h"
 
 using namespace dst;
 
 BOOST_CLASS_EXPORT(dst::BalancerJobDescription)
 BOOST_CLASS_EXPORT(dst::BroadcastJobDescription)
+BOOST_CLASS_EXPORT(dst::RegionJobDescription)
+BOOST_CLASS_EXPORT(dst::WorkerStatusJobDescription)
 
 BalancerConnection::BalancerConnection(asio::io_service& io_service,
                                        LoadBalancer* owner,
@@ -64,32 +69,49 @@ tcp::socket& BalancerConnection::socket()
 
 void BalancerConnection::start()
 {
-  async_read_until(
-      sock_,
-      in_packet_,
-      JobMessage::EOP,
-      [me = shared_from_this()](boost::system::error_code const& ec,
-                                std::size_t bytes_xfer) {
-        boost::thread t(&BalancerConnection::handle_read, me, ec, bytes_xfer);
-        t.detach();
-      });
+  async_read(sock_,
+             asio::buffer(header_),
+             [me = shared_from_this()](boost::system::error_code const& ec,
+                                       std::size_t /* bytes_xfer */) {
+               me->read_payload(ec);
+             });
+}
+
+void BalancerConnection::read_payload(boost::system::error_code const& err)
+{
+  if (err) {
+    handle_read(err, 0);
+    return;
+  }
+  bool more;
+  const std::size_t size = decodeFrameHeader(header_.data(), more);
+  if (size > frame_max_size) {
+    handle_read(asio::error::message_size, 0);
+    return;
+  }
+  payload_.resize(size);
+  async_read(sock_,
+             asio::buffer(payload_),
+             [me = shared_from_this()](boost::system::error_code const& ec,
+                                       std::size_t bytes_xfer) {
+               boost::thread t(
+                   &BalancerConnection::handle_read, me, ec, bytes_xfer);
+               t.detach();
+             });
 }
 
 void BalancerConnection::handle_read(boost::system::error_code const& err,
                                      size_t bytes_transferred)
 {
   if (!err) {
-    boost::system::error_code error;
-    std::string data{buffers_begin(in_packet_.data()),
-                     buffers_begin(in_packet_.data()) + bytes_transferred};
+    const std::string& data = payload_;
     JobMessage msg(JobMessage::NONE);
-    if (!JobMessage::serializeMsg(JobMessage::READ, msg, data)) {
+    if (!JobMessage::serializeMsg(JobMessage::READ, msg, payload_)) {
       logger_->warn(utl::DST,
                     42,
                     "Received malformed msg {} from port {}",
                     data,
                     sock_.remote_endpoint().port());
-      asio::write(sock_, asio::buffer("0"), error);
       sock_.close();
       return;
     }
@@ -97,7 +119,16 @@ void BalancerConnection::handle_read(boost::system::error_code const& err,
       case JobMessage::UNICAST: {
         ip::address workerAddress;
         unsigned short port;
-        owner_->getNextWorker(workerAddress, port);
+        const JobMessage::JobType type = msg.getJobType();
+        const double cost = msg.getJobDescription() != nullptr
+                                ? msg.getJobDescription()->getCost()
+                                : 1;
+        double cost_ahead = 0;
+        if (type == JobMessage::BALANCER) {
+          owner_->getNextWorker(workerAddress, port);
+        } else {
+          owner_->assignJob(type, cost, workerAddress, port, cost_ahead);
+        }
         if (workerAddress.is_unspecified()) {
           logger_->warn(utl::DST, 6, "No workers available");
           sock_.close();
@@ -110,59 +141,62 @@ void BalancerConnection::handle_read(boost::system::error_code const& err,
             desc->setWorkerPort(port);
             reply.setJobDescription(std::move(uDesc));
             owner_->dist_->sendResult(reply, sock_);
-            sock_.close();
           } else {
-            asio::io_service io_service;
-            tcp::socket socket(io_service);
             int failed_workers_trials = 0;
-            asio::streambuf receive_buffer;
+            std::vector<std::string> replies;
+            std::string error;
             bool failure = true;
             while (failure) {
-              try {
-                socket.connect(tcp::endpoint(workerAddress, port));
-                asio::write(socket, in_packet_);
-                asio::read(socket, receive_buffer, asio::transfer_all());
+              const auto start = std::chrono::steady_clock::now();
+              const tcp::endpoint end_point(workerAddress, port);
+              if (owner_->dist_->exchange(end_point, data, replies, error)) {
+                const std::chrono::duration<double> elapsed
+                    = std::chrono::steady_clock::now() - start;
+                owner_->finishJob(workerAddress,
+                                  port,
+                                  type,
+                                  cost,
+                                  cost_ahead,
+                                  elapsed.count());
                 failure = false;
-              } catch (std::exception const& ex) {
-                if (socket.is_open()) {
-                  socket.close();
-                }
-                if (std::string(ex.what()).find("read: End of file")
-                    != std::string::npos) {
-                  // Since asio::transfer_all() used with a stream buffer it
-                  // always reach an eof file exception!
-                  failure = false;
-                  break;
-                }
+                break;
+              }
+              logger_->warn(utl::DST,
+                            204,
+                            "Exception thrown: {}. worker with ip \"{}\" and "
+                            "port \"{}\" will be pushed back the queue.",
+                            error,
+                            workerAddress,
+                            port);
+              owner_->finishJob(
+                  workerAddress, port, type, cost, cost_ahead, -1);
+              owner_->punishWorker(workerAddress, port);
+              failed_workers_trials++;
+              if (failed_workers_trials == MAX_FAILED_WORKERS_TRIALS) {
                 logger_->warn(utl::DST,
-                              204,
-                              "Exception thrown: {}. worker with ip \"{}\" and "
-                              "port \"{}\" will be pushed back the queue.",
-                              ex.what(),
-                              workerAddress,
-                              port);
-                owner_->punishWorker(workerAddress, port);
-                failed_workers_trials++;
-                if (failed_workers_trials == MAX_FAILED_WORKERS_TRIALS) {
-                  logger_->warn(utl::DST,
-                                205,
-                                "Maximum of {} failing workers reached, "
-                                "relaying error to leader.",
-                                failed_workers_trials);
-                  break;
-                }
-                owner_->getNextWorker(workerAddress, port);
+                              205,
+                              "Maximum of {} failing workers reached, "
+                              "relaying error to leader.",
+                              failed_workers_trials);
+                break;
+              }
+              if (!owner_->assignJob(
+                      type, cost, workerAddress, port, cost_ahead)) {
+                break;
               }
             }
             if (failure) {
               JobMessage result(JobMessage::ERROR);
-              std::string msgStr;
-              JobMessage::serializeMsg(JobMessage::WRITE, result, msgStr);
-              asio::write(sock_, asio::buffer(msgStr), error);
+              owner_->dist_->sendResult(result, sock_);
             } else {
-              asio::write(sock_, receive_buffer, error);
+              try {
+                for (std::size_t i = 0; i < replies.size(); i++) {
+                  writeFrame(sock_, replies[i], i + 1 < replies.size());
+                }
+              } catch (const boost::system::system_error& ex) {
+                sock_.close();
+              }
             }
-            sock_.close();
           }
         }
         break;
@@ -171,36 +205,28 @@ void BalancerConnection::handle_read(boost::system::error_code const& err,
         std::lock_guard<std::mutex> lock(owner_->workers_mutex_);
         owner_->broadcastData.push_back(data);
         asio::thread_pool pool(owner_->workers_.size());
-        auto workers_copy = owner_->workers_;
         std::mutex broadcast_failure_mutex;
         std::vector<std::pair<ip::address, unsigned short>> failed_workers;
-        while (!workers_copy.empty()) {
-          auto worker = workers_copy.top();
-          workers_copy.pop();
+        Distributed* dist = owner_->dist_;
+        for (const auto& worker : owner_->workers_) {
           asio::post(
               pool,
-              [worker, data, &failed_workers, &broadcast_failure_mutex]() {
-                try {
-                  asio::io_service io_service;
-                  tcp::socket socket(io_service);
-                  socket.connect(tcp::endpoint(worker.ip, worker.port));
-                  asio::write(socket, asio::buffer(data));
-                  asio::streambuf receive_buffer;
-                  asio::read(socket, receive_buffer, asio::transfer_all());
-                } catch (std::exception const& ex) {
-                  if (std::string(ex.what()).find("read: End of file")
-                      == std::string::npos) {
-                    // Since asio::transfer_all() used with a stream buffer it
-                    // always reach an eof file exception!
-                    std::lock_guard<std::mutex> lock(broadcast_failure_mutex);
-                    failed_workers.emplace_back(worker.ip, worker.port);
-                  }
+              [worker,
+               data,
+               dist,
+               &failed_workers,
+               &broadcast_failure_mutex]() {
+                const tcp::endpoint end_point(worker.ip, worker.port);
+                std::vector<std::string> replies;
+                std::string error;
+                if (!dist->exchange(end_point, data, replies, error)) {
+                  std::lock_guard<std::mutex> lock(broadcast_failure_mutex);
+                  failed_workers.emplace_back(worker.ip, worker.port);
                 }
               });
         }
         pool.join();
         JobMessage result(JobMessage::SUCCESS);
-        std::string msgStr;
         unsigned short successBroadcast
             = owner_->workers_.size() - failed_workers.size();
         if (!failed_workers.empty()) {
@@ -221,13 +247,17 @@ void BalancerConnection::handle_read(boost::system::error_code const& err,
         auto desc = uDesc.get();
         desc->setWorkersCount(successBroadcast);
         result.setJobDescription(std::move(uDesc));
-        JobMessage::serializeMsg(JobMessage::WRITE, result, msgStr);
-        asio::write(sock_, asio::buffer(msgStr), error);
-        sock_.close();
+        owner_->dist_->sendResult(result, sock_);
         break;
       }
     }
-
+    // The connection stays open for the next job of the same client.
+    if (sock_.is_open()) {
+      start();
+    }
+  } else if (err == asio::error::eof) {
+    // The client closed its connection.
+    sock_.close();
   } else {
     logger_->warn(utl::DST,
                   8,
@@ -27,9 +27,13 @@
  */
 
 #pragma once
+#include <array>
 #include <boost/asio.hpp>
 #include <boost/enable_shared_from_this.hpp>
 #include <boost/make_shared.hpp>
+#include <string>
+
+#include "Frame.h"
 
 namespace asio = boost::asio;
 namespace ip = asio::ip;
@@ -57,13 +61,15 @@ class BalancerConnection
   }
   tcp::socket& socket();
   void start();
+  void read_payload(boost::system::error_code const& err);
   void handle_read(boost::system::error_code const& err,
                    size_t bytes_transferred);
   LoadBalancer* getOwner() const { return owner_; }
 
  private:
   tcp::socket sock_;
-  asio::streambuf in_packet_;
+  std::array<unsigned char, frame_header_size> header_;
+  std::string payload_;
   utl::Logger* logger_;
   LoadBalancer* owner_;
   const int MAX_FAILED_WORKERS_TRIALS = 3;
@@ -28,11 +28,15 @@
 
 #include "dst/Distributed.h"
 
+#include <algorithm>
 #include <boost/asio.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <boost/system/system_error.hpp>
 #include <boost/thread/thread.hpp>
 
+#include "Frame.h"
 #include "LoadBalancer.h"
 #include "Worker.h"
 #include "dst/JobCallBack.h"
@@ -41,6 +45,7 @@
 #include "utl/Logger.h"
 namespace dst {
 const int MAX_TRIES = 5;
+const size_t MAX_REGION_CONNECTIONS = 64;
 }
 
 using namespace dst;
@@ -76,10 +81,11 @@ void Distributed::init(Tcl_Interp* tcl_interp, utl::Logger* logger)
 
 void Distributed::runWorker(const char* ip,
                             unsigned short port,
-                            bool interactive)
+                            bool interactive,
+                            int threads)
 {
   try {
-    auto uWorker = std::make_unique<Worker>(this, logger_, ip, port);
+    auto uWorker = std::make_unique<Worker>(this, logger_, ip, port, threads);
     auto worker = uWorker.get();
     workers_.push_back(std::move(uWorker));
     if (interactive) {
@@ -115,43 +121,61 @@ void Distributed::addWorkerAddress(const char* address, unsigned short port)
 {
   end_points_.emplace_back(address, port);
 }
-// TODO: exponential backoff
-bool sendMsg(dst::socket& sock, const std::string& msg, std::string& errorMsg)
+std::unique_ptr<dst::socket> Distributed::getConnection(
+    const tcp::endpoint& end_point)
 {
-  int tries = 0;
-  while (tries++ < MAX_TRIES) {
-    boost::system::error_code error;
-    sock.wait(asio::ip::tcp::socket::wait_write);
-    write(sock, asio::buffer(msg), error);
-    if (!error) {
-      errorMsg.clear();
-      return true;
+  {
+    std::lock_guard<std::mutex> lock(connections_mutex_);
+    auto& idle = idle_connections_[end_point];
+    if (!idle.empty()) {
+      auto sock = std::move(idle.back());
+      idle.pop_back();
+      return sock;
     }
-    errorMsg = error.message();
   }
-  return false;
+  auto sock = std::make_unique<dst::socket>(connections_service_);
+  sock->connect(end_point);
+  sock->set_option(tcp::no_delay(true));
+  return sock;
 }
 
-bool readMsg(dst::socket& sock, std::string& dataStr)
+void Distributed::releaseConnection(const tcp::endpoint& end_point,
+                                    std::unique_ptr<dst::socket> sock)
 {
-  boost::system::error_code error;
-  asio::streambuf receive_buffer;
-  sock.wait(asio::ip::tcp::socket::wait_read);
-  asio::read(sock, receive_buffer, asio::transfer_all(), error);
-  if (error && error != asio::error::eof) {
-    dataStr = error.message();
-    return false;
-  }
+  std::lock_guard<std::mutex> lock(connections_mutex_);
+  idle_connections_[end_point].push_back(std::move(sock));
+}
 
-  auto bufs = receive_buffer.data();
-  auto offset = asio::buffers_begin(bufs) + receive_buffer.size();
-  std::string result;
-  if (offset <= asio::buffers_end(bufs)) {
-    result = std::string(asio::buffers_begin(bufs), offset);
+// TODO: exponential backoff
+bool Distributed::exchange(const tcp::endpoint& end_point,
+                           const std::string& msg,
+                           std::vector<std::string>& replies,
+                           std::string& error)
+{
+  int tries = 0;
+  while (tries++ < MAX_TRIES) {
+    replies.clear();
+    std::unique_ptr<dst::socket> sock;
+    try {
+      // A pooled connection may have been closed by the other side since
+      // its last job; that shows up as an error here and the next try uses
+      // a new connection.
+      sock = getConnection(end_point);
+      writeFrame(*sock, msg);
+      bool more = true;
+      while (more) {
+        replies.emplace_back();
+        more = readFrame(*sock, replies.back());
+      }
+    } catch (const boost::system::system_error& ex) {
+      error = ex.what();
+      continue;
+    }
+    releaseConnection(end_point, std::move(sock));
+    error.clear();
+    return true;
   }
-
-  dataStr = result;
-  return !dataStr.empty();
+  return false;
 }
 
 bool Distributed::sendJob(JobMessage& msg,
@@ -159,136 +183,98 @@ bool Distributed::sendJob(JobMessage& msg,
                           unsigned short port,
                           JobMessage& result)
 {
-  int tries = 0;
   std::string msgStr;
   if (!JobMessage::serializeMsg(JobMessage::WRITE, msg, msgStr)) {
     logger_->warn(utl::DST, 112, "Serializing JobMessage failed");
     return false;
   }
-  std::string resultStr;
-  while (tries++ < MAX_TRIES) {
-    asio::io_service io_service;
-    dst::socket sock(io_service);
-    try {
-      sock.connect(tcp::endpoint(ip::address::from_string(ip), port));
-    } catch (const boost::system::system_error& ex) {
-      logger_->warn(utl::DST,
-                    113,
-                    "Trial {}, socket connection failed with message \"{}\"",
-                    tries,
-                    ex.what());
-      continue;
-    }
-    bool ok = sendMsg(sock, msgStr, resultStr);
-    if (!ok) {
-      continue;
-    }
-    ok = readMsg(sock, resultStr);
-    if (!ok) {
-      continue;
-    }
-    if (!JobMessage::serializeMsg(JobMessage::READ, result, resultStr)) {
-      continue;
-    }
-    if (sock.is_open()) {
-      sock.close();
-    }
-    return true;
+  std::vector<std::string> replies;
+  std::string error;
+  const tcp::endpoint end_point(ip::address::from_string(ip), port);
+  if (!exchange(end_point, msgStr, replies, error)) {
+    logger_->warn(
+        utl::DST, 114, "Sending job failed with message \"{}\"", error);
+    return false;
   }
-  if (resultStr.empty()) {
-    resultStr = "MAX_TRIES reached";
+  if (!JobMessage::serializeMsg(JobMessage::READ, result, replies.back())) {
+    logger_->warn(utl::DST, 113, "Deserializing the job result failed");
+    return false;
   }
-  logger_->warn(
-      utl::DST, 114, "Sending job failed with message \"{}\"", resultStr);
-  return false;
+  return true;
 }
 
-inline bool getNextMsg(std::string& haystack,
-                       const std::string& needle,
-                       std::string& result)
-{
-  std::size_t found = haystack.find(needle);
-  if (found != std::string::npos) {
-    result = haystack.substr(0, found + needle.size());
-    haystack.erase(0, found + needle.size());
-    return true;
-  }
-  return false;
-}
 bool Distributed::sendJobMultiResult(JobMessage& msg,
                                      const char* ip,
                                      unsigned short port,
                                      JobMessage& result)
 {
-  int tries = 0;
   std::string msgStr;
   if (!JobMessage::serializeMsg(JobMessage::WRITE, msg, msgStr)) {
     logger_->warn(utl::DST, 12, "Serializing JobMessage failed");
     return false;
   }
-  std::string resultStr;
-  while (tries++ < MAX_TRIES) {
-    asio::io_service io_service;
-    dst::socket sock(io_service);
-    try {
-      sock.connect(tcp::endpoint(ip::address::from_string(ip), port));
-    } catch (const boost::system::system_error& ex) {
-      logger_->warn(utl::DST,
-                    13,
-                    "Socket connection failed with message \"{}\"",
-                    ex.what());
-      return false;
-    }
-    boost::asio::ip::tcp::no_delay option(true);
-    sock.set_option(option);
-    bool ok = sendMsg(sock, msgStr, resultStr);
-    if (!ok) {
-      continue;
-    }
-    ok = readMsg(sock, resultStr);
-    if (!ok) {
-      continue;
-    }
-    std::string split;
-    while (getNextMsg(resultStr, JobMessage::EOP, split)) {
-      JobMessage tmp;
-      if (!JobMessage::serializeMsg(JobMessage::READ, tmp, split)) {
-        logger_->error(utl::DST, 9999, "Problem in deserialize {}", split);
-      } else {
-        result.addJobDescription(std::move(tmp.getJobDescriptionRef()));
-      }
-    }
-    result.setJobType(JobMessage::SUCCESS);
-    if (sock.is_open()) {
-      sock.close();
+  std::vector<std::string> replies;
+  std::string error;
+  const tcp::endpoint end_point(ip::address::from_string(ip), port);
+  if (!exchange(end_point, msgStr, replies, error)) {
+    logger_->warn(
+        utl::DST, 14, "Sending job failed with message \"{}\"", error);
+    return false;
+  }
+  for (auto& reply : replies) {
+    JobMessage tmp;
+    if (!JobMessage::serializeMsg(JobMessage::READ, tmp, reply)) {
+      logger_->error(utl::DST, 9999, "Problem in deserialize {}", reply);
+    } else {
+      result.addJobDescription(std::move(tmp.getJobDescriptionRef()));
     }
-    return true;
   }
-  if (resultStr.empty()) {
-    resultStr = "MAX_TRIES reached";
+  result.setJobType(JobMessage::SUCCESS);
+  return true;
+}
+
+bool Distributed::runRegionJobs(std::vector<JobMessage>& msgs,
+                                const char* ip,
+                                unsigned short port,
+                                std::vector<JobMessage>& results)
+{
+  results.clear();
+  results.resize(msgs.size());
+  std::vector<char> succeeded(msgs.size(), false);
+  // The balancer spreads the jobs over the workers, each job only occupies
+  // a connection here while it waits for its reply.
+  const size_t threads
+      = std::clamp<size_t>(msgs.size(), 1, MAX_REGION_CONNECTIONS);
+  asio::thread_pool pool(threads);
+  for (size_t i = 0; i < msgs.size(); i++) {
+    asio::post(pool, [this, &msgs, &results, &succeeded, ip, port, i]() {
+      succeeded[i] = sendJob(msgs[i], ip, port, results[i])
+                     && results[i].getJobType() == JobMessage::SUCCESS;
+      if (!succeeded[i]) {
+        results[i].setJobType(JobMessage::ERROR);
+      }
+    });
   }
-  logger_->warn(
-      utl::DST, 14, "Sending job failed with message \"{}\"", resultStr);
-  return false;
+  pool.join();
+  return std::all_of(
+      succeeded.begin(), succeeded.end(), [](char ok) { return ok; });
 }
 
-bool Distributed::sendResult(JobMessage& msg, dst::socket& sock)
+bool Distributed::sendResult(JobMessage& msg, dst::socket& sock, bool more)
 {
   std::string msgStr;
   if (!JobMessage::serializeMsg(JobMessage::WRITE, msg, msgStr)) {
     logger_->warn(utl::DST, 20, "Serializing result JobMessage failed");
     return false;
   }
-  int tries = 0;
-  std::string error;
-  while (tries++ < MAX_TRIES) {
-    if (sendMsg(sock, msgStr, error)) {
-      return true;
-    }
+  try {
+    writeFrame(sock, msgStr, more);
+  } catch (const boost::system::system_error& ex) {
+    logger_->warn(
+        utl::DST, 22, "Sending result failed with message \"{}\"", ex.what());
+    return false;
   }
-  logger_->warn(
-      utl::DST, 22, "Sending result failed with message \"{}\"", error);
-  return false;
+  return true;
 }
 
 void Distributed::addCallBack(JobCallBack* cb)
@@ -38,8 +38,9 @@
 void run_worker_cmd(
     const char* host, unsigned short port, bool interactive)
 {
-  auto* distributed = ord::OpenRoad::openRoad()->getDistributed();
-  distributed->runWorker(host, port, interactive);
+  auto* openroad = ord::OpenRoad::openRoad();
+  openroad->getDistributed()->runWorker(
+      host, port, interactive, openroad->getThreadCount());
 }
 
 void run_load_balancer(
@@ -29,6 +29,7 @@
 sta::define_cmd_args "run_worker" {
     [-host host]
     [-port port]
+    [-threads threads]
     [-i]
 }
 proc run_worker { args } {
@@ -46,6 +47,9 @@ proc run_worker { args } {
   } else {
     utl::error DST 3 "-port is required in run_worker cmd."
   }
+  if { [info exists keys(-threads)] } {
+    set_thread_count $keys(-threads)
+  }
   set interactive [info exists flags(-i)]
   dst::run_worker_cmd $host $port $interactive
 }
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024, The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <array>
+#include <boost/asio.hpp>
+#include <cstdint>
+#include <string>
+
+namespace dst {
+
+// Every message on a dst connection is a frame: an 8 byte big endian header
+// holding the payload size, followed by the serialized JobMessage.  The top
+// bit of the header marks a partial result, more frames of the same reply
+// follow.  Connections stay open between jobs, so the end of a reply is
+// known from the framing instead of the peer closing the socket.
+constexpr std::size_t frame_header_size = 8;
+constexpr uint64_t frame_more_flag = uint64_t(1) << 63;
+// Larger frames are refused so a corrupt or hostile header can't make the
+// reader allocate an arbitrary amount of memory.
+constexpr std::size_t frame_max_size = std::size_t(1) << 30;
+
+inline std::array<unsigned char, frame_header_size> encodeFrameHeader(
+    std::size_t size,
+    bool more)
+{
+  uint64_t header = size | (more ? frame_more_flag : 0);
+  std::array<unsigned char, frame_header_size> bytes;
+  for (int i = frame_header_size - 1; i >= 0; i--) {
+    bytes[i] = header & 0xff;
+    header >>= 8;
+  }
+  return bytes;
+}
+
+// Returns the payload size.
+inline std::size_t decodeFrameHeader(const unsigned char* bytes, bool& more)
+{
+  uint64_t header = 0;
+  for (std::size_t i = 0; i < frame_header_size; i++) {
+    header = (header << 8) | bytes[i];
+  }
+  more = (header & frame_more_flag) != 0;
+  return header & ~frame_more_flag;
+}
+
+// Both throw boost::system::system_error on failure, with message_size for
+// a payload over frame_max_size.
+template <typename Socket>
+void writeFrame(Socket& sock, const std::string& payload, bool more = false)
+{
+  if (payload.size() > frame_max_size) {
+    throw boost::system::system_error(boost::asio::error::message_size);
+  }
+  const auto header = encodeFrameHeader(payload.size(), more);
+  const std::array<boost::asio::const_buffer, 2> buffers{
+      boost::asio::buffer(header), boost::asio::buffer(payload)};
+  boost::asio::write(sock, buffers);
+}
+
+// Returns whether more frames of the same reply follow.
+template <typename Socket>
+bool readFrame(Socket& sock, std::string& payload)
+{
+  std::array<unsigned char, frame_header_size> header;
+  boost::asio::read(sock, boost::asio::buffer(header));
+  bool more;
+  const std::size_t size = decodeFrameHeader(header.data(), more);
+  if (size > frame_max_size) {
+    throw boost::system::system_error(boost::asio::error::message_size);
+  }
+  payload.resize(size);
+  boost::asio::read(sock, boost::asio::buffer(payload));
+  return more;
+}
+
+}  // namespace dst
@@ -38,22 +38,12 @@
 
 using namespace dst;
 
-template <class Archive>
-inline bool is_loading(const Archive& ar)
-{
-  return std::is_same<typename Archive::is_loading, boost::mpl::true_>::value;
-}
-
 template <class Archive>
 void JobMessage::serialize(Archive& ar, const unsigned int version)
 {
   (ar) & msg_type_;
   (ar) & job_type_;
   (ar) & desc_;
-  if (!is_loading(ar)) {
-    std::string eop = EOP;
-    (ar) & eop;
-  }
 }
 
 bool JobMessage::serializeMsg(SerializeType type,
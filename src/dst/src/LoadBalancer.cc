@@ -28,27 +28,33 @@
 
 #include "LoadBalancer.h"
 
+#include <algorithm>
 #include <boost/bind/bind.hpp>
 #include <boost/thread/thread.hpp>
 
+#include "dst/Distributed.h"
+#include "dst/WorkerStatusJobDescription.h"
 #include "utl/Logger.h"
 
 using boost::asio::ip::udp;
 
 namespace dst {
 
+// Weight of a new runtime sample in the runtime per unit of cost of a
+// worker.
+constexpr double seconds_per_cost_weight = 0.3;
+constexpr int max_worker_failures = 16;
+
 void LoadBalancer::start_accept()
 {
   if (jobs_ != 0 && jobs_ % 100 == 0) {
     logger_->info(utl::DST, 7, "Processed {} jobs", jobs_);
-    auto copy = workers_;
-    while (!copy.empty()) {
-      auto worker = copy.top();
+    std::lock_guard<std::mutex> lock(workers_mutex_);
+    for (const auto& worker : workers_) {
       logger_->report("Worker {}/{} handled {} jobs",
                       worker.ip,
                       worker.port,
-                      worker.priority);
-      copy.pop();
+                      worker.jobs);
     }
   }
   jobs_++;
@@ -93,73 +99,198 @@ bool LoadBalancer::addWorker(const std::string& ip, unsigned short port)
 {
   std::lock_guard<std::mutex> lock(workers_mutex_);
   bool validWorkerState = true;
-  if (!broadcastData.empty()) {
-    for (auto data : broadcastData) {
-      try {
-        asio::io_service io_service;
-        tcp::socket socket(io_service);
-        socket.connect(tcp::endpoint(ip::address::from_string(ip), port));
-        asio::write(socket, asio::buffer(data));
-        asio::streambuf receive_buffer;
-        asio::read(socket, receive_buffer, asio::transfer_all());
-      } catch (std::exception const& ex) {
-        if (std::string(ex.what()).find("read: End of file")
-            == std::string::npos) {
-          // Since asio::transfer_all() used with a stream buffer it
-          // always reach an eof file exception!
-          validWorkerState = false;
-          break;
-        }
-      }
+  const tcp::endpoint end_point(ip::address::from_string(ip), port);
+  for (const auto& data : broadcastData) {
+    std::vector<std::string> replies;
+    std::string error;
+    if (!dist_->exchange(end_point, data, replies, error)) {
+      validWorkerState = false;
+      break;
     }
   }
   if (validWorkerState) {
-    workers_.push(worker(ip::address::from_string(ip), port, 0));
+    worker new_worker(ip::address::from_string(ip), port);
+    new_worker.capacity = queryCapacity(ip, port);
+    workers_.push_back(new_worker);
   }
   return validWorkerState;
 }
-void LoadBalancer::updateWorker(const ip::address& ip, unsigned short port)
+
+// Asks the worker for its thread count.  A worker that is not up yet or
+// does not answer counts as a single thread.
+int LoadBalancer::queryCapacity(const std::string& ip, unsigned short port)
 {
-  std::lock_guard<std::mutex> lock(workers_mutex_);
-  std::priority_queue<worker, std::vector<worker>, CompareWorker> newQueue;
-  while (!workers_.empty()) {
-    auto worker = workers_.top();
-    workers_.pop();
+  JobMessage msg(JobMessage::WORKER_STATUS);
+  std::string msg_str;
+  if (!JobMessage::serializeMsg(JobMessage::WRITE, msg, msg_str)) {
+    return 1;
+  }
+  std::vector<std::string> replies;
+  std::string error;
+  if (!dist_->exchange(tcp::endpoint(ip::address::from_string(ip), port),
+                       msg_str,
+                       replies,
+                       error)) {
+    return 1;
+  }
+  JobMessage reply;
+  if (!JobMessage::serializeMsg(JobMessage::READ, reply, replies.back())
+      || reply.getJobType() != JobMessage::SUCCESS) {
+    return 1;
+  }
+  auto desc = dynamic_cast<WorkerStatusJobDescription*>(
+      reply.getJobDescription());
+  if (desc == nullptr) {
+    return 1;
+  }
+  return std::max(1, desc->getCapacity());
+}
+
+LoadBalancer::worker* LoadBalancer::findWorker(const ip::address& ip,
+                                               unsigned short port)
+{
+  for (auto& worker : workers_) {
     if (worker.ip == ip && worker.port == port) {
-      worker.priority--;
+      return &worker;
     }
-    newQueue.push(worker);
   }
-  workers_.swap(newQueue);
+  return nullptr;
 }
+
+// Workers that have not run a job of this type yet are assumed to be as
+// fast per thread as the ones that have.
+double LoadBalancer::secondsPerCost(const worker& w,
+                                    JobMessage::JobType type) const
+{
+  auto it = w.seconds_per_cost.find(type);
+  if (it != w.seconds_per_cost.end()) {
+    return it->second;
+  }
+  double thread_seconds = 0;
+  int measured = 0;
+  for (const auto& other : workers_) {
+    auto other_it = other.seconds_per_cost.find(type);
+    if (other_it != other.seconds_per_cost.end()) {
+      thread_seconds += other_it->second * other.capacity;
+      measured++;
+    }
+  }
+  if (measured == 0) {
+    return 1.0 / w.capacity;
+  }
+  return thread_seconds / measured / w.capacity;
+}
+
+// A worker runs its jobs one after the other, so a new job finishes after
+// the cost in flight on the worker plus its own.  Failing workers are
+// penalized until they finish a job again.
+LoadBalancer::worker* LoadBalancer::pickWorker(JobMessage::JobType type,
+                                               double cost)
+{
+  worker* best = nullptr;
+  double best_finish = 0;
+  for (auto& worker : workers_) {
+    const double finish = (worker.in_flight_cost + cost)
+                          * secondsPerCost(worker, type)
+                          * (1 + 2 * worker.failures);
+    if (best == nullptr || finish < best_finish
+        || (finish == best_finish
+            && worker.lookups + worker.in_flight
+                   < best->lookups + best->in_flight)) {
+      best = &worker;
+      best_finish = finish;
+    }
+  }
+  return best;
+}
+
+void LoadBalancer::updateWorker(const ip::address& ip, unsigned short port)
+{
+  std::lock_guard<std::mutex> lock(workers_mutex_);
+  worker* w = findWorker(ip, port);
+  if (w != nullptr && w->lookups > 0) {
+    w->lookups--;
+  }
+}
+
 void LoadBalancer::getNextWorker(ip::address& ip, unsigned short& port)
 {
   std::lock_guard<std::mutex> lock(workers_mutex_);
-  if (!workers_.empty()) {
-    worker w = workers_.top();
-    workers_.pop();
-    ip = w.ip;
-    port = w.port;
-    if (w.priority != std::numeric_limits<unsigned short>::max()) {
-      w.priority++;
-    }
-    workers_.push(w);
+  worker* w = pickWorker(JobMessage::NONE, 1);
+  if (w != nullptr) {
+    ip = w->ip;
+    port = w->port;
+    w->lookups++;
+  }
+}
+
+bool LoadBalancer::assignJob(JobMessage::JobType type,
+                             double cost,
+                             ip::address& ip,
+                             unsigned short& port,
+                             double& cost_ahead)
+{
+  std::lock_guard<std::mutex> lock(workers_mutex_);
+  worker* w = pickWorker(type, cost);
+  if (w == nullptr) {
+    return false;
   }
+  ip = w->ip;
+  port = w->port;
+  cost_ahead = w->in_flight_cost;
+  w->in_flight++;
+  w->in_flight_cost += cost;
+  return true;
+}
+
+void LoadBalancer::finishJob(const ip::address& ip,
+                             unsigned short port,
+                             JobMessage::JobType type,
+                             double cost,
+                             double cost_ahead,
+                             double seconds)
+{
+  std::lock_guard<std::mutex> lock(workers_mutex_);
+  worker* w = findWorker(ip, port);
+  if (w == nullptr) {
+    return;
+  }
+  w->in_flight = std::max(0, w->in_flight - 1);
+  w->in_flight_cost = std::max(0.0, w->in_flight_cost - cost);
+  if (seconds < 0) {
+    return;
+  }
+  w->failures = 0;
+  w->jobs++;
+  // The reply came after the jobs ahead of this one were done too.
+  const double sample = seconds / std::max(cost + cost_ahead, 1e-9);
+  auto it = w->seconds_per_cost.find(type);
+  if (it == w->seconds_per_cost.end()) {
+    w->seconds_per_cost[type] = sample;
+  } else {
+    it->second = (1 - seconds_per_cost_weight) * it->second
+                 + seconds_per_cost_weight * sample;
+  }
+  debugPrint(logger_,
+             utl::DST,
+             "load_balancer",
+             1,
+             "Worker {}/{} finished a job of cost {} in {:.3f} s, {:.3g} s per "
+             "unit of cost.",
+             ip,
+             port,
+             cost,
+             seconds,
+             w->seconds_per_cost[type]);
 }
 
 void LoadBalancer::punishWorker(const ip::address& ip, unsigned short port)
 {
   std::lock_guard<std::mutex> lock(workers_mutex_);
-  std::priority_queue<worker, std::vector<worker>, CompareWorker> newQueue;
-  while (!workers_.empty()) {
-    auto worker = workers_.top();
-    workers_.pop();
-    if (worker.ip == ip && worker.port == port) {
-      worker.priority = worker.priority == 0 ? 2 : worker.priority * 2;
-    }
-    newQueue.push(worker);
+  worker* w = findWorker(ip, port);
+  if (w != nullptr) {
+    w->failures = std::min(w->failures + 1, max_worker_failures);
   }
-  workers_.swap(newQueue);
 }
 
 void LoadBalancer::removeWorker(const ip::address& ip,
@@ -169,16 +300,12 @@ void LoadBalancer::removeWorker(const ip::address& ip,
   if (lock) {
     workers_mutex_.lock();
   }
-  std::priority_queue<worker, std::vector<worker>, CompareWorker> newQueue;
-  while (!workers_.empty()) {
-    auto worker = workers_.top();
-    workers_.pop();
-    if (worker.ip == ip && worker.port == port) {
-      continue;
-    }
-    newQueue.push(worker);
-  }
-  workers_.swap(newQueue);
+  workers_.erase(std::remove_if(workers_.begin(),
+                                workers_.end(),
+                                [&](const worker& w) {
+                                  return w.ip == ip && w.port == port;
+                                }),
+                 workers_.end());
   if (lock) {
     workers_mutex_.unlock();
   }
@@ -206,7 +333,7 @@ void LoadBalancer::lookUpWorkers(const char* domain, unsigned short port)
     int new_workers_count = 0;
     udp::resolver::iterator it_end;
     for (; it != it_end; ++it) {
-      auto discovered_worker = worker(it->endpoint().address(), port, 0);
+      auto discovered_worker = worker(it->endpoint().address(), port);
       if (std::find(workers_set.begin(), workers_set.end(), discovered_worker)
           == workers_set.end()) {
         workers_set.push_back(discovered_worker);
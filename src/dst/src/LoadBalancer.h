@@ -32,11 +32,12 @@
 #include <boost/asio/thread_pool.hpp>
 #include <boost/thread/thread.hpp>
 #include <cstdint>
+#include <map>
 #include <mutex>
-#include <queue>
 #include <vector>
 
 #include "BalancerConnection.h"
+#include "dst/JobMessage.h"
 
 namespace utl {
 class Logger;
@@ -58,8 +59,27 @@ class LoadBalancer
                unsigned short port = 1234);
   ~LoadBalancer();
   bool addWorker(const std::string& ip, unsigned short port);
+  // Picks the next worker for a client that sends its job itself, so the
+  // balancer never sees the job finish.  updateWorker undoes one lookup.
   void updateWorker(const ip::address& ip, unsigned short port);
   void getNextWorker(ip::address& ip, unsigned short& port);
+  // Picks the worker expected to finish a job of the given type and cost
+  // first and counts the job as in flight on it.  cost_ahead is the cost
+  // of the jobs the worker has to finish before, to be passed back to
+  // finishJob.  Returns false if there are no workers.
+  bool assignJob(JobMessage::JobType type,
+                 double cost,
+                 ip::address& ip,
+                 unsigned short& port,
+                 double& cost_ahead);
+  // Ends a job taken by assignJob.  seconds is the time from sending the
+  // job to the end of the reply, or negative if the job failed.
+  void finishJob(const ip::address& ip,
+                 unsigned short port,
+                 JobMessage::JobType type,
+                 double cost,
+                 double cost_ahead,
+                 double seconds);
   void removeWorker(const ip::address& ip,
                     unsigned short port,
                     bool lock = true);
@@ -70,21 +90,23 @@ class LoadBalancer
   {
     ip::address ip;
     unsigned short port;
-    unsigned short priority;
-    worker(ip::address ipIn, unsigned short portIn, unsigned short priorityIn)
-        : ip(ipIn), port(portIn), priority(priorityIn)
+    // threads reported by the worker
+    int capacity{1};
+    // getNextWorker lookups, only used to break ties
+    int lookups{0};
+    int in_flight{0};
+    double in_flight_cost{0};
+    // failures since the last job the worker finished
+    int failures{0};
+    uint32_t jobs{0};
+    // measured runtime per unit of cost, by job type
+    std::map<JobMessage::JobType, double> seconds_per_cost;
+    worker(ip::address ipIn, unsigned short portIn) : ip(ipIn), port(portIn)
     {
     }
     bool operator==(const worker& rhs) const
     {
-      return (ip == rhs.ip && port == rhs.port && priority == rhs.priority);
-    }
-  };
-  struct CompareWorker
-  {
-    bool operator()(worker const& w1, worker const& w2)
-    {
-      return w1.priority > w2.priority;
+      return (ip == rhs.ip && port == rhs.port);
     }
   };
 
@@ -92,7 +114,7 @@ class LoadBalancer
   tcp::acceptor acceptor_;
   asio::io_service* service;
   utl::Logger* logger_;
-  std::priority_queue<worker, std::vector<worker>, CompareWorker> workers_;
+  std::vector<worker> workers_;
   std::mutex workers_mutex_;
   std::unique_ptr<asio::thread_pool> pool_;
   std::mutex pool_mutex_;
@@ -105,6 +127,10 @@ class LoadBalancer
   void handle_accept(const BalancerConnection::pointer& connection,
                      const boost::system::error_code& err);
   void lookUpWorkers(const char* domain, unsigned short port);
+  int queryCapacity(const std::string& ip, unsigned short port);
+  worker* findWorker(const ip::address& ip, unsigned short port);
+  worker* pickWorker(JobMessage::JobType type, double cost);
+  double secondsPerCost(const worker& w, JobMessage::JobType type) const;
   friend class dst::BalancerConnection;
 };
 }  // namespace dst
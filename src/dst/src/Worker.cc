@@ -50,10 +50,12 @@ void Worker::start_accept()
 Worker::Worker(Distributed* dist,
                utl::Logger* logger,
                const char* ip,
-               unsigned short port)
+               unsigned short port,
+               int threads)
     : acceptor_(service_, tcp::endpoint(ip::address::from_string(ip), port)),
       dist_(dist),
-      logger_(logger)
+      logger_(logger),
+      threads_(threads)
 {
   start_accept();
 }
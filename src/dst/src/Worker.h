@@ -45,15 +45,18 @@ class Worker
   Worker(Distributed* dist,
          utl::Logger* logger,
          const char* ip,
-         unsigned short port);
+         unsigned short port,
+         int threads = 1);
   void run();
   ~Worker();
+  int getThreads() const { return threads_; }
 
  private:
   asio::io_service service_;
   tcp::acceptor acceptor_;
   Distributed* dist_;
   utl::Logger* logger_;
+  int threads_;
   void start_accept();
   void handle_accept(const boost::shared_ptr<WorkerConnection>& connection,
                      const boost::system::error_code& err);
@@ -35,6 +35,7 @@
 #include "dst/Distributed.h"
 #include "dst/JobCallBack.h"
 #include "dst/JobMessage.h"
+#include "dst/WorkerStatusJobDescription.h"
 #include "utl/Logger.h"
 namespace dst {
 
@@ -57,30 +58,45 @@ tcp::socket& WorkerConnection::socket()
 
 void WorkerConnection::start()
 {
-  async_read_until(
-      sock_,
-      in_packet_,
-      JobMessage::EOP,
-      [me = shared_from_this()](boost::system::error_code const& ec,
-                                std::size_t bytes_xfer) {
-        me->handle_read(ec, bytes_xfer);
-      });
+  async_read(sock_,
+             asio::buffer(header_),
+             [me = shared_from_this()](boost::system::error_code const& ec,
+                                       std::size_t /* bytes_xfer */) {
+               me->read_payload(ec);
+             });
+}
+
+void WorkerConnection::read_payload(boost::system::error_code const& err)
+{
+  if (err) {
+    handle_read(err, 0);
+    return;
+  }
+  bool more;
+  const std::size_t size = decodeFrameHeader(header_.data(), more);
+  if (size > frame_max_size) {
+    handle_read(asio::error::message_size, 0);
+    return;
+  }
+  payload_.resize(size);
+  async_read(sock_,
+             asio::buffer(payload_),
+             [me = shared_from_this()](boost::system::error_code const& ec,
+                                       std::size_t bytes_xfer) {
+               me->handle_read(ec, bytes_xfer);
+             });
 }
 
 void WorkerConnection::handle_read(boost::system::error_code const& err,
                                    size_t bytes_transferred)
 {
   if (!err) {
-    std::string data{buffers_begin(in_packet_.data()),
-                     buffers_begin(in_packet_.data()) + bytes_transferred};
-    boost::system::error_code error;
-    if (!JobMessage::serializeMsg(JobMessage::READ, msg_, data)) {
+    if (!JobMessage::serializeMsg(JobMessage::READ, msg_, payload_)) {
       logger_->warn(utl::DST,
                     41,
                     "Received malformed msg {} from port {}",
-                    data,
+                    payload_,
                     sock_.remote_endpoint().port());
-      asio::write(sock_, asio::buffer("0"), error);
       sock_.close();
       return;
     }
@@ -108,16 +124,50 @@ void WorkerConnection::handle_read(boost::system::error_code const& err,
         }
         break;
       }
-      default:
+      case JobMessage::REGION: {
+        bool handled = false;
+        for (auto& cb : dist_->getCallBacks()) {
+          if (cb->onRegionJobReceived(msg_, sock_)) {
+            handled = true;
+            break;
+          }
+        }
+        if (!handled) {
+          logger_->warn(utl::DST,
+                        43,
+                        "No tool handles the region job from port {}",
+                        sock_.remote_endpoint().port());
+          JobMessage reply(JobMessage::ERROR);
+          dist_->sendResult(reply, sock_);
+        }
+        break;
+      }
+      case JobMessage::WORKER_STATUS: {
+        JobMessage reply(JobMessage::SUCCESS);
+        auto desc = std::make_unique<WorkerStatusJobDescription>();
+        desc->setCapacity(worker_->getThreads());
+        reply.setJobDescription(std::move(desc));
+        dist_->sendResult(reply, sock_);
+        break;
+      }
+      default: {
         logger_->warn(utl::DST,
                       5,
                       "Unsupported job type {} from port {}",
                       (int) msg_.getJobType(),
                       sock_.remote_endpoint().port());
-        asio::write(sock_, asio::buffer("0"), error);
-        sock_.close();
-        return;
+        JobMessage reply(JobMessage::ERROR);
+        dist_->sendResult(reply, sock_);
+        break;
+      }
     }
+    // The connection stays open for the next job of the same client.
+    if (sock_.is_open()) {
+      start();
+    }
+  } else if (err == asio::error::eof) {
+    // The client closed its connection.
+    sock_.close();
   } else {
     logger_->warn(utl::DST,
                   4,
@@ -29,9 +29,13 @@
 #pragma once
 #include <dst/JobMessage.h>
 
+#include <array>
 #include <boost/asio.hpp>
 #include <boost/enable_shared_from_this.hpp>
 #include <boost/make_shared.hpp>
+#include <string>
+
+#include "Frame.h"
 namespace asio = boost::asio;
 using asio::ip::tcp;
 namespace utl {
@@ -49,6 +53,7 @@ class WorkerConnection : public boost::enable_shared_from_this<WorkerConnection>
                    Worker* worker);
   tcp::socket& socket();
   void start();
+  void read_payload(boost::system::error_code const& err);
   void handle_read(boost::system::error_code const& err,
                    size_t bytes_transferred);
   Worker* getWorker() const { return worker_; }
@@ -56,7 +61,8 @@ class WorkerConnection : public boost::enable_shared_from_this<WorkerConnection>
  private:
   tcp::socket sock_;
   Distributed* dist_;
-  asio::streambuf in_packet_;
+  std::array<unsigned char, frame_header_size> header_;
+  std::string payload_;
   utl::Logger* logger_;
   JobMessage msg_;
   Worker* worker_;
@@ -29,6 +29,7 @@
 #include "dst/Distributed.h"
 #include "dst/JobCallBack.h"
 #include "dst/JobMessage.h"
+#include "dst/RegionJobDescription.h"
 
 using namespace dst;
 
@@ -53,6 +54,20 @@ class HelperCallBack : public dst::JobCallBack
   void onGRDRInitJobReceived(dst::JobMessage& msg, dst::socket& sock) override
   {
   }
+  // Echoes the payload of region jobs of the "helper" tool.
+  bool onRegionJobReceived(dst::JobMessage& msg, dst::socket& sock) override
+  {
+    auto desc = static_cast<RegionJobDescription*>(msg.getJobDescription());
+    if (desc->getTool() != "helper") {
+      return false;
+    }
+    JobMessage replyMsg(JobMessage::JobType::SUCCESS);
+    auto reply = std::make_unique<RegionJobDescription>();
+    reply->setPayload(desc->getPayload());
+    replyMsg.setJobDescription(std::move(reply));
+    dist_->sendResult(replyMsg, sock);
+    return true;
+  }
 
  private:
   dst::Distributed* dist_;
@@ -107,4 +107,55 @@ BOOST_AUTO_TEST_CASE(test_default)
   // history i.e have invalid state.
   BOOST_TEST(balancer->addWorker(local_ip, worker_port_2) == false);
 }
+
+BOOST_AUTO_TEST_CASE(test_load_aware)
+{
+  utl::Logger* logger = new utl::Logger();
+  Distributed* dist = new Distributed(logger);
+  std::string local_ip = "127.0.0.1";
+  unsigned short balancer_port = 5565;
+  unsigned short slow_port = 5566;
+  unsigned short fast_port = 5567;
+  asio::io_service io_service;
+  LoadBalancer* balancer = new LoadBalancer(
+      dist, io_service, logger, local_ip.c_str(), "", balancer_port);
+  balancer->addWorker(local_ip, slow_port);
+  balancer->addWorker(local_ip, fast_port);
+  const auto ip = asio::ip::address::from_string(local_ip);
+  const auto type = JobMessage::JobType::ROUTING;
+
+  // Both workers are new, so jobs go to the least loaded one.
+  asio::ip::address address;
+  unsigned short port;
+  double cost_ahead;
+  BOOST_TEST(balancer->assignJob(type, 2, address, port, cost_ahead));
+  BOOST_TEST(port == slow_port);
+  BOOST_TEST(cost_ahead == 0);
+  BOOST_TEST(balancer->assignJob(type, 2, address, port, cost_ahead));
+  BOOST_TEST(port == fast_port);
+
+  // 10 s and 1 s per unit of cost.
+  balancer->finishJob(ip, slow_port, type, 2, 0, 20);
+  balancer->finishJob(ip, fast_port, type, 2, 0, 2);
+
+  // The fast worker gets jobs until its queue would finish later than the
+  // slow worker with the job.
+  BOOST_TEST(balancer->assignJob(type, 4, address, port, cost_ahead));
+  BOOST_TEST(port == fast_port);
+  BOOST_TEST(balancer->assignJob(type, 40, address, port, cost_ahead));
+  BOOST_TEST(port == fast_port);
+  BOOST_TEST(cost_ahead == 4);
+  BOOST_TEST(balancer->assignJob(type, 4, address, port, cost_ahead));
+  BOOST_TEST(port == slow_port);
+
+  // A failed job no longer counts as in flight, the penalty of the failure
+  // is smaller than the speed difference.
+  balancer->finishJob(ip, fast_port, type, 4, 0, 4);
+  balancer->finishJob(ip, fast_port, type, 40, 4, -1);
+  balancer->punishWorker(ip, fast_port);
+  BOOST_TEST(balancer->assignJob(type, 4, address, port, cost_ahead));
+  BOOST_TEST(port == fast_port);
+  BOOST_TEST(cost_ahead == 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -7,6 +7,7 @@
 #include <boost/thread/thread.hpp>
 #include <string>
 
+#include "Frame.h"
 #include "HelperCallBack.h"
 #include "Worker.h"
 #include "dst/Distributed.h"
@@ -33,6 +34,91 @@ BOOST_AUTO_TEST_CASE(test_default)
   JobMessage result;
   BOOST_TEST(dist->sendJob(msg, local_ip.c_str(), port, result));
   BOOST_TEST(result.getJobType() == JobMessage::JobType::SUCCESS);
+
+  // The connection of the first job is kept open and reused by the next
+  // ones, which the worker serves without the client reconnecting.
+  for (int i = 0; i < 3; i++) {
+    JobMessage next_result;
+    BOOST_TEST(dist->sendJob(msg, local_ip.c_str(), port, next_result));
+    BOOST_TEST(next_result.getJobType() == JobMessage::JobType::SUCCESS);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_region_jobs)
+{
+  Distributed* dist = new Distributed();
+  utl::Logger* logger = new utl::Logger();
+  std::string local_ip = "127.0.0.1";
+  unsigned short port = 1235;
+
+  Worker* worker = new Worker(dist, logger, local_ip.c_str(), port);
+  boost::thread t(boost::bind(&Worker::run, worker));
+  dist->addCallBack(new HelperCallBack(dist));
+
+  auto make_job = [](const std::string& tool, const std::string& payload) {
+    JobMessage msg(JobMessage::JobType::REGION);
+    auto desc = std::make_unique<RegionJobDescription>();
+    desc->setTool(tool);
+    desc->setRegion(0, 0, 10, 10);
+    desc->setPayload(payload);
+    msg.setJobDescription(std::move(desc));
+    return msg;
+  };
+  std::vector<JobMessage> msgs;
+  for (int i = 0; i < 8; i++) {
+    msgs.push_back(make_job("helper", std::to_string(i)));
+  }
+  std::vector<JobMessage> results;
+  BOOST_TEST(dist->runRegionJobs(msgs, local_ip.c_str(), port, results));
+  BOOST_TEST(results.size() == msgs.size());
+  for (int i = 0; i < 8; i++) {
+    auto desc
+        = static_cast<RegionJobDescription*>(results[i].getJobDescription());
+    BOOST_TEST(desc->getPayload() == std::to_string(i));
+  }
+
+  // A job of a tool no callback handles is answered with an error.
+  msgs.push_back(make_job("unknown", ""));
+  BOOST_TEST(!dist->runRegionJobs(msgs, local_ip.c_str(), port, results));
+  BOOST_TEST(results.back().getJobType() == JobMessage::JobType::ERROR);
+  BOOST_TEST(results.front().getJobType() == JobMessage::JobType::SUCCESS);
+}
+
+BOOST_AUTO_TEST_CASE(test_frame_header)
+{
+  bool more = false;
+  auto header = encodeFrameHeader(123456789, true);
+  BOOST_TEST(decodeFrameHeader(header.data(), more) == 123456789);
+  BOOST_TEST(more);
+  header = encodeFrameHeader(0, false);
+  BOOST_TEST(decodeFrameHeader(header.data(), more) == 0);
+  BOOST_TEST(!more);
+}
+
+BOOST_AUTO_TEST_CASE(test_frame_max_size)
+{
+  boost::asio::io_context service;
+  boost::asio::local::stream_protocol::socket reader(service);
+  boost::asio::local::stream_protocol::socket writer(service);
+  boost::asio::local::connect_pair(reader, writer);
+
+  // A header claiming more than frame_max_size is refused before the
+  // payload is allocated.
+  const auto header = encodeFrameHeader(frame_max_size + 1, false);
+  boost::asio::write(writer, boost::asio::buffer(header));
+  std::string payload;
+  try {
+    readFrame(reader, payload);
+    BOOST_TEST(false);
+  } catch (const boost::system::system_error& e) {
+    BOOST_TEST(e.code() == boost::asio::error::message_size);
+  }
+  BOOST_TEST(payload.empty());
+
+  // A frame within the limit round trips.
+  writeFrame(writer, "payload", true);
+  BOOST_TEST(readFrame(reader, payload));
+  BOOST_TEST(payload == "payload");
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -38,6 +38,7 @@
 
 #include "graphics.h"
 #include "odb/dbShape.h"
+#include "ord/OpenRoad.hh"
 
 namespace fin {
 
@@ -341,17 +342,23 @@ static void prune(Polygon90Set& fill_area,
   fill_area -= pruned;
 }
 
+// A fill shape and its mask color, ready to be made into a dbFill
+struct DensityFillShape
+{
+  Rect rect;
+  int mask;
+};
+
 // Fill a polygon (area) on the given layer using the given configuration.
-// Num_masks is used to color the generated fills.
-// filled_area, if given, is an OR of the generated fills without bloating
+// Num_masks is used to color the generated fills.  The fills are appended to
+// fills rather than created in the db so that polygons can be filled in
+// parallel.
 static void fillPolygon(const Polygon90& area,
                         dbTechLayer* layer,
-                        dbBlock* block,
                         const DensityFillShapesConfig& cfg,
                         int num_masks,
-                        bool needs_opc,
                         Graphics* graphics,
-                        Polygon90Set* filled_area = nullptr)
+                        std::vector<DensityFillShape>& fills)
 {
   // Convert the area polygon to a polygon set as we will remove areas
   // filled by one fill shape from consideration by future shapes,
@@ -391,10 +398,17 @@ static void fillPolygon(const Polygon90& area,
       graphics->drawPolygon90Set(pruned_fill_area);
     }
 
-    Polygon90Set all_iter_fills;
     std::vector<Polygon90> sub_fill_areas;
     pruned_fill_area.get(sub_fill_areas);
-    for (auto& sub_fill_area : sub_fill_areas) {
+
+    // The pruned sub areas are min-space apart so each is tiled on its own.
+    const int sub_cnt = sub_fill_areas.size();
+    std::vector<std::vector<DensityFillShape>> sub_fills(sub_cnt);
+    std::vector<Polygon90Set> sub_bloated(sub_cnt);
+#pragma omp parallel for schedule(dynamic) \
+    num_threads(ord::OpenRoad::openRoad()->getThreadCount()) if (sub_cnt > 1)
+    for (int i = 0; i < sub_cnt; ++i) {
+      const Polygon90& sub_fill_area = sub_fill_areas[i];
       Rectangle bounds;
       extents(bounds, sub_fill_area);
 
@@ -413,9 +427,8 @@ static void fillPolygon(const Polygon90& area,
       keep(fills, w * h, w * h, w - 1, w, h - 1, h);
 
       Polygon90Set tmp_fills(fills);
-      all_iter_fills += bloat(tmp_fills, space_x, space_x, space_y, space_y);
+      sub_bloated[i] = bloat(tmp_fills, space_x, space_x, space_y, space_y);
 
-      // Insert fills into the db
       std::vector<Rectangle> polygons;
       fills.get_rectangles(polygons);
       const int num_mask = std::max(num_masks, 1);
@@ -427,21 +440,59 @@ static void fillPolygon(const Polygon90& area,
         } else {
           mask = cnt++ % num_mask + 1;
         }
-        auto x_lo = xl(f);
-        auto y_lo = yl(f);
-        auto x_hi = xh(f);
-        auto y_hi = yh(f);
-        dbFill::create(block, needs_opc, mask, layer, x_lo, y_lo, x_hi, y_hi);
-        if (filled_area) {
-          *filled_area += makeRect(x_lo, y_lo, x_hi, y_hi);
-        }
+        sub_fills[i].push_back({Rect(xl(f), yl(f), xh(f), yh(f)), mask});
       }
     }
+
+    Polygon90Set all_iter_fills;
+    for (int i = 0; i < sub_cnt; ++i) {
+      all_iter_fills += sub_bloated[i];
+      fills.insert(fills.end(), sub_fills[i].begin(), sub_fills[i].end());
+    }
     // Remove filled area from use by future shapes
     fill_area -= all_iter_fills;
   }
 }
 
+// Fill the polygons in parallel and then create their dbFills in polygon
+// order, so the result matches a serial fill.  filled_area, if given, is an
+// OR of the generated fills without bloating.
+static void fillPolygons(const std::vector<Polygon90>& polygons,
+                         dbTechLayer* layer,
+                         dbBlock* block,
+                         const DensityFillShapesConfig& cfg,
+                         int num_masks,
+                         bool needs_opc,
+                         Graphics* graphics,
+                         Polygon90Set* filled_area = nullptr)
+{
+  const int polygon_cnt = polygons.size();
+  std::vector<std::vector<DensityFillShape>> fills(polygon_cnt);
+#pragma omp parallel for schedule(dynamic) \
+    num_threads(ord::OpenRoad::openRoad()->getThreadCount()) if (!graphics)
+  for (int i = 0; i < polygon_cnt; ++i) {
+    fillPolygon(polygons[i], layer, cfg, num_masks, graphics, fills[i]);
+  }
+
+  // Insert fills into the db
+  for (const auto& polygon_fills : fills) {
+    for (const auto& [rect, mask] : polygon_fills) {
+      dbFill::create(block,
+                     needs_opc,
+                     mask,
+                     layer,
+                     rect.xMin(),
+                     rect.yMin(),
+                     rect.xMax(),
+                     rect.yMax());
+      if (filled_area) {
+        *filled_area += makeRect(
+            rect.xMin(), rect.yMin(), rect.xMax(), rect.yMax());
+      }
+    }
+  }
+}
+
 // Fill the given layer
 void DensityFill::fillLayer(dbBlock* block,
                             dbTechLayer* layer,
@@ -475,16 +526,14 @@ void DensityFill::fillLayer(dbBlock* block,
   logger_->info(FIN, 9, "Filling {} areas with non-OPC fill.", polygons.size());
 
   Polygon90Set non_opc_fill_area;
-  for (auto& polygon : polygons) {
-    fillPolygon(polygon,
-                layer,
-                block,
-                cfg.non_opc,
-                cfg.num_masks,
-                false,
-                graphics_.get(),
-                &non_opc_fill_area);
-  }
+  fillPolygons(polygons,
+               layer,
+               block,
+               cfg.non_opc,
+               cfg.num_masks,
+               false,
+               graphics_.get(),
+               &non_opc_fill_area);
   logger_->info(FIN, 4, "Total fills: {}.", block->getFills().size());
 
   if (!cfg.has_opc) {
@@ -505,10 +554,8 @@ void DensityFill::fillLayer(dbBlock* block,
   polygons.clear();
   opc_fill_area.get(polygons);
   logger_->info(FIN, 5, "Filling {} areas with OPC fill.", polygons.size());
-  for (auto& polygon : polygons) {
-    fillPolygon(
-        polygon, layer, block, cfg.opc, cfg.num_masks, true, graphics_.get());
-  }
+  fillPolygons(
+      polygons, layer, block, cfg.opc, cfg.num_masks, true, graphics_.get());
 
   logger_->info(FIN, 6, "Total fills: {}.", block->getFills().size());
 
@@ -0,0 +1,190 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Microbenchmarks of the density FFT and the weighted average wirelength
+// gradient of global placement.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "fft.h"
+#include "nesterovBase.h"
+#include "odb/db.h"
+#include "placerBase.h"
+#include "utl/Logger.h"
+
+namespace gpl {
+
+// One density update and Poisson solve on a square bin grid of
+// state.range(0) bins per side, as done once per Nesterov iteration.
+static void BM_Fft(benchmark::State& state)
+{
+  const int bin_cnt = state.range(0);
+  FFT fft(bin_cnt, bin_cnt, 100, 100);
+
+  std::mt19937 rng(1);
+  std::uniform_real_distribution<float> dist(0, 1);
+  for (auto _ : state) {
+    state.PauseTiming();
+    for (int x = 0; x < bin_cnt; x++) {
+      for (int y = 0; y < bin_cnt; y++) {
+        fft.updateDensity(x, y, dist(rng));
+      }
+    }
+    state.ResumeTiming();
+    fft.doFFT();
+    benchmark::DoNotOptimize(fft.getElectroPhi(0, 0));
+  }
+}
+BENCHMARK(BM_Fft)->Arg(256)->Arg(1024)->Unit(benchmark::kMillisecond);
+
+namespace {
+
+// A placed block of num_insts single row cells connected by random nets
+// of two to eight pins.
+class SyntheticPlacement
+{
+ public:
+  explicit SyntheticPlacement(int num_insts)
+  {
+    db_ = odb::dbDatabase::create();
+    db_->setLogger(&logger_);
+    odb::dbTech* tech = odb::dbTech::create(db_, "tech");
+    odb::dbLib* lib = odb::dbLib::create(db_, "lib", tech, ',');
+    odb::dbSite* site = odb::dbSite::create(lib, "core");
+    site->setWidth(200);
+    site->setHeight(2000);
+    site->setClass(odb::dbSiteClass::CORE);
+    odb::dbMaster* master = odb::dbMaster::create(lib, "cell");
+    master->setWidth(800);
+    master->setHeight(2000);
+    master->setType(odb::dbMasterType::CORE);
+    odb::dbMTerm::create(
+        master, "a", odb::dbIoType::INPUT, odb::dbSigType::SIGNAL);
+    odb::dbMTerm::create(
+        master, "b", odb::dbIoType::INPUT, odb::dbSigType::SIGNAL);
+    odb::dbMTerm::create(
+        master, "o", odb::dbIoType::OUTPUT, odb::dbSigType::SIGNAL);
+    master->setFrozen();
+
+    odb::dbChip* chip = odb::dbChip::create(db_);
+    odb::dbBlock* block = odb::dbBlock::create(chip, "top");
+    // Square core at 50% utilization.
+    const int num_rows = std::max(1, static_cast<int>(std::sqrt(num_insts)));
+    const int sites_per_row = 2 * 4 * num_insts / num_rows + 4;
+    block->setDieArea(
+        odb::Rect(0, 0, sites_per_row * 200, num_rows * 2000));
+    for (int row = 0; row < num_rows; row++) {
+      odb::dbRow::create(block,
+                         ("row" + std::to_string(row)).c_str(),
+                         site,
+                         0,
+                         row * 2000,
+                         odb::dbOrientType::R0,
+                         odb::dbRowDir::HORIZONTAL,
+                         sites_per_row,
+                         200);
+    }
+
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<int> site_dist(0, sites_per_row - 4);
+    std::uniform_int_distribution<int> row_dist(0, num_rows - 1);
+    std::uniform_int_distribution<int> inst_dist(0, num_insts - 1);
+    std::uniform_int_distribution<int> fanout_dist(1, 7);
+    std::vector<odb::dbInst*> insts;
+    for (int i = 0; i < num_insts; i++) {
+      odb::dbInst* inst = odb::dbInst::create(
+          block, master, ("u" + std::to_string(i)).c_str());
+      inst->setLocation(site_dist(rng) * 200, row_dist(rng) * 2000);
+      inst->setPlacementStatus(odb::dbPlacementStatus::PLACED);
+      insts.push_back(inst);
+    }
+    for (int i = 0; i < num_insts; i++) {
+      odb::dbNet* net
+          = odb::dbNet::create(block, ("n" + std::to_string(i)).c_str());
+      insts[i]->findITerm("o")->connect(net);
+      const int fanout = fanout_dist(rng);
+      for (int sink = 0; sink < fanout; sink++) {
+        odb::dbITerm* input
+            = insts[inst_dist(rng)]->findITerm(sink % 2 ? "a" : "b");
+        if (input->getNet() == nullptr) {
+          input->connect(net);
+        }
+      }
+    }
+  }
+
+  ~SyntheticPlacement() { odb::dbDatabase::destroy(db_); }
+
+  odb::dbDatabase* db() const { return db_; }
+  utl::Logger* logger() { return &logger_; }
+
+ private:
+  utl::Logger logger_;
+  odb::dbDatabase* db_ = nullptr;
+};
+
+}  // namespace
+
+// The wirelength gradient of every net with the weighted average model,
+// on state.range(0) instances and state.range(1) threads.
+static void BM_WireLengthForceWA(benchmark::State& state)
+{
+  SyntheticPlacement placement(state.range(0));
+  utl::Logger* logger = placement.logger();
+  logger->suppressMessage(utl::GPL, 2);
+  logger->suppressMessage(utl::GPL, 3);
+  logger->suppressMessage(utl::GPL, 4);
+  auto pbc = std::make_shared<PlacerBaseCommon>(
+      placement.db(), PlacerBaseVars(), logger);
+  NesterovBaseCommon nbc(NesterovBaseVars(), pbc, logger, state.range(1));
+
+  // 1 / gamma for a gamma of a few bins, as early in placement.
+  const float wl_coeff = 1.0 / 4000;
+  for (auto _ : state) {
+    nbc.updateWireLengthForceWA(wl_coeff, wl_coeff);
+  }
+  state.SetItemsProcessed(state.iterations() * nbc.gNets().size());
+}
+BENCHMARK(BM_WireLengthForceWA)
+    ->Args({10000, 1})
+    ->Args({100000, 1})
+    ->Args({100000, 8})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace gpl
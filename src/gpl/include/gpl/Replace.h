@@ -36,6 +36,8 @@
 #include <memory>
 #include <vector>
 
+#include "utl/MemoryRegistry.h"
+
 namespace odb {
 class dbDatabase;
 class dbInst;
@@ -83,7 +85,7 @@ class Replace
   void reset();
 
   void doIncrementalPlace(int threads);
-  void doInitialPlace();
+  void doInitialPlace(int threads);
   void runMBFF(int max_sz, float alpha, float beta, int threads, int num_paths);
 
   int doNesterovPlace(int threads, int start_iter = 0);
@@ -93,6 +95,7 @@ class Replace
   void setInitialPlaceMinDiffLength(int length);
   void setInitialPlaceMaxSolverIter(int iter);
   void setInitialPlaceMaxFanout(int fanout);
+  void setInitialPlaceCoarsenLevels(int levels);
   void setInitialPlaceNetWeightScale(float scale);
 
   void setNesterovPlaceMaxIter(int iter);
@@ -136,6 +139,7 @@ class Replace
 
   void addTimingNetWeightOverflow(int overflow);
   void setTimingNetWeightMax(float max);
+  void setTimingDrivenIncrementalMode(bool mode);
 
   void setDebug(int pause_iterations,
                 int update_iterations,
@@ -151,6 +155,7 @@ class Replace
   rsz::Resizer* rs_ = nullptr;
   grt::GlobalRouter* fr_ = nullptr;
   utl::Logger* log_ = nullptr;
+  utl::MemoryRegistration memory_registration_;
 
   std::shared_ptr<PlacerBaseCommon> pbc_;
   std::shared_ptr<NesterovBaseCommon> nbc_;
@@ -166,6 +171,7 @@ class Replace
   int initialPlaceMinDiffLength_ = 1500;
   int initialPlaceMaxSolverIter_ = 100;
   int initialPlaceMaxFanout_ = 200;
+  int initialPlaceCoarsenLevels_ = 0;
   float initialPlaceNetWeightScale_ = 800;
 
   int total_placeable_insts_ = 0;
@@ -197,6 +203,7 @@ class Replace
   int routabilityMaxInflationIter_ = 4;
 
   float timingNetWeightMax_ = 1.9;
+  bool timingDrivenIncrementalMode_ = false;
 
   bool timingDrivenMode_ = true;
   bool routabilityDrivenMode_ = true;
@@ -33,6 +33,9 @@
 
 #include "fft.h"
 
+#include <omp.h>
+
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <cstdlib>
@@ -74,6 +77,13 @@ FFT::FFT(int binCntX, int binCntY, int binSizeX, int binSizeY)
 
   workArea_.resize(round(sqrt(std::max(binCntX_, binCntY_))) + 2, 0);
 
+  // Make the cos/sin tables once, as the first ddct2d call would, so the
+  // 1D transforms only read them and can run on any thread.
+  const int n = std::max(binCntX_, binCntY_);
+  makewt(n >> 2, workArea_.data(), csTable_.data());
+  makect(n, workArea_.data(), csTable_.data() + (n >> 2));
+  setNumThreads(1);
+
   for (int i = 0; i < binCntX_; i++) {
     wx_[i]
         = REPLACE_FFT_PI * static_cast<float>(i) / static_cast<float>(binCntX_);
@@ -111,6 +121,18 @@ FFT::~FFT()
   workArea_.clear();
 }
 
+void FFT::setNumThreads(int num_threads)
+{
+  num_threads_ = std::max(num_threads, 1);
+  // The buffers are kept when the count drops so switching back is cheap.
+  if (columnBuffers_.size() < static_cast<size_t>(num_threads_)) {
+    columnBuffers_.resize(num_threads_);
+    for (std::vector<float>& buffer : columnBuffers_) {
+      buffer.resize(4 * binCntX_);
+    }
+  }
+}
+
 void FFT::updateDensity(int x, int y, float density)
 {
   binDensity_[x][y] = density;
@@ -128,13 +150,17 @@ float FFT::getElectroPhi(int x, int y) const
 
 void FFT::doFFT()
 {
-  ddct2d(binCntX_,
-         binCntY_,
-         -1,
-         binDensity_,
-         nullptr,
-         (int*) &workArea_[0],
-         (float*) &csTable_[0]);
+  if (num_threads_ > 1) {
+    transform2d(binDensity_, -1, false, false);
+  } else {
+    ddct2d(binCntX_,
+           binCntY_,
+           -1,
+           binDensity_,
+           nullptr,
+           (int*) &workArea_[0],
+           (float*) &csTable_[0]);
+  }
 
   for (int i = 0; i < binCntX_; i++) {
     binDensity_[i][0] *= 0.5;
@@ -144,12 +170,14 @@ void FFT::doFFT()
     binDensity_[0][i] *= 0.5;
   }
 
+#pragma omp parallel for num_threads(num_threads_)
   for (int i = 0; i < binCntX_; i++) {
     for (int j = 0; j < binCntY_; j++) {
       binDensity_[i][j] *= 4.0 / binCntX_ / binCntY_;
     }
   }
 
+#pragma omp parallel for num_threads(num_threads_)
   for (int i = 0; i < binCntX_; i++) {
     float wx = wx_[i];
     float wx2 = wxSquare_[i];
@@ -186,27 +214,78 @@ void FFT::doFFT()
     }
   }
   // Inverse DCT
-  ddct2d(binCntX_,
-         binCntY_,
-         1,
-         electroPhi_,
-         nullptr,
-         (int*) &workArea_[0],
-         (float*) &csTable_[0]);
-  ddsct2d(binCntX_,
-          binCntY_,
-          1,
-          electroForceX_,
-          nullptr,
-          (int*) &workArea_[0],
-          (float*) &csTable_[0]);
-  ddcst2d(binCntX_,
-          binCntY_,
-          1,
-          electroForceY_,
-          nullptr,
-          (int*) &workArea_[0],
-          (float*) &csTable_[0]);
+  if (num_threads_ > 1) {
+    transform2d(electroPhi_, 1, false, false);
+    transform2d(electroForceX_, 1, false, true);
+    transform2d(electroForceY_, 1, true, false);
+  } else {
+    ddct2d(binCntX_,
+           binCntY_,
+           1,
+           electroPhi_,
+           nullptr,
+           (int*) &workArea_[0],
+           (float*) &csTable_[0]);
+    ddsct2d(binCntX_,
+            binCntY_,
+            1,
+            electroForceX_,
+            nullptr,
+            (int*) &workArea_[0],
+            (float*) &csTable_[0]);
+    ddcst2d(binCntX_,
+            binCntY_,
+            1,
+            electroForceY_,
+            nullptr,
+            (int*) &workArea_[0],
+            (float*) &csTable_[0]);
+  }
+}
+
+void FFT::transform2d(float** a,
+                      const int isgn,
+                      const bool dst_rows,
+                      const bool dst_columns)
+{
+  int* ip = workArea_.data();
+  float* w = csTable_.data();
+
+#pragma omp parallel for num_threads(num_threads_)
+  for (int i = 0; i < binCntX_; i++) {
+    if (dst_rows) {
+      ddst(binCntY_, isgn, a[i], ip, w);
+    } else {
+      ddct(binCntY_, isgn, a[i], ip, w);
+    }
+  }
+
+  // The columns are copied four at a time, as ddxt2d_sub does, to use every
+  // row brought into the cache.
+  const int num_groups = (binCntY_ + 3) / 4;
+#pragma omp parallel for num_threads(num_threads_)
+  for (int group = 0; group < num_groups; group++) {
+    float* t = columnBuffers_[omp_get_thread_num()].data();
+    const int first_column = group * 4;
+    const int num_columns = std::min(4, binCntY_ - first_column);
+    for (int i = 0; i < binCntX_; i++) {
+      for (int k = 0; k < num_columns; k++) {
+        t[k * binCntX_ + i] = a[i][first_column + k];
+      }
+    }
+    for (int k = 0; k < num_columns; k++) {
+      if (dst_columns) {
+        ddst(binCntX_, isgn, &t[k * binCntX_], ip, w);
+      } else {
+        ddct(binCntX_, isgn, &t[k * binCntX_], ip, w);
+      }
+    }
+    for (int i = 0; i < binCntX_; i++) {
+      for (int k = 0; k < num_columns; k++) {
+        a[i][first_column + k] = t[k * binCntX_ + i];
+      }
+    }
+  }
 }
 
 }  // namespace gpl
@@ -43,6 +43,10 @@ class FFT
   FFT(int binCntX, int binCntY, int binSizeX, int binSizeY);
   ~FFT();
 
+  // Transforms run on num_threads threads. The result does not depend on
+  // the count.
+  void setNumThreads(int num_threads);
+
   // input func
   void updateDensity(int x, int y, float density);
 
@@ -54,6 +58,11 @@ class FFT
   float getElectroPhi(int x, int y) const;
 
  private:
+  // Same as ddct2d (dst_rows and dst_columns false), ddcst2d (dst_rows) and
+  // ddsct2d (dst_columns), with the rows and the columns split over the
+  // threads.
+  void transform2d(float** a, int isgn, bool dst_rows, bool dst_columns);
+
   // 2D array; width: binCntX_, height: binCntY_;
   // No hope to use Vector at this moment...
   float** binDensity_ = nullptr;
@@ -77,10 +86,14 @@ class FFT
   // length: round(sqrt( max(binCntX_, binCntY_) )) + 2
   std::vector<int> workArea_;
 
+  // per thread copy of four columns for transform2d
+  std::vector<std::vector<float>> columnBuffers_;
+
   int binCntX_ = 0;
   int binCntY_ = 0;
   int binSizeX_ = 0;
   int binSizeY_ = 0;
+  int num_threads_ = 1;
 };
 
 //
@@ -92,6 +105,8 @@ class FFT
 void cdft(int n, int isgn, float* a, int* ip, float* w);
 void ddct(int n, int isgn, float* a, int* ip, float* w);
 void ddst(int n, int isgn, float* a, int* ip, float* w);
+void makewt(int nw, int* ip, float* w);
+void makect(int nc, int* ip, float* c);
 
 /// 2D FFT ////////////////////////////////////////////////////////////////
 void cdft2d(int, int, int, float**, float*, int*, float*);
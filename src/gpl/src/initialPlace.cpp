@@ -33,15 +33,29 @@
 
 #include "initialPlace.h"
 
+#include <algorithm>
+#include <numeric>
 #include <utility>
+#include <vector>
 
 #include "placerBase.h"
 #include "solver.h"
+#include "utl/Logger.h"
 
 namespace gpl {
 
+using utl::GPL;
+
 using T = Eigen::Triplet<float>;
 
+// clustering stops once a level has fewer clusters than this
+static constexpr int kMinClusterCount = 100;
+// clustering stops once a level removes less than 10% of the clusters
+static constexpr float kMinCoarsenRatio = 0.9;
+// nets with more pins don't drive the clustering
+static constexpr int kMaxClusterNetPins = 16;
+static constexpr int kClusterLevelMaxIter = 5;
+
 InitialPlaceVars::InitialPlaceVars()
 {
   reset();
@@ -54,6 +68,7 @@ void InitialPlaceVars::reset()
   maxSolverIter = 100;
   maxFanout = 200;
   netWeightScale = 800.0;
+  coarsenLevels = 0;
   debug = false;
 }
 
@@ -65,9 +80,10 @@ InitialPlace::InitialPlace(InitialPlaceVars ipVars,
 {
 }
 
-void InitialPlace::doBicgstabPlace()
+void InitialPlace::doBicgstabPlace(int threads)
 {
-  ResidualError error;
+  num_threads_ = threads;
+  Eigen::setNbThreads(threads);
 
   std::unique_ptr<Graphics> graphics;
   if (ipVars_.debug && Graphics::guiActive()) {
@@ -76,22 +92,17 @@ void InitialPlace::doBicgstabPlace()
 
   placeInstsCenter();
 
+  if (ipVars_.coarsenLevels > 0 && ipVars_.maxIter > 0) {
+    placeClusters();
+  }
+
   // set ExtId for idx reference // easy recovery
   setPlaceInstExtId();
 
+  // the cluster levels already give a converged starting point
+  const size_t minIter = clusterLevels_.empty() ? 5 : 2;
   for (size_t iter = 1; iter <= ipVars_.maxIter; iter++) {
-    updatePinInfo();
-    createSparseMatrix();
-    error = cpuSparseSolve(ipVars_.maxSolverIter,
-                           iter,
-                           placeInstForceMatrixX_,
-                           fixedInstForceVecX_,
-                           instLocVecX_,
-                           placeInstForceMatrixY_,
-                           fixedInstForceVecY_,
-                           instLocVecY_,
-                           log_);
-    float error_max = std::max(error.x, error.y);
+    const float error_max = solveIteration(iter);
     log_->report("[InitialPlace]  Iter: {} CG residual: {:0.8f} HPWL: {}",
                  iter,
                  error_max,
@@ -102,12 +113,195 @@ void InitialPlace::doBicgstabPlace()
       graphics->cellPlot(true);
     }
 
-    if (error_max <= 1e-5 && iter >= 5) {
+    if (error_max <= 1e-5 && iter >= minIter) {
       break;
     }
   }
 }
 
+// Builds and solves the B2B system for the current extIds.
+float InitialPlace::solveIteration(int iter)
+{
+  int cellCnt = 0;
+  for (auto& inst : pbc_->placeInsts()) {
+    cellCnt = std::max(cellCnt, inst->extId() + 1);
+  }
+  updatePinInfo();
+  createSparseMatrix(cellCnt);
+  ResidualError error = cpuSparseSolve(ipVars_.maxSolverIter,
+                                       iter,
+                                       placeInstForceMatrixX_,
+                                       fixedInstForceVecX_,
+                                       instLocVecX_,
+                                       placeInstForceMatrixY_,
+                                       fixedInstForceVecY_,
+                                       instLocVecY_,
+                                       log_);
+  return std::max(error.x, error.y);
+}
+
+// Solves the clustered netlist from the coarsest level down.  All the
+// instances of a cluster share its location, so the solution of a level is
+// the starting point of the next finer one.
+void InitialPlace::placeClusters()
+{
+  setPlaceInstExtId();
+  buildClusterLevels();
+
+  const auto& placeInsts = pbc_->placeInsts();
+  for (int level = clusterLevels_.size() - 1; level >= 0; level--) {
+    const std::vector<int>& cluster = clusterLevels_[level];
+    const int clusterCnt = clusterCounts_[level];
+
+    // collapse the instances of every cluster to the cluster center
+    std::vector<int64_t> sumX(clusterCnt, 0), sumY(clusterCnt, 0);
+    std::vector<int> instCnt(clusterCnt, 0);
+    for (size_t i = 0; i < placeInsts.size(); i++) {
+      sumX[cluster[i]] += placeInsts[i]->cx();
+      sumY[cluster[i]] += placeInsts[i]->cy();
+      instCnt[cluster[i]]++;
+    }
+    for (size_t i = 0; i < placeInsts.size(); i++) {
+      Instance* inst = placeInsts[i];
+      inst->setExtId(cluster[i]);
+      if (!inst->isLocked()) {
+        const int cnt = instCnt[cluster[i]];
+        inst->setCenterLocation(sumX[cluster[i]] / cnt,
+                                sumY[cluster[i]] / cnt);
+      }
+    }
+
+    for (int iter = 1; iter <= kClusterLevelMaxIter; iter++) {
+      const float error_max = solveIteration(iter);
+      log_->report(
+          "[InitialPlace]  Level: {} Clusters: {} Iter: {} CG residual: "
+          "{:0.8f} HPWL: {}",
+          level + 1,
+          clusterCnt,
+          iter,
+          error_max,
+          pbc_->hpwl());
+      updateCoordi();
+      if (error_max <= 1e-5) {
+        break;
+      }
+    }
+  }
+}
+
+void InitialPlace::buildClusterLevels()
+{
+  clusterLevels_.clear();
+  clusterCounts_.clear();
+
+  std::vector<int> cluster(pbc_->placeInsts().size());
+  std::iota(cluster.begin(), cluster.end(), 0);
+  int clusterCnt = cluster.size();
+
+  for (int level = 0; level < ipVars_.coarsenLevels; level++) {
+    std::vector<int> coarseCluster;
+    const int coarseCnt = matchClusters(cluster, clusterCnt, coarseCluster);
+    if (coarseCnt < kMinClusterCount
+        || coarseCnt > clusterCnt * kMinCoarsenRatio) {
+      break;
+    }
+    for (int& c : cluster) {
+      c = coarseCluster[c];
+    }
+    clusterCnt = coarseCnt;
+    clusterLevels_.push_back(cluster);
+    clusterCounts_.push_back(clusterCnt);
+  }
+
+  log_->info(GPL,
+             14,
+             "Initial placement cluster levels: {}.",
+             clusterLevels_.size());
+}
+
+// Heavy edge matching: every cluster is merged with its unmatched neighbor
+// of the highest connectivity per area.  coarseCluster maps the clusters to
+// the merged clusters; the number of merged clusters is returned.
+int InitialPlace::matchClusters(const std::vector<int>& cluster,
+                                int clusterCnt,
+                                std::vector<int>& coarseCluster) const
+{
+  const auto& placeInsts = pbc_->placeInsts();
+
+  // locked, macro and power domain instances stay alone
+  std::vector<char> canMerge(clusterCnt, true);
+  std::vector<int64_t> area(clusterCnt, 0);
+  for (size_t i = 0; i < placeInsts.size(); i++) {
+    Instance* inst = placeInsts[i];
+    area[cluster[i]] += inst->area();
+    if (inst->isLocked() || inst->isMacro()
+        || inst->dbInst()->getGroup() != nullptr) {
+      canMerge[cluster[i]] = false;
+    }
+  }
+
+  // clique model of the connectivity between clusters
+  std::vector<T> list;
+  std::vector<int> netClusters;
+  for (auto& net : pbc_->nets()) {
+    if (net->pins().size() <= 1 || net->pins().size() > kMaxClusterNetPins) {
+      continue;
+    }
+    netClusters.clear();
+    for (auto& pin : net->pins()) {
+      if (pin->isPlaceInstConnected()) {
+        const int c = cluster[pin->instance()->extId()];
+        if (canMerge[c]) {
+          netClusters.push_back(c);
+        }
+      }
+    }
+    std::sort(netClusters.begin(), netClusters.end());
+    netClusters.erase(std::unique(netClusters.begin(), netClusters.end()),
+                      netClusters.end());
+    if (netClusters.size() <= 1) {
+      continue;
+    }
+    const float weight = 1.0 / (netClusters.size() - 1);
+    for (size_t i = 0; i < netClusters.size(); i++) {
+      for (size_t j = i + 1; j < netClusters.size(); j++) {
+        list.emplace_back(netClusters[i], netClusters[j], weight);
+        list.emplace_back(netClusters[j], netClusters[i], weight);
+      }
+    }
+  }
+  SMatrix connectivity(clusterCnt, clusterCnt);
+  connectivity.setFromTriplets(list.begin(), list.end());
+
+  coarseCluster.assign(clusterCnt, -1);
+  int coarseCnt = 0;
+  for (int c1 = 0; c1 < clusterCnt; c1++) {
+    if (coarseCluster[c1] != -1) {
+      continue;
+    }
+    int match = -1;
+    float matchScore = 0;
+    for (SMatrix::InnerIterator it(connectivity, c1); it; ++it) {
+      const int c2 = it.col();
+      if (coarseCluster[c2] != -1) {
+        continue;
+      }
+      const int64_t mergedArea = std::max<int64_t>(1, area[c1] + area[c2]);
+      const float score = it.value() / mergedArea;
+      if (score > matchScore) {
+        matchScore = score;
+        match = c2;
+      }
+    }
+    coarseCluster[c1] = coarseCnt;
+    if (match != -1) {
+      coarseCluster[match] = coarseCnt;
+    }
+    coarseCnt++;
+  }
+  return coarseCnt;
+}
+
 // starting point of initial place is center.
 void InitialPlace::placeInstsCenter()
 {
@@ -216,181 +410,234 @@ void InitialPlace::updatePinInfo()
 
 // solve placeInstForceMatrixX_ * xcg_x_ = xcg_b_ and placeInstForceMatrixY_ *
 // ycg_x_ = ycg_b_ eq.
-void InitialPlace::createSparseMatrix()
+void InitialPlace::createSparseMatrix(int cellCnt)
 {
-  const int placeCnt = pbc_->placeInsts().size();
-  instLocVecX_.resize(placeCnt);
-  fixedInstForceVecX_.resize(placeCnt);
-  instLocVecY_.resize(placeCnt);
-  fixedInstForceVecY_.resize(placeCnt);
+  // warm start from the unrounded previous solution on the same netlist
+  const bool warmStart = instLocVecX_.size() == cellCnt;
+
+  instLocVecX_.resize(cellCnt);
+  fixedInstForceVecX_.resize(cellCnt);
+  instLocVecY_.resize(cellCnt);
+  fixedInstForceVecY_.resize(cellCnt);
 
-  placeInstForceMatrixX_.resize(placeCnt, placeCnt);
-  placeInstForceMatrixY_.resize(placeCnt, placeCnt);
+  placeInstForceMatrixX_.resize(cellCnt, cellCnt);
+  placeInstForceMatrixY_.resize(cellCnt, cellCnt);
 
+  // initialize vector
+  for (auto& inst : pbc_->placeInsts()) {
+    int idx = inst->extId();
+
+    if (!warmStart) {
+      instLocVecX_(idx) = inst->cx();
+      instLocVecY_(idx) = inst->cy();
+    }
+
+    fixedInstForceVecX_(idx) = fixedInstForceVecY_(idx) = 0;
+  }
+
+  //
+  // The nets are split in chunks that are filled in parallel. Each chunk has
+  // its own B2B lists:
   //
-  // listX and listY is a temporary vector that have tuples, (idx1, idx2, val)
+  // listX/listY : tuples (idx1, idx2, val) of placeInstForceMatrixX_/Y_
+  // forceX/forceY : tuples (idx, 0, val) added to fixedInstForceVecX_/Y_
   //
-  // listX finally becomes placeInstForceMatrixX_
-  // listY finally becomes placeInstForceMatrixY_
+  // The chunks are merged in net order, so the result doesn't depend on the
+  // number of threads.
   //
   // The triplet vector is recommended usages
   // to fill in SparseMatrix from Eigen docs.
   //
+  const auto& nets = pbc_->nets();
+  const int numChunks = num_threads_ > 1 ? num_threads_ * 4 : 1;
+  std::vector<B2BLists> chunks(numChunks);
+
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic)
+  for (int chunk = 0; chunk < numChunks; chunk++) {
+    const size_t begin = nets.size() * chunk / numChunks;
+    const size_t end = nets.size() * (chunk + 1) / numChunks;
+    for (size_t i = begin; i < end; i++) {
+      addNetB2B(nets[i], chunks[chunk]);
+    }
+  }
 
+  size_t listXSize = 0, listYSize = 0;
+  for (const B2BLists& lists : chunks) {
+    listXSize += lists.listX.size();
+    listYSize += lists.listY.size();
+  }
   std::vector<T> listX, listY;
-  listX.reserve(1000000);
-  listY.reserve(1000000);
+  listX.reserve(listXSize);
+  listY.reserve(listYSize);
+  for (const B2BLists& lists : chunks) {
+    listX.insert(listX.end(), lists.listX.begin(), lists.listX.end());
+    listY.insert(listY.end(), lists.listY.begin(), lists.listY.end());
+    for (const T& force : lists.forceX) {
+      fixedInstForceVecX_(force.row()) += force.value();
+    }
+    for (const T& force : lists.forceY) {
+      fixedInstForceVecY_(force.row()) += force.value();
+    }
+  }
 
-  // initialize vector
-  for (auto& inst : pbc_->placeInsts()) {
-    int idx = inst->extId();
+  placeInstForceMatrixX_.setFromTriplets(listX.begin(), listX.end());
+  placeInstForceMatrixY_.setFromTriplets(listY.begin(), listY.end());
+}
 
-    instLocVecX_(idx) = inst->cx();
-    instLocVecY_(idx) = inst->cy();
+void InitialPlace::addNetB2B(Net* net, B2BLists& lists) const
+{
+  // skip for small nets.
+  if (net->pins().size() <= 1) {
+    return;
+  }
 
-    fixedInstForceVecX_(idx) = fixedInstForceVecY_(idx) = 0;
+  // escape long time cals on huge fanout.
+  //
+  if (net->pins().size() >= ipVars_.maxFanout) {
+    return;
   }
 
-  // for each net
-  for (auto& net : pbc_->nets()) {
-    // skip for small nets.
-    if (net->pins().size() <= 1) {
-      continue;
-    }
+  float netWeight = ipVars_.netWeightScale / (net->pins().size() - 1);
 
-    // escape long time cals on huge fanout.
-    //
-    if (net->pins().size() >= ipVars_.maxFanout) {
-      continue;
-    }
+  // foreach two pins in single nets.
+  auto& pins = net->pins();
+  for (int pinIdx1 = 1; pinIdx1 < pins.size(); ++pinIdx1) {
+    Pin* pin1 = pins[pinIdx1];
+    for (int pinIdx2 = 0; pinIdx2 < pinIdx1; ++pinIdx2) {
+      Pin* pin2 = pins[pinIdx2];
 
-    float netWeight = ipVars_.netWeightScale / (net->pins().size() - 1);
+      // no need to fill in when instance is same
+      if (pin1->instance() == pin2->instance()) {
+        continue;
+      }
+
+      // or when both instances are in the same cluster
+      if (pin1->isPlaceInstConnected() && pin2->isPlaceInstConnected()
+          && pin1->instance()->extId() == pin2->instance()->extId()) {
+        continue;
+      }
 
-    // foreach two pins in single nets.
-    auto& pins = net->pins();
-    for (int pinIdx1 = 1; pinIdx1 < pins.size(); ++pinIdx1) {
-      Pin* pin1 = pins[pinIdx1];
-      for (int pinIdx2 = 0; pinIdx2 < pinIdx1; ++pinIdx2) {
-        Pin* pin2 = pins[pinIdx2];
+      // B2B modeling on min/maxX pins.
+      if (pin1->isMinPinX() || pin1->isMaxPinX() || pin2->isMinPinX()
+          || pin2->isMaxPinX()) {
+        int diffX = abs(pin1->cx() - pin2->cx());
+        float weightX = 0;
+        if (diffX > ipVars_.minDiffLength) {
+          weightX = netWeight / diffX;
+        } else {
+          weightX = netWeight / ipVars_.minDiffLength;
+        }
 
-        // no need to fill in when instance is same
-        if (pin1->instance() == pin2->instance()) {
-          continue;
+        // both pin cames from instance
+        if (pin1->isPlaceInstConnected() && pin2->isPlaceInstConnected()) {
+          const int inst1 = pin1->instance()->extId();
+          const int inst2 = pin2->instance()->extId();
+
+          lists.listX.emplace_back(inst1, inst1, weightX);
+          lists.listX.emplace_back(inst2, inst2, weightX);
+
+          lists.listX.emplace_back(inst1, inst2, -weightX);
+          lists.listX.emplace_back(inst2, inst1, -weightX);
+
+          lists.forceX.emplace_back(
+              inst1,
+              0,
+              -weightX
+                  * ((pin1->cx() - pin1->instance()->cx())
+                     - (pin2->cx() - pin2->instance()->cx())));
+
+          lists.forceX.emplace_back(
+              inst2,
+              0,
+              -weightX
+                  * ((pin2->cx() - pin2->instance()->cx())
+                     - (pin1->cx() - pin1->instance()->cx())));
+        }
+        // pin1 from IO port / pin2 from Instance
+        else if (!pin1->isPlaceInstConnected()
+                 && pin2->isPlaceInstConnected()) {
+          const int inst2 = pin2->instance()->extId();
+          lists.listX.emplace_back(inst2, inst2, weightX);
+
+          lists.forceX.emplace_back(
+              inst2,
+              0,
+              weightX * (pin1->cx() - (pin2->cx() - pin2->instance()->cx())));
+        }
+        // pin1 from Instance / pin2 from IO port
+        else if (pin1->isPlaceInstConnected()
+                 && !pin2->isPlaceInstConnected()) {
+          const int inst1 = pin1->instance()->extId();
+          lists.listX.emplace_back(inst1, inst1, weightX);
+
+          lists.forceX.emplace_back(
+              inst1,
+              0,
+              weightX * (pin2->cx() - (pin1->cx() - pin1->instance()->cx())));
         }
+      }
 
-        // B2B modeling on min/maxX pins.
-        if (pin1->isMinPinX() || pin1->isMaxPinX() || pin2->isMinPinX()
-            || pin2->isMaxPinX()) {
-          int diffX = abs(pin1->cx() - pin2->cx());
-          float weightX = 0;
-          if (diffX > ipVars_.minDiffLength) {
-            weightX = netWeight / diffX;
-          } else {
-            weightX = netWeight / ipVars_.minDiffLength;
-          }
-
-          // both pin cames from instance
-          if (pin1->isPlaceInstConnected() && pin2->isPlaceInstConnected()) {
-            const int inst1 = pin1->instance()->extId();
-            const int inst2 = pin2->instance()->extId();
-
-            listX.emplace_back(inst1, inst1, weightX);
-            listX.emplace_back(inst2, inst2, weightX);
-
-            listX.emplace_back(inst1, inst2, -weightX);
-            listX.emplace_back(inst2, inst1, -weightX);
-
-            fixedInstForceVecX_(inst1)
-                += -weightX
-                   * ((pin1->cx() - pin1->instance()->cx())
-                      - (pin2->cx() - pin2->instance()->cx()));
-
-            fixedInstForceVecX_(inst2)
-                += -weightX
-                   * ((pin2->cx() - pin2->instance()->cx())
-                      - (pin1->cx() - pin1->instance()->cx()));
-          }
-          // pin1 from IO port / pin2 from Instance
-          else if (!pin1->isPlaceInstConnected()
-                   && pin2->isPlaceInstConnected()) {
-            const int inst2 = pin2->instance()->extId();
-            listX.emplace_back(inst2, inst2, weightX);
-
-            fixedInstForceVecX_(inst2)
-                += weightX
-                   * (pin1->cx() - (pin2->cx() - pin2->instance()->cx()));
-          }
-          // pin1 from Instance / pin2 from IO port
-          else if (pin1->isPlaceInstConnected()
-                   && !pin2->isPlaceInstConnected()) {
-            const int inst1 = pin1->instance()->extId();
-            listX.emplace_back(inst1, inst1, weightX);
-
-            fixedInstForceVecX_(inst1)
-                += weightX
-                   * (pin2->cx() - (pin1->cx() - pin1->instance()->cx()));
-          }
+      // B2B modeling on min/maxY pins.
+      if (pin1->isMinPinY() || pin1->isMaxPinY() || pin2->isMinPinY()
+          || pin2->isMaxPinY()) {
+        int diffY = abs(pin1->cy() - pin2->cy());
+        float weightY = 0;
+        if (diffY > ipVars_.minDiffLength) {
+          weightY = netWeight / diffY;
+        } else {
+          weightY = netWeight / ipVars_.minDiffLength;
         }
 
-        // B2B modeling on min/maxY pins.
-        if (pin1->isMinPinY() || pin1->isMaxPinY() || pin2->isMinPinY()
-            || pin2->isMaxPinY()) {
-          int diffY = abs(pin1->cy() - pin2->cy());
-          float weightY = 0;
-          if (diffY > ipVars_.minDiffLength) {
-            weightY = netWeight / diffY;
-          } else {
-            weightY = netWeight / ipVars_.minDiffLength;
-          }
-
-          // both pin cames from instance
-          if (pin1->isPlaceInstConnected() && pin2->isPlaceInstConnected()) {
-            const int inst1 = pin1->instance()->extId();
-            const int inst2 = pin2->instance()->extId();
-
-            listY.emplace_back(inst1, inst1, weightY);
-            listY.emplace_back(inst2, inst2, weightY);
-
-            listY.emplace_back(inst1, inst2, -weightY);
-            listY.emplace_back(inst2, inst1, -weightY);
-
-            fixedInstForceVecY_(inst1)
-                += -weightY
-                   * ((pin1->cy() - pin1->instance()->cy())
-                      - (pin2->cy() - pin2->instance()->cy()));
-
-            fixedInstForceVecY_(inst2)
-                += -weightY
-                   * ((pin2->cy() - pin2->instance()->cy())
-                      - (pin1->cy() - pin1->instance()->cy()));
-          }
-          // pin1 from IO port / pin2 from Instance
-          else if (!pin1->isPlaceInstConnected()
-                   && pin2->isPlaceInstConnected()) {
-            const int inst2 = pin2->instance()->extId();
-            listY.emplace_back(inst2, inst2, weightY);
-
-            fixedInstForceVecY_(inst2)
-                += weightY
-                   * (pin1->cy() - (pin2->cy() - pin2->instance()->cy()));
-          }
-          // pin1 from Instance / pin2 from IO port
-          else if (pin1->isPlaceInstConnected()
-                   && !pin2->isPlaceInstConnected()) {
-            const int inst1 = pin1->instance()->extId();
-            listY.emplace_back(inst1, inst1, weightY);
-
-            fixedInstForceVecY_(inst1)
-                += weightY
-                   * (pin2->cy() - (pin1->cy() - pin1->instance()->cy()));
-          }
+        // both pin cames from instance
+        if (pin1->isPlaceInstConnected() && pin2->isPlaceInstConnected()) {
+          const int inst1 = pin1->instance()->extId();
+          const int inst2 = pin2->instance()->extId();
+
+          lists.listY.emplace_back(inst1, inst1, weightY);
+          lists.listY.emplace_back(inst2, inst2, weightY);
+
+          lists.listY.emplace_back(inst1, inst2, -weightY);
+          lists.listY.emplace_back(inst2, inst1, -weightY);
+
+          lists.forceY.emplace_back(
+              inst1,
+              0,
+              -weightY
+                  * ((pin1->cy() - pin1->instance()->cy())
+                     - (pin2->cy() - pin2->instance()->cy())));
+
+          lists.forceY.emplace_back(
+              inst2,
+              0,
+              -weightY
+                  * ((pin2->cy() - pin2->instance()->cy())
+                     - (pin1->cy() - pin1->instance()->cy())));
+        }
+        // pin1 from IO port / pin2 from Instance
+        else if (!pin1->isPlaceInstConnected()
+                 && pin2->isPlaceInstConnected()) {
+          const int inst2 = pin2->instance()->extId();
+          lists.listY.emplace_back(inst2, inst2, weightY);
+
+          lists.forceY.emplace_back(
+              inst2,
+              0,
+              weightY * (pin1->cy() - (pin2->cy() - pin2->instance()->cy())));
+        }
+        // pin1 from Instance / pin2 from IO port
+        else if (pin1->isPlaceInstConnected()
+                 && !pin2->isPlaceInstConnected()) {
+          const int inst1 = pin1->instance()->extId();
+          lists.listY.emplace_back(inst1, inst1, weightY);
+
+          lists.forceY.emplace_back(
+              inst1,
+              0,
+              weightY * (pin2->cy() - (pin1->cy() - pin1->instance()->cy())));
         }
       }
     }
   }
-
-  placeInstForceMatrixX_.setFromTriplets(listX.begin(), listX.end());
-  placeInstForceMatrixY_.setFromTriplets(listY.begin(), listY.end());
 }
 
 void InitialPlace::updateCoordi()
@@ -47,6 +47,7 @@ namespace gpl {
 
 class PlacerBaseCommon;
 class PlacerBase;
+class Net;
 class Graphics;
 
 class InitialPlaceVars
@@ -57,6 +58,8 @@ class InitialPlaceVars
   int maxSolverIter;
   int maxFanout;
   float netWeightScale;
+  // number of clustering levels solved before the flat netlist; 0 disables
+  int coarsenLevels;
   bool debug;
 
   InitialPlaceVars();
@@ -72,13 +75,14 @@ class InitialPlace
                std::shared_ptr<PlacerBaseCommon> pbc,
                std::vector<std::shared_ptr<PlacerBase>>& pbVec,
                utl::Logger* logger);
-  void doBicgstabPlace();
+  void doBicgstabPlace(int threads);
 
  private:
   InitialPlaceVars ipVars_;
   std::shared_ptr<PlacerBaseCommon> pbc_;
   std::vector<std::shared_ptr<PlacerBase>> pbVec_;
   utl::Logger* log_ = nullptr;
+  int num_threads_ = 1;
 
   // Solve two SparseMatrix equations here;
   //
@@ -110,11 +114,31 @@ class InitialPlace
   Eigen::VectorXf instLocVecY_, fixedInstForceVecY_;
   SMatrix placeInstForceMatrixX_, placeInstForceMatrixY_;
 
+  // B2B contributions of a range of nets
+  struct B2BLists
+  {
+    std::vector<Eigen::Triplet<float>> listX, listY;
+    std::vector<Eigen::Triplet<float>> forceX, forceY;
+  };
+
+  // clusterLevels_[level][placeInst idx] : cluster of the placeInst
+  // at (level + 1). Every level roughly halves the cluster count.
+  std::vector<std::vector<int>> clusterLevels_;
+  std::vector<int> clusterCounts_;
+
   void placeInstsCenter();
   void setPlaceInstExtId();
   void updatePinInfo();
-  void createSparseMatrix();
+  void createSparseMatrix(int cellCnt);
+  void addNetB2B(Net* net, B2BLists& lists) const;
   void updateCoordi();
+  float solveIteration(int iter);
+
+  void buildClusterLevels();
+  int matchClusters(const std::vector<int>& cluster,
+                    int clusterCnt,
+                    std::vector<int>& coarseCluster) const;
+  void placeClusters();
 };
 
 }  // namespace gpl
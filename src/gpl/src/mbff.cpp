@@ -40,6 +40,7 @@
 #include <ortools/sat/cp_model.h>
 
 #include <algorithm>
+#include <cmath>
 #include <random>
 
 #include "db_sta/dbNetwork.hh"
@@ -1142,19 +1143,8 @@ double MBFF::RunILP(const std::vector<Flop>& flops,
 
   std::vector<float> tray_cost(num_trays);
   for (int i = 0; i < num_trays; i++) {
-    int bit_idx = 0;
-    for (int j = 0; j < num_sizes_; j++) {
-      if (best_master_[array_mask][j] != nullptr) {
-        if (GetBitCnt(j) == static_cast<int>(trays[i].slots.size())) {
-          bit_idx = j;
-        }
-      }
-    }
-    if (GetBitCnt(bit_idx) == 1) {
-      tray_cost[i] = 1.00;
-    } else {
-      tray_cost[i] = (GetBitCnt(bit_idx) * norm_power_[bit_idx]);
-    }
+    tray_cost[i] = GetTrayCost(static_cast<int>(trays[i].slots.size()),
+                               array_mask);
   }
 
   /*
@@ -1186,6 +1176,10 @@ double MBFF::RunILP(const std::vector<Flop>& flops,
 
   operations_research::sat::Model model;
   operations_research::sat::SatParameters parameters;
+  // don't oversubscribe when the pointsets are solved in parallel
+  parameters.set_num_search_workers(omp_get_num_threads() > 1 ? 1
+                                                              : num_threads_);
+  parameters.set_max_time_in_seconds(ilp_time_limit_);
   model.Add(NewSatParameters(parameters));
   operations_research::sat::CpSolverResponse response
       = operations_research::sat::SolveCpModel(cp_model.Build(), &model);
@@ -1215,13 +1209,123 @@ double MBFF::RunILP(const std::vector<Flop>& flops,
       }
     }
 
+#pragma omp critical(mbff_tray_sizes)
     for (const auto& sizes : trays_used) {
       tray_sizes_used_[sizes.second]++;
     }
 
     return ret;
   }
-  return 0;
+
+  debugPrint(log_,
+             utl::GPL,
+             "mbff",
+             1,
+             "No ILP solution for {} flops, using the greedy mapping.",
+             num_flops);
+  return RunGreedy(flops, trays, final_flop_to_slot, alpha, array_mask);
+}
+
+float MBFF::GetTrayCost(const int slot_cnt, const std::vector<int>& array_mask)
+{
+  int bit_idx = 0;
+  for (int j = 0; j < num_sizes_; j++) {
+    if (best_master_.at(array_mask)[j] != nullptr) {
+      if (GetBitCnt(j) == slot_cnt) {
+        bit_idx = j;
+      }
+    }
+  }
+  if (GetBitCnt(bit_idx) == 1) {
+    return 1.00;
+  }
+  return GetBitCnt(bit_idx) * norm_power_[bit_idx];
+}
+
+double MBFF::RunGreedy(const std::vector<Flop>& flops,
+                       const std::vector<Tray>& trays,
+                       std::vector<std::pair<int, int>>& final_flop_to_slot,
+                       const float alpha,
+                       const std::vector<int>& array_mask)
+{
+  const int num_flops = static_cast<int>(flops.size());
+  const int num_trays = static_cast<int>(trays.size());
+
+  // (-savings over 1-bit trays, tray index) of the multi-bit trays
+  std::vector<std::pair<float, int>> savings;
+  std::vector<int> one_bit_tray(num_flops, -1);
+  for (int i = 0; i < num_trays; i++) {
+    const int slot_cnt = static_cast<int>(trays[i].slots.size());
+    if (slot_cnt == 1) {
+      if (trays[i].cand[0] >= 0) {
+        one_bit_tray[trays[i].cand[0]] = i;
+      }
+      continue;
+    }
+    int used_slots = 0;
+    float disp = 0;
+    for (int j = 0; j < slot_cnt; j++) {
+      const int flop_idx = trays[i].cand[j];
+      if (flop_idx >= 0) {
+        disp += std::abs(trays[i].slots[j].x - flops[flop_idx].pt.x)
+                + std::abs(trays[i].slots[j].y - flops[flop_idx].pt.y);
+        used_slots++;
+      }
+    }
+    const float saving
+        = alpha * (used_slots - GetTrayCost(slot_cnt, array_mask)) - disp;
+    if (used_slots > 1 && saving > 0) {
+      savings.emplace_back(-saving, i);
+    }
+  }
+  std::sort(savings.begin(), savings.end());
+
+  double ret = 0;
+  std::map<int, int> sizes_used;
+  std::vector<char> mapped(num_flops, false);
+  auto map_flop = [&](const int flop_idx, const int tray, const int slot) {
+    mapped[flop_idx] = true;
+    final_flop_to_slot[flop_idx] = {tray, slot};
+    slot_disp_x_[flops[flop_idx].idx]
+        = trays[tray].slots[slot].x - flops[flop_idx].pt.x;
+    slot_disp_y_[flops[flop_idx].idx]
+        = trays[tray].slots[slot].y - flops[flop_idx].pt.y;
+    ret += std::abs(slot_disp_x_[flops[flop_idx].idx])
+           + std::abs(slot_disp_y_[flops[flop_idx].idx]);
+  };
+
+  // take the trays whose flops are all still unmapped
+  for (const auto& [neg_saving, tray] : savings) {
+    const std::vector<int>& cand = trays[tray].cand;
+    if (std::any_of(cand.begin(), cand.end(), [&mapped](const int flop_idx) {
+          return flop_idx >= 0 && mapped[flop_idx];
+        })) {
+      continue;
+    }
+    for (size_t j = 0; j < cand.size(); j++) {
+      if (cand[j] >= 0) {
+        map_flop(cand[j], tray, j);
+      }
+    }
+    const int slot_cnt = static_cast<int>(trays[tray].slots.size());
+    ret += alpha * GetTrayCost(slot_cnt, array_mask);
+    sizes_used[slot_cnt]++;
+  }
+
+  for (int i = 0; i < num_flops; i++) {
+    if (!mapped[i] && one_bit_tray[i] != -1) {
+      map_flop(i, one_bit_tray[i], 0);
+      ret += alpha;
+      sizes_used[1]++;
+    }
+  }
+
+#pragma omp critical(mbff_tray_sizes)
+  for (const auto& [slot_cnt, cnt] : sizes_used) {
+    tray_sizes_used_[slot_cnt] += cnt;
+  }
+
+  return ret;
 }
 
 void MBFF::GetSlots(const Point& tray,
@@ -1913,105 +2017,129 @@ float MBFF::RunClustering(const std::vector<Flop>& flops,
   std::vector<std::vector<Flop>> pointsets;
   KMeansDecomp(flops, mx_sz, pointsets);
 
-  // all_start_trays[t][i][j]: start trays of size 2^i, multistart = j for
-  // pointset[t]
+  // The pointsets are solved in batches to bound the memory held for the
+  // start trays and mappings.  The start trays use std::rand, so they are
+  // made serially in pointset order before each parallel batch.
   const int num_pointsets = static_cast<int>(pointsets.size());
-  std::vector<std::vector<std::vector<Tray>>> all_start_trays[num_pointsets];
-  for (int t = 0; t < num_pointsets; t++) {
-    all_start_trays[t].resize(num_sizes_);
-    for (int i = 1; i < num_sizes_; i++) {
-      if (best_master_[array_mask][i] != nullptr) {
-        const int rows = GetRows(GetBitCnt(i), array_mask);
-        const int cols = GetBitCnt(i) / rows;
-        const float AR = (cols * single_bit_width_ * norm_area_[i])
-                         / (rows * single_bit_height_);
-        const int num_trays
-            = (static_cast<int>(pointsets[t].size()) + (GetBitCnt(i) - 1))
-              / GetBitCnt(i);
-        all_start_trays[t][i].resize(5);
-        for (int j = 0; j < 5; j++) {
-          // running in parallel ==> not reproducible
-          GetStartTrays(pointsets[t], num_trays, AR, all_start_trays[t][i][j]);
+  const int batch_size = std::max(1, num_threads_ * 4);
+
+  float ans = 0;
+  Graphics::LineSegs segs;
+  for (int batch_begin = 0; batch_begin < num_pointsets;
+       batch_begin += batch_size) {
+    const int batch_end = std::min(num_pointsets, batch_begin + batch_size);
+    const int batch_cnt = batch_end - batch_begin;
+
+    // all_start_trays[t][i][j]: start trays of size 2^i, multistart = j for
+    // pointset[batch_begin + t]
+    std::vector<std::vector<std::vector<std::vector<Tray>>>> all_start_trays(
+        batch_cnt);
+    for (int t = 0; t < batch_cnt; t++) {
+      const std::vector<Flop>& pointset = pointsets[batch_begin + t];
+      all_start_trays[t].resize(num_sizes_);
+      for (int i = 1; i < num_sizes_; i++) {
+        if (best_master_[array_mask][i] != nullptr) {
+          const int rows = GetRows(GetBitCnt(i), array_mask);
+          const int cols = GetBitCnt(i) / rows;
+          const float AR = (cols * single_bit_width_ * norm_area_[i])
+                           / (rows * single_bit_height_);
+          const int num_trays
+              = (static_cast<int>(pointset.size()) + (GetBitCnt(i) - 1))
+                / GetBitCnt(i);
+          all_start_trays[t][i].resize(5);
+          for (int j = 0; j < 5; j++) {
+            // running in parallel ==> not reproducible
+            GetStartTrays(pointset, num_trays, AR, all_start_trays[t][i][j]);
+          }
         }
       }
     }
-  }
 
-  float ans = 0;
-  std::vector<std::pair<int, int>> all_mappings[num_pointsets];
-  std::vector<Tray> all_final_trays[num_pointsets];
-
-#pragma omp parallel for num_threads(num_threads_)
-  for (int t = 0; t < num_pointsets; t++) {
-    std::vector<std::vector<Tray>> cur_trays;
-    RunMultistart(cur_trays, pointsets[t], all_start_trays[t], array_mask);
-
-    // run capacitated k-means per tray size
-    const int num_flops = static_cast<int>(pointsets[t].size());
-    for (int i = 1; i < num_sizes_; i++) {
-      if (best_master_[array_mask][i] != nullptr) {
-        const int rows = GetRows(GetBitCnt(i), array_mask),
-                  cols = GetBitCnt(i) / rows;
-        const int num_trays = (num_flops + (GetBitCnt(i) - 1)) / GetBitCnt(i);
+    std::vector<std::vector<std::pair<int, int>>> all_mappings(batch_cnt);
+    std::vector<std::vector<Tray>> all_final_trays(batch_cnt);
+
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic) \
+    reduction(+ : ans)
+    for (int t = 0; t < batch_cnt; t++) {
+      const std::vector<Flop>& pointset = pointsets[batch_begin + t];
+      std::vector<std::vector<Tray>> cur_trays;
+      RunMultistart(cur_trays, pointset, all_start_trays[t], array_mask);
+      // the start trays are not needed after the multistart
+      std::vector<std::vector<std::vector<Tray>>>().swap(all_start_trays[t]);
+
+      // run capacitated k-means per tray size
+      const int num_flops = static_cast<int>(pointset.size());
+      for (int i = 1; i < num_sizes_; i++) {
+        if (best_master_[array_mask][i] != nullptr) {
+          const int rows = GetRows(GetBitCnt(i), array_mask),
+                    cols = GetBitCnt(i) / rows;
+          const int num_trays
+              = (num_flops + (GetBitCnt(i) - 1)) / GetBitCnt(i);
+
+          for (int j = 0; j < num_trays; j++) {
+            GetSlots(cur_trays[i][j].pt,
+                     rows,
+                     cols,
+                     cur_trays[i][j].slots,
+                     array_mask);
+          }
 
-        for (int j = 0; j < num_trays; j++) {
-          GetSlots(cur_trays[i][j].pt,
-                   rows,
-                   cols,
-                   cur_trays[i][j].slots,
-                   array_mask);
+          std::vector<std::pair<int, int>> cluster;
+          RunCapacitatedKMeans(
+              pointset, cur_trays[i], GetBitCnt(i), 35, cluster, array_mask);
+          MinCostFlow(pointset, cur_trays[i], GetBitCnt(i), cluster);
+          for (int j = 0; j < num_trays; j++) {
+            GetSlots(cur_trays[i][j].pt,
+                     rows,
+                     cols,
+                     cur_trays[i][j].slots,
+                     array_mask);
+          }
         }
-
-        std::vector<std::pair<int, int>> cluster;
-        RunCapacitatedKMeans(
-            pointsets[t], cur_trays[i], GetBitCnt(i), 35, cluster, array_mask);
-        MinCostFlow(pointsets[t], cur_trays[i], GetBitCnt(i), cluster);
-        for (int j = 0; j < num_trays; j++) {
-          GetSlots(cur_trays[i][j].pt,
-                   rows,
-                   cols,
-                   cur_trays[i][j].slots,
-                   array_mask);
+      }
+      for (int i = 0; i < num_sizes_; i++) {
+        if (!i || best_master_[array_mask][i] != nullptr) {
+          all_final_trays[t].insert(all_final_trays[t].end(),
+                                    cur_trays[i].begin(),
+                                    cur_trays[i].end());
         }
       }
-    }
-    for (int i = 0; i < num_sizes_; i++) {
-      if (!i || best_master_[array_mask][i] != nullptr) {
-        all_final_trays[t].insert(
-            all_final_trays[t].end(), cur_trays[i].begin(), cur_trays[i].end());
+      std::vector<std::pair<int, int>> mapping(num_flops);
+      const float cur_ans = RunILP(
+          pointset, all_final_trays[t], mapping, alpha, beta, array_mask);
+      all_mappings[t] = std::move(mapping);
+      ans += cur_ans;
+    }
+
+    for (int t = 0; t < batch_cnt; t++) {
+      ModifyPinConnections(pointsets[batch_begin + t],
+                           all_final_trays[t],
+                           all_mappings[t],
+                           array_mask);
+    }
+
+    if (graphics_) {
+      for (int t = 0; t < batch_cnt; t++) {
+        const std::vector<Flop>& pointset = pointsets[batch_begin + t];
+        const int num_flops = pointset.size();
+        for (int i = 0; i < num_flops; i++) {
+          const int tray_idx = all_mappings[t][i].first;
+          if (tray_idx == std::numeric_limits<int>::max()) {
+            continue;
+          }
+          const Point tray_pt = all_final_trays[t][tray_idx].pt;
+          const odb::Point tray_pt_dbu(multiplier_ * tray_pt.x,
+                                       multiplier_ * tray_pt.y);
+          const Point flop_pt = pointset[i].pt;
+          const odb::Point flop_pt_dbu(multiplier_ * flop_pt.x,
+                                       multiplier_ * flop_pt.y);
+          segs.emplace_back(flop_pt_dbu, tray_pt_dbu);
+        }
       }
     }
-    std::vector<std::pair<int, int>> mapping(num_flops);
-    const float cur_ans = RunILP(
-        pointsets[t], all_final_trays[t], mapping, alpha, beta, array_mask);
-    all_mappings[t] = std::move(mapping);
-    ans += cur_ans;
-  }
-
-  for (int t = 0; t < num_pointsets; t++) {
-    ModifyPinConnections(
-        pointsets[t], all_final_trays[t], all_mappings[t], array_mask);
   }
 
   if (graphics_) {
-    Graphics::LineSegs segs;
-    for (int t = 0; t < num_pointsets; t++) {
-      const int num_flops = pointsets[t].size();
-      for (int i = 0; i < num_flops; i++) {
-        const int tray_idx = all_mappings[t][i].first;
-        if (tray_idx == std::numeric_limits<int>::max()) {
-          continue;
-        }
-        const Point tray_pt = all_final_trays[t][tray_idx].pt;
-        const odb::Point tray_pt_dbu(multiplier_ * tray_pt.x,
-                                     multiplier_ * tray_pt.y);
-        const Point flop_pt = pointsets[t][i].pt;
-        const odb::Point flop_pt_dbu(multiplier_ * flop_pt.x,
-                                     multiplier_ * flop_pt.y);
-        segs.emplace_back(flop_pt_dbu, tray_pt_dbu);
-      }
-    }
-
     graphics_->mbff_mapping(segs);
   }
 
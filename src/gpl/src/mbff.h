@@ -206,6 +206,15 @@ class MBFF
                 float alpha,
                 float beta,
                 std::vector<int> array_mask);
+  // tray cost of the ILP objective, without alpha
+  float GetTrayCost(int slot_cnt, const std::vector<int>& array_mask);
+  // fallback to RunILP when CP-SAT finds no solution within the time limit:
+  // take the multi-bit trays by decreasing savings over 1-bit trays
+  double RunGreedy(const std::vector<Flop>& flops,
+                   const std::vector<Tray>& trays,
+                   std::vector<std::pair<int, int>>& final_flop_to_slot,
+                   float alpha,
+                   const std::vector<int>& array_mask);
   // calculate beta (1.00) * sum(relative displacements)
   float GetPairDisplacements();
   // place trays and modify nets
@@ -241,6 +250,8 @@ class MBFF
   int multistart_;
   int num_paths_;
   float multiplier_;
+  // CP-SAT time limit per pointset (seconds)
+  double ilp_time_limit_ = 10.0;
 
   // single-bit FF vars
   std::vector<Flop> flops_;
@@ -75,9 +75,20 @@ static float getSecondNorm(const std::vector<FloatPoint>& a);
 //
 // Choose to use "float" only in the following functions
 static float getOverlapDensityArea(const Bin& bin, const GCell* cell);
+static float getOverlapDensityArea(const Bin& bin,
+                                   int lx,
+                                   int ly,
+                                   int ux,
+                                   int uy);
 
 static float fastExp(float exp);
 
+template <typename T>
+static int64_t capacityBytes(const std::vector<T>& v)
+{
+  return v.capacity() * sizeof(T);
+}
+
 ////////////////////////////////////////////////
 // GCell
 
@@ -306,6 +317,14 @@ int64_t GNet::hpwl() const
   return (ux - lx) + (uy - ly);
 }
 
+void GNet::setBox(int lx, int ly, int ux, int uy)
+{
+  lx_ = lx;
+  ly_ = ly;
+  ux_ = ux;
+  uy_ = uy;
+}
+
 void GNet::clearWaVars()
 {
   waExpMinSumX_ = 0;
@@ -369,41 +388,6 @@ void GPin::setCenterLocation(int cx, int cy)
   cy_ = cy;
 }
 
-void GPin::clearWaVars()
-{
-  hasMaxExpSumX_ = false;
-  hasMaxExpSumY_ = false;
-  hasMinExpSumX_ = false;
-  hasMinExpSumY_ = false;
-
-  maxExpSumX_ = maxExpSumY_ = 0;
-  minExpSumX_ = minExpSumY_ = 0;
-}
-
-void GPin::setMaxExpSumX(float maxExpSumX)
-{
-  hasMaxExpSumX_ = true;
-  maxExpSumX_ = maxExpSumX;
-}
-
-void GPin::setMaxExpSumY(float maxExpSumY)
-{
-  hasMaxExpSumY_ = true;
-  maxExpSumY_ = maxExpSumY;
-}
-
-void GPin::setMinExpSumX(float minExpSumX)
-{
-  hasMinExpSumX_ = true;
-  minExpSumX_ = minExpSumX;
-}
-
-void GPin::setMinExpSumY(float minExpSumY)
-{
-  hasMinExpSumY_ = true;
-  minExpSumY_ = minExpSumY;
-}
-
 void GPin::updateLocation(const GCell* gCell)
 {
   cx_ = gCell->cx() + offsetCx_;
@@ -510,6 +494,8 @@ void BinGrid::setLogger(utl::Logger* log)
 void BinGrid::setTargetDensity(float density)
 {
   targetDensity_ = density;
+  // macro areas are scaled by the bins' target density
+  densityCells_.clear();
 }
 
 void BinGrid::setBinCnt(int binCntX, int binCntY)
@@ -599,6 +585,7 @@ static unsigned int roundDownToPowerOfTwo(unsigned int x)
 void BinGrid::initBins()
 {
   assert(omp_get_thread_num() == 0);
+  densityCells_.clear();
   int64_t totalBinArea
       = static_cast<int64_t>(ux_ - lx_) * static_cast<int64_t>(uy_ - ly_);
 
@@ -737,54 +724,23 @@ void BinGrid::updateBinsNonPlaceArea()
 // Core Part
 void BinGrid::updateBinsGCellDensityArea(const std::vector<GCell*>& cells)
 {
-  // clear the Bin-area info
-  for (Bin& bin : bins_) {
-    bin.setInstPlacedAreaUnscaled(0);
-    bin.setFillerArea(0);
-  }
-
-  for (auto& cell : cells) {
-    std::pair<int, int> pairX = getDensityMinMaxIdxX(cell);
-    std::pair<int, int> pairY = getDensityMinMaxIdxY(cell);
+  if (!updateChangedGCellDensityArea(cells)) {
+    // clear the Bin-area info
+    for (Bin& bin : bins_) {
+      bin.setInstPlacedAreaUnscaled(0);
+      bin.setFillerArea(0);
+    }
 
-    // The following function is critical runtime hotspot
-    // for global placer.
-    //
-    if (cell->isInstance()) {
-      // macro should have
-      // scale-down with target-density
-      if (cell->isMacroInstance()) {
-        for (int y = pairY.first; y < pairY.second; y++) {
-          for (int x = pairX.first; x < pairX.second; x++) {
-            Bin& bin = bins_[y * binCntX_ + x];
-
-            const float scaledAvea = getOverlapDensityArea(bin, cell)
-                                     * cell->densityScale()
-                                     * bin.targetDensity();
-            bin.addInstPlacedAreaUnscaled(scaledAvea);
-          }
-        }
-      }
-      // normal cells
-      else if (cell->isStdInstance()) {
-        for (int y = pairY.first; y < pairY.second; y++) {
-          for (int x = pairX.first; x < pairX.second; x++) {
-            Bin& bin = bins_[y * binCntX_ + x];
-            const float scaledArea
-                = getOverlapDensityArea(bin, cell) * cell->densityScale();
-            bin.addInstPlacedAreaUnscaled(scaledArea);
-          }
-        }
-      }
-    } else if (cell->isFiller()) {
-      for (int y = pairY.first; y < pairY.second; y++) {
-        for (int x = pairX.first; x < pairX.second; x++) {
-          Bin& bin = bins_[y * binCntX_ + x];
-          bin.addFillerArea(getOverlapDensityArea(bin, cell)
-                            * cell->densityScale());
-        }
-      }
+    densityCells_.assign(cells.begin(), cells.end());
+    densityBoxes_.resize(cells.size());
+    std::vector<DensityUpdate> updates;
+    updates.reserve(cells.size());
+    for (size_t i = 0; i < cells.size(); i++) {
+      densityBoxes_[i] = getDensityBox(cells[i]);
+      updates.push_back({cells[i], densityBoxes_[i], 1});
     }
+    applyDensityUpdates(updates);
+    deltaDensityUpdateCnt_ = 0;
   }
 
   overflowArea_ = 0;
@@ -819,24 +775,171 @@ void BinGrid::updateBinsGCellDensityArea(const std::vector<GCell*>& cells)
   }
 }
 
+// Bin areas are integers, so removing a cell's old contribution and adding
+// its new one gives exactly the sums of a full recompute; the periodic full
+// recompute only bounds the work when many cells move.
+static constexpr int kMaxDeltaDensityUpdates = 32;
+
+bool BinGrid::updateChangedGCellDensityArea(const std::vector<GCell*>& cells)
+{
+  if (densityCells_.size() != cells.size()
+      || ++deltaDensityUpdateCnt_ > kMaxDeltaDensityUpdates) {
+    return false;
+  }
+
+  // a delta update costs twice a full one per changed cell
+  const size_t maxUpdates = cells.size();
+  std::vector<DensityUpdate> updates;
+  for (size_t i = 0; i < cells.size(); i++) {
+    if (cells[i] != densityCells_[i]) {
+      return false;
+    }
+    const DensityBox box = getDensityBox(cells[i]);
+    if (box == densityBoxes_[i]) {
+      continue;
+    }
+    if (updates.size() + 2 > maxUpdates) {
+      return false;
+    }
+    updates.push_back({cells[i], densityBoxes_[i], -1});
+    updates.push_back({cells[i], box, 1});
+    densityBoxes_[i] = box;
+  }
+  applyDensityUpdates(updates);
+  return true;
+}
+
+void BinGrid::applyDensityUpdates(const std::vector<DensityUpdate>& updates)
+{
+  // Each stripe of bin rows is owned by one thread, which applies the updates
+  // overlapping it in their original order, so no two threads write the same
+  // bin.
+  int num_stripes = 1;
+  if (num_threads_ > 1) {
+    num_stripes = std::max(1, std::min(binCntY_, num_threads_ * 4));
+  }
+  const int stripe_rows = (binCntY_ + num_stripes - 1) / num_stripes;
+  std::vector<std::vector<const DensityUpdate*>> stripe_updates(num_stripes);
+  for (const DensityUpdate& update : updates) {
+    const std::pair<int, int> pairY
+        = getDensityMinMaxIdxY(update.box.ly, update.box.uy);
+    if (pairY.first >= pairY.second) {
+      continue;
+    }
+    const int last_stripe = (pairY.second - 1) / stripe_rows;
+    for (int stripe = pairY.first / stripe_rows; stripe <= last_stripe;
+         stripe++) {
+      stripe_updates[stripe].push_back(&update);
+    }
+  }
+
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic)
+  for (int stripe = 0; stripe < num_stripes; stripe++) {
+    const int y_begin = stripe * stripe_rows;
+    const int y_end = std::min(y_begin + stripe_rows, binCntY_);
+    for (const DensityUpdate* update : stripe_updates[stripe]) {
+      addGCellDensityArea(*update, y_begin, y_end);
+    }
+  }
+}
+
+BinGrid::DensityBox BinGrid::getDensityBox(const GCell* cell)
+{
+  DensityBox box;
+  box.lx = cell->dLx();
+  box.ly = cell->dLy();
+  box.ux = cell->dUx();
+  box.uy = cell->dUy();
+  box.scale = cell->densityScale();
+  return box;
+}
+
+void BinGrid::addGCellDensityArea(const DensityUpdate& update,
+                                  const int y_begin,
+                                  const int y_end)
+{
+  const GCell* cell = update.cell;
+  const DensityBox& box = update.box;
+  const std::pair<int, int> pairX = getDensityMinMaxIdxX(box.lx, box.ux);
+  std::pair<int, int> pairY = getDensityMinMaxIdxY(box.ly, box.uy);
+  pairY.first = std::max(pairY.first, y_begin);
+  pairY.second = std::min(pairY.second, y_end);
+
+  // The following function is critical runtime hotspot
+  // for global placer.
+  //
+  if (cell->isInstance()) {
+    // macro should have
+    // scale-down with target-density
+    if (cell->isMacroInstance()) {
+      for (int y = pairY.first; y < pairY.second; y++) {
+        for (int x = pairX.first; x < pairX.second; x++) {
+          Bin& bin = bins_[y * binCntX_ + x];
+
+          const float scaledAvea
+              = getOverlapDensityArea(bin, box.lx, box.ly, box.ux, box.uy)
+                * box.scale * bin.targetDensity();
+          bin.addInstPlacedAreaUnscaled(update.sign
+                                        * static_cast<int64_t>(scaledAvea));
+        }
+      }
+    }
+    // normal cells
+    else if (cell->isStdInstance()) {
+      for (int y = pairY.first; y < pairY.second; y++) {
+        for (int x = pairX.first; x < pairX.second; x++) {
+          Bin& bin = bins_[y * binCntX_ + x];
+          const float scaledArea
+              = getOverlapDensityArea(bin, box.lx, box.ly, box.ux, box.uy)
+                * box.scale;
+          bin.addInstPlacedAreaUnscaled(update.sign
+                                        * static_cast<int64_t>(scaledArea));
+        }
+      }
+    }
+  } else if (cell->isFiller()) {
+    for (int y = pairY.first; y < pairY.second; y++) {
+      for (int x = pairX.first; x < pairX.second; x++) {
+        Bin& bin = bins_[y * binCntX_ + x];
+        const float fillerArea
+            = getOverlapDensityArea(bin, box.lx, box.ly, box.ux, box.uy)
+              * box.scale;
+        bin.addFillerArea(update.sign * static_cast<int64_t>(fillerArea));
+      }
+    }
+  }
+}
+
 std::pair<int, int> BinGrid::getDensityMinMaxIdxX(const GCell* gcell) const
 {
-  int lowerIdx = (gcell->dLx() - lx()) / binSizeX_;
-  int upperIdx = (fastModulo((gcell->dUx() - lx()), binSizeX_) == 0)
-                     ? (gcell->dUx() - lx()) / binSizeX_
-                     : (gcell->dUx() - lx()) / binSizeX_ + 1;
+  return getDensityMinMaxIdxX(gcell->dLx(), gcell->dUx());
+}
+
+std::pair<int, int> BinGrid::getDensityMinMaxIdxY(const GCell* gcell) const
+{
+  return getDensityMinMaxIdxY(gcell->dLy(), gcell->dUy());
+}
+
+std::pair<int, int> BinGrid::getDensityMinMaxIdxX(const int dLx,
+                                                  const int dUx) const
+{
+  int lowerIdx = (dLx - lx()) / binSizeX_;
+  int upperIdx = (fastModulo((dUx - lx()), binSizeX_) == 0)
+                     ? (dUx - lx()) / binSizeX_
+                     : (dUx - lx()) / binSizeX_ + 1;
 
   lowerIdx = std::max(lowerIdx, 0);
   upperIdx = std::min(upperIdx, binCntX_);
   return std::make_pair(lowerIdx, upperIdx);
 }
 
-std::pair<int, int> BinGrid::getDensityMinMaxIdxY(const GCell* gcell) const
+std::pair<int, int> BinGrid::getDensityMinMaxIdxY(const int dLy,
+                                                  const int dUy) const
 {
-  int lowerIdx = (gcell->dLy() - ly()) / binSizeY_;
-  int upperIdx = (fastModulo((gcell->dUy() - ly()), binSizeY_) == 0)
-                     ? (gcell->dUy() - ly()) / binSizeY_
-                     : (gcell->dUy() - ly()) / binSizeY_ + 1;
+  int lowerIdx = (dLy - ly()) / binSizeY_;
+  int upperIdx = (fastModulo((dUy - ly()), binSizeY_) == 0)
+                     ? (dUy - ly()) / binSizeY_
+                     : (dUy - ly()) / binSizeY_ + 1;
 
   lowerIdx = std::max(lowerIdx, 0);
   upperIdx = std::min(upperIdx, binCntY_);
@@ -973,6 +1076,32 @@ NesterovBaseCommon::NesterovBaseCommon(NesterovBaseVars nbVars,
       gNet.addGPin(pbToNb(pin));
     }
   }
+
+  initWaPins();
+}
+
+void NesterovBaseCommon::initWaPins()
+{
+  waNetPinStart_.assign(gNetStor_.size() + 1, 0);
+  for (size_t i = 0; i < gNetStor_.size(); i++) {
+    waNetPinStart_[i + 1] = waNetPinStart_[i] + gNetStor_[i].gPins().size();
+  }
+
+  waPinPos_.assign(gPinStor_.size(), -1);
+  waPins_.reserve(waNetPinStart_.back());
+  for (const GNet& gNet : gNetStor_) {
+    for (GPin* gPin : gNet.gPins()) {
+      waPinPos_[gPin - gPinStor_.data()] = waPins_.size();
+      waPins_.push_back(gPin);
+    }
+  }
+
+  waPinX_.resize(waPins_.size());
+  waPinY_.resize(waPins_.size());
+  waMinExpX_.assign(waPins_.size(), -1);
+  waMaxExpX_.assign(waPins_.size(), -1);
+  waMinExpY_.assign(waPins_.size(), -1);
+  waMaxExpY_.assign(waPins_.size(), -1);
 }
 
 GCell* NesterovBaseCommon::pbToNb(Instance* inst) const
@@ -1025,21 +1154,41 @@ GNet* NesterovBaseCommon::dbToNb(odb::dbNet* net) const
 void NesterovBaseCommon::updateWireLengthForceWA(float wlCoeffX, float wlCoeffY)
 {
   assert(omp_get_thread_num() == 0);
-  // clear all WA variables.
 #pragma omp parallel for num_threads(num_threads_)
-  for (auto gPin = gPinStor_.begin(); gPin < gPinStor_.end(); ++gPin) {
-    // old-style loop for old OpenMP
-    gPin->clearWaVars();
-  }
-
-#pragma omp parallel for num_threads(num_threads_)
-  for (auto gNet = gNetStor_.begin(); gNet < gNetStor_.end(); ++gNet) {
-    // old-style loop for old OpenMP
-
-    gNet->clearWaVars();
-    gNet->updateBox();
+  for (int netIdx = 0; netIdx < (int) gNetStor_.size(); netIdx++) {  // NOLINT
+    GNet& gNet = gNetStor_[netIdx];
+    const int begin = waNetPinStart_[netIdx];
+    const int end = waNetPinStart_[netIdx + 1];
+
+    // gather the pin locations, then work on the packed arrays only
+    for (int k = begin; k < end; k++) {
+      waPinX_[k] = waPins_[k]->cx();
+      waPinY_[k] = waPins_[k]->cy();
+    }
 
-    for (auto& gPin : gNet->gPins()) {
+    int lx = INT_MAX;
+    int ly = INT_MAX;
+    int ux = INT_MIN;
+    int uy = INT_MIN;
+    for (int k = begin; k < end; k++) {
+      lx = std::min(waPinX_[k], lx);
+      ly = std::min(waPinY_[k], ly);
+      ux = std::max(waPinX_[k], ux);
+      uy = std::max(waPinY_[k], uy);
+    }
+    gNet.setBox(lx, ly, ux, uy);
+
+    float waExpMinSumX = 0;
+    float waXExpMinSumX = 0;
+    float waExpMaxSumX = 0;
+    float waXExpMaxSumX = 0;
+    float waExpMinSumY = 0;
+    float waYExpMinSumY = 0;
+    float waExpMaxSumY = 0;
+    float waYExpMaxSumY = 0;
+
+    for (int k = begin; k < end; k++) {
+      const GPin* gPin = waPins_[k];
       // The WA terms are shift invariant:
       //
       //   Sum(x_i * exp(x_i))    Sum(x_i * exp(x_i - C))
@@ -1047,16 +1196,18 @@ void NesterovBaseCommon::updateWireLengthForceWA(float wlCoeffX, float wlCoeffY)
       //   Sum(exp(x_i))          Sum(exp(x_i - C))
       //
       // So we shift to keep the exponential from overflowing
-      float expMinX = (gNet->lx() - gPin->cx()) * wlCoeffX;
-      float expMaxX = (gPin->cx() - gNet->ux()) * wlCoeffX;
-      float expMinY = (gNet->ly() - gPin->cy()) * wlCoeffY;
-      float expMaxY = (gPin->cy() - gNet->uy()) * wlCoeffY;
+      const float expMinX = (lx - waPinX_[k]) * wlCoeffX;
+      const float expMaxX = (waPinX_[k] - ux) * wlCoeffX;
+      const float expMinY = (ly - waPinY_[k]) * wlCoeffY;
+      const float expMaxY = (waPinY_[k] - uy) * wlCoeffY;
+
+      waMinExpX_[k] = waMaxExpX_[k] = waMinExpY_[k] = waMaxExpY_[k] = -1;
 
       // min x
       if (expMinX > nbVars_.minWireLengthForceBar) {
-        gPin->setMinExpSumX(fastExp(expMinX));
-        gNet->addWaExpMinSumX(gPin->minExpSumX());
-        gNet->addWaXExpMinSumX(gPin->cx() * gPin->minExpSumX());
+        waMinExpX_[k] = fastExp(expMinX);
+        waExpMinSumX += waMinExpX_[k];
+        waXExpMinSumX += waPinX_[k] * waMinExpX_[k];
         if (gPin->gCell() && gPin->gCell()->isInstance()) {
           debugPrint(log_,
                      GPL,
@@ -1064,15 +1215,15 @@ void NesterovBaseCommon::updateWireLengthForceWA(float wlCoeffX, float wlCoeffY)
                      1,
                      "MinX updated: {} {:g}",
                      gPin->gCell()->instance()->dbInst()->getConstName(),
-                     gPin->minExpSumX());
+                     waMinExpX_[k]);
         }
       }
 
       // max x
       if (expMaxX > nbVars_.minWireLengthForceBar) {
-        gPin->setMaxExpSumX(fastExp(expMaxX));
-        gNet->addWaExpMaxSumX(gPin->maxExpSumX());
-        gNet->addWaXExpMaxSumX(gPin->cx() * gPin->maxExpSumX());
+        waMaxExpX_[k] = fastExp(expMaxX);
+        waExpMaxSumX += waMaxExpX_[k];
+        waXExpMaxSumX += waPinX_[k] * waMaxExpX_[k];
         if (gPin->gCell() && gPin->gCell()->isInstance()) {
           debugPrint(log_,
                      GPL,
@@ -1080,15 +1231,15 @@ void NesterovBaseCommon::updateWireLengthForceWA(float wlCoeffX, float wlCoeffY)
                      1,
                      "MaxX updated: {} {:g}",
                      gPin->gCell()->instance()->dbInst()->getConstName(),
-                     gPin->maxExpSumX());
+                     waMaxExpX_[k]);
         }
       }
 
       // min y
       if (expMinY > nbVars_.minWireLengthForceBar) {
-        gPin->setMinExpSumY(fastExp(expMinY));
-        gNet->addWaExpMinSumY(gPin->minExpSumY());
-        gNet->addWaYExpMinSumY(gPin->cy() * gPin->minExpSumY());
+        waMinExpY_[k] = fastExp(expMinY);
+        waExpMinSumY += waMinExpY_[k];
+        waYExpMinSumY += waPinY_[k] * waMinExpY_[k];
         if (gPin->gCell() && gPin->gCell()->isInstance()) {
           debugPrint(log_,
                      GPL,
@@ -1096,15 +1247,15 @@ void NesterovBaseCommon::updateWireLengthForceWA(float wlCoeffX, float wlCoeffY)
                      1,
                      "MinY updated: {} {:g}",
                      gPin->gCell()->instance()->dbInst()->getConstName(),
-                     gPin->minExpSumY());
+                     waMinExpY_[k]);
         }
       }
 
       // max y
       if (expMaxY > nbVars_.minWireLengthForceBar) {
-        gPin->setMaxExpSumY(fastExp(expMaxY));
-        gNet->addWaExpMaxSumY(gPin->maxExpSumY());
-        gNet->addWaYExpMaxSumY(gPin->cy() * gPin->maxExpSumY());
+        waMaxExpY_[k] = fastExp(expMaxY);
+        waExpMaxSumY += waMaxExpY_[k];
+        waYExpMaxSumY += waPinY_[k] * waMaxExpY_[k];
         if (gPin->gCell() && gPin->gCell()->isInstance()) {
           debugPrint(log_,
                      GPL,
@@ -1112,10 +1263,20 @@ void NesterovBaseCommon::updateWireLengthForceWA(float wlCoeffX, float wlCoeffY)
                      1,
                      "MaxY updated: {} {:g}",
                      gPin->gCell()->instance()->dbInst()->getConstName(),
-                     gPin->maxExpSumY());
+                     waMaxExpY_[k]);
         }
       }
     }
+
+    gNet.clearWaVars();
+    gNet.addWaExpMinSumX(waExpMinSumX);
+    gNet.addWaXExpMinSumX(waXExpMinSumX);
+    gNet.addWaExpMaxSumX(waExpMaxSumX);
+    gNet.addWaXExpMaxSumX(waXExpMaxSumX);
+    gNet.addWaExpMinSumY(waExpMinSumY);
+    gNet.addWaYExpMinSumY(waYExpMinSumY);
+    gNet.addWaExpMaxSumY(waExpMaxSumY);
+    gNet.addWaYExpMaxSumY(waYExpMaxSumY);
   }
 }
 
@@ -1172,49 +1333,54 @@ FloatPoint NesterovBaseCommon::getWireLengthGradientPinWA(const GPin* gPin,
   float gradientMinX = 0, gradientMinY = 0;
   float gradientMaxX = 0, gradientMaxY = 0;
 
-  // min x
-  if (gPin->hasMinExpSumX()) {
-    // from Net.
-    float waExpMinSumX = gPin->gNet()->waExpMinSumX();
-    float waXExpMinSumX = gPin->gNet()->waXExpMinSumX();
+  const int pos = waPinPos_[gPin - gPinStor_.data()];
+  if (pos != -1) {
+    const GNet* gNet = gPin->gNet();
 
-    gradientMinX
-        = (waExpMinSumX * (gPin->minExpSumX() * (1.0 - wlCoeffX * gPin->cx()))
-           + wlCoeffX * gPin->minExpSumX() * waXExpMinSumX)
-          / (waExpMinSumX * waExpMinSumX);
-  }
+    // min x
+    if (waMinExpX_[pos] >= 0) {
+      // from Net.
+      float waExpMinSumX = gNet->waExpMinSumX();
+      float waXExpMinSumX = gNet->waXExpMinSumX();
 
-  // max x
-  if (gPin->hasMaxExpSumX()) {
-    float waExpMaxSumX = gPin->gNet()->waExpMaxSumX();
-    float waXExpMaxSumX = gPin->gNet()->waXExpMaxSumX();
+      gradientMinX
+          = (waExpMinSumX * (waMinExpX_[pos] * (1.0 - wlCoeffX * gPin->cx()))
+             + wlCoeffX * waMinExpX_[pos] * waXExpMinSumX)
+            / (waExpMinSumX * waExpMinSumX);
+    }
 
-    gradientMaxX
-        = (waExpMaxSumX * (gPin->maxExpSumX() * (1.0 + wlCoeffX * gPin->cx()))
-           - wlCoeffX * gPin->maxExpSumX() * waXExpMaxSumX)
-          / (waExpMaxSumX * waExpMaxSumX);
-  }
+    // max x
+    if (waMaxExpX_[pos] >= 0) {
+      float waExpMaxSumX = gNet->waExpMaxSumX();
+      float waXExpMaxSumX = gNet->waXExpMaxSumX();
 
-  // min y
-  if (gPin->hasMinExpSumY()) {
-    float waExpMinSumY = gPin->gNet()->waExpMinSumY();
-    float waYExpMinSumY = gPin->gNet()->waYExpMinSumY();
+      gradientMaxX
+          = (waExpMaxSumX * (waMaxExpX_[pos] * (1.0 + wlCoeffX * gPin->cx()))
+             - wlCoeffX * waMaxExpX_[pos] * waXExpMaxSumX)
+            / (waExpMaxSumX * waExpMaxSumX);
+    }
 
-    gradientMinY
-        = (waExpMinSumY * (gPin->minExpSumY() * (1.0 - wlCoeffY * gPin->cy()))
-           + wlCoeffY * gPin->minExpSumY() * waYExpMinSumY)
-          / (waExpMinSumY * waExpMinSumY);
-  }
+    // min y
+    if (waMinExpY_[pos] >= 0) {
+      float waExpMinSumY = gNet->waExpMinSumY();
+      float waYExpMinSumY = gNet->waYExpMinSumY();
 
-  // max y
-  if (gPin->hasMaxExpSumY()) {
-    float waExpMaxSumY = gPin->gNet()->waExpMaxSumY();
-    float waYExpMaxSumY = gPin->gNet()->waYExpMaxSumY();
+      gradientMinY
+          = (waExpMinSumY * (waMinExpY_[pos] * (1.0 - wlCoeffY * gPin->cy()))
+             + wlCoeffY * waMinExpY_[pos] * waYExpMinSumY)
+            / (waExpMinSumY * waExpMinSumY);
+    }
+
+    // max y
+    if (waMaxExpY_[pos] >= 0) {
+      float waExpMaxSumY = gNet->waExpMaxSumY();
+      float waYExpMaxSumY = gNet->waYExpMaxSumY();
 
-    gradientMaxY
-        = (waExpMaxSumY * (gPin->maxExpSumY() * (1.0 + wlCoeffY * gPin->cy()))
-           - wlCoeffY * gPin->maxExpSumY() * waYExpMaxSumY)
-          / (waExpMaxSumY * waExpMaxSumY);
+      gradientMaxY
+          = (waExpMaxSumY * (waMaxExpY_[pos] * (1.0 + wlCoeffY * gPin->cy()))
+             - wlCoeffY * waMaxExpY_[pos] * waYExpMaxSumY)
+            / (waExpMaxSumY * waExpMaxSumY);
+    }
   }
 
   debugPrint(log_,
@@ -1268,6 +1434,20 @@ int64_t NesterovBaseCommon::getHpwl()
   return hpwl;
 }
 
+int64_t NesterovBaseCommon::getMemoryUsage() const
+{
+  int64_t bytes = capacityBytes(gCellStor_) + capacityBytes(gNetStor_)
+                  + capacityBytes(gPinStor_);
+  bytes += capacityBytes(gCells_) + capacityBytes(gNets_)
+           + capacityBytes(gPins_);
+  bytes += capacityBytes(waNetPinStart_) + capacityBytes(waPinPos_)
+           + capacityBytes(waPins_) + capacityBytes(waPinX_)
+           + capacityBytes(waPinY_);
+  bytes += capacityBytes(waMinExpX_) + capacityBytes(waMaxExpX_)
+           + capacityBytes(waMinExpY_) + capacityBytes(waMaxExpY_);
+  return bytes;
+}
+
 ////////////////////////////////////////////////
 // NesterovBase
 
@@ -1335,6 +1515,8 @@ NesterovBase::NesterovBase(NesterovBaseVars nbVars,
 
   bg_.setPlacerBase(pb_);
   bg_.setLogger(log_);
+  num_threads_ = nbc_->getNumThreads();
+  bg_.setNumThreads(num_threads_);
   bg_.setCorePoints(&(pb_->die()));
   bg_.setTargetDensity(targetDensity_);
 
@@ -1344,6 +1526,7 @@ NesterovBase::NesterovBase(NesterovBaseVars nbVars,
   // initialize fft structrue based on bins
   std::unique_ptr<FFT> fft(
       new FFT(bg_.binCntX(), bg_.binCntY(), bg_.binSizeX(), bg_.binSizeY()));
+  fft->setNumThreads(num_threads_);
 
   fft_ = std::move(fft);
 
@@ -1491,19 +1674,27 @@ void NesterovBase::updateGCellCenterLocation(
 void NesterovBase::updateGCellDensityCenterLocation(
     const std::vector<FloatPoint>& coordis)
 {
-  for (auto& coordi : coordis) {
-    int idx = &coordi - &coordis[0];
-    gCells_[idx]->setDensityCenterLocation(coordi.x, coordi.y);
+  // a pin belongs to a single cell, so the cells can move in parallel
+#pragma omp parallel for num_threads(num_threads_)
+  for (int idx = 0; idx < (int) coordis.size(); idx++) {  // NOLINT
+    gCells_[idx]->setDensityCenterLocation(coordis[idx].x, coordis[idx].y);
   }
   bg_.updateBinsGCellDensityArea(gCells_);
 }
 
+void NesterovBase::setNumThreads(int num_threads)
+{
+  num_threads_ = num_threads;
+  bg_.setNumThreads(num_threads);
+  fft_->setNumThreads(num_threads);
+}
+
 void NesterovBase::setTargetDensity(float density)
 {
   assert(omp_get_thread_num() == 0);
   targetDensity_ = density;
   bg_.setTargetDensity(density);
-#pragma omp parallel for num_threads(nbc_->getNumThreads())
+#pragma omp parallel for num_threads(num_threads_)
   for (auto bin = bins().begin(); bin < bins().end(); ++bin) {
     // old-style loop for old OpenMP
     bin->setTargetDensity(density);
@@ -1532,6 +1723,35 @@ int NesterovBase::binSizeY() const
   return bg_.binSizeY();
 }
 
+int64_t NesterovBase::getMemoryUsage() const
+{
+  int64_t bytes = capacityBytes(gCellStor_) + capacityBytes(gCells_)
+                  + capacityBytes(gCellInsts_) + capacityBytes(gCellFillers_);
+  bytes += capacityBytes(binsConst());
+  for (const std::vector<FloatPoint>* points : {&curSLPCoordi_,
+                                                &curSLPWireLengthGrads_,
+                                                &curSLPDensityGrads_,
+                                                &curSLPSumGrads_,
+                                                &nextSLPCoordi_,
+                                                &nextSLPWireLengthGrads_,
+                                                &nextSLPDensityGrads_,
+                                                &nextSLPSumGrads_,
+                                                &prevSLPCoordi_,
+                                                &prevSLPWireLengthGrads_,
+                                                &prevSLPDensityGrads_,
+                                                &prevSLPSumGrads_,
+                                                &curCoordi_,
+                                                &nextCoordi_,
+                                                &initCoordi_,
+                                                &snapshotCoordi_,
+                                                &snapshotSLPCoordi_,
+                                                &snapshotSLPSumGrads_}) {
+    bytes += capacityBytes(*points);
+  }
+  bytes += capacityBytes(densityPenaltyStor_);
+  return bytes;
+}
+
 int64_t NesterovBase::overflowArea() const
 {
   return bg_.overflowArea();
@@ -1608,7 +1828,7 @@ float NesterovBase::targetDensity() const
 void NesterovBase::updateDensitySize()
 {
   assert(omp_get_thread_num() == 0);
-#pragma omp parallel for num_threads(nbc_->getNumThreads())
+#pragma omp parallel for num_threads(num_threads_)
   for (auto it = gCells_.begin(); it < gCells_.end(); ++it) {
     auto& gCell = *it;  // old-style loop for old OpenMP
     float scaleX = 0, scaleY = 0;
@@ -1642,7 +1862,7 @@ void NesterovBase::updateAreas()
   // bloating can change the following :
   // stdInstsArea and macroInstsArea
   stdInstsArea_ = macroInstsArea_ = 0;
-#pragma omp parallel for num_threads(nbc_->getNumThreads()) \
+#pragma omp parallel for num_threads(num_threads_) \
     reduction(+ : stdInstsArea_, macroInstsArea_)
   for (auto it = gCells_.begin(); it < gCells_.end(); ++it) {
     auto& gCell = *it;  // old-style loop for old OpenMP
@@ -1799,9 +2019,9 @@ FloatPoint NesterovBase::getDensityGradient(const GCell* gCell) const
 // Density force cals
 void NesterovBase::updateDensityForceBin()
 {
-  assert(omp_get_thread_num() == 0);
+  assert(omp_get_level() <= 1);
   // copy density to utilize FFT
-#pragma omp parallel for num_threads(nbc_->getNumThreads())
+#pragma omp parallel for num_threads(num_threads_)
   for (auto it = bins().begin(); it < bins().end(); ++it) {
     auto& bin = *it;  // old-style loop for old OpenMP
     fft_->updateDensity(bin.x(), bin.y(), bin.density());
@@ -1813,7 +2033,7 @@ void NesterovBase::updateDensityForceBin()
   // update electroPhi and electroForce
   // update sumPhi_ for nesterov loop
   sumPhi_ = 0;
-#pragma omp parallel for num_threads(nbc_->getNumThreads()) \
+#pragma omp parallel for num_threads(num_threads_) \
     reduction(+ : sumPhi_)
   for (auto it = bins().begin(); it < bins().end(); ++it) {
     auto& bin = *it;  // old-style loop for old OpenMP
@@ -1853,7 +2073,7 @@ void NesterovBase::initDensity1()
 
   initCoordi_.resize(gCellSize, FloatPoint());
 
-#pragma omp parallel for num_threads(nbc_->getNumThreads())
+#pragma omp parallel for num_threads(num_threads_)
   for (auto it = gCells_.begin(); it < gCells_.end(); ++it) {
     auto& gCell = *it;  // old-style loop for old OpenMP
     updateDensityCoordiLayoutInside(gCell);
@@ -1948,7 +2168,7 @@ void NesterovBase::updateGradients(std::vector<FloatPoint>& sumGrads,
                                    float wlCoeffX,
                                    float wlCoeffY)
 {
-  assert(omp_get_thread_num() == 0);
+  assert(omp_get_level() <= 1);
   if (isConverged_) {
     return;
   }
@@ -1961,28 +2181,15 @@ void NesterovBase::updateGradients(std::vector<FloatPoint>& sumGrads,
   debugPrint(
       log_, GPL, "updateGrad", 1, "DensityPenalty: {:g}", densityPenalty_);
 
-  // TODO: This OpenMP parallel section is causing non-determinism. Consider
-  // revisiting this in the future to restore determinism.
-  //#pragma omp parallel for num_threads(nbc_->getNumThreads()) reduction(+ :
-  // wireLengthGradSum_, densityGradSum_, gradSum)
-  for (size_t i = 0; i < gCells_.size(); i++) {
-    GCell* gCell = gCells_.at(i);
+  // The gradients of the cells are independent, so they are computed in
+  // parallel. The sums are then taken in cell order to stay deterministic.
+#pragma omp parallel for num_threads(num_threads_)
+  for (int i = 0; i < (int) gCells_.size(); i++) {  // NOLINT
+    GCell* gCell = gCells_[i];
     wireLengthGrads[i]
         = nbc_->getWireLengthGradientWA(gCell, wlCoeffX, wlCoeffY);
     densityGrads[i] = getDensityGradient(gCell);
 
-    // Different compiler has different results on the following formula.
-    // e.g. wireLengthGradSum_ += fabs(~~.x) + fabs(~~.y);
-    //
-    // To prevent instability problem,
-    // I partitioned the fabs(~~.x) + fabs(~~.y) as two terms.
-    //
-    wireLengthGradSum_ += std::fabs(wireLengthGrads[i].x);
-    wireLengthGradSum_ += std::fabs(wireLengthGrads[i].y);
-
-    densityGradSum_ += std::fabs(densityGrads[i].x);
-    densityGradSum_ += std::fabs(densityGrads[i].y);
-
     sumGrads[i].x = wireLengthGrads[i].x + densityPenalty_ * densityGrads[i].x;
     sumGrads[i].y = wireLengthGrads[i].y + densityPenalty_ * densityGrads[i].y;
 
@@ -2003,6 +2210,20 @@ void NesterovBase::updateGradients(std::vector<FloatPoint>& sumGrads,
 
     sumGrads[i].x /= sumPrecondi.x;
     sumGrads[i].y /= sumPrecondi.y;
+  }
+
+  for (size_t i = 0; i < gCells_.size(); i++) {
+    // Different compiler has different results on the following formula.
+    // e.g. wireLengthGradSum_ += fabs(~~.x) + fabs(~~.y);
+    //
+    // To prevent instability problem,
+    // I partitioned the fabs(~~.x) + fabs(~~.y) as two terms.
+    //
+    wireLengthGradSum_ += std::fabs(wireLengthGrads[i].x);
+    wireLengthGradSum_ += std::fabs(wireLengthGrads[i].y);
+
+    densityGradSum_ += std::fabs(densityGrads[i].x);
+    densityGradSum_ += std::fabs(densityGrads[i].y);
 
     gradSum += std::fabs(sumGrads[i].x) + std::fabs(sumGrads[i].y);
   }
@@ -2048,7 +2269,7 @@ void NesterovBase::updateNextGradient(float wlCoeffX, float wlCoeffY)
 void NesterovBase::updateInitialPrevSLPCoordi()
 {
   assert(omp_get_thread_num() == 0);
-#pragma omp parallel for num_threads(nbc_->getNumThreads())
+#pragma omp parallel for num_threads(num_threads_)
   for (size_t i = 0; i < gCells_.size(); i++) {
     GCell* curGCell = gCells_[i];
 
@@ -2118,7 +2339,7 @@ void NesterovBase::updateNextIter(const int iter)
   std::swap(prevSLPSumGrads_, curSLPSumGrads_);
 
   // Prevent locked instances from moving
-#pragma omp parallel for num_threads(nbc_->getNumThreads())
+#pragma omp parallel for num_threads(num_threads_)
   for (size_t k = 0; k < gCells_.size(); ++k) {
     if (gCells_[k]->isInstance() && gCells_[k]->instance()->isLocked()) {
       nextSLPCoordi_[k] = curSLPCoordi_[k];
@@ -2322,7 +2543,7 @@ bool NesterovBase::checkConvergence()
                    sumOverflowUnscaled_);
     }
 
-#pragma omp parallel for num_threads(nbc_->getNumThreads())
+#pragma omp parallel for num_threads(num_threads_)
     for (auto it = gCells_.begin(); it < gCells_.end(); ++it) {
       auto& gCell = *it;  // old-style loop for old OpenMP
       if (!gCell->isInstance()) {
@@ -2382,10 +2603,20 @@ static int fastModulo(const int input, const int ceil)
 
 static float getOverlapDensityArea(const Bin& bin, const GCell* cell)
 {
-  const int rectLx = std::max(bin.lx(), cell->dLx());
-  const int rectLy = std::max(bin.ly(), cell->dLy());
-  const int rectUx = std::min(bin.ux(), cell->dUx());
-  const int rectUy = std::min(bin.uy(), cell->dUy());
+  return getOverlapDensityArea(
+      bin, cell->dLx(), cell->dLy(), cell->dUx(), cell->dUy());
+}
+
+static float getOverlapDensityArea(const Bin& bin,
+                                   const int lx,
+                                   const int ly,
+                                   const int ux,
+                                   const int uy)
+{
+  const int rectLx = std::max(bin.lx(), lx);
+  const int rectLy = std::max(bin.ly(), ly);
+  const int rectUx = std::min(bin.ux(), ux);
+  const int rectUy = std::min(bin.uy(), uy);
 
   if (rectLx >= rectUx || rectLy >= rectUy) {
     return 0;
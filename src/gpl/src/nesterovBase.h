@@ -248,6 +248,8 @@ class GNet
 
   void addGPin(GPin* gPin);
   void updateBox();
+  // same as updateBox when given the bounding box of the pins
+  void setBox(int lx, int ly, int ux, int uy);
   int64_t hpwl() const;
 
   void setDontCare();
@@ -450,24 +452,6 @@ class GPin
   int cx() const { return cx_; }
   int cy() const { return cy_; }
 
-  // clear WA(Weighted Average) variables.
-  void clearWaVars();
-
-  void setMaxExpSumX(float maxExpSumX);
-  void setMaxExpSumY(float maxExpSumY);
-  void setMinExpSumX(float minExpSumX);
-  void setMinExpSumY(float minExpSumY);
-
-  float maxExpSumX() const { return maxExpSumX_; }
-  float maxExpSumY() const { return maxExpSumY_; }
-  float minExpSumX() const { return minExpSumX_; }
-  float minExpSumY() const { return minExpSumY_; }
-
-  bool hasMaxExpSumX() const { return hasMaxExpSumX_; }
-  bool hasMaxExpSumY() const { return hasMaxExpSumY_; }
-  bool hasMinExpSumX() const { return hasMinExpSumX_; }
-  bool hasMinExpSumY() const { return hasMinExpSumY_; }
-
   void setCenterLocation(int cx, int cy);
   void updateLocation(const GCell* gCell);
   void updateDensityLocation(const GCell* gCell);
@@ -481,29 +465,6 @@ class GPin
   int offsetCy_ = 0;
   int cx_ = 0;
   int cy_ = 0;
-
-  // weighted average WL vals stor for better indexing
-  // Please check the equation (4) in the ePlace-MS paper.
-  //
-  // maxExpSum_: holds exp(x_i/gamma)
-  // minExpSum_: holds exp(-x_i/gamma)
-  // the x_i is equal to cx_ variable.
-  //
-  float maxExpSumX_ = 0;
-  float maxExpSumY_ = 0;
-
-  float minExpSumX_ = 0;
-  float minExpSumY_ = 0;
-
-  // flag variables
-  //
-  // check whether
-  // this pin is considered in a WA models.
-  bool hasMaxExpSumX_ = false;
-  bool hasMaxExpSumY_ = false;
-
-  bool hasMinExpSumX_ = false;
-  bool hasMinExpSumY_ = false;
 };
 
 class Bin
@@ -706,6 +667,43 @@ class BinGrid
   void updateBinsNonPlaceArea();
 
  private:
+  // density box and scale of a GCell as last added to the bins
+  struct DensityBox
+  {
+    int lx = 0;
+    int ly = 0;
+    int ux = 0;
+    int uy = 0;
+    float scale = 0;
+
+    bool operator==(const DensityBox& box) const
+    {
+      return lx == box.lx && ly == box.ly && ux == box.ux && uy == box.uy
+             && scale == box.scale;
+    }
+  };
+
+  // adds (sign = 1) or removes (sign = -1) the area of cell at box
+  struct DensityUpdate
+  {
+    const GCell* cell;
+    DensityBox box;
+    int sign;
+  };
+
+  static DensityBox getDensityBox(const GCell* cell);
+  std::pair<int, int> getDensityMinMaxIdxX(int dLx, int dUx) const;
+  std::pair<int, int> getDensityMinMaxIdxY(int dLy, int dUy) const;
+
+  // Moves only the area of the cells whose density box changed since the
+  // previous call. Returns false when a full recompute is needed instead.
+  bool updateChangedGCellDensityArea(const std::vector<GCell*>& cells);
+  void applyDensityUpdates(const std::vector<DensityUpdate>& updates);
+  // applies update to the bins of rows [y_begin, y_end)
+  void addGCellDensityArea(const DensityUpdate& update,
+                           int y_begin,
+                           int y_end);
+
   std::vector<Bin> bins_;
   std::shared_ptr<PlacerBase> pb_;
   utl::Logger* log_ = nullptr;
@@ -722,6 +720,12 @@ class BinGrid
   int64_t overflowAreaUnscaled_ = 0;
   bool isSetBinCnt_ = false;
   int num_threads_ = 1;
+
+  // the cells and boxes added to the bins by updateBinsGCellDensityArea;
+  // empty when the bin areas must be recomputed from scratch
+  std::vector<const GCell*> densityCells_;
+  std::vector<DensityBox> densityBoxes_;
+  int deltaDensityUpdateCnt_ = 0;
 };
 
 inline std::vector<Bin>& BinGrid::bins()
@@ -824,6 +828,9 @@ class NesterovBaseCommon
 
   int64_t getHpwl();
 
+  // Estimate of the bytes held, for the memory report.
+  int64_t getMemoryUsage() const;
+
   void updateDbGCells();
 
   // Number of threads of execution
@@ -846,6 +853,26 @@ class NesterovBaseCommon
   std::unordered_map<Pin*, GPin*> gPinMap_;
   std::unordered_map<Net*, GNet*> gNetMap_;
 
+  // WA(Weighted Average) state of the pins, packed in net order so the WA
+  // kernel works on contiguous arrays. The pins of gNetStor_[i] are at
+  // [waNetPinStart_[i], waNetPinStart_[i + 1]) and gPinStor_[i] is at
+  // waPinPos_[i], or -1 without a net. An exp value is negative when the
+  // pin is not part of that WA term.
+  //
+  // minExp: holds exp(-x_i/gamma)
+  // maxExp: holds exp(x_i/gamma)
+  //
+  void initWaPins();
+  std::vector<int> waNetPinStart_;
+  std::vector<int> waPinPos_;
+  std::vector<GPin*> waPins_;
+  std::vector<int> waPinX_;
+  std::vector<int> waPinY_;
+  std::vector<float> waMinExpX_;
+  std::vector<float> waMaxExpX_;
+  std::vector<float> waMinExpY_;
+  std::vector<float> waMaxExpY_;
+
   int num_threads_;
 };
 
@@ -868,6 +895,7 @@ class NesterovBase
 
   float getSumOverflow() const { return sumOverflow_; }
   float getSumOverflowUnscaled() const { return sumOverflowUnscaled_; }
+  int64_t getLastHpwl() const { return prevHpwl_; }
   float getBaseWireLengthCoef() const { return baseWireLengthCoef_; }
   float getDensityPenalty() const { return densityPenalty_; }
 
@@ -889,6 +917,9 @@ class NesterovBase
   std::vector<Bin>& bins();
   const std::vector<Bin>& binsConst() const { return bg_.binsConst(); };
 
+  // Estimate of the bytes held, for the memory report.
+  int64_t getMemoryUsage() const;
+
   // filler cells / area control
   // will be used in Routability-driven loop
   int fillerDx() const;
@@ -955,6 +986,11 @@ class NesterovBase
   void initDensity1();
   float initDensity2(float wlCoeffX, float wlCoeffY);
   void setNpVars(NesterovPlaceVars* npVars) { npVars_ = npVars; }
+  // Threads used by the cell and bin loops of this region.  Lowered while
+  // several regions are stepped concurrently.
+  void setNumThreads(int num_threads);
+  int getNumThreads() const { return num_threads_; }
+  bool isConverged() const { return isConverged_; }
   void setIter(int iter) { iter_ = iter; }
   void setMaxPhiCoefChanged(bool maxPhiCoefChanged)
   {
@@ -1011,6 +1047,7 @@ class NesterovBase
 
   BinGrid bg_;
   std::unique_ptr<FFT> fft_;
+  int num_threads_ = 1;
 
   int fillerDx_ = 0;
   int fillerDy_ = 0;
@@ -35,6 +35,9 @@
 
 #include "nesterovPlace.h"
 
+#include <omp.h>
+
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -46,6 +49,7 @@
 #include "routeBase.h"
 #include "timingBase.h"
 #include "utl/Logger.h"
+#include "utl/exception.h"
 
 namespace gpl {
 using utl::GPL;
@@ -170,7 +174,11 @@ void NesterovPlace::updateCurGradient(const std::shared_ptr<NesterovBase>& nb)
 void NesterovPlace::updateNextGradient(const std::shared_ptr<NesterovBase>& nb)
 {
   nb->updateNextGradient(wireLengthCoefX_, wireLengthCoefY_);
+  checkNextGradient(nb);
+}
 
+void NesterovPlace::checkNextGradient(const std::shared_ptr<NesterovBase>& nb)
+{
   auto wireLengthGradSum_ = nb->getWireLengthGradSum();
   auto densityGradSum_ = nb->getDensityGradSum();
 
@@ -344,15 +352,26 @@ int NesterovPlace::doNesterovPlace(int start_iter)
     int numBackTrak = 0;
     for (numBackTrak = 0; numBackTrak < npVars_.maxBackTrack; numBackTrak++) {
       // fill in nextCoordinates with given stepLength_
-      for (auto& nb : nbVec_) {
+      runRegions([coeff](const std::shared_ptr<NesterovBase>& nb) {
         nb->nesterovUpdateCoordinates(coeff);
-      }
+      });
 
       nbc_->updateWireLengthForceWA(wireLengthCoefX_, wireLengthCoefY_);
 
+      const float wlCoefX = wireLengthCoefX_;
+      const float wlCoefY = wireLengthCoefY_;
+      runRegions([wlCoefX, wlCoefY](const std::shared_ptr<NesterovBase>& nb) {
+        nb->updateNextGradient(wlCoefX, wlCoefY);
+      });
+
       int numDiverge = 0;
       for (auto& nb : nbVec_) {
-        updateNextGradient(nb);
+        if (wireLengthCoefX_ != wlCoefX || wireLengthCoefY_ != wlCoefY) {
+          // an earlier region lowered the wirelength coefficient
+          updateNextGradient(nb);
+        } else {
+          checkNextGradient(nb);
+        }
         numDiverge += nb->isDiverged();
       }
 
@@ -538,6 +557,8 @@ int NesterovPlace::doNesterovPlace(int start_iter)
       break;
     }
   }
+  rb_->releaseGlobalRoute();
+
   // in all case including diverge,
   // db should be updated.
   updateDb();
@@ -554,6 +575,48 @@ int NesterovPlace::doNesterovPlace(int start_iter)
   return iter;
 }
 
+void NesterovPlace::runRegions(
+    const std::function<void(const std::shared_ptr<NesterovBase>&)>& func)
+{
+  std::vector<std::shared_ptr<NesterovBase>> active;
+  for (auto& nb : nbVec_) {
+    if (!nb->isConverged()) {
+      active.push_back(nb);
+    }
+  }
+  const int threads = nbc_->getNumThreads();
+  const int concurrent = std::min((int) active.size(), threads);
+  if (concurrent <= 1) {
+    for (auto& nb : active) {
+      func(nb);
+    }
+    return;
+  }
+
+  // Each region keeps its bin-level parallelism on its share of the
+  // threads, which needs a second active OpenMP level.
+  const int regionThreads = threads / concurrent;
+  for (auto& nb : active) {
+    nb->setNumThreads(regionThreads);
+  }
+  const int maxLevels = omp_get_max_active_levels();
+  omp_set_max_active_levels(std::max(maxLevels, 2));
+  utl::ThreadException exception;
+#pragma omp parallel for num_threads(concurrent) schedule(dynamic)
+  for (int i = 0; i < (int) active.size(); i++) {  // NOLINT
+    try {
+      func(active[i]);
+    } catch (...) {
+      exception.capture();
+    }
+  }
+  omp_set_max_active_levels(maxLevels);
+  for (auto& nb : active) {
+    nb->setNumThreads(threads);
+  }
+  exception.rethrow();
+}
+
 void NesterovPlace::updateWireLengthCoef(float overflow)
 {
   if (overflow > 1.0) {
@@ -586,6 +649,12 @@ void NesterovPlace::updateNextIter(const int iter)
 
   // For coefficient, using average regions' overflow
   updateWireLengthCoef(average_overflow_);
+
+  // The HPWL is of the whole design, the same for every region.
+  log_->metricSeries("global_place__iteration",
+                     {{"iteration", iter + 1},
+                      {"overflow", average_overflow_unscaled_},
+                      {"hpwl", nbVec_[0]->getLastHpwl()}});
 }
 
 void NesterovPlace::updateDb()
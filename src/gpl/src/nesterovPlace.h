@@ -33,6 +33,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -91,6 +92,12 @@ class NesterovPlace
   void updateNextGradient(const std::shared_ptr<NesterovBase>& nb);
 
  private:
+  void checkNextGradient(const std::shared_ptr<NesterovBase>& nb);
+  // Runs func on every region.  The regions not yet converged run
+  // concurrently, each with its share of the threads for its own loops.
+  void runRegions(
+      const std::function<void(const std::shared_ptr<NesterovBase>&)>& func);
+
   std::shared_ptr<PlacerBaseCommon> pbc_;
   std::shared_ptr<NesterovBaseCommon> nbc_;
   std::vector<std::shared_ptr<PlacerBase>> pbVec_;
@@ -966,6 +966,13 @@ int64_t PlacerBaseCommon::hpwl() const
   return hpwl;
 }
 
+int64_t PlacerBaseCommon::getMemoryUsage() const
+{
+  return instStor_.capacity() * sizeof(Instance)
+         + pinStor_.capacity() * sizeof(Pin)
+         + netStor_.capacity() * sizeof(Net);
+}
+
 Instance* PlacerBaseCommon::dbToPb(odb::dbInst* inst) const
 {
   auto instPtr = instMap_.find(inst);
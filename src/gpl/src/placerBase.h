@@ -334,6 +334,8 @@ class PlacerBaseCommon
   int padRight() const { return pbVars_.padRight; }
 
   int64_t hpwl() const;
+  // Estimate of the bytes held, for the memory report.
+  int64_t getMemoryUsage() const;
   void printInfo() const;
 
   int64_t macroInstsArea() const { return macroInstsArea_; }
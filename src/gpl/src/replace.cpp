@@ -49,6 +49,8 @@
 #include "sta/StaMain.hh"
 #include "timingBase.h"
 #include "utl/Logger.h"
+#include "utl/MemoryRegistry.h"
+#include "utl/Numa.h"
 
 namespace gpl {
 
@@ -69,6 +71,21 @@ void Replace::init(odb::dbDatabase* odb,
   rs_ = resizer;
   fr_ = router;
   log_ = logger;
+
+  memory_registration_
+      = log_->getMemoryRegistry()->add(GPL, "placer", [this] {
+          int64_t bytes = 0;
+          if (pbc_) {
+            bytes += pbc_->getMemoryUsage();
+          }
+          if (nbc_) {
+            bytes += nbc_->getMemoryUsage();
+          }
+          for (const auto& nb : nbVec_) {
+            bytes += nb->getMemoryUsage();
+          }
+          return bytes;
+        });
 }
 
 void Replace::reset()
@@ -91,6 +108,7 @@ void Replace::reset()
   initialPlaceMinDiffLength_ = 1500;
   initialPlaceMaxSolverIter_ = 100;
   initialPlaceMaxFanout_ = 200;
+  initialPlaceCoarsenLevels_ = 0;
   initialPlaceNetWeightScale_ = 800;
 
   nesterovPlaceMaxIter_ = 5000;
@@ -124,6 +142,7 @@ void Replace::reset()
   timingNetWeightOverflows_.clear();
   timingNetWeightOverflows_.shrink_to_fit();
   timingNetWeightMax_ = 1.9;
+  timingDrivenIncrementalMode_ = false;
 
   gui_debug_ = false;
   gui_debug_pause_iterations_ = 10;
@@ -190,7 +209,7 @@ void Replace::doIncrementalPlace(int threads)
   constexpr float rough_oveflow = 0.2f;
   float previous_overflow = overflow_;
   setTargetOverflow(std::max(rough_oveflow, overflow_));
-  doInitialPlace();
+  doInitialPlace(threads);
 
   int previous_max_iter = nesterovPlaceMaxIter_;
   initNesterovPlace(threads);
@@ -210,7 +229,7 @@ void Replace::doIncrementalPlace(int threads)
   }
 }
 
-void Replace::doInitialPlace()
+void Replace::doInitialPlace(int threads)
 {
   if (pbc_ == nullptr) {
     PlacerBaseVars pbVars;
@@ -244,13 +263,14 @@ void Replace::doInitialPlace()
   ipVars.minDiffLength = initialPlaceMinDiffLength_;
   ipVars.maxSolverIter = initialPlaceMaxSolverIter_;
   ipVars.maxFanout = initialPlaceMaxFanout_;
+  ipVars.coarsenLevels = initialPlaceCoarsenLevels_;
   ipVars.netWeightScale = initialPlaceNetWeightScale_;
   ipVars.debug = gui_debug_initial_;
 
   std::unique_ptr<InitialPlace> ip(
       new InitialPlace(ipVars, pbc_, pbVec_, log_));
   ip_ = std::move(ip);
-  ip_->doBicgstabPlace();
+  ip_->doBicgstabPlace(threads);
 }
 
 void Replace::runMBFF(int max_sz,
@@ -305,6 +325,8 @@ bool Replace::initNesterovPlace(int threads)
 
     nbVars.useUniformTargetDensity = uniformTargetDensityMode_;
 
+    // The cell and bin arrays are read by every Nesterov thread.
+    utl::ScopedInterleave interleave;
     nbc_ = std::make_shared<NesterovBaseCommon>(nbVars, pbc_, log_, threads);
 
     for (const auto& pb : pbVec_) {
@@ -333,6 +355,7 @@ bool Replace::initNesterovPlace(int threads)
     tb_ = std::make_shared<TimingBase>(nbc_, rs_, log_);
     tb_->setTimingNetWeightOverflows(timingNetWeightOverflows_);
     tb_->setTimingNetWeightMax(timingNetWeightMax_);
+    tb_->setIncrementalMode(timingDrivenIncrementalMode_);
   }
 
   if (!np_) {
@@ -397,6 +420,11 @@ void Replace::setInitialPlaceMaxFanout(int fanout)
   initialPlaceMaxFanout_ = fanout;
 }
 
+void Replace::setInitialPlaceCoarsenLevels(int levels)
+{
+  initialPlaceCoarsenLevels_ = levels;
+}
+
 void Replace::setInitialPlaceNetWeightScale(float scale)
 {
   initialPlaceNetWeightScale_ = scale;
@@ -568,4 +596,9 @@ void Replace::setTimingNetWeightMax(float max)
   timingNetWeightMax_ = max;
 }
 
+void Replace::setTimingDrivenIncrementalMode(bool mode)
+{
+  timingDrivenIncrementalMode_ = mode;
+}
+
 }  // namespace gpl
@@ -33,7 +33,8 @@ void
 replace_initial_place_cmd()
 {
   Replace* replace = getReplace();
-  replace->doInitialPlace();
+  int threads = ord::OpenRoad::openRoad()->getThreadCount();
+  replace->doInitialPlace(threads);
 }
 
 void 
@@ -82,6 +83,13 @@ set_initial_place_max_fanout_cmd(int fanout)
   replace->setInitialPlaceMaxFanout(fanout);
 }
 
+void
+set_initial_place_coarsen_levels_cmd(int levels)
+{
+  Replace* replace = getReplace();
+  replace->setInitialPlaceCoarsenLevels(levels);
+}
+
 void
 set_nesv_place_iter_cmd(int iter)
 {
@@ -271,6 +279,13 @@ set_timing_driven_net_weight_max_cmd(float max)
   return replace->setTimingNetWeightMax(max);
 }
 
+void
+set_timing_driven_incremental_mode_cmd(bool mode)
+{
+  Replace* replace = getReplace();
+  replace->setTimingDrivenIncrementalMode(mode);
+}
+
 
 
 void
@@ -50,6 +50,7 @@ sta::define_cmd_args "global_placement" {\
     [-overflow overflow]\
     [-initial_place_max_iter initial_place_max_iter]\
     [-initial_place_max_fanout initial_place_max_fanout]\
+    [-initial_place_coarsen_levels initial_place_coarsen_levels]\
     [-routability_use_grt]\
     [-routability_target_rc_metric routability_target_rc_metric]\
     [-routability_check_overflow routability_check_overflow]\
@@ -62,6 +63,7 @@ sta::define_cmd_args "global_placement" {\
     [-timing_driven_net_reweight_overflow timing_driven_net_reweight_overflow]\
     [-timing_driven_net_weight_max timing_driven_net_weight_max]\
     [-timing_driven_nets_percentage timing_driven_nets_percentage]\
+    [-timing_driven_incremental]\
     [-pad_left pad_left]\
     [-pad_right pad_right]\
 }
@@ -73,6 +75,7 @@ proc global_placement { args } {
       -min_phi_coef -max_phi_coef -overflow \
       -reference_hpwl \
       -initial_place_max_iter -initial_place_max_fanout \
+      -initial_place_coarsen_levels \
       -routability_check_overflow -routability_max_density \
       -routability_max_bloat_iter -routability_max_inflation_iter \
       -routability_target_rc_metric \
@@ -86,6 +89,7 @@ proc global_placement { args } {
     flags {-skip_initial_place \
       -skip_nesterov_place \
       -timing_driven \
+      -timing_driven_incremental \
       -routability_driven \
       -routability_use_grt \
       -disable_timing_driven \
@@ -141,6 +145,9 @@ proc global_placement { args } {
     if { [info exists keys(-timing_driven_nets_percentage)] } {
       rsz::set_worst_slack_nets_percent $keys(-timing_driven_nets_percentage)
     }
+
+    gpl::set_timing_driven_incremental_mode_cmd \
+      [info exists flags(-timing_driven_incremental)]
   }
 
   if { [info exists flags(-disable_timing_driven)] } {
@@ -174,6 +181,13 @@ proc global_placement { args } {
     gpl::set_initial_place_max_fanout_cmd $initial_place_max_fanout
   }
 
+  if { [info exists keys(-initial_place_coarsen_levels)] } {
+    set initial_place_coarsen_levels $keys(-initial_place_coarsen_levels)
+    sta::check_positive_integer "-initial_place_coarsen_levels" \
+      $initial_place_coarsen_levels
+    gpl::set_initial_place_coarsen_levels_cmd $initial_place_coarsen_levels
+  }
+
   # density settings
   set target_density 0.7
   set uniform_mode 0
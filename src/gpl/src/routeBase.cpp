@@ -160,9 +160,10 @@ void TileGrid::initTiles(bool use_rudy)
     log_->info(GPL, 39, "numRoutingLayers: {}", numRoutingLayers_);
   }
 
-  // 2D tile grid structure init
+  // 2D tile grid structure init, reusing the tiles of a previous call
   int x = lx_, y = ly_;
   int idxX = 0, idxY = 0;
+  tiles_.clear();
   tileStor_.resize(static_cast<uint64_t>(tileCntX_)
                    * static_cast<uint64_t>(tileCntY_));
   for (auto& tile : tileStor_) {
@@ -282,6 +283,7 @@ RouteBase::~RouteBase() = default;
 
 void RouteBase::reset()
 {
+  releaseGlobalRoute();
   rbVars_.reset();
   db_ = nullptr;
   nbc_ = nullptr;
@@ -294,8 +296,8 @@ void RouteBase::reset()
   minRcTargetDensity_ = 0;
   minRcViolatedCnt_ = 0;
 
-  minRcCellSize_.clear();
-  minRcCellSize_.shrink_to_fit();
+  minRcCellSizeDelta_.clear();
+  minRcCellSizeDelta_.shrink_to_fit();
 
   resetRoutabilityResources();
 }
@@ -303,11 +305,14 @@ void RouteBase::reset()
 void RouteBase::resetRoutabilityResources()
 {
   inflatedAreaDelta_ = 0;
+}
 
-  if (!rbVars_.useRudy) {
+void RouteBase::releaseGlobalRoute()
+{
+  if (incrementalGRoute_) {
+    incrementalGRoute_.reset();
     grouter_->clear();
   }
-  tg_.reset();
 }
 
 void RouteBase::init()
@@ -317,7 +322,6 @@ void RouteBase::init()
   tg_ = std::move(tg);
 
   tg_->setLogger(log_);
-  minRcCellSize_.resize(nbc_->gCells().size(), std::make_pair(0, 0));
 }
 
 void RouteBase::getRudyResult()
@@ -331,14 +335,22 @@ void RouteBase::getGrtResult()
   // update gCells' location to DB for GR
   nbc_->updateDbGCells();
 
-  // these two options must be on
-  grouter_->setAllowCongestion(true);
-  grouter_->setOverflowIterations(0);
+  if (incrementalGRoute_) {
+    // the db callbacks marked the nets of the moved cells dirty
+    incrementalGRoute_->updateRoutes();
+    grouter_->updateDbCongestion();
+  } else {
+    // these two options must be on
+    grouter_->setAllowCongestion(true);
+    grouter_->setOverflowIterations(0);
 
-  // this option must be off
-  grouter_->setCriticalNetsPercentage(0);
+    // this option must be off
+    grouter_->setCriticalNetsPercentage(0);
 
-  grouter_->globalRoute();
+    grouter_->globalRoute();
+    incrementalGRoute_ = std::make_unique<grt::IncrementalGRoute>(
+        grouter_, db_->getChip()->getBlock());
+  }
 
   updateGrtRoute();
 }
@@ -385,8 +397,8 @@ static float getUsageCapacityRatio(Tile* tile,
   // RePlAce/RC metric need 'blockage' because
   // if blockage ratio is larger than certain ratio,
   // need to skip.
-  uint8_t curCap = gGrid->getCapacity(layer, tile->x(), tile->y());
-  uint8_t curUse = gGrid->getUsage(layer, tile->x(), tile->y());
+  uint16_t curCap = gGrid->getCapacity(layer, tile->x(), tile->y());
+  uint16_t curUse = gGrid->getUsage(layer, tile->x(), tile->y());
   uint8_t blockage = (isHorizontal) ? blockH : blockV;
 
   // escape tile ratio cals when capacity = 0
@@ -565,11 +577,6 @@ std::pair<bool, bool> RouteBase::routability()
 {
   increaseCounter();
 
-  // create Tile Grid
-  std::unique_ptr<TileGrid> tg(new TileGrid());
-  tg_ = std::move(tg);
-  tg_->setLogger(log_);
-
   float curRc;
   if (rbVars_.useRudy) {
     getRudyResult();
@@ -585,6 +592,7 @@ std::pair<bool, bool> RouteBase::routability()
                "FinalRC lower than targetRC({}), routability not needed.",
                rbVars_.targetRC);
     resetRoutabilityResources();
+    releaseGlobalRoute();
     return std::make_pair(false, false);
   }
 
@@ -599,15 +607,8 @@ std::pair<bool, bool> RouteBase::routability()
     minRcTargetDensity_ = nbVec_[0]->targetDensity();
     minRcViolatedCnt_ = 0;
 
-    // save cell size info
-    for (auto& gCell : nbc_->gCells()) {
-      if (!gCell->isStdInstance()) {
-        continue;
-      }
-
-      minRcCellSize_[&gCell - nbc_->gCells().data()]
-          = std::make_pair(gCell->dx(), gCell->dy());
-    }
+    // the current cell sizes are the new minRc solution
+    minRcCellSizeDelta_.clear();
   } else {
     minRcViolatedCnt_++;
     log_->info(GPL,
@@ -654,6 +655,11 @@ std::pair<bool, bool> RouteBase::routability()
     int64_t prevCellArea
         = static_cast<int64_t>(gCell->dx()) * static_cast<int64_t>(gCell->dy());
 
+    minRcCellSizeDelta_.push_back(
+        {static_cast<int>(&gCell - nbc_->gCells().data()),
+         gCell->dx(),
+         gCell->dy()});
+
     // bloat
     gCell->setSize(static_cast<int>(std::round(
                        gCell->dx() * std::sqrt(tile->inflatedRatio()))),
@@ -723,6 +729,7 @@ std::pair<bool, bool> RouteBase::routability()
 
     nbVec_[0]->updateDensitySize();
     resetRoutabilityResources();
+    releaseGlobalRoute();
 
     return std::make_pair(false, true);
   }
@@ -812,16 +819,12 @@ std::pair<bool, bool> RouteBase::routability()
 
 void RouteBase::revertGCellSizeToMinRc()
 {
-  // revert back the gcell sizes
-  for (auto& gCell : nbc_->gCells()) {
-    if (!gCell->isStdInstance()) {
-      continue;
-    }
-
-    int idx = &gCell - nbc_->gCells().data();
-
-    gCell->setSize(minRcCellSize_[idx].first, minRcCellSize_[idx].second);
+  // undo the bloats in reverse so each cell ends at its minRc size
+  for (auto it = minRcCellSizeDelta_.rbegin(); it != minRcCellSizeDelta_.rend();
+       ++it) {
+    nbc_->gCells()[it->index]->setSize(it->dx, it->dy);
   }
+  minRcCellSizeDelta_.clear();
 }
 
 float RouteBase::getRudyRC() const
@@ -42,6 +42,7 @@ class dbDatabase;
 
 namespace grt {
 class GlobalRouter;
+class IncrementalGRoute;
 }
 
 namespace utl {
@@ -201,6 +202,8 @@ class RouteBase
   int inflationIterCnt() const;
 
   void revertGCellSizeToMinRc();
+  // Drops the global routes kept for the incremental routability calls.
+  void releaseGlobalRoute();
 
  private:
   RouteBaseVars rbVars_;
@@ -212,6 +215,9 @@ class RouteBase
   utl::Logger* log_ = nullptr;
 
   std::unique_ptr<TileGrid> tg_;
+  // Keeps the global routes between routability calls so only the nets of
+  // the cells moved since the last call are rerouted.
+  std::unique_ptr<grt::IncrementalGRoute> incrementalGRoute_;
 
   int64_t inflatedAreaDelta_ = 0;
 
@@ -221,12 +227,19 @@ class RouteBase
 
   // if solutions are not improved at all,
   // needs to revert back to have the minimized RC values.
-  // minRcInflationSize_ will store
-  // GCell's width and height
+  // minRcCellSizeDelta_ stores the GCell index and the width and height
+  // before each bloat done since the minRc solution, so a revert only
+  // touches the bloated cells.
+  struct CellSize
+  {
+    int index;
+    int dx;
+    int dy;
+  };
   float minRc_ = 1e30;
   float minRcTargetDensity_ = 0;
   int minRcViolatedCnt_ = 0;
-  std::vector<std::pair<int, int>> minRcCellSize_;
+  std::vector<CellSize> minRcCellSizeDelta_;
 
   void init();
   void reset();
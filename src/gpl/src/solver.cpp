@@ -48,7 +48,7 @@ ResidualError cpuSparseSolve(int maxSolverIter,
                              utl::Logger* logger)
 {
   ResidualError error;
-  BiCGSTAB<SMatrix, IdentityPreconditioner> solver;
+  BiCGSTAB<SMatrix, DiagonalPreconditioner<float>> solver;
   solver.setMaxIterations(maxSolverIter);
   solver.compute(placeInstForceMatrixX);
   instLocVecX = solver.solveWithGuess(fixedInstForceVecX, instLocVecX);
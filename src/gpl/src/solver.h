@@ -57,7 +57,7 @@ struct ResidualError
 };
 
 using Eigen::BiCGSTAB;
-using Eigen::IdentityPreconditioner;
+using Eigen::DiagonalPreconditioner;
 using utl::GPL;
 
 using SMatrix = Eigen::SparseMatrix<float, Eigen::RowMajor>;
@@ -142,9 +142,54 @@ void TimingBase::setTimingNetWeightMax(float max)
   net_weight_max_ = max;
 }
 
+void TimingBase::setIncrementalMode(bool mode)
+{
+  incremental_mode_ = mode;
+}
+
+void TimingBase::invalidateMovedNetParasitics()
+{
+  const auto& gCells = nbc_->gCells();
+  const bool have_locations = gcell_locations_.size() == gCells.size();
+  if (!have_locations) {
+    gcell_locations_.resize(gCells.size());
+  }
+
+  int moved_cell_count = 0;
+  for (size_t i = 0; i < gCells.size(); i++) {
+    GCell* gCell = gCells[i];
+    if (!gCell->isInstance()) {
+      continue;
+    }
+    const std::pair<int, int> location(gCell->dCx(), gCell->dCy());
+    if (have_locations && gcell_locations_[i] == location) {
+      continue;
+    }
+    gcell_locations_[i] = location;
+    moved_cell_count++;
+    for (GPin* gPin : gCell->gPins()) {
+      if (gPin->gNet()) {
+        rs_->parasiticsInvalid(gPin->gNet()->net()->dbNet());
+      }
+    }
+  }
+
+  debugPrint(log_,
+             GPL,
+             "timing",
+             1,
+             "moved cells since last reweight: {}",
+             moved_cell_count);
+}
+
 bool TimingBase::updateGNetWeights(float overflow)
 {
-  rs_->findResizeSlacks();
+  // The first call has nothing to compare against and estimates every net.
+  const bool incremental = incremental_mode_ && !gcell_locations_.empty();
+  if (incremental_mode_) {
+    invalidateMovedNetParasitics();
+  }
+  rs_->findResizeSlacks(incremental);
 
   // get worst resize nets
   sta::NetSeq& worst_slack_nets = rs_->resizeWorstSlackNets();
@@ -172,38 +217,44 @@ bool TimingBase::updateGNetWeights(float overflow)
     return false;
   }
 
-  int weighted_net_count = 0;
-  for (auto& gNet : nbc_->gNets()) {
-    // default weight
+  // Nets with slack < slack_max are all in worst_slack_nets,
+  // so only those need a new weight.
+  for (GNet* gNet : weighted_nets_) {
     gNet->setTimingWeight(1.0);
-    if (gNet->gPins().size() > 1) {
-      auto net_slack_opt = rs_->resizeNetSlack(gNet->net()->dbNet());
-      if (!net_slack_opt) {
-        continue;
-      }
-      auto net_slack = net_slack_opt.value();
-      if (net_slack < slack_max) {
-        if (slack_max == slack_min) {
-          gNet->setTimingWeight(1.0);
-        } else {
-          // weight(min_slack) = net_weight_max_
-          // weight(max_slack) = 1
-          const float weight = 1
-                               + (net_weight_max_ - 1) * (slack_max - net_slack)
-                                     / (slack_max - slack_min);
-          gNet->setTimingWeight(weight);
-        }
-        weighted_net_count++;
+  }
+  weighted_nets_.clear();
+
+  int weighted_net_count = 0;
+  for (odb::dbNet* db_net : rs_->resizeWorstSlackDbNets()) {
+    GNet* gNet = nbc_->dbToNb(db_net);
+    if (gNet == nullptr || gNet->gPins().size() <= 1) {
+      continue;
+    }
+    auto net_slack_opt = rs_->resizeNetSlack(db_net);
+    if (!net_slack_opt) {
+      continue;
+    }
+    auto net_slack = net_slack_opt.value();
+    if (net_slack < slack_max) {
+      if (slack_max != slack_min) {
+        // weight(min_slack) = net_weight_max_
+        // weight(max_slack) = 1
+        const float weight = 1
+                             + (net_weight_max_ - 1) * (slack_max - net_slack)
+                                   / (slack_max - slack_min);
+        gNet->setTimingWeight(weight);
+        weighted_nets_.push_back(gNet);
       }
-      debugPrint(log_,
-                 GPL,
-                 "timing",
-                 1,
-                 "net:{} slack:{} weight:{}",
-                 gNet->net()->dbNet()->getConstName(),
-                 net_slack,
-                 gNet->totalWeight());
+      weighted_net_count++;
     }
+    debugPrint(log_,
+               GPL,
+               "timing",
+               1,
+               "net:{} slack:{} weight:{}",
+               db_net->getConstName(),
+               net_slack,
+               gNet->totalWeight());
   }
 
   log_->info(GPL, 103, "Timing-driven: weighted {} nets.", weighted_net_count);
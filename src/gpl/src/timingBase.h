@@ -34,6 +34,7 @@
 #pragma once
 
 #include <memory>
+#include <utility>
 #include <vector>
 
 namespace rsz {
@@ -67,6 +68,10 @@ class TimingBase
 
   void setTimingNetWeightMax(float max);
 
+  // Only re-estimate the parasitics of nets with moved cells
+  // after the first reweighting.
+  void setIncrementalMode(bool mode);
+
   // updateNetWeight.
   // True: successfully reweighted gnets
   // False: no slacks found
@@ -80,7 +85,15 @@ class TimingBase
   std::vector<int> timingNetWeightOverflow_;
   std::vector<int> timingOverflowChk_;
   float net_weight_max_ = 1.9;
+  bool incremental_mode_ = false;
+
+  // nets weighted by the previous updateGNetWeights
+  std::vector<GNet*> weighted_nets_;
+  // gCell (dCx, dCy) at the previous updateGNetWeights
+  std::vector<std::pair<int, int>> gcell_locations_;
+
   void initTimingOverflowChk();
+  void invalidateMovedNetParasitics();
 };
 
 }  // namespace gpl
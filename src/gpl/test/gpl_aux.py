@@ -26,6 +26,7 @@ def global_placement(
     overflow=None,  # positive float
     initial_place_max_iter=None,  # positive int, default 20
     initial_place_max_fanout=None,  # positive int, default 200
+    initial_place_coarsen_levels=None,  # positive int, default 0
     routability_check_overflow=None,  # positive float
     routability_max_density=None,  # positive float  default  0.99
     routability_max_bloat_iter=None,  # positive int  default  1
@@ -37,6 +38,7 @@ def global_placement(
     timing_driven_net_reweight_overflow=None,  # list of ints
     timing_driven_net_weight_max=None,  # float
     timing_driven_nets_percentage=None,  # float
+    timing_driven_incremental=False,
     pad_left=None,  # positive int
     pad_right=None,  # positive int
 ):
@@ -77,6 +79,8 @@ def global_placement(
                 f"rsz::set_worst_slack_nets_percent {timing_driven_nets_percentage}"
             )
 
+        gpl.setTimingDrivenIncrementalMode(timing_driven_incremental)
+
     gpl.setRoutabilityDrivenMode(routability_driven)
 
     if routability_driven:
@@ -88,6 +92,13 @@ def global_placement(
     elif initial_place_max_fanout != None:
         utl.error(utl.GPL, 505, "initial_place_max_fanout must be a positive integer")
 
+    if is_pos_int(initial_place_coarsen_levels):
+        gpl.setInitialPlaceCoarsenLevels(initial_place_coarsen_levels)
+    elif initial_place_coarsen_levels != None:
+        utl.error(
+            utl.GPL, 509, "initial_place_coarsen_levels must be a positive integer"
+        )
+
     uniform_mode = False
 
     if density != None:
@@ -160,7 +171,7 @@ def global_placement(
         if incremental:
             gpl.doIncrementalPlace(1)
         else:
-            gpl.doInitialPlace()
+            gpl.doInitialPlace(1)
             if not skip_nesterov_place:
                 gpl.doNesterovPlace(1)
         gpl.reset()
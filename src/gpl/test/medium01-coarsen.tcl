@@ -0,0 +1,8 @@
+source helpers.tcl
+set test_name medium01-coarsen
+read_lef ./nangate45.lef
+read_def ./medium01.def
+
+# the log reports each cluster level of the initial placement
+global_placement -initial_place_coarsen_levels 3
+source report_hpwl.tcl
@@ -0,0 +1,20 @@
+source helpers.tcl
+set test_name simple01-td-incremental
+read_liberty ./library/nangate45/NangateOpenCellLibrary_typical.lib
+
+read_lef ./nangate45.lef
+read_def ./simple01-td.def
+
+create_clock -name core_clock -period 2 clk
+
+set_wire_rc -signal -layer metal3
+set_wire_rc -clock  -layer metal5
+
+# report the cells moved between the timing-driven reweights
+set_debug_level GPL timing 1
+global_placement -timing_driven -timing_driven_incremental
+set_debug_level GPL timing 0
+
+# check reported wns
+estimate_parasitics -placement
+report_worst_slack
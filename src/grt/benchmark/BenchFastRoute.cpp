@@ -0,0 +1,173 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Microbenchmark of FastRoute on a synthetic congested grid.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "FastRoute.h"
+#include "odb/db.h"
+#include "stt/SteinerTreeBuilder.h"
+#include "utl/Logger.h"
+
+namespace grt {
+
+namespace {
+
+constexpr int num_layers = 4;
+
+// The nets given to FastRoute.  FastRoute only needs the dbNets as keys,
+// so the block holds nothing else.
+class SyntheticNets
+{
+ public:
+  explicit SyntheticNets(int num_nets)
+  {
+    db_ = odb::dbDatabase::create();
+    db_->setLogger(&logger_);
+    odb::dbTech::create(db_, "tech");
+    odb::dbChip* chip = odb::dbChip::create(db_);
+    odb::dbBlock* block = odb::dbBlock::create(chip, "top");
+    for (int i = 0; i < num_nets; i++) {
+      nets_.push_back(
+          odb::dbNet::create(block, ("n" + std::to_string(i)).c_str()));
+    }
+    stt_builder_.init(db_, &logger_);
+  }
+
+  ~SyntheticNets() { odb::dbDatabase::destroy(db_); }
+
+  odb::dbDatabase* db() const { return db_; }
+  utl::Logger* logger() { return &logger_; }
+  stt::SteinerTreeBuilder* sttBuilder() { return &stt_builder_; }
+  const std::vector<odb::dbNet*>& nets() const { return nets_; }
+
+ private:
+  utl::Logger logger_;
+  stt::SteinerTreeBuilder stt_builder_;
+  odb::dbDatabase* db_ = nullptr;
+  std::vector<odb::dbNet*> nets_;
+};
+
+// Sets up a grid_size x grid_size grid in the order GlobalRouter does,
+// with the metal1 capacity left empty like a real design.  The nets are
+// short random nets of two to six pins, dense enough to overflow the
+// pattern routes so the run goes through the maze rip-up and reroute.
+std::unique_ptr<FastRouteCore> makeFastRoute(SyntheticNets& synthetic,
+                                             int grid_size,
+                                             int capacity)
+{
+  constexpr int tile_size = 3000;
+  constexpr int max_degree = 6;
+  auto fastroute = std::make_unique<FastRouteCore>(
+      synthetic.db(), synthetic.logger(), synthetic.sttBuilder());
+  fastroute->setVerbose(false);
+  fastroute->setLowerLeft(0, 0);
+  fastroute->setTileSize(tile_size);
+  fastroute->setGridsAndLayers(grid_size, grid_size, num_layers);
+  fastroute->setGridMax(grid_size * tile_size, grid_size * tile_size);
+  for (int l = 1; l <= num_layers; l++) {
+    fastroute->addLayerDirection(l - 1,
+                                 l % 2 ? odb::dbTechLayerDir::HORIZONTAL
+                                       : odb::dbTechLayerDir::VERTICAL);
+    const int layer_capacity = l == 1 ? 0 : capacity;
+    fastroute->addHCapacity(l % 2 ? layer_capacity : 0, l);
+    fastroute->addVCapacity(l % 2 ? 0 : layer_capacity, l);
+  }
+  fastroute->setMaxNetDegree(max_degree);
+
+  std::mt19937 rng(1);
+  std::uniform_int_distribution<int> grid_dist(0, grid_size - 1);
+  std::uniform_int_distribution<int> offset_dist(-8, 8);
+  std::uniform_int_distribution<int> degree_dist(2, max_degree);
+  for (odb::dbNet* net : synthetic.nets()) {
+    FrNet* fr_net = fastroute->addNet(net,
+                                      /*is_clock=*/false,
+                                      /*driver_idx=*/0,
+                                      /*cost=*/1,
+                                      /*min_layer=*/1,
+                                      /*max_layer=*/num_layers - 1,
+                                      /*slack=*/0,
+                                      /*edge_cost_per_layer=*/nullptr);
+    const int x = grid_dist(rng);
+    const int y = grid_dist(rng);
+    const int degree = degree_dist(rng);
+    for (int pin = 0; pin < degree; pin++) {
+      const int pin_x = std::clamp(x + offset_dist(rng), 0, grid_size - 1);
+      const int pin_y = std::clamp(y + offset_dist(rng), 0, grid_size - 1);
+      fr_net->addPin(pin_x, pin_y, 0);
+    }
+  }
+
+  fastroute->initEdges();
+  std::vector<int> track_space(num_layers, tile_size / 20);
+  fastroute->initBlockedIntervals(track_space);
+  fastroute->initAuxVar();
+  return fastroute;
+}
+
+}  // namespace
+
+// Full global routing of state.range(1) nets on a state.range(0) grid.
+// mazeRouteMSMD is private to FastRouteCore, so it is measured through
+// run(), where it dominates once the grid is congested.  The remaining
+// overflow is reported so a change in routing quality is visible next to
+// the runtime.
+static void BM_FastRouteCongested(benchmark::State& state)
+{
+  const int grid_size = state.range(0);
+  SyntheticNets synthetic(state.range(1));
+  constexpr int capacity = 10;
+
+  int overflow = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto fastroute = makeFastRoute(synthetic, grid_size, capacity);
+    state.ResumeTiming();
+    NetRouteMap routes = fastroute->run();
+    benchmark::DoNotOptimize(routes.size());
+    overflow = fastroute->totalOverflow();
+  }
+  state.counters["overflow"] = overflow;
+}
+BENCHMARK(BM_FastRouteCongested)
+    ->Args({64, 8000})
+    ->Args({128, 32000})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace grt
@@ -48,7 +48,9 @@
 #include "ant/AntennaChecker.hh"
 #include "odb/db.h"
 #include "odb/dbBlockCallBackObj.h"
+#include "odb/dbGuideStore.h"
 #include "sta/Liberty.hh"
+#include "utl/MemoryRegistry.h"
 
 using AdjacencyList = std::vector<std::vector<int>>;
 
@@ -72,6 +74,11 @@ namespace ant {
 class AntennaChecker;
 }
 
+namespace dst {
+class Distributed;
+class RegionJobDescription;
+}  // namespace dst
+
 namespace dpl {
 class Opendp;
 }
@@ -102,6 +109,7 @@ class GlobalRouter;
 class AbstractRoutingCongestionDataSource;
 class GRouteDbCbk;
 class Rudy;
+struct BlockedTiles;
 
 struct RegionAdjustment
 {
@@ -154,12 +162,15 @@ class GlobalRouter : public ant::GlobalRouteSource
             rsz::Resizer* resizer,
             ant::AntennaChecker* antenna_checker,
             dpl::Opendp* opendp,
+            dst::Distributed* dist,
             std::unique_ptr<AbstractRoutingCongestionDataSource>
                 routing_congestion_data_source,
             std::unique_ptr<AbstractRoutingCongestionDataSource>
                 routing_congestion_data_source_rudy);
 
   void clear();
+  // Writes the usage of the current routes to the dbGCellGrid.
+  void updateDbCongestion();
 
   void setAdjustment(const float adjustment);
   void setMinRoutingLayer(const int min_layer);
@@ -182,7 +193,22 @@ class GlobalRouter : public ant::GlobalRouteSource
   void setCongestionReportFile(const char* file_name);
   void setGridOrigin(int x, int y);
   void setAllowCongestion(bool allow_congestion);
+  void setParallelMaze(bool parallel, int threads);
+  void setLayerAssignmentThreads(int threads);
   void setMacroExtension(int macro_extension);
+  // Reroutes the congested regions left by global_route on the dst workers
+  // behind the load balancer at ip and port.  The design and the routes are
+  // shared with the workers through the shared volume.
+  void setDistributed(bool on) { distributed_ = on; }
+  void setDistributedIpPort(const std::string& ip, unsigned short port);
+  void setSharedVolume(const std::string& shared_volume);
+  // Worker side of the distributed rerouting.  Rebuilds the routing state
+  // from the routes on the shared volume, reroutes the nets of the region
+  // and returns their routes in the format of writeSegments.  The total
+  // overflow before and after the reroute is returned in the arguments.
+  std::string routeRegion(const dst::RegionJobDescription* desc,
+                          int& overflow_before,
+                          int& overflow_after);
 
   // flow functions
   void readGuides(const char* file_name);
@@ -277,6 +303,9 @@ class GlobalRouter : public ant::GlobalRouteSource
   void reportNetLayerWirelengths(odb::dbNet* db_net, std::ofstream& out);
   void reportLayerWireLengths();
   odb::Rect globalRoutingToBox(const GSegment& route);
+  odb::dbGuideStore::Guide segmentToGuide(const GSegment& segment,
+                                          odb::dbTechLayer* layer,
+                                          odb::dbTechLayer* via_layer);
   void boxToGlobalRouting(const odb::Rect& route_bds,
                           int layer,
                           int via_layer,
@@ -314,6 +343,8 @@ class GlobalRouter : public ant::GlobalRouteSource
  private:
   // Net functions
   Net* addNet(odb::dbNet* db_net);
+  // Creates the net and its pins without their positions on the grid.
+  Net* createNet(odb::dbNet* db_net);
   void removeNet(odb::dbNet* db_net);
 
   void applyAdjustments(int min_routing_layer, int max_routing_layer);
@@ -343,8 +374,12 @@ class GlobalRouter : public ant::GlobalRouteSource
   void computeRegionAdjustments(const odb::Rect& region,
                                 int layer,
                                 float reduction_percentage);
-  void applyObstructionAdjustment(const odb::Rect& obstruction,
-                                  odb::dbTechLayer* tech_layer);
+  // Obstructions per layer, indexed by routing level - 1.
+  using LayerObstructions = std::vector<std::vector<odb::Rect>>;
+  void applyObstructionAdjustments(const LayerObstructions& obstructions);
+  bool findBlockedTiles(const odb::Rect& obstruction,
+                        odb::dbTechLayer* tech_layer,
+                        BlockedTiles& blocked_tiles) const;
   void addResourcesForPinAccess();
   int computeNetWirelength(odb::dbNet* db_net);
   void computeWirelength();
@@ -359,6 +394,8 @@ class GlobalRouter : public ant::GlobalRouteSource
                                               odb::Point& pos_on_grid);
   int getNetMaxRoutingLayer(const Net* net);
   void findPins(Net* net);
+  // Finds the pin positions of the nets in parallel.
+  void findPins(const std::vector<Net*>& nets);
   void findFastRoutePins(Net* net,
                          std::vector<RoutePt>& pins_on_grid,
                          int& root_idx);
@@ -391,6 +428,9 @@ class GlobalRouter : public ant::GlobalRouteSource
   void reportResources();
   void reportCongestion();
   void updateEdgesUsage();
+  bool loadRoutesFromGuides();
+  void updateRouteUsage(odb::dbNet* db_net, const GRoute& route, int sign);
+  void releaseRestoredRoute(odb::dbNet* db_net);
   void updateDbCongestionFromGuides();
   void computeGCellGridPatternFromGuides(
       std::unordered_map<odb::dbNet*, Guides>& guides);
@@ -417,7 +457,6 @@ class GlobalRouter : public ant::GlobalRouteSource
   void removeWireUsage(odb::dbWire* wire);
   void removeRectUsage(const odb::Rect& rect, odb::dbTechLayer* tech_layer);
   bool isDetailedRouted(odb::dbNet* db_net);
-  void updateDbCongestion();
 
   // db functions
   void initGrid(int max_layer);
@@ -426,7 +465,7 @@ class GlobalRouter : public ant::GlobalRouteSource
   std::vector<Net*> findNets();
   void computeObstructionsAdjustments();
   void findLayerExtensions(std::vector<int>& layer_extensions);
-  int findObstructions(odb::Rect& die_area);
+  int findObstructions(odb::Rect& die_area, LayerObstructions& obstructions);
   bool layerIsBlocked(int layer,
                       const std::unordered_map<int, std::vector<odb::Rect>>&
                           macro_obs_per_layer,
@@ -438,12 +477,15 @@ class GlobalRouter : public ant::GlobalRouteSource
   int findInstancesObstructions(
       odb::Rect& die_area,
       const std::vector<int>& layer_extensions,
-      std::map<int, std::vector<odb::Rect>>& layer_obs_map);
-  void findNetsObstructions(odb::Rect& die_area);
-  void applyNetObstruction(const odb::Rect& rect,
-                           odb::dbTechLayer* tech_layer,
-                           const odb::Rect& die_area,
-                           odb::dbNet* db_net);
+      std::map<int, std::vector<odb::Rect>>& layer_obs_map,
+      LayerObstructions& obstructions);
+  void findNetsObstructions(odb::Rect& die_area,
+                            LayerObstructions& obstructions);
+  void addNetObstruction(const odb::Rect& rect,
+                         odb::dbTechLayer* tech_layer,
+                         const odb::Rect& die_area,
+                         odb::dbNet* db_net,
+                         LayerObstructions& obstructions);
   int computeMaxRoutingLayer();
   std::map<int, odb::dbTechVia*> getDefaultVias(int max_routing_layer);
   void makeItermPins(Net* net, odb::dbNet* db_net, const odb::Rect& die_area);
@@ -454,6 +496,16 @@ class GlobalRouter : public ant::GlobalRouteSource
   void ensureLayerForGuideDimension(int max_routing_layer);
   void configFastRoute();
   void checkOverflow();
+  void writeRouteSegments(std::ostream& out,
+                          const std::string& net_name,
+                          const GRoute& route);
+  void parseSegments(std::istream& in,
+                     const std::string& source,
+                     NetRouteMap& routes);
+  std::string writeRegionSettings();
+  void readRegionSettings(std::istream& in, std::vector<odb::dbNet*>& nets);
+  void rerouteCongestedRegions();
+  void mergeRegionRoutes(const NetRouteMap& routes, NetRouteMap& old_routes);
 
   utl::Logger* logger_;
   stt::SteinerTreeBuilder* stt_builder_;
@@ -465,6 +517,7 @@ class GlobalRouter : public ant::GlobalRouteSource
   odb::Point grid_origin_;
   std::unique_ptr<AbstractGrouteRenderer> groute_renderer_;
   NetRouteMap routes_;
+  utl::MemoryRegistration memory_registration_;
 
   std::map<odb::dbNet*, Net*> db_net_map_;
   Grid* grid_;
@@ -479,6 +532,9 @@ class GlobalRouter : public ant::GlobalRouteSource
   int overflow_iterations_;
   int congestion_report_iter_step_;
   bool allow_congestion_;
+  bool parallel_maze_;
+  int maze_threads_;
+  int layer_assignment_threads_;
   std::vector<int> vertical_capacities_;
   std::vector<int> horizontal_capacities_;
   int macro_extension_;
@@ -518,6 +574,16 @@ class GlobalRouter : public ant::GlobalRouteSource
 
   // incremental grt
   GRouteDbCbk* grouter_cbk_;
+  // nets whose route was restored from the guides and has no Steiner tree
+  std::set<odb::dbNet*> restored_nets_;
+
+  // distributed rerouting of congested regions
+  dst::Distributed* dist_;
+  bool distributed_;
+  std::string dist_ip_;
+  unsigned short dist_port_;
+  std::string shared_volume_;
+  int dist_design_version_;
 
   friend class IncrementalGRoute;
   friend class GRouteDbCbk;
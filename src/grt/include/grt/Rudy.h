@@ -79,7 +79,9 @@ class Rudy
    * If the layer which name is metal1 and it has getWidth value, then this
    * function will not applied, but it will apply that information.
    * */
-  void setWireWidth(int wire_width) { wire_width_ = wire_width; }
+  void setWireWidth(int wire_width);
+
+  void setNumThreads(int num_threads) { num_threads_ = num_threads; }
 
   const Tile& getTile(int x, int y) const { return grid_.at(x).at(y); }
   std::pair<int, int> getGridSize() const;
@@ -92,7 +94,9 @@ class Rudy
   void makeGrid();
   void getResourceReductions();
   Tile& getEditableTile(int x, int y) { return grid_.at(x).at(y); }
-  void processIntersectionSignalNet(odb::Rect net_rect);
+  void getNetRects(std::vector<odb::Rect>& net_rects) const;
+  void processIntersectionSignalNet(odb::Rect net_rect, double sign);
+  void integrateInteriorRudy();
 
   odb::dbBlock* block_;
   odb::Rect grid_block_;
@@ -101,7 +105,17 @@ class Rudy
   int tile_cnt_y_ = 40;
   int wire_width_ = 100;
   int tile_size_ = 0;
+  int num_threads_ = 1;
   std::vector<std::vector<Tile>> grid_;
+
+  // Net rudy is kept between calls so that only the nets whose bounding box
+  // changed are recomputed. The tiles fully covered by a net all get the same
+  // rudy, so they go through a 2D difference array (interior_diff_) that is
+  // integrated once per call.
+  bool net_rudy_valid_ = false;
+  std::vector<odb::Rect> net_rects_;  // indexed by dbNet id
+  std::vector<double> net_rudy_;      // x * tile_cnt_y_ + y
+  std::vector<double> interior_diff_;
 };
 
 }  // namespace grt
@@ -59,6 +59,9 @@
 #include "RepairAntennas.h"
 #include "RoutingTracks.h"
 #include "db_sta/dbNetwork.hh"
+#include "dst/Distributed.h"
+#include "dst/JobMessage.h"
+#include "dst/RegionJobDescription.h"
 #include "db_sta/dbSta.hh"
 #include "grt/GRoute.h"
 #include "grt/Rudy.h"
@@ -73,6 +76,7 @@
 #include "sta/Set.hh"
 #include "stt/SteinerTreeBuilder.h"
 #include "utl/Logger.h"
+#include "utl/ThreadPool.h"
 #include "utl/algorithms.h"
 
 namespace grt {
@@ -80,6 +84,10 @@ namespace grt {
 using boost::icl::interval;
 using utl::GRT;
 
+// Side of the square regions the congested nets are grouped in for the
+// distributed reroute, in gcells.
+static const int region_gcells = 64;
+
 GlobalRouter::GlobalRouter()
     : logger_(nullptr),
       stt_builder_(nullptr),
@@ -97,6 +105,9 @@ GlobalRouter::GlobalRouter()
       overflow_iterations_(50),
       congestion_report_iter_step_(0),
       allow_congestion_(false),
+      parallel_maze_(false),
+      maze_threads_(1),
+      layer_assignment_threads_(1),
       macro_extension_(0),
       initialized_(false),
       total_diodes_count_(0),
@@ -114,7 +125,11 @@ GlobalRouter::GlobalRouter()
       heatmap_(nullptr),
       heatmap_rudy_(nullptr),
       congestion_file_name_(nullptr),
-      grouter_cbk_(nullptr)
+      grouter_cbk_(nullptr),
+      dist_(nullptr),
+      distributed_(false),
+      dist_port_(0),
+      dist_design_version_(0)
 {
 }
 
@@ -125,6 +140,7 @@ void GlobalRouter::init(utl::Logger* logger,
                         rsz::Resizer* resizer,
                         ant::AntennaChecker* antenna_checker,
                         dpl::Opendp* opendp,
+                        dst::Distributed* dist,
                         std::unique_ptr<AbstractRoutingCongestionDataSource>
                             routing_congestion_data_source,
                         std::unique_ptr<AbstractRoutingCongestionDataSource>
@@ -136,6 +152,7 @@ void GlobalRouter::init(utl::Logger* logger,
   stt_builder_ = stt_builder;
   antenna_checker_ = antenna_checker;
   opendp_ = opendp;
+  dist_ = dist;
   fastroute_ = new FastRouteCore(db_, logger_, stt_builder_);
   sta_ = sta;
   resizer_ = resizer;
@@ -144,6 +161,15 @@ void GlobalRouter::init(utl::Logger* logger,
   heatmap_->registerHeatMap();
   heatmap_rudy_ = std::move(routing_congestion_data_source_rudy);
   heatmap_rudy_->registerHeatMap();
+
+  memory_registration_ = logger_->getMemoryRegistry()->add(
+      utl::GRT, "fastroute", [this] {
+        int64_t bytes = fastroute_->getMemoryUsage();
+        for (const auto& [db_net, route] : routes_) {
+          bytes += route.capacity() * sizeof(GSegment);
+        }
+        return bytes;
+      });
 }
 
 void GlobalRouter::clear()
@@ -159,6 +185,8 @@ void GlobalRouter::clear()
   fastroute_->clear();
   vertical_capacities_.clear();
   horizontal_capacities_.clear();
+  restored_nets_.clear();
+  dirty_nets_.clear();
   initialized_ = false;
 }
 
@@ -284,6 +312,12 @@ void GlobalRouter::globalRoute(bool save_guides,
                    "The start_incremental and end_incremental flags cannot be "
                    "defined together");
   } else if (start_incremental) {
+    if ((routes_.empty() || !initialized_) && !loadRoutesFromGuides()) {
+      logger_->warn(GRT,
+                    269,
+                    "No global routing found to start the incremental "
+                    "routing from.");
+    }
     grouter_cbk_ = new GRouteDbCbk(this);
     grouter_cbk_->addOwner(block_);
   } else {
@@ -307,6 +341,9 @@ void GlobalRouter::globalRoute(bool save_guides,
         }
 
         routes_ = findRouting(nets, min_layer, max_layer);
+        if (distributed_ && fastroute_->totalOverflow() > 0) {
+          rerouteCongestedRegions();
+        }
       }
     } catch (...) {
       updateDbCongestion();
@@ -330,6 +367,13 @@ void GlobalRouter::globalRoute(bool save_guides,
     }
     if (save_guides) {
       saveGuides();
+      // The guides are in the db, so the routing grid can be rebuilt from
+      // them by an incremental call.
+      if (!end_incremental
+          && logger_->getMemoryRegistry()->releaseOnExit()) {
+        fastroute_->clear();
+        initialized_ = false;
+      }
     }
   }
 }
@@ -467,12 +511,7 @@ void GlobalRouter::estimateRC(rsz::SpefWriter* spef_writer)
   MakeWireParasitics builder(
       logger_, resizer_, sta_, db_->getTech(), block_, this);
 
-  for (auto& [db_net, route] : routes_) {
-    if (!route.empty()) {
-      Net* net = getNet(db_net);
-      builder.estimateParasitcs(db_net, net->getPins(), route, spef_writer);
-    }
-  }
+  builder.estimateParasitcs(routes_, sta_->threadCount(), spef_writer);
 }
 
 void GlobalRouter::estimateRC(odb::dbNet* db_net)
@@ -628,6 +667,7 @@ void GlobalRouter::updateDirtyNets(std::vector<Net*>& dirty_nets)
     if (pinPositionsChanged(net, last_pos)
         && (!net->isMergedNet() || !netIsCovered(db_net, pins_not_covered))) {
       dirty_nets.push_back(db_net_map_[db_net]);
+      releaseRestoredRoute(db_net);
       routes_[db_net].clear();
       db_net->clearGuides();
       fastroute_->clearNetRoute(db_net);
@@ -842,6 +882,7 @@ Rudy* GlobalRouter::getRudy()
   if (rudy_ == nullptr) {
     rudy_ = new Rudy(db_->getChip()->getBlock(), this);
   }
+  rudy_->setNumThreads(sta_->threadCount());
 
   return rudy_;
 }
@@ -946,7 +987,7 @@ void GlobalRouter::findPins(Net* net)
     // this way, the result based on drt APs is maintained
     if (!has_access_points && pinOverlapsWithSingleTrack(pin, pos_on_grid)) {
       const int conn_layer = pin.getConnectionLayer();
-      odb::dbTechLayer* layer = routing_layers_[conn_layer];
+      odb::dbTechLayer* layer = routing_layers_.at(conn_layer);
       pos_on_grid = grid_->getPositionOnGrid(pos_on_grid);
       if (!(pos_on_grid == pin_position)
           && ((layer->getDirection() == odb::dbTechLayerDir::HORIZONTAL
@@ -961,6 +1002,13 @@ void GlobalRouter::findPins(Net* net)
   }
 }
 
+void GlobalRouter::findPins(const std::vector<Net*>& nets)
+{
+  // Each net only writes the positions of its own pins.
+  utl::ThreadPool::get().parallelFor(
+      0, nets.size(), [&](const int i) { findPins(nets[i]); });
+}
+
 int GlobalRouter::getNetMaxRoutingLayer(const Net* net)
 {
   return net->getSignalType() == odb::dbSigType::CLOCK
@@ -1392,6 +1440,7 @@ void GlobalRouter::computeGridAdjustments(int min_routing_layer,
 void GlobalRouter::computeTrackAdjustments(int min_routing_layer,
                                            int max_routing_layer)
 {
+  LayerObstructions obstructions(db_->getTech()->getRoutingLayerCount());
   for (auto const& [level, layer] : routing_layers_) {
     if (level < min_routing_layer
         || (level > max_routing_layer && max_routing_layer > 0))
@@ -1414,7 +1463,7 @@ void GlobalRouter::computeTrackAdjustments(int min_routing_layer,
       if (yh > grid_->getYMin()) {
         odb::Rect init_track_obs(
             grid_->getXMin(), grid_->getYMin(), grid_->getXMax(), yh);
-        applyObstructionAdjustment(init_track_obs, layer);
+        obstructions[level - 1].push_back(init_track_obs);
       }
 
       /* top most obstruction */
@@ -1422,7 +1471,7 @@ void GlobalRouter::computeTrackAdjustments(int min_routing_layer,
       if (yl < grid_->getYMax()) {
         odb::Rect final_track_obs(
             grid_->getXMin(), yl, grid_->getXMax(), grid_->getYMax());
-        applyObstructionAdjustment(final_track_obs, layer);
+        obstructions[level - 1].push_back(final_track_obs);
       }
     } else {
       /* left most obstruction */
@@ -1430,7 +1479,7 @@ void GlobalRouter::computeTrackAdjustments(int min_routing_layer,
       if (xh > grid_->getXMin()) {
         const odb::Rect init_track_obs(
             grid_->getXMin(), grid_->getYMin(), xh, grid_->getYMax());
-        applyObstructionAdjustment(init_track_obs, layer);
+        obstructions[level - 1].push_back(init_track_obs);
       }
 
       /* right most obstruction */
@@ -1438,10 +1487,11 @@ void GlobalRouter::computeTrackAdjustments(int min_routing_layer,
       if (xl < grid_->getXMax()) {
         const odb::Rect final_track_obs(
             xl, grid_->getYMin(), grid_->getXMax(), grid_->getYMax());
-        applyObstructionAdjustment(final_track_obs, layer);
+        obstructions[level - 1].push_back(final_track_obs);
       }
     }
   }
+  applyObstructionAdjustments(obstructions);
 }
 
 void GlobalRouter::computeUserGlobalAdjustments(int min_routing_layer,
@@ -1566,8 +1616,33 @@ void GlobalRouter::computeRegionAdjustments(const odb::Rect& region,
   }
 }
 
-void GlobalRouter::applyObstructionAdjustment(const odb::Rect& obstruction,
-                                              odb::dbTechLayer* tech_layer)
+void GlobalRouter::applyObstructionAdjustments(
+    const LayerObstructions& obstructions)
+{
+  odb::dbTech* tech = db_->getTech();
+  std::vector<odb::dbTechLayer*> tech_layers;
+  for (int layer = 1; layer <= obstructions.size(); layer++) {
+    tech_layers.push_back(tech->findRoutingLayer(layer));
+  }
+
+  std::vector<std::vector<BlockedTiles>> layer_blocked_tiles(
+      obstructions.size());
+  utl::ThreadPool::get().parallelFor(
+      0, obstructions.size(), [&](const int k) {
+        for (const odb::Rect& obstruction : obstructions[k]) {
+          BlockedTiles blocked_tiles;
+          if (findBlockedTiles(obstruction, tech_layers[k], blocked_tiles)) {
+            layer_blocked_tiles[k].push_back(blocked_tiles);
+          }
+        }
+      });
+
+  fastroute_->addObstructionAdjustments(layer_blocked_tiles);
+}
+
+bool GlobalRouter::findBlockedTiles(const odb::Rect& obstruction,
+                                    odb::dbTechLayer* tech_layer,
+                                    BlockedTiles& blocked_tiles) const
 {
   // compute the intersection between obstruction and the die area
   // only when they are overlapping to avoid assert error during
@@ -1578,47 +1653,34 @@ void GlobalRouter::applyObstructionAdjustment(const odb::Rect& obstruction,
     obstruction_rect = die_area.intersect(obstruction);
     // ignores obstructions completely outside the die area
     if (obstruction_rect.isInverted()) {
-      return;
+      return false;
     }
   }
 
   odb::Rect first_tile_box, last_tile_box;
-  odb::Point first_tile, last_tile;
-  grid_->getBlockedTiles(
-      obstruction_rect, first_tile_box, last_tile_box, first_tile, last_tile);
-
-  bool vertical = tech_layer->getDirection() == odb::dbTechLayerDir::VERTICAL;
+  grid_->getBlockedTiles(obstruction_rect,
+                         first_tile_box,
+                         last_tile_box,
+                         blocked_tiles.first_tile,
+                         blocked_tiles.last_tile);
 
   int layer = tech_layer->getRoutingLevel();
 
   int track_space = grid_->getTrackPitches()[layer - 1];
 
-  interval<int>::type first_tile_reduce_interval
+  blocked_tiles.first_tile_reduce_interval
       = grid_->computeTileReduceInterval(obstruction_rect,
                                          first_tile_box,
                                          track_space,
                                          true,
                                          tech_layer->getDirection());
-  interval<int>::type last_tile_reduce_interval
+  blocked_tiles.last_tile_reduce_interval
       = grid_->computeTileReduceInterval(obstruction_rect,
                                          last_tile_box,
                                          track_space,
                                          false,
                                          tech_layer->getDirection());
-
-  if (!vertical) {
-    fastroute_->addHorizontalAdjustments(first_tile,
-                                         last_tile,
-                                         layer,
-                                         first_tile_reduce_interval,
-                                         last_tile_reduce_interval);
-  } else {
-    fastroute_->addVerticalAdjustments(first_tile,
-                                       last_tile,
-                                       layer,
-                                       first_tile_reduce_interval,
-                                       last_tile_reduce_interval);
-  }
+  return true;
 }
 
 // For macro pins in the east and north edges of the macros, the access for
@@ -1753,6 +1815,17 @@ void GlobalRouter::setAllowCongestion(bool allow_congestion)
   allow_congestion_ = allow_congestion;
 }
 
+void GlobalRouter::setParallelMaze(bool parallel, int threads)
+{
+  parallel_maze_ = parallel;
+  maze_threads_ = threads;
+}
+
+void GlobalRouter::setLayerAssignmentThreads(int threads)
+{
+  layer_assignment_threads_ = threads;
+}
+
 void GlobalRouter::setMacroExtension(int macro_extension)
 {
   macro_extension_ = macro_extension;
@@ -1846,6 +1919,8 @@ void GlobalRouter::configFastRoute()
   fastroute_->setVerbose(verbose_);
   fastroute_->setOverflowIterations(overflow_iterations_);
   fastroute_->setCongestionReportIterStep(congestion_report_iter_step_);
+  fastroute_->setParallelMaze(parallel_maze_, maze_threads_);
+  fastroute_->setLayerAssignmentThreads(layer_assignment_threads_);
 
   if (congestion_file_name_ != nullptr) {
     fastroute_->setCongestionReportFile(congestion_file_name_);
@@ -2063,6 +2138,93 @@ void GlobalRouter::updateEdgesUsage()
   }
 }
 
+// Rebuilds the routing state from the guides saved in the db, so the
+// incremental routing of a new session doesn't need to route every net
+// again. The restored nets have no Steiner tree, so their usage is taken
+// from the guides and released the same way when they are rerouted.
+bool GlobalRouter::loadRoutesFromGuides()
+{
+  clear();
+  block_ = db_->getChip()->getBlock();
+
+  int min_layer, max_layer;
+  getMinMaxLayer(min_layer, max_layer);
+  initFastRoute(min_layer, max_layer);
+  fastroute_->clearNetsToRoute();
+
+  odb::dbGuideStore* store = block_->getGuideStore();
+  for (odb::dbNet* net : block_->getNets()) {
+    // Reading the packed guides avoids making dbGuides of them.
+    if (store->hasGuides(net)) {
+      for (const odb::dbGuideStore::Guide& guide : store->getGuides(net)) {
+        int layer_idx = store->getLayer(guide)->getRoutingLevel();
+        int via_layer_idx = store->getViaLayer(guide)->getRoutingLevel();
+        boxToGlobalRouting(
+            store->getBox(guide), layer_idx, via_layer_idx, routes_[net]);
+      }
+      continue;
+    }
+    for (odb::dbGuide* guide : net->getGuides()) {
+      int layer_idx = guide->getLayer()->getRoutingLevel();
+      int via_layer_idx = guide->getViaLayer()->getRoutingLevel();
+      boxToGlobalRouting(
+          guide->getBox(), layer_idx, via_layer_idx, routes_[net]);
+    }
+  }
+
+  for (auto it = routes_.begin(); it != routes_.end();) {
+    odb::dbNet* db_net = it->first;
+    auto net_it = db_net_map_.find(db_net);
+    // Guides of nets the global router does not route (e.g. with no pins)
+    // have no usage to restore.
+    if (net_it == db_net_map_.end()) {
+      logger_->warn(GRT,
+                    273,
+                    "Net {} has guides but is not globally routed. Its guides "
+                    "are ignored.",
+                    db_net->getConstName());
+      it = routes_.erase(it);
+      continue;
+    }
+    mergeSegments(net_it->second->getPins(), it->second);
+    updateRouteUsage(db_net, it->second, 1);
+    restored_nets_.insert(db_net);
+    ++it;
+  }
+
+  return !routes_.empty();
+}
+
+void GlobalRouter::updateRouteUsage(odb::dbNet* db_net,
+                                    const GRoute& route,
+                                    const int sign)
+{
+  for (const GSegment& seg : route) {
+    if (seg.isVia()) {
+      continue;
+    }
+    int x0 = (seg.init_x - grid_->getXMin()) / grid_->getTileSize();
+    int y0 = (seg.init_y - grid_->getYMin()) / grid_->getTileSize();
+    int x1 = (seg.final_x - grid_->getXMin()) / grid_->getTileSize();
+    int y1 = (seg.final_y - grid_->getYMin()) / grid_->getTileSize();
+
+    x0 = std::min(x0, grid_->getXGrids() - 1);
+    y0 = std::min(y0, grid_->getYGrids() - 1);
+    x1 = std::min(x1, grid_->getXGrids() - 1);
+    y1 = std::min(y1, grid_->getYGrids() - 1);
+
+    fastroute_->updateSegmentUsage(
+        db_net, x0, y0, x1, y1, seg.init_layer, sign);
+  }
+}
+
+void GlobalRouter::releaseRestoredRoute(odb::dbNet* db_net)
+{
+  if (restored_nets_.erase(db_net) != 0) {
+    updateRouteUsage(db_net, routes_[db_net], -1);
+  }
+}
+
 void GlobalRouter::updateDbCongestionFromGuides()
 {
   auto block = db_->getChip()->getBlock();
@@ -2215,11 +2377,14 @@ void GlobalRouter::saveGuidesFromFile(
   }
 }
 
+// The guides are packed in the guide store of the block, which drt reads
+// directly; they become dbGuides only when something asks the db for them.
 void GlobalRouter::saveGuides()
 {
-  int offset_x = grid_origin_.x();
-  int offset_y = grid_origin_.y();
+  odb::dbGuideStore* store = block_->getGuideStore();
+  store->setGrid(grid_->getGridArea(), grid_->getTileSize(), grid_origin_);
 
+  std::vector<odb::dbGuideStore::Guide> guides;
   for (odb::dbNet* db_net : block_->getNets()) {
     auto iter = routes_.find(db_net);
     if (iter == routes_.end()) {
@@ -2229,10 +2394,8 @@ void GlobalRouter::saveGuides()
     GRoute& route = iter->second;
 
     if (!route.empty()) {
-      db_net->clearGuides();
+      guides.clear();
       for (GSegment& segment : route) {
-        odb::Rect box = globalRoutingToBox(segment);
-        box.moveDelta(offset_x, offset_y);
         if (segment.isVia()) {
           if (abs(segment.final_layer - segment.init_layer) > 1) {
             logger_->error(GRT,
@@ -2246,15 +2409,15 @@ void GlobalRouter::saveGuides()
             int layer_idx2 = segment.final_layer;
             odb::dbTechLayer* layer1 = routing_layers_[layer_idx1];
             odb::dbTechLayer* layer2 = routing_layers_[layer_idx2];
-            odb::dbGuide::create(db_net, layer1, layer2, box);
-            odb::dbGuide::create(db_net, layer2, layer1, box);
+            guides.push_back(segmentToGuide(segment, layer1, layer2));
+            guides.push_back(segmentToGuide(segment, layer2, layer1));
           } else {
             int layer_idx = std::min(segment.init_layer, segment.final_layer);
             int via_layer_idx
                 = std::max(segment.init_layer, segment.final_layer);
             odb::dbTechLayer* layer = routing_layers_[layer_idx];
             odb::dbTechLayer* via_layer = routing_layers_[via_layer_idx];
-            odb::dbGuide::create(db_net, layer, via_layer, box);
+            guides.push_back(segmentToGuide(segment, layer, via_layer));
           }
         } else if (segment.init_layer == segment.final_layer) {
           if (segment.init_layer < min_routing_layer_
@@ -2267,16 +2430,33 @@ void GlobalRouter::saveGuides()
           }
 
           odb::dbTechLayer* layer = routing_layers_[segment.init_layer];
-          odb::dbGuide::create(db_net, layer, layer, box);
+          guides.push_back(segmentToGuide(segment, layer, layer));
         }
       }
+      store->setGuides(db_net, guides);
     }
-    auto dbGuides = db_net->getGuides();
-    if (dbGuides.orderReversed() && dbGuides.reversible())
-      dbGuides.reverse();
   }
 }
 
+odb::dbGuideStore::Guide GlobalRouter::segmentToGuide(
+    const GSegment& segment,
+    odb::dbTechLayer* layer,
+    odb::dbTechLayer* via_layer)
+{
+  // Gcell of the segment ends, which are gcell centers.
+  const int tile_size = grid_->getTileSize();
+  const auto [init_x, final_x] = std::minmax(segment.init_x, segment.final_x);
+  const auto [init_y, final_y] = std::minmax(segment.init_y, segment.final_y);
+  odb::dbGuideStore::Guide guide;
+  guide.x_lo = (init_x - grid_->getXMin()) / tile_size;
+  guide.y_lo = (init_y - grid_->getYMin()) / tile_size;
+  guide.x_hi = (final_x - grid_->getXMin()) / tile_size;
+  guide.y_hi = (final_y - grid_->getYMin()) / tile_size;
+  guide.layer = layer->getId();
+  guide.via_layer = via_layer->getId();
+  return guide;
+}
+
 void GlobalRouter::writeSegments(const char* file_name)
 {
   std::ofstream segs_file;
@@ -2285,33 +2465,36 @@ void GlobalRouter::writeSegments(const char* file_name)
     logger_->error(GRT, 255, "Global route segments file could not be opened.");
   }
 
-  odb::dbTech* tech = db_->getTech();
-
   for (const auto [db_net, net] : db_net_map_) {
     auto iter = routes_.find(db_net);
     if (iter == routes_.end()) {
       continue;
     }
-    const GRoute& route = iter->second;
-
-    if (!route.empty()) {
-      segs_file << net->getName() << "\n";
-      segs_file << "(\n";
-      for (const GSegment& segment : route) {
-        odb::dbTechLayer* init_layer
-            = tech->findRoutingLayer(segment.init_layer);
-        odb::dbTechLayer* final_layer
-            = tech->findRoutingLayer(segment.final_layer);
-        segs_file << segment.init_x << " " << segment.init_y << " "
-                  << init_layer->getName() << " " << segment.final_x << " "
-                  << segment.final_y << " " << final_layer->getName() << "\n";
-      }
-      segs_file << ")\n";
-    }
+    writeRouteSegments(segs_file, net->getName(), iter->second);
   }
   segs_file.close();
 }
 
+void GlobalRouter::writeRouteSegments(std::ostream& out,
+                                      const std::string& net_name,
+                                      const GRoute& route)
+{
+  if (route.empty()) {
+    return;
+  }
+  odb::dbTech* tech = db_->getTech();
+  out << net_name << "\n";
+  out << "(\n";
+  for (const GSegment& segment : route) {
+    odb::dbTechLayer* init_layer = tech->findRoutingLayer(segment.init_layer);
+    odb::dbTechLayer* final_layer = tech->findRoutingLayer(segment.final_layer);
+    out << segment.init_x << " " << segment.init_y << " "
+        << init_layer->getName() << " " << segment.final_x << " "
+        << segment.final_y << " " << final_layer->getName() << "\n";
+  }
+  out << ")\n";
+}
+
 void GlobalRouter::readSegments(const char* file_name)
 {
   if (db_->getChip() == nullptr || db_->getChip()->getBlock() == nullptr
@@ -2321,20 +2504,39 @@ void GlobalRouter::readSegments(const char* file_name)
 
   initGridAndNets();
 
-  odb::dbTech* tech = db_->getTech();
-
   std::ifstream fin(file_name);
-  std::string line;
-  odb::dbNet* db_net = nullptr;
-  std::unordered_map<odb::dbNet*, Guides> guides;
-
   if (!fin.is_open()) {
     logger_->error(
         GRT, 257, "Failed to open global route segments file {}.", file_name);
   }
+  parseSegments(fin, file_name, routes_);
 
-  while (fin.good()) {
-    getline(fin, line);
+  for (auto& [db_net, segments] : routes_) {
+    if (!isConnected(db_net)) {
+      logger_->error(
+          GRT, 262, "Net {} has disconnected segments.", db_net->getName());
+    }
+    std::string pins_not_covered;
+    if (!netIsCovered(db_net, pins_not_covered)) {
+      logger_->error(GRT,
+                     263,
+                     "Pin(s) {}not covered in net {}.",
+                     pins_not_covered,
+                     db_net->getName());
+    }
+  }
+}
+
+void GlobalRouter::parseSegments(std::istream& in,
+                                 const std::string& source,
+                                 NetRouteMap& routes)
+{
+  odb::dbTech* tech = db_->getTech();
+  std::string line;
+  odb::dbNet* db_net = nullptr;
+
+  while (in.good()) {
+    getline(in, line);
     if (line == "(" || line.empty() || line == ")") {
       continue;
     }
@@ -2367,28 +2569,265 @@ void GlobalRouter::readSegments(const char* file_name)
                        stoi(tokens[3]),
                        stoi(tokens[4]),
                        layer2->getRoutingLevel());
-      routes_[db_net].push_back(segment);
+      routes[db_net].push_back(segment);
     } else {
       logger_->error(
-          GRT, 261, "Error reading global route segments file {}.", file_name);
+          GRT, 261, "Error reading global route segments file {}.", source);
     }
   }
-  for (auto& [db_net, segments] : routes_) {
-    if (!isConnected(db_net)) {
-      logger_->error(
-          GRT, 262, "Net {} has disconnected segments.", db_net->getName());
+}
+
+void GlobalRouter::setDistributedIpPort(const std::string& ip,
+                                        unsigned short port)
+{
+  dist_ip_ = ip;
+  dist_port_ = port;
+}
+
+void GlobalRouter::setSharedVolume(const std::string& shared_volume)
+{
+  shared_volume_ = shared_volume;
+  if (!shared_volume_.empty() && shared_volume_.back() != '/') {
+    shared_volume_ += '/';
+  }
+}
+
+std::string GlobalRouter::writeRegionSettings()
+{
+  std::ostringstream out;
+  out << "settings " << adjustment_ << " " << min_routing_layer_ << " "
+      << max_routing_layer_ << " " << min_layer_for_clock_ << " "
+      << max_layer_for_clock_ << " " << macro_extension_ << " "
+      << overflow_iterations_ << " " << grid_origin_.x() << " "
+      << grid_origin_.y() << " " << seed_ << " "
+      << caps_perturbation_percentage_ << " " << perturbation_amount_ << "\n";
+  for (RegionAdjustment& region_adjustment : region_adjustments_) {
+    const odb::Rect& region = region_adjustment.getRegion();
+    out << "region_adjustment " << region.xMin() << " " << region.yMin()
+        << " " << region.xMax() << " " << region.yMax() << " "
+        << region_adjustment.getLayer() << " "
+        << region_adjustment.getAdjustment() << "\n";
+  }
+  return out.str();
+}
+
+void GlobalRouter::readRegionSettings(std::istream& in,
+                                      std::vector<odb::dbNet*>& nets)
+{
+  region_adjustments_.clear();
+  std::string line;
+  while (getline(in, line)) {
+    std::istringstream fields(line);
+    std::string key;
+    fields >> key;
+    if (key == "settings") {
+      int origin_x, origin_y;
+      fields >> adjustment_ >> min_routing_layer_ >> max_routing_layer_
+          >> min_layer_for_clock_ >> max_layer_for_clock_ >> macro_extension_
+          >> overflow_iterations_ >> origin_x >> origin_y >> seed_
+          >> caps_perturbation_percentage_ >> perturbation_amount_;
+      grid_origin_ = odb::Point(origin_x, origin_y);
+    } else if (key == "region_adjustment") {
+      int min_x, min_y, max_x, max_y, layer;
+      float adjustment;
+      fields >> min_x >> min_y >> max_x >> max_y >> layer >> adjustment;
+      addRegionAdjustment(min_x, min_y, max_x, max_y, layer, adjustment);
+    } else if (key == "net") {
+      std::string name;
+      fields >> name;
+      odb::dbNet* db_net = block_->findNet(name.c_str());
+      if (db_net == nullptr) {
+        logger_->error(GRT, 275, "Cannot find net {}.", name);
+      }
+      nets.push_back(db_net);
     }
-    std::string pins_not_covered;
-    if (!netIsCovered(db_net, pins_not_covered)) {
-      logger_->error(GRT,
-                     263,
-                     "Pin(s) {}not covered in net {}.",
-                     pins_not_covered,
-                     db_net->getName());
+  }
+}
+
+void GlobalRouter::rerouteCongestedRegions()
+{
+  std::set<odb::dbNet*> congestion_nets;
+  fastroute_->getCongestionNets(congestion_nets);
+  if (congestion_nets.empty() || dist_ == nullptr) {
+    return;
+  }
+
+  // A congested net is rerouted by the region holding the center of its
+  // pins, so the regions reroute disjoint sets of nets.
+  const int region_size = region_gcells * grid_->getTileSize();
+  std::map<std::pair<int, int>, std::vector<odb::dbNet*>> region_nets;
+  std::map<std::pair<int, int>, odb::Rect> region_boxes;
+  for (odb::dbNet* db_net : congestion_nets) {
+    odb::Rect net_box;
+    net_box.mergeInit();
+    for (const Pin& pin : db_net_map_[db_net]->getPins()) {
+      net_box.merge(odb::Rect(pin.getPosition(), pin.getPosition()));
+    }
+    const std::pair<int, int> region(net_box.xCenter() / region_size,
+                                     net_box.yCenter() / region_size);
+    region_nets[region].push_back(db_net);
+    auto [box, inserted] = region_boxes.emplace(region, net_box);
+    if (!inserted) {
+      box->second.merge(net_box);
+    }
+  }
+
+  // The workers rebuild the routing state from the design and the routes
+  // found so far, a new version makes them reload the design.
+  const std::string design_path = shared_volume_ + "grt_design.odb";
+  const std::string routes_path = shared_volume_ + "grt_routes.txt";
+  std::ofstream design_file(design_path, std::ios::binary);
+  if (!design_file) {
+    logger_->error(GRT, 270, "Cannot write the design to {}.", design_path);
+  }
+  db_->write(design_file);
+  design_file.close();
+  writeSegments(routes_path.c_str());
+  dist_design_version_++;
+
+  const std::string settings = writeRegionSettings();
+  std::vector<dst::JobMessage> jobs;
+  for (const auto& [region, nets] : region_nets) {
+    dst::JobMessage msg(dst::JobMessage::REGION);
+    auto desc = std::make_unique<dst::RegionJobDescription>();
+    const odb::Rect& box = region_boxes[region];
+    desc->setTool("grt");
+    desc->setRegion(box.xMin(), box.yMin(), box.xMax(), box.yMax());
+    desc->setDesign(design_path, dist_design_version_);
+    desc->setStatePath(routes_path);
+    std::string payload = settings;
+    for (odb::dbNet* db_net : nets) {
+      payload += "net " + db_net->getName() + "\n";
+    }
+    desc->setPayload(payload);
+    desc->setCost(nets.size());
+    msg.setJobDescription(std::move(desc));
+    jobs.push_back(std::move(msg));
+  }
+
+  if (verbose_) {
+    logger_->info(GRT,
+                  271,
+                  "Rerouting {} congested nets in {} regions on the workers.",
+                  congestion_nets.size(),
+                  jobs.size());
+  }
+  std::vector<dst::JobMessage> results;
+  if (!dist_->runRegionJobs(jobs, dist_ip_.c_str(), dist_port_, results)) {
+    logger_->warn(GRT, 272, "Some region reroute jobs failed.");
+  }
+
+  // Each region was rerouted against the same routing state, so a region
+  // only improves the overflow for sure on its own.  The regions that did
+  // are merged and all of them are undone if together they did not.
+  fastroute_->updateOverflow();
+  const int overflow = fastroute_->totalOverflow();
+  NetRouteMap old_routes;
+  int merged_regions = 0;
+  for (dst::JobMessage& result : results) {
+    if (result.getJobType() != dst::JobMessage::SUCCESS) {
+      continue;
+    }
+    auto desc
+        = static_cast<dst::RegionJobDescription*>(result.getJobDescription());
+    std::istringstream in(desc->getPayload());
+    int overflow_before, overflow_after;
+    in >> overflow_before >> overflow_after;
+    if (overflow_after >= overflow_before) {
+      continue;
     }
+    NetRouteMap routes;
+    parseSegments(in, "region reroute result", routes);
+    mergeRegionRoutes(routes, old_routes);
+    merged_regions++;
+  }
+  fastroute_->updateOverflow();
+  if (fastroute_->totalOverflow() >= overflow && !old_routes.empty()) {
+    NetRouteMap undone_routes;
+    mergeRegionRoutes(old_routes, undone_routes);
+    fastroute_->updateOverflow();
+    merged_regions = 0;
+  }
+  if (verbose_) {
+    logger_->info(GRT,
+                  273,
+                  "Merged {} rerouted regions, overflow {} -> {}.",
+                  merged_regions,
+                  overflow,
+                  fastroute_->totalOverflow());
   }
 }
 
+void GlobalRouter::mergeRegionRoutes(const NetRouteMap& routes,
+                                     NetRouteMap& old_routes)
+{
+  for (const auto& [db_net, route] : routes) {
+    old_routes.emplace(db_net, routes_[db_net]);
+    // The net either has the Steiner tree of the first routing or a route
+    // restored from a previous merge, release the one it has.
+    releaseRestoredRoute(db_net);
+    fastroute_->clearNetRoute(db_net);
+    routes_[db_net] = route;
+    updateRouteUsage(db_net, route, 1);
+    restored_nets_.insert(db_net);
+  }
+}
+
+std::string GlobalRouter::routeRegion(const dst::RegionJobDescription* desc,
+                                      int& overflow_before,
+                                      int& overflow_after)
+{
+  clear();
+  block_ = db_->getChip()->getBlock();
+  verbose_ = false;
+  std::istringstream settings(desc->getPayload());
+  std::vector<odb::dbNet*> db_nets;
+  readRegionSettings(settings, db_nets);
+
+  int min_layer, max_layer;
+  getMinMaxLayer(min_layer, max_layer);
+  initFastRoute(min_layer, max_layer);
+  fastroute_->clearNetsToRoute();
+  fastroute_->setVerbose(false);
+  fastroute_->setCriticalNetsPercentage(0);
+  fastroute_->setCongestionReportIterStep(0);
+
+  std::ifstream state(desc->getStatePath());
+  if (!state.is_open()) {
+    logger_->error(GRT,
+                   274,
+                   "Failed to open global route segments file {}.",
+                   desc->getStatePath());
+  }
+  parseSegments(state, desc->getStatePath(), routes_);
+  for (auto& [db_net, route] : routes_) {
+    updateRouteUsage(db_net, route, 1);
+    restored_nets_.insert(db_net);
+  }
+  fastroute_->updateOverflow();
+  overflow_before = fastroute_->totalOverflow();
+
+  std::vector<Net*> nets;
+  for (odb::dbNet* db_net : db_nets) {
+    auto iter = db_net_map_.find(db_net);
+    if (iter != db_net_map_.end()) {
+      nets.push_back(iter->second);
+    }
+  }
+  initFastRouteIncr(nets);
+  NetRouteMap new_routes
+      = findRouting(nets, min_routing_layer_, max_routing_layer_);
+  mergeResults(new_routes);
+  fastroute_->updateOverflow();
+  overflow_after = fastroute_->totalOverflow();
+
+  std::ostringstream out;
+  for (const auto& [db_net, route] : new_routes) {
+    writeRouteSegments(out, db_net->getName(), route);
+  }
+  return out.str();
+}
+
 bool GlobalRouter::netIsCovered(odb::dbNet* db_net,
                                 std::string& pins_not_covered)
 {
@@ -2898,7 +3337,7 @@ bool GlobalRouter::pinOverlapsWithSingleTrack(const Pin& pin,
   int conn_layer = pin.getConnectionLayer();
   std::vector<odb::Rect> pin_boxes = pin.getBoxes().at(conn_layer);
 
-  odb::dbTechLayer* layer = routing_layers_[conn_layer];
+  odb::dbTechLayer* layer = routing_layers_.at(conn_layer);
   RoutingTracks tracks = getRoutingTracksByIndex(conn_layer);
 
   odb::Rect pin_rect;
@@ -3248,15 +3687,18 @@ std::vector<Net*> GlobalRouter::findNets()
     db_nets = nets_to_route_;
   }
   std::vector<Net*> clk_nets;
+  std::vector<Net*> new_nets;
   for (odb::dbNet* db_net : db_nets) {
-    Net* net = addNet(db_net);
+    Net* net = createNet(db_net);
     // add clock nets not connected to a leaf first
     if (net) {
+      new_nets.push_back(net);
       bool is_non_leaf_clock = isNonLeafClock(net->getDbNet());
       if (is_non_leaf_clock)
         clk_nets.push_back(net);
     }
   }
+  findPins(new_nets);
 
   std::vector<Net*> non_clk_nets;
   for (auto [ignored, net] : db_net_map_) {
@@ -3278,6 +3720,15 @@ std::vector<Net*> GlobalRouter::findNets()
 }
 
 Net* GlobalRouter::addNet(odb::dbNet* db_net)
+{
+  Net* net = createNet(db_net);
+  if (net) {
+    findPins(net);
+  }
+  return net;
+}
+
+Net* GlobalRouter::createNet(odb::dbNet* db_net)
 {
   if (!db_net->getSigType().isSupply() && !db_net->isSpecial()
       && db_net->getSWires().empty() && !db_net->isConnectedByAbutment()) {
@@ -3285,7 +3736,6 @@ Net* GlobalRouter::addNet(odb::dbNet* db_net)
     db_net_map_[db_net] = net;
     makeItermPins(net, db_net, grid_->getGridArea());
     makeBtermPins(net, db_net, grid_->getGridArea());
-    findPins(net);
     return net;
   }
   return nullptr;
@@ -3295,8 +3745,11 @@ void GlobalRouter::removeNet(odb::dbNet* db_net)
 {
   Net* net = db_net_map_[db_net];
   if (net->isMergedNet()) {
+    // the routing now belongs to the surviving net
+    restored_nets_.erase(db_net);
     fastroute_->mergeNet(db_net);
   } else {
+    releaseRestoredRoute(db_net);
     fastroute_->removeNet(db_net);
   }
   delete net;
@@ -3522,12 +3975,14 @@ void GlobalRouter::computeObstructionsAdjustments()
   odb::Rect die_area = grid_->getGridArea();
   std::vector<int> layer_extensions;
   std::map<int, std::vector<odb::Rect>> layer_obs_map;
+  LayerObstructions obstructions(db_->getTech()->getRoutingLayerCount());
 
   findLayerExtensions(layer_extensions);
-  int obstructions_cnt = findObstructions(die_area);
-  obstructions_cnt
-      += findInstancesObstructions(die_area, layer_extensions, layer_obs_map);
-  findNetsObstructions(die_area);
+  int obstructions_cnt = findObstructions(die_area, obstructions);
+  obstructions_cnt += findInstancesObstructions(
+      die_area, layer_extensions, layer_obs_map, obstructions);
+  findNetsObstructions(die_area, obstructions);
+  applyObstructionAdjustments(obstructions);
 
   std::vector<LayerId> transition_layers = findTransitionLayers();
   adjustTransitionLayers(transition_layers, layer_obs_map);
@@ -3585,7 +4040,8 @@ void GlobalRouter::findLayerExtensions(std::vector<int>& layer_extensions)
   }
 }
 
-int GlobalRouter::findObstructions(odb::Rect& die_area)
+int GlobalRouter::findObstructions(odb::Rect& die_area,
+                                   LayerObstructions& obstructions)
 {
   int obstructions_cnt = 0;
   for (odb::dbObstruction* obstruction : block_->getObstructions()) {
@@ -3602,8 +4058,7 @@ int GlobalRouter::findObstructions(odb::Rect& die_area)
         if (verbose_)
           logger_->warn(GRT, 37, "Found blockage outside die area.");
       }
-      odb::dbTechLayer* tech_layer = obstruction_box->getTechLayer();
-      applyObstructionAdjustment(obstruction_rect, tech_layer);
+      obstructions[layer - 1].push_back(obstruction_rect);
       obstructions_cnt++;
     }
   }
@@ -3689,7 +4144,8 @@ void GlobalRouter::extendObstructions(
 int GlobalRouter::findInstancesObstructions(
     odb::Rect& die_area,
     const std::vector<int>& layer_extensions,
-    std::map<int, std::vector<odb::Rect>>& layer_obs_map)
+    std::map<int, std::vector<odb::Rect>>& layer_obs_map,
+    LayerObstructions& obstructions)
 {
   int macros_cnt = 0;
   int obstructions_cnt = 0;
@@ -3742,7 +4198,7 @@ int GlobalRouter::findInstancesObstructions(
             cur_obs.set_xhi(cur_obs.xMax() + layer_extension);
           }
           layer_obs_map[layer].push_back(cur_obs);
-          applyObstructionAdjustment(cur_obs, tech->findRoutingLayer(layer));
+          obstructions[layer - 1].push_back(cur_obs);
         }
       }
     } else {
@@ -3762,8 +4218,7 @@ int GlobalRouter::findInstancesObstructions(
                             "Found blockage outside die area in instance {}.",
                             inst->getConstName());
           }
-          odb::dbTechLayer* tech_layer = box->getTechLayer();
-          applyObstructionAdjustment(obstruction_rect, tech_layer);
+          obstructions[layer - 1].push_back(obstruction_rect);
           obstructions_cnt++;
         }
       }
@@ -3801,8 +4256,7 @@ int GlobalRouter::findInstancesObstructions(
                             inst->getConstName());
               pin_out_of_die_count++;
             }
-            odb::dbTechLayer* tech_layer = box->getTechLayer();
-            applyObstructionAdjustment(pin_box, tech_layer);
+            obstructions[pin_layer - 1].push_back(pin_box);
           }
         }
       }
@@ -3820,7 +4274,8 @@ int GlobalRouter::findInstancesObstructions(
   return obstructions_cnt;
 }
 
-void GlobalRouter::findNetsObstructions(odb::Rect& die_area)
+void GlobalRouter::findNetsObstructions(odb::Rect& die_area,
+                                        LayerObstructions& obstructions)
 {
   odb::dbSet<odb::dbNet> nets = block_->getNets();
 
@@ -3846,12 +4301,14 @@ void GlobalRouter::findNetsObstructions(odb::Rect& die_area)
                 continue;
               }
               odb::Rect via_rect = box.getBox();
-              applyNetObstruction(via_rect, tech_layer, die_area, db_net);
+              addNetObstruction(
+                  via_rect, tech_layer, die_area, db_net, obstructions);
             }
           } else {
             odb::Rect wire_rect = s->getBox();
             odb::dbTechLayer* tech_layer = s->getTechLayer();
-            applyNetObstruction(wire_rect, tech_layer, die_area, db_net);
+            addNetObstruction(
+                wire_rect, tech_layer, die_area, db_net, obstructions);
           }
         }
       }
@@ -3872,13 +4329,15 @@ void GlobalRouter::findNetsObstructions(odb::Rect& die_area)
                 continue;
               }
               odb::Rect via_rect = box.getBox();
-              applyNetObstruction(via_rect, tech_layer, die_area, db_net);
+              addNetObstruction(
+                  via_rect, tech_layer, die_area, db_net, obstructions);
             }
           } else {
             odb::Rect wire_rect = shape.getBox();
             odb::dbTechLayer* tech_layer = shape.getTechLayer();
 
-            applyNetObstruction(wire_rect, tech_layer, die_area, db_net);
+            addNetObstruction(
+                wire_rect, tech_layer, die_area, db_net, obstructions);
           }
         }
       }
@@ -3886,10 +4345,11 @@ void GlobalRouter::findNetsObstructions(odb::Rect& die_area)
   }
 }
 
-void GlobalRouter::applyNetObstruction(const odb::Rect& rect,
-                                       odb::dbTechLayer* tech_layer,
-                                       const odb::Rect& die_area,
-                                       odb::dbNet* db_net)
+void GlobalRouter::addNetObstruction(const odb::Rect& rect,
+                                     odb::dbTechLayer* tech_layer,
+                                     const odb::Rect& die_area,
+                                     odb::dbNet* db_net,
+                                     LayerObstructions& obstructions)
 {
   int l = tech_layer->getRoutingLevel();
 
@@ -3905,7 +4365,7 @@ void GlobalRouter::applyNetObstruction(const odb::Rect& rect,
                       db_net->getConstName());
       }
     }
-    applyObstructionAdjustment(obstruction_rect, tech_layer);
+    obstructions[l - 1].push_back(obstruction_rect);
   }
 }
 
@@ -4565,6 +5025,10 @@ bool operator==(const RoutePt& p1, const RoutePt& p2)
 IncrementalGRoute::IncrementalGRoute(GlobalRouter* groute, odb::dbBlock* block)
     : groute_(groute), db_cbk_(groute)
 {
+  // The routing grid was released after the last global_route.
+  if (!groute_->isInitialized()) {
+    groute_->loadRoutesFromGuides();
+  }
   db_cbk_.addOwner(block);
 }
 
@@ -4682,6 +5146,9 @@ std::vector<Net*> GlobalRouter::updateDirtyRoutes(bool save_guides)
 
 void GlobalRouter::initFastRouteIncr(std::vector<Net*>& nets)
 {
+  for (Net* net : nets) {
+    releaseRestoredRoute(net->getDbNet());
+  }
   initNetlist(nets);
   fastroute_->initAuxVar();
 }
@@ -142,12 +142,43 @@ set_grid_origin(int x, int y)
   getGlobalRouter()->setGridOrigin(x, y);
 }
 
+void
+set_distributed(const char* remote_ip,
+                unsigned short remote_port,
+                const char* shared_volume)
+{
+  auto* router = getGlobalRouter();
+  router->setDistributed(true);
+  router->setDistributedIpPort(remote_ip, remote_port);
+  router->setSharedVolume(shared_volume);
+}
+
+void
+unset_distributed()
+{
+  getGlobalRouter()->setDistributed(false);
+}
+
 void
 set_allow_congestion(bool allowCongestion)
 {
   getGlobalRouter()->setAllowCongestion(allowCongestion);
 }
 
+void
+set_parallel_maze(bool parallel)
+{
+  const int num_threads = parallel ? ord::OpenRoad::openRoad()->getThreadCount() : 1;
+  getGlobalRouter()->setParallelMaze(parallel, num_threads);
+}
+
+void
+set_parallel_layer_assignment(bool parallel)
+{
+  const int num_threads = parallel ? ord::OpenRoad::openRoad()->getThreadCount() : 1;
+  getGlobalRouter()->setLayerAssignmentThreads(num_threads);
+}
+
 void
 set_clock_layer_range(int minLayer, int maxLayer)
 {
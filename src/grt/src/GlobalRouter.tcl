@@ -197,18 +197,26 @@ sta::define_cmd_args "global_route" {[-guide_file out_file] \
                                   [-critical_nets_percentage percent] \
                                   [-allow_congestion] \
                                   [-allow_overflow] \
+                                  [-parallel_maze] \
+                                  [-parallel_layer_assignment] \
                                   [-overflow_iterations iterations] \
                                   [-verbose] \
                                   [-start_incremental] \
-                                  [-end_incremental]
+                                  [-end_incremental] \
+                                  [-distributed] \
+                                  [-remote_host rhost] \
+                                  [-remote_port rport] \
+                                  [-shared_volume vol]
 }
 
 proc global_route { args } {
   sta::parse_key_args "global_route" args \
     keys {-guide_file -congestion_iterations -congestion_report_file \
-          -overflow_iterations -grid_origin -critical_nets_percentage -congestion_report_iter_step
+          -overflow_iterations -grid_origin -critical_nets_percentage -congestion_report_iter_step \
+          -remote_host -remote_port -shared_volume
          } \
-    flags {-allow_congestion -allow_overflow -verbose -start_incremental -end_incremental}
+    flags {-allow_congestion -allow_overflow -verbose -start_incremental -end_incremental \
+           -parallel_maze -parallel_layer_assignment -distributed}
 
   sta::check_argc_eq0 "global_route" $args
 
@@ -275,6 +283,31 @@ proc global_route { args } {
     || [info exists flags(-allow_overflow)]]
   grt::set_allow_congestion $allow_congestion
 
+  grt::set_parallel_maze [info exists flags(-parallel_maze)]
+  grt::set_parallel_layer_assignment \
+    [info exists flags(-parallel_layer_assignment)]
+
+  if { [info exists flags(-distributed)] } {
+    if { [info exists keys(-remote_host)] } {
+      set rhost $keys(-remote_host)
+    } else {
+      utl::error GRT 276 "-remote_host is required for distributed routing."
+    }
+    if { [info exists keys(-remote_port)] } {
+      set rport $keys(-remote_port)
+    } else {
+      utl::error GRT 277 "-remote_port is required for distributed routing."
+    }
+    if { [info exists keys(-shared_volume)] } {
+      set vol $keys(-shared_volume)
+    } else {
+      utl::error GRT 278 "-shared_volume is required for distributed routing."
+    }
+    grt::set_distributed $rhost $rport $vol
+  } else {
+    grt::unset_distributed
+  }
+
   set start_incremental [info exists flags(-start_incremental)]
   set end_incremental [info exists flags(-end_incremental)]
 
@@ -66,7 +66,7 @@ void Grid::clear()
   vertical_edges_capacities_.clear();
 }
 
-odb::Point Grid::getPositionOnGrid(const odb::Point& position)
+odb::Point Grid::getPositionOnGrid(const odb::Point& position) const
 {
   int x = position.x();
   int y = position.y();
@@ -93,7 +93,7 @@ void Grid::getBlockedTiles(const odb::Rect& obstruction,
                            odb::Rect& first_tile_bds,
                            odb::Rect& last_tile_bds,
                            odb::Point& first_tile,
-                           odb::Point& last_tile)
+                           odb::Point& last_tile) const
 {
   odb::Point lower = obstruction.ll();  // lower bound of obstruction
   odb::Point upper = obstruction.ur();  // upper bound of obstruction
@@ -139,7 +139,7 @@ interval<int>::type Grid::computeTileReduceInterval(
     const odb::Rect& tile,
     int track_space,
     bool first,
-    odb::dbTechLayerDir direction)
+    odb::dbTechLayerDir direction) const
 {
   int start_point, end_point;
   if (direction == odb::dbTechLayerDir::VERTICAL) {
@@ -116,13 +116,13 @@ class Grid
     vertical_edges_capacities_[layer] = capacity;
   }
 
-  odb::Point getPositionOnGrid(const odb::Point& position);
+  odb::Point getPositionOnGrid(const odb::Point& position) const;
 
   void getBlockedTiles(const odb::Rect& obstruction,
                        odb::Rect& first_tile_bds,
                        odb::Rect& last_tile_bds,
                        odb::Point& first_tile,
-                       odb::Point& last_tile);
+                       odb::Point& last_tile) const;
 
   int computeTileReduce(const odb::Rect& obs,
                         const odb::Rect& tile,
@@ -134,7 +134,8 @@ class Grid
                                                 const odb::Rect& tile,
                                                 int track_space,
                                                 bool first,
-                                                odb::dbTechLayerDir direction);
+                                                odb::dbTechLayerDir direction)
+      const;
 
   odb::Point getMiddle();
   const odb::Rect& getGridArea() const;
@@ -36,6 +36,8 @@
 #include "grt/MakeGlobalRouter.h"
 
 #include "FastRoute.h"
+#include "RegionRouteCallBack.h"
+#include "dst/Distributed.h"
 #include "grt/GlobalRouter.h"
 #include "heatMap.h"
 #include "heatMapRudy.h"
@@ -77,11 +79,14 @@ void initGlobalRouter(OpenRoad* openroad)
       openroad->getResizer(),
       openroad->getAntennaChecker(),
       openroad->getOpendp(),
+      openroad->getDistributed(),
       std::make_unique<grt::RoutingCongestionDataSource>(openroad->getLogger(),
                                                          openroad->getDb()),
       std::make_unique<grt::RUDYDataSource>(openroad->getLogger(),
                                             openroad->getGlobalRouter(),
                                             openroad->getDb()));
+  openroad->getDistributed()->addCallBack(new grt::RegionRouteCallBack(
+      openroad->getGlobalRouter(), openroad->getDistributed()));
 }
 
 }  // namespace ord
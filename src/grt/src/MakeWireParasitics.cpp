@@ -35,6 +35,8 @@
 
 #include "MakeWireParasitics.h"
 
+#include <omp.h>
+
 #include "db_sta/dbNetwork.hh"
 #include "db_sta/dbSta.hh"
 #include "rsz/Resizer.hh"
@@ -47,6 +49,7 @@
 #include "sta/StaState.hh"
 #include "sta/Units.hh"
 #include "utl/Logger.h"
+#include "utl/exception.h"
 
 namespace grt {
 
@@ -79,6 +82,26 @@ void MakeWireParasitics::estimateParasitcs(odb::dbNet* net,
                                            std::vector<Pin>& pins,
                                            GRoute& route,
                                            rsz::SpefWriter* spef_writer)
+{
+  makeNetParasitics(net, pins, route, -1, spef_writer);
+}
+
+void MakeWireParasitics::estimateParasitcs(odb::dbNet* net, GRoute& route)
+{
+  // The route of an incremental update reaches the pins on the lowest
+  // layer of the net.
+  int net_min_layer;
+  int net_max_layer;
+  grouter_->getNetLayerRange(net, net_min_layer, net_max_layer);
+  makeNetParasitics(
+      net, grouter_->getNet(net)->getPins(), route, net_min_layer, nullptr);
+}
+
+void MakeWireParasitics::makeNetParasitics(odb::dbNet* net,
+                                           std::vector<Pin>& pins,
+                                           GRoute& route,
+                                           const int pin_layer,
+                                           rsz::SpefWriter* spef_writer)
 {
   debugPrint(logger_, GRT, "est_rc", 1, "net {}", net->getConstName());
   if (logger_->debugCheck(GRT, "est_rc", 2)) {
@@ -96,122 +119,118 @@ void MakeWireParasitics::estimateParasitcs(odb::dbNet* net,
   }
 
   sta::Net* sta_net = network_->dbToSta(net);
-
+  bool first_corner = true;
   for (sta::Corner* corner : *sta_->corners()) {
-    NodeRoutePtMap node_map;
-
-    sta::ParasiticAnalysisPt* analysis_point
-        = corner->findParasiticAnalysisPt(min_max_);
-    sta::Parasitic* parasitic
-        = parasitics_->makeParasiticNetwork(sta_net, false, analysis_point);
-    makeRouteParasitics(
-        net, route, sta_net, corner, analysis_point, parasitic, node_map);
-    makeParasiticsToPins(pins, node_map, corner, analysis_point, parasitic);
-
-    if (spef_writer) {
-      spef_writer->writeNet(corner, sta_net, parasitic);
+    RcNetwork network;
+    makeRcNetwork(net, pins, route, corner, pin_layer, network);
+    // The corners only differ in their RC values.
+    if (first_corner) {
+      reportRcNetworkWarnings(net, network, pin_layer >= 0);
+      first_corner = false;
     }
-
-    arc_delay_calc_->reduceParasitic(
-        parasitic, sta_net, corner, sta::MinMaxAll::all());
+    makeParasiticNetwork(sta_net, corner, network, spef_writer);
   }
   parasitics_->deleteParasiticNetworks(sta_net);
 }
 
-void MakeWireParasitics::estimateParasitcs(odb::dbNet* net, GRoute& route)
+void MakeWireParasitics::estimateParasitcs(NetRouteMap& routes,
+                                           const int num_threads,
+                                           rsz::SpefWriter* spef_writer)
 {
-  debugPrint(logger_, GRT, "est_rc", 1, "net {}", net->getConstName());
-  if (logger_->debugCheck(GRT, "est_rc", 2)) {
-    for (GSegment& segment : route) {
-      logger_->report(
-          "({:.2f}, {:.2f}) {:2d} -> ({:.2f}, {:.2f}) {:2d} l={:.2f}",
-          block_->dbuToMicrons(segment.init_x),
-          block_->dbuToMicrons(segment.init_y),
-          segment.init_layer,
-          block_->dbuToMicrons(segment.final_x),
-          block_->dbuToMicrons(segment.final_y),
-          segment.final_layer,
-          block_->dbuToMicrons(segment.length()));
+  std::vector<std::pair<odb::dbNet*, GRoute*>> nets;
+  std::vector<std::vector<Pin>*> net_pins;
+  for (auto& [db_net, route] : routes) {
+    if (!route.empty()) {
+      nets.emplace_back(db_net, &route);
+      net_pins.push_back(&grouter_->getNet(db_net)->getPins());
     }
   }
 
-  sta::Net* sta_net = network_->dbToSta(net);
-  grt::Net* grt_net = grouter_->getNet(net);
-
+  std::vector<sta::Corner*> corners;
   for (sta::Corner* corner : *sta_->corners()) {
-    NodeRoutePtMap node_map;
-
-    sta::ParasiticAnalysisPt* analysis_point
-        = corner->findParasiticAnalysisPt(min_max_);
-    sta::Parasitic* parasitic
-        = parasitics_->makeParasiticNetwork(sta_net, false, analysis_point);
-    makeRouteParasitics(
-        net, route, sta_net, corner, analysis_point, parasitic, node_map);
-    makePartialParasiticsToPins(
-        grt_net->getPins(), node_map, corner, analysis_point, parasitic, net);
-    arc_delay_calc_->reduceParasitic(
-        parasitic, sta_net, corner, sta::MinMaxAll::all());
+    corners.push_back(corner);
+  }
+  const int batch_size = 10000;
+  std::vector<RcNetwork> networks;
+  for (int begin = 0; begin < nets.size(); begin += batch_size) {
+    const int end = std::min(begin + batch_size, (int) nets.size());
+    networks.assign((end - begin) * corners.size(), RcNetwork());
+
+    utl::ThreadException exception;
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+    for (int i = begin; i < end; i++) {  // NOLINT
+      try {
+        auto& [db_net, route] = nets[i];
+        for (int c = 0; c < corners.size(); c++) {
+          makeRcNetwork(db_net,
+                        *net_pins[i],
+                        *route,
+                        corners[c],
+                        -1,
+                        networks[(i - begin) * corners.size() + c]);
+        }
+      } catch (...) {
+        exception.capture();
+      }
+    }
+    exception.rethrow();
+
+    // Warnings are issued here in net order, once per net.
+    for (int i = begin; i < end; i++) {
+      odb::dbNet* db_net = nets[i].first;
+      debugPrint(logger_, GRT, "est_rc", 1, "net {}", db_net->getConstName());
+      reportRcNetworkWarnings(
+          db_net, networks[(i - begin) * corners.size()], false);
+      sta::Net* sta_net = network_->dbToSta(db_net);
+      for (int c = 0; c < corners.size(); c++) {
+        makeParasiticNetwork(sta_net,
+                             corners[c],
+                             networks[(i - begin) * corners.size() + c],
+                             spef_writer);
+      }
+      parasitics_->deleteParasiticNetworks(sta_net);
+    }
   }
-
-  parasitics_->deleteParasiticNetworks(sta_net);
-}
-
-void MakeWireParasitics::clearParasitics()
-{
-  // Remove any existing parasitics.
-  sta_->deleteParasitics();
-
-  // Make separate parasitics for each corner.
-  sta_->setParasiticAnalysisPts(true);
-}
-
-sta::Pin* MakeWireParasitics::staPin(Pin& pin) const
-{
-  if (pin.isPort())
-    return network_->dbToSta(pin.getBTerm());
-  else
-    return network_->dbToSta(pin.getITerm());
 }
 
-void MakeWireParasitics::makeRouteParasitics(
-    odb::dbNet* net,
-    GRoute& route,
-    sta::Net* sta_net,
-    sta::Corner* corner,
-    sta::ParasiticAnalysisPt* analysis_point,
-    sta::Parasitic* parasitic,
-    NodeRoutePtMap& node_map)
+// Resistors for the route segments of the net, followed by a wire from
+// each pin to the grid location of the pin.
+void MakeWireParasitics::makeRcNetwork(odb::dbNet* net,
+                                       std::vector<Pin>& pins,
+                                       GRoute& route,
+                                       sta::Corner* corner,
+                                       const int pin_layer,
+                                       RcNetwork& network) const
 {
   const int min_routing_layer = grouter_->getMinRoutingLayer();
 
-  size_t resistor_id_ = 1;
+  std::map<RoutePt, int> node_map;
+  auto ensure_node = [&](const int x, const int y, const int layer) {
+    auto [it, inserted] = node_map.emplace(RoutePt(x, y, layer), 0);
+    if (inserted) {
+      it->second = network.nodes.size();
+      network.nodes.push_back({(int) node_map.size(), nullptr});
+    }
+    return it->second;
+  };
+
   for (GSegment& segment : route) {
     const int wire_length_dbu = segment.length();
 
     const int init_layer = segment.init_layer;
-    sta::ParasiticNode* n1 = (init_layer >= min_routing_layer)
-                                 ? ensureParasiticNode(segment.init_x,
-                                                       segment.init_y,
-                                                       init_layer,
-                                                       node_map,
-                                                       parasitic,
-                                                       sta_net)
-                                 : nullptr;
+    const int n1 = (init_layer >= min_routing_layer)
+                       ? ensure_node(segment.init_x, segment.init_y, init_layer)
+                       : -1;
 
     const int final_layer = segment.final_layer;
-    sta::ParasiticNode* n2 = (final_layer >= min_routing_layer)
-                                 ? ensureParasiticNode(segment.final_x,
-                                                       segment.final_y,
-                                                       final_layer,
-                                                       node_map,
-                                                       parasitic,
-                                                       sta_net)
-                                 : nullptr;
-    if (!n1 || !n2) {
+    const int n2
+        = (final_layer >= min_routing_layer)
+              ? ensure_node(segment.final_x, segment.final_y, final_layer)
+              : -1;
+    if (n1 < 0 || n2 < 0) {
       continue;
     }
 
-    sta::Units* units = sta_->units();
     float res = 0.0;
     float cap = 0.0;
     if (wire_length_dbu == 0) {
@@ -220,228 +239,137 @@ void MakeWireParasitics::makeRouteParasitics(
       odb::dbTechLayer* cut_layer
           = tech_->findRoutingLayer(lower_layer)->getUpperLayer();
       res = getCutLayerRes(cut_layer, corner);
-      debugPrint(logger_,
-                 GRT,
-                 "est_rc",
-                 1,
-                 "{} -> {} via {}-{} r={}",
-                 parasitics_->name(n1),
-                 parasitics_->name(n2),
-                 segment.init_layer,
-                 segment.final_layer,
-                 units->resistanceUnit()->asString(res));
     } else if (segment.init_layer == segment.final_layer) {
       layerRC(wire_length_dbu, segment.init_layer, corner, res, cap);
-      debugPrint(logger_,
-                 GRT,
-                 "est_rc",
-                 1,
-                 "{} -> {} {:.2f}u layer={} r={} c={}",
-                 parasitics_->name(n1),
-                 parasitics_->name(n2),
-                 dbuToMeters(wire_length_dbu) * 1e+6,
-                 segment.init_layer,
-                 units->resistanceUnit()->asString(res),
-                 units->capacitanceUnit()->asString(cap));
-    } else
-      logger_->warn(GRT,
-                    25,
-                    "Non wire or via route found on net {}.",
-                    net->getConstName());
-    parasitics_->incrCap(n1, cap / 2.0);
-    parasitics_->makeResistor(parasitic, resistor_id_++, res, n1, n2);
-    parasitics_->incrCap(n2, cap / 2.0);
+    } else {
+      network.non_wire_route = true;
+    }
+    network.resistors.push_back({n1, n2, res, cap, false});
   }
-}
 
-void MakeWireParasitics::makeParasiticsToPins(
-    std::vector<Pin>& pins,
-    NodeRoutePtMap& node_map,
-    sta::Corner* corner,
-    sta::ParasiticAnalysisPt* analysis_point,
-    sta::Parasitic* parasitic)
-{
   for (Pin& pin : pins) {
-    makeParasiticsToPin(pin, node_map, corner, analysis_point, parasitic);
+    const int pin_node = network.nodes.size();
+    network.nodes.push_back({-1, staPin(pin)});
+
+    odb::Point pt = pin.getPosition();
+    odb::Point grid_pt = pin.getOnGridPosition();
+
+    // Use the route layer above the pin layer if there is a via
+    // to the pin.
+    int layer = (pin_layer >= 0 ? pin_layer : pin.getConnectionLayer()) + 1;
+    auto grid_node
+        = node_map.find(RoutePt(grid_pt.getX(), grid_pt.getY(), layer));
+    float via_res = 0;
+
+    // Use the pin layer for the connection.
+    if (grid_node == node_map.end()) {
+      layer--;
+      grid_node = node_map.find(RoutePt(grid_pt.getX(), grid_pt.getY(), layer));
+    } else {
+      odb::dbTechLayer* cut_layer
+          = tech_->findRoutingLayer(layer)->getLowerLayer();
+      via_res = getCutLayerRes(cut_layer, corner);
+    }
+
+    if (grid_node != node_map.end()) {
+      // Make wire from pin to gcell center on pin layer.
+      int wire_length_dbu
+          = abs(pt.getX() - grid_pt.getX()) + abs(pt.getY() - grid_pt.getY());
+      float res, cap;
+      layerRC(wire_length_dbu, layer, corner, res, cap);
+      // We could added the via resistor before the segment pi-model
+      // but that would require an extra node and the accuracy of all
+      // this is not that high.  Instead we just lump them together.
+      network.resistors.push_back(
+          {pin_node, grid_node->second, res + via_res, cap, true});
+    } else {
+      network.unrouted_pins.push_back(&pin);
+    }
   }
 }
 
-// Make parasitics for the wire from the pin to the grid location of the pin.
-void MakeWireParasitics::makeParasiticsToPin(
-    Pin& pin,
-    NodeRoutePtMap& node_map,
-    sta::Corner* corner,
-    sta::ParasiticAnalysisPt* analysis_point,
-    sta::Parasitic* parasitic)
+void MakeWireParasitics::reportRcNetworkWarnings(odb::dbNet* net,
+                                                 const RcNetwork& network,
+                                                 const bool partial) const
 {
-  sta::Pin* sta_pin = staPin(pin);
-  sta::ParasiticNode* pin_node
-      = parasitics_->ensureParasiticNode(parasitic, sta_pin, network_);
-
-  odb::Point pt = pin.getPosition();
-  odb::Point grid_pt = pin.getOnGridPosition();
-
-  // Use the route layer above the pin layer if there is a via
-  // to the pin.
-  int layer = pin.getConnectionLayer() + 1;
-  RoutePt grid_route(grid_pt.getX(), grid_pt.getY(), layer);
-  sta::ParasiticNode* grid_node = node_map[grid_route];
-  float via_res = 0;
-
-  // Use the pin layer for the connection.
-  if (grid_node == nullptr) {
-    layer--;
-    grid_route = RoutePt(grid_pt.getX(), grid_pt.getY(), layer);
-    grid_node = node_map[grid_route];
-  } else {
-    odb::dbTechLayer* cut_layer
-        = tech_->findRoutingLayer(layer)->getLowerLayer();
-    via_res = getCutLayerRes(cut_layer, corner);
+  if (network.non_wire_route) {
+    logger_->warn(GRT,
+                  25,
+                  "Non wire or via route found on net {}.",
+                  net->getConstName());
   }
+  for (const Pin* pin : network.unrouted_pins) {
+    logger_->warn(
+        GRT, partial ? 350 : 26, "Missing route to pin {}.", pin->getName());
+  }
+}
 
-  if (grid_node) {
-    // Make wire from pin to gcell center on pin layer.
-    int wire_length_dbu
-        = abs(pt.getX() - grid_pt.getX()) + abs(pt.getY() - grid_pt.getY());
-    float res, cap;
-    layerRC(wire_length_dbu, layer, corner, res, cap);
-    sta::Units* units = sta_->units();
-    debugPrint(
-        logger_,
-        GRT,
-        "est_rc",
-        1,
-        "{} -> {} ({:.2f}, {:.2f}) {:.2f}u layer={} r={} via_res={} c={}",
-        parasitics_->name(grid_node),
-        parasitics_->name(pin_node),
-        block_->dbuToMicrons(pt.getX()),
-        block_->dbuToMicrons(pt.getY()),
-        block_->dbuToMicrons(wire_length_dbu),
-        layer,
-        units->resistanceUnit()->asString(res),
-        units->resistanceUnit()->asString(via_res),
-        units->capacitanceUnit()->asString(cap));
+void MakeWireParasitics::makeParasiticNetwork(sta::Net* sta_net,
+                                              sta::Corner* corner,
+                                              const RcNetwork& network,
+                                              rsz::SpefWriter* spef_writer)
+{
+  sta::ParasiticAnalysisPt* analysis_point
+      = corner->findParasiticAnalysisPt(min_max_);
+  sta::Parasitic* parasitic
+      = parasitics_->makeParasiticNetwork(sta_net, false, analysis_point);
+
+  std::vector<sta::ParasiticNode*> nodes;
+  nodes.reserve(network.nodes.size());
+  for (const RcNode& node : network.nodes) {
+    if (node.id < 0) {
+      nodes.push_back(
+          parasitics_->ensureParasiticNode(parasitic, node.pin, network_));
+    } else {
+      nodes.push_back(parasitics_->ensureParasiticNode(
+          parasitic, sta_net, node.id, network_));
+    }
+  }
 
+  // route resistors are numbered per net, pin resistors across nets
+  size_t route_resistor_id = 1;
+  sta::Units* units = sta_->units();
+  for (const RcResistor& resistor : network.resistors) {
+    sta::ParasiticNode* n1 = nodes[resistor.node1];
+    sta::ParasiticNode* n2 = nodes[resistor.node2];
+    const size_t id = resistor.to_pin ? resistor_id_++ : route_resistor_id++;
     debugPrint(logger_,
                GRT,
                "est_rc",
                1,
-               "pin {} -> to grid {}u layer={} r={} via_res={} c={}",
-               pin.getName(),
-               static_cast<int>(dbuToMeters(wire_length_dbu) * 1e+6),
-               layer,
-               units->resistanceUnit()->asString(res),
-               units->resistanceUnit()->asString(via_res),
-               units->capacitanceUnit()->asString(cap));
-
-    // We could added the via resistor before the segment pi-model
-    // but that would require an extra node and the accuracy of all
-    // this is not that high.  Instead we just lump them together.
-    parasitics_->incrCap(pin_node, cap / 2.0);
-    parasitics_->makeResistor(
-        parasitic, resistor_id_++, res + via_res, pin_node, grid_node);
-    parasitics_->incrCap(grid_node, cap / 2.0);
-  } else {
-    logger_->warn(GRT, 26, "Missing route to pin {}.", pin.getName());
+               "{} -> {} r={} c={}",
+               parasitics_->name(n1),
+               parasitics_->name(n2),
+               units->resistanceUnit()->asString(resistor.res),
+               units->capacitanceUnit()->asString(resistor.cap));
+    parasitics_->incrCap(n1, resistor.cap / 2.0);
+    parasitics_->makeResistor(parasitic, id, resistor.res, n1, n2);
+    parasitics_->incrCap(n2, resistor.cap / 2.0);
   }
-}
 
-void MakeWireParasitics::makePartialParasiticsToPins(
-    std::vector<Pin>& pins,
-    NodeRoutePtMap& node_map,
-    sta::Corner* corner,
-    sta::ParasiticAnalysisPt* analysis_point,
-    sta::Parasitic* parasitic,
-    odb::dbNet* net)
-{
-  for (Pin& pin : pins) {
-    makePartialParasiticsToPin(
-        pin, node_map, corner, analysis_point, parasitic, net);
+  if (spef_writer) {
+    spef_writer->writeNet(corner, sta_net, parasitic);
   }
+
+  arc_delay_calc_->reduceParasitic(
+      parasitic, sta_net, corner, sta::MinMaxAll::all());
 }
 
-// Make parasitics for the wire from the pin to the grid location of the pin.
-void MakeWireParasitics::makePartialParasiticsToPin(
-    Pin& pin,
-    NodeRoutePtMap& node_map,
-    sta::Corner* corner,
-    sta::ParasiticAnalysisPt* analysis_point,
-    sta::Parasitic* parasitic,
-    odb::dbNet* net)
+void MakeWireParasitics::clearParasitics()
 {
-  sta::Pin* sta_pin = staPin(pin);
-  sta::ParasiticNode* pin_node
-      = parasitics_->ensureParasiticNode(parasitic, sta_pin, network_);
-
-  odb::Point pt = pin.getPosition();
-  odb::Point grid_pt = pin.getOnGridPosition();
-
-  // Use the route layer above the pin layer if there is a via
-  // to the pin.
-  int net_max_layer;
-  int net_min_layer;
-  grouter_->getNetLayerRange(net, net_min_layer, net_max_layer);
-  int layer = net_min_layer + 1;
-  RoutePt grid_route(grid_pt.getX(), grid_pt.getY(), layer);
-  sta::ParasiticNode* grid_node = node_map[grid_route];
-  float via_res = 0;
-
-  // Use the pin layer for the connection.
-  if (grid_node == nullptr) {
-    layer--;
-    grid_route = RoutePt(grid_pt.getX(), grid_pt.getY(), layer);
-    grid_node = node_map[grid_route];
-  } else {
-    odb::dbTechLayer* cut_layer
-        = tech_->findRoutingLayer(layer)->getLowerLayer();
-    via_res = getCutLayerRes(cut_layer, corner);
-  }
+  // Remove any existing parasitics.
+  sta_->deleteParasitics();
 
-  if (grid_node) {
-    // Make wire from pin to gcell center on pin layer.
-    int wire_length_dbu
-        = abs(pt.getX() - grid_pt.getX()) + abs(pt.getY() - grid_pt.getY());
-    float res, cap;
-    layerRC(wire_length_dbu, layer, corner, res, cap);
-    sta::Units* units = sta_->units();
-    debugPrint(
-        logger_,
-        GRT,
-        "est_rc",
-        1,
-        "{} -> {} ({:.2f}, {:.2f}) {:.2f}u layer={} r={} via_res={} c={}",
-        parasitics_->name(grid_node),
-        parasitics_->name(pin_node),
-        block_->dbuToMicrons(pt.getX()),
-        block_->dbuToMicrons(pt.getY()),
-        block_->dbuToMicrons(wire_length_dbu),
-        layer,
-        units->resistanceUnit()->asString(res),
-        units->resistanceUnit()->asString(via_res),
-        units->capacitanceUnit()->asString(cap));
+  // Make separate parasitics for each corner.
+  sta_->setParasiticAnalysisPts(true);
+}
 
-    debugPrint(logger_,
-               GRT,
-               "est_rc",
-               1,
-               "pin {} -> to grid {}u layer={} r={} via_res={} c={}",
-               pin.getName(),
-               static_cast<int>(dbuToMeters(wire_length_dbu) * 1e+6),
-               layer,
-               units->resistanceUnit()->asString(res),
-               units->resistanceUnit()->asString(via_res),
-               units->capacitanceUnit()->asString(cap));
-
-    // We could added the via resistor before the segment pi-model
-    // but that would require an extra node and the accuracy of all
-    // this is not that high.  Instead we just lump them together.
-    parasitics_->incrCap(pin_node, cap / 2.0);
-    parasitics_->makeResistor(
-        parasitic, resistor_id_++, res + via_res, pin_node, grid_node);
-    parasitics_->incrCap(grid_node, cap / 2.0);
-  } else {
-    logger_->warn(GRT, 350, "Missing route to pin {}.", pin.getName());
-  }
+sta::Pin* MakeWireParasitics::staPin(Pin& pin) const
+{
+  if (pin.isPort())
+    return network_->dbToSta(pin.getBTerm());
+  else
+    return network_->dbToSta(pin.getITerm());
 }
 
 void MakeWireParasitics::layerRC(int wire_length_dbu,
@@ -478,24 +406,6 @@ double MakeWireParasitics::dbuToMeters(int dbu) const
   return (double) dbu / (tech_->getDbUnitsPerMicron() * 1E+6);
 }
 
-sta::ParasiticNode* MakeWireParasitics::ensureParasiticNode(
-    int x,
-    int y,
-    int layer,
-    NodeRoutePtMap& node_map,
-    sta::Parasitic* parasitic,
-    sta::Net* net) const
-{
-  RoutePt pin_loc(x, y, layer);
-  sta::ParasiticNode* node = node_map[pin_loc];
-  if (node == nullptr) {
-    node = parasitics_->ensureParasiticNode(
-        parasitic, net, node_map.size(), network_);
-    node_map[pin_loc] = node;
-  }
-  return node;
-}
-
 float MakeWireParasitics::getNetSlack(odb::dbNet* net)
 {
   sta::dbNetwork* network = sta_->getDbNetwork();
@@ -525,7 +435,7 @@ std::vector<int> MakeWireParasitics::routeLayerLengths(odb::dbNet* db_net) const
         route_pts.insert(RoutePt(segment.final_x, segment.final_y, layer));
       }
     }
-    // Mimic MakeWireParasitics::makeParasiticsToPin functionality.
+    // Mimic MakeWireParasitics::makeRcNetwork functionality.
     Net* net = grouter_->getNet(db_net);
     for (Pin& pin : net->getPins()) {
       int layer = pin.getConnectionLayer() + 1;
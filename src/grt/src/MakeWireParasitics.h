@@ -84,6 +84,12 @@ class MakeWireParasitics : public AbstractMakeWireParasitics
                          GRoute& route,
                          rsz::SpefWriter* spef_writer = nullptr);
   void estimateParasitcs(odb::dbNet* net, GRoute& route) override;
+  // Estimates the parasitics of every net with a route.  The RC networks are
+  // computed for batches of nets on num_threads threads and then made in the
+  // sta parasitics one net at a time.
+  void estimateParasitcs(NetRouteMap& routes,
+                         int num_threads,
+                         rsz::SpefWriter* spef_writer = nullptr);
 
   void clearParasitics() override;
   // Return GRT layer lengths in dbu's for db_net's route indexed by routing
@@ -93,44 +99,54 @@ class MakeWireParasitics : public AbstractMakeWireParasitics
   float getNetSlack(odb::dbNet* net) override;
 
  private:
-  typedef std::map<RoutePt, sta::ParasiticNode*> NodeRoutePtMap;
+  // Parasitic node of an RcNetwork, either a grid point or a pin.
+  struct RcNode
+  {
+    int id;  // grid node id, -1 for pins
+    sta::Pin* pin;
+  };
+  struct RcResistor
+  {
+    int node1;  // index in RcNetwork::nodes
+    int node2;
+    float res;
+    float cap;  // split between the two nodes
+    bool to_pin;
+  };
+  // Parasitic network of a net for one corner that is built without the sta
+  // parasitics, so that nets can be estimated on several threads.  Nodes and
+  // resistors are in the order estimateParasitcs makes them.
+  struct RcNetwork
+  {
+    std::vector<RcNode> nodes;
+    std::vector<RcResistor> resistors;
+    // Problems found while building, reported by reportRcNetworkWarnings
+    // outside of the threads.
+    bool non_wire_route = false;
+    std::vector<const Pin*> unrouted_pins;
+  };
 
-  sta::Pin* staPin(Pin& pin) const;
-  void makeRouteParasitics(odb::dbNet* net,
-                           GRoute& route,
-                           sta::Net* sta_net,
-                           sta::Corner* corner,
-                           sta::ParasiticAnalysisPt* analysis_point,
-                           sta::Parasitic* parasitic,
-                           NodeRoutePtMap& node_map);
-  sta::ParasiticNode* ensureParasiticNode(int x,
-                                          int y,
-                                          int layer,
-                                          NodeRoutePtMap& node_map,
-                                          sta::Parasitic* parasitic,
-                                          sta::Net* net) const;
-  void makeParasiticsToPins(std::vector<Pin>& pins,
-                            NodeRoutePtMap& node_map,
+  // pin_layer >= 0 connects every pin on that layer instead of its own.
+  void makeNetParasitics(odb::dbNet* net,
+                         std::vector<Pin>& pins,
+                         GRoute& route,
+                         int pin_layer,
+                         rsz::SpefWriter* spef_writer);
+  void makeRcNetwork(odb::dbNet* net,
+                     std::vector<Pin>& pins,
+                     GRoute& route,
+                     sta::Corner* corner,
+                     int pin_layer,
+                     RcNetwork& network) const;
+  void reportRcNetworkWarnings(odb::dbNet* net,
+                               const RcNetwork& network,
+                               bool partial) const;
+  void makeParasiticNetwork(sta::Net* sta_net,
                             sta::Corner* corner,
-                            sta::ParasiticAnalysisPt* analysis_point,
-                            sta::Parasitic* parasitic);
-  void makeParasiticsToPin(Pin& pin,
-                           NodeRoutePtMap& node_map,
-                           sta::Corner* corner,
-                           sta::ParasiticAnalysisPt* analysis_point,
-                           sta::Parasitic* parasitic);
-  void makePartialParasiticsToPins(std::vector<Pin>& pins,
-                                   NodeRoutePtMap& node_map,
-                                   sta::Corner* corner,
-                                   sta::ParasiticAnalysisPt* analysis_point,
-                                   sta::Parasitic* parasitic,
-                                   odb::dbNet* net);
-  void makePartialParasiticsToPin(Pin& pin,
-                                  NodeRoutePtMap& node_map,
-                                  sta::Corner* corner,
-                                  sta::ParasiticAnalysisPt* analysis_point,
-                                  sta::Parasitic* parasitic,
-                                  odb::dbNet* net);
+                            const RcNetwork& network,
+                            rsz::SpefWriter* spef_writer);
+
+  sta::Pin* staPin(Pin& pin) const;
   void layerRC(int wire_length_dbu,
                int layer,
                sta::Corner* corner,
@@ -0,0 +1,112 @@
+/////////////////////////////////////////////////////////////////////////////
+//
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "dst/Distributed.h"
+#include "dst/JobCallBack.h"
+#include "dst/JobMessage.h"
+#include "dst/RegionJobDescription.h"
+#include "grt/GlobalRouter.h"
+#include "odb/db.h"
+#include "ord/OpenRoad.hh"
+
+namespace grt {
+
+// Reroutes the congested regions sent by a leader running global_route
+// -distributed.
+class RegionRouteCallBack : public dst::JobCallBack
+{
+ public:
+  RegionRouteCallBack(GlobalRouter* router, dst::Distributed* dist)
+      : router_(router), dist_(dist)
+  {
+  }
+  void onRoutingJobReceived(dst::JobMessage& msg, dst::socket& sock) override
+  {
+  }
+  void onFrDesignUpdated(dst::JobMessage& msg, dst::socket& sock) override {}
+  void onPinAccessJobReceived(dst::JobMessage& msg, dst::socket& sock) override
+  {
+  }
+  void onGRDRInitJobReceived(dst::JobMessage& msg, dst::socket& sock) override
+  {
+  }
+  bool onRegionJobReceived(dst::JobMessage& msg, dst::socket& sock) override
+  {
+    auto desc
+        = static_cast<dst::RegionJobDescription*>(msg.getJobDescription());
+    if (desc->getTool() != "grt") {
+      return false;
+    }
+    // The router holds the state of one region at a time.
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (desc->getDesignPath() != design_path_
+        || desc->getDesignVersion() != design_version_) {
+      odb::dbDatabase* db = router_->db();
+      if (db->getChip() != nullptr) {
+        odb::dbChip::destroy(db->getChip());
+      }
+      ord::OpenRoad::openRoad()->readDb(desc->getDesignPath().c_str());
+      design_path_ = desc->getDesignPath();
+      design_version_ = desc->getDesignVersion();
+    }
+    int overflow_before, overflow_after;
+    const std::string routes
+        = router_->routeRegion(desc, overflow_before, overflow_after);
+
+    dst::JobMessage reply(dst::JobMessage::SUCCESS);
+    auto reply_desc = std::make_unique<dst::RegionJobDescription>();
+    reply_desc->setTool("grt");
+    reply_desc->setPayload(std::to_string(overflow_before) + " "
+                           + std::to_string(overflow_after) + "\n" + routes);
+    reply.setJobDescription(std::move(reply_desc));
+    dist_->sendResult(reply, sock);
+    return true;
+  }
+
+ private:
+  GlobalRouter* router_;
+  dst::Distributed* dist_;
+  std::mutex mutex_;
+  std::string design_path_;
+  int design_version_{0};
+};
+
+}  // namespace grt
@@ -32,10 +32,15 @@
 
 #include "grt/Rudy.h"
 
+#include <omp.h>
+
+#include <algorithm>
+
 #include "grt/GRoute.h"
 #include "grt/GlobalRouter.h"
 #include "odb/dbShape.h"
 #include "utl/Logger.h"
+#include "utl/exception.h"
 
 namespace grt {
 
@@ -83,6 +88,13 @@ void Rudy::setGridConfig(odb::Rect block, int tile_cnt_x, int tile_cnt_y)
   grid_block_ = block;
   tile_cnt_x_ = tile_cnt_x;
   tile_cnt_y_ = tile_cnt_y;
+  net_rudy_valid_ = false;
+}
+
+void Rudy::setWireWidth(int wire_width)
+{
+  wire_width_ = wire_width;
+  net_rudy_valid_ = false;
 }
 
 void Rudy::makeGrid()
@@ -111,6 +123,7 @@ void Rudy::makeGrid()
     }
     cur_x += tile_size_;
   }
+  net_rudy_valid_ = false;
 }
 
 void Rudy::getResourceReductions()
@@ -139,16 +152,70 @@ void Rudy::calculateRudy()
 
   getResourceReductions();
 
+  std::vector<odb::Rect> net_rects;
+  getNetRects(net_rects);
+
   // refer: https://ieeexplore.ieee.org/document/4211973
-  for (auto net : block_->getNets()) {
+  const int tile_count = tile_cnt_x_ * tile_cnt_y_;
+  interior_diff_.assign((tile_cnt_x_ + 1) * (tile_cnt_y_ + 1), 0.0);
+  if (!net_rudy_valid_ || net_rudy_.size() != tile_count) {
+    net_rudy_.assign(tile_count, 0.0);
+    for (const odb::Rect& net_rect : net_rects) {
+      processIntersectionSignalNet(net_rect, 1.0);
+    }
+  } else {
+    // Only update the nets that moved, were added or were removed.
+    net_rects_.resize(net_rects.size());
+    for (int id = 0; id < net_rects.size(); id++) {
+      if (net_rects[id] != net_rects_[id]) {
+        processIntersectionSignalNet(net_rects_[id], -1.0);
+        processIntersectionSignalNet(net_rects[id], 1.0);
+      }
+    }
+  }
+  integrateInteriorRudy();
+  net_rects_ = std::move(net_rects);
+  net_rudy_valid_ = true;
+
+  for (int x = 0; x < grid_.size(); x++) {
+    for (int y = 0; y < grid_[x].size(); y++) {
+      getEditableTile(x, y).addRudy(net_rudy_[x * tile_cnt_y_ + y]);
+    }
+  }
+}
+
+void Rudy::getNetRects(std::vector<odb::Rect>& net_rects) const
+{
+  std::vector<odb::dbNet*> nets;
+  int max_id = -1;
+  for (odb::dbNet* net : block_->getNets()) {
     if (!net->getSigType().isSupply()) {
-      const auto net_rect = net->getTermBBox();
-      processIntersectionSignalNet(net_rect);
+      nets.push_back(net);
+      max_id = std::max(max_id, static_cast<int>(net->getId()));
+    }
+  }
+
+  // Nets that are gone keep an empty rect, so their rudy gets removed.
+  net_rects.assign(std::max(max_id + 1, static_cast<int>(net_rects_.size())),
+                   odb::Rect());
+  utl::ThreadException exception;
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic, 64)
+  for (int i = 0; i < (int) nets.size(); i++) {  // NOLINT
+    try {
+      odb::dbNet* net = nets[i];
+      const odb::Rect net_rect = net->getTermBBox();
+      if (net_rect.area() != 0) {
+        net_rects[net->getId()] = net_rect;
+      }
+    } catch (...) {
+      exception.capture();
     }
   }
+  exception.rethrow();
 }
 
-void Rudy::processIntersectionSignalNet(const odb::Rect net_rect)
+void Rudy::processIntersectionSignalNet(const odb::Rect net_rect,
+                                        const double sign)
 {
   const auto net_area = net_rect.area();
   if (net_area == 0) {
@@ -169,10 +236,24 @@ void Rudy::processIntersectionSignalNet(const odb::Rect net_rect)
   const int max_y_index = std::min(
       tile_cnt_y_ - 1, (net_rect.yMax() - grid_block_.yMin()) / tile_size_);
 
-  // Iterate over the tiles in the calculated range
+  // The tiles strictly inside the range are fully covered by the net.
+  const double interior_rudy = sign * net_congestion * 100;
+  if (max_x_index - min_x_index > 1 && max_y_index - min_y_index > 1) {
+    const int stride = tile_cnt_y_ + 1;
+    interior_diff_[(min_x_index + 1) * stride + min_y_index + 1]
+        += interior_rudy;
+    interior_diff_[(min_x_index + 1) * stride + max_y_index] -= interior_rudy;
+    interior_diff_[max_x_index * stride + min_y_index + 1] -= interior_rudy;
+    interior_diff_[max_x_index * stride + max_y_index] += interior_rudy;
+  }
+
+  // Iterate over the tiles on the border of the range; the inner columns
+  // only have their first and last tile there.
   for (int x = min_x_index; x <= max_x_index; ++x) {
-    for (int y = min_y_index; y <= max_y_index; ++y) {
-      Tile& tile = getEditableTile(x, y);
+    const bool x_border = x == min_x_index || x == max_x_index;
+    for (int y = min_y_index; y <= max_y_index;
+         y = (x_border || y == max_y_index) ? y + 1 : max_y_index) {
+      const Tile& tile = getTile(x, y);
       const auto tile_box = tile.getRect();
       if (net_rect.overlaps(tile_box)) {
         const auto intersect_area = net_rect.intersect(tile_box).area();
@@ -180,8 +261,28 @@ void Rudy::processIntersectionSignalNet(const odb::Rect net_rect)
         const auto tile_net_box_ratio = static_cast<float>(intersect_area)
                                         / static_cast<float>(tile_area);
         const auto rudy = net_congestion * tile_net_box_ratio * 100;
-        tile.addRudy(rudy);
+        net_rudy_[x * tile_cnt_y_ + y] += sign * rudy;
+      }
+    }
+  }
+}
+
+void Rudy::integrateInteriorRudy()
+{
+  const int stride = tile_cnt_y_ + 1;
+  for (int x = 0; x < tile_cnt_x_; x++) {
+    for (int y = 0; y < tile_cnt_y_; y++) {
+      double& value = interior_diff_[x * stride + y];
+      if (x > 0) {
+        value += interior_diff_[(x - 1) * stride + y];
+      }
+      if (y > 0) {
+        value += interior_diff_[x * stride + y - 1];
+      }
+      if (x > 0 && y > 0) {
+        value -= interior_diff_[(x - 1) * stride + y - 1];
       }
+      net_rudy_[x * tile_cnt_y_ + y] += value;
     }
   }
 }
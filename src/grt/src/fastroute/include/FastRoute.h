@@ -46,6 +46,8 @@
 
 #include "AbstractMakeWireParasitics.h"
 #include "DataType.h"
+#include "IndexedHeap.h"
+#include "TiledGrid.h"
 #include "grt/GRoute.h"
 #include "odb/geom.h"
 #include "stt/SteinerTreeBuilder.h"
@@ -93,12 +95,33 @@ struct DebugSetting
 
 using stt::Tree;
 
+// Tiles of one layer blocked by an obstruction.  The tiles between the
+// first and last tiles are fully blocked, the first and last tiles only in
+// the given intervals.
+struct BlockedTiles
+{
+  odb::Point first_tile;
+  odb::Point last_tile;
+  interval<int>::type first_tile_reduce_interval;
+  interval<int>::type last_tile_reduce_interval;
+};
+
 struct parent3D
 {
   int16_t layer;
   int x, y;
 };
 
+// Scratch data of one thread of the 2D maze routing
+struct MazeNetState
+{
+  IndexedHeap<double> src_heap;
+  std::vector<int> dest_heap;
+  std::vector<OrderNetEdge> net_eo;
+  std::set<std::pair<int, int>> h_used_ggrid;
+  std::set<std::pair<int, int>> v_used_ggrid;
+};
+
 class FastRouteCore
 {
  public:
@@ -108,6 +131,8 @@ class FastRouteCore
   ~FastRouteCore();
 
   void clear();
+  // Estimate of the bytes held by the routing grids and the nets.
+  int64_t getMemoryUsage() const;
   void saveCongestion(int iter = -1);
   void setGridsAndLayers(int x, int y, int nLayers);
   void addVCapacity(short verticalCapacity, int layer);
@@ -158,11 +183,18 @@ class FastRouteCore
       const int layer,
       const interval<int>::type& first_tile_reduce_interval,
       const interval<int>::type& last_tile_reduce_interval);
+  // Adds the blocked tiles of the obstructions of all layers, indexed by
+  // routing level - 1.  The layers are blocked in parallel.
+  void addObstructionAdjustments(
+      const std::vector<std::vector<BlockedTiles>>& layer_blocked_tiles);
   void initBlockedIntervals(std::vector<int>& track_space);
   void initAuxVar();
   NetRouteMap run();
   int totalOverflow() const { return total_overflow_; }
   bool has2Doverflow() const { return has_2D_overflow_; }
+  // Recomputes the total overflow over all 2D edges, after routes were
+  // changed outside of run().
+  void updateOverflow();
   void getBlockage(odb::dbTechLayer* layer,
                    int x,
                    int y,
@@ -178,8 +210,8 @@ class FastRouteCore
   const std::vector<short>& getVerticalCapacities() { return v_capacity_3D_; }
   const std::vector<short>& getHorizontalCapacities() { return h_capacity_3D_; }
   int getEdgeCapacity(int x1, int y1, int x2, int y2, int layer);
-  const multi_array<Edge3D, 3>& getHorizontalEdges3D() { return h_edges_3D_; }
-  const multi_array<Edge3D, 3>& getVerticalEdges3D() { return v_edges_3D_; }
+  const TiledGrid3D<Edge3D>& getHorizontalEdges3D() { return h_edges_3D_; }
+  const TiledGrid3D<Edge3D>& getVerticalEdges3D() { return v_edges_3D_; }
   void setLastColVCapacity(short cap, int layer)
   {
     last_col_v_capacity_3D_[layer] = cap;
@@ -199,8 +231,27 @@ class FastRouteCore
   void setRegularX(bool regular_x) { regular_x_ = regular_x; }
   void setRegularY(bool regular_y) { regular_y_ = regular_y; }
   void incrementEdge3DUsage(int x1, int y1, int x2, int y2, int layer);
+  // Adds (sign 1) or removes (sign -1) the 2D and 3D usage of a net segment
+  // that is not part of the net's Steiner tree, e.g. one read from the
+  // guides.
+  void updateSegmentUsage(odb::dbNet* db_net,
+                          int x1,
+                          int y1,
+                          int x2,
+                          int y2,
+                          int layer,
+                          int sign);
+  // Forgets the nets queued for the next run without touching their routes.
+  void clearNetsToRoute() { net_ids_.clear(); }
   void setMaxNetDegree(int);
   void setVerbose(bool v);
+  // Routes the 2D maze rip-up and reroute in waves of nets with disjoint
+  // regions on threads.  The result does not depend on the thread count,
+  // but differs from the serial loop used when parallel is false.
+  void setParallelMaze(bool parallel, int threads);
+  // Threads used by the 3D layer assignment.  The result does not depend on
+  // the count.
+  void setLayerAssignmentThreads(int threads);
   void setCriticalNetsPercentage(float u);
   float getCriticalNetsPercentage() { return critical_nets_percentage_; };
   void setMakeWireParasiticsBuilder(AbstractMakeWireParasitics* builder);
@@ -268,6 +319,12 @@ class FastRouteCore
                      const int slope,
                      const int L,
                      float& slack_th);
+  // Grid box that net can read or write while maze routed with expand
+  odb::Rect getMazeRegion(int netID, int expand);
+  // Groups the items into waves so that the regions of one wave don't share a
+  // tile and overlapping regions keep their order across waves.
+  std::vector<std::vector<int>> getRegionWaves(
+      const std::vector<odb::Rect>& regions);
   void convertToMazeroute();
   void updateCongestionHistory(const int upType, bool stopDEC, int& max_adj);
   int getOverflow2D(int* maxOverflow);
@@ -304,8 +361,8 @@ class FastRouteCore
   void convertToMazerouteNet(const int netID);
   void setupHeap(const int netID,
                  const int edgeID,
-                 std::vector<double*>& src_heap,
-                 std::vector<double*>& dest_heap,
+                 IndexedHeap<double>& src_heap,
+                 std::vector<int>& dest_heap,
                  multi_array<double, 2>& d1,
                  multi_array<double, 2>& d2,
                  const int regionX1,
@@ -349,14 +406,14 @@ class FastRouteCore
   void addNeighborPoints(int netID,
                          int n1,
                          int n2,
-                         std::vector<int*>& points_heap_3D,
+                         std::vector<int>& points_3D,
                          multi_array<int, 3>& dist_3D,
                          multi_array<Direction, 3>& directions_3D,
                          multi_array<int, 3>& corr_edge_3D);
   void setupHeap3D(int netID,
                    int edgeID,
-                   std::vector<int*>& src_heap_3D,
-                   std::vector<int*>& dest_heap_3D,
+                   IndexedHeap<int>& src_heap_3D,
+                   std::vector<int>& dest_heap_3D,
                    multi_array<Direction, 3>& directions_3D,
                    multi_array<int, 3>& corr_edge_3D,
                    multi_array<int, 3>& d1_3D,
@@ -408,6 +465,7 @@ class FastRouteCore
                     const bool genTree,
                     const bool newType,
                     const bool noADJ);
+  std::vector<Tree> makeNetTrees(const bool noADJ, const int flute_accuracy);
   void fluteNormal(const int netID,
                    const std::vector<int>& x,
                    const std::vector<int>& y,
@@ -498,7 +556,7 @@ class FastRouteCore
                         int16_t& top_pin_l);
   int threeDVIA();
   void fixEdgeAssignment(int& net_layer,
-                         multi_array<Edge3D, 3>& edges_3D,
+                         TiledGrid3D<Edge3D>& edges_3D,
                          int x,
                          int y,
                          int k,
@@ -515,7 +573,7 @@ class FastRouteCore
   float CalculatePartialSlack();
   bool checkRoute2DTree(int netID);
   void removeLoops();
-  void netedgeOrderDec(int netID);
+  void netedgeOrderDec(int netID, std::vector<OrderNetEdge>& net_eo);
   void printTree2D(int netID);
   void printEdge2D(int netID, int edgeID);
   void printEdge3D(int netID, int edgeID);
@@ -536,7 +594,27 @@ class FastRouteCore
                            bool is3DVisualization);
   int netCount() const { return nets_.size(); }
 
-  typedef std::tuple<int, int, int> Tile;
+  typedef std::pair<int, int> Tile;
+  using BlockedIntervals
+      = std::unordered_map<Tile, interval_set<int>, boost::hash<Tile>>;
+  // Capacity removed from the 2D edge of a tile by blocking a 3D edge.
+  struct EdgeReduction
+  {
+    int x;
+    int y;
+    int reduce;
+  };
+
+  // Block the 3D edges of one layer; the 2D edge reductions are returned
+  // in reductions to be applied by applyEdgeReductions.
+  void blockVerticalTiles(const BlockedTiles& tiles,
+                          int layer,
+                          std::vector<EdgeReduction>& reductions);
+  void blockHorizontalTiles(const BlockedTiles& tiles,
+                            int layer,
+                            std::vector<EdgeReduction>& reductions);
+  void applyEdgeReductions(const std::vector<EdgeReduction>& reductions,
+                           bool vertical);
 
   static const int BIG_INT = 1e9;  // big integer used as infinity
   static const int HCOST = 5000;
@@ -574,6 +652,9 @@ class FastRouteCore
   bool has_2D_overflow_;
   int grid_hv_;
   bool verbose_;
+  bool parallel_maze_;
+  int maze_threads_;
+  int layer_assignment_threads_;
   float critical_nets_percentage_;
   int via_cost_;
   int mazeedge_threshold_;
@@ -603,7 +684,6 @@ class FastRouteCore
 
   std::vector<FrNet*> nets_;
   std::unordered_map<odb::dbNet*, int> db_net_id_map_;  // db net -> net id
-  std::vector<OrderNetEdge> net_eo_;
   std::vector<std::vector<int>>
       gxs_;  // the copy of xs for nets, used for second FLUTE
   std::vector<std::vector<int>>
@@ -614,10 +694,10 @@ class FastRouteCore
   std::vector<OrderNetPin> tree_order_pv_;
   std::vector<OrderTree> tree_order_cong_;
 
-  multi_array<Edge, 2> v_edges_;       // The way it is indexed is (Y, X)
-  multi_array<Edge, 2> h_edges_;       // The way it is indexed is (Y, X)
-  multi_array<Edge3D, 3> h_edges_3D_;  // The way it is indexed is (Layer, Y, X)
-  multi_array<Edge3D, 3> v_edges_3D_;  // The way it is indexed is (Layer, Y, X)
+  TiledGrid<Edge> v_edges_;         // The way it is indexed is (Y, X)
+  TiledGrid<Edge> h_edges_;         // The way it is indexed is (Y, X)
+  TiledGrid3D<Edge3D> h_edges_3D_;  // The way it is indexed is (Layer, Y, X)
+  TiledGrid3D<Edge3D> v_edges_3D_;  // The way it is indexed is (Layer, Y, X)
   multi_array<int, 2> corr_edge_;
   multi_array<short, 2> parent_x1_;
   multi_array<short, 2> parent_y1_;
@@ -637,13 +717,17 @@ class FastRouteCore
 
   std::unique_ptr<DebugSetting> debug_;
 
-  std::unordered_map<Tile, interval_set<int>, boost::hash<Tile>>
-      vertical_blocked_intervals_;
-  std::unordered_map<Tile, interval_set<int>, boost::hash<Tile>>
-      horizontal_blocked_intervals_;
+  // Per layer, indexed by routing level - 1.
+  std::vector<BlockedIntervals> vertical_blocked_intervals_;
+  std::vector<BlockedIntervals> horizontal_blocked_intervals_;
 
   std::set<std::pair<int, int>> h_used_ggrid_;
   std::set<std::pair<int, int>> v_used_ggrid_;
+  // Grids used by earlier runs that may still hold congestion history.
+  // Every other 2D edge has zero est_usage, last_usage and congCNT, so the
+  // per-run resets only visit these and the used grids of the current run.
+  std::set<std::pair<int, int>> h_last_used_ggrid_;
+  std::set<std::pair<int, int>> v_last_used_ggrid_;
   std::vector<int> net_ids_;
 
   // Maze 3D variables
@@ -651,8 +735,8 @@ class FastRouteCore
   multi_array<int, 3> corr_edge_3D_;
   multi_array<parent3D, 3> pr_3D_;
   std::vector<bool> pop_heap2_3D_;
-  std::vector<int*> src_heap_3D_;
-  std::vector<int*> dest_heap_3D_;
+  IndexedHeap<int> src_heap_3D_;
+  std::vector<int> dest_heap_3D_;
   multi_array<int, 3> d1_3D_;
   multi_array<int, 3> d2_3D_;
 };
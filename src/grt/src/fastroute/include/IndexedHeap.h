@@ -0,0 +1,150 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+namespace grt {
+
+// Binary min-heap of the indices of a key array, used as the maze routing
+// wavefront.  The heap position of every index is tracked so decreasing a
+// key doesn't have to search for it.  Sifting and tie breaking follow the
+// pointer heap the maze routers used before, so equal cost grids pop in the
+// same order and the routes don't change.
+template <typename Key>
+class IndexedHeap
+{
+ public:
+  // keys must stay valid while the heap is used
+  void init(const Key* keys, const int size)
+  {
+    keys_ = keys;
+    heap_.clear();
+    positions_.assign(size, -1);
+  }
+
+  bool empty() const { return heap_.empty(); }
+  int size() const { return heap_.size(); }
+  // index with the smallest key
+  int top() const { return heap_[0]; }
+  bool contains(const int index) const { return positions_[index] >= 0; }
+
+  // An index pushed twice, like a grid shared by two edges of a source
+  // subtree, is popped twice.  Only the position of its last copy is
+  // tracked, so such an index must not be decreased.
+  void push(const int index)
+  {
+    positions_[index] = heap_.size();
+    heap_.push_back(index);
+    siftUp(heap_.size() - 1);
+  }
+
+  // Must be called after the key of index was decreased.
+  void decrease(const int index) { siftUp(positions_[index]); }
+
+  void pop()
+  {
+    positions_[heap_[0]] = -1;
+    const int last = heap_.back();
+    heap_.pop_back();
+    if (!heap_.empty()) {
+      heap_[0] = last;
+      positions_[last] = 0;
+      siftDown(0);
+    }
+  }
+
+  void clear()
+  {
+    for (const int index : heap_) {
+      positions_[index] = -1;
+    }
+    heap_.clear();
+  }
+
+ private:
+  static constexpr int kArity = 2;
+
+  void siftUp(int pos)
+  {
+    const int index = heap_[pos];
+    while (pos > 0) {
+      const int parent = (pos - 1) / kArity;
+      if (!(keys_[heap_[parent]] > keys_[index])) {
+        break;
+      }
+      place(heap_[parent], pos);
+      pos = parent;
+    }
+    place(index, pos);
+  }
+
+  void siftDown(int pos)
+  {
+    const int index = heap_[pos];
+    const int heap_size = heap_.size();
+    while (true) {
+      const int first_child = kArity * pos + 1;
+      if (first_child >= heap_size) {
+        break;
+      }
+      const int last_child = std::min(first_child + kArity, heap_size);
+      int smallest = first_child;
+      for (int child = first_child + 1; child < last_child; child++) {
+        if (keys_[heap_[child]] < keys_[heap_[smallest]]) {
+          smallest = child;
+        }
+      }
+      if (!(keys_[heap_[smallest]] < keys_[index])) {
+        break;
+      }
+      place(heap_[smallest], pos);
+      pos = smallest;
+    }
+    place(index, pos);
+  }
+
+  void place(const int index, const int pos)
+  {
+    heap_[pos] = index;
+    positions_[index] = pos;
+  }
+
+  const Key* keys_ = nullptr;
+  std::vector<int> heap_;
+  std::vector<int> positions_;  // -1 if not in the heap
+};
+
+}  // namespace grt
@@ -0,0 +1,133 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+#include <cstddef>
+#include <vector>
+
+namespace grt {
+
+// 2D grid stored as 8x8 tiles, one tile after the other, so cells that are
+// close in x or in y share cache lines.  Cells are accessed as grid[y][x]
+// like a multi_array and are value initialized by resize.
+template <typename T>
+class TiledGrid
+{
+ public:
+  template <typename U>
+  class RowRef
+  {
+   public:
+    explicit RowRef(U* row) : row_(row) {}
+    U& operator[](const int x) const
+    {
+      return row_[(x >> kTileBits) * kTileArea + (x & kTileMask)];
+    }
+
+   private:
+    U* row_;
+  };
+
+  void resize(const int rows, const int cols)
+  {
+    rows_ = rows;
+    cols_ = cols;
+    tiles_x_ = (cols + kTileMask) >> kTileBits;
+    const int tiles_y = (rows + kTileMask) >> kTileBits;
+    cells_.assign(static_cast<size_t>(tiles_x_) * tiles_y * kTileArea, T());
+  }
+
+  size_t num_elements() const { return static_cast<size_t>(rows_) * cols_; }
+  // Cells allocated, including the padding of the last row and column tiles.
+  size_t allocated_elements() const { return cells_.size(); }
+
+  RowRef<T> operator[](const int y)
+  {
+    return RowRef<T>(cells_.data() + rowOffset(y));
+  }
+  RowRef<const T> operator[](const int y) const
+  {
+    return RowRef<const T>(cells_.data() + rowOffset(y));
+  }
+
+ private:
+  static constexpr int kTileBits = 3;
+  static constexpr int kTileSize = 1 << kTileBits;
+  static constexpr int kTileMask = kTileSize - 1;
+  static constexpr int kTileArea = kTileSize * kTileSize;
+
+  // offset of the first cell of row y in the tile holding column 0
+  size_t rowOffset(const int y) const
+  {
+    return static_cast<size_t>(y >> kTileBits) * tiles_x_ * kTileArea
+           + (y & kTileMask) * kTileSize;
+  }
+
+  std::vector<T> cells_;
+  int rows_ = 0;
+  int cols_ = 0;
+  int tiles_x_ = 0;
+};
+
+// Layers of TiledGrids accessed as grid[l][y][x].
+template <typename T>
+class TiledGrid3D
+{
+ public:
+  void resize(const int layers, const int rows, const int cols)
+  {
+    layers_.resize(layers);
+    for (TiledGrid<T>& layer : layers_) {
+      layer.resize(rows, cols);
+    }
+  }
+
+  size_t num_elements() const
+  {
+    return layers_.empty() ? 0 : layers_.size() * layers_[0].num_elements();
+  }
+  size_t allocated_elements() const
+  {
+    return layers_.empty()
+               ? 0
+               : layers_.size() * layers_[0].allocated_elements();
+  }
+
+  TiledGrid<T>& operator[](const int l) { return layers_[l]; }
+  const TiledGrid<T>& operator[](const int l) const { return layers_[l]; }
+
+ private:
+  std::vector<TiledGrid<T>> layers_;
+};
+
+}  // namespace grt
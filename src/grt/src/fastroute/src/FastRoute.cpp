@@ -44,6 +44,7 @@
 #include "DataType.h"
 #include "odb/db.h"
 #include "utl/Logger.h"
+#include "utl/ThreadPool.h"
 
 namespace grt {
 
@@ -76,6 +77,9 @@ FastRouteCore::FastRouteCore(odb::dbDatabase* db,
       has_2D_overflow_(false),
       grid_hv_(0),
       verbose_(false),
+      parallel_maze_(false),
+      maze_threads_(1),
+      layer_assignment_threads_(1),
       critical_nets_percentage_(10),
       via_cost_(0),
       mazeedge_threshold_(0),
@@ -105,8 +109,12 @@ void FastRouteCore::clear()
   total_overflow_ = 0;
   has_2D_overflow_ = false;
 
-  h_edges_.resize(boost::extents[0][0]);
-  v_edges_.resize(boost::extents[0][0]);
+  h_edges_.resize(0, 0);
+  v_edges_.resize(0, 0);
+  h_used_ggrid_.clear();
+  v_used_ggrid_.clear();
+  h_last_used_ggrid_.clear();
+  v_last_used_ggrid_.clear();
   seglist_.clear();
 
   gxs_.clear();
@@ -116,16 +124,14 @@ void FastRouteCore::clear()
   tree_order_pv_.clear();
   tree_order_cong_.clear();
 
-  h_edges_3D_.resize(boost::extents[0][0][0]);
-  v_edges_3D_.resize(boost::extents[0][0][0]);
+  h_edges_3D_.resize(0, 0, 0);
+  v_edges_3D_.resize(0, 0, 0);
 
   parent_x1_.resize(boost::extents[0][0]);
   parent_y1_.resize(boost::extents[0][0]);
   parent_x3_.resize(boost::extents[0][0]);
   parent_y3_.resize(boost::extents[0][0]);
 
-  net_eo_.clear();
-
   xcor_.clear();
   ycor_.clear();
   dcor_.clear();
@@ -154,6 +160,44 @@ void FastRouteCore::clear()
   horizontal_blocked_intervals_.clear();
 }
 
+int64_t FastRouteCore::getMemoryUsage() const
+{
+  int64_t bytes = 0;
+  bytes += (h_edges_.allocated_elements() + v_edges_.allocated_elements())
+           * sizeof(Edge);
+  bytes
+      += (h_edges_3D_.allocated_elements() + v_edges_3D_.allocated_elements())
+         * sizeof(Edge3D);
+  bytes += corr_edge_.num_elements() * sizeof(int);
+  bytes += (parent_x1_.num_elements() + parent_y1_.num_elements()
+            + parent_x3_.num_elements() + parent_y3_.num_elements())
+           * sizeof(short);
+  bytes += (hv_.num_elements() + hyper_v_.num_elements()
+            + hyper_h_.num_elements() + in_region_.num_elements())
+           * sizeof(bool);
+  bytes += directions_3D_.num_elements() * sizeof(Direction);
+  bytes += (corr_edge_3D_.num_elements() + d1_3D_.num_elements()
+            + d2_3D_.num_elements())
+           * sizeof(int);
+  bytes += pr_3D_.num_elements() * sizeof(parent3D);
+
+  for (const StTree& tree : sttrees_) {
+    bytes += tree.nodes.capacity() * sizeof(TreeNode);
+    bytes += tree.edges.capacity() * sizeof(TreeEdge);
+    for (const TreeEdge& edge : tree.edges) {
+      const Route& route = edge.route;
+      bytes += (route.gridsX.capacity() + route.gridsY.capacity()
+                + route.gridsL.capacity())
+               * sizeof(int16_t);
+    }
+  }
+  for (const std::vector<Segment>& segs : seglist_) {
+    bytes += segs.capacity() * sizeof(Segment);
+  }
+  bytes += nets_.size() * sizeof(FrNet);
+  return bytes;
+}
+
 void FastRouteCore::clearNets()
 {
   if (!sttrees_.empty()) {
@@ -175,6 +219,8 @@ void FastRouteCore::setGridsAndLayers(int x, int y, int nLayers)
   y_grid_ = y;
   num_layers_ = nLayers;
   layer_directions_.resize(num_layers_);
+  vertical_blocked_intervals_.resize(num_layers_);
+  horizontal_blocked_intervals_.resize(num_layers_);
   if (std::max(x_grid_, y_grid_) >= 1000) {
     x_range_ = std::max(x_grid_, y_grid_);
     y_range_ = std::max(x_grid_, y_grid_);
@@ -221,13 +267,11 @@ void FastRouteCore::setGridsAndLayers(int x, int y, int nLayers)
   int64 total_size = static_cast<int64>(num_layers_) * y_range_ * x_range_;
   pop_heap2_3D_.resize(total_size, false);
 
-  // allocate memory for priority queue
-  total_size = static_cast<int64>(y_grid_) * x_grid_ * num_layers_;
-  src_heap_3D_.resize(total_size);
-  dest_heap_3D_.resize(total_size);
-
   d1_3D_.resize(boost::extents[num_layers_][y_range_][x_range_]);
   d2_3D_.resize(boost::extents[num_layers_][y_range_][x_range_]);
+
+  // the priority queue is keyed by the d1_3D_ distances
+  src_heap_3D_.init(d1_3D_.data(), d1_3D_.num_elements());
 }
 
 void FastRouteCore::addVCapacity(short verticalCapacity, int layer)
@@ -362,11 +406,11 @@ void FastRouteCore::initEdges()
 
   // allocate memory and initialize for edges
 
-  h_edges_.resize(boost::extents[y_grid_][x_grid_ - 1]);
-  v_edges_.resize(boost::extents[y_grid_ - 1][x_grid_]);
+  h_edges_.resize(y_grid_, x_grid_ - 1);
+  v_edges_.resize(y_grid_ - 1, x_grid_);
 
-  v_edges_3D_.resize(boost::extents[num_layers_][y_grid_][x_grid_]);
-  h_edges_3D_.resize(boost::extents[num_layers_][y_grid_][x_grid_]);
+  v_edges_3D_.resize(num_layers_, y_grid_, x_grid_);
+  h_edges_3D_.resize(num_layers_, y_grid_, x_grid_);
 
   for (int i = 0; i < y_grid_; i++) {
     for (int j = 0; j < x_grid_; j++) {
@@ -568,20 +612,13 @@ void FastRouteCore::addVerticalAdjustments(
     const interval<int>::type& first_tile_reduce_interval,
     const interval<int>::type& last_tile_reduce_interval)
 {
-  // add intervals to set for each tile
-  for (int x = first_tile.getX(); x <= last_tile.getX(); x++) {
-    for (int y = first_tile.getY(); y < last_tile.getY(); y++) {
-      if (x == first_tile.getX()) {
-        vertical_blocked_intervals_[std::make_tuple(x, y, layer)]
-            += first_tile_reduce_interval;
-      } else if (x == last_tile.getX()) {
-        vertical_blocked_intervals_[std::make_tuple(x, y, layer)]
-            += last_tile_reduce_interval;
-      } else {
-        addAdjustment(x, y, x, y + 1, layer, 0, true);
-      }
-    }
-  }
+  std::vector<EdgeReduction> reductions;
+  const BlockedTiles tiles{first_tile,
+                           last_tile,
+                           first_tile_reduce_interval,
+                           last_tile_reduce_interval};
+  blockVerticalTiles(tiles, layer, reductions);
+  applyEdgeReductions(reductions, true);
 }
 
 void FastRouteCore::addHorizontalAdjustments(
@@ -591,65 +628,149 @@ void FastRouteCore::addHorizontalAdjustments(
     const interval<int>::type& first_tile_reduce_interval,
     const interval<int>::type& last_tile_reduce_interval)
 {
+  std::vector<EdgeReduction> reductions;
+  const BlockedTiles tiles{first_tile,
+                           last_tile,
+                           first_tile_reduce_interval,
+                           last_tile_reduce_interval};
+  blockHorizontalTiles(tiles, layer, reductions);
+  applyEdgeReductions(reductions, false);
+}
+
+void FastRouteCore::addObstructionAdjustments(
+    const std::vector<std::vector<BlockedTiles>>& layer_blocked_tiles)
+{
+  const int num_layers
+      = std::min(static_cast<int>(layer_blocked_tiles.size()), num_layers_);
+  // A layer only writes its own 3D edges and blocked intervals.  The 2D
+  // edges are shared by all layers, so their reductions are applied after.
+  std::vector<std::vector<EdgeReduction>> reductions(num_layers);
+  utl::ThreadPool::get().parallelFor(0, num_layers, [&](const int k) {
+    const bool vertical = layer_directions_[k] == odb::dbTechLayerDir::VERTICAL;
+    for (const BlockedTiles& tiles : layer_blocked_tiles[k]) {
+      if (vertical) {
+        blockVerticalTiles(tiles, k + 1, reductions[k]);
+      } else {
+        blockHorizontalTiles(tiles, k + 1, reductions[k]);
+      }
+    }
+  });
+  for (int k = 0; k < num_layers; k++) {
+    applyEdgeReductions(
+        reductions[k], layer_directions_[k] == odb::dbTechLayerDir::VERTICAL);
+  }
+}
+
+void FastRouteCore::blockVerticalTiles(const BlockedTiles& tiles,
+                                       const int layer,
+                                       std::vector<EdgeReduction>& reductions)
+{
+  const int k = layer - 1;
+  BlockedIntervals& blocked_intervals = vertical_blocked_intervals_[k];
+  // add intervals to set for each tile
+  for (int x = tiles.first_tile.getX(); x <= tiles.last_tile.getX(); x++) {
+    for (int y = tiles.first_tile.getY(); y < tiles.last_tile.getY(); y++) {
+      if (x == tiles.first_tile.getX()) {
+        blocked_intervals[{x, y}] += tiles.first_tile_reduce_interval;
+      } else if (x == tiles.last_tile.getX()) {
+        blocked_intervals[{x, y}] += tiles.last_tile_reduce_interval;
+      } else {
+        // same as addAdjustment(x, y, x, y + 1, layer, 0, true)
+        Edge3D& edge = v_edges_3D_[k][y][x];
+        if (y < y_grid_ - 1) {
+          reductions.push_back({x, y, edge.cap});
+        }
+        edge.red += edge.cap;
+        edge.cap = 0;
+      }
+    }
+  }
+}
+
+void FastRouteCore::blockHorizontalTiles(
+    const BlockedTiles& tiles,
+    const int layer,
+    std::vector<EdgeReduction>& reductions)
+{
+  const int k = layer - 1;
+  BlockedIntervals& blocked_intervals = horizontal_blocked_intervals_[k];
   // add intervals to each tiles
-  for (int x = first_tile.getX(); x < last_tile.getX(); x++) {
-    for (int y = first_tile.getY(); y <= last_tile.getY(); y++) {
-      if (y == first_tile.getY()) {
-        horizontal_blocked_intervals_[std::make_tuple(x, y, layer)]
-            += first_tile_reduce_interval;
-      } else if (y == last_tile.getY()) {
-        horizontal_blocked_intervals_[std::make_tuple(x, y, layer)]
-            += last_tile_reduce_interval;
+  for (int x = tiles.first_tile.getX(); x < tiles.last_tile.getX(); x++) {
+    for (int y = tiles.first_tile.getY(); y <= tiles.last_tile.getY(); y++) {
+      if (y == tiles.first_tile.getY()) {
+        blocked_intervals[{x, y}] += tiles.first_tile_reduce_interval;
+      } else if (y == tiles.last_tile.getY()) {
+        blocked_intervals[{x, y}] += tiles.last_tile_reduce_interval;
       } else {
-        addAdjustment(x, y, x + 1, y, layer, 0, true);
+        // same as addAdjustment(x, y, x + 1, y, layer, 0, true)
+        Edge3D& edge = h_edges_3D_[k][y][x];
+        if (x < x_grid_ - 1) {
+          reductions.push_back({x, y, edge.cap});
+        }
+        edge.red += edge.cap;
+        edge.cap = 0;
       }
     }
   }
 }
 
+void FastRouteCore::applyEdgeReductions(
+    const std::vector<EdgeReduction>& reductions,
+    const bool vertical)
+{
+  TiledGrid<Edge>& edges = vertical ? v_edges_ : h_edges_;
+  for (const EdgeReduction& reduction : reductions) {
+    Edge& edge = edges[reduction.y][reduction.x];
+    edge.cap -= reduction.reduce;
+    edge.red += reduction.reduce;
+  }
+}
+
 void FastRouteCore::initBlockedIntervals(std::vector<int>& track_space)
 {
   // Calculate reduce for vertical tiles
-  for (const auto& [tile, intervals] : vertical_blocked_intervals_) {
-    int x = std::get<0>(tile);
-    int y = std::get<1>(tile);
-    int layer = std::get<2>(tile);
-    int edge_cap = getEdgeCapacity(x, y, x, y + 1, layer);
-    if (edge_cap > 0) {
-      int reduce = 0;
-      if (layer > 0 && layer <= track_space.size()) {
-        for (const auto& interval_it : intervals) {
-          reduce += std::ceil(static_cast<float>(std::abs(
-                                  interval_it.upper() - interval_it.lower()))
-                              / track_space[layer - 1]);
+  for (int k = 0; k < vertical_blocked_intervals_.size(); k++) {
+    const int layer = k + 1;
+    for (const auto& [tile, intervals] : vertical_blocked_intervals_[k]) {
+      const auto& [x, y] = tile;
+      int edge_cap = getEdgeCapacity(x, y, x, y + 1, layer);
+      if (edge_cap > 0) {
+        int reduce = 0;
+        if (layer <= track_space.size()) {
+          for (const auto& interval_it : intervals) {
+            reduce += std::ceil(static_cast<float>(std::abs(
+                                    interval_it.upper() - interval_it.lower()))
+                                / track_space[layer - 1]);
+          }
         }
+        edge_cap -= reduce;
+        if (edge_cap < 0)
+          edge_cap = 0;
+        addAdjustment(x, y, x, y + 1, layer, edge_cap, true);
       }
-      edge_cap -= reduce;
-      if (edge_cap < 0)
-        edge_cap = 0;
-      addAdjustment(x, y, x, y + 1, layer, edge_cap, true);
     }
   }
 
   // Calculate reduce for horizontal tiles
-  for (const auto& [tile, intervals] : horizontal_blocked_intervals_) {
-    int x = std::get<0>(tile);
-    int y = std::get<1>(tile);
-    int layer = std::get<2>(tile);
-    int edge_cap = getEdgeCapacity(x, y, x + 1, y, layer);
-    if (edge_cap > 0) {
-      int reduce = 0;
-      if (layer > 0 && layer <= track_space.size()) {
-        for (const auto& interval_it : intervals) {
-          reduce += std::ceil(static_cast<float>(std::abs(
-                                  interval_it.upper() - interval_it.lower()))
-                              / track_space[layer - 1]);
+  for (int k = 0; k < horizontal_blocked_intervals_.size(); k++) {
+    const int layer = k + 1;
+    for (const auto& [tile, intervals] : horizontal_blocked_intervals_[k]) {
+      const auto& [x, y] = tile;
+      int edge_cap = getEdgeCapacity(x, y, x + 1, y, layer);
+      if (edge_cap > 0) {
+        int reduce = 0;
+        if (layer <= track_space.size()) {
+          for (const auto& interval_it : intervals) {
+            reduce += std::ceil(static_cast<float>(std::abs(
+                                    interval_it.upper() - interval_it.lower()))
+                                / track_space[layer - 1]);
+          }
         }
+        edge_cap -= reduce;
+        if (edge_cap < 0)
+          edge_cap = 0;
+        addAdjustment(x, y, x + 1, y, layer, edge_cap, true);
       }
-      edge_cap -= reduce;
-      if (edge_cap < 0)
-        edge_cap = 0;
-      addAdjustment(x, y, x + 1, y, layer, edge_cap, true);
     }
   }
 }
@@ -709,16 +830,71 @@ void FastRouteCore::incrementEdge3DUsage(int x1,
   }
 }
 
+void FastRouteCore::updateSegmentUsage(odb::dbNet* db_net,
+                                       int x1,
+                                       int y1,
+                                       int x2,
+                                       int y2,
+                                       int layer,
+                                       int sign)
+{
+  int net_id;
+  bool exists;
+  getNetId(db_net, net_id, exists);
+  if (!exists) {
+    return;
+  }
+  const FrNet* net = nets_[net_id];
+  const int k = layer - 1;
+  const int edge_cost = sign * net->getEdgeCost();
+  const int layer_edge_cost = sign * net->getLayerEdgeCost(k);
+
+  if (y1 == y2) {  // horizontal edge
+    for (int x = std::min(x1, x2); x < std::max(x1, x2); x++) {
+      h_edges_[y1][x].usage += edge_cost;
+      h_edges_3D_[k][y1][x].usage += layer_edge_cost;
+    }
+  } else if (x1 == x2) {  // vertical edge
+    for (int y = std::min(y1, y2); y < std::max(y1, y2); y++) {
+      v_edges_[y][x1].usage += edge_cost;
+      v_edges_3D_[k][y][x1].usage += layer_edge_cost;
+    }
+  }
+}
+
+void FastRouteCore::updateOverflow()
+{
+  total_overflow_ = 0;
+  for (int y = 0; y < y_grid_; y++) {
+    for (int x = 0; x < x_grid_ - 1; x++) {
+      const Edge& edge = h_edges_[y][x];
+      total_overflow_ += std::max(0, edge.usage - edge.cap);
+    }
+  }
+  for (int y = 0; y < y_grid_ - 1; y++) {
+    for (int x = 0; x < x_grid_; x++) {
+      const Edge& edge = v_edges_[y][x];
+      total_overflow_ += std::max(0, edge.usage - edge.cap);
+    }
+  }
+  has_2D_overflow_ = total_overflow_ > 0;
+}
+
 void FastRouteCore::initAuxVar()
 {
   tree_order_cong_.clear();
 
   grid_hv_ = x_range_ * y_range_;
 
-  parent_x1_.resize(boost::extents[y_grid_][x_grid_]);
-  parent_y1_.resize(boost::extents[y_grid_][x_grid_]);
-  parent_x3_.resize(boost::extents[y_grid_][x_grid_]);
-  parent_y3_.resize(boost::extents[y_grid_][x_grid_]);
+  // incremental routing calls this for every update, so only reallocate the
+  // grids when their size changed
+  if (parent_x1_.shape()[0] != (size_t) y_grid_
+      || parent_x1_.shape()[1] != (size_t) x_grid_) {
+    parent_x1_.resize(boost::extents[y_grid_][x_grid_]);
+    parent_y1_.resize(boost::extents[y_grid_][x_grid_]);
+    parent_x3_.resize(boost::extents[y_grid_][x_grid_]);
+    parent_y3_.resize(boost::extents[y_grid_][x_grid_]);
+  }
 }
 
 NetRouteMap FastRouteCore::getRoutes()
@@ -900,43 +1076,47 @@ void FastRouteCore::updateDbCongestion(int min_routing_layer,
       continue;
     }
 
-    const uint8_t capH = h_capacity_3D_[k];
-    const uint8_t capV = v_capacity_3D_[k];
-    const uint8_t last_row_capH = last_row_h_capacity_3D_[k];
-    const uint8_t last_col_capV = last_col_v_capacity_3D_[k];
+    const uint16_t capH = h_capacity_3D_[k];
+    const uint16_t capV = v_capacity_3D_[k];
+    const uint16_t last_row_capH = last_row_h_capacity_3D_[k];
+    const uint16_t last_col_capV = last_col_v_capacity_3D_[k];
     bool is_horizontal
         = layer_directions_[k] == odb::dbTechLayerDir::HORIZONTAL;
+    // Fill the whole layer and hand it to the grid in one call
+    odb::dbMatrix<odb::dbGCellGrid::GCellData> congestion(x_grid_, y_grid_);
     for (int y = 0; y < y_grid_; y++) {
       for (int x = 0; x < x_grid_; x++) {
+        odb::dbGCellGrid::GCellData& data = congestion(x, y);
         if (is_horizontal) {
           if (!regular_y_ && y == y_grid_ - 1) {
-            db_gcell->setCapacity(layer, x, y, last_row_capH);
+            data.capacity = last_row_capH;
           } else {
-            db_gcell->setCapacity(layer, x, y, capH);
+            data.capacity = capH;
           }
         } else {
           if (!regular_x_ && x == x_grid_ - 1) {
-            db_gcell->setCapacity(layer, x, y, last_col_capV);
+            data.capacity = last_col_capV;
           } else {
-            db_gcell->setCapacity(layer, x, y, capV);
+            data.capacity = capV;
           }
         }
         if (x == x_grid_ - 1 && y == y_grid_ - 1 && x_grid_ > 1
             && y_grid_ > 1) {
-          uint8_t blockageH = h_edges_3D_[k][y][x - 1].red;
-          uint8_t blockageV = v_edges_3D_[k][y - 1][x].red;
-          uint8_t usageH = h_edges_3D_[k][y - 1][x - 1].usage + blockageH;
-          uint8_t usageV = v_edges_3D_[k][y - 1][x - 1].usage + blockageV;
-          db_gcell->setUsage(layer, x, y, usageH + usageV);
+          uint16_t blockageH = h_edges_3D_[k][y][x - 1].red;
+          uint16_t blockageV = v_edges_3D_[k][y - 1][x].red;
+          uint16_t usageH = h_edges_3D_[k][y - 1][x - 1].usage + blockageH;
+          uint16_t usageV = v_edges_3D_[k][y - 1][x - 1].usage + blockageV;
+          data.usage = usageH + usageV;
         } else {
-          uint8_t blockageH = h_edges_3D_[k][y][x].red;
-          uint8_t blockageV = v_edges_3D_[k][y][x].red;
-          uint8_t usageH = h_edges_3D_[k][y][x].usage + blockageH;
-          uint8_t usageV = v_edges_3D_[k][y][x].usage + blockageV;
-          db_gcell->setUsage(layer, x, y, usageH + usageV);
+          uint16_t blockageH = h_edges_3D_[k][y][x].red;
+          uint16_t blockageV = v_edges_3D_[k][y][x].red;
+          uint16_t usageH = h_edges_3D_[k][y][x].usage + blockageH;
+          uint16_t usageV = v_edges_3D_[k][y][x].usage + blockageV;
+          data.usage = usageH + usageV;
         }
       }
     }
+    db_gcell->setLayerCongestionMap(layer, std::move(congestion));
   }
 }
 
@@ -995,6 +1175,8 @@ NetRouteMap FastRouteCore::run()
     return getRoutes();
   }
 
+  h_last_used_ggrid_.insert(h_used_ggrid_.begin(), h_used_ggrid_.end());
+  v_last_used_ggrid_.insert(v_used_ggrid_.begin(), v_used_ggrid_.end());
   v_used_ggrid_.clear();
   h_used_ggrid_.clear();
 
@@ -1014,7 +1196,6 @@ NetRouteMap FastRouteCore::run()
   xcor_.resize(max_degree2);
   ycor_.resize(max_degree2);
   dcor_.resize(max_degree2);
-  net_eo_.reserve(max_degree2);
 
   int THRESH_M = 20;
   const int ENLARGE = 15;  // 5
@@ -1349,6 +1530,12 @@ NetRouteMap FastRouteCore::run()
       break;
     }
 
+    logger_->metricSeries("global_route__iteration",
+                          {{"iteration", i - 1},
+                           {"overflow", total_overflow_},
+                           {"max_overflow", maxOverflow},
+                           {"usage", tUsage}});
+
     if (total_overflow_ > last_total_overflow) {
       overflow_increases++;
     }
@@ -1433,7 +1620,6 @@ NetRouteMap FastRouteCore::run()
   }
 
   NetRouteMap routes = getRoutes();
-  net_eo_.clear();
   net_ids_.clear();
   return routes;
 }
@@ -1443,6 +1629,17 @@ void FastRouteCore::setVerbose(bool v)
   verbose_ = v;
 }
 
+void FastRouteCore::setParallelMaze(bool parallel, int threads)
+{
+  parallel_maze_ = parallel;
+  maze_threads_ = threads;
+}
+
+void FastRouteCore::setLayerAssignmentThreads(int threads)
+{
+  layer_assignment_threads_ = threads;
+}
+
 void FastRouteCore::setCriticalNetsPercentage(float u)
 {
   critical_nets_percentage_ = u;
@@ -36,6 +36,7 @@
 #include "DataType.h"
 #include "FastRoute.h"
 #include "utl/Logger.h"
+#include "utl/exception.h"
 
 namespace grt {
 
@@ -639,6 +640,65 @@ float FastRouteCore::coeffADJ(const int netID)
   return coef;
 }
 
+// Builds the trees of net_ids_ as gen_brk_RSMT does when it is neither
+// congestion driven nor rerouting, which leaves the nets independent so
+// they are built in parallel.
+std::vector<Tree> FastRouteCore::makeNetTrees(const bool noADJ,
+                                              const int flute_accuracy)
+{
+  std::vector<Tree> trees(net_ids_.size());
+
+  // nets with an alpha get their trees from the SteinerTreeBuilder batch
+  std::vector<odb::dbNet*> alpha_nets;
+  std::vector<int> alpha_tree_idx;
+  std::vector<int> pin_x;
+  std::vector<int> pin_y;
+  std::vector<int> pin_offsets = {0};
+  std::vector<int> drvr_indices;
+  std::vector<int> flute_tree_idx;
+  for (int i = 0; i < net_ids_.size(); i++) {
+    FrNet* net = nets_[net_ids_[i]];
+    if (stt_builder_->getAlpha(net->getDbNet()) > 0.0) {
+      alpha_nets.push_back(net->getDbNet());
+      alpha_tree_idx.push_back(i);
+      pin_x.insert(pin_x.end(), net->getPinX().begin(), net->getPinX().end());
+      pin_y.insert(pin_y.end(), net->getPinY().begin(), net->getPinY().end());
+      pin_offsets.push_back(pin_x.size());
+      drvr_indices.push_back(net->getDriverIdx());
+    } else {
+      flute_tree_idx.push_back(i);
+    }
+  }
+
+  std::vector<Tree> alpha_trees = stt_builder_->makeSteinerTrees(
+      alpha_nets, pin_x, pin_y, pin_offsets, drvr_indices, maze_threads_);
+  for (int i = 0; i < alpha_tree_idx.size(); i++) {
+    trees[alpha_tree_idx[i]] = std::move(alpha_trees[i]);
+  }
+
+  // fluteNormal only writes the sorted pins of its own net
+  utl::ThreadException exception;
+#pragma omp parallel for num_threads(maze_threads_) schedule(dynamic, 64)
+  for (int i = 0; i < flute_tree_idx.size(); i++) {  // NOLINT
+    try {
+      const int netID = net_ids_[flute_tree_idx[i]];
+      FrNet* net = nets_[netID];
+      const float coeffV = (noADJ || HTreeSuite(netID)) ? 1.2 : 1.36;
+      fluteNormal(netID,
+                  net->getPinX(),
+                  net->getPinY(),
+                  flute_accuracy,
+                  coeffV,
+                  trees[flute_tree_idx[i]]);
+    } catch (...) {
+      exception.capture();
+    }
+  }
+  exception.rethrow();
+
+  return trees;
+}
+
 void FastRouteCore::gen_brk_RSMT(const bool congestionDriven,
                                  const bool reRoute,
                                  const bool genTree,
@@ -654,7 +714,14 @@ void FastRouteCore::gen_brk_RSMT(const bool congestionDriven,
 
   const int flute_accuracy = 2;
 
-  for (const int& netID : net_ids_) {
+  // without rip-up or congestion the trees only depend on the net pins
+  std::vector<Tree> net_trees;
+  if (!reRoute && !congestionDriven) {
+    net_trees = makeNetTrees(noADJ, flute_accuracy);
+  }
+
+  for (int i = 0; i < net_ids_.size(); i++) {
+    const int netID = net_ids_[i];
     FrNet* net = nets_[netID];
 
     int d = net->getNumPins();
@@ -687,7 +754,9 @@ void FastRouteCore::gen_brk_RSMT(const bool congestionDriven,
     // check net alpha because FastRoute has a special implementation of flute
     // TODO: move this flute implementation to SteinerTreeBuilder
     const float net_alpha = stt_builder_->getAlpha(net->getDbNet());
-    if (net_alpha > 0.0) {
+    if (!net_trees.empty()) {
+      rsmt = std::move(net_trees[i]);
+    } else if (net_alpha > 0.0) {
       rsmt = stt_builder_->makeSteinerTree(
           net->getDbNet(), net->getPinX(), net->getPinY(), net->getDriverIdx());
     } else {
@@ -30,30 +30,21 @@
 // POSSIBILITY OF SUCH DAMAGE.
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <omp.h>
+
 #include <algorithm>
+#include <mutex>
 
 #include "DataType.h"
 #include "FastRoute.h"
 #include "utl/Logger.h"
+#include "utl/exception.h"
 
 namespace grt {
 
 using utl::GRT;
 
-static int parent_index(int i)
-{
-  return (i - 1) / 2;
-}
-
-static int left_index(int i)
-{
-  return 2 * i + 1;
-}
-
-static int right_index(int i)
-{
-  return 2 * i + 2;
-}
+static std::mutex reinit_tree_mutex;
 
 void FastRouteCore::fixEmbeddedTrees()
 {
@@ -501,75 +492,21 @@ void FastRouteCore::convertToMazeroute()
     convertToMazerouteNet(netID);
   }
 
-  for (int i = 0; i < y_grid_; i++) {
-    for (int j = 0; j < x_grid_ - 1; j++) {
-      // Add to keep the usage values of the last incremental routing performed
-      h_edges_[i][j].usage += h_edges_[i][j].est_usage;
-    }
+  // pattern routing only sets est_usage on the used grids
+  for (const auto& [i, j] : h_used_ggrid_) {
+    // Add to keep the usage values of the last incremental routing performed
+    h_edges_[i][j].usage += h_edges_[i][j].est_usage;
   }
 
-  for (int i = 0; i < y_grid_ - 1; i++) {
-    for (int j = 0; j < x_grid_; j++) {
-      // Add to keep the usage values of the last incremental routing performed
-      v_edges_[i][j].usage += v_edges_[i][j].est_usage;
-    }
+  for (const auto& [i, j] : v_used_ggrid_) {
+    // Add to keep the usage values of the last incremental routing performed
+    v_edges_[i][j].usage += v_edges_[i][j].est_usage;
   }
 
   // check 2D edges for invalid usage values
   check2DEdgesUsage();
 }
 
-// non recursive version of heapify
-static void heapify(std::vector<double*>& array)
-{
-  bool stop = false;
-  const int heapSize = array.size();
-  int i = 0;
-
-  double* tmp = array[i];
-  do {
-    const int l = left_index(i);
-    const int r = right_index(i);
-
-    int smallest;
-    if (l < heapSize && *(array[l]) < *tmp) {
-      smallest = l;
-      if (r < heapSize && *(array[r]) < *(array[l]))
-        smallest = r;
-    } else {
-      smallest = i;
-      if (r < heapSize && *(array[r]) < *tmp)
-        smallest = r;
-    }
-    if (smallest != i) {
-      array[i] = array[smallest];
-      i = smallest;
-    } else {
-      array[i] = tmp;
-      stop = true;
-    }
-  } while (!stop);
-}
-
-static void updateHeap(std::vector<double*>& array, int i)
-{
-  double* tmpi = array[i];
-  while (i > 0 && *(array[parent_index(i)]) > *tmpi) {
-    const int parent = parent_index(i);
-    array[i] = array[parent];
-    i = parent;
-  }
-  array[i] = tmpi;
-}
-
-// remove the entry with minimum distance from Priority queue
-static void removeMin(std::vector<double*>& array)
-{
-  array[0] = array.back();
-  heapify(array);
-  array.pop_back();
-}
-
 /*
  * num_iteration : the total number of iterations for maze route to run
  * round : the number of maze route stages runned
@@ -726,12 +663,12 @@ void FastRouteCore::updateCongestionHistory(const int upType,
 // edgeID    - the ID for the tree edge to route
 // d1        - the distance of any grid from the source subtree t1
 // d2        - the distance of any grid from the destination subtree t2
-// src_heap  - the heap storing the addresses for d1
-// dest_heap - the heap storing the addresses for d2
+// src_heap  - the heap of grid indices keyed by d1
+// dest_heap - the grid indices of the destination subtree
 void FastRouteCore::setupHeap(const int netID,
                               const int edgeID,
-                              std::vector<double*>& src_heap,
-                              std::vector<double*>& dest_heap,
+                              IndexedHeap<double>& src_heap,
+                              std::vector<int>& dest_heap,
                               multi_array<double, 2>& d1,
                               multi_array<double, 2>& d2,
                               const int regionX1,
@@ -761,9 +698,9 @@ void FastRouteCore::setupHeap(const int netID,
   if (num_terminals == 2)  // 2-pin net
   {
     d1[y1][x1] = 0;
-    src_heap.push_back(&d1[y1][x1]);
+    src_heap.push(y1 * x_range_ + x1);
     d2[y2][x2] = 0;
-    dest_heap.push_back(&d2[y2][x2]);
+    dest_heap.push_back(y2 * x_range_ + x2);
   } else {  // net with more than 2 pins
     const int numNodes = sttrees_[netID].num_nodes();
 
@@ -777,7 +714,7 @@ void FastRouteCore::setupHeap(const int netID,
 
     // add n1 into src_heap
     d1[y1][x1] = 0;
-    src_heap.push_back(&d1[y1][x1]);
+    src_heap.push(y1 * x_range_ + x1);
     visited[n1] = true;
 
     // add n1 into the queue
@@ -812,7 +749,7 @@ void FastRouteCore::setupHeap(const int netID,
             const int nbrX = nbr_node.x;
             const int nbrY = nbr_node.y;
             d1[nbrY][nbrX] = 0;
-            src_heap.push_back(&d1[nbrY][nbrX]);
+            src_heap.push(nbrY * x_range_ + nbrX);
             corr_edge_[nbrY][nbrX] = edge;
           }
           const Route* route = &(treeedges[edge].route);
@@ -827,7 +764,7 @@ void FastRouteCore::setupHeap(const int netID,
 
             if (in_region_[y_grid][x_grid]) {
               d1[y_grid][x_grid] = 0;
-              src_heap.push_back(&d1[y_grid][x_grid]);
+              src_heap.push(y_grid * x_range_ + x_grid);
               corr_edge_[y_grid][x_grid] = edge;
             }
           }
@@ -847,7 +784,7 @@ void FastRouteCore::setupHeap(const int netID,
 
     // add n2 into dest_heap
     d2[y2][x2] = 0;
-    dest_heap.push_back(&d2[y2][x2]);
+    dest_heap.push_back(y2 * x_range_ + x2);
     visited[n2] = true;
 
     // add n2 into the queue
@@ -882,7 +819,7 @@ void FastRouteCore::setupHeap(const int netID,
             const int nbrX = nbr_node.x;
             const int nbrY = nbr_node.y;
             d2[nbrY][nbrX] = 0;
-            dest_heap.push_back(&d2[nbrY][nbrX]);
+            dest_heap.push_back(nbrY * x_range_ + nbrX);
             corr_edge_[nbrY][nbrX] = edge;
           }
 
@@ -897,7 +834,7 @@ void FastRouteCore::setupHeap(const int netID,
             const int y_grid = route->gridsY[j];
             if (in_region_[y_grid][x_grid]) {
               d2[y_grid][x_grid] = 0;
-              dest_heap.push_back(&d2[y_grid][x_grid]);
+              dest_heap.push_back(y_grid * x_range_ + x_grid);
               corr_edge_[y_grid][x_grid] = edge;
             }
           }
@@ -1246,6 +1183,8 @@ bool FastRouteCore::updateRouteType2(const int net_id,
 
 void FastRouteCore::reInitTree(const int netID)
 {
+  // FLUTE and the used grid sets are shared by the mazeRouteMSMD threads
+  std::lock_guard<std::mutex> lock(reinit_tree_mutex);
   const int numEdges = sttrees_[netID].num_edges();
   for (int edgeID = 0; edgeID < numEdges; edgeID++) {
     TreeEdge* treeedge = &(sttrees_[netID].edges[edgeID]);
@@ -1303,6 +1242,65 @@ float getCost(const int i,
   return cost;
 }
 
+odb::Rect FastRouteCore::getMazeRegion(const int netID, const int expand)
+{
+  const StTree& sttree = sttrees_[netID];
+  odb::Rect region;
+  region.mergeInit();
+  for (const TreeNode& node : sttree.nodes) {
+    region.merge(odb::Rect(node.x, node.y, node.x, node.y));
+  }
+  for (const TreeEdge& edge : sttree.edges) {
+    if (edge.route.type != RouteType::MazeRoute) {
+      continue;
+    }
+    for (int i = 0; i < edge.route.gridsX.size(); i++) {
+      const int x = edge.route.gridsX[i];
+      const int y = edge.route.gridsY[i];
+      region.merge(odb::Rect(x, y, x, y));
+    }
+  }
+  return odb::Rect(std::max(region.xMin() - expand, 0),
+                   std::max(region.yMin() - expand, 0),
+                   std::min(region.xMax() + expand, x_grid_ - 1),
+                   std::min(region.yMax() + expand, y_grid_ - 1));
+}
+
+std::vector<std::vector<int>> FastRouteCore::getRegionWaves(
+    const std::vector<odb::Rect>& regions)
+{
+  // An item goes into the wave after the last wave that used any tile of its
+  // region.
+  const int tile_size = 16;
+  const int x_tiles = (x_grid_ + tile_size - 1) / tile_size;
+  const int y_tiles = (y_grid_ + tile_size - 1) / tile_size;
+  std::vector<int> tile_waves(x_tiles * y_tiles, -1);
+  std::vector<std::vector<int>> waves;
+  for (int item = 0; item < regions.size(); item++) {
+    const odb::Rect& region = regions[item];
+    const int tile_x1 = region.xMin() / tile_size;
+    const int tile_x2 = region.xMax() / tile_size;
+    const int tile_y1 = region.yMin() / tile_size;
+    const int tile_y2 = region.yMax() / tile_size;
+    int wave = 0;
+    for (int y = tile_y1; y <= tile_y2; y++) {
+      for (int x = tile_x1; x <= tile_x2; x++) {
+        wave = std::max(wave, tile_waves[y * x_tiles + x] + 1);
+      }
+    }
+    for (int y = tile_y1; y <= tile_y2; y++) {
+      for (int x = tile_x1; x <= tile_x2; x++) {
+        tile_waves[y * x_tiles + x] = wave;
+      }
+    }
+    if (wave == (int) waves.size()) {
+      waves.emplace_back();
+    }
+    waves[wave].push_back(item);
+  }
+  return waves;
+}
+
 void FastRouteCore::mazeRouteMSMD(const int iter,
                                   const int expand,
                                   const float cost_height,
@@ -1317,8 +1315,6 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
                                   float& slack_th)
 {
   // maze routing for multi-source, multi-destination
-  int tmpX, tmpY;
-
   const int max_usage_multiplier = 40;
 
   // allocate memory for distance and parent and pop_heap
@@ -1346,32 +1342,37 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
     StNetOrder();
   }
 
-  std::vector<double*> src_heap;
-  std::vector<double*> dest_heap;
-  src_heap.reserve(y_grid_ * x_grid_);
-  dest_heap.reserve(y_grid_ * x_grid_);
-
+  // A net only reads and writes the grid inside its bounding box grown by
+  // expand, so nets with disjoint regions can share the grid arrays.
   multi_array<double, 2> d1(boost::extents[y_range_][x_range_]);
   multi_array<double, 2> d2(boost::extents[y_range_][x_range_]);
 
-  std::vector<bool> pop_heap2(y_grid_ * x_range_, false);
+  std::vector<char> pop_heap2(y_grid_ * x_range_, false);
 
-  for (int nidRPC = 0; nidRPC < net_ids_.size(); nidRPC++) {
-    const int netID
-        = ordering ? tree_order_cong_[nidRPC].treeIndex : net_ids_[nidRPC];
+  // Routes the tree edges of a net.  Returns false if the tree had to be
+  // rebuilt, in which case the net must be routed again.  With a
+  // net_region, the search of every edge is clamped to it.
+  auto route_net = [&](const int netID,
+                       const odb::Rect* net_region,
+                       MazeNetState& state,
+                       int& enlarge) {
+    int tmpX, tmpY;
+    IndexedHeap<double>& src_heap = state.src_heap;
+    std::vector<int>& dest_heap = state.dest_heap;
+    std::vector<OrderNetEdge>& net_eo = state.net_eo;
 
     const int num_terminals = sttrees_[netID].num_terminals;
 
     const int origENG = expand;
 
-    netedgeOrderDec(netID);
+    netedgeOrderDec(netID, net_eo);
 
     auto& treeedges = sttrees_[netID].edges;
     auto& treenodes = sttrees_[netID].nodes;
     // loop for all the tree edges
     const int num_edges = sttrees_[netID].num_edges();
     for (int edgeREC = 0; edgeREC < num_edges; edgeREC++) {
-      const int edgeID = net_eo_[edgeREC].edgeID;
+      const int edgeID = net_eo[edgeREC].edgeID;
       TreeEdge* treeedge = &(treeedges[edgeID]);
 
       int n1 = treeedge->n1;
@@ -1409,17 +1410,25 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
       const int xmin = std::min(n1x, n2x);
       const int xmax = std::max(n1x, n2x);
 
-      enlarge_ = std::min(origENG, (iter / 6 + 3) * treeedge->route.routelen);
+      enlarge = std::min(origENG, (iter / 6 + 3) * treeedge->route.routelen);
 
       int decrease = 0;
 
       if (nets_[netID]->isCritical()) {
-        decrease = std::min((iter / 7) * 5, enlarge_ / 2);
+        decrease = std::min((iter / 7) * 5, enlarge / 2);
+      }
+      int regionX1 = std::max(xmin - enlarge + decrease, 0);
+      int regionX2 = std::min(xmax + enlarge - decrease, x_grid_ - 1);
+      int regionY1 = std::max(ymin - enlarge + decrease, 0);
+      int regionY2 = std::min(ymax + enlarge - decrease, y_grid_ - 1);
+      if (net_region != nullptr) {
+        // The edge end points only move along paths routed inside the net
+        // region, so they stay inside it and so does the clamped search.
+        regionX1 = std::max(regionX1, net_region->xMin());
+        regionX2 = std::min(regionX2, net_region->xMax());
+        regionY1 = std::max(regionY1, net_region->yMin());
+        regionY2 = std::min(regionY2, net_region->yMax());
       }
-      const int regionX1 = std::max(xmin - enlarge_ + decrease, 0);
-      const int regionX2 = std::min(xmax + enlarge_ - decrease, x_grid_ - 1);
-      const int regionY1 = std::max(ymin - enlarge_ + decrease, 0);
-      const int regionY2 = std::min(ymax + enlarge_ - decrease, y_grid_ - 1);
 
       // initialize d1[][] and d2[][] as BIG_INT
       for (int i = regionY1; i <= regionY2; i++) {
@@ -1445,9 +1454,9 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
                 regionY2);
 
       // while loop to find shortest path
-      int ind1 = (src_heap[0] - &d1[0][0]);
+      int ind1 = src_heap.top();
       for (int i = 0; i < dest_heap.size(); i++)
-        pop_heap2[(dest_heap[i] - &d2[0][0])] = true;
+        pop_heap2[dest_heap[i]] = true;
 
       // stop when the grid position been popped out from both src_heap and
       // dest_heap
@@ -1470,7 +1479,7 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
           preY = curY;
         }
 
-        removeMin(src_heap);
+        src_heap.pop();
 
         // left
         if (curX > regionX1) {
@@ -1518,8 +1527,7 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
             parent_x3_[curY][tmpX] = curX;
             parent_y3_[curY][tmpX] = curY;
             hv_[curY][tmpX] = false;
-            src_heap.push_back(&d1[curY][tmpX]);
-            updateHeap(src_heap, src_heap.size() - 1);
+            src_heap.push(curY * x_range_ + tmpX);
           } else if (d1[curY][tmpX] > tmp)  // left neighbor been put into
                                             // src_heap but needs update
           {
@@ -1527,11 +1535,9 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
             parent_x3_[curY][tmpX] = curX;
             parent_y3_[curY][tmpX] = curY;
             hv_[curY][tmpX] = false;
-            double* dtmp = &d1[curY][tmpX];
-            const auto it = std::find(src_heap.begin(), src_heap.end(), dtmp);
-            if (it != src_heap.end()) {
-              const int pos = it - src_heap.begin();
-              updateHeap(src_heap, pos);
+            const int index = curY * x_range_ + tmpX;
+            if (src_heap.contains(index)) {
+              src_heap.decrease(index);
             } else {
               logger_->error(
                   GRT,
@@ -1586,8 +1592,7 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
             parent_x3_[curY][tmpX] = curX;
             parent_y3_[curY][tmpX] = curY;
             hv_[curY][tmpX] = false;
-            src_heap.push_back(&d1[curY][tmpX]);
-            updateHeap(src_heap, src_heap.size() - 1);
+            src_heap.push(curY * x_range_ + tmpX);
           } else if (d1[curY][tmpX] > tmp)  // right neighbor been put into
                                             // src_heap but needs update
           {
@@ -1595,11 +1600,9 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
             parent_x3_[curY][tmpX] = curX;
             parent_y3_[curY][tmpX] = curY;
             hv_[curY][tmpX] = false;
-            double* dtmp = &d1[curY][tmpX];
-            const auto it = std::find(src_heap.begin(), src_heap.end(), dtmp);
-            if (it != src_heap.end()) {
-              const int pos = it - src_heap.begin();
-              updateHeap(src_heap, pos);
+            const int index = curY * x_range_ + tmpX;
+            if (src_heap.contains(index)) {
+              src_heap.decrease(index);
             } else {
               logger_->error(
                   GRT,
@@ -1653,8 +1656,7 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
             parent_x1_[tmpY][curX] = curX;
             parent_y1_[tmpY][curX] = curY;
             hv_[tmpY][curX] = true;
-            src_heap.push_back(&d1[tmpY][curX]);
-            updateHeap(src_heap, src_heap.size() - 1);
+            src_heap.push(tmpY * x_range_ + curX);
           } else if (d1[tmpY][curX] > tmp)  // bottom neighbor been put into
                                             // src_heap but needs update
           {
@@ -1662,11 +1664,9 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
             parent_x1_[tmpY][curX] = curX;
             parent_y1_[tmpY][curX] = curY;
             hv_[tmpY][curX] = true;
-            double* dtmp = &d1[tmpY][curX];
-            const auto it = std::find(src_heap.begin(), src_heap.end(), dtmp);
-            if (it != src_heap.end()) {
-              const int pos = it - src_heap.begin();
-              updateHeap(src_heap, pos);
+            const int index = tmpY * x_range_ + curX;
+            if (src_heap.contains(index)) {
+              src_heap.decrease(index);
             } else {
               logger_->error(
                   GRT,
@@ -1721,8 +1721,7 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
             parent_x1_[tmpY][curX] = curX;
             parent_y1_[tmpY][curX] = curY;
             hv_[tmpY][curX] = true;
-            src_heap.push_back(&d1[tmpY][curX]);
-            updateHeap(src_heap, src_heap.size() - 1);
+            src_heap.push(tmpY * x_range_ + curX);
           } else if (d1[tmpY][curX] > tmp)  // top neighbor been put into
                                             // src_heap but needs update
           {
@@ -1730,11 +1729,9 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
             parent_x1_[tmpY][curX] = curX;
             parent_y1_[tmpY][curX] = curY;
             hv_[tmpY][curX] = true;
-            double* dtmp = &d1[tmpY][curX];
-            const auto it = std::find(src_heap.begin(), src_heap.end(), dtmp);
-            if (it != src_heap.end()) {
-              const int pos = it - src_heap.begin();
-              updateHeap(src_heap, pos);
+            const int index = tmpY * x_range_ + curX;
+            if (src_heap.contains(index)) {
+              src_heap.decrease(index);
             } else {
               logger_->error(
                   GRT,
@@ -1746,12 +1743,12 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
         }
 
         // update ind1 for next loop
-        ind1 = (src_heap[0] - &d1[0][0]);
+        ind1 = src_heap.top();
 
       }  // while loop
 
       for (int i = 0; i < dest_heap.size(); i++)
-        pop_heap2[(dest_heap[i] - &d2[0][0])] = false;
+        pop_heap2[dest_heap[i]] = false;
 
       const int crossX = ind1 % x_range_;
       const int crossY = ind1 / x_range_;
@@ -1868,8 +1865,7 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
                              "Net {} has errors during updateRouteType1.",
                              nets_[netID]->getName());
             reInitTree(netID);
-            nidRPC--;
-            break;
+            return false;
           }
           // update position for n1
           treenodes[n1].x = E1x;
@@ -1903,8 +1899,7 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
                        "Net {} has errors during updateRouteType2.",
                        nets_[netID]->getName());
             reInitTree(netID);
-            nidRPC--;
-            break;
+            return false;
           }
           // update position for n1
           treenodes[n1].x = E1x;
@@ -2025,8 +2020,7 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
                        "Net {} has errors during updateRouteType1.",
                        nets_[netID]->getName());
             reInitTree(netID);
-            nidRPC--;
-            break;
+            return false;
           }
 
           // update position for n2
@@ -2061,8 +2055,7 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
                        "Net {} has errors during updateRouteType2.",
                        nets_[netID]->getName());
             reInitTree(netID);
-            nidRPC--;
-            break;
+            return false;
           }
           // update position for n2
           treenodes[n2].x = E2x;
@@ -2145,16 +2138,75 @@ void FastRouteCore::mazeRouteMSMD(const int iter,
         {
           const int min_y = std::min(gridsY[i], gridsY[i + 1]);
           v_edges_[min_y][gridsX[i]].usage += edgeCost;
-          v_used_ggrid_.insert(std::make_pair(min_y, gridsX[i]));
+          state.v_used_ggrid.insert(std::make_pair(min_y, gridsX[i]));
         } else  /// if(gridsY[i]==gridsY[i+1])// a horizontal edge
         {
           const int min_x = std::min(gridsX[i], gridsX[i + 1]);
           h_edges_[gridsY[i]][min_x].usage += edgeCost;
-          h_used_ggrid_.insert(std::make_pair(gridsY[i], min_x));
+          state.h_used_ggrid.insert(std::make_pair(gridsY[i], min_x));
         }
       }
     }  // loop edgeID
-  }    // loop netID
+    return true;
+  };
+
+  std::vector<int> net_enlarge(net_ids_.size(), -1);
+  auto get_net_id = [&](const int nidRPC) {
+    return ordering ? tree_order_cong_[nidRPC].treeIndex : net_ids_[nidRPC];
+  };
+  std::vector<MazeNetState> states(std::max(maze_threads_, 1));
+  for (MazeNetState& state : states) {
+    state.src_heap.init(&d1[0][0], d1.num_elements());
+  }
+  if (!parallel_maze_) {
+    for (int nidRPC = 0; nidRPC < net_ids_.size(); nidRPC++) {
+      while (!route_net(
+          get_net_id(nidRPC), nullptr, states[0], net_enlarge[nidRPC])) {
+      }
+    }
+  } else {
+    // Nets whose regions overlap are routed in their original order.  The
+    // edge searches of a net are clamped to its region, so nets of the same
+    // wave never touch the same part of the grid and the result is the same
+    // for any number of threads, including one.
+    std::vector<odb::Rect> regions;
+    regions.reserve(net_ids_.size());
+    for (int nidRPC = 0; nidRPC < net_ids_.size(); nidRPC++) {
+      regions.push_back(getMazeRegion(get_net_id(nidRPC), expand));
+    }
+    const std::vector<std::vector<int>> waves = getRegionWaves(regions);
+
+    utl::ThreadException exception;
+    for (const std::vector<int>& wave : waves) {
+#pragma omp parallel for num_threads(maze_threads_) schedule(dynamic)
+      for (int i = 0; i < (int) wave.size(); i++) {  // NOLINT
+        try {
+          const int nidRPC = wave[i];
+          MazeNetState& state = states[omp_get_thread_num()];
+          while (!route_net(get_net_id(nidRPC),
+                            &regions[nidRPC],
+                            state,
+                            net_enlarge[nidRPC])) {
+          }
+        } catch (...) {
+          exception.capture();
+        }
+      }
+      exception.rethrow();
+    }
+  }
+
+  for (const MazeNetState& state : states) {
+    h_used_ggrid_.insert(state.h_used_ggrid.begin(), state.h_used_ggrid.end());
+    v_used_ggrid_.insert(state.v_used_ggrid.begin(), state.v_used_ggrid.end());
+  }
+  // enlarge_ is left with the value of the last routed edge
+  for (int nidRPC = net_ids_.size() - 1; nidRPC >= 0; nidRPC--) {
+    if (net_enlarge[nidRPC] >= 0) {
+      enlarge_ = net_enlarge[nidRPC];
+      break;
+    }
+  }
 
   h_cost_table_.clear();
   v_cost_table_.clear();
@@ -2513,77 +2565,66 @@ int FastRouteCore::getOverflow3D()
 
 void FastRouteCore::InitEstUsage()
 {
-  for (int i = 0; i < y_grid_; i++) {
-    for (int j = 0; j < x_grid_ - 1; j++) {
-      h_edges_[i][j].est_usage = 0;
-    }
+  for (const auto& [i, j] : h_used_ggrid_) {
+    h_edges_[i][j].est_usage = 0;
   }
 
-  for (int i = 0; i < y_grid_ - 1; i++) {
-    for (int j = 0; j < x_grid_; j++) {
-      v_edges_[i][j].est_usage = 0;
-    }
+  for (const auto& [i, j] : v_used_ggrid_) {
+    v_edges_[i][j].est_usage = 0;
   }
 }
 
 void FastRouteCore::str_accu(const int rnd)
 {
-  for (int i = 0; i < y_grid_; i++) {
-    for (int j = 0; j < x_grid_ - 1; j++) {
-      const int overflow = h_edges_[i][j].usage - h_edges_[i][j].cap;
-      if (overflow > 0 || h_edges_[i][j].congCNT > rnd) {
-        h_edges_[i][j].last_usage += h_edges_[i][j].congCNT * overflow / 2;
-      }
+  // edges outside the used grids have no congestion count
+  for (const auto& [i, j] : h_used_ggrid_) {
+    const int overflow = h_edges_[i][j].usage - h_edges_[i][j].cap;
+    if (overflow > 0 || h_edges_[i][j].congCNT > rnd) {
+      h_edges_[i][j].last_usage += h_edges_[i][j].congCNT * overflow / 2;
     }
   }
 
-  for (int i = 0; i < y_grid_ - 1; i++) {
-    for (int j = 0; j < x_grid_; j++) {
-      const int overflow = v_edges_[i][j].usage - v_edges_[i][j].cap;
-      if (overflow > 0 || v_edges_[i][j].congCNT > rnd) {
-        v_edges_[i][j].last_usage += v_edges_[i][j].congCNT * overflow / 2;
-      }
+  for (const auto& [i, j] : v_used_ggrid_) {
+    const int overflow = v_edges_[i][j].usage - v_edges_[i][j].cap;
+    if (overflow > 0 || v_edges_[i][j].congCNT > rnd) {
+      v_edges_[i][j].last_usage += v_edges_[i][j].congCNT * overflow / 2;
     }
   }
 }
 
 void FastRouteCore::InitLastUsage(const int upType)
 {
-  for (int i = 0; i < y_grid_; i++) {
-    for (int j = 0; j < x_grid_ - 1; j++) {
-      h_edges_[i][j].last_usage = 0;
+  // clear the history left by earlier runs
+  for (const auto& [i, j] : h_last_used_ggrid_) {
+    h_edges_[i][j].last_usage = 0;
+    if (upType == 1) {
+      h_edges_[i][j].congCNT = 0;
     }
   }
 
-  for (int i = 0; i < y_grid_ - 1; i++) {
-    for (int j = 0; j < x_grid_; j++) {
-      v_edges_[i][j].last_usage = 0;
+  for (const auto& [i, j] : v_last_used_ggrid_) {
+    v_edges_[i][j].last_usage = 0;
+    if (upType == 1) {
+      v_edges_[i][j].congCNT = 0;
     }
   }
 
   if (upType == 1) {
-    for (int i = 0; i < y_grid_; i++) {
-      for (int j = 0; j < x_grid_ - 1; j++) {
-        h_edges_[i][j].congCNT = 0;
-      }
-    }
+    h_last_used_ggrid_.clear();
+    v_last_used_ggrid_.clear();
+  }
 
-    for (int i = 0; i < y_grid_ - 1; i++) {
-      for (int j = 0; j < x_grid_; j++) {
-        v_edges_[i][j].congCNT = 0;
-      }
-    }
-  } else if (upType == 2) {
-    for (int i = 0; i < y_grid_; i++) {
-      for (int j = 0; j < x_grid_ - 1; j++) {
-        h_edges_[i][j].last_usage = h_edges_[i][j].last_usage * 0.2;
-      }
+  for (const auto& [i, j] : h_used_ggrid_) {
+    h_edges_[i][j].last_usage = 0;
+    if (upType == 1) {
+      h_edges_[i][j].congCNT = 0;
     }
+  }
 
-    for (int i = 0; i < y_grid_ - 1; i++) {
-      for (int j = 0; j < x_grid_; j++) {
-        v_edges_[i][j].last_usage = v_edges_[i][j].last_usage * 0.2;
-      }
+  for (const auto& [i, j] : v_used_ggrid_) {
+    v_edges_[i][j].last_usage = 0;
+    if (upType == 1) {
+      v_edges_[i][j].congCNT = 0;
     }
   }
 }
@@ -41,76 +41,10 @@ namespace grt {
 
 using utl::GRT;
 
-static int parent_index(int i)
-{
-  return (i - 1) / 2;
-}
-
-static int left_index(int i)
-{
-  return 2 * i + 1;
-}
-
-static int right_index(int i)
-{
-  return 2 * i + 2;
-}
-
-// non recursive version of heapify-
-static void heapify3D(std::vector<int*>& array)
-{
-  bool stop = false;
-  const int heapSize = array.size();
-  int i = 0;
-
-  int* tmp = array[i];
-  do {
-    const int l = left_index(i);
-    const int r = right_index(i);
-
-    int smallest;
-    if (l < heapSize && *(array[l]) < *tmp) {
-      smallest = l;
-      if (r < heapSize && *(array[r]) < *(array[l]))
-        smallest = r;
-    } else {
-      smallest = i;
-      if (r < heapSize && *(array[r]) < *tmp)
-        smallest = r;
-    }
-    if (smallest != i) {
-      array[i] = array[smallest];
-      i = smallest;
-    } else {
-      array[i] = tmp;
-      stop = true;
-    }
-  } while (!stop);
-}
-
-static void updateHeap3D(std::vector<int*>& array, int i)
-{
-  int* tmpi = array[i];
-  while (i > 0 && *(array[parent_index(i)]) > *tmpi) {
-    const int parent = parent_index(i);
-    array[i] = array[parent];
-    i = parent;
-  }
-  array[i] = tmpi;
-}
-
-// extract the entry with minimum distance from Priority queue
-static void removeMin3D(std::vector<int*>& array)
-{
-  array[0] = array.back();
-  heapify3D(array);
-  array.pop_back();
-}
-
 void FastRouteCore::addNeighborPoints(const int netID,
                                       const int n1,
                                       const int n2,
-                                      std::vector<int*>& points_heap_3D,
+                                      std::vector<int>& points_3D,
                                       multi_array<int, 3>& dist_3D,
                                       multi_array<Direction, 3>& directions_3D,
                                       multi_array<int, 3>& corr_edge_3D)
@@ -134,7 +68,7 @@ void FastRouteCore::addNeighborPoints(const int netID,
   for (int l = treenodes[nt].botL; l <= treenodes[nt].topL; l++) {
     dist_3D[l][y1][x1] = 0;
     directions_3D[l][y1][x1] = Direction::Origin;
-    points_heap_3D.push_back(&dist_3D[l][y1][x1]);
+    points_3D.push_back(&dist_3D[l][y1][x1] - dist_3D.data());
     heapVisited[n1] = true;
   }
 
@@ -159,10 +93,10 @@ void FastRouteCore::addNeighborPoints(const int netID,
         continue;
       }
       // put all the grids of the adjacent tree edges into
-      // points_heap_3D
+      // points_3D
       if (treeedges[edge].route.routelen > 0) {
         // not a degraded edge
-        // put nbr into points_heap_3D if in enlarged region
+        // put nbr into points_3D if in enlarged region
         if (in_region_[treenodes[nbr].y][treenodes[nbr].x]) {
           const int nbrX = treenodes[nbr].x;
           const int nbrY = treenodes[nbr].y;
@@ -170,7 +104,7 @@ void FastRouteCore::addNeighborPoints(const int netID,
           for (int l = treenodes[nt].botL; l <= treenodes[nt].topL; l++) {
             dist_3D[l][nbrY][nbrX] = 0;
             directions_3D[l][nbrY][nbrX] = Direction::Origin;
-            points_heap_3D.push_back(&dist_3D[l][nbrY][nbrX]);
+            points_3D.push_back(&dist_3D[l][nbrY][nbrX] - dist_3D.data());
             corr_edge_3D[l][nbrY][nbrX] = edge;
           }
         }
@@ -180,14 +114,15 @@ void FastRouteCore::addNeighborPoints(const int netID,
         const Route* route = &(treeedges[edge].route);
         if (route->type == RouteType::MazeRoute) {
           for (int j = 1; j < route->routelen; j++) {
-            // don't put edge_n1 and edge_n2 into points_heap_3D
+            // don't put edge_n1 and edge_n2 into points_3D
             const int x_grid = route->gridsX[j];
             const int y_grid = route->gridsY[j];
             const int l_grid = route->gridsL[j];
 
             if (in_region_[y_grid][x_grid]) {
               dist_3D[l_grid][y_grid][x_grid] = 0;
-              points_heap_3D.push_back(&dist_3D[l_grid][y_grid][x_grid]);
+              points_3D.push_back(&dist_3D[l_grid][y_grid][x_grid]
+                  - dist_3D.data());
               directions_3D[l_grid][y_grid][x_grid] = Direction::Origin;
               corr_edge_3D[l_grid][y_grid][x_grid] = edge;
             }
@@ -206,8 +141,8 @@ void FastRouteCore::addNeighborPoints(const int netID,
 
 void FastRouteCore::setupHeap3D(int netID,
                                 int edgeID,
-                                std::vector<int*>& src_heap_3D,
-                                std::vector<int*>& dest_heap_3D,
+                                IndexedHeap<int>& src_heap_3D,
+                                std::vector<int>& dest_heap_3D,
                                 multi_array<Direction, 3>& directions_3D,
                                 multi_array<int, 3>& corr_edge_3D,
                                 multi_array<int, 3>& d1_3D,
@@ -240,10 +175,11 @@ void FastRouteCore::setupHeap3D(int netID,
 
     d1_3D[node1_access_layer][y1][x1] = 0;
     directions_3D[node1_access_layer][y1][x1] = Direction::Origin;
-    src_heap_3D.push_back(&d1_3D[node1_access_layer][y1][x1]);
+    src_heap_3D.push(&d1_3D[node1_access_layer][y1][x1] - d1_3D.data());
     d2_3D[node2_access_layer][y2][x2] = 0;
     directions_3D[node2_access_layer][y2][x2] = Direction::Origin;
-    dest_heap_3D.push_back(&d2_3D[node2_access_layer][y2][x2]);
+    dest_heap_3D.push_back(&d2_3D[node2_access_layer][y2][x2]
+                           - d2_3D.data());
   } else {  // net with more than 2 pins
     for (int i = regionY1; i <= regionY2; i++) {
       for (int j = regionX1; j <= regionX2; j++) {
@@ -252,8 +188,12 @@ void FastRouteCore::setupHeap3D(int netID,
     }
     // find all the grids on tree edges in subtree t1 (connecting to n1) and put
     // them into src_heap_3D
+    std::vector<int> src_points_3D;
     addNeighborPoints(
-        netID, n1, n2, src_heap_3D, d1_3D, directions_3D, corr_edge_3D);
+        netID, n1, n2, src_points_3D, d1_3D, directions_3D, corr_edge_3D);
+    for (const int index : src_points_3D) {
+      src_heap_3D.push(index);
+    }
 
     // find all the grids on tree edges in subtree t2 (connecting
     // to n2) and put them into dest_heap_3D
@@ -862,10 +802,10 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                   regionY2);
 
       // while loop to find shortest path
-      int ind1 = (src_heap_3D_[0] - &d1_3D_[0][0][0]);
+      int ind1 = src_heap_3D_.top();
 
       for (auto& i : dest_heap_3D_) {
-        pop_heap2_3D_[i - &d2_3D_[0][0][0]] = true;
+        pop_heap2_3D_[i] = true;
       }
 
       while (pop_heap2_3D_[ind1]
@@ -878,7 +818,7 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
         const int remd = ind1 % (grid_hv_);
         const int curX = remd % x_range_;
         const int curY = remd / x_range_;
-        removeMin3D(src_heap_3D_);
+        src_heap_3D_.pop();
 
         const bool Horizontal
             = layer_directions_[curL] == odb::dbTechLayerDir::HORIZONTAL;
@@ -902,8 +842,7 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                 pr_3D_[curL][curY][tmpX].x = curX;
                 pr_3D_[curL][curY][tmpX].y = curY;
                 directions_3D_[curL][curY][tmpX] = Direction::West;
-                src_heap_3D_.push_back(&d1_3D_[curL][curY][tmpX]);
-                updateHeap3D(src_heap_3D_, src_heap_3D_.size() - 1);
+                src_heap_3D_.push(&d1_3D_[curL][curY][tmpX] - d1_3D_.data());
               } else if (d1_3D_[curL][curY][tmpX]
                          > tmp)  // left neighbor been put into src_heap_3D
                                  // but needs update
@@ -913,12 +852,9 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                 pr_3D_[curL][curY][tmpX].x = curX;
                 pr_3D_[curL][curY][tmpX].y = curY;
                 directions_3D_[curL][curY][tmpX] = Direction::West;
-                const int* dtmp = &d1_3D_[curL][curY][tmpX];
-                const auto it
-                    = std::find(src_heap_3D_.begin(), src_heap_3D_.end(), dtmp);
-                if (it != src_heap_3D_.end()) {
-                  const int pos = it - src_heap_3D_.begin();
-                  updateHeap3D(src_heap_3D_, pos);
+                const int index = &d1_3D_[curL][curY][tmpX] - d1_3D_.data();
+                if (src_heap_3D_.contains(index)) {
+                  src_heap_3D_.decrease(index);
                 } else {
                   logger_->error(GRT,
                                  601,
@@ -947,8 +883,7 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                 pr_3D_[curL][curY][tmpX].x = curX;
                 pr_3D_[curL][curY][tmpX].y = curY;
                 directions_3D_[curL][curY][tmpX] = Direction::East;
-                src_heap_3D_.push_back(&d1_3D_[curL][curY][tmpX]);
-                updateHeap3D(src_heap_3D_, src_heap_3D_.size() - 1);
+                src_heap_3D_.push(&d1_3D_[curL][curY][tmpX] - d1_3D_.data());
               } else if (d1_3D_[curL][curY][tmpX]
                          > tmp)  // right neighbor been put into src_heap_3D
                                  // but needs update
@@ -958,12 +893,9 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                 pr_3D_[curL][curY][tmpX].x = curX;
                 pr_3D_[curL][curY][tmpX].y = curY;
                 directions_3D_[curL][curY][tmpX] = Direction::East;
-                const int* dtmp = &d1_3D_[curL][curY][tmpX];
-                const auto it
-                    = std::find(src_heap_3D_.begin(), src_heap_3D_.end(), dtmp);
-                if (it != src_heap_3D_.end()) {
-                  const int pos = it - src_heap_3D_.begin();
-                  updateHeap3D(src_heap_3D_, pos);
+                const int index = &d1_3D_[curL][curY][tmpX] - d1_3D_.data();
+                if (src_heap_3D_.contains(index)) {
+                  src_heap_3D_.decrease(index);
                 } else {
                   logger_->error(GRT,
                                  602,
@@ -992,8 +924,7 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                 pr_3D_[curL][tmpY][curX].x = curX;
                 pr_3D_[curL][tmpY][curX].y = curY;
                 directions_3D_[curL][tmpY][curX] = Direction::North;
-                src_heap_3D_.push_back(&d1_3D_[curL][tmpY][curX]);
-                updateHeap3D(src_heap_3D_, src_heap_3D_.size() - 1);
+                src_heap_3D_.push(&d1_3D_[curL][tmpY][curX] - d1_3D_.data());
               } else if (d1_3D_[curL][tmpY][curX]
                          > tmp)  // bottom neighbor been put into
                                  // src_heap_3D but needs update
@@ -1003,12 +934,9 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                 pr_3D_[curL][tmpY][curX].x = curX;
                 pr_3D_[curL][tmpY][curX].y = curY;
                 directions_3D_[curL][tmpY][curX] = Direction::North;
-                const int* dtmp = &d1_3D_[curL][tmpY][curX];
-                const auto it
-                    = std::find(src_heap_3D_.begin(), src_heap_3D_.end(), dtmp);
-                if (it != src_heap_3D_.end()) {
-                  const int pos = it - src_heap_3D_.begin();
-                  updateHeap3D(src_heap_3D_, pos);
+                const int index = &d1_3D_[curL][tmpY][curX] - d1_3D_.data();
+                if (src_heap_3D_.contains(index)) {
+                  src_heap_3D_.decrease(index);
                 } else {
                   logger_->error(GRT,
                                  603,
@@ -1035,8 +963,7 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                 pr_3D_[curL][tmpY][curX].x = curX;
                 pr_3D_[curL][tmpY][curX].y = curY;
                 directions_3D_[curL][tmpY][curX] = Direction::South;
-                src_heap_3D_.push_back(&d1_3D_[curL][tmpY][curX]);
-                updateHeap3D(src_heap_3D_, src_heap_3D_.size() - 1);
+                src_heap_3D_.push(&d1_3D_[curL][tmpY][curX] - d1_3D_.data());
               } else if (d1_3D_[curL][tmpY][curX]
                          > tmp)  // top neighbor been put into src_heap_3D
                                  // but needs update
@@ -1046,12 +973,9 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                 pr_3D_[curL][tmpY][curX].x = curX;
                 pr_3D_[curL][tmpY][curX].y = curY;
                 directions_3D_[curL][tmpY][curX] = Direction::South;
-                const int* dtmp = &d1_3D_[curL][tmpY][curX];
-                const auto it
-                    = std::find(src_heap_3D_.begin(), src_heap_3D_.end(), dtmp);
-                if (it != src_heap_3D_.end()) {
-                  const int pos = it - src_heap_3D_.begin();
-                  updateHeap3D(src_heap_3D_, pos);
+                const int index = &d1_3D_[curL][tmpY][curX] - d1_3D_.data();
+                if (src_heap_3D_.contains(index)) {
+                  src_heap_3D_.decrease(index);
                 } else {
                   logger_->error(GRT,
                                  604,
@@ -1077,8 +1001,7 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
             pr_3D_[tmpL][curY][curX].x = curX;
             pr_3D_[tmpL][curY][curX].y = curY;
             directions_3D_[tmpL][curY][curX] = Direction::Down;
-            src_heap_3D_.push_back(&d1_3D_[tmpL][curY][curX]);
-            updateHeap3D(src_heap_3D_, src_heap_3D_.size() - 1);
+            src_heap_3D_.push(&d1_3D_[tmpL][curY][curX] - d1_3D_.data());
           } else if (d1_3D_[tmpL][curY][curX]
                      > tmp)  // bottom neighbor been put into src_heap_3D
                              // but needs update
@@ -1088,12 +1011,9 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
             pr_3D_[tmpL][curY][curX].x = curX;
             pr_3D_[tmpL][curY][curX].y = curY;
             directions_3D_[tmpL][curY][curX] = Direction::Down;
-            const int* dtmp = &d1_3D_[tmpL][curY][curX];
-            const auto it
-                = std::find(src_heap_3D_.begin(), src_heap_3D_.end(), dtmp);
-            if (it != src_heap_3D_.end()) {
-              const int pos = it - src_heap_3D_.begin();
-              updateHeap3D(src_heap_3D_, pos);
+            const int index = &d1_3D_[tmpL][curY][curX] - d1_3D_.data();
+            if (src_heap_3D_.contains(index)) {
+              src_heap_3D_.decrease(index);
             } else {
               logger_->error(
                   GRT,
@@ -1117,8 +1037,7 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
             pr_3D_[tmpL][curY][curX].x = curX;
             pr_3D_[tmpL][curY][curX].y = curY;
             directions_3D_[tmpL][curY][curX] = Direction::Up;
-            src_heap_3D_.push_back(&d1_3D_[tmpL][curY][curX]);
-            updateHeap3D(src_heap_3D_, src_heap_3D_.size() - 1);
+            src_heap_3D_.push(&d1_3D_[tmpL][curY][curX] - d1_3D_.data());
           } else if (d1_3D_[tmpL][curY][curX]
                      > tmp)  // bottom neighbor been put into src_heap_3D
                              // but needs update
@@ -1128,12 +1047,9 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
             pr_3D_[tmpL][curY][curX].x = curX;
             pr_3D_[tmpL][curY][curX].y = curY;
             directions_3D_[tmpL][curY][curX] = Direction::Up;
-            const int* dtmp = &d1_3D_[tmpL][curY][curX];
-            const auto it
-                = std::find(src_heap_3D_.begin(), src_heap_3D_.end(), dtmp);
-            if (it != src_heap_3D_.end()) {
-              const int pos = it - src_heap_3D_.begin();
-              updateHeap3D(src_heap_3D_, pos);
+            const int index = &d1_3D_[tmpL][curY][curX] - d1_3D_.data();
+            if (src_heap_3D_.contains(index)) {
+              src_heap_3D_.decrease(index);
             } else {
               logger_->error(
                   GRT,
@@ -1151,11 +1067,11 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                          nets_[netID]->getName());
         }
         // update ind1 for next loop
-        ind1 = (src_heap_3D_[0] - &d1_3D_[0][0][0]);
+        ind1 = src_heap_3D_.top();
       }  // while loop
 
       for (auto& i : dest_heap_3D_) {
-        pop_heap2_3D_[i - &d2_3D_[0][0][0]] = false;
+        pop_heap2_3D_[i] = false;
       }
       // get the new route for the edge and store it in gridsX[] and
       // gridsY[] temporarily
@@ -30,6 +30,8 @@
 // POSSIBILITY OF SUCH DAMAGE.
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <omp.h>
+
 #include <algorithm>
 #include <fstream>
 #include <queue>
@@ -38,6 +40,7 @@
 #include "FastRoute.h"
 #include "odb/db.h"
 #include "utl/Logger.h"
+#include "utl/exception.h"
 
 namespace grt {
 
@@ -133,19 +136,19 @@ void FastRouteCore::ConvertToFull3DType2()
   }
 }
 
-static bool comparePVMINX(const OrderNetPin& a, const OrderNetPin& b)
+// Same order as stable sorting by minX and then by npv
+static bool comparePV(const OrderNetPin& a, const OrderNetPin& b)
 {
+  if (a.npv != b.npv) {
+    return a.npv < b.npv;
+  }
   return a.minX < b.minX;
 }
 
-static bool comparePVPV(const OrderNetPin& a, const OrderNetPin& b)
-{
-  return a.npv < b.npv;
-}
-
 void FastRouteCore::netpinOrderInc()
 {
   tree_order_pv_.clear();
+  tree_order_pv_.reserve(net_ids_.size());
 
   for (const int& netID : net_ids_) {
     int xmin = BIG_INT;
@@ -165,8 +168,7 @@ void FastRouteCore::netpinOrderInc()
     tree_order_pv_.push_back({netID, xmin, npvalue});
   }
 
-  std::stable_sort(tree_order_pv_.begin(), tree_order_pv_.end(), comparePVMINX);
-  std::stable_sort(tree_order_pv_.begin(), tree_order_pv_.end(), comparePVPV);
+  std::stable_sort(tree_order_pv_.begin(), tree_order_pv_.end(), comparePV);
 }
 
 void FastRouteCore::fillVIA()
@@ -417,7 +419,7 @@ int FastRouteCore::threeDVIA()
 }
 
 void FastRouteCore::fixEdgeAssignment(int& net_layer,
-                                      multi_array<Edge3D, 3>& edges_3D,
+                                      TiledGrid3D<Edge3D>& edges_3D,
                                       int x,
                                       int y,
                                       int k,
@@ -832,20 +834,12 @@ void FastRouteCore::assignEdge(int netID, int edgeID, bool processDIR)
 
 void FastRouteCore::layerAssignmentV4()
 {
-  int i, k, edgeID, nodeID, routeLen;
-  int n1, n2, connectionCNT;
-
-  int n1a, n2a;
-  std::queue<int> edgeQueue;
-
-  TreeEdge* treeedge;
-
   for (const int& netID : net_ids_) {
     auto& treeedges = sttrees_[netID].edges;
-    for (edgeID = 0; edgeID < sttrees_[netID].num_edges(); edgeID++) {
-      treeedge = &(treeedges[edgeID]);
+    for (int edgeID = 0; edgeID < sttrees_[netID].num_edges(); edgeID++) {
+      TreeEdge* treeedge = &(treeedges[edgeID]);
       if (treeedge->len > 0) {
-        routeLen = treeedge->route.routelen;
+        const int routeLen = treeedge->route.routelen;
         treeedge->route.gridsL.resize(routeLen + 1, 0);
         treeedge->assigned = false;
       }
@@ -853,8 +847,16 @@ void FastRouteCore::layerAssignmentV4()
   }
   netpinOrderInc();
 
-  for (i = 0; i < tree_order_pv_.size(); i++) {
-    int netID = tree_order_pv_[i].treeIndex;
+  // assigns the layers of one net, only touching the 3D edges inside its
+  // tree bounding box
+  auto assign_net = [this](const int netID) {
+    int k, edgeID, nodeID, routeLen;
+    int n1, n2, connectionCNT;
+
+    int n1a, n2a;
+    std::queue<int> edgeQueue;
+
+    TreeEdge* treeedge;
 
     auto& treeedges = sttrees_[netID].edges;
     auto& treenodes = sttrees_[netID].nodes;
@@ -965,6 +967,33 @@ void FastRouteCore::layerAssignmentV4()
 
       }  // edge len > 0
     }    // eunmerating edges
+  };
+
+  if (layer_assignment_threads_ <= 1) {
+    for (const OrderNetPin& order : tree_order_pv_) {
+      assign_net(order.treeIndex);
+    }
+  } else {
+    // Nets of the same wave use disjoint 3D edges and overlapping nets keep
+    // the netpinOrderInc order, so the result matches the serial loop.
+    std::vector<odb::Rect> regions;
+    regions.reserve(tree_order_pv_.size());
+    for (const OrderNetPin& order : tree_order_pv_) {
+      regions.push_back(getMazeRegion(order.treeIndex, 0));
+    }
+    utl::ThreadException exception;
+    for (const std::vector<int>& wave : getRegionWaves(regions)) {
+#pragma omp parallel for num_threads(layer_assignment_threads_) \
+    schedule(dynamic)
+      for (int i = 0; i < (int) wave.size(); i++) {  // NOLINT
+        try {
+          assign_net(tree_order_pv_[wave[i]].treeIndex);
+        } catch (...) {
+          exception.capture();
+        }
+      }
+      exception.rethrow();
+    }
   }
 }
 
@@ -1249,8 +1278,13 @@ void FastRouteCore::StNetOrder()
     }
   }
 
-  std::stable_sort(
-      tree_order_cong_.begin(), tree_order_cong_.end(), compareTEL);
+  // Most nets don't cross any overflowed edge. They would keep their order
+  // at the end of the sort anyway, so only the congested nets are sorted.
+  const auto congested_end = std::stable_partition(
+      tree_order_cong_.begin(), tree_order_cong_.end(), [](const OrderTree& a) {
+        return a.xmin > 0;
+      });
+  std::stable_sort(tree_order_cong_.begin(), congested_end, compareTEL);
 
   // Set the 70% (or less) of non critical nets that doesn't have overflow
   // with the lowest priority
@@ -1271,9 +1305,13 @@ void FastRouteCore::StNetOrder()
     const FrNet* net_b = nets_[b.treeIndex];
     return net_a->getSlack() < net_b->getSlack();
   };
-  // sort by slack after congestion sort
-  std::stable_sort(
-      tree_order_cong_.begin(), tree_order_cong_.end(), compareSlack);
+  // sort by slack after congestion sort. Without critical nets the slacks
+  // set above are already in order.
+  if (!std::is_sorted(
+          tree_order_cong_.begin(), tree_order_cong_.end(), compareSlack)) {
+    std::stable_sort(
+        tree_order_cong_.begin(), tree_order_cong_.end(), compareSlack);
+  }
 }
 
 float FastRouteCore::CalculatePartialSlack()
@@ -1669,20 +1707,21 @@ static bool compareEdgeLen(const OrderNetEdge a, const OrderNetEdge b)
   return a.length > b.length;
 }
 
-void FastRouteCore::netedgeOrderDec(int netID)
+void FastRouteCore::netedgeOrderDec(int netID,
+                                    std::vector<OrderNetEdge>& net_eo)
 {
   const int numTreeedges = sttrees_[netID].num_edges();
 
-  net_eo_.clear();
+  net_eo.clear();
 
   for (int j = 0; j < numTreeedges; j++) {
     OrderNetEdge orderNet;
     orderNet.length = sttrees_[netID].edges[j].route.routelen;
     orderNet.edgeID = j;
-    net_eo_.push_back(orderNet);
+    net_eo.push_back(orderNet);
   }
 
-  std::stable_sort(net_eo_.begin(), net_eo_.end(), compareEdgeLen);
+  std::stable_sort(net_eo.begin(), net_eo.end(), compareEdgeLen);
 }
 
 void FastRouteCore::printEdge2D(int netID, int edgeID)
@@ -189,6 +189,11 @@ void RUDYDataSource::inDbPostMoveInst(odb::dbInst*)
   destroyMap();
 }
 
+void RUDYDataSource::inDbPostMoveInsts(const std::vector<odb::dbInst*>&)
+{
+  destroyMap();
+}
+
 void RUDYDataSource::inDbITermPostDisconnect(odb::dbITerm*, odb::dbNet*)
 {
   destroyMap();
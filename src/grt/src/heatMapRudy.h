@@ -68,6 +68,7 @@ class RUDYDataSource : public gui::GlobalRoutingDataSource,
                                      const odb::dbPlacementStatus&) override;
   void inDbInstSwapMasterAfter(odb::dbInst*) override;
   void inDbPostMoveInst(odb::dbInst*) override;
+  void inDbPostMoveInsts(const std::vector<odb::dbInst*>&) override;
   void inDbITermPostDisconnect(odb::dbITerm*, odb::dbNet*) override;
   void inDbITermPostConnect(odb::dbITerm*) override;
   void inDbBTermPostConnect(odb::dbBTerm*) override;
@@ -0,0 +1,27 @@
+# global_route -start_incremental rebuilds its routing from the guides
+# of a db that was written in an earlier session
+source "helpers.tcl"
+read_lef "Nangate45/Nangate45.lef"
+read_def "gcd.def"
+
+set_routing_layers -signal metal2-metal10
+global_route
+
+# A net without pins is not globally routed, but may still carry guides.
+set block [ord::get_db_block]
+set net [odb::dbNet_create $block "guides_only"]
+set tech [ord::get_db_tech]
+set layer [$tech findLayer metal3]
+set rect [odb::Rect]
+$rect init 0 0 2800 2800
+odb::dbGuide_create $net $layer $layer $rect
+
+set db_file [make_result_file incremental_from_db.odb]
+write_db $db_file
+clear
+
+read_db $db_file
+set_routing_layers -signal metal2-metal10
+
+global_route -start_incremental
+global_route -end_incremental
@@ -0,0 +1,18 @@
+# global_route -parallel_maze on a congested gcd gives the same routes with
+# one and four threads
+source "helpers.tcl"
+read_lef "Nangate45/Nangate45.lef"
+read_def "gcd.def"
+
+set_global_routing_layer_adjustment metal2-metal10 0.9
+set_routing_layers -signal metal2-metal10
+
+set guide_file1 [make_result_file parallel_maze_t1.guide]
+set_thread_count 1
+global_route -parallel_maze -allow_congestion -guide_file $guide_file1
+
+set guide_file4 [make_result_file parallel_maze_t4.guide]
+set_thread_count 4
+global_route -parallel_maze -allow_congestion -guide_file $guide_file4
+
+diff_files $guide_file1 $guide_file4
@@ -293,6 +293,14 @@ class Descriptor
   };
   using Properties = std::vector<Property>;
   using PropertyList = std::vector<std::pair<std::any, std::any>>;
+  // A list of objects that is only built when it is viewed, for
+  // properties that can hold millions of objects (ie. the iterms of a
+  // power net).  getItems returns up to count objects starting at first.
+  struct LazySelectionList
+  {
+    int size;
+    std::function<std::vector<Selected>(int first, int count)> getItems;
+  };
 
   // An action is a name and a callback function, the function should return
   // the next object to select (when deleting the object just return Selected())
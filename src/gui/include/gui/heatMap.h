@@ -201,7 +201,10 @@ class HeatMapDataSource
   void setupMap();
   void clearMap();
   virtual bool populateMap() = 0;
+  // Regions are buffered and applied to the map in parallel, each bin
+  // still combines its regions in the order they were added.
   void addToMap(const odb::Rect& region, double value);
+  // May be called concurrently for different bins
   virtual void combineMapData(bool base_has_value,
                               double& base,
                               const double new_data,
@@ -253,10 +256,37 @@ class HeatMapDataSource
   bool show_numbers_;
   bool show_legend_;
 
+  // Values of a populated map before correctMapScale, kept when the grid
+  // is resized so returning to a previous grid does not repopulate.
+  struct MapData
+  {
+    odb::dbBlock* block = nullptr;
+    double grid_x_size = 0.0;
+    double grid_y_size = 0.0;
+    std::vector<int> x_grid;
+    std::vector<int> y_grid;
+    std::vector<char> has_value;
+    std::vector<double> value;
+  };
+
+  void buildMapBins();
+  void flushMapUpdates();
+  std::array<int, 4> getMapIndexRange(const odb::Rect& bounds) const;
+  void saveMapData();
+  void cacheMapData();
+  bool restoreMapData();
+
   Map map_;
   std::vector<int> map_x_grid_;
   std::vector<int> map_y_grid_;
 
+  std::vector<std::pair<odb::Rect, double>> pending_map_updates_;
+  MapData map_data_;
+  std::vector<MapData> map_cache_;
+  bool clear_map_cache_ = false;
+  static constexpr size_t map_cache_limit_ = 4;
+  static constexpr size_t pending_map_updates_limit_ = 1 << 16;
+
   std::unique_ptr<HeatMapRenderer> renderer_;
   HeatMapSetup* setup_;
 
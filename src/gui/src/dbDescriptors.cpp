@@ -37,6 +37,7 @@
 #include <boost/algorithm/string.hpp>
 #include <iomanip>
 #include <limits>
+#include <memory>
 #include <queue>
 #include <regex>
 #include <sstream>
@@ -146,6 +147,43 @@ std::string Descriptor::convertUnits(const double value, const bool area)
   return str;
 }
 
+// Lists with more objects than this are only built when they are viewed
+static constexpr int max_selection_set_size = 10000;
+
+// Returns a SelectionSet of the objects, or a LazySelectionList when there
+// are too many of them to make a Selected for each one up front.
+template <typename Container>
+static std::any makeSelectionList(Container objects)
+{
+  auto* gui = Gui::get();
+  const int size = objects.size();
+  if (size <= max_selection_set_size) {
+    SelectionSet selections;
+    for (auto* object : objects) {
+      selections.insert(gui->makeSelected(object));
+    }
+    return selections;
+  }
+
+  auto shared_objects = std::make_shared<Container>(std::move(objects));
+  return Descriptor::LazySelectionList{
+      size, [gui, shared_objects](int first, int count) {
+        // walk from the start each time, the objects may have changed
+        std::vector<Selected> items;
+        int index = 0;
+        for (auto* object : *shared_objects) {
+          if (index++ < first) {
+            continue;
+          }
+          if (static_cast<int>(items.size()) == count) {
+            break;
+          }
+          items.push_back(gui->makeSelected(object));
+        }
+        return items;
+      }};
+}
+
 // renames an object
 template <typename T>
 static void addRenameEditor(T obj, Descriptor::Editors& editor)
@@ -397,67 +435,18 @@ Descriptor::Properties DbBlockDescriptor::getProperties(std::any object) const
   auto gui = Gui::get();
 
   Properties props;
-  SelectionSet children;
-  for (auto child : block->getChildren()) {
-    children.insert(gui->makeSelected(child));
-  }
-  props.push_back({"Child Blocks", children});
-
-  SelectionSet modules;
-  for (auto module : block->getModules()) {
-    modules.insert(gui->makeSelected(module));
-  }
-  props.push_back({"Modules", modules});
-
+  props.push_back({"Child Blocks", makeSelectionList(block->getChildren())});
+  props.push_back({"Modules", makeSelectionList(block->getModules())});
   props.push_back({"Top Module", gui->makeSelected(block->getTopModule())});
-
-  SelectionSet bterms;
-  for (auto bterm : block->getBTerms()) {
-    bterms.insert(gui->makeSelected(bterm));
-  }
-  props.push_back({"BTerms", bterms});
-
-  SelectionSet vias;
-  for (auto via : block->getVias()) {
-    vias.insert(gui->makeSelected(via));
-  }
-  props.push_back({"Block Vias", vias});
-
-  SelectionSet nets;
-  for (auto net : block->getNets()) {
-    nets.insert(gui->makeSelected(net));
-  }
-  props.push_back({"Nets", nets});
-
-  SelectionSet regions;
-  for (auto region : block->getRegions()) {
-    regions.insert(gui->makeSelected(region));
-  }
-  props.push_back({"Regions", regions});
-
-  SelectionSet insts;
-  for (auto inst : block->getInsts()) {
-    insts.insert(gui->makeSelected(inst));
-  }
-  props.push_back({"Instances", insts});
-
-  SelectionSet blockages;
-  for (auto blockage : block->getBlockages()) {
-    blockages.insert(gui->makeSelected(blockage));
-  }
-  props.push_back({"Blockages", blockages});
-
-  SelectionSet obstructions;
-  for (auto obstruction : block->getObstructions()) {
-    obstructions.insert(gui->makeSelected(obstruction));
-  }
-  props.push_back({"Obstructions", obstructions});
-
-  SelectionSet rows;
-  for (auto row : block->getRows()) {
-    rows.insert(gui->makeSelected(row));
-  }
-  props.push_back({"Rows", rows});
+  props.push_back({"BTerms", makeSelectionList(block->getBTerms())});
+  props.push_back({"Block Vias", makeSelectionList(block->getVias())});
+  props.push_back({"Nets", makeSelectionList(block->getNets())});
+  props.push_back({"Regions", makeSelectionList(block->getRegions())});
+  props.push_back({"Instances", makeSelectionList(block->getInsts())});
+  props.push_back({"Blockages", makeSelectionList(block->getBlockages())});
+  props.push_back(
+      {"Obstructions", makeSelectionList(block->getObstructions())});
+  props.push_back({"Rows", makeSelectionList(block->getRows())});
 
   populateODBProperties(props, block);
 
@@ -824,13 +813,9 @@ Descriptor::Properties DbMasterDescriptor::getProperties(std::any object) const
     }
   }
   props.push_back({"Equivalent", equivalent});
-  SelectionSet instances;
   std::set<odb::dbInst*> insts;
   getInstances(master, insts);
-  for (auto inst : insts) {
-    instances.insert(gui->makeSelected(inst));
-  }
-  props.push_back({"Instances", instances});
+  props.push_back({"Instances", makeSelectionList(std::move(insts))});
   props.push_back({"Origin", master->getOrigin()});
 
   populateODBProperties(props, master);
@@ -1440,18 +1425,7 @@ Descriptor::Properties DbNetDescriptor::getProperties(std::any object) const
                     {"Wire type", net->getWireType().getString()},
                     {"Special", net->isSpecial()},
                     {"Dont Touch", net->isDoNotTouch()}});
-  int iterm_size = net->getITerms().size();
-  std::any iterm_item;
-  if (iterm_size > max_iterms_) {
-    iterm_item = std::to_string(iterm_size) + " items";
-  } else {
-    SelectionSet iterms;
-    for (auto iterm : net->getITerms()) {
-      iterms.insert(gui->makeSelected(iterm));
-    }
-    iterm_item = iterms;
-  }
-  props.push_back({"ITerms", std::move(iterm_item)});
+  props.push_back({"ITerms", makeSelectionList(net->getITerms())});
   SelectionSet bterms;
   for (auto bterm : net->getBTerms()) {
     bterms.insert(gui->makeSelected(bterm));
@@ -2894,11 +2868,7 @@ Descriptor::Properties DbGroupDescriptor::getProperties(std::any object) const
     props.push_back({"Groups", groups});
   }
 
-  SelectionSet insts;
-  for (auto* inst : group->getInsts()) {
-    insts.insert(gui->makeSelected(inst));
-  }
-  props.push_back({"Instances", insts});
+  props.push_back({"Instances", makeSelectionList(group->getInsts())});
 
   props.push_back({"Group Type", group->getType().getString()});
 
@@ -3018,11 +2988,7 @@ Descriptor::Properties DbRegionDescriptor::getProperties(std::any object) const
     props.push_back({"Groups", children});
   }
 
-  SelectionSet insts;
-  for (auto* inst : region->getRegionInsts()) {
-    insts.insert(gui->makeSelected(inst));
-  }
-  props.push_back({"Instances", insts});
+  props.push_back({"Instances", makeSelectionList(region->getRegionInsts())});
 
   populateODBProperties(props, region);
 
@@ -3152,11 +3118,7 @@ Descriptor::Properties DbModuleDescriptor::getProperties(std::any object) const
     props.push_back({"Children", children});
   }
 
-  SelectionSet insts;
-  for (auto* inst : module->getInsts()) {
-    insts.insert(gui->makeSelected(inst));
-  }
-  props.push_back({"Instances", insts});
+  props.push_back({"Instances", makeSelectionList(module->getInsts())});
 
   populateODBProperties(props, module);
   if (mod_inst != nullptr) {
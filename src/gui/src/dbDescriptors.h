@@ -223,7 +223,6 @@ class DbNetDescriptor : public Descriptor
   odb::dbNet* getNet(const std::any& object) const;
   odb::dbObject* getSink(const std::any& object) const;
 
-  static const int max_iterms_ = 10000;
 };
 
 class DbITermDescriptor : public Descriptor
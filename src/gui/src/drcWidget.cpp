@@ -39,6 +39,7 @@
 #include <QFileDialog>
 #include <QHeaderView>
 #include <QVBoxLayout>
+#include <algorithm>
 #include <array>
 #include <boost/property_tree/json_parser.hpp>
 #include <boost/regex.hpp>
@@ -240,6 +241,86 @@ QVariant DRCItemModel::data(const QModelIndex& index, int role) const
   return QStandardItemModel::data(index, role);
 }
 
+static QStandardItem* makeItem(const QString& text)
+{
+  QStandardItem* item = new QStandardItem(text);
+  item->setEditable(false);
+  item->setSelectable(false);
+  return item;
+}
+
+void DRCItemModel::addGroup(QStandardItem* group,
+                            const std::vector<DRCViolation*>* violations)
+{
+  groups_[group] = violations;
+}
+
+void DRCItemModel::clearGroups()
+{
+  groups_.clear();
+}
+
+const std::vector<DRCViolation*>* DRCItemModel::getGroupViolations(
+    QStandardItem* item) const
+{
+  auto it = groups_.find(item);
+  if (it == groups_.end()) {
+    return nullptr;
+  }
+  return it->second;
+}
+
+bool DRCItemModel::hasChildren(const QModelIndex& parent) const
+{
+  if (parent.isValid()) {
+    auto violations = getGroupViolations(itemFromIndex(parent));
+    if (violations != nullptr) {
+      return !violations->empty();
+    }
+  }
+  return QStandardItemModel::hasChildren(parent);
+}
+
+bool DRCItemModel::canFetchMore(const QModelIndex& parent) const
+{
+  if (!parent.isValid()) {
+    return false;
+  }
+  QStandardItem* group = itemFromIndex(parent);
+  auto violations = getGroupViolations(group);
+  return violations != nullptr
+         && static_cast<size_t>(group->rowCount()) < violations->size();
+}
+
+void DRCItemModel::fetchMore(const QModelIndex& parent)
+{
+  if (!parent.isValid()) {
+    return;
+  }
+  QStandardItem* group = itemFromIndex(parent);
+  auto violations = getGroupViolations(group);
+  if (violations == nullptr) {
+    return;
+  }
+
+  const int begin = group->rowCount();
+  const int end
+      = std::min<int>(begin + fetch_batch_size_, violations->size());
+  for (int i = begin; i < end; i++) {
+    DRCViolation* violation = (*violations)[i];
+    QStandardItem* violation_item
+        = makeItem(QString::fromStdString(violation->getName()));
+    violation_item->setSelectable(true);
+    violation_item->setData(QVariant::fromValue(violation));
+    QStandardItem* violation_index = makeItem(QString::number(i + 1));
+    violation_index->setData(QVariant::fromValue(violation));
+    violation_index->setCheckable(true);
+    violation_index->setCheckState(violation->isVisible() ? Qt::Checked
+                                                          : Qt::Unchecked);
+    group->appendRow({violation_index, violation_item});
+  }
+}
+
 ///////
 
 DRCWidget::DRCWidget(QWidget* parent)
@@ -249,7 +330,7 @@ DRCWidget::DRCWidget(QWidget* parent)
       model_(new DRCItemModel(this)),
       block_(nullptr),
       load_(new QPushButton("Load...", this)),
-      renderer_(std::make_unique<DRCRenderer>(violations_))
+      renderer_(std::make_unique<DRCRenderer>(violations_by_type_))
 {
   setObjectName("drc_viewer");  // for settings
 
@@ -338,16 +419,19 @@ void DRCWidget::selectionChanged(const QItemSelection& selected,
 void DRCWidget::toggleParent(QStandardItem* child)
 {
   QStandardItem* parent = child->parent();
-  std::vector<bool> states;
-  for (int r = 0; r < parent->rowCount(); r++) {
-    auto* pchild = parent->child(r, 0);
-    states.push_back(pchild->checkState() == Qt::Checked);
+  // Not all the violations of the group may have a row yet.
+  auto violations = model_->getGroupViolations(parent);
+  if (violations == nullptr) {
+    return;
   }
 
+  auto is_visible = [](DRCViolation* violation) {
+    return violation->isVisible();
+  };
   const bool all_on
-      = std::all_of(states.begin(), states.end(), [](bool v) { return v; });
+      = std::all_of(violations->begin(), violations->end(), is_visible);
   const bool any_on
-      = std::any_of(states.begin(), states.end(), [](bool v) { return v; });
+      = std::any_of(violations->begin(), violations->end(), is_visible);
 
   if (all_on) {
     parent->setCheckState(Qt::Checked);
@@ -394,14 +478,15 @@ void DRCWidget::clicked(const QModelIndex& index)
       Selected t = Gui::get()->makeSelected(violation);
       emit selectDRC(t);
     }
-  } else {
-    if (item->hasChildren()) {
-      const bool state = item->checkState() == Qt::Checked;
-      for (int r = 0; r < item->rowCount(); r++) {
-        auto* child = item->child(r, 0);
-        setVisibleDRC(child, state, false);
-      }
+  } else if (auto violations = model_->getGroupViolations(item)) {
+    const bool state = item->checkState() == Qt::Checked;
+    for (DRCViolation* violation : *violations) {
+      violation->setIsVisible(state);
+    }
+    for (int r = 0; r < item->rowCount(); r++) {
+      item->child(r, 0)->setCheckState(state ? Qt::Checked : Qt::Unchecked);
     }
+    renderer_->redraw();
   }
 }
 
@@ -434,43 +519,25 @@ void DRCWidget::toggleRenderer(bool visible)
   }
 }
 
-void DRCWidget::updateModel()
+void DRCWidget::addViolation(std::unique_ptr<DRCViolation> violation)
 {
-  auto makeItem = [](const QString& text) {
-    QStandardItem* item = new QStandardItem(text);
-    item->setEditable(false);
-    item->setSelectable(false);
-    return item;
-  };
+  violations_by_type_[violation->getType()].push_back(violation.get());
+  violations_.push_back(std::move(violation));
+}
 
+void DRCWidget::updateModel()
+{
+  model_->clearGroups();
   model_->removeRows(0, model_->rowCount());
+  renderer_->clearIndex();
 
-  std::map<std::string, std::vector<DRCViolation*>> violation_by_type;
-  for (const auto& violation : violations_) {
-    violation_by_type[violation->getType()].push_back(violation.get());
-  }
-
-  for (const auto& [type, violation_list] : violation_by_type) {
+  // The violation rows are added by DRCItemModel::fetchMore.
+  for (const auto& [type, violation_list] : violations_by_type_) {
     QStandardItem* type_group = makeItem(QString::fromStdString(type));
     type_group->setCheckable(true);
     type_group->setCheckState(Qt::Checked);
 
-    int violation_idx = 1;
-    for (const auto& violation : violation_list) {
-      QStandardItem* violation_item
-          = makeItem(QString::fromStdString(violation->getName()));
-      violation_item->setSelectable(true);
-      violation_item->setData(QVariant::fromValue(violation));
-      QStandardItem* violation_index
-          = makeItem(QString::number(violation_idx++));
-      violation_index->setData(QVariant::fromValue(violation));
-      violation_index->setCheckable(true);
-      violation_index->setCheckState(violation->isVisible() ? Qt::Checked
-                                                            : Qt::Unchecked);
-
-      type_group->appendRow({violation_index, violation_item});
-    }
-
+    model_->addGroup(type_group, &violation_list);
     model_->appendRow(
         {type_group,
          makeItem(QString::number(violation_list.size()) + " violations")});
@@ -494,6 +561,7 @@ void DRCWidget::loadReport(const QString& filename)
   Gui::get()->removeSelected<DRCViolation*>();
 
   violations_.clear();
+  violations_by_type_.clear();
 
   try {
     // OpenLane uses .drc and OpenROAD-flow-scripts uses .rpt
@@ -532,6 +600,12 @@ void DRCWidget::loadTRReport(const QString& filename)
   std::regex bbox_corners(
       "\\s*\\(\\s*(.*),\\s*(.*)\\s*\\)\\s*-\\s*\\(\\s*(.*),\\s*(.*)\\s*\\)");
 
+  std::map<odb::dbTechLayer*, std::vector<odb::dbObstruction*>>
+      obstructions_by_layer;
+  for (const auto obs : block_->getObstructions()) {
+    obstructions_by_layer[obs->getBBox()->getTechLayer()].push_back(obs);
+  }
+
   int line_number = 0;
   auto tech = block_->getDataBase()->getTech();
   while (!report.eof()) {
@@ -699,15 +773,13 @@ void DRCWidget::loadTRReport(const QString& filename)
         }
       } else if (item_type == "obstruction") {
         bool found = false;
-        if (layer != nullptr) {
-          for (const auto obs : block_->getObstructions()) {
-            auto obs_bbox = obs->getBBox();
-            if (obs_bbox->getTechLayer() == layer) {
-              odb::Rect obs_rect = obs_bbox->getBox();
-              if (obs_rect.intersects(rect)) {
-                srcs_list.emplace_back(obs);
-                found = true;
-              }
+        auto layer_obstructions = obstructions_by_layer.find(layer);
+        if (layer != nullptr
+            && layer_obstructions != obstructions_by_layer.end()) {
+          for (const auto obs : layer_obstructions->second) {
+            if (obs->getBBox()->getBox().intersects(rect)) {
+              srcs_list.emplace_back(obs);
+              found = true;
             }
           }
         }
@@ -745,7 +817,7 @@ void DRCWidget::loadTRReport(const QString& filename)
     comment += congestion_information;
 
     std::vector<DRCViolation::DRCShape> shapes({rect});
-    violations_.push_back(std::make_unique<DRCViolation>(
+    addViolation(std::make_unique<DRCViolation>(
         name, type, srcs_list, shapes, layer, comment, violation_line_number));
   }
 
@@ -892,7 +964,7 @@ void DRCWidget::loadJSONReport(const QString& filename)
       }
 
       std::string name = violation_type + " - " + std::to_string(++i);
-      violations_.push_back(std::make_unique<DRCViolation>(
+      addViolation(std::make_unique<DRCViolation>(
           name, violation_type, srcs_list, shapes, layer, violation_text, 0));
     }
   }
@@ -900,12 +972,33 @@ void DRCWidget::loadJSONReport(const QString& filename)
 
 ////////
 
-DRCRenderer::DRCRenderer(
-    const std::vector<std::unique_ptr<DRCViolation>>& violations)
+DRCRenderer::DRCRenderer(const DRCViolationsByType& violations)
     : violations_(violations)
 {
 }
 
+void DRCRenderer::clearIndex()
+{
+  index_.clear();
+}
+
+const DRCRenderer::ViolationTree& DRCRenderer::getIndex(
+    const std::string& type,
+    const std::vector<DRCViolation*>& violations)
+{
+  auto& index = index_[type];
+  if (index == nullptr) {
+    std::vector<ViolationValue> values;
+    values.reserve(violations.size());
+    for (DRCViolation* violation : violations) {
+      values.emplace_back(violation->getBBox(), violation);
+    }
+    // The range constructor packs the tree.
+    index = std::make_unique<ViolationTree>(values.begin(), values.end());
+  }
+  return *index;
+}
+
 void DRCRenderer::drawObjects(Painter& painter)
 {
   Painter::Color pen_color = Painter::white;
@@ -914,11 +1007,22 @@ void DRCRenderer::drawObjects(Painter& painter)
 
   painter.setPen(pen_color, true, 0);
   painter.setBrush(brush_color, Painter::Brush::DIAGONAL);
-  for (const auto& violation : violations_) {
-    if (!violation->isVisible()) {
-      continue;
+
+  // Small violations are drawn as an X of this size
+  const int min_box = 20.0 / painter.getPixelsPerDBU();
+  odb::Rect bounds;
+  painter.getBounds().bloat(min_box, bounds);
+  for (const auto& [type, violations] : violations_) {
+    const ViolationTree& index = getIndex(type, violations);
+    for (auto it = index.qbegin(boost::geometry::index::intersects(bounds));
+         it != index.qend();
+         ++it) {
+      DRCViolation* violation = it->second;
+      if (!violation->isVisible()) {
+        continue;
+      }
+      violation->paint(painter);
     }
-    violation->paint(painter);
   }
 }
 
@@ -932,12 +1036,16 @@ SelectionSet DRCRenderer::select(odb::dbTechLayer* layer,
   auto gui = Gui::get();
 
   SelectionSet selections;
-  for (const auto& violation : violations_) {
-    if (!violation->isVisible()) {
-      continue;
-    }
-    if (violation->getBBox().intersects(region)) {
-      selections.insert(gui->makeSelected(violation.get()));
+  for (const auto& [type, violations] : violations_) {
+    const ViolationTree& index = getIndex(type, violations);
+    for (auto it = index.qbegin(boost::geometry::index::intersects(region));
+         it != index.qend();
+         ++it) {
+      DRCViolation* violation = it->second;
+      if (!violation->isVisible()) {
+        continue;
+      }
+      selections.insert(gui->makeSelected(violation));
     }
   }
   return selections;
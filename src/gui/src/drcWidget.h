@@ -41,12 +41,15 @@
 #include <QSettings>
 #include <QStandardItemModel>
 #include <QTreeView>
+#include <boost/geometry/index/rtree.hpp>
+#include <map>
 #include <memory>
 #include <variant>
 
 #include "gui/gui.h"
 #include "inspector.h"
 #include "odb/db.h"
+#include "odb/geom_boost.h"
 
 namespace utl {
 class Logger;
@@ -131,25 +134,58 @@ class DRCDescriptor : public Descriptor
   const std::vector<std::unique_ptr<DRCViolation>>& violations_;
 };
 
+using DRCViolationsByType = std::map<std::string, std::vector<DRCViolation*>>;
+
+// The rows of a violation type are only created as its group is expanded
+// or scrolled, so reports with millions of violations load quickly.
 class DRCItemModel : public QStandardItemModel
 {
  public:
   DRCItemModel(QWidget* parent = nullptr) : QStandardItemModel(parent) {}
   QVariant data(const QModelIndex& index, int role) const override;
+
+  void addGroup(QStandardItem* group,
+                const std::vector<DRCViolation*>* violations);
+  void clearGroups();
+  // nullptr if item is not a group
+  const std::vector<DRCViolation*>* getGroupViolations(
+      QStandardItem* item) const;
+
+  bool hasChildren(const QModelIndex& parent) const override;
+  bool canFetchMore(const QModelIndex& parent) const override;
+  void fetchMore(const QModelIndex& parent) override;
+
+ private:
+  static constexpr int fetch_batch_size_ = 1000;
+
+  std::map<QStandardItem*, const std::vector<DRCViolation*>*> groups_;
 };
 
 class DRCRenderer : public Renderer
 {
  public:
-  DRCRenderer(const std::vector<std::unique_ptr<DRCViolation>>& violations);
+  DRCRenderer(const DRCViolationsByType& violations);
 
   // Renderer
   void drawObjects(Painter& painter) override;
   SelectionSet select(odb::dbTechLayer* layer,
                       const odb::Rect& region) override;
 
+  // Must be called when the violations change.
+  void clearIndex();
+
  private:
-  const std::vector<std::unique_ptr<DRCViolation>>& violations_;
+  using ViolationValue = std::pair<odb::Rect, DRCViolation*>;
+  using ViolationTree
+      = boost::geometry::index::rtree<ViolationValue,
+                                      boost::geometry::index::quadratic<16>>;
+
+  const ViolationTree& getIndex(const std::string& type,
+                                const std::vector<DRCViolation*>& violations);
+
+  const DRCViolationsByType& violations_;
+  // Built the first time a violation type is drawn or selected.
+  std::map<std::string, std::unique_ptr<ViolationTree>> index_;
 };
 
 class DRCWidget : public QDockWidget
@@ -188,6 +224,7 @@ class DRCWidget : public QDockWidget
  private:
   void loadTRReport(const QString& filename);
   void loadJSONReport(const QString& filename);
+  void addViolation(std::unique_ptr<DRCViolation> violation);
   void updateModel();
 
   utl::Logger* logger_;
@@ -202,6 +239,8 @@ class DRCWidget : public QDockWidget
   std::unique_ptr<DRCRenderer> renderer_;
 
   std::vector<std::unique_ptr<DRCViolation>> violations_;
+  // Grouped while the report is parsed.
+  DRCViolationsByType violations_by_type_;
 
   void toggleParent(QStandardItem* child);
   bool setVisibleDRC(QStandardItem* item, bool visible, bool announce_parent);
@@ -525,6 +525,20 @@ bool Gui::filterSelectionProperties(const Descriptor::Properties& properties,
             return true;
           }
         }
+      } else if (auto props_lazy_list
+                 = std::any_cast<Descriptor::LazySelectionList>(
+                     &property.value)) {
+        if (Descriptor::Property::toString(value) == "CONNECTED"
+            && props_lazy_list->size != 0) {
+          return true;
+        }
+        const std::string name = Descriptor::Property::toString(value);
+        for (const auto& selected :
+             props_lazy_list->getItems(0, props_lazy_list->size)) {
+          if (name == selected.getName()) {
+            return true;
+          }
+        }
       } else if (auto props_list
                  = std::any_cast<Descriptor::PropertyList>(&property.value)) {
         for (const auto& prop : *props_list) {
@@ -1531,6 +1545,8 @@ std::string Descriptor::Property::toString(const std::any& value)
     std::string text = fmt::format(
         "({},{})", convert_dbu(v->x(), false), convert_dbu(v->y(), false));
     return text;
+  } else if (auto v = std::any_cast<LazySelectionList>(&value)) {
+    return std::to_string(v->size) + " items";
   }
 
   return "<unknown>";
@@ -39,6 +39,7 @@
 #include <iostream>
 
 #include "heatMapSetup.h"
+#include "ord/OpenRoad.hh"
 #include "utl/Logger.h"
 
 namespace gui {
@@ -188,7 +189,9 @@ void HeatMapDataSource::setGridSizes(double x, double y)
   }
 
   if (changed) {
-    destroyMap();
+    // the data itself is unchanged, so keep the cached maps
+    destroy_map_ = true;
+    redraw();
   }
 }
 
@@ -339,8 +342,8 @@ void HeatMapDataSource::setSettings(const Renderer::Settings& settings)
   setColorAlpha(color_alpha_);
 }
 
-HeatMapDataSource::MapView HeatMapDataSource::getMapView(
-    const odb::Rect& bounds)
+std::array<int, 4> HeatMapDataSource::getMapIndexRange(
+    const odb::Rect& bounds) const
 {
   const auto x_low_find
       = std::lower_bound(map_x_grid_.begin(), map_x_grid_.end(), bounds.xMin());
@@ -365,32 +368,87 @@ HeatMapDataSource::MapView HeatMapDataSource::getMapView(
       static_cast<int>(std::distance(map_y_grid_.begin(), y_high_find)),
       shape_y);
 
+  return {x_low, x_high, y_low, y_high};
+}
+
+HeatMapDataSource::MapView HeatMapDataSource::getMapView(
+    const odb::Rect& bounds)
+{
+  const auto [x_low, x_high, y_low, y_high] = getMapIndexRange(bounds);
+
   return map_[boost::indices[Map::index_range(x_low, x_high)]
                             [Map::index_range(y_low, y_high)]];
 }
 
 void HeatMapDataSource::addToMap(const odb::Rect& region, double value)
 {
-  for (const auto& map_col : getMapView(region)) {
-    for (const auto& map_pt : map_col) {
-      odb::Rect intersection;
-      map_pt->rect.intersection(region, intersection);
+  pending_map_updates_.emplace_back(region, value);
+  if (pending_map_updates_.size() >= pending_map_updates_limit_) {
+    flushMapUpdates();
+  }
+}
 
-      const double intersect_area = intersection.area();
-      const double value_area = region.area();
-      const double region_area = map_pt->rect.area();
+void HeatMapDataSource::flushMapUpdates()
+{
+  if (pending_map_updates_.empty()) {
+    return;
+  }
 
-      combineMapData(map_pt->has_value,
-                     map_pt->value,
-                     value,
-                     value_area,
-                     intersect_area,
-                     region_area);
-      map_pt->has_value = true;
+  const int columns = static_cast<int>(map_.shape()[0]);
+  const int threads = ord::OpenRoad::openRoad()->getThreadCount();
+  const int stripes = std::max(1, std::min(columns, threads * 4));
+  const int stripe_width = (columns + stripes - 1) / stripes;
+
+  // Bucket the regions by column stripe, keeping the order they were added
+  // in so every bin combines its data in the same order as before.
+  std::vector<std::array<int, 4>> ranges;
+  ranges.reserve(pending_map_updates_.size());
+  std::vector<std::vector<int>> stripe_updates(stripes);
+  for (const auto& [region, value] : pending_map_updates_) {
+    const std::array<int, 4> range = getMapIndexRange(region);
+    const int idx = ranges.size();
+    ranges.push_back(range);
+    const int last_column = std::max(range[0], range[1] - 1);
+    for (int stripe = range[0] / stripe_width;
+         stripe <= last_column / stripe_width && stripe < stripes;
+         stripe++) {
+      stripe_updates[stripe].push_back(idx);
+    }
+  }
 
-      markColorsInvalid();
+#pragma omp parallel for num_threads(threads) schedule(dynamic)
+  for (int stripe = 0; stripe < stripes; stripe++) {
+    const int stripe_begin = stripe * stripe_width;
+    const int stripe_end = std::min(stripe_begin + stripe_width, columns);
+    for (const int idx : stripe_updates[stripe]) {
+      const auto& [region, value] = pending_map_updates_[idx];
+      const auto& [x_low, x_high, y_low, y_high] = ranges[idx];
+      const double value_area = region.area();
+      for (int x = std::max(x_low, stripe_begin);
+           x < std::min(x_high, stripe_end);
+           x++) {
+        for (int y = y_low; y < y_high; y++) {
+          const auto& map_pt = map_[x][y];
+          odb::Rect intersection;
+          map_pt->rect.intersection(region, intersection);
+
+          const double intersect_area = intersection.area();
+          const double region_area = map_pt->rect.area();
+
+          combineMapData(map_pt->has_value,
+                         map_pt->value,
+                         value,
+                         value_area,
+                         intersect_area,
+                         region_area);
+          map_pt->has_value = true;
+        }
+      }
     }
   }
+
+  pending_map_updates_.clear();
+  markColorsInvalid();
 }
 
 odb::Rect HeatMapDataSource::getBounds() const
@@ -412,7 +470,11 @@ void HeatMapDataSource::setupMap()
   }
 
   populateXYGrid();
+  buildMapBins();
+}
 
+void HeatMapDataSource::buildMapBins()
+{
   const size_t x_grid_size = map_x_grid_.size() - 1;
   const size_t y_grid_size = map_y_grid_.size() - 1;
 
@@ -426,6 +488,8 @@ void HeatMapDataSource::setupMap()
   map_.resize(boost::extents[x_grid_size][y_grid_size]);
 
   const Painter::Color default_color = getColor(0);
+  const int threads = ord::OpenRoad::openRoad()->getThreadCount();
+#pragma omp parallel for num_threads(threads) schedule(dynamic)
   for (size_t x = 0; x < x_grid_size; x++) {
     const int xMin = map_x_grid_[x];
     const int xMax = map_x_grid_[x + 1];
@@ -493,6 +557,7 @@ void HeatMapDataSource::setXYMapGrid(const std::vector<int>& x_grid,
 void HeatMapDataSource::destroyMap()
 {
   destroy_map_ = true;
+  clear_map_cache_ = true;
 
   redraw();
 }
@@ -520,25 +585,46 @@ void HeatMapDataSource::ensureMap()
 
   if (destroy_map_) {
     debugPrint(logger_, utl::GUI, "HeatMap", 1, "Destroying map");
+    if (clear_map_cache_) {
+      map_cache_.clear();
+      map_data_ = MapData();
+      clear_map_cache_ = false;
+    } else {
+      cacheMapData();
+    }
     clearMap();
     destroy_map_ = false;
   }
 
   const bool build_map = map_[0][0] == nullptr;
+  bool restored = false;
   if (build_map) {
-    debugPrint(logger_, utl::GUI, "HeatMap", 1, "Setting up map");
-    setupMap();
+    restored = restoreMapData();
+    if (!restored) {
+      debugPrint(logger_, utl::GUI, "HeatMap", 1, "Setting up map");
+      setupMap();
+    }
   }
 
   if (build_map || !isPopulated()) {
-    debugPrint(logger_, utl::GUI, "HeatMap", 1, "Populating map");
+    if (restored) {
+      debugPrint(logger_, utl::GUI, "HeatMap", 1, "Restored cached map");
+    } else {
+      debugPrint(logger_, utl::GUI, "HeatMap", 1, "Populating map");
 
-    if (gui::Gui::enabled()) {
-      QApplication::setOverrideCursor(Qt::WaitCursor);
-    }
-    populated_ = populateMap();
-    if (gui::Gui::enabled()) {
-      QApplication::restoreOverrideCursor();
+      if (gui::Gui::enabled()) {
+        QApplication::setOverrideCursor(Qt::WaitCursor);
+      }
+      populated_ = populateMap();
+      if (isPopulated()) {
+        flushMapUpdates();
+        saveMapData();
+      } else {
+        pending_map_updates_.clear();
+      }
+      if (gui::Gui::enabled()) {
+        QApplication::restoreOverrideCursor();
+      }
     }
 
     if (isPopulated()) {
@@ -560,6 +646,78 @@ void HeatMapDataSource::ensureMap()
   }
 }
 
+void HeatMapDataSource::saveMapData()
+{
+  map_data_.block = getBlock();
+  map_data_.grid_x_size = getGridXSize();
+  map_data_.grid_y_size = getGridYSize();
+  map_data_.x_grid = map_x_grid_;
+  map_data_.y_grid = map_y_grid_;
+  map_data_.has_value.clear();
+  map_data_.value.clear();
+  map_data_.has_value.reserve(map_.num_elements());
+  map_data_.value.reserve(map_.num_elements());
+  for (const auto& map_col : map_) {
+    for (const auto& map_pt : map_col) {
+      map_data_.has_value.push_back(map_pt->has_value);
+      map_data_.value.push_back(map_pt->value);
+    }
+  }
+}
+
+void HeatMapDataSource::cacheMapData()
+{
+  if (!isPopulated() || map_data_.block == nullptr) {
+    return;
+  }
+
+  map_cache_.push_back(std::move(map_data_));
+  map_data_ = MapData();
+  if (map_cache_.size() > map_cache_limit_) {
+    map_cache_.erase(map_cache_.begin());
+  }
+}
+
+bool HeatMapDataSource::restoreMapData()
+{
+  odb::dbBlock* block = getBlock();
+  if (block == nullptr) {
+    return false;
+  }
+
+  const double grid_x_size = getGridXSize();
+  const double grid_y_size = getGridYSize();
+  auto cached = std::find_if(
+      map_cache_.begin(), map_cache_.end(), [&](const MapData& data) {
+        return data.block == block && data.grid_x_size == grid_x_size
+               && data.grid_y_size == grid_y_size;
+      });
+  if (cached == map_cache_.end()) {
+    return false;
+  }
+
+  map_data_ = std::move(*cached);
+  map_cache_.erase(cached);
+
+  map_x_grid_ = map_data_.x_grid;
+  map_y_grid_ = map_data_.y_grid;
+  buildMapBins();
+
+  size_t idx = 0;
+  for (const auto& map_col : map_) {
+    for (const auto& map_pt : map_col) {
+      map_pt->has_value = map_data_.has_value[idx];
+      map_pt->value = map_data_.value[idx];
+      idx++;
+    }
+  }
+
+  populated_ = true;
+  markColorsInvalid();
+
+  return true;
+}
+
 void HeatMapDataSource::updateMapColors()
 {
   const int color_count = color_generator_.getColorCount();
@@ -601,8 +759,11 @@ void HeatMapDataSource::updateMapColors()
 
 void HeatMapDataSource::assignMapColors()
 {
-  for (const auto& map_col : map_) {
-    for (const auto& map_pt : map_col) {
+  const int columns = static_cast<int>(map_.shape()[0]);
+  const int threads = ord::OpenRoad::openRoad()->getThreadCount();
+#pragma omp parallel for num_threads(threads) schedule(dynamic)
+  for (int x = 0; x < columns; x++) {
+    for (const auto& map_pt : map_[x]) {
       map_pt->color = getColor(map_pt->value);
     }
   }
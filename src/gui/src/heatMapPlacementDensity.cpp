@@ -185,4 +185,10 @@ void PlacementDensityDataSource::inDbPostMoveInst(odb::dbInst*)
   destroyMap();
 }
 
+void PlacementDensityDataSource::inDbPostMoveInsts(
+    const std::vector<odb::dbInst*>&)
+{
+  destroyMap();
+}
+
 }  // namespace gui
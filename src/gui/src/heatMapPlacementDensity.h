@@ -60,6 +60,7 @@ class PlacementDensityDataSource : public HeatMapDataSource,
   virtual void inDbInstSwapMasterAfter(odb::dbInst*) override;
   virtual void inDbPreMoveInst(odb::dbInst*) override;
   virtual void inDbPostMoveInst(odb::dbInst*) override;
+  virtual void inDbPostMoveInsts(const std::vector<odb::dbInst*>&) override;
 
  protected:
   virtual bool populateMap() override;
@@ -37,6 +37,7 @@
 #include <QHeaderView>
 #include <QLineEdit>
 #include <QPushButton>
+#include <algorithm>
 
 #include "gui/gui.h"
 #include "gui_utils.h"
@@ -90,6 +91,7 @@ void SelectedItemModel::updateObject()
   beginResetModel();
 
   removeRows(0, rowCount());
+  lazy_lists_.clear();
 
   if (!object_) {
     endResetModel();
@@ -140,6 +142,9 @@ void SelectedItemModel::makePropertyItem(const Descriptor::Property& property,
     value_item = makePropertyList(name_item, sel_set->begin(), sel_set->end());
   } else if (auto sel_set = std::any_cast<SelectionSet>(&value)) {
     value_item = makeList(name_item, sel_set->begin(), sel_set->end());
+  } else if (auto lazy_list
+             = std::any_cast<Descriptor::LazySelectionList>(&value)) {
+    value_item = makeLazyList(name_item, *lazy_list);
   } else if (auto v_list = std::any_cast<std::vector<std::any>>(&value)) {
     value_item = makeList(name_item, v_list->begin(), v_list->end());
   } else if (auto v_set = std::any_cast<std::set<std::any>>(&value)) {
@@ -212,6 +217,59 @@ QStandardItem* SelectedItemModel::makePropertyList(QStandardItem* name_item,
   return makeItem(items);
 }
 
+QStandardItem* SelectedItemModel::makeLazyList(
+    QStandardItem* name_item,
+    const Descriptor::LazySelectionList& list)
+{
+  // items are only created when the list is expanded
+  name_item->setData(static_cast<int>(lazy_lists_.size()),
+                     EditorItemDelegate::lazy_list_);
+  lazy_lists_.emplace_back(list, 0);
+  if (list.size > 0) {
+    appendMoreRow(name_item, list.size);
+  }
+
+  return makeItem(QString::number(list.size) + " items");
+}
+
+void SelectedItemModel::appendMoreRow(QStandardItem* name_item, int remaining)
+{
+  auto more_item = makeItem(
+      QString("Show %1 more").arg(std::min(remaining, lazy_page_size_)));
+  more_item->setData(true, EditorItemDelegate::lazy_more_);
+  name_item->appendRow(
+      {more_item, makeItem(QString::number(remaining) + " remaining")});
+}
+
+void SelectedItemModel::loadMoreItems(QStandardItem* name_item)
+{
+  const QVariant lazy_index = name_item->data(EditorItemDelegate::lazy_list_);
+  if (!lazy_index.isValid()) {
+    return;
+  }
+
+  auto& [list, loaded] = lazy_lists_[lazy_index.toInt()];
+  if (loaded >= list.size) {
+    return;
+  }
+
+  // replace the "more" row with the next page
+  name_item->removeRow(name_item->rowCount() - 1);
+  const std::vector<Selected> items = list.getItems(loaded, lazy_page_size_);
+  for (const Selected& item : items) {
+    name_item->appendRow(
+        {makeItem(QString::number(++loaded)), makeItem(std::any(item))});
+  }
+  if (items.empty()) {
+    // the list shrank since it was made
+    loaded = list.size;
+  }
+
+  if (loaded < list.size) {
+    appendMoreRow(name_item, list.size - loaded);
+  }
+}
+
 void SelectedItemModel::makeItemEditor(const std::string& name,
                                        QStandardItem* item,
                                        const Selected& selected,
@@ -674,6 +732,7 @@ Inspector::Inspector(const SelectionSet& selected,
 
   connect(view_, &ObjectTree::clicked, this, &Inspector::clicked);
   connect(view_, &ObjectTree::doubleClicked, this, &Inspector::doubleClicked);
+  connect(view_, &ObjectTree::expanded, this, &Inspector::indexExpanded);
 
   connect(
       button_prev_, &QPushButton::pressed, this, &Inspector::selectPrevious);
@@ -970,6 +1029,12 @@ void Inspector::indexClicked()
 {
   // handle single click event
   QStandardItem* item = model_->itemFromIndex(clicked_index_);
+  QStandardItem* name_item = model_->itemFromIndex(
+      clicked_index_.sibling(clicked_index_.row(), Name));
+  if (name_item->data(EditorItemDelegate::lazy_more_).isValid()) {
+    model_->loadMoreItems(name_item->parent());
+    return;
+  }
   auto new_selected
       = item->data(EditorItemDelegate::selected_).value<Selected>();
   if (new_selected) {
@@ -1002,6 +1067,16 @@ void Inspector::indexDoubleClicked(const QModelIndex& index)
   }
 }
 
+void Inspector::indexExpanded(const QModelIndex& index)
+{
+  // load the first page of a lazy list once it is opened
+  QStandardItem* item = model_->itemFromIndex(index);
+  if (item->rowCount() == 1
+      && item->child(0)->data(EditorItemDelegate::lazy_more_).isValid()) {
+    model_->loadMoreItems(item);
+  }
+}
+
 void Inspector::focusIndex(const QModelIndex& focus_index)
 {
   defocus();
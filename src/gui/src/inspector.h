@@ -60,6 +60,8 @@ class EditorItemDelegate : public QItemDelegate
   static const int editor_type_ = Qt::UserRole + 2;
   static const int editor_select_ = Qt::UserRole + 3;
   static const int selected_ = Qt::UserRole + 4;
+  static const int lazy_list_ = Qt::UserRole + 5;
+  static const int lazy_more_ = Qt::UserRole + 6;
 
   enum EditType
   {
@@ -108,6 +110,8 @@ class SelectedItemModel : public QStandardItemModel
 
  public slots:
   void updateObject();
+  // Appends the next page of a lazy list to its name item
+  void loadMoreItems(QStandardItem* name_item);
 
  private:
   void makePropertyItem(const Descriptor::Property& property,
@@ -125,6 +129,10 @@ class SelectedItemModel : public QStandardItemModel
                                   const Iterator& begin,
                                   const Iterator& end);
 
+  QStandardItem* makeLazyList(QStandardItem* name_item,
+                              const Descriptor::LazySelectionList& list);
+  void appendMoreRow(QStandardItem* name_item, int remaining);
+
   void makeItemEditor(const std::string& name,
                       QStandardItem* item,
                       const Selected& selected,
@@ -134,6 +142,10 @@ class SelectedItemModel : public QStandardItemModel
   const QColor selectable_item_;
   const QColor editable_item_;
   const Selected& object_;
+
+  // lazy lists of the current object and how many items are loaded
+  std::vector<std::pair<Descriptor::LazySelectionList, int>> lazy_lists_;
+  static constexpr int lazy_page_size_ = 1000;
 };
 
 class ActionLayout : public QLayout
@@ -238,6 +250,7 @@ class Inspector : public QDockWidget
 
   void indexClicked();
   void indexDoubleClicked(const QModelIndex& index);
+  void indexExpanded(const QModelIndex& index);
 
   void showCommandsMenu(const QPoint& pos);
 
@@ -605,7 +605,7 @@ std::pair<LayoutViewer::Edge, bool> LayoutViewer::searchNearestEdge(
   // Cache the search results as we will iterate over the instances
   // for each layer.
   std::vector<dbInst*> insts;
-  for (auto* inst : inst_range) {
+  for (const auto& [inst_box, inst] : inst_range) {
     if (options_->isInstanceVisible(inst)) {
       if (inst_internals_visible) {
         // only add inst if it can be used for pin or obs search
@@ -944,7 +944,7 @@ void LayoutViewer::selectAt(odb::Rect region, std::vector<Selected>& selections)
                                    region.yMax(),
                                    instanceSizeLimit());
 
-  for (auto* inst : insts) {
+  for (const auto& [inst_box, inst] : insts) {
     if (options_->isInstanceVisible(inst)) {
       if (options_->isInstanceSelectable(inst)) {
         selections.push_back(gui_->makeSelected(inst));
@@ -1888,10 +1888,16 @@ void LayoutViewer::paintEvent(QPaintEvent* event)
 }
 
 void LayoutViewer::fullRepaint()
+{
+  viewer_thread_.invalidateBlockCache();
+  scrollRepaint();
+}
+
+void LayoutViewer::scrollRepaint()
 {
   if (command_executing_ && !paused_) {
     QTimer::singleShot(
-        5 /*ms*/, this, &LayoutViewer::fullRepaint);  // retry later
+        5 /*ms*/, this, &LayoutViewer::scrollRepaint);  // retry later
     return;
   }
 
@@ -2010,7 +2016,7 @@ void LayoutViewer::setScroller(LayoutScroll* scroller)
   connect(scroller_,
           &LayoutScroll::centerChanged,
           this,
-          &LayoutViewer::fullRepaint);
+          &LayoutViewer::scrollRepaint);
 }
 
 void LayoutViewer::viewportUpdated()
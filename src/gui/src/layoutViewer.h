@@ -245,6 +245,8 @@ class LayoutViewer : public QWidget
 
   // signals that the cache should be flushed and a full repaint should occur.
   void fullRepaint();
+  // repaint after the view was only moved, reusing the cached drawing.
+  void scrollRepaint();
 
   odb::Point getVisibleCenter();
 
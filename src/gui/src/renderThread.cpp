@@ -33,6 +33,7 @@
 #include "renderThread.h"
 
 #include <QPainterPath>
+#include <QRegion>
 
 #include "layoutViewer.h"
 #include "odb/dbShape.h"
@@ -118,19 +119,21 @@ void RenderThread::run()
     selected.swap(selected_);
     highlighted.swap(highlighted_);
     rulers.swap(rulers_);
+    render_generation_ = block_cache_generation_;
     mutex_.unlock();
     QImage image(draw_bounds.width(),
                  draw_bounds.height(),
                  QImage::Format_ARGB32_Premultiplied);
     // drawing can be interrupted by setting restart_
     try {
-      draw(image,
-           draw_bounds,
-           selected,
-           highlighted,
-           rulers,
-           1.0,
-           Qt::transparent);
+      drawImage(image,
+                draw_bounds,
+                selected,
+                highlighted,
+                rulers,
+                1.0,
+                Qt::transparent,
+                true);
     } catch (const std::exception& e) {
       logger_->warn(
           GUI, 102, "An exception occurred during rendering: {}", e.what());
@@ -185,6 +188,36 @@ void RenderThread::draw(QImage& image,
                         const Rulers& rulers,
                         qreal render_ratio,
                         const QColor& background)
+{
+  drawImage(image,
+            draw_bounds,
+            selected,
+            highlighted,
+            rulers,
+            render_ratio,
+            background,
+            false);
+}
+
+void RenderThread::setupTransform(QPainter* painter,
+                                  const QRect& draw_bounds,
+                                  qreal render_ratio)
+{
+  // Setup the transform to map coordinates from dbu to pixels
+  painter->translate(-draw_bounds.topLeft());
+  painter->translate(viewer_->centering_shift_);
+  painter->scale(viewer_->pixels_per_dbu_, -viewer_->pixels_per_dbu_);
+  painter->scale(render_ratio, render_ratio);
+}
+
+void RenderThread::drawImage(QImage& image,
+                             const QRect& draw_bounds,
+                             const SelectionSet& selected,
+                             const HighlightSet& highlighted,
+                             const Rulers& rulers,
+                             qreal render_ratio,
+                             const QColor& background,
+                             bool use_block_cache)
 {
   if (image.isNull()) {
     return;
@@ -198,11 +231,7 @@ void RenderThread::draw(QImage& image,
   // Fill draw region with the background
   image.fill(background);
 
-  // Setup the transform to map coordinates from dbu to pixels
-  painter.translate(-draw_bounds.topLeft());
-  painter.translate(viewer_->centering_shift_);
-  painter.scale(viewer_->pixels_per_dbu_, -viewer_->pixels_per_dbu_);
-  painter.scale(render_ratio, render_ratio);
+  setupTransform(&painter, draw_bounds, render_ratio);
 
   const Rect dbu_bounds = viewer_->screenToDBU(draw_bounds);
 
@@ -221,7 +250,11 @@ void RenderThread::draw(QImage& image,
     image.fill(background);
   }
 
-  drawBlock(&painter, viewer_->block_, dbu_bounds, 0);
+  if (use_block_cache) {
+    drawCachedBlock(&painter, draw_bounds);
+  } else {
+    drawBlock(&painter, viewer_->block_, dbu_bounds, 0);
+  }
 
   // draw selected and over top level and fast painting events
   drawSelected(gui_painter, selected);
@@ -230,6 +263,64 @@ void RenderThread::draw(QImage& image,
   drawRulers(gui_painter, rulers);
 }
 
+void RenderThread::drawCachedBlock(QPainter* painter, const QRect& draw_bounds)
+{
+  const bool reuse
+      = block_cache_.generation == render_generation_
+        && block_cache_.pixels_per_dbu == viewer_->pixels_per_dbu_
+        && block_cache_.centering_shift == viewer_->centering_shift_
+        && block_cache_.bounds.intersects(draw_bounds);
+
+  QImage block_image(draw_bounds.size(), QImage::Format_ARGB32_Premultiplied);
+  block_image.fill(Qt::transparent);
+
+  QRegion exposed(draw_bounds);
+  QPainter block_painter(&block_image);
+  if (reuse) {
+    const QRect overlap = block_cache_.bounds.intersected(draw_bounds);
+    block_painter.drawImage(overlap.topLeft() - draw_bounds.topLeft(),
+                            block_cache_.image,
+                            overlap.translated(-block_cache_.bounds.topLeft()));
+    exposed -= overlap;
+    debugPrint(logger_,
+               GUI,
+               "draw",
+               1,
+               "reusing {}x{} of cached block image",
+               overlap.width(),
+               overlap.height());
+  }
+  block_painter.setRenderHints(QPainter::Antialiasing);
+
+  // Only draw what is not covered by the cached image, clipping so shapes
+  // crossing into the copied area do not draw over it a second time.
+  for (const QRect& rect : exposed) {
+    if (restart_) {
+      break;
+    }
+    block_painter.save();
+    block_painter.setClipRect(rect.translated(-draw_bounds.topLeft()));
+    setupTransform(&block_painter, draw_bounds, 1.0);
+    drawBlock(&block_painter, viewer_->block_, viewer_->screenToDBU(rect), 0);
+    block_painter.restore();
+  }
+  block_painter.end();
+
+  painter->save();
+  painter->resetTransform();
+  painter->drawImage(0, 0, block_image);
+  painter->restore();
+
+  // An interrupted render is incomplete and must not be reused
+  if (!restart_) {
+    block_cache_.image = block_image;
+    block_cache_.bounds = draw_bounds;
+    block_cache_.pixels_per_dbu = viewer_->pixels_per_dbu_;
+    block_cache_.centering_shift = viewer_->centering_shift_;
+    block_cache_.generation = render_generation_;
+  }
+}
+
 QColor RenderThread::getColor(dbTechLayer* layer)
 {
   return viewer_->options_->color(layer);
@@ -548,7 +639,7 @@ void RenderThread::drawInstanceShapes(dbTechLayer* layer,
                                                      instance_limit);
       child_insts.clear();
       child_insts.reserve(10000);
-      for (auto* inst : inst_range) {
+      for (const auto& [inst_box, inst] : inst_range) {
         if (viewer_->options_->isInstanceVisible(inst)) {
           child_insts.push_back(inst);
         }
@@ -914,7 +1005,15 @@ void RenderThread::drawLayer(QPainter* painter,
   painter->setBrush(QBrush(color, brush_pattern));
   painter->setPen(QPen(color, 0));
   if (draw_shapes) {
-    if (draw_routing || draw_vias) {
+    if (draw_routing && draw_vias
+        && drawBoxShapeDensity(painter, block, layer, bounds)) {
+      debugPrint(logger_,
+                 GUI,
+                 "draw",
+                 1,
+                 "layer {} drawn as density",
+                 layer->getName());
+    } else if (draw_routing || draw_vias) {
       auto box_iter = viewer_->search_.searchBoxShapes(block,
                                                        layer,
                                                        bounds.xMin(),
@@ -1052,6 +1151,84 @@ void RenderThread::drawLayer(QPainter* painter,
              layer_timer);
 }
 
+// When zoomed out far enough that a density bin is no larger than a pixel
+// draw the coverage of the routing shapes rather than each shape.  Returns
+// false if the shapes need to be drawn individually.
+bool RenderThread::drawBoxShapeDensity(QPainter* painter,
+                                       odb::dbBlock* block,
+                                       dbTechLayer* layer,
+                                       const Rect& bounds)
+{
+  // the density can't honor a net focus
+  if (!viewer_->focus_nets_.empty()) {
+    return false;
+  }
+
+  const Search::LayerDensity* density
+      = viewer_->search_.searchBoxShapeDensity(block, layer);
+  if (density == nullptr || density->levels.empty()) {
+    return false;
+  }
+  // nor can it hide a single net type
+  for (odb::dbNet* net : density->nets) {
+    if (!viewer_->options_->isNetVisible(net)) {
+      return false;
+    }
+  }
+
+  const qreal pixels_per_dbu = viewer_->pixels_per_dbu_;
+  if (density->levels[0].bin_size * pixels_per_dbu > 1.0) {
+    return false;
+  }
+
+  // Use the finest level with bins of at least a pixel
+  const Search::DensityLevel* level = &density->levels.back();
+  for (const auto& candidate : density->levels) {
+    if (candidate.bin_size * pixels_per_dbu >= 1.0) {
+      level = &candidate;
+      break;
+    }
+  }
+
+  const Rect& area = density->bounds;
+  if (!bounds.overlaps(area)) {
+    return true;
+  }
+  const int bin_size = level->bin_size;
+  const int x_lo = std::max(0, (bounds.xMin() - area.xMin()) / bin_size);
+  const int x_hi
+      = std::min(level->x_bins - 1, (bounds.xMax() - area.xMin()) / bin_size);
+  const int y_lo = std::max(0, (bounds.yMin() - area.yMin()) / bin_size);
+  const int y_hi
+      = std::min(level->y_bins - 1, (bounds.yMax() - area.yMin()) / bin_size);
+  if (x_lo > x_hi || y_lo > y_hi) {
+    return true;
+  }
+
+  // Row 0 of the image is the lowest row of bins, which the flipped y axis
+  // of the painter puts at the bottom.
+  const QColor color = getColor(layer);
+  QImage image(
+      x_hi - x_lo + 1, y_hi - y_lo + 1, QImage::Format_ARGB32_Premultiplied);
+  for (int y = y_lo; y <= y_hi; y++) {
+    QRgb* line = reinterpret_cast<QRgb*>(image.scanLine(y - y_lo));
+    const uint8_t* coverage
+        = level->coverage.data() + y * (size_t) level->x_bins;
+    for (int x = x_lo; x <= x_hi; x++) {
+      const int alpha = color.alpha() * coverage[x] / 255;
+      line[x - x_lo] = qPremultiply(
+          qRgba(color.red(), color.green(), color.blue(), alpha));
+    }
+  }
+
+  painter->drawImage(QRectF(area.xMin() + x_lo * (qreal) bin_size,
+                            area.yMin() + y_lo * (qreal) bin_size,
+                            image.width() * (qreal) bin_size,
+                            image.height() * (qreal) bin_size),
+                     image);
+  return true;
+}
+
 // Draw the region of the block.  Depth is not yet used but
 // is there for hierarchical design support.
 void RenderThread::drawBlock(QPainter* painter,
@@ -1098,7 +1275,7 @@ void RenderThread::drawBlock(QPainter* painter,
   // for each layer.
   std::vector<dbInst*> insts;
   insts.reserve(10000);
-  for (auto* inst : inst_range) {
+  for (const auto& [inst_box, inst] : inst_range) {
     if (restart_) {
       break;
     }
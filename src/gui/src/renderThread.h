@@ -36,6 +36,7 @@
 #include <QPainter>
 #include <QThread>
 #include <QWaitCondition>
+#include <atomic>
 #include <mutex>
 
 #include "gui/gui.h"
@@ -76,12 +77,29 @@ class RenderThread : public QThread
   bool isFirstRenderDone() { return is_first_render_done_; };
   bool isRendering() { return is_rendering_; };
 
+  // Discard the cached block image so the next render redraws everything.
+  // Must be called whenever anything but the view position changes.
+  void invalidateBlockCache() { block_cache_generation_++; }
+
  signals:
   void done(const QImage& image, const QRect& bounds);
 
  private:
   void run() override;
 
+  void drawImage(QImage& image,
+                 const QRect& draw_bounds,
+                 const SelectionSet& selected,
+                 const HighlightSet& highlighted,
+                 const Rulers& rulers,
+                 qreal render_ratio,
+                 const QColor& background,
+                 bool use_block_cache);
+  void drawCachedBlock(QPainter* painter, const QRect& draw_bounds);
+  void setupTransform(QPainter* painter,
+                      const QRect& draw_bounds,
+                      qreal render_ratio);
+
   void setupIOPins(odb::dbBlock* block, const odb::Rect& bounds);
 
   void drawBlock(QPainter* painter,
@@ -94,6 +112,10 @@ class RenderThread : public QThread
                  const std::vector<odb::dbInst*>& insts,
                  const odb::Rect& bounds,
                  GuiPainter& gui_painter);
+  bool drawBoxShapeDensity(QPainter* painter,
+                           odb::dbBlock* block,
+                           odb::dbTechLayer* layer,
+                           const odb::Rect& bounds);
   void drawRegions(QPainter* painter, odb::dbBlock* block);
   void drawTracks(odb::dbTechLayer* layer,
                   QPainter* painter,
@@ -177,6 +199,22 @@ class RenderThread : public QThread
   bool is_rendering_ = false;
   bool is_first_render_done_ = false;
 
+  // The block (without selection, highlight and rulers) as drawn by the
+  // last completed render.  When the view is only panned the overlapping
+  // part is copied and just the newly exposed area is drawn.
+  struct BlockCache
+  {
+    QImage image;
+    QRect bounds;
+    qreal pixels_per_dbu = 0;
+    QPoint centering_shift;
+    int generation = -1;
+  };
+  BlockCache block_cache_;
+  std::atomic<int> block_cache_generation_ = 0;
+  // generation captured when the current render started
+  int render_generation_ = 0;
+
   QFont pin_font_;
   bool pin_draw_names_ = false;
   double pin_max_size_ = 0.0;
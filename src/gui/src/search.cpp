@@ -32,6 +32,9 @@
 
 #include "search.h"
 
+#include <algorithm>
+#include <cmath>
+#include <iterator>
 #include <tuple>
 #include <utility>
 
@@ -48,20 +51,29 @@ Search::~Search()
 
 void Search::inDbNetDestroy(odb::dbNet* net)
 {
-  clearShapes();
+  // special wires and pins have already been destroyed, clearing the shapes
+  queueNet(net, false);
 }
 
 void Search::inDbInstDestroy(odb::dbInst* inst)
 {
   if (inst->isPlaced()) {
-    clearInsts();
+    queueInst(inst, false);
+  }
+}
+
+void Search::inDbInstSwapMasterBefore(odb::dbInst* inst,
+                                      odb::dbMaster* /* master */)
+{
+  if (inst->isPlaced()) {
+    queueInst(inst, false);
   }
 }
 
 void Search::inDbInstSwapMasterAfter(odb::dbInst* inst)
 {
   if (inst->isPlaced()) {
-    clearInsts();
+    queueInst(inst, true);
   }
 }
 
@@ -69,14 +81,30 @@ void Search::inDbInstPlacementStatusBefore(odb::dbInst* inst,
                                            const odb::dbPlacementStatus& status)
 {
   if (inst->getPlacementStatus().isPlaced() != status.isPlaced()) {
-    clearInsts();
+    queueInst(inst, status.isPlaced());
+  }
+}
+
+void Search::inDbPreMoveInst(odb::dbInst* inst)
+{
+  if (inst->isPlaced()) {
+    queueInst(inst, false);
   }
 }
 
 void Search::inDbPostMoveInst(odb::dbInst* inst)
 {
   if (inst->isPlaced()) {
-    clearInsts();
+    queueInst(inst, true);
+  }
+}
+
+void Search::inDbPostMoveInsts(const std::vector<odb::dbInst*>& insts)
+{
+  for (odb::dbInst* inst : insts) {
+    if (inst->isPlaced()) {
+      queueInst(inst, true);
+    }
   }
 }
 
@@ -97,12 +125,16 @@ void Search::inDbFillCreate(odb::dbFill* fill)
 
 void Search::inDbWireCreate(odb::dbWire* wire)
 {
-  clearShapes();
+  if (odb::dbNet* net = wire->getNet()) {
+    queueNet(net, true);
+  }
 }
 
 void Search::inDbWireDestroy(odb::dbWire* wire)
 {
-  clearShapes();
+  if (odb::dbNet* net = wire->getNet()) {
+    queueNet(net, true);
+  }
 }
 
 void Search::inDbSWireCreate(odb::dbSWire* wire)
@@ -167,7 +199,9 @@ void Search::inDbRowDestroy(odb::dbRow* row)
 
 void Search::inDbWirePostModify(odb::dbWire* wire)
 {
-  clearShapes();
+  if (odb::dbNet* net = wire->getNet()) {
+    queueNet(net, true);
+  }
 }
 
 void Search::setTopBlock(odb::dbBlock* block)
@@ -245,6 +279,127 @@ void Search::clearRows()
   announceModified(top_block_data_.rows_init_);
 }
 
+void Search::queueInst(odb::dbInst* inst, bool insert)
+{
+  BlockData& data = top_block_data_;
+  if (!data.insts_init_) {
+    return;  // the next build will see the change
+  }
+
+  bool first_change;
+  bool rebuild;
+  {
+    std::lock_guard<std::mutex> lock(data.pending_mutex_);
+    first_change = data.insts_pending_.empty();
+    data.insts_pending_.push_back({{inst->getBBox()->getBox(), inst}, insert});
+    // Past this many changes rebuilding is cheaper than updating
+    rebuild = data.insts_pending_.size() > data.insts_.size() / 4;
+    if (rebuild) {
+      data.insts_pending_.clear();
+    }
+  }
+
+  if (rebuild) {
+    clearInsts();
+  } else if (first_change) {
+    emit modified();
+  }
+}
+
+void Search::queueNet(odb::dbNet* net, bool exists)
+{
+  BlockData& data = top_block_data_;
+  if (!data.shapes_init_) {
+    return;  // the next build will see the change
+  }
+
+  bool first_change;
+  bool rebuild;
+  {
+    std::lock_guard<std::mutex> lock(data.pending_mutex_);
+    first_change = data.shapes_pending_.empty();
+    data.shapes_pending_[net] = exists;
+    // Past this many changes rebuilding is cheaper than updating
+    rebuild = data.shapes_pending_.size() > data.net_bounds_.size() / 4;
+    if (rebuild) {
+      data.shapes_pending_.clear();
+    }
+  }
+
+  if (rebuild) {
+    clearShapes();
+  } else if (first_change) {
+    emit modified();
+  }
+}
+
+void Search::applyInstChanges(BlockData& data)
+{
+  std::lock_guard<std::mutex> lock(data.insts_init_mutex_);
+  std::vector<std::pair<RectValue<odb::dbInst*>, bool>> pending;
+  {
+    std::lock_guard<std::mutex> pending_lock(data.pending_mutex_);
+    pending.swap(data.insts_pending_);
+  }
+
+  for (const auto& [value, insert] : pending) {
+    if (insert) {
+      data.insts_.insert(value);
+    } else {
+      data.insts_.remove(value);
+    }
+  }
+}
+
+void Search::applyShapeChanges(BlockData& data)
+{
+  std::lock_guard<std::mutex> lock(data.shapes_init_mutex_);
+  std::map<odb::dbNet*, bool> pending;
+  {
+    std::lock_guard<std::mutex> pending_lock(data.pending_mutex_);
+    pending.swap(data.shapes_pending_);
+  }
+
+  for (const auto& [net, exists] : pending) {
+    // Remove the shapes from the net's previous state, the net may
+    // already have been destroyed so only the pointer can be used.
+    auto bounds_it = data.net_bounds_.find(net);
+    if (bounds_it != data.net_bounds_.end()) {
+      auto is_net = [net = net](const RouteBoxValue<odb::dbNet*>& value) {
+        return std::get<2>(value) == net;
+      };
+      for (auto& [layer, rtree] : data.box_shapes_) {
+        std::vector<RouteBoxValue<odb::dbNet*>> shapes;
+        rtree.query(
+            bgi::intersects(bounds_it->second) && bgi::satisfies(is_net),
+            std::back_inserter(shapes));
+        for (const auto& shape : shapes) {
+          rtree.remove(shape);
+        }
+        if (!shapes.empty() && data.box_density_.count(layer) != 0) {
+          data.box_density_stale_.insert(layer);
+        }
+      }
+      data.net_bounds_.erase(bounds_it);
+    }
+
+    if (!exists) {
+      continue;
+    }
+    LayerMap<std::vector<RouteBoxValue<odb::dbNet*>>> net_shapes;
+    const odb::Rect bounds = addNet(net, net_shapes);
+    for (const auto& [layer, layer_shapes] : net_shapes) {
+      data.box_shapes_[layer].insert(layer_shapes.begin(), layer_shapes.end());
+      if (data.box_density_.count(layer) != 0) {
+        data.box_density_stale_.insert(layer);
+      }
+    }
+    if (!bounds.isInverted()) {
+      data.net_bounds_[net] = bounds;
+    }
+  }
+}
+
 Search::BlockData& Search::getData(odb::dbBlock* block)
 {
   return block == top_block_ ? top_block_data_ : child_block_data_[block];
@@ -258,7 +413,16 @@ void Search::updateShapes(odb::dbBlock* block)
     return;  // already done by another thread
   }
 
+  {
+    // The rebuild picks up any queued changes
+    std::lock_guard<std::mutex> pending_lock(data.pending_mutex_);
+    data.shapes_pending_.clear();
+  }
+
   data.box_shapes_.clear();
+  data.box_density_.clear();
+  data.box_density_stale_.clear();
+  data.net_bounds_.clear();
   data.snet_via_shapes_.clear();
   data.snet_shapes_.clear();
 
@@ -280,33 +444,111 @@ void Search::updateShapes(odb::dbBlock* block)
 
   LayerMap<std::vector<RouteBoxValue<odb::dbNet*>>> net_shapes;
   for (odb::dbNet* net : block->getNets()) {
-    addNet(net, net_shapes);
-  }
-
-  for (odb::dbBTerm* term : block->getBTerms()) {
-    for (odb::dbBPin* pin : term->getBPins()) {
-      odb::dbPlacementStatus status = pin->getPlacementStatus();
-      if (status == odb::dbPlacementStatus::NONE
-          || status == odb::dbPlacementStatus::UNPLACED) {
-        continue;
-      }
-      for (odb::dbBox* box : pin->getBoxes()) {
-        if (!box) {
-          continue;
-        }
-        odb::dbTechLayer* layer = box->getTechLayer();
-        net_shapes[layer].emplace_back(box->getBox(), false, term->getNet());
-      }
+    const odb::Rect bounds = addNet(net, net_shapes);
+    if (!bounds.isInverted()) {
+      data.net_bounds_[net] = bounds;
     }
   }
+  const odb::Rect die_area = block->getDieArea();
   for (const auto& [layer, layer_shapes] : net_shapes) {
     data.box_shapes_[layer] = RtreeRoutingShapes<odb::dbNet*>(
         layer_shapes.begin(), layer_shapes.end());
+    if (layer_shapes.size() >= density_min_shapes_ && die_area.area() > 0) {
+      data.box_density_[layer] = makeDensity(die_area, layer_shapes);
+    }
   }
 
   data.shapes_init_ = true;
 }
 
+Search::LayerDensity Search::makeDensity(
+    const odb::Rect& bounds,
+    const std::vector<RouteBoxValue<odb::dbNet*>>& shapes)
+{
+  LayerDensity density;
+  density.bounds = bounds;
+
+  const int max_dim = std::max(bounds.dx(), bounds.dy());
+  int bin_size
+      = std::max(1, (max_dim + density_max_bins_ - 1) / density_max_bins_);
+  int x_bins = std::max(1, (bounds.dx() + bin_size - 1) / bin_size);
+  int y_bins = std::max(1, (bounds.dy() + bin_size - 1) / bin_size);
+
+  // Accumulate the covered area of each bin
+  std::vector<double> coverage(x_bins * (size_t) y_bins, 0.0);
+  for (const auto& [rect, is_via, net] : shapes) {
+    if (net != nullptr) {
+      const auto type = net->getSigType().getValue();
+      const bool seen = std::any_of(
+          density.nets.begin(), density.nets.end(), [type](odb::dbNet* other) {
+            return other->getSigType().getValue() == type;
+          });
+      if (!seen) {
+        density.nets.push_back(net);
+      }
+    }
+    if (!rect.overlaps(bounds)) {
+      continue;
+    }
+    odb::Rect box;
+    rect.intersection(bounds, box);
+    const int x_lo = (box.xMin() - bounds.xMin()) / bin_size;
+    const int x_hi = std::min(
+        x_bins - 1, std::max(0, box.xMax() - bounds.xMin() - 1) / bin_size);
+    const int y_lo = (box.yMin() - bounds.yMin()) / bin_size;
+    const int y_hi = std::min(
+        y_bins - 1, std::max(0, box.yMax() - bounds.yMin() - 1) / bin_size);
+    for (int y = y_lo; y <= y_hi; y++) {
+      const int bin_y_lo = bounds.yMin() + y * bin_size;
+      const double dy = std::min(box.yMax(), bin_y_lo + bin_size)
+                        - std::max(box.yMin(), bin_y_lo);
+      for (int x = x_lo; x <= x_hi; x++) {
+        const int bin_x_lo = bounds.xMin() + x * bin_size;
+        const double dx = std::min(box.xMax(), bin_x_lo + bin_size)
+                          - std::max(box.xMin(), bin_x_lo);
+        coverage[y * (size_t) x_bins + x] += dx * dy;
+      }
+    }
+  }
+  const double bin_area = static_cast<double>(bin_size) * bin_size;
+  for (double& value : coverage) {
+    // overlapping shapes can add up to more than the bin
+    value = std::min(1.0, value / bin_area);
+  }
+
+  // Store this level and merge 2x2 bins into the next until a single bin
+  // covers the whole area
+  while (true) {
+    DensityLevel& level = density.levels.emplace_back();
+    level.bin_size = bin_size;
+    level.x_bins = x_bins;
+    level.y_bins = y_bins;
+    level.coverage.reserve(coverage.size());
+    for (const double value : coverage) {
+      level.coverage.push_back(std::lround(value * 255));
+    }
+    if (x_bins == 1 && y_bins == 1) {
+      break;
+    }
+
+    const int next_x_bins = (x_bins + 1) / 2;
+    const int next_y_bins = (y_bins + 1) / 2;
+    std::vector<double> next(next_x_bins * (size_t) next_y_bins, 0.0);
+    for (int y = 0; y < y_bins; y++) {
+      for (int x = 0; x < x_bins; x++) {
+        next[(y / 2) * (size_t) next_x_bins + x / 2]
+            += coverage[y * (size_t) x_bins + x] / 4;
+      }
+    }
+    coverage.swap(next);
+    x_bins = next_x_bins;
+    y_bins = next_y_bins;
+    bin_size *= 2;
+  }
+
+  return density;
+}
+
 void Search::updateFills(odb::dbBlock* block)
 {
   BlockData& data = getData(block);
@@ -336,15 +578,21 @@ void Search::updateInsts(odb::dbBlock* block)
     return;  // already done by another thread
   }
 
+  {
+    // The rebuild picks up any queued changes
+    std::lock_guard<std::mutex> pending_lock(data.pending_mutex_);
+    data.insts_pending_.clear();
+  }
+
   data.insts_.clear();
 
-  std::vector<odb::dbInst*> insts;
+  std::vector<RectValue<odb::dbInst*>> insts;
   for (odb::dbInst* inst : block->getInsts()) {
     if (inst->isPlaced()) {
-      insts.push_back(inst);
+      insts.emplace_back(inst->getBBox()->getBox(), inst);
     }
   }
-  data.insts_ = RtreeDBox<odb::dbInst*>(insts.begin(), insts.end());
+  data.insts_ = RtreeRect<odb::dbInst*>(insts.begin(), insts.end());
 
   data.insts_init_ = true;
 }
@@ -462,14 +710,35 @@ void Search::addSNet(
   }
 }
 
-void Search::addNet(
+odb::Rect Search::addNet(
     odb::dbNet* net,
     LayerMap<std::vector<RouteBoxValue<odb::dbNet*>>>& tree_shapes)
 {
+  odb::Rect bounds;
+  bounds.mergeInit();
+
+  for (odb::dbBTerm* term : net->getBTerms()) {
+    for (odb::dbBPin* pin : term->getBPins()) {
+      odb::dbPlacementStatus status = pin->getPlacementStatus();
+      if (status == odb::dbPlacementStatus::NONE
+          || status == odb::dbPlacementStatus::UNPLACED) {
+        continue;
+      }
+      for (odb::dbBox* box : pin->getBoxes()) {
+        if (!box) {
+          continue;
+        }
+        odb::dbTechLayer* layer = box->getTechLayer();
+        tree_shapes[layer].emplace_back(box->getBox(), false, net);
+        bounds.merge(box->getBox());
+      }
+    }
+  }
+
   odb::dbWire* wire = net->getWire();
 
   if (wire == nullptr) {
-    return;
+    return bounds;
   }
 
   odb::dbWireShapeItr itr;
@@ -481,7 +750,11 @@ void Search::addNet(
     } else {
       tree_shapes[s.getTechLayer()].emplace_back(s.getBox(), false, net);
     }
+    // the box of a via covers all of its shapes
+    bounds.merge(s.getBox());
   }
+
+  return bounds;
 }
 
 template <typename T>
@@ -570,11 +843,6 @@ class Search::MinHeightPredicate
 
   bool operator()(const RectValue<T>& o) const { return checkBox(o.first); }
 
-  bool operator()(odb::dbInst* o) const
-  {
-    return checkBox(o->getBBox()->getBox());
-  }
-
   bool operator()(odb::dbBlockage* o) const
   {
     return checkBox(o->getBBox()->getBox());
@@ -597,6 +865,8 @@ Search::RoutingRange Search::searchBoxShapes(odb::dbBlock* block,
   BlockData& data = getData(block);
   if (!data.shapes_init_) {
     updateShapes(block);
+  } else {
+    applyShapeChanges(data);
   }
 
   auto it = data.box_shapes_.find(layer);
@@ -618,6 +888,34 @@ Search::RoutingRange Search::searchBoxShapes(odb::dbBlock* block,
   return RoutingRange(rtree.qbegin(bgi::intersects(query)), rtree.qend());
 }
 
+const Search::LayerDensity* Search::searchBoxShapeDensity(
+    odb::dbBlock* block,
+    odb::dbTechLayer* layer)
+{
+  BlockData& data = getData(block);
+  if (!data.shapes_init_) {
+    updateShapes(block);
+  } else {
+    applyShapeChanges(data);
+  }
+
+  auto it = data.box_density_.find(layer);
+  if (it == data.box_density_.end()) {
+    return nullptr;
+  }
+
+  std::lock_guard<std::mutex> lock(data.shapes_init_mutex_);
+  if (data.box_density_stale_.erase(layer) != 0) {
+    // redo the density from the updated shapes
+    const auto& rtree = data.box_shapes_[layer];
+    const std::vector<RouteBoxValue<odb::dbNet*>> shapes(rtree.begin(),
+                                                         rtree.end());
+    it->second = makeDensity(it->second.bounds, shapes);
+  }
+
+  return &it->second;
+}
+
 Search::SNetSBoxRange Search::searchSNetViaShapes(odb::dbBlock* block,
                                                   odb::dbTechLayer* layer,
                                                   int x_lo,
@@ -728,6 +1026,8 @@ Search::InstRange Search::searchInsts(odb::dbBlock* block,
   BlockData& data = getData(block);
   if (!data.insts_init_) {
     updateInsts(block);
+  } else {
+    applyInstChanges(data);
   }
 
   const odb::Rect query(x_lo, y_lo, x_hi, y_hi);
@@ -35,7 +35,11 @@
 #include <QObject>
 #include <boost/geometry.hpp>
 #include <boost/geometry/index/rtree.hpp>
+#include <cstdint>
+#include <map>
 #include <mutex>
+#include <set>
+#include <vector>
 
 #include "odb/db.h"
 #include "odb/dbBlockCallBackObj.h"
@@ -51,8 +55,10 @@ namespace bgi = boost::geometry::index;
 // rtree.  OpenDB also has some code for this purpose but I
 // find it confusing so just made a simpler solution for now.
 //
-// Currently this class is static once built and doesn't follow
-// db changes.  TODO: this should be into an observer of OpenDB.
+// The trees are built on first use.  Instance changes and changes to the
+// wires of regular nets are queued by the db callbacks and applied to the
+// trees before the next search; other changes, or too many queued ones,
+// cause the affected trees to be rebuilt.
 class Search : public QObject, public odb::dbBlockCallBackObj
 {
   Q_OBJECT
@@ -140,7 +146,7 @@ class Search : public QObject, public odb::dbBlockCallBackObj
     Iterator begin_;
     Iterator end_;
   };
-  using InstRange = Range<RtreeDBox<odb::dbInst*>>;
+  using InstRange = Range<RtreeRect<odb::dbInst*>>;
   using RoutingRange = Range<RtreeRoutingShapes<odb::dbNet*>>;
   using SNetSBoxRange = Range<RtreeSNetDBoxShapes<odb::dbNet*>>;
   using SNetShapeRange = Range<RtreeSNetShapes<odb::dbNet*>>;
@@ -149,6 +155,25 @@ class Search : public QObject, public odb::dbBlockCallBackObj
   using BlockageRange = Range<RtreeDBox<odb::dbBlockage*>>;
   using RowRange = Range<RtreeRect<odb::dbRow*>>;
 
+  // Fraction of a layer covered by routing box shapes, binned on a grid
+  // over the die area.  Each level merges 2x2 bins of the one before it,
+  // so zoomed out views can draw a raster instead of every shape.
+  struct DensityLevel
+  {
+    int bin_size;  // in dbu
+    int x_bins;
+    int y_bins;
+    // 0 (empty) to 255 (full), row major starting from the lower left bin
+    std::vector<uint8_t> coverage;
+  };
+  struct LayerDensity
+  {
+    odb::Rect bounds;
+    // One net of each signal type on the layer to check the visibility of
+    std::vector<odb::dbNet*> nets;
+    std::vector<DensityLevel> levels;
+  };
+
   ~Search();
 
   // Build the structure for the given block.
@@ -164,6 +189,11 @@ class Search : public QObject, public odb::dbBlockCallBackObj
                                int y_hi,
                                int min_size = 0);
 
+  // Get the density of the box shapes on the given layer, or nullptr if
+  // the layer has too few shapes to be worth summarizing.
+  const LayerDensity* searchBoxShapeDensity(odb::dbBlock* block,
+                                            odb::dbTechLayer* layer);
+
   // Find all via sbox shapes in the given bounds on the given layer which
   // are at least min_size in either dimension.
   SNetSBoxRange searchSNetViaShapes(odb::dbBlock* block,
@@ -238,11 +268,15 @@ class Search : public QObject, public odb::dbBlockCallBackObj
   // From dbBlockCallBackObj
   void inDbNetDestroy(odb::dbNet* net) override;
   void inDbInstDestroy(odb::dbInst* inst) override;
+  void inDbInstSwapMasterBefore(odb::dbInst* inst,
+                                odb::dbMaster* master) override;
   void inDbInstSwapMasterAfter(odb::dbInst* inst) override;
   void inDbInstPlacementStatusBefore(
       odb::dbInst* inst,
       const odb::dbPlacementStatus& status) override;
+  void inDbPreMoveInst(odb::dbInst* inst) override;
   void inDbPostMoveInst(odb::dbInst* inst) override;
+  void inDbPostMoveInsts(const std::vector<odb::dbInst*>& insts) override;
   void inDbBPinCreate(odb::dbBPin* pin) override;
   void inDbBPinDestroy(odb::dbBPin* pin) override;
   void inDbFillCreate(odb::dbFill* fill) override;
@@ -272,14 +306,25 @@ class Search : public QObject, public odb::dbBlockCallBackObj
   void addSNet(odb::dbNet* net,
                LayerMap<std::vector<SNetValue<odb::dbNet*>>>& net_shapes,
                LayerMap<std::vector<SNetDBoxValue<odb::dbNet*>>>& via_shapes);
-  void addNet(odb::dbNet* net,
-              LayerMap<std::vector<RouteBoxValue<odb::dbNet*>>>& tree_shapes);
+  // Returns the bounds of the shapes added
+  odb::Rect addNet(
+      odb::dbNet* net,
+      LayerMap<std::vector<RouteBoxValue<odb::dbNet*>>>& tree_shapes);
   void addVia(odb::dbNet* net,
               odb::dbShape* shape,
               int x,
               int y,
               LayerMap<std::vector<RouteBoxValue<odb::dbNet*>>>& tree_shapes);
 
+  static LayerDensity makeDensity(
+      const odb::Rect& bounds,
+      const std::vector<RouteBoxValue<odb::dbNet*>>& shapes);
+
+  void queueInst(odb::dbInst* inst, bool insert);
+  void queueNet(odb::dbNet* net, bool exists);
+  void applyInstChanges(BlockData& data);
+  void applyShapeChanges(BlockData& data);
+
   void updateShapes(odb::dbBlock* block);
   void updateFills(odb::dbBlock* block);
   void updateInsts(odb::dbBlock* block);
@@ -292,12 +337,22 @@ class Search : public QObject, public odb::dbBlockCallBackObj
   void announceModified(std::atomic_bool& flag);
   BlockData& getData(odb::dbBlock* block);
 
+  // Layers with fewer box shapes than this are cheap enough to always draw
+  static constexpr size_t density_min_shapes_ = 100000;
+  // Limit on the number of density bins along the longer side of the die
+  static constexpr int density_max_bins_ = 2048;
+
   odb::dbBlock* top_block_{nullptr};
 
   struct BlockData
   {
     // The net is used for filter shapes by net type
     LayerMap<RtreeRoutingShapes<odb::dbNet*>> box_shapes_;
+    LayerMap<LayerDensity> box_density_;
+    // Layers whose density no longer matches box_shapes_
+    std::set<odb::dbTechLayer*> box_density_stale_;
+    // Bounds of the box shapes of each net, to find them for removal
+    std::map<odb::dbNet*, odb::Rect> net_bounds_;
     // Special net vias may be large multi-cut vias.  It is more efficient
     // to store the dbSBox (ie the via) than all the cuts.  This is
     // particularly true when you have parallel straps like m1 & m2 in asap7.
@@ -308,7 +363,7 @@ class Search : public QObject, public odb::dbBlockCallBackObj
     LayerMap<RtreeFill> fills_;
     std::atomic_bool fills_init_{false};
     std::mutex fills_init_mutex_;
-    RtreeDBox<odb::dbInst*> insts_;
+    RtreeRect<odb::dbInst*> insts_;
     std::atomic_bool insts_init_{false};
     std::mutex insts_init_mutex_;
     RtreeDBox<odb::dbBlockage*> blockages_;
@@ -320,6 +375,13 @@ class Search : public QObject, public odb::dbBlockCallBackObj
     RtreeRect<odb::dbRow*> rows_;
     std::atomic_bool rows_init_{false};
     std::mutex rows_init_mutex_;
+
+    // Changes since the trees were built, applied before the next search.
+    // Instances are queued with the box to insert or remove and nets with
+    // whether they still exist.
+    std::vector<std::pair<RectValue<odb::dbInst*>, bool>> insts_pending_;
+    std::map<odb::dbNet*, bool> shapes_pending_;
+    std::mutex pending_mutex_;
   };
   std::map<odb::dbBlock*, BlockData> child_block_data_;
   BlockData top_block_data_;
@@ -38,15 +38,24 @@
 #include <QAbstractItemView>
 #include <QAction>
 #include <QApplication>
+#include <QEventLoop>
 #include <QKeyEvent>
 #include <QLineEdit>
 #include <QMenu>
+#include <QProgressDialog>
 #include <QPushButton>
 #include <QStandardItemModel>
+#include <QTimer>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <fstream>
+#include <future>
 #include <iostream>
 #include <limits>
+#include <mutex>
 #include <string>
+#include <tuple>
 
 #include "dbDescriptors.h"
 #include "db_sta/dbNetwork.hh"
@@ -208,9 +217,38 @@ void TimingPathsModel::resetModel()
 {
   beginResetModel();
   timing_paths_.clear();
+  current_query_.reset();
   endResetModel();
 }
 
+void TimingPathsModel::clearCache()
+{
+  current_query_.reset();
+  path_cache_.clear();
+}
+
+bool TimingPathsModel::PathQuery::operator==(const PathQuery& other) const
+{
+  return std::tie(from,
+                  thru,
+                  to,
+                  path_group_name,
+                  corner,
+                  max_path_count,
+                  one_path_per_endpoint,
+                  include_unconstrained,
+                  include_capture_path)
+         == std::tie(other.from,
+                     other.thru,
+                     other.to,
+                     other.path_group_name,
+                     other.corner,
+                     other.max_path_count,
+                     other.one_path_per_endpoint,
+                     other.include_unconstrained,
+                     other.include_capture_path);
+}
+
 void TimingPathsModel::sort(int col_index, Qt::SortOrder sort_order)
 {
   std::function<bool(const std::unique_ptr<TimingPath>& path1,
@@ -283,34 +321,131 @@ void TimingPathsModel::sort(int col_index, Qt::SortOrder sort_order)
   endResetModel();
 }
 
-void TimingPathsModel::populateModel(
+bool TimingPathsModel::populateModel(
     const std::set<const sta::Pin*>& from,
     const std::vector<std::set<const sta::Pin*>>& thru,
     const std::set<const sta::Pin*>& to,
     const std::string& path_group_name)
 {
+  const PathQuery query{from,
+                        thru,
+                        to,
+                        path_group_name,
+                        sta_->getCorner(),
+                        sta_->getMaxPathCount(),
+                        sta_->isOnePathPerEndpoint(),
+                        sta_->isIncludeUnconstrainedPaths(),
+                        sta_->isIncludeCapturePaths()};
+
   beginResetModel();
+  if (current_query_) {
+    path_cache_.emplace_back(std::move(*current_query_),
+                             std::move(timing_paths_));
+    if (path_cache_.size() > path_cache_limit_) {
+      path_cache_.erase(path_cache_.begin());
+    }
+  }
+  current_query_.reset();
   timing_paths_.clear();
-  populatePaths(from, thru, to, path_group_name);
+
+  auto cached = std::find_if(
+      path_cache_.begin(), path_cache_.end(), [&query](const auto& entry) {
+        return entry.first == query;
+      });
+  if (cached != path_cache_.end()) {
+    timing_paths_ = std::move(cached->second);
+    path_cache_.erase(cached);
+    current_query_ = query;
+    endResetModel();
+    return true;
+  }
   endResetModel();
+
+  if (!populatePaths(query)) {
+    return false;
+  }
+  current_query_ = query;
+  return true;
 }
 
-bool TimingPathsModel::populatePaths(
-    const std::set<const sta::Pin*>& from,
-    const std::vector<std::set<const sta::Pin*>>& thru,
-    const std::set<const sta::Pin*>& to,
-    const std::string& path_group_name)
+bool TimingPathsModel::populatePaths(const PathQuery& query)
 {
-  // On lines of DataBaseHandler
-  QApplication::setOverrideCursor(Qt::WaitCursor);
+  std::mutex paths_mutex;
+  TimingPathList found_paths;
+  std::atomic<bool> canceled = false;
 
   const bool sta_max = sta_->isUseMax();
   sta_->setUseMax(is_setup_);
-  timing_paths_ = sta_->getTimingPaths(from, thru, to, path_group_name);
+  auto search = std::async(std::launch::async, [&]() {
+    sta_->getTimingPaths(query.from,
+                         query.thru,
+                         query.to,
+                         query.path_group_name,
+                         [&](std::unique_ptr<TimingPath> path) {
+                           std::unique_lock<std::mutex> guard(paths_mutex);
+                           found_paths.push_back(std::move(path));
+                           return !canceled;
+                         });
+  });
+
+  // Most searches are quick, only keep the gui responsive for slow ones.
+  // The dialog is modal so the design cannot change while STA is busy.
+  if (search.wait_for(std::chrono::milliseconds(500))
+      != std::future_status::ready) {
+    const QString label = is_setup_ ? "Finding setup paths: %1 found"
+                                    : "Finding hold paths: %1 found";
+    QProgressDialog progress(label.arg(0), "Cancel", 0, 0);
+    progress.setWindowModality(Qt::ApplicationModal);
+    progress.setAutoClose(false);
+    progress.setAutoReset(false);
+    progress.setMinimumDuration(0);
+    progress.show();
+
+    QEventLoop loop;
+    QTimer timer;
+    connect(&progress, &QProgressDialog::canceled, &loop, [&]() {
+      canceled = true;
+      progress.setLabelText("Canceling...");
+    });
+    connect(&timer, &QTimer::timeout, &loop, [&]() {
+      {
+        std::unique_lock<std::mutex> guard(paths_mutex);
+        appendPaths(found_paths);
+      }
+      if (!canceled) {
+        progress.setLabelText(label.arg(timing_paths_.size()));
+      }
+      if (search.wait_for(std::chrono::seconds(0))
+          == std::future_status::ready) {
+        loop.quit();
+      }
+    });
+    timer.start(100);
+    loop.exec();
+  }
+
+  search.wait();
   sta_->setUseMax(sta_max);
+  appendPaths(found_paths);
+  // rethrow any error from the search
+  search.get();
 
-  QApplication::restoreOverrideCursor();
-  return true;
+  return !canceled;
+}
+
+void TimingPathsModel::appendPaths(TimingPathList& paths)
+{
+  if (paths.empty()) {
+    return;
+  }
+
+  const int first_row = timing_paths_.size();
+  beginInsertRows(QModelIndex(), first_row, first_row + paths.size() - 1);
+  for (auto& path : paths) {
+    timing_paths_.push_back(std::move(path));
+  }
+  endInsertRows();
+  paths.clear();
 }
 
 /////////
@@ -46,7 +46,9 @@
 #include <QSpinBox>
 #include <map>
 #include <memory>
+#include <optional>
 #include <set>
+#include <string>
 #include <vector>
 
 #include "gui/gui.h"
@@ -119,23 +121,45 @@ class TimingPathsModel : public QAbstractTableModel
   TimingPath* getPathAt(const QModelIndex& index) const;
 
   void resetModel();
-  void populateModel(const std::set<const sta::Pin*>& from,
+  // Paths of a previous identical query are reused until clearCache.
+  // Returns false if the user canceled the search, the paths found up to
+  // that point are kept in the model.
+  bool populateModel(const std::set<const sta::Pin*>& from,
                      const std::vector<std::set<const sta::Pin*>>& thru,
                      const std::set<const sta::Pin*>& to,
                      const std::string& path_group_name);
+  void clearCache();
 
  public slots:
   void sort(int col_index, Qt::SortOrder sort_order) override;
 
  private:
-  bool populatePaths(const std::set<const sta::Pin*>& from,
-                     const std::vector<std::set<const sta::Pin*>>& thru,
-                     const std::set<const sta::Pin*>& to,
-                     const std::string& path_group_name);
+  struct PathQuery
+  {
+    std::set<const sta::Pin*> from;
+    std::vector<std::set<const sta::Pin*>> thru;
+    std::set<const sta::Pin*> to;
+    std::string path_group_name;
+    sta::Corner* corner;
+    int max_path_count;
+    bool one_path_per_endpoint;
+    bool include_unconstrained;
+    bool include_capture_path;
+
+    bool operator==(const PathQuery& other) const;
+  };
+
+  bool populatePaths(const PathQuery& query);
+  void appendPaths(TimingPathList& paths);
 
   STAGuiInterface* sta_;
   bool is_setup_;
   std::vector<std::unique_ptr<TimingPath>> timing_paths_;
+
+  // query the current paths are the complete result of
+  std::optional<PathQuery> current_query_;
+  std::vector<std::pair<PathQuery, TimingPathList>> path_cache_;
+  static constexpr size_t path_cache_limit_ = 8;
 };
 
 class TimingPathDetailModel : public QAbstractTableModel
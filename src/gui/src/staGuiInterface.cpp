@@ -1000,7 +1000,24 @@ TimingPathList STAGuiInterface::getTimingPaths(
     const std::string& path_group_name) const
 {
   TimingPathList paths;
+  getTimingPaths(from,
+                 thrus,
+                 to,
+                 path_group_name,
+                 [&paths](std::unique_ptr<TimingPath> path) {
+                   paths.push_back(std::move(path));
+                   return true;
+                 });
+  return paths;
+}
 
+void STAGuiInterface::getTimingPaths(
+    const StaPins& from,
+    const std::vector<StaPins>& thrus,
+    const StaPins& to,
+    const std::string& path_group_name,
+    const TimingPathCallback& path_found) const
+{
   initSTA();
 
   sta::ExceptionFrom* e_from = nullptr;
@@ -1120,10 +1137,10 @@ TimingPathList STAGuiInterface::getTimingPaths(
     timing_path->computeClkEndIndex();
     timing_path->setSlackOnPathNodes();
 
-    paths.emplace_back(timing_path);
+    if (!path_found(std::unique_ptr<TimingPath>(timing_path))) {
+      break;
+    }
   }
-
-  return paths;
 }
 
 ConeDepthMapPinSet STAGuiInterface::getFaninCone(const sta::Pin* pin) const
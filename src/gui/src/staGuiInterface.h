@@ -36,6 +36,7 @@
 #pragma once
 
 #include <QObject>
+#include <functional>
 #include <map>
 #include <memory>
 #include <set>
@@ -58,6 +59,8 @@ class TimingPathNode;
 class STAGuiInterface;
 
 using TimingPathList = std::vector<std::unique_ptr<TimingPath>>;
+// Receives each path as it is built, returns false to stop the search.
+using TimingPathCallback = std::function<bool(std::unique_ptr<TimingPath>)>;
 using TimingNodeList = std::vector<std::unique_ptr<TimingPathNode>>;
 using StaPins = std::set<const sta::Pin*>;
 using EndPointSlackMap = std::map<const sta::Pin*, float>;
@@ -363,6 +366,11 @@ class STAGuiInterface
                                 const StaPins& to,
                                 const std::string& path_group_name) const;
   TimingPathList getTimingPaths(const sta::Pin* thru) const;
+  void getTimingPaths(const StaPins& from,
+                      const std::vector<StaPins>& thrus,
+                      const StaPins& to,
+                      const std::string& path_group_name,
+                      const TimingPathCallback& path_found) const;
 
   std::unique_ptr<TimingPathNode> getTimingNode(const sta::Pin* pin) const;
 
@@ -569,6 +569,10 @@ void TimingWidget::populatePaths()
   const auto thru = settings_->getThruPins();
   const auto to = settings_->getToPins();
 
+  // an explicit update has to reflect the current timing
+  setup_timing_paths_model_->clearCache();
+  hold_timing_paths_model_->clearCache();
+
   populateAndSortModels(from, thru, to, "" /* path group name */);
 }
 
@@ -578,8 +582,13 @@ void TimingWidget::populateAndSortModels(
     const std::set<const sta::Pin*>& to,
     const std::string& path_group_name)
 {
-  setup_timing_paths_model_->populateModel(from, thru, to, path_group_name);
-  hold_timing_paths_model_->populateModel(from, thru, to, path_group_name);
+  if (setup_timing_paths_model_->populateModel(
+          from, thru, to, path_group_name)) {
+    hold_timing_paths_model_->populateModel(from, thru, to, path_group_name);
+  } else {
+    // canceled, do not leave hold paths of a different query around
+    hold_timing_paths_model_->resetModel();
+  }
 
   // honor selected sort
   auto setup_header = setup_timing_table_view_->horizontalHeader();
@@ -686,6 +695,8 @@ void TimingWidget::handleDbChange()
 
   setup_timing_paths_model_->resetModel();
   hold_timing_paths_model_->resetModel();
+  setup_timing_paths_model_->clearCache();
+  hold_timing_paths_model_->clearCache();
 }
 
 void TimingWidget::showEvent(QShowEvent* event)
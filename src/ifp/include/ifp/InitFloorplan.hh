@@ -112,6 +112,10 @@ class InitFloorplan
 
   double designArea();
   void makeRows(const odb::dbSite::RowPattern& pattern, const odb::Rect& core);
+  // Creates count rows, filling the parameters of each one with
+  // row_params(row, params) in parallel.
+  template <typename RowFunc>
+  void createRows(int count, const RowFunc& row_params);
   void makeUniformRows(odb::dbSite* base_site,
                        const SitesByName& sites_by_name,
                        const odb::Rect& core,
@@ -39,6 +39,7 @@
 #include <fstream>
 #include <iostream>
 #include <set>
+#include <vector>
 
 #include "db_sta/dbNetwork.hh"
 #include "odb/db.h"
@@ -51,6 +52,7 @@
 #include "sta/Vector.hh"
 #include "upf/upf.h"
 #include "utl/Logger.h"
+#include "utl/ThreadPool.h"
 #include "utl/validation.h"
 
 namespace ifp {
@@ -413,6 +415,17 @@ void InitFloorplan::addUsedSites(
   }
 }
 
+template <typename RowFunc>
+void InitFloorplan::createRows(const int count, const RowFunc& row_params)
+{
+  // Huge dies have hundreds of thousands of rows, their parameters are
+  // computed in parallel and the rows are created in one call.
+  std::vector<dbRow::Params> rows(count);
+  utl::ThreadPool::get().parallelFor(
+      0, count, [&](const int row) { row_params(row, rows[row]); });
+  dbRow::create(block_, rows);
+}
+
 // Create the rows for the core area
 void InitFloorplan::makeUniformRows(odb::dbSite* base_site,
                                     const SitesByName& sites_by_name,
@@ -443,22 +456,18 @@ void InitFloorplan::makeUniformRows(odb::dbSite* base_site,
         break;
     }
 
-    int y = core.yMin();
-    for (int row = 0; row < rows_y; row++) {
-      dbOrientType orient = (row % 2 == 0) ? dbOrientType::R0   // N
-                                           : dbOrientType::MX;  // FS
-      string row_name = fmt::format("ROW_{}", block_->getRows().size());
-      dbRow::create(block_,
-                    row_name.c_str(),
-                    site,
-                    core.xMin(),
-                    y,
-                    orient,
-                    dbRowDir::HORIZONTAL,
-                    rows_x,
-                    site_dx);
-      y += site_dy;
-    }
+    const int first_row = block_->getRows().size();
+    createRows(rows_y, [&](const int row, dbRow::Params& params) {
+      params.name = fmt::format("ROW_{}", first_row + row);
+      params.site = site;
+      params.origin_x = core.xMin();
+      params.origin_y = core.yMin() + row * static_cast<int>(site_dy);
+      params.orient = (row % 2 == 0) ? dbOrientType::R0   // N
+                                     : dbOrientType::MX;  // FS
+      params.direction = dbRowDir::HORIZONTAL;
+      params.num_sites = rows_x;
+      params.spacing = site_dx;
+    });
     logger_->info(IFP,
                   1,
                   "Added {} rows of {} site {}.",
@@ -546,54 +555,67 @@ void InitFloorplan::makeHybridRows(dbSite* base_hybrid_site,
   const int site_width = first_site->getWidth();
   const int row_width = core.dx() / site_width;
 
-  int row = 0;
-  int y = core.yMin();
-
-  while (true) {
-    auto [site, orient] = row_pattern[row % row_pattern.size()];
-    if (y + site->getHeight() > core.yMax()) {
-      break;
-    }
-    const string row_name = fmt::format("ROW_{}", row);
-    dbRow::create(block_,
-                  row_name.c_str(),
-                  site,
-                  core.xMin(),
-                  y,
-                  orient,
-                  dbRowDir::HORIZONTAL,
-                  row_width,
-                  site_width);
-    y += site->getHeight();
-    ++row;
+  // Offset of each row of the pattern from the start of the pattern
+  const int pattern_size = row_pattern.size();
+  std::vector<int> pattern_y(pattern_size + 1, 0);
+  for (int i = 0; i < pattern_size; ++i) {
+    pattern_y[i + 1] = pattern_y[i] + row_pattern[i].site->getHeight();
   }
+  const int pattern_height = pattern_y[pattern_size];
+  auto row_y = [&](const int row) {
+    return core.yMin() + (row / pattern_size) * pattern_height
+           + pattern_y[row % pattern_size];
+  };
+
+  // Every row of the whole patterns fits, the last partial pattern is
+  // checked row by row
+  int row_count = (core.dy() / pattern_height) * pattern_size;
+  while (row_y(row_count)
+             + static_cast<int>(
+                 row_pattern[row_count % pattern_size].site->getHeight())
+         <= core.yMax()) {
+    ++row_count;
+  }
+
+  createRows(row_count, [&](const int row, dbRow::Params& params) {
+    const auto& [site, orient] = row_pattern[row % pattern_size];
+    params.name = fmt::format("ROW_{}", row);
+    params.site = site;
+    params.origin_x = core.xMin();
+    params.origin_y = row_y(row);
+    params.orient = orient;
+    params.direction = dbRowDir::HORIZONTAL;
+    params.num_sites = row_width;
+    params.spacing = site_width;
+  });
   logger_->info(IFP,
                 49,
                 "Added {} rows from site {} row pattern.",
-                row,
+                row_count,
                 base_hybrid_site->getName());
 
   auto make_rows = [&](dbSite* site) {
     dbOrientType orient;
-    int y = getOffset(base_hybrid_site, site, orient) + core.yMin();
-
-    int row = 0;
-
-    while (y + site->getHeight() <= core.yMax()) {
-      const string row_name = fmt::format("ROW_{}", block_->getRows().size());
-      dbRow::create(block_,
-                    row_name.c_str(),
-                    site,
-                    core.xMin(),
-                    y,
-                    orient,
-                    dbRowDir::HORIZONTAL,
-                    row_width,
-                    site_width);
-      y += site->getHeight();
-      ++row;
+    const int y = getOffset(base_hybrid_site, site, orient) + core.yMin();
+    const int site_height = site->getHeight();
+
+    int rows = 0;
+    if (y + site_height <= core.yMax()) {
+      rows = (core.yMax() - y - site_height) / site_height + 1;
     }
-    logger_->info(IFP, 50, "Added {} rows of site {}.", row, site->getName());
+
+    const int first_row = block_->getRows().size();
+    createRows(rows, [&](const int row, dbRow::Params& params) {
+      params.name = fmt::format("ROW_{}", first_row + row);
+      params.site = site;
+      params.origin_x = core.xMin();
+      params.origin_y = y + row * site_height;
+      params.orient = orient;
+      params.direction = dbRowDir::HORIZONTAL;
+      params.num_sites = row_width;
+      params.spacing = site_width;
+    });
+    logger_->info(IFP, 50, "Added {} rows of site {}.", rows, site->getName());
   };
 
   for (const auto& [name, site] : sites_by_name) {
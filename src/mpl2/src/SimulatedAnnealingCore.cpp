@@ -35,6 +35,7 @@
 
 #include <fstream>
 #include <iostream>
+#include <iterator>
 
 #include "Mpl2Observer.h"
 #include "object.h"
@@ -122,6 +123,12 @@ template <class T>
 void SimulatedAnnealingCore<T>::setNets(const std::vector<BundledNet>& nets)
 {
   nets_ = nets;
+
+  // calculate the total net weight
+  tot_net_weight_ = 0.0;
+  for (const auto& net : nets_) {
+    tot_net_weight_ += net.weight;
+  }
 }
 
 template <class T>
@@ -261,13 +268,7 @@ void SimulatedAnnealingCore<T>::calWirelength()
     return;
   }
 
-  // calculate the total net weight
-  float tot_net_weight = 0.0;
-  for (const auto& net : nets_) {
-    tot_net_weight += net.weight;
-  }
-
-  if (tot_net_weight <= 0.0) {
+  if (tot_net_weight_ <= 0.0) {
     return;
   }
 
@@ -280,7 +281,7 @@ void SimulatedAnnealingCore<T>::calWirelength()
   }
 
   // normalization
-  wirelength_ = wirelength_ / tot_net_weight
+  wirelength_ = wirelength_ / tot_net_weight_
                 / (outline_.getHeight() + outline_.getWidth());
 
   if (graphics_) {
@@ -374,87 +375,64 @@ void SimulatedAnnealingCore<T>::packFloorplan()
     macros_[macro_id].setY(0.0);
   }
 
-  // Each index corresponds to a macro id whose pair is:
-  // <Position in Positive Sequence , Position in Negative Sequence>
-  std::vector<std::pair<int, int>> sequence_pair_pos(pos_seq_.size());
-
-  // calculate X position
-  for (int i = 0; i < pos_seq_.size(); i++) {
-    sequence_pair_pos[pos_seq_[i]].first = i;
-    sequence_pair_pos[neg_seq_[i]].second = i;
-  }
-
-  std::vector<float> accumulated_length(pos_seq_.size(), 0.0);
-  for (int i = 0; i < pos_seq_.size(); i++) {
-    const int macro_id = pos_seq_[i];
-
-    // There may exist pin access macros with zero area in our sequence pair
-    // when bus planning is on. This check is a temporary approach.
-    if (macros_[macro_id].getWidth() <= 0
-        || macros_[macro_id].getHeight() <= 0) {
-      continue;
-    }
-
-    const int neg_seq_pos = sequence_pair_pos[macro_id].second;
-
-    macros_[macro_id].setX(accumulated_length[neg_seq_pos]);
+  // Position of each macro id in the negative sequence.
+  std::vector<int> neg_seq_pos(neg_seq_.size());
+  for (int i = 0; i < neg_seq_.size(); i++) {
+    neg_seq_pos[neg_seq_[i]] = i;
+  }
+
+  // Places the macros in the given order, each one after the placed macros
+  // that precede it in the negative sequence.  Those distances are kept as a
+  // staircase (negative sequence position -> far edge) whose values increase
+  // with the position, so each macro takes O(log n) instead of a scan over
+  // the remaining positions.  Returns the extent of the packing.
+  std::map<int, float> staircase;
+  auto pack = [&](auto macro_begin,
+                  auto macro_end,
+                  auto get_length,
+                  auto set_start) -> float {
+    staircase.clear();
+    for (auto it = macro_begin; it != macro_end; ++it) {
+      const int macro_id = *it;
+
+      // There may exist pin access macros with zero area in our sequence pair
+      // when bus planning is on. This check is a temporary approach.
+      if (macros_[macro_id].getWidth() <= 0
+          || macros_[macro_id].getHeight() <= 0) {
+        continue;
+      }
 
-    const float current_length
-        = macros_[macro_id].getX() + macros_[macro_id].getWidth();
+      const int neg_pos = neg_seq_pos[macro_id];
+      auto next = staircase.lower_bound(neg_pos);
+      const float start
+          = next == staircase.begin() ? 0.0 : std::prev(next)->second;
+      set_start(macros_[macro_id], start);
 
-    for (int j = neg_seq_pos; j < neg_seq_.size(); j++) {
-      if (current_length > accumulated_length[j]) {
-        accumulated_length[j] = current_length;
-      } else {
-        break;
+      const float current_length = start + get_length(macros_[macro_id]);
+      if (current_length <= start) {
+        continue;
+      }
+      while (next != staircase.end() && next->second <= current_length) {
+        next = staircase.erase(next);
       }
+      staircase.emplace_hint(next, neg_pos, current_length);
     }
-  }
+    return staircase.empty() ? 0.0 : staircase.rbegin()->second;
+  };
 
-  width_ = accumulated_length[pos_seq_.size() - 1];
+  // calculate X position
+  width_ = pack(
+      pos_seq_.begin(),
+      pos_seq_.end(),
+      [](const T& macro) { return macro.getWidth(); },
+      [](T& macro, const float x) { macro.setX(x); });
 
   // calulate Y position
-  std::vector<int> reversed_pos_seq(pos_seq_.size());
-  for (int i = 0; i < reversed_pos_seq.size(); i++) {
-    reversed_pos_seq[i] = pos_seq_[reversed_pos_seq.size() - 1 - i];
-  }
-
-  for (int i = 0; i < pos_seq_.size(); i++) {
-    sequence_pair_pos[reversed_pos_seq[i]].first = i;
-    sequence_pair_pos[neg_seq_[i]].second = i;
-
-    // This is actually the accumulated height, but we use the same vector
-    // to avoid more allocation.
-    accumulated_length[i] = 0.0;
-  }
-
-  for (int i = 0; i < pos_seq_.size(); i++) {
-    const int macro_id = reversed_pos_seq[i];
-
-    // There may exist pin access macros with zero area in our sequence pair
-    // when bus planning is on. This check is a temporary approach.
-    if (macros_[macro_id].getWidth() <= 0
-        || macros_[macro_id].getHeight() <= 0) {
-      continue;
-    }
-
-    const int neg_seq_pos = sequence_pair_pos[macro_id].second;
-
-    macros_[macro_id].setY(accumulated_length[neg_seq_pos]);
-
-    const float current_height
-        = macros_[macro_id].getY() + macros_[macro_id].getHeight();
-
-    for (int j = neg_seq_pos; j < neg_seq_.size(); j++) {
-      if (current_height > accumulated_length[j]) {
-        accumulated_length[j] = current_height;
-      } else {
-        break;
-      }
-    }
-  }
-
-  height_ = accumulated_length[pos_seq_.size() - 1];
+  height_ = pack(
+      pos_seq_.rbegin(),
+      pos_seq_.rend(),
+      [](const T& macro) { return macro.getHeight(); },
+      [](T& macro, const float y) { macro.setY(y); });
 
   if (graphics_) {
     graphics_->saStep(macros_);
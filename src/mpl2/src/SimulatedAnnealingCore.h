@@ -166,6 +166,7 @@ class SimulatedAnnealingCore
 
   // nets, fences, guides, blockages
   std::vector<BundledNet> nets_;
+  float tot_net_weight_ = 0.0;  // sum of the weights of nets_
   std::map<int, Rect> fences_;
   std::map<int, Rect> guides_;
 
@@ -538,30 +538,77 @@ void ClusteringEngine::createDataFlow()
 
   const DataFlowHypergraph hypergraph = computeHypergraph(num_of_vertices);
 
-  // Traverse hypergraph to build dataflow.
-  for (auto [src, src_pin] : vertices_maps.id_to_bterm) {
-    int idx = 0;
-    std::vector<bool> visited(num_of_vertices, false);
-    std::vector<std::set<odb::dbInst*>> insts(max_num_of_hops_);
-    dataFlowDFSIOPin(
-        src, idx, vertices_maps, hypergraph, insts, visited, false);
-    dataFlowDFSIOPin(src, idx, vertices_maps, hypergraph, insts, visited, true);
-
-    data_connections_.io_and_regs.emplace_back(src_pin, insts);
-  }
-
-  for (auto [src, src_pin] : vertices_maps.id_to_macro_pin) {
-    int idx = 0;
-    std::vector<bool> visited(num_of_vertices, false);
-    std::vector<std::set<odb::dbInst*>> std_cells(max_num_of_hops_);
-    std::vector<std::set<odb::dbInst*>> macros(max_num_of_hops_);
-    dataFlowDFSMacroPin(
-        src, idx, vertices_maps, hypergraph, std_cells, macros, visited, false);
-    dataFlowDFSMacroPin(
-        src, idx, vertices_maps, hypergraph, std_cells, macros, visited, true);
-
-    data_connections_.macro_pins_and_regs.emplace_back(src_pin, std_cells);
-    data_connections_.macro_pins_and_macros.emplace_back(src_pin, macros);
+  // Traverse hypergraph to build dataflow.  Each source is searched on its
+  // own, so the searches run in parallel.  A visited vertex is marked with the
+  // index of the source being searched, which avoids clearing a visited
+  // vector per source.
+  const std::vector<std::pair<int, odb::dbBTerm*>> io_sources(
+      vertices_maps.id_to_bterm.begin(), vertices_maps.id_to_bterm.end());
+  std::vector<std::vector<std::set<odb::dbInst*>>> io_regs(io_sources.size());
+#pragma omp parallel num_threads(num_threads_)
+  {
+    std::vector<int> visited(num_of_vertices, -1);
+#pragma omp for schedule(dynamic)
+    for (int i = 0; i < io_sources.size(); i++) {
+      const int src = io_sources[i].first;
+      int idx = 0;
+      std::vector<std::set<odb::dbInst*>>& insts = io_regs[i];
+      insts.resize(max_num_of_hops_);
+      dataFlowDFSIOPin(
+          src, idx, vertices_maps, hypergraph, insts, visited, i, false);
+      dataFlowDFSIOPin(
+          src, idx, vertices_maps, hypergraph, insts, visited, i, true);
+    }
+  }
+  for (int i = 0; i < io_sources.size(); i++) {
+    data_connections_.io_and_regs.emplace_back(io_sources[i].second,
+                                               std::move(io_regs[i]));
+  }
+
+  const std::vector<std::pair<int, odb::dbITerm*>> macro_pin_sources(
+      vertices_maps.id_to_macro_pin.begin(),
+      vertices_maps.id_to_macro_pin.end());
+  std::vector<std::vector<std::set<odb::dbInst*>>> macro_pin_regs(
+      macro_pin_sources.size());
+  std::vector<std::vector<std::set<odb::dbInst*>>> macro_pin_macros(
+      macro_pin_sources.size());
+#pragma omp parallel num_threads(num_threads_)
+  {
+    std::vector<int> visited(num_of_vertices, -1);
+#pragma omp for schedule(dynamic)
+    for (int i = 0; i < macro_pin_sources.size(); i++) {
+      const int src = macro_pin_sources[i].first;
+      int idx = 0;
+      std::vector<std::set<odb::dbInst*>>& std_cells = macro_pin_regs[i];
+      std::vector<std::set<odb::dbInst*>>& macros = macro_pin_macros[i];
+      std_cells.resize(max_num_of_hops_);
+      macros.resize(max_num_of_hops_);
+      dataFlowDFSMacroPin(src,
+                          idx,
+                          vertices_maps,
+                          hypergraph,
+                          std_cells,
+                          macros,
+                          visited,
+                          i,
+                          false);
+      dataFlowDFSMacroPin(src,
+                          idx,
+                          vertices_maps,
+                          hypergraph,
+                          std_cells,
+                          macros,
+                          visited,
+                          i,
+                          true);
+    }
+  }
+  for (int i = 0; i < macro_pin_sources.size(); i++) {
+    odb::dbITerm* src_pin = macro_pin_sources[i].second;
+    data_connections_.macro_pins_and_regs.emplace_back(
+        src_pin, std::move(macro_pin_regs[i]));
+    data_connections_.macro_pins_and_macros.emplace_back(
+        src_pin, std::move(macro_pin_macros[i]));
   }
 }
 
@@ -750,10 +797,11 @@ void ClusteringEngine::dataFlowDFSIOPin(
     const VerticesMaps& vertices_maps,
     const DataFlowHypergraph& hypergraph,
     std::vector<std::set<odb::dbInst*>>& insts,
-    std::vector<bool>& visited,
+    std::vector<int>& visited,
+    const int search_id,
     bool backward_search)
 {
-  visited[parent] = true;
+  visited[parent] = search_id;
   if (vertices_maps.stoppers[parent]) {
     if (parent < vertices_maps.id_to_bterm.size()) {
       ;  // currently we do not consider IO pin to IO pin connection
@@ -774,7 +822,8 @@ void ClusteringEngine::dataFlowDFSIOPin(
     for (auto& hyperedge : hypergraph.vertices[parent]) {
       for (auto& vertex : hypergraph.hyperedges[hyperedge]) {
         // we do not consider pin to pin
-        if (visited[vertex] || vertex < vertices_maps.id_to_bterm.size()) {
+        if (visited[vertex] == search_id
+          || vertex < vertices_maps.id_to_bterm.size()) {
           continue;
         }
         dataFlowDFSIOPin(vertex,
@@ -783,6 +832,7 @@ void ClusteringEngine::dataFlowDFSIOPin(
                          hypergraph,
                          insts,
                          visited,
+                         search_id,
                          backward_search);
       }
     }
@@ -791,7 +841,8 @@ void ClusteringEngine::dataFlowDFSIOPin(
       const int vertex
           = hypergraph.hyperedges[hyperedge].front();  // driver vertex
       // we do not consider pin to pin
-      if (visited[vertex] || vertex < vertices_maps.id_to_bterm.size()) {
+      if (visited[vertex] == search_id
+          || vertex < vertices_maps.id_to_bterm.size()) {
         continue;
       }
       dataFlowDFSIOPin(vertex,
@@ -800,6 +851,7 @@ void ClusteringEngine::dataFlowDFSIOPin(
                        hypergraph,
                        insts,
                        visited,
+                       search_id,
                        backward_search);
     }
   }
@@ -814,10 +866,11 @@ void ClusteringEngine::dataFlowDFSMacroPin(
     const DataFlowHypergraph& hypergraph,
     std::vector<std::set<odb::dbInst*>>& std_cells,
     std::vector<std::set<odb::dbInst*>>& macros,
-    std::vector<bool>& visited,
+    std::vector<int>& visited,
+    const int search_id,
     bool backward_search)
 {
-  visited[parent] = true;
+  visited[parent] = search_id;
   if (vertices_maps.stoppers[parent]) {
     if (parent < vertices_maps.id_to_bterm.size()) {
       ;  // the connection between IO and macro pins have been considers
@@ -838,7 +891,8 @@ void ClusteringEngine::dataFlowDFSMacroPin(
     for (auto& hyperedge : hypergraph.vertices[parent]) {
       for (auto& vertex : hypergraph.hyperedges[hyperedge]) {
         // we do not consider pin to pin
-        if (visited[vertex] || vertex < vertices_maps.id_to_bterm.size()) {
+        if (visited[vertex] == search_id
+          || vertex < vertices_maps.id_to_bterm.size()) {
           continue;
         }
         dataFlowDFSMacroPin(vertex,
@@ -848,6 +902,7 @@ void ClusteringEngine::dataFlowDFSMacroPin(
                             std_cells,
                             macros,
                             visited,
+                            search_id,
                             backward_search);
       }
     }
@@ -855,7 +910,8 @@ void ClusteringEngine::dataFlowDFSMacroPin(
     for (auto& hyperedge : hypergraph.backward_vertices[parent]) {
       const int vertex = hypergraph.hyperedges[hyperedge].front();
       // we do not consider pin to pin
-      if (visited[vertex] || vertex < vertices_maps.id_to_bterm.size()) {
+      if (visited[vertex] == search_id
+          || vertex < vertices_maps.id_to_bterm.size()) {
         continue;
       }
       dataFlowDFSMacroPin(vertex,
@@ -865,6 +921,7 @@ void ClusteringEngine::dataFlowDFSMacroPin(
                           std_cells,
                           macros,
                           visited,
+                          search_id,
                           backward_search);
     }
   }
@@ -1668,13 +1725,49 @@ void ClusteringEngine::updateConnections()
     cluster->initConnection();
   }
 
+  if (!connection_nets_built_) {
+    buildConnectionNets();
+  }
+
+  std::vector<int> load_clusters_ids;
+  for (const ConnectionNet& net : connection_nets_) {
+    if (net.loads.size() >= tree_->large_net_threshold) {
+      continue;
+    }
+
+    const int driver_cluster_id = getClusterId(net.driver);
+    load_clusters_ids.clear();
+    for (const ConnectionTerminal& load : net.loads) {
+      load_clusters_ids.push_back(getClusterId(load));
+    }
+
+    const float weight = net.has_io_pin ? tree_->virtual_weight : 1.0;
+
+    for (const int load_cluster_id : load_clusters_ids) {
+      if (load_cluster_id != driver_cluster_id) { /* undirected connection */
+        tree_->maps.id_to_cluster[driver_cluster_id]->addConnection(
+            load_cluster_id, weight);
+        tree_->maps.id_to_cluster[load_cluster_id]->addConnection(
+            driver_cluster_id, weight);
+      }
+    }
+  }
+}
+
+// The netlist does not change while the clusters are built and placed, so the
+// driver and loads of each net are collected once and only their cluster ids
+// are looked up again when the connections are updated.
+void ClusteringEngine::buildConnectionNets()
+{
+  connection_nets_.clear();
+
   for (odb::dbNet* net : block_->getNets()) {
     if (net->getSigType().isSupply()) {
       continue;
     }
 
-    int driver_cluster_id = -1;
-    std::vector<int> load_clusters_ids;
+    ConnectionNet connection_net;
+    bool net_has_driver = false;
     bool net_has_pad_or_cover = false;
 
     for (odb::dbITerm* iterm : net->getITerms()) {
@@ -1685,12 +1778,11 @@ void ClusteringEngine::updateConnections()
         break;
       }
 
-      const int cluster_id = tree_->maps.inst_to_cluster_id.at(inst);
-
       if (iterm->getIoType() == odb::dbIoType::OUTPUT) {
-        driver_cluster_id = cluster_id;
+        connection_net.driver = {inst, nullptr};
+        net_has_driver = true;
       } else {
-        load_clusters_ids.push_back(cluster_id);
+        connection_net.loads.push_back({inst, nullptr});
       }
     }
 
@@ -1698,33 +1790,31 @@ void ClusteringEngine::updateConnections()
       continue;
     }
 
-    bool net_has_io_pin = false;
-
     for (odb::dbBTerm* bterm : net->getBTerms()) {
-      const int cluster_id = tree_->maps.bterm_to_cluster_id.at(bterm);
-      net_has_io_pin = true;
+      connection_net.has_io_pin = true;
 
       if (bterm->getIoType() == odb::dbIoType::INPUT) {
-        driver_cluster_id = cluster_id;
+        connection_net.driver = {nullptr, bterm};
+        net_has_driver = true;
       } else {
-        load_clusters_ids.push_back(cluster_id);
+        connection_net.loads.push_back({nullptr, bterm});
       }
     }
 
-    if (driver_cluster_id != -1 && !load_clusters_ids.empty()
-        && load_clusters_ids.size() < tree_->large_net_threshold) {
-      const float weight = net_has_io_pin ? tree_->virtual_weight : 1.0;
-
-      for (const int load_cluster_id : load_clusters_ids) {
-        if (load_cluster_id != driver_cluster_id) { /* undirected connection */
-          tree_->maps.id_to_cluster[driver_cluster_id]->addConnection(
-              load_cluster_id, weight);
-          tree_->maps.id_to_cluster[load_cluster_id]->addConnection(
-              driver_cluster_id, weight);
-        }
-      }
+    if (net_has_driver && !connection_net.loads.empty()) {
+      connection_nets_.push_back(std::move(connection_net));
     }
   }
+
+  connection_nets_built_ = true;
+}
+
+int ClusteringEngine::getClusterId(const ConnectionTerminal& terminal) const
+{
+  if (terminal.inst) {
+    return tree_->maps.inst_to_cluster_id.at(terminal.inst);
+  }
+  return tree_->maps.bterm_to_cluster_id.at(terminal.bterm);
 }
 
 void ClusteringEngine::fetchMixedLeaves(
@@ -95,6 +95,21 @@ struct DataFlow
       macro_pins_and_macros;
 };
 
+// A net as seen by the cluster connections: its driver and loads, each one
+// either an instance or an IO pin.
+struct ConnectionTerminal
+{
+  odb::dbInst* inst{nullptr};
+  odb::dbBTerm* bterm{nullptr};
+};
+
+struct ConnectionNet
+{
+  ConnectionTerminal driver;
+  std::vector<ConnectionTerminal> loads;
+  bool has_io_pin{false};
+};
+
 struct PhysicalHierarchyMaps
 {
   std::map<int, Cluster*> id_to_cluster;
@@ -152,6 +167,7 @@ class ClusteringEngine
 
   void setDesignMetrics(Metrics* design_metrics);
   void setTree(PhysicalHierarchy* tree);
+  void setNumThreads(int threads) { num_threads_ = threads; }
 
   // Methods to update the tree as the hierarchical
   // macro placement runs.
@@ -237,7 +253,8 @@ class ClusteringEngine
                         const VerticesMaps& vertices_maps,
                         const DataFlowHypergraph& hypergraph,
                         std::vector<std::set<odb::dbInst*>>& insts,
-                        std::vector<bool>& visited,
+                        std::vector<int>& visited,
+                        int search_id,
                         bool backward_search);
   void dataFlowDFSMacroPin(int parent,
                            int idx,
@@ -245,7 +262,8 @@ class ClusteringEngine
                            const DataFlowHypergraph& hypergraph,
                            std::vector<std::set<odb::dbInst*>>& std_cells,
                            std::vector<std::set<odb::dbInst*>>& macros,
-                           std::vector<bool>& visited,
+                           std::vector<int>& visited,
+                           int search_id,
                            bool backward_search);
   std::set<int> computeSinks(const std::set<odb::dbInst*>& insts);
   float computeConnWeight(int hops);
@@ -253,6 +271,9 @@ class ClusteringEngine
   void printPhysicalHierarchyTree(Cluster* parent, int level);
   float computeMicronArea(odb::dbInst* inst);
 
+  void buildConnectionNets();
+  int getClusterId(const ConnectionTerminal& terminal) const;
+
   static bool isIgnoredMaster(odb::dbMaster* master);
 
   odb::dbBlock* block_;
@@ -263,6 +284,7 @@ class ClusteringEngine
   Metrics* design_metrics_{nullptr};
   PhysicalHierarchy* tree_{nullptr};
 
+  int num_threads_{1};
   int level_{0};  // Current level
   int id_{0};     // Current "highest" id
 
@@ -276,6 +298,10 @@ class ClusteringEngine
   // Variables for data flow
   DataFlow data_connections_;
 
+  // Nets used by updateConnections, collected on its first call.
+  std::vector<ConnectionNet> connection_nets_;
+  bool connection_nets_built_{false};
+
   // The register distance between two macros for
   // them to be considered connected when creating data flow.
   const int max_num_of_hops_ = 5;
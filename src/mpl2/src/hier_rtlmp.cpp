@@ -34,10 +34,13 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "hier_rtlmp.h"
 
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <fstream>
+#include <future>
 #include <iostream>
+#include <memory>
 #include <queue>
-#include <thread>
 
 #include "Mpl2Observer.h"
 #include "SACoreHardMacro.h"
@@ -66,6 +69,32 @@ using utl::MPL;
 
 HierRTLMP::~HierRTLMP() = default;
 
+// Runs a batch of SA instances, one per worker of a thread pool that is kept
+// for the whole hierarchy rather than spawning threads for every batch.
+template <class T>
+void HierRTLMP::runSABatch(std::vector<std::unique_ptr<T>>& sa_batch)
+{
+  if (sa_batch.size() == 1) {
+    runSA<T>(sa_batch[0].get());
+    return;
+  }
+
+  if (!sa_pool_) {
+    sa_pool_ = std::make_unique<boost::asio::thread_pool>(num_threads_);
+  }
+  std::vector<std::future<void>> runs;
+  runs.reserve(sa_batch.size());
+  for (auto& sa : sa_batch) {
+    auto run = std::make_shared<std::packaged_task<void()>>(
+        [sa_core = sa.get()] { runSA<T>(sa_core); });
+    runs.push_back(run->get_future());
+    boost::asio::post(*sa_pool_, [run] { (*run)(); });
+  }
+  for (auto& run : runs) {
+    run.get();
+  }
+}
+
 // Constructors
 HierRTLMP::HierRTLMP(sta::dbNetwork* network,
                      odb::dbDatabase* db,
@@ -284,6 +313,7 @@ void HierRTLMP::runMultilevelAutoclustering()
   // Set target structures
   clustering_engine_->setDesignMetrics(metrics_);
   clustering_engine_->setTree(tree_.get());
+  clustering_engine_->setNumThreads(num_threads_);
 
   clustering_engine_->run();
 
@@ -537,19 +567,7 @@ void HierRTLMP::calculateChildrenTilings(Cluster* parent)
                                               logger_);
       sa_batch.push_back(std::move(sa));
     }
-    if (sa_batch.size() == 1) {
-      runSA<SACoreSoftMacro>(sa_batch[0].get());
-    } else {
-      // multi threads
-      std::vector<std::thread> threads;
-      threads.reserve(sa_batch.size());
-      for (auto& sa : sa_batch) {
-        threads.emplace_back(runSA<SACoreSoftMacro>, sa.get());
-      }
-      for (auto& th : threads) {
-        th.join();
-      }
-    }
+    runSABatch(sa_batch);
     // add macro tilings
     for (auto& sa : sa_batch) {
       if (sa->isValid(outline)) {
@@ -601,19 +619,7 @@ void HierRTLMP::calculateChildrenTilings(Cluster* parent)
                                               logger_);
       sa_batch.push_back(std::move(sa));
     }
-    if (sa_batch.size() == 1) {
-      runSA<SACoreSoftMacro>(sa_batch[0].get());
-    } else {
-      // multi threads
-      std::vector<std::thread> threads;
-      threads.reserve(sa_batch.size());
-      for (auto& sa : sa_batch) {
-        threads.emplace_back(runSA<SACoreSoftMacro>, sa.get());
-      }
-      for (auto& th : threads) {
-        th.join();
-      }
-    }
+    runSABatch(sa_batch);
     // add macro tilings
     for (auto& sa : sa_batch) {
       if (sa->isValid(outline)) {
@@ -766,19 +772,7 @@ void HierRTLMP::calculateMacroTilings(Cluster* cluster)
                                               logger_);
       sa_batch.push_back(std::move(sa));
     }
-    if (sa_batch.size() == 1) {
-      runSA<SACoreHardMacro>(sa_batch[0].get());
-    } else {
-      // multi threads
-      std::vector<std::thread> threads;
-      threads.reserve(sa_batch.size());
-      for (auto& sa : sa_batch) {
-        threads.emplace_back(runSA<SACoreHardMacro>, sa.get());
-      }
-      for (auto& th : threads) {
-        th.join();
-      }
-    }
+    runSABatch(sa_batch);
     // add macro tilings
     for (auto& sa : sa_batch) {
       if (sa->isValid(outline)) {
@@ -824,19 +818,7 @@ void HierRTLMP::calculateMacroTilings(Cluster* cluster)
                                               logger_);
       sa_batch.push_back(std::move(sa));
     }
-    if (sa_batch.size() == 1) {
-      runSA<SACoreHardMacro>(sa_batch[0].get());
-    } else {
-      // multi threads
-      std::vector<std::thread> threads;
-      threads.reserve(sa_batch.size());
-      for (auto& sa : sa_batch) {
-        threads.emplace_back(runSA<SACoreHardMacro>, sa.get());
-      }
-      for (auto& th : threads) {
-        th.join();
-      }
-    }
+    runSABatch(sa_batch);
     // add macro tilings
     for (auto& sa : sa_batch) {
       if (sa->isValid(outline)) {
@@ -1690,19 +1672,7 @@ void HierRTLMP::runHierarchicalMacroPlacement(Cluster* parent)
       sa->addBlockages(macro_blockages);
       sa_batch.push_back(std::move(sa));
     }
-    if (sa_batch.size() == 1) {
-      runSA<SACoreSoftMacro>(sa_batch[0].get());
-    } else {
-      // multi threads
-      std::vector<std::thread> threads;
-      threads.reserve(sa_batch.size());
-      for (auto& sa : sa_batch) {
-        threads.emplace_back(runSA<SACoreSoftMacro>, sa.get());
-      }
-      for (auto& th : threads) {
-        th.join();
-      }
-    }
+    runSABatch(sa_batch);
     remaining_runs -= run_thread;
     // add macro tilings
     for (auto& sa : sa_batch) {
@@ -1948,19 +1918,7 @@ void HierRTLMP::runHierarchicalMacroPlacement(Cluster* parent)
         sa->addBlockages(macro_blockages);
         sa_batch.push_back(std::move(sa));
       }
-      if (sa_batch.size() == 1) {
-        runSA<SACoreSoftMacro>(sa_batch[0].get());
-      } else {
-        // multi threads
-        std::vector<std::thread> threads;
-        threads.reserve(sa_batch.size());
-        for (auto& sa : sa_batch) {
-          threads.emplace_back(runSA<SACoreSoftMacro>, sa.get());
-        }
-        for (auto& th : threads) {
-          th.join();
-        }
-      }
+      runSABatch(sa_batch);
       remaining_runs -= run_thread;
       // add macro tilings
       for (auto& sa : sa_batch) {
@@ -2520,19 +2478,7 @@ void HierRTLMP::runHierarchicalMacroPlacementWithoutBusPlanning(Cluster* parent)
       sa->addBlockages(macro_blockages);
       sa_batch.push_back(std::move(sa));
     }
-    if (sa_batch.size() == 1) {
-      runSA<SACoreSoftMacro>(sa_batch[0].get());
-    } else {
-      // multi threads
-      std::vector<std::thread> threads;
-      threads.reserve(sa_batch.size());
-      for (auto& sa : sa_batch) {
-        threads.emplace_back(runSA<SACoreSoftMacro>, sa.get());
-      }
-      for (auto& th : threads) {
-        th.join();
-      }
-    }
+    runSABatch(sa_batch);
     remaining_runs -= run_thread;
     // add macro tilings
     for (auto& sa : sa_batch) {
@@ -3002,19 +2948,7 @@ void HierRTLMP::runEnhancedHierarchicalMacroPlacement(Cluster* parent)
       sa->addBlockages(macro_blockages);
       sa_batch.push_back(std::move(sa));
     }
-    if (sa_batch.size() == 1) {
-      runSA<SACoreSoftMacro>(sa_batch[0].get());
-    } else {
-      // multi threads
-      std::vector<std::thread> threads;
-      threads.reserve(sa_batch.size());
-      for (auto& sa : sa_batch) {
-        threads.emplace_back(runSA<SACoreSoftMacro>, sa.get());
-      }
-      for (auto& th : threads) {
-        th.join();
-      }
-    }
+    runSABatch(sa_batch);
     remaining_runs -= run_thread;
     // add macro tilings
     for (auto& sa : sa_batch) {
@@ -3485,20 +3419,7 @@ void HierRTLMP::placeMacros(Cluster* cluster)
 
       run_id++;
     }
-    if (sa_batch.size() == 1) {
-      runSA<SACoreHardMacro>(sa_batch[0].get());
-    } else {
-      std::vector<std::thread> threads;
-      threads.reserve(sa_batch.size());
-
-      for (auto& sa : sa_batch) {
-        threads.emplace_back(runSA<SACoreHardMacro>, sa.get());
-      }
-
-      for (auto& th : threads) {
-        th.join();
-      }
-    }
+    runSABatch(sa_batch);
 
     for (auto& sa : sa_batch) {
       SACoreWeights weights;
@@ -36,11 +36,16 @@
 #pragma once
 
 #include <limits>
+#include <memory>
 #include <string>
 
 #include "Mpl2Observer.h"
 #include "clusterEngine.h"
 
+namespace boost::asio {
+class thread_pool;
+}  // namespace boost::asio
+
 namespace odb {
 class dbBlock;
 class dbDatabase;
@@ -133,7 +138,11 @@ class HierRTLMP
   void setDebugOnlyFinalResult(bool only_final_result);
   void setBusPlanningOn(bool bus_planning_on);
 
-  void setNumThreads(int threads) { num_threads_ = threads; }
+  void setNumThreads(int threads)
+  {
+    num_threads_ = threads;
+    sa_pool_.reset();
+  }
   void setMacroPlacementFile(const std::string& file_name);
   void writeMacroPlacement(const std::string& file_name);
 
@@ -143,6 +152,8 @@ class HierRTLMP
   using IOSpans = std::map<Boundary, std::pair<float, float>>;
 
   void runMultilevelAutoclustering();
+  template <class T>
+  void runSABatch(std::vector<std::unique_ptr<T>>& sa_batch);
   void runHierarchicalMacroPlacement();
 
   void resetSAParameters();
@@ -264,6 +275,8 @@ class HierRTLMP
 
   const int num_runs_ = 10;    // number of runs for SA
   int num_threads_ = 10;       // number of threads
+  // workers for parallel SA runs, created on first use
+  std::unique_ptr<boost::asio::thread_pool> sa_pool_;
   const int random_seed_ = 0;  // random seed for deterministic
 
   float target_dead_space_ = 0.2;  // dead space for the cluster
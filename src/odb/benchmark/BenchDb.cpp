@@ -0,0 +1,173 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Microbenchmarks of the odb wire codec and name lookups on synthetic
+// blocks.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "odb/db.h"
+#include "odb/dbWireCodec.h"
+#include "utl/Logger.h"
+
+namespace odb {
+
+namespace {
+
+// A block with num_insts instances of a two pin master, each output
+// driving its own net.
+class SyntheticBlock
+{
+ public:
+  explicit SyntheticBlock(int num_insts)
+  {
+    db_ = dbDatabase::create();
+    db_->setLogger(&logger_);
+    dbTech* tech = dbTech::create(db_, "tech");
+    metal1_ = dbTechLayer::create(tech, "metal1", dbTechLayerType::ROUTING);
+    metal1_->setWidth(100);
+    metal2_ = dbTechLayer::create(tech, "metal2", dbTechLayerType::ROUTING);
+    metal2_->setWidth(100);
+    dbLib* lib = dbLib::create(db_, "lib", tech, ',');
+    dbMaster* master = dbMaster::create(lib, "buf");
+    master->setWidth(1000);
+    master->setHeight(1000);
+    master->setType(dbMasterType::CORE);
+    dbMTerm::create(master, "a", dbIoType::INPUT, dbSigType::SIGNAL);
+    dbMTerm::create(master, "o", dbIoType::OUTPUT, dbSigType::SIGNAL);
+    master->setFrozen();
+    dbChip* chip = dbChip::create(db_);
+    block_ = dbBlock::create(chip, "top");
+    for (int i = 0; i < num_insts; i++) {
+      const std::string index = std::to_string(i);
+      dbInst* inst = dbInst::create(block_, master, ("u" + index).c_str());
+      dbNet* net = dbNet::create(block_, ("n" + index).c_str());
+      inst->findITerm("o")->connect(net);
+    }
+  }
+
+  ~SyntheticBlock() { dbDatabase::destroy(db_); }
+
+  dbBlock* block() const { return block_; }
+  dbTechLayer* metal1() const { return metal1_; }
+  dbTechLayer* metal2() const { return metal2_; }
+
+ private:
+  utl::Logger logger_;
+  dbDatabase* db_ = nullptr;
+  dbBlock* block_ = nullptr;
+  dbTechLayer* metal1_ = nullptr;
+  dbTechLayer* metal2_ = nullptr;
+};
+
+}  // namespace
+
+// Decodes a wire of num_segments alternating metal1/metal2 segments
+// joined by vias, the way extraction and the writers walk routed nets.
+static void BM_WireDecode(benchmark::State& state)
+{
+  const int num_segments = state.range(0);
+  SyntheticBlock synthetic(1);
+  dbBlock* block = synthetic.block();
+  dbTechLayer* metal1 = synthetic.metal1();
+  dbTechLayer* metal2 = synthetic.metal2();
+  dbTechVia* via = dbTechVia::create(block->getDataBase()->getTech(), "via12");
+  dbBox::create(via, metal1, -50, -50, 50, 50);
+  dbBox::create(via, metal2, -50, -50, 50, 50);
+
+  dbWire* wire = dbWire::create(block->findNet("n0"));
+  dbWireEncoder encoder;
+  encoder.begin(wire);
+  encoder.newPath(metal1, dbWireType::ROUTED);
+  int x = 0;
+  int y = 0;
+  encoder.addPoint(x, y);
+  for (int i = 0; i < num_segments; i++) {
+    if (i % 2 == 0) {
+      x += 1000;
+    } else {
+      y += 1000;
+    }
+    encoder.addPoint(x, y);
+    encoder.addTechVia(via);
+  }
+  encoder.end();
+
+  for (auto _ : state) {
+    dbWireDecoder decoder;
+    decoder.begin(wire);
+    int points = 0;
+    for (auto op = decoder.next(); op != dbWireDecoder::END_DECODE;
+         op = decoder.next()) {
+      if (op == dbWireDecoder::POINT) {
+        points++;
+      }
+    }
+    benchmark::DoNotOptimize(points);
+  }
+  state.SetItemsProcessed(state.iterations() * num_segments);
+}
+BENCHMARK(BM_WireDecode)->Arg(64)->Arg(4096);
+
+// Random hits of dbBlock::findNet/findInst, which go through the name
+// hash tables of the block.
+static void BM_HashTableFind(benchmark::State& state)
+{
+  const int num_insts = state.range(0);
+  SyntheticBlock synthetic(num_insts);
+  dbBlock* block = synthetic.block();
+
+  std::mt19937 rng(1);
+  std::uniform_int_distribution<int> dist(0, num_insts - 1);
+  std::vector<std::string> net_names;
+  std::vector<std::string> inst_names;
+  for (int i = 0; i < 1024; i++) {
+    const std::string index = std::to_string(dist(rng));
+    net_names.push_back("n" + index);
+    inst_names.push_back("u" + index);
+  }
+
+  size_t i = 0;
+  for (auto _ : state) {
+    const size_t name = i++ % net_names.size();
+    benchmark::DoNotOptimize(block->findNet(net_names[name].c_str()));
+    benchmark::DoNotOptimize(block->findInst(inst_names[name].c_str()));
+  }
+  state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_HashTableFind)->Arg(1000)->Arg(100000);
+
+}  // namespace odb
@@ -33,6 +33,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <list>
 #include <map>
 #include <optional>
@@ -95,6 +96,7 @@ class dbCapNode;
 class dbRSeg;
 class dbCCSeg;
 class dbBlockSearch;
+class dbGuideStore;
 class dbRow;
 class dbFill;
 class dbTechAntennaPinModel;
@@ -424,7 +426,8 @@ class dbDatabase : public dbObject
   ///
   /// Begin collecting netlist changes on specified block.
   ///
-  /// NOTE: Eco changes can not be nested at this time.
+  /// NOTE: Eco changes can not be nested at this time.  Use ecoSavepoint
+  ///       and undoEcoToSavepoint for nested speculative edits.
   ///
   static void beginEco(dbBlock* block);
 
@@ -463,6 +466,18 @@ class dbDatabase : public dbObject
   ///
   static void undoEco(dbBlock* block);
 
+  ///
+  /// Returns a savepoint in the eco being collected on the block.  Savepoints
+  /// may be nested and are cheap: they only record the journal size.
+  ///
+  static int ecoSavepoint(dbBlock* block);
+
+  ///
+  /// Undo the changes collected since the savepoint, leaving the eco open.
+  /// Savepoints taken after this one are invalidated.
+  ///
+  static void undoEcoToSavepoint(dbBlock* block, int savepoint);
+
   ///
   /// links to utl::Logger
   ///
@@ -484,7 +499,9 @@ class dbDatabase : public dbObject
   static void destroy(dbDatabase* db);
 
   ///
-  /// Create a duplicate (IN-MEMORY) instance of a database.
+  /// Create a duplicate (IN-MEMORY) instance of a database.  The duplicate
+  /// shares the logger of db and is independent of it afterwards, so it can
+  /// serve as a snapshot for what-if experiments instead of write/read_db.
   ///
   /// WARNING: This action may result in an out-of-memory condition if
   ///          there is not enough memory (or swap space) to maintain
@@ -504,6 +521,11 @@ class dbDatabase : public dbObject
   /// Translate a database-id back to a pointer.
   ///
   static dbDatabase* getDatabase(uint oid);
+
+  ///
+  /// Bytes held by the object table pages of all the databases.
+  ///
+  static int64_t getTableMemoryUsage();
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -981,6 +1003,39 @@ class dbBlock : public dbObject
   ///
   dbSet<dbInst> getInsts();
 
+  ///
+  /// Bulk accessors for scripting.  Each returns a flat array with a fixed
+  /// number of values per object, in the order of getInsts() or getNets(),
+  /// so the Python API can hand it out as one buffer instead of an object
+  /// per access.
+  ///
+  /// Instance bounding boxes: xMin, yMin, xMax, yMax per instance.
+  ///
+  std::vector<int> getInstBBoxes();
+
+  ///
+  /// Instance orientations (dbOrientType::Value), one per instance.
+  ///
+  std::vector<int> getInstOrients();
+
+  ///
+  /// Instance master ids (dbMaster::getId), one per instance.  Master ids
+  /// are only unique within a library.
+  ///
+  std::vector<int> getInstMasterIds();
+
+  ///
+  /// Pin locations of the nets: net id, x, y per iterm and bterm that has a
+  /// location.
+  ///
+  std::vector<int> getNetPinLocations();
+
+  ///
+  /// Decoded wire segments of all nets: net id, routing level, xMin, yMin,
+  /// xMax, yMax per segment.  Vias are not included.
+  ///
+  std::vector<int> getWireSegments();
+
   ///
   /// Get the modules of this block.
   ///
@@ -1464,6 +1519,11 @@ class dbBlock : public dbObject
   ///
   dbBlockSearch* getSearchDb();
 
+  ///
+  /// Get the packed global routing guides of the block, see dbGuideStore.
+  ///
+  dbGuideStore* getGuideStore();
+
   ///
   /// destroy coupling caps of nets
   ///
@@ -1704,6 +1764,24 @@ class dbBlock : public dbObject
                           FILE* out,
                           int indent_per_level = 4);
 
+  ///
+  /// Content hash of the object tables of this block.  Blocks holding the
+  /// same objects under the same ids hash equal, independent of the order in
+  /// which objects were destroyed.
+  ///
+  uint64_t getContentHash();
+
+  ///
+  /// Compare the blocks by per-page content hashes and show the differences
+  /// of the objects on mismatching pages only.  Much faster than
+  /// differences() on large blocks that are mostly equal.
+  /// Returns true if differences were found.
+  ///
+  static bool hashDifferences(dbBlock* block1,
+                              dbBlock* block2,
+                              FILE* out,
+                              int indent_per_level = 4);
+
  private:
   void ComputeBBox();
 };
@@ -3291,6 +3369,24 @@ class dbInst : public dbObject
   ///
   bool swapMaster(dbMaster* master);
 
+  ///
+  /// Swap the masters of many instances of a block at once.  Unlike
+  /// swapMaster the mterms of the new master do not have to match the old
+  /// ones: map_mterm returns the mterm of the new master that takes over the
+  /// connections of an old mterm, or nullptr to drop them.  It is called
+  /// once per mterm of each distinct (old master, new master) pair.
+  ///
+  /// Each instance is replaced by a new one with the same name, module,
+  /// region and placement.  All the old instances are destroyed before the
+  /// new ones are created and connected, and the moves of the new instances
+  /// are delivered as a single dbInstMoveBatch.  Hierarchical instances are
+  /// not swapped.  Returns the instance that holds each swap, in order.
+  ///
+  static std::vector<dbInst*> swapMasters(
+      dbBlock* block,
+      const std::vector<std::pair<dbInst*, dbMaster*>>& swaps,
+      const std::function<dbMTerm*(dbMTerm*, dbMaster*)>& map_mterm);
+
   ///
   /// Level of instance; if negative belongs to Primary Input Logic cone, 0
   /// invalid.
@@ -5060,6 +5156,29 @@ class dbRow : public dbObject
                        int num_sites,
                        int spacing);
 
+  ///
+  /// The arguments of dbRow::create for one row of a bulk create.
+  ///
+  struct Params
+  {
+    std::string name;
+    dbSite* site = nullptr;
+    int origin_x = 0;
+    int origin_y = 0;
+    dbOrientType orient;
+    dbRowDir direction;
+    int num_sites = 0;
+    int spacing = 0;
+  };
+
+  ///
+  /// Create the given rows, in order, and return them.  The rows can be
+  /// computed ahead of time, in parallel if there are many, and created
+  /// here in one call.
+  ///
+  static std::vector<dbRow*> create(dbBlock* block,
+                                    const std::vector<Params>& rows);
+
   ///
   /// Destroy a row.
   ///
@@ -7276,8 +7395,8 @@ class dbGCellGrid : public dbObject
  public:
   struct GCellData
   {
-    uint8_t usage = 0;
-    uint8_t capacity = 0;
+    uint16_t usage = 0;
+    uint16_t capacity = 0;
   };
 
   // User Code Begin dbGCellGrid
@@ -7341,16 +7460,16 @@ class dbGCellGrid : public dbObject
 
   uint getYIdx(int y);
 
-  uint8_t getCapacity(dbTechLayer* layer, uint x_idx, uint y_idx) const;
+  uint16_t getCapacity(dbTechLayer* layer, uint x_idx, uint y_idx) const;
 
-  uint8_t getUsage(dbTechLayer* layer, uint x_idx, uint y_idx) const;
+  uint16_t getUsage(dbTechLayer* layer, uint x_idx, uint y_idx) const;
 
   void setCapacity(dbTechLayer* layer,
                    uint x_idx,
                    uint y_idx,
-                   uint8_t capacity);
+                   uint16_t capacity);
 
-  void setUsage(dbTechLayer* layer, uint x_idx, uint y_idx, uint8_t use);
+  void setUsage(dbTechLayer* layer, uint x_idx, uint y_idx, uint16_t use);
 
   void resetCongestionMap();
 
@@ -7358,6 +7477,13 @@ class dbGCellGrid : public dbObject
 
   dbMatrix<dbGCellGrid::GCellData> getLayerCongestionMap(dbTechLayer* layer);
 
+  ///
+  /// Set the capacity and usage of every gcell of a layer at once.
+  /// The matrix is indexed by (x_idx, y_idx) and must match the grid size.
+  ///
+  void setLayerCongestionMap(dbTechLayer* layer,
+                             dbMatrix<dbGCellGrid::GCellData> congestion);
+
   dbMatrix<dbGCellGrid::GCellData> getDirectionCongestionMap(
       const dbTechLayerDir& direction);
   // User Code End dbGCellGrid
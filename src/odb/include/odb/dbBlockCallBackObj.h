@@ -33,6 +33,7 @@
 #pragma once
 
 #include <list>
+#include <vector>
 
 #include "odb.h"
 
@@ -80,6 +81,9 @@ class dbBlockCallBackObj
   virtual void inDbInstSwapMasterAfter(dbInst*) {}
   virtual void inDbPreMoveInst(dbInst*) {}
   virtual void inDbPostMoveInst(dbInst*) {}
+  // Delivered once per observer at the end of a dbInstMoveBatch with each
+  // moved instance listed once.  Defaults to inDbPostMoveInst per instance.
+  virtual void inDbPostMoveInsts(const std::vector<dbInst*>& insts);
   // dbInst End
 
   // dbNet Start
@@ -183,4 +187,25 @@ class dbBlockCallBackObj
   dbBlock* _owner;
 };
 
+///////////////////////////////////////////////////////////////////////////////
+///
+/// dbInstMoveBatch - Defers the post-move callbacks of a block while in
+/// scope.  inDbPreMoveInst is still called before an instance's first move
+/// in the batch; the post-move notifications are coalesced per instance and
+/// delivered through inDbPostMoveInsts when the outermost batch ends.
+///
+///////////////////////////////////////////////////////////////////////////////
+class dbInstMoveBatch
+{
+ public:
+  explicit dbInstMoveBatch(dbBlock* block);
+  ~dbInstMoveBatch();
+
+  dbInstMoveBatch(const dbInstMoveBatch&) = delete;
+  dbInstMoveBatch& operator=(const dbInstMoveBatch&) = delete;
+
+ private:
+  dbBlock* block_;
+};
+
 }  // namespace odb
@@ -0,0 +1,127 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#pragma once
+
+#include <boost/geometry/index/rtree.hpp>
+#include <unordered_map>
+#include <vector>
+
+#include "odb/dbBlockCallBackObj.h"
+#include "odb/geom_boost.h"
+
+namespace odb {
+
+class dbBlockage;
+class dbTechLayer;
+
+///////////////////////////////////////////////////////////////////////////////
+///
+/// dbBlockShapeIndex - R-trees over the shapes of a block, built once and
+/// kept current through the block callbacks so tools can share them rather
+/// than each building their own.
+///
+/// Indexed are placed instances and blockages by bounding box, and special
+/// wire boxes, wire shapes and obstructions per layer (vias are split into
+/// their layer boxes).  Queries return every object with a shape touching
+/// the query rectangle; an object is reported once per matching shape.
+///
+///////////////////////////////////////////////////////////////////////////////
+class dbBlockShapeIndex : public dbBlockCallBackObj
+{
+ public:
+  explicit dbBlockShapeIndex(dbBlock* block);
+
+  void queryInsts(const Rect& rect, std::vector<dbInst*>& insts) const;
+  void queryBlockages(const Rect& rect,
+                      std::vector<dbBlockage*>& blockages) const;
+  void querySBoxes(dbTechLayer* layer,
+                   const Rect& rect,
+                   std::vector<dbSBox*>& sboxes) const;
+  void queryWires(dbTechLayer* layer,
+                  const Rect& rect,
+                  std::vector<dbWire*>& wires) const;
+  void queryObstructions(dbTechLayer* layer,
+                         const Rect& rect,
+                         std::vector<dbObstruction*>& obstructions) const;
+
+  // dbBlockCallBackObj
+  void inDbInstCreate(dbInst* inst) override;
+  void inDbInstCreate(dbInst* inst, dbRegion* region) override;
+  void inDbInstDestroy(dbInst* inst) override;
+  void inDbInstPlacementStatusBefore(dbInst* inst,
+                                     const dbPlacementStatus& status) override;
+  void inDbInstSwapMasterBefore(dbInst* inst, dbMaster* master) override;
+  void inDbInstSwapMasterAfter(dbInst* inst) override;
+  void inDbPreMoveInst(dbInst* inst) override;
+  void inDbPostMoveInst(dbInst* inst) override;
+  void inDbBlockageCreate(dbBlockage* blockage) override;
+  void inDbObstructionCreate(dbObstruction* obstruction) override;
+  void inDbObstructionDestroy(dbObstruction* obstruction) override;
+  void inDbSWireAddSBox(dbSBox* sbox) override;
+  void inDbSWireRemoveSBox(dbSBox* sbox) override;
+  void inDbSWirePreDestroySBoxes(dbSWire* swire) override;
+  void inDbWireCreate(dbWire* wire) override;
+  void inDbWireDestroy(dbWire* wire) override;
+  void inDbWirePostModify(dbWire* wire) override;
+  void inDbWirePostAppend(dbWire* src, dbWire* dst) override;
+  void inDbWirePostCopy(dbWire* src, dbWire* dst) override;
+
+ private:
+  template <typename T>
+  using RTree = boost::geometry::index::
+      rtree<std::pair<Rect, T*>, boost::geometry::index::quadratic<16>>;
+  template <typename T>
+  using LayerRTrees = std::unordered_map<dbTechLayer*, RTree<T>>;
+  using LayerBoxes = std::vector<std::pair<dbTechLayer*, Rect>>;
+
+  static LayerBoxes getSBoxShapes(dbSBox* sbox);
+  static LayerBoxes getWireShapes(dbWire* wire);
+
+  void addInst(dbInst* inst);
+  void removeInst(dbInst* inst);
+  void addSBox(dbSBox* sbox);
+  void removeSBox(dbSBox* sbox);
+  void addWire(dbWire* wire);
+  void removeWire(dbWire* wire);
+
+  RTree<dbInst> insts_;
+  RTree<dbBlockage> blockages_;
+  LayerRTrees<dbSBox> sboxes_;
+  LayerRTrees<dbWire> wires_;
+  LayerRTrees<dbObstruction> obstructions_;
+  // the shapes each wire was indexed with, as its path may since have changed
+  std::unordered_map<dbWire*, LayerBoxes> wire_shapes_;
+};
+
+}  // namespace odb
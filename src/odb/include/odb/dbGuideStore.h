@@ -0,0 +1,147 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "odb/geom.h"
+
+namespace odb {
+
+class dbBlock;
+class dbNet;
+class dbTechLayer;
+
+///////////////////////////////////////////////////////////////////////////////
+///
+/// dbGuideStore - the global routing guides of a block packed as gcell
+/// ranges, so the global router can hand them to the detailed router
+/// without creating a dbGuide per box.
+///
+/// Each block owns one store (dbBlock::getGuideStore).  A net's packed
+/// guides are turned into dbGuide objects the first time they are needed
+/// through the db: dbNet::getGuides, dbGuide::create on the net, or
+/// writing the block.  Clearing or destroying the net drops them.
+///
+///////////////////////////////////////////////////////////////////////////////
+class dbGuideStore
+{
+ public:
+  struct Guide
+  {
+    // Gcell ranges, inclusive.
+    int x_lo;
+    int y_lo;
+    int x_hi;
+    int y_hi;
+    // Tech layer ids.
+    uint16_t layer;
+    uint16_t via_layer;
+  };
+
+  class Range
+  {
+   public:
+    Range(const Guide* begin, const Guide* end) : begin_(begin), end_(end) {}
+    const Guide* begin() const { return begin_; }
+    const Guide* end() const { return end_; }
+    bool empty() const { return begin_ == end_; }
+    int size() const { return end_ - begin_; }
+
+   private:
+    const Guide* begin_;
+    const Guide* end_;
+  };
+
+  explicit dbGuideStore(dbBlock* block);
+  dbGuideStore(dbBlock* block, const dbGuideStore& other);
+
+  ///
+  /// Sets the gcell grid of the guides: the area covered by the grid,
+  /// the side of a gcell, and the offset added to the guide boxes.  The
+  /// guides packed on a different grid are turned into dbGuides first.
+  ///
+  void setGrid(const Rect& grid_area, int tile_size, const Point& offset);
+
+  ///
+  /// Replaces the guides of the net, packed and dbGuide alike.
+  ///
+  void setGuides(dbNet* net, const std::vector<Guide>& guides);
+
+  ///
+  /// Packed guides of the net, empty once they are dbGuides.
+  ///
+  Range getGuides(dbNet* net) const;
+  bool hasGuides(dbNet* net) const;
+
+  Rect getBox(const Guide& guide) const;
+  dbTechLayer* getLayer(const Guide& guide) const;
+  dbTechLayer* getViaLayer(const Guide& guide) const;
+
+  ///
+  /// Turns the packed guides of the net, or of every net, into dbGuides.
+  ///
+  void materialize(dbNet* net);
+  void materializeAll();
+
+  ///
+  /// Drops the packed guides of the net.
+  ///
+  void clear(dbNet* net);
+
+  int64_t getMemoryUsage() const;
+
+ private:
+  struct NetRange
+  {
+    uint32_t begin = 0;
+    uint32_t end = 0;
+  };
+
+  NetRange* findRange(uint net_id);
+  const NetRange* findRange(uint net_id) const;
+  void compact();
+
+  dbBlock* block_;
+  Rect grid_area_;
+  int tile_size_ = 0;
+  Point offset_;
+  // Guides of the nets, contiguous per net, in the order they were set.
+  std::vector<Guide> guides_;
+  // Indexed by net id.
+  std::vector<NetRange> ranges_;
+  uint32_t live_guides_ = 0;
+};
+
+}  // namespace odb
@@ -53,6 +53,11 @@ class dbIterator
   virtual uint end(dbObject* parent) = 0;
   virtual uint next(uint id, ...) = 0;
   virtual dbObject* getObject(uint id, ...) = 0;
+  // Sequential iterators return the first object id >= id, or end().
+  virtual uint seek(dbObject* parent, uint /* unused: id */)
+  {
+    return begin(parent);
+  }
   virtual ~dbIterator() = default;
 };
 
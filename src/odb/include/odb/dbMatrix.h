@@ -32,6 +32,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <vector>
 
 #include "dbDiff.h"
@@ -68,7 +69,8 @@ class dbMatrix
  private:
   uint _n = 0;
   uint _m = 0;
-  std::vector<std::vector<T>> _matrix;
+  // Row major, element (i, j) is at i * _m + j
+  std::vector<T> _matrix;
 };
 
 template <class T>
@@ -129,33 +131,43 @@ inline uint dbMatrix<T>::numElems() const
 template <class T>
 inline void dbMatrix<T>::resize(uint n, uint m)
 {
-  _n = n;
-  _m = m;
-  _matrix.resize(n);
+  if (m == _m) {
+    _n = n;
+    _matrix.resize(static_cast<size_t>(n) * m);
+    return;
+  }
 
-  for (uint i = 0; i < _n; ++i) {
-    _matrix[i].resize(m);
+  // Keep the elements that are still inside the matrix at their (i, j)
+  std::vector<T> matrix(static_cast<size_t>(n) * m);
+  for (uint i = 0; i < std::min(n, _n); ++i) {
+    for (uint j = 0; j < std::min(m, _m); ++j) {
+      matrix[static_cast<size_t>(i) * m + j]
+          = std::move(_matrix[static_cast<size_t>(i) * _m + j]);
+    }
   }
+  _n = n;
+  _m = m;
+  _matrix = std::move(matrix);
 }
 
 template <class T>
 inline const T& dbMatrix<T>::operator()(uint i, uint j) const
 {
   assert((i >= 0) && (i < _n) && (j >= 0) && (j < _m));
-  return _matrix[i][j];
+  return _matrix[static_cast<size_t>(i) * _m + j];
 }
 
 template <class T>
 inline T& dbMatrix<T>::operator()(uint i, uint j)
 {
   assert((i >= 0) && (i < _n) && (j >= 0) && (j < _m));
-  return _matrix[i][j];
+  return _matrix[static_cast<size_t>(i) * _m + j];
 }
 
 template <class T>
 inline bool dbMatrix<T>::operator==(const dbMatrix<T>& rhs) const
 {
-  return _matrix == rhs._matrix;
+  return _n == rhs._n && _m == rhs._m && _matrix == rhs._matrix;
 }
 
 template <class T>
@@ -32,6 +32,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <vector>
+
 #include "dbObject.h"
 
 namespace odb {
@@ -171,6 +174,36 @@ class dbSet<dbNet>
   /// Returns true if set is empty
   ///
   bool empty() { return begin() == end(); }
+
+  ///
+  /// Split the set into at most count consecutive ranges, see dbSet::split.
+  ///
+  std::vector<dbSetRange<dbNet>> split(uint count);
 };
 
+inline std::vector<dbSetRange<dbNet>> dbSet<dbNet>::split(uint count)
+{
+  std::vector<dbSetRange<dbNet>> ranges;
+  const uint last = sequential();
+  const uint first = _itr->begin(_parent);
+  const uint end_id = _itr->end(_parent);
+  if (last == 0 || count <= 1 || first == end_id) {
+    ranges.emplace_back(begin(), end());
+    return ranges;
+  }
+
+  const uint span = last - first + 1;
+  const uint step = std::max(1U, (span + count - 1) / count);
+  uint cur = first;
+  for (uint lo = first + step; cur != end_id; lo += step) {
+    const uint next = lo > last ? end_id : _itr->seek(_parent, lo);
+    if (next != cur) {
+      ranges.emplace_back(iterator(_itr, cur, _parent),
+                          iterator(_itr, next, _parent));
+    }
+    cur = next;
+  }
+  return ranges;
+}
+
 }  // namespace odb
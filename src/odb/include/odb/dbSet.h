@@ -32,6 +32,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <vector>
+
 #include "dbIterator.h"
 
 namespace odb {
@@ -39,6 +42,9 @@ namespace odb {
 template <class T>
 class dbSet;
 
+template <class T>
+class dbSetRange;
+
 template <class T>
 class dbSetIterator
 {
@@ -90,6 +96,18 @@ class dbSetIterator
 ///
 /// Non-Sequential set iterators do not have any ordering property.
 ///
+/// Sequential sets can be split into ranges that are iterated
+/// independently, e.g. one range per thread:
+///
+///     std::vector<dbSetRange<dbInst>> ranges = block->getInsts().split(n);
+///     #pragma omp parallel for
+///     for (int i = 0; i < ranges.size(); ++i)
+///       for (dbInst* inst : ranges[i]) ...
+///
+/// Concurrent iteration and getter calls are safe as long as no thread
+/// modifies the database at the same time.  Getters that update a cached
+/// value (such as dbBlock::getBBox) must be called before going parallel.
+///
 template <class T>
 class dbSet
 {
@@ -163,8 +181,58 @@ class dbSet
   /// Returns true if set is empty
   ///
   bool empty() { return begin() == end(); }
+
+  ///
+  /// Split the set into at most count consecutive ranges of similar id
+  /// spans which together iterate the whole set in order.  Non-sequential
+  /// sets are returned as one range.
+  ///
+  std::vector<dbSetRange<T>> split(uint count);
 };
 
+///
+/// A sub-range of a dbSet; see dbSet::split.
+///
+template <class T>
+class dbSetRange
+{
+ public:
+  using iterator = dbSetIterator<T>;
+
+  dbSetRange(iterator begin, iterator end) : _begin(begin), _end(end) {}
+
+  iterator begin() const { return _begin; }
+  iterator end() const { return _end; }
+
+ private:
+  iterator _begin;
+  iterator _end;
+};
+
+template <class T>
+inline std::vector<dbSetRange<T>> dbSet<T>::split(uint count)
+{
+  std::vector<dbSetRange<T>> ranges;
+  const uint last = sequential();
+  const uint first = _itr->begin(_parent);
+  if (last == 0 || count <= 1 || first == _itr->end(_parent)) {
+    ranges.emplace_back(begin(), end());
+    return ranges;
+  }
+
+  const uint span = last - first + 1;
+  const uint step = std::max(1U, (span + count - 1) / count);
+  uint cur = first;
+  for (uint lo = first + step; cur != _itr->end(_parent); lo += step) {
+    const uint next = lo > last ? _itr->end(_parent) : _itr->seek(_parent, lo);
+    if (next != cur) {
+      ranges.emplace_back(iterator(_itr, cur), iterator(_itr, next));
+    }
+    cur = next;
+  }
+  return ranges;
+}
+
 template <class T>
 inline dbSetIterator<T>::dbSetIterator()
 {
@@ -35,6 +35,7 @@
 #include <array>
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <istream>
 #include <ostream>
 #include <string>
@@ -68,6 +69,7 @@ class dbOStream
   double _lef_area_factor;
   double _lef_dist_factor;
   std::vector<Scope> _scopes;
+  std::string _prev_name;
 
   // By default values are written as their string ("255" vs 0xFF)
   // representations when using the << stream method. In dbOstream we are
@@ -272,6 +274,18 @@ class dbOStream
 
   void pushScope(const std::string& name);
   void popScope();
+
+  // Runs each writer on its own stream, in parallel, and returns the
+  // bytes they wrote.  Each result is written with writeChunk.
+  std::vector<std::string> encodeChunks(
+      const std::vector<std::function<void(dbOStream&)>>& writers);
+  // Writes a length prefixed chunk to be read by dbIStream::readChunk.
+  void writeChunk(const std::string& chunk);
+
+  // Writes name as the length of the prefix it shares with the previous
+  // name written by writeName, followed by the rest of the name.  Names
+  // of consecutive hierarchical objects mostly share their scope.
+  void writeName(const char* name);
 };
 
 // RAII class for scoping ostream operations
@@ -296,6 +310,24 @@ class dbIStream
   double _lef_area_factor;
   double _lef_dist_factor;
 
+  struct Chunk
+  {
+    std::vector<char> data;
+    std::function<void(dbIStream&)> reader;
+  };
+  std::vector<Chunk> _chunks;
+  std::string _prev_name;
+
+  // Reads straight from the stream buffer to skip the istream::read
+  // sentry on every field.  A short read sets the same state (and throws
+  // the same exceptions) as istream::read would.
+  void readBytes(char* data, std::streamsize size)
+  {
+    if (_f.rdbuf()->sgetn(data, size) != size) {
+      _f.setstate(std::ios::eofbit | std::ios::failbit);
+    }
+  }
+
  public:
   dbIStream(_dbDatabase* db, std::istream& f);
 
@@ -311,67 +343,67 @@ class dbIStream
 
   dbIStream& operator>>(char& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    readBytes(reinterpret_cast<char*>(&c), sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(unsigned char& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    readBytes(reinterpret_cast<char*>(&c), sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(int16_t& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    readBytes(reinterpret_cast<char*>(&c), sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(uint16_t& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    readBytes(reinterpret_cast<char*>(&c), sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(int& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    readBytes(reinterpret_cast<char*>(&c), sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(uint64_t& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    readBytes(reinterpret_cast<char*>(&c), sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(unsigned int& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    readBytes(reinterpret_cast<char*>(&c), sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(int8_t& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    readBytes(reinterpret_cast<char*>(&c), sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(float& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    readBytes(reinterpret_cast<char*>(&c), sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(double& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    readBytes(reinterpret_cast<char*>(&c), sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(long double& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    readBytes(reinterpret_cast<char*>(&c), sizeof(c));
     return *this;
   }
 
@@ -384,7 +416,7 @@ class dbIStream
       c = nullptr;
     } else {
       c = (char*) malloc(l);
-      _f.read(reinterpret_cast<char*>(c), l);
+      readBytes(c, l);
     }
 
     return *this;
@@ -392,7 +424,7 @@ class dbIStream
 
   dbIStream& operator>>(dbObjectType& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    readBytes(reinterpret_cast<char*>(&c), sizeof(c));
     return *this;
   }
 
@@ -490,6 +522,16 @@ class dbIStream
 
   double lefdist(int value) { return ((double) value * _lef_dist_factor); }
 
+  // Reads a chunk written by dbOStream::writeChunk.  reader decodes it
+  // on the next decodeChunks call.
+  void readChunk(std::function<void(dbIStream&)> reader);
+  // Runs the readers of the pending chunks in parallel.  A reader that
+  // doesn't consume exactly its chunk fails the stream.
+  void decodeChunks();
+
+  // Reads a name written by dbOStream::writeName into a malloc'ed string.
+  void readName(char*& name);
+
  private:
   template <uint32_t I = 0, typename... Ts>
   dbIStream& variantHelper(uint32_t index, std::variant<Ts...>& v)
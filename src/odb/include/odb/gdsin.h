@@ -35,6 +35,7 @@
 #include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <string>
 #include <vector>
 
 #include "odb/db.h"
@@ -70,15 +71,35 @@ class GDSReader
   /**
    * Reads a GDS file and returns a dbGDSLib object
    *
+   * The structure offsets are indexed first and the structures are then
+   * decoded in parallel.
+   *
    * @param filename The path to the GDS file
    * @param db The database to store the GDS data
+   * @param cells If not empty, only these structures and the structures
+   * they reference are read
    * @return A dbGDSLib object containing the GDS data
-   * @throws std::runtime_error if the file cannot be opened, or if the GDS is
-   * corrupted
+   * @throws std::runtime_error if the file cannot be opened, if the GDS is
+   * corrupted, or if one of the cells is not in the GDS
    */
-  dbGDSLib* read_gds(const std::string& filename, dbDatabase* db);
+  dbGDSLib* read_gds(const std::string& filename,
+                     dbDatabase* db,
+                     const std::vector<std::string>& cells = {});
 
  private:
+  /** Location of a structure in the GDS file */
+  struct StructureIndex
+  {
+    std::string name;
+    /** Offset of the first record after STRNAME */
+    std::streamoff offset;
+    /** Names of the structures referenced by SREFs and AREFs */
+    std::vector<std::string> refs;
+  };
+
+  /** Opens filename in _file with a large read buffer */
+  void openFile(const std::string& filename);
+
   /**
    * Checks if the read record is the expected type
    *
@@ -105,23 +126,6 @@ class GDSReader
    */
   bool checkRData(DataType eType, size_t eSize);
 
-  /**
-   * Reads a real8 from _file
-   *
-   * NOTE: real8 is not the same as double. This conversion is not lossless.
-   * @return The real8 read from _file, converted to a double
-   */
-  double readReal8();
-
-  /** Reads an int32 from _file */
-  int32_t readInt32();
-
-  /** Reads an int16 from _file */
-  int16_t readInt16();
-
-  /** Reads an int8 from _file */
-  int8_t readInt8();
-
   /**
    * Reads a record from _file and stores it in _r
    *
@@ -133,18 +137,38 @@ class GDSReader
    */
   bool readRecord();
 
+  /** Reads the record type, data type, and length from _file into _r */
+  bool readRecordHeader();
+
+  /** Reads the data of the record whose header is in _r */
+  bool readRecordData();
+
   /** Parses a GDS Lib from the GDS file */
-  bool processLib();
+  bool processLib(const std::string& filename,
+                  const std::vector<std::string>& cells);
 
-  /** Parses a GDS Structure from the GDS file */
-  bool processStruct();
+  /**
+   * Records the name, offset and references of every structure up to
+   * ENDLIB, skipping over the element data
+   *
+   * @return false if the end of the file was reached before ENDLIB
+   */
+  bool indexStructs(std::vector<StructureIndex>& index);
+
+  /**
+   * Parses the elements of a GDS Structure from the GDS file, up to ENDSTR
+   *
+   * @param elements The parsed elements, in file order
+   * @return false if the end of the file was reached before ENDSTR
+   */
+  bool processStruct(std::vector<dbGDSElement*>& elements);
 
   /**
    * Parses a GDS Element from the GDS file
    *
-   * @param str The GDS Structure to add the GDS Element to
+   * @return The parsed GDS Element
    */
-  bool processElement(dbGDSStructure& str);
+  dbGDSElement* processElement();
 
   // Specific element types, same as processElement
   dbGDSElement* processBoundary();
@@ -189,6 +213,10 @@ class GDSReader
 
   /** Current filestream */
   std::ifstream _file;
+  /** Read buffer of _file */
+  std::vector<char> _file_buffer;
+  /** Data of the most recently read record */
+  std::vector<char> _data;
   /** Most recently read record */
   record_t _r;
   /** Current ODB Database */
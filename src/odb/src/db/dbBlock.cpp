@@ -39,6 +39,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <string_view>
 
 #include "dbAccessPoint.h"
 #include "dbArrayTable.h"
@@ -128,6 +129,7 @@
 #include "odb/dbBlockCallBackObj.h"
 #include "odb/dbDiff.h"
 #include "odb/dbExtControl.h"
+#include "odb/dbGuideStore.h"
 #include "odb/dbShape.h"
 #include "odb/defout.h"
 #include "odb/lefout.h"
@@ -419,9 +421,11 @@ _dbBlock::_dbBlock(_dbDatabase* db)
 
   _num_ext_dbs = 1;
   _searchDb = nullptr;
+  _guide_store = nullptr;
   _extmi = nullptr;
   _journal = nullptr;
   _journal_pending = nullptr;
+  _move_batch_depth = 0;
 }
 
 _dbBlock::_dbBlock(_dbDatabase* db, const _dbBlock& block)
@@ -625,6 +629,11 @@ _dbBlock::_dbBlock(_dbDatabase* db, const _dbBlock& block)
   // ??? Initialize search-db on copy?
   _searchDb = nullptr;
 
+  _guide_store = nullptr;
+  if (block._guide_store) {
+    _guide_store = new dbGuideStore((dbBlock*) this, *block._guide_store);
+  }
+
   // ??? callbacks
   // _callbacks = ???
 
@@ -632,6 +641,7 @@ _dbBlock::_dbBlock(_dbDatabase* db, const _dbBlock& block)
   _extmi = block._extmi;
   _journal = nullptr;
   _journal_pending = nullptr;
+  _move_batch_depth = 0;
 }
 
 _dbBlock::~_dbBlock()
@@ -715,6 +725,7 @@ _dbBlock::~_dbBlock()
   delete _bpin_itr;
   delete _prop_itr;
   delete _dft_tbl;
+  delete _guide_store;
 
   std::list<dbBlockCallBackObj*>::iterator _cbitr;
   while (_callbacks.begin() != _callbacks.end()) {
@@ -991,11 +1002,36 @@ dbOStream& operator<<(dbOStream& stream, const _dbBlock& block)
   stream << block._component_mask_shift;
   stream << block._currentCcAdjOrder;
 
+  // The largest tables are encoded in parallel and stored as chunks so
+  // that they can be decoded in parallel too.  The chunks are written in
+  // this order.
+  const std::vector<std::string> chunks = stream.encodeChunks({
+      [&block](dbOStream& chunk) { chunk << *block._iterm_tbl; },
+      [&block](dbOStream& chunk) { chunk << *block._net_tbl; },
+      [&block](dbOStream& chunk) { chunk << *block._inst_tbl; },
+      [&block](dbOStream& chunk) { chunk << *block._box_tbl; },
+      [&block](dbOStream& chunk) { chunk << *block._wire_tbl; },
+      [&block](dbOStream& chunk) { chunk << *block._sbox_tbl; },
+      [&block](dbOStream& chunk) { chunk << *block._r_val_tbl; },
+      [&block](dbOStream& chunk) { chunk << *block._c_val_tbl; },
+      [&block](dbOStream& chunk) { chunk << *block._cc_val_tbl; },
+      [&block](dbOStream& chunk) {
+        chunk << NamedTable("cap_node_tbl", block._cap_node_tbl);
+      },
+      [&block](dbOStream& chunk) {
+        chunk << NamedTable("r_seg_tbl", block._r_seg_tbl);
+      },
+      [&block](dbOStream& chunk) {
+        chunk << NamedTable("cc_seg_tbl", block._cc_seg_tbl);
+      },
+  });
+  auto chunk = chunks.begin();
+
   stream << *block._bterm_tbl;
-  stream << *block._iterm_tbl;
-  stream << *block._net_tbl;
+  stream.writeChunk(*chunk++);  // iterm
+  stream.writeChunk(*chunk++);  // net
   stream << *block._inst_hdr_tbl;
-  stream << *block._inst_tbl;
+  stream.writeChunk(*chunk++);  // inst
   stream << *block._module_tbl;
   stream << *block._modinst_tbl;
   if (db->isSchema(db_schema_update_hierarchy)) {
@@ -1013,15 +1049,15 @@ dbOStream& operator<<(dbOStream& stream, const _dbBlock& block)
   stream << *block.global_connect_tbl_;
   stream << *block._guide_tbl;
   stream << *block._net_tracks_tbl;
-  stream << *block._box_tbl;
+  stream.writeChunk(*chunk++);  // box
   stream << *block._via_tbl;
   stream << *block._gcell_grid_tbl;
   stream << *block._track_grid_tbl;
   stream << *block._obstruction_tbl;
   stream << *block._blockage_tbl;
-  stream << *block._wire_tbl;
+  stream.writeChunk(*chunk++);  // wire
   stream << *block._swire_tbl;
-  stream << *block._sbox_tbl;
+  stream.writeChunk(*chunk++);  // sbox
   stream << *block._row_tbl;
   stream << *block._fill_tbl;
   stream << *block._region_tbl;
@@ -1032,12 +1068,12 @@ dbOStream& operator<<(dbOStream& stream, const _dbBlock& block)
   stream << *block._prop_tbl;
 
   stream << *block._name_cache;
-  stream << *block._r_val_tbl;
-  stream << *block._c_val_tbl;
-  stream << *block._cc_val_tbl;
-  stream << NamedTable("cap_node_tbl", block._cap_node_tbl);
-  stream << NamedTable("r_seg_tbl", block._r_seg_tbl);
-  stream << NamedTable("cc_seg_tbl", block._cc_seg_tbl);
+  stream.writeChunk(*chunk++);  // r_val
+  stream.writeChunk(*chunk++);  // c_val
+  stream.writeChunk(*chunk++);  // cc_val
+  stream.writeChunk(*chunk++);  // cap_node
+  stream.writeChunk(*chunk++);  // r_seg
+  stream.writeChunk(*chunk++);  // cc_seg
   stream << *block._extControl;
   stream << block._dft;
   stream << *block._dft_tbl;
@@ -1123,11 +1159,20 @@ dbIStream& operator>>(dbIStream& stream, _dbBlock& block)
     stream >> block._component_mask_shift;
   }
   stream >> block._currentCcAdjOrder;
+  // See operator<< for the tables stored as chunks
+  const bool chunked = db->isSchema(db_schema_block_table_chunks);
+  auto read_table = [&stream, chunked](auto& table) {
+    if (chunked) {
+      stream.readChunk([&table](dbIStream& chunk) { chunk >> table; });
+    } else {
+      stream >> table;
+    }
+  };
   stream >> *block._bterm_tbl;
-  stream >> *block._iterm_tbl;
-  stream >> *block._net_tbl;
+  read_table(*block._iterm_tbl);
+  read_table(*block._net_tbl);
   stream >> *block._inst_hdr_tbl;
-  stream >> *block._inst_tbl;
+  read_table(*block._inst_tbl);
   stream >> *block._module_tbl;
   stream >> *block._modinst_tbl;
   if (db->isSchema(db_schema_update_hierarchy)) {
@@ -1151,15 +1196,15 @@ dbIStream& operator>>(dbIStream& stream, _dbBlock& block)
   if (db->isSchema(db_schema_net_tracks)) {
     stream >> *block._net_tracks_tbl;
   }
-  stream >> *block._box_tbl;
+  read_table(*block._box_tbl);
   stream >> *block._via_tbl;
   stream >> *block._gcell_grid_tbl;
   stream >> *block._track_grid_tbl;
   stream >> *block._obstruction_tbl;
   stream >> *block._blockage_tbl;
-  stream >> *block._wire_tbl;
+  read_table(*block._wire_tbl);
   stream >> *block._swire_tbl;
-  stream >> *block._sbox_tbl;
+  read_table(*block._sbox_tbl);
   stream >> *block._row_tbl;
   stream >> *block._fill_tbl;
   stream >> *block._region_tbl;
@@ -1169,17 +1214,18 @@ dbIStream& operator>>(dbIStream& stream, _dbBlock& block)
   stream >> *block._layer_rule_tbl;
   stream >> *block._prop_tbl;
   stream >> *block._name_cache;
-  stream >> *block._r_val_tbl;
-  stream >> *block._c_val_tbl;
-  stream >> *block._cc_val_tbl;
-  stream >> *block._cap_node_tbl;  // DKF
-  stream >> *block._r_seg_tbl;     // DKF
-  stream >> *block._cc_seg_tbl;
+  read_table(*block._r_val_tbl);
+  read_table(*block._c_val_tbl);
+  read_table(*block._cc_val_tbl);
+  read_table(*block._cap_node_tbl);  // DKF
+  read_table(*block._r_seg_tbl);     // DKF
+  read_table(*block._cc_seg_tbl);
   stream >> *block._extControl;
   if (db->isSchema(db_schema_add_scan)) {
     stream >> block._dft;
     stream >> *block._dft_tbl;
   }
+  stream.decodeChunks();
 
   //---------------------------------------------------------- stream in
   // properties
@@ -1756,6 +1802,53 @@ void _dbBlock::out(dbDiff& diff, char side, const char* field) const
   DIFF_END
 }
 
+template <typename Visitor>
+void _dbBlock::visitTables(Visitor&& visitor)
+{
+  visitor("bterm_tbl", &_dbBlock::_bterm_tbl);
+  visitor("iterm_tbl", &_dbBlock::_iterm_tbl);
+  visitor("net_tbl", &_dbBlock::_net_tbl);
+  visitor("inst_hdr_tbl", &_dbBlock::_inst_hdr_tbl);
+  visitor("inst_tbl", &_dbBlock::_inst_tbl);
+  visitor("box_tbl", &_dbBlock::_box_tbl);
+  visitor("via_tbl", &_dbBlock::_via_tbl);
+  visitor("gcell_grid_tbl", &_dbBlock::_gcell_grid_tbl);
+  visitor("track_grid_tbl", &_dbBlock::_track_grid_tbl);
+  visitor("obstruction_tbl", &_dbBlock::_obstruction_tbl);
+  visitor("blockage_tbl", &_dbBlock::_blockage_tbl);
+  visitor("wire_tbl", &_dbBlock::_wire_tbl);
+  visitor("swire_tbl", &_dbBlock::_swire_tbl);
+  visitor("sbox_tbl", &_dbBlock::_sbox_tbl);
+  visitor("row_tbl", &_dbBlock::_row_tbl);
+  visitor("fill_tbl", &_dbBlock::_fill_tbl);
+  visitor("region_tbl", &_dbBlock::_region_tbl);
+  visitor("hier_tbl", &_dbBlock::_hier_tbl);
+  visitor("bpin_tbl", &_dbBlock::_bpin_tbl);
+  visitor("non_default_rule_tbl", &_dbBlock::_non_default_rule_tbl);
+  visitor("layer_rule_tbl", &_dbBlock::_layer_rule_tbl);
+  visitor("prop_tbl", &_dbBlock::_prop_tbl);
+  visitor("module_tbl", &_dbBlock::_module_tbl);
+  visitor("powerdomain_tbl", &_dbBlock::_powerdomain_tbl);
+  visitor("logicport_tbl", &_dbBlock::_logicport_tbl);
+  visitor("powerswitch_tbl", &_dbBlock::_powerswitch_tbl);
+  visitor("isolation_tbl", &_dbBlock::_isolation_tbl);
+  visitor("levelshifter_tbl", &_dbBlock::_levelshifter_tbl);
+  visitor("modinst_tbl", &_dbBlock::_modinst_tbl);
+  visitor("group_tbl", &_dbBlock::_group_tbl);
+  visitor("ap_tbl", &_dbBlock::ap_tbl_);
+  visitor("global_connect_tbl", &_dbBlock::global_connect_tbl_);
+  visitor("guide_tbl", &_dbBlock::_guide_tbl);
+  visitor("net_tracks_tbl", &_dbBlock::_net_tracks_tbl);
+  visitor("dft_tbl", &_dbBlock::_dft_tbl);
+  visitor("modbterm_tbl", &_dbBlock::_modbterm_tbl);
+  visitor("moditerm_tbl", &_dbBlock::_moditerm_tbl);
+  visitor("modnet_tbl", &_dbBlock::_modnet_tbl);
+  visitor("busport_tbl", &_dbBlock::_busport_tbl);
+  visitor("cap_node_tbl", &_dbBlock::_cap_node_tbl);
+  visitor("r_seg_tbl", &_dbBlock::_r_seg_tbl);
+  visitor("cc_seg_tbl", &_dbBlock::_cc_seg_tbl);
+}
+
 ////////////////////////////////////////////////////////////////////
 //
 // dbBlock - Methods
@@ -1949,6 +2042,91 @@ dbSet<dbInst> dbBlock::getInsts()
   return dbSet<dbInst>(block, block->_inst_tbl);
 }
 
+std::vector<int> dbBlock::getInstBBoxes()
+{
+  dbSet<dbInst> insts = getInsts();
+  std::vector<int> bboxes;
+  bboxes.reserve(4 * insts.size());
+  for (dbInst* inst : insts) {
+    const Rect bbox = inst->getBBox()->getBox();
+    bboxes.insert(bboxes.end(),
+                  {bbox.xMin(), bbox.yMin(), bbox.xMax(), bbox.yMax()});
+  }
+  return bboxes;
+}
+
+std::vector<int> dbBlock::getInstOrients()
+{
+  dbSet<dbInst> insts = getInsts();
+  std::vector<int> orients;
+  orients.reserve(insts.size());
+  for (dbInst* inst : insts) {
+    orients.push_back(inst->getOrient().getValue());
+  }
+  return orients;
+}
+
+std::vector<int> dbBlock::getInstMasterIds()
+{
+  dbSet<dbInst> insts = getInsts();
+  std::vector<int> master_ids;
+  master_ids.reserve(insts.size());
+  for (dbInst* inst : insts) {
+    master_ids.push_back(inst->getMaster()->getId());
+  }
+  return master_ids;
+}
+
+std::vector<int> dbBlock::getNetPinLocations()
+{
+  std::vector<int> locations;
+  locations.reserve(3 * (getITerms().size() + getBTerms().size()));
+  for (dbNet* net : getNets()) {
+    const int net_id = net->getId();
+    int x, y;
+    for (dbITerm* iterm : net->getITerms()) {
+      if (iterm->getAvgXY(&x, &y)) {
+        locations.insert(locations.end(), {net_id, x, y});
+      }
+    }
+    for (dbBTerm* bterm : net->getBTerms()) {
+      if (bterm->getFirstPinLocation(x, y)) {
+        locations.insert(locations.end(), {net_id, x, y});
+      }
+    }
+  }
+  return locations;
+}
+
+std::vector<int> dbBlock::getWireSegments()
+{
+  std::vector<int> segments;
+  dbWireShapeItr shapes;
+  dbShape shape;
+  for (dbNet* net : getNets()) {
+    dbWire* wire = net->getWire();
+    if (wire == nullptr) {
+      continue;
+    }
+    const int net_id = net->getId();
+    shapes.begin(wire);
+    while (shapes.next(shape)) {
+      if (shape.isVia()) {
+        continue;
+      }
+      const Rect box = shape.getBox();
+      segments.insert(segments.end(),
+                      {net_id,
+                       shape.getTechLayer()->getRoutingLevel(),
+                       box.xMin(),
+                       box.yMin(),
+                       box.xMax(),
+                       box.yMax()});
+    }
+  }
+  return segments;
+}
+
 dbSet<dbModule> dbBlock::getModules()
 {
   _dbBlock* block = (_dbBlock*) this;
@@ -3133,6 +3311,15 @@ dbBlockSearch* dbBlock::getSearchDb()
   return block->_searchDb;
 }
 
+dbGuideStore* dbBlock::getGuideStore()
+{
+  _dbBlock* block = (_dbBlock*) this;
+  if (block->_guide_store == nullptr) {
+    block->_guide_store = new dbGuideStore(this);
+  }
+  return block->_guide_store;
+}
+
 void dbBlock::getWireUpdatedNets(std::vector<dbNet*>& result)
 {
   dbSet<dbNet> nets = getNets();
@@ -3616,6 +3803,58 @@ bool dbBlock::differences(dbBlock* block1,
   return diff.hasDifferences();
 }
 
+uint64_t dbBlock::getContentHash()
+{
+  _dbBlock* block = (_dbBlock*) this;
+  std::vector<uint64_t> table_hashes;
+  std::vector<uint64_t> page_hashes;
+
+  _dbBlock::visitTables([&](const char* /* unused: name */, auto member) {
+    table_hashes.push_back((block->*member)->contentHash(page_hashes));
+  });
+
+  const std::string_view hashes((const char*) table_hashes.data(),
+                                table_hashes.size() * sizeof(uint64_t));
+  return std::hash<std::string_view>()(hashes);
+}
+
+bool dbBlock::hashDifferences(dbBlock* block1,
+                              dbBlock* block2,
+                              FILE* out,
+                              int indent)
+{
+  _dbBlock* b1 = (_dbBlock*) block1;
+  _dbBlock* b2 = (_dbBlock*) block2;
+
+  dbDiff diff(out);
+  diff.setDeepDiff(true);
+  diff.setIndentPerLevel(indent);
+
+  _dbBlock::visitTables([&](const char* name, auto member) {
+    const auto& lhs = *(b1->*member);
+    const auto& rhs = *(b2->*member);
+    std::vector<uint64_t> lhs_pages;
+    std::vector<uint64_t> rhs_pages;
+
+    if (lhs.contentHash(lhs_pages) == rhs.contentHash(rhs_pages)) {
+      return;
+    }
+
+    const uint page_cnt = std::max(lhs_pages.size(), rhs_pages.size());
+    diff.begin_object("<> %s\n", name);
+    for (uint page_id = 0; page_id < page_cnt; ++page_id) {
+      if (page_id < lhs_pages.size() && page_id < rhs_pages.size()
+          && lhs_pages[page_id] == rhs_pages[page_id]) {
+        continue;
+      }
+      lhs.pageDifferences(diff, rhs, page_id);
+    }
+    diff.end_object();
+  });
+
+  return diff.hasDifferences();
+}
+
 uint dbBlock::levelize(std::vector<dbInst*>& startingInsts,
                        std::vector<dbInst*>& instsToBeLeveled)
 {
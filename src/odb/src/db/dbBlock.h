@@ -33,6 +33,7 @@
 #pragma once
 
 #include <list>
+#include <unordered_set>
 #include <vector>
 
 #include "dbCore.h"
@@ -136,6 +137,7 @@ class dbDiff;
 class dbBlockSearch;
 class dbBlockCallBackObj;
 class dbGuideItr;
+class dbGuideStore;
 class dbNetTrackItr;
 class _dbDft;
 
@@ -286,10 +288,15 @@ class _dbBlock : public _dbObject
   dbBPinItr* _bpin_itr;
   dbPropertyItr* _prop_itr;
   dbBlockSearch* _searchDb;
+  dbGuideStore* _guide_store;
 
   unsigned char _num_ext_dbs;
 
   std::list<dbBlockCallBackObj*> _callbacks;
+  // Nesting depth of dbInstMoveBatch and the instances moved in it
+  int _move_batch_depth;
+  std::vector<dbInst*> _moved_insts;
+  std::unordered_set<dbInst*> _moved_inst_set;
   void* _extmi;
 
   dbJournal* _journal;
@@ -313,6 +320,10 @@ class _dbBlock : public _dbObject
   void differences(dbDiff& diff, const char* field, const _dbBlock& rhs) const;
   void out(dbDiff& diff, char side, const char* field) const;
 
+  // Calls visitor(name, member) for each dbTable member of the block.
+  template <typename Visitor>
+  static void visitTables(Visitor&& visitor);
+
   int globalConnect(const std::vector<dbGlobalConnect*>& connects);
   _dbTech* getTech();
 
@@ -42,6 +42,13 @@ namespace odb {
 //
 ////////////////////////////////////////////////////////////////////
 
+void dbBlockCallBackObj::inDbPostMoveInsts(const std::vector<dbInst*>& insts)
+{
+  for (dbInst* inst : insts) {
+    inDbPostMoveInst(inst);
+  }
+}
+
 void dbBlockCallBackObj::addOwner(dbBlock* new_owner)
 {
   if (!new_owner) {
@@ -66,4 +73,27 @@ void dbBlockCallBackObj::removeOwner()
   }
 }
 
+dbInstMoveBatch::dbInstMoveBatch(dbBlock* block) : block_(block)
+{
+  ((_dbBlock*) block_)->_move_batch_depth++;
+}
+
+dbInstMoveBatch::~dbInstMoveBatch()
+{
+  _dbBlock* block = (_dbBlock*) block_;
+  if (--block->_move_batch_depth > 0) {
+    return;
+  }
+
+  std::vector<dbInst*> insts;
+  insts.swap(block->_moved_insts);
+  block->_moved_inst_set.clear();
+  if (insts.empty()) {
+    return;
+  }
+  for (auto callback : block->_callbacks) {
+    callback->inDbPostMoveInsts(insts);
+  }
+}
+
 }  // namespace odb
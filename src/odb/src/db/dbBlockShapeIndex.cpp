@@ -0,0 +1,345 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "odb/dbBlockShapeIndex.h"
+
+#include <iterator>
+
+#include "odb/db.h"
+#include "odb/dbShape.h"
+
+namespace odb {
+
+namespace bgi = boost::geometry::index;
+
+template <typename Tree, typename T>
+static void queryTree(const Tree& tree, const Rect& rect, std::vector<T*>& objs)
+{
+  for (auto it = tree.qbegin(bgi::intersects(rect)); it != tree.qend(); ++it) {
+    objs.push_back(it->second);
+  }
+}
+
+template <typename Trees, typename T>
+static void queryLayer(const Trees& trees,
+                       dbTechLayer* layer,
+                       const Rect& rect,
+                       std::vector<T*>& objs)
+{
+  auto it = trees.find(layer);
+  if (it != trees.end()) {
+    queryTree(it->second, rect, objs);
+  }
+}
+
+dbBlockShapeIndex::dbBlockShapeIndex(dbBlock* block)
+{
+  std::vector<std::pair<Rect, dbInst*>> insts;
+  for (dbInst* inst : block->getInsts()) {
+    if (inst->isPlaced()) {
+      insts.emplace_back(inst->getBBox()->getBox(), inst);
+    }
+  }
+  insts_ = RTree<dbInst>(insts.begin(), insts.end());
+
+  std::vector<std::pair<Rect, dbBlockage*>> blockages;
+  for (dbBlockage* blockage : block->getBlockages()) {
+    blockages.emplace_back(blockage->getBBox()->getBox(), blockage);
+  }
+  blockages_ = RTree<dbBlockage>(blockages.begin(), blockages.end());
+
+  std::unordered_map<dbTechLayer*, std::vector<std::pair<Rect, dbSBox*>>>
+      sboxes;
+  std::unordered_map<dbTechLayer*, std::vector<std::pair<Rect, dbWire*>>>
+      wires;
+  for (dbNet* net : block->getNets()) {
+    for (dbSWire* swire : net->getSWires()) {
+      for (dbSBox* sbox : swire->getWires()) {
+        for (const auto& [layer, rect] : getSBoxShapes(sbox)) {
+          sboxes[layer].emplace_back(rect, sbox);
+        }
+      }
+    }
+    dbWire* wire = net->getWire();
+    if (wire != nullptr) {
+      LayerBoxes& shapes = wire_shapes_[wire];
+      shapes = getWireShapes(wire);
+      for (const auto& [layer, rect] : shapes) {
+        wires[layer].emplace_back(rect, wire);
+      }
+    }
+  }
+  for (auto& [layer, values] : sboxes) {
+    sboxes_[layer] = RTree<dbSBox>(values.begin(), values.end());
+  }
+  for (auto& [layer, values] : wires) {
+    wires_[layer] = RTree<dbWire>(values.begin(), values.end());
+  }
+
+  for (dbObstruction* obstruction : block->getObstructions()) {
+    dbBox* box = obstruction->getBBox();
+    obstructions_[box->getTechLayer()].insert({box->getBox(), obstruction});
+  }
+
+  addOwner(block);
+}
+
+void dbBlockShapeIndex::queryInsts(const Rect& rect,
+                                   std::vector<dbInst*>& insts) const
+{
+  queryTree(insts_, rect, insts);
+}
+
+void dbBlockShapeIndex::queryBlockages(
+    const Rect& rect,
+    std::vector<dbBlockage*>& blockages) const
+{
+  queryTree(blockages_, rect, blockages);
+}
+
+void dbBlockShapeIndex::querySBoxes(dbTechLayer* layer,
+                                    const Rect& rect,
+                                    std::vector<dbSBox*>& sboxes) const
+{
+  queryLayer(sboxes_, layer, rect, sboxes);
+}
+
+void dbBlockShapeIndex::queryWires(dbTechLayer* layer,
+                                   const Rect& rect,
+                                   std::vector<dbWire*>& wires) const
+{
+  queryLayer(wires_, layer, rect, wires);
+}
+
+void dbBlockShapeIndex::queryObstructions(
+    dbTechLayer* layer,
+    const Rect& rect,
+    std::vector<dbObstruction*>& obstructions) const
+{
+  queryLayer(obstructions_, layer, rect, obstructions);
+}
+
+dbBlockShapeIndex::LayerBoxes dbBlockShapeIndex::getSBoxShapes(dbSBox* sbox)
+{
+  LayerBoxes shapes;
+  if (sbox->isVia()) {
+    std::vector<dbShape> via_boxes;
+    sbox->getViaBoxes(via_boxes);
+    for (const dbShape& shape : via_boxes) {
+      shapes.emplace_back(shape.getTechLayer(), shape.getBox());
+    }
+  } else {
+    shapes.emplace_back(sbox->getTechLayer(), sbox->getBox());
+  }
+  return shapes;
+}
+
+dbBlockShapeIndex::LayerBoxes dbBlockShapeIndex::getWireShapes(dbWire* wire)
+{
+  LayerBoxes shapes;
+  dbWireShapeItr itr;
+  dbShape shape;
+  for (itr.begin(wire); itr.next(shape);) {
+    if (shape.isVia()) {
+      std::vector<dbShape> via_boxes;
+      dbShape::getViaBoxes(shape, via_boxes);
+      for (const dbShape& via_box : via_boxes) {
+        shapes.emplace_back(via_box.getTechLayer(), via_box.getBox());
+      }
+    } else {
+      shapes.emplace_back(shape.getTechLayer(), shape.getBox());
+    }
+  }
+  return shapes;
+}
+
+void dbBlockShapeIndex::addInst(dbInst* inst)
+{
+  if (inst->isPlaced()) {
+    insts_.insert({inst->getBBox()->getBox(), inst});
+  }
+}
+
+void dbBlockShapeIndex::removeInst(dbInst* inst)
+{
+  if (inst->isPlaced()) {
+    insts_.remove({inst->getBBox()->getBox(), inst});
+  }
+}
+
+void dbBlockShapeIndex::addSBox(dbSBox* sbox)
+{
+  for (const auto& [layer, rect] : getSBoxShapes(sbox)) {
+    sboxes_[layer].insert({rect, sbox});
+  }
+}
+
+void dbBlockShapeIndex::removeSBox(dbSBox* sbox)
+{
+  for (const auto& [layer, rect] : getSBoxShapes(sbox)) {
+    sboxes_[layer].remove({rect, sbox});
+  }
+}
+
+void dbBlockShapeIndex::addWire(dbWire* wire)
+{
+  LayerBoxes& shapes = wire_shapes_[wire];
+  shapes = getWireShapes(wire);
+  for (const auto& [layer, rect] : shapes) {
+    wires_[layer].insert({rect, wire});
+  }
+}
+
+void dbBlockShapeIndex::removeWire(dbWire* wire)
+{
+  auto it = wire_shapes_.find(wire);
+  if (it == wire_shapes_.end()) {
+    return;
+  }
+  for (const auto& [layer, rect] : it->second) {
+    wires_[layer].remove({rect, wire});
+  }
+  wire_shapes_.erase(it);
+}
+
+void dbBlockShapeIndex::inDbInstCreate(dbInst* inst)
+{
+  addInst(inst);
+}
+
+void dbBlockShapeIndex::inDbInstCreate(dbInst* inst, dbRegion* /* region */)
+{
+  addInst(inst);
+}
+
+void dbBlockShapeIndex::inDbInstDestroy(dbInst* inst)
+{
+  removeInst(inst);
+}
+
+void dbBlockShapeIndex::inDbInstPlacementStatusBefore(
+    dbInst* inst,
+    const dbPlacementStatus& status)
+{
+  const Rect bbox = inst->getBBox()->getBox();
+  if (inst->isPlaced() && !status.isPlaced()) {
+    insts_.remove({bbox, inst});
+  } else if (!inst->isPlaced() && status.isPlaced()) {
+    insts_.insert({bbox, inst});
+  }
+}
+
+void dbBlockShapeIndex::inDbInstSwapMasterBefore(dbInst* inst,
+                                                 dbMaster* /* master */)
+{
+  removeInst(inst);
+}
+
+void dbBlockShapeIndex::inDbInstSwapMasterAfter(dbInst* inst)
+{
+  addInst(inst);
+}
+
+void dbBlockShapeIndex::inDbPreMoveInst(dbInst* inst)
+{
+  removeInst(inst);
+}
+
+void dbBlockShapeIndex::inDbPostMoveInst(dbInst* inst)
+{
+  addInst(inst);
+}
+
+void dbBlockShapeIndex::inDbBlockageCreate(dbBlockage* blockage)
+{
+  blockages_.insert({blockage->getBBox()->getBox(), blockage});
+}
+
+void dbBlockShapeIndex::inDbObstructionCreate(dbObstruction* obstruction)
+{
+  dbBox* box = obstruction->getBBox();
+  obstructions_[box->getTechLayer()].insert({box->getBox(), obstruction});
+}
+
+void dbBlockShapeIndex::inDbObstructionDestroy(dbObstruction* obstruction)
+{
+  dbBox* box = obstruction->getBBox();
+  obstructions_[box->getTechLayer()].remove({box->getBox(), obstruction});
+}
+
+void dbBlockShapeIndex::inDbSWireAddSBox(dbSBox* sbox)
+{
+  addSBox(sbox);
+}
+
+void dbBlockShapeIndex::inDbSWireRemoveSBox(dbSBox* sbox)
+{
+  removeSBox(sbox);
+}
+
+void dbBlockShapeIndex::inDbSWirePreDestroySBoxes(dbSWire* swire)
+{
+  for (dbSBox* sbox : swire->getWires()) {
+    removeSBox(sbox);
+  }
+}
+
+void dbBlockShapeIndex::inDbWireCreate(dbWire* wire)
+{
+  addWire(wire);
+}
+
+void dbBlockShapeIndex::inDbWireDestroy(dbWire* wire)
+{
+  removeWire(wire);
+}
+
+void dbBlockShapeIndex::inDbWirePostModify(dbWire* wire)
+{
+  removeWire(wire);
+  addWire(wire);
+}
+
+void dbBlockShapeIndex::inDbWirePostAppend(dbWire* /* src */, dbWire* dst)
+{
+  removeWire(dst);
+  addWire(dst);
+}
+
+void dbBlockShapeIndex::inDbWirePostCopy(dbWire* /* src */, dbWire* dst)
+{
+  removeWire(dst);
+  addWire(dst);
+}
+
+}  // namespace odb
@@ -44,6 +44,9 @@
 ///  dbTablePage
 ///
 
+#include <atomic>
+#include <cstdint>
+
 #include "dbAttrTable.h"
 #include "odb/dbId.h"
 #include "odb/dbObject.h"
@@ -101,6 +104,9 @@ class dbObjectTable
   // PERSISTANT DATA
   dbAttrTable<dbId<_dbProperty>> _prop_list;
 
+  // Bytes of the pages of all the tables, for the memory report.
+  inline static std::atomic<int64_t> _page_bytes{0};
+
   virtual ~dbObjectTable() = default;
   dbObjectTable();
   dbObjectTable(_dbDatabase* db,
@@ -58,6 +58,7 @@
 #include "odb/db.h"
 #include "odb/dbBlockCallBackObj.h"
 #include "odb/dbExtControl.h"
+#include "odb/dbGuideStore.h"
 #include "odb/dbStream.h"
 #include "utl/Logger.h"
 
@@ -244,7 +245,7 @@ _dbDatabase::_dbDatabase(_dbDatabase* /* unused: db */, const _dbDatabase& d)
       _master_id(d._master_id),
       _chip(d._chip),
       _unique_id(db_unique_id++),
-      _logger(nullptr)
+      _logger(d._logger)
 {
   _chip_tbl = new dbTable<_dbChip>(this, this, *d._chip_tbl);
 
@@ -509,9 +510,25 @@ void dbDatabase::read(std::istream& file)
   stream >> *db;
 }
 
+// The packed guides are written as dbGuides.
+static void materializeGuides(dbBlock* block_)
+{
+  _dbBlock* block = (_dbBlock*) block_;
+  if (block->_guide_store) {
+    block->_guide_store->materializeAll();
+  }
+  for (dbBlock* child : block_->getChildren()) {
+    materializeGuides(child);
+  }
+}
+
 void dbDatabase::write(std::ostream& file)
 {
   _dbDatabase* db = (_dbDatabase*) this;
+  dbChip* chip = getChip();
+  if (chip && chip->getBlock()) {
+    materializeGuides(chip->getBlock());
+  }
   dbOStream stream(db, file);
   stream << *db;
   file.flush();
@@ -629,6 +646,29 @@ void dbDatabase::undoEco(dbBlock* block_)
   }
 }
 
+int dbDatabase::ecoSavepoint(dbBlock* block_)
+{
+  _dbBlock* block = (_dbBlock*) block_;
+
+  if (block->_journal) {
+    return block->_journal->size();
+  }
+  return 0;
+}
+
+void dbDatabase::undoEcoToSavepoint(dbBlock* block_, int savepoint)
+{
+  _dbBlock* block = (_dbBlock*) block_;
+  dbJournal* eco = block->_journal;
+
+  if (eco) {
+    // The undo itself must not be journaled.
+    block->_journal = nullptr;
+    eco->undo(savepoint);
+    block->_journal = eco;
+  }
+}
+
 void dbDatabase::setLogger(utl::Logger* logger)
 {
   _dbDatabase* _db = (_dbDatabase*) this;
@@ -672,6 +712,11 @@ dbDatabase* dbDatabase::getDatabase(uint dbid)
   return (dbDatabase*) db_tbl->getPtr(dbid);
 }
 
+int64_t dbDatabase::getTableMemoryUsage()
+{
+  return dbObjectTable::_page_bytes;
+}
+
 dbDatabase* dbObject::getDb() const
 {
   return (dbDatabase*) getImpl()->getDatabase();
@@ -70,7 +70,16 @@ namespace odb {
 const uint db_schema_major = 0;  // Not used...
 const uint db_schema_initial = 57;
 
-const uint db_schema_minor = 90;  // Current revision number
+const uint db_schema_minor = 93;  // Current revision number
+
+// Revision where dbGCellGrid::GCellData moved to uint16_t
+const uint db_schema_gcell_data_16bit = 93;
+
+// Revision where dbInst and dbNet names were prefix compressed
+const uint db_schema_name_prefix = 92;
+
+// Revision where the largest dbBlock tables were stored as chunks
+const uint db_schema_block_table_chunks = 91;
 
 // Revision where via layer was added to dbGuide
 const uint db_schema_db_guide_via_layer = 90;
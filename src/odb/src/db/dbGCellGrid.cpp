@@ -49,6 +49,7 @@
 #include "dbBlock.h"
 #include "dbTech.h"
 #include "odb/dbSet.h"
+#include "utl/Logger.h"
 // User Code End Includes
 namespace odb {
 template class dbTable<_dbGCellGrid>;
@@ -218,9 +219,16 @@ dbOStream& operator<<(dbOStream& stream, const _dbGCellGrid& obj)
 
 dbIStream& operator>>(dbIStream& stream, dbGCellGrid::GCellData& obj)
 {
-  if (stream.getDatabase()->isSchema(db_schema_smaler_gcelldata)) {
+  if (stream.getDatabase()->isSchema(db_schema_gcell_data_16bit)) {
     stream >> obj.usage;
     stream >> obj.capacity;
+  } else if (stream.getDatabase()->isSchema(db_schema_smaler_gcelldata)) {
+    uint8_t usage;
+    uint8_t capacity;
+    stream >> usage;
+    stream >> capacity;
+    obj.usage = usage;
+    obj.capacity = capacity;
   } else {
     uint horizontal_usage;
     uint vertical_usage;
@@ -451,8 +459,13 @@ dbGCellGrid* dbGCellGrid::getGCellGrid(dbBlock* block_, uint dbid_)
 
 uint dbGCellGrid::getXIdx(int x)
 {
-  std::vector<int> grid;
-  getGridX(grid);
+  _dbGCellGrid* _grid = (_dbGCellGrid*) this;
+  if (!_grid->flags_.x_grid_valid_) {
+    std::vector<int> grid;
+    getGridX(grid);
+  }
+  // Search the cached grid rather than a copy of it
+  const std::vector<int>& grid = _grid->x_grid_;
   if (grid.empty() || grid[0] > x) {
     return 0;
   }
@@ -462,8 +475,12 @@ uint dbGCellGrid::getXIdx(int x)
 
 uint dbGCellGrid::getYIdx(int y)
 {
-  std::vector<int> grid;
-  getGridY(grid);
+  _dbGCellGrid* _grid = (_dbGCellGrid*) this;
+  if (!_grid->flags_.y_grid_valid_) {
+    std::vector<int> grid;
+    getGridY(grid);
+  }
+  const std::vector<int>& grid = _grid->y_grid_;
   if (grid.empty() || grid[0] > y) {
     return 0;
   }
@@ -471,16 +488,18 @@ uint dbGCellGrid::getYIdx(int y)
   return (int) std::distance(grid.begin(), pos);
 }
 
-uint8_t dbGCellGrid::getCapacity(dbTechLayer* layer,
-                                 uint x_idx,
-                                 uint y_idx) const
+uint16_t dbGCellGrid::getCapacity(dbTechLayer* layer,
+                                  uint x_idx,
+                                  uint y_idx) const
 {
   _dbGCellGrid* _grid = (_dbGCellGrid*) this;
   uint lid = layer->getId();
   return _grid->get(lid)(x_idx, y_idx).capacity;
 }
 
-uint8_t dbGCellGrid::getUsage(dbTechLayer* layer, uint x_idx, uint y_idx) const
+uint16_t dbGCellGrid::getUsage(dbTechLayer* layer,
+                               uint x_idx,
+                               uint y_idx) const
 {
   _dbGCellGrid* _grid = (_dbGCellGrid*) this;
   uint lid = layer->getId();
@@ -490,7 +509,7 @@ uint8_t dbGCellGrid::getUsage(dbTechLayer* layer, uint x_idx, uint y_idx) const
 void dbGCellGrid::setCapacity(dbTechLayer* layer,
                               uint x_idx,
                               uint y_idx,
-                              uint8_t capacity)
+                              uint16_t capacity)
 {
   _dbGCellGrid* _grid = (_dbGCellGrid*) this;
   uint lid = layer->getId();
@@ -500,7 +519,7 @@ void dbGCellGrid::setCapacity(dbTechLayer* layer,
 void dbGCellGrid::setUsage(dbTechLayer* layer,
                            uint x_idx,
                            uint y_idx,
-                           uint8_t use)
+                           uint16_t use)
 {
   _dbGCellGrid* _grid = (_dbGCellGrid*) this;
   uint lid = layer->getId();
@@ -540,6 +559,27 @@ dbMatrix<dbGCellGrid::GCellData> dbGCellGrid::getLayerCongestionMap(
   return {};
 }
 
+void dbGCellGrid::setLayerCongestionMap(
+    dbTechLayer* layer,
+    dbMatrix<dbGCellGrid::GCellData> congestion)
+{
+  _dbGCellGrid* _grid = (_dbGCellGrid*) this;
+  dbMatrix<dbGCellGrid::GCellData>& cmap = _grid->get(layer->getId());
+  if (cmap.numRows() != congestion.numRows()
+      || cmap.numCols() != congestion.numCols()) {
+    _grid->getLogger()->error(
+        utl::ODB,
+        1104,
+        "Congestion map of {} is {}x{}, but the gcell grid is {}x{}.",
+        layer->getName(),
+        congestion.numRows(),
+        congestion.numCols(),
+        cmap.numRows(),
+        cmap.numCols());
+  }
+  cmap = std::move(congestion);
+}
+
 dbMatrix<dbGCellGrid::GCellData> dbGCellGrid::getDirectionCongestionMap(
     const dbTechLayerDir& direction)
 {
@@ -43,6 +43,7 @@
 // User Code Begin Includes
 #include "dbBlock.h"
 #include "dbJournal.h"
+#include "odb/dbGuideStore.h"
 // User Code End Includes
 namespace odb {
 template class dbTable<_dbGuide>;
@@ -177,6 +178,10 @@ dbGuide* dbGuide::create(dbNet* net,
 {
   _dbNet* owner = (_dbNet*) net;
   _dbBlock* block = (_dbBlock*) owner->getOwner();
+  // Keeps the packed guides of the net ahead of the new one.
+  if (block->_guide_store) {
+    block->_guide_store->materialize(net);
+  }
   _dbGuide* guide = block->_guide_tbl->create();
 
   if (block->_journal) {
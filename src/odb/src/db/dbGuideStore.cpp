@@ -0,0 +1,211 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "odb/dbGuideStore.h"
+
+#include <algorithm>
+
+#include "odb/db.h"
+
+namespace odb {
+
+dbGuideStore::dbGuideStore(dbBlock* block) : block_(block)
+{
+}
+
+dbGuideStore::dbGuideStore(dbBlock* block, const dbGuideStore& other)
+    : block_(block),
+      grid_area_(other.grid_area_),
+      tile_size_(other.tile_size_),
+      offset_(other.offset_),
+      guides_(other.guides_),
+      ranges_(other.ranges_),
+      live_guides_(other.live_guides_)
+{
+}
+
+void dbGuideStore::setGrid(const Rect& grid_area,
+                           const int tile_size,
+                           const Point& offset)
+{
+  if (grid_area == grid_area_ && tile_size == tile_size_
+      && offset == offset_) {
+    return;
+  }
+  materializeAll();
+  grid_area_ = grid_area;
+  tile_size_ = tile_size;
+  offset_ = offset;
+}
+
+void dbGuideStore::setGuides(dbNet* net, const std::vector<Guide>& guides)
+{
+  net->clearGuides();
+  if (guides.empty()) {
+    return;
+  }
+  if (guides_.size() > 2 * static_cast<size_t>(live_guides_) + 1024) {
+    compact();
+  }
+  const uint net_id = net->getId();
+  if (ranges_.size() <= net_id) {
+    ranges_.resize(net_id + 1);
+  }
+  NetRange& range = ranges_[net_id];
+  range.begin = guides_.size();
+  guides_.insert(guides_.end(), guides.begin(), guides.end());
+  range.end = guides_.size();
+  live_guides_ += guides.size();
+}
+
+dbGuideStore::Range dbGuideStore::getGuides(dbNet* net) const
+{
+  const NetRange* range = findRange(net->getId());
+  if (range == nullptr) {
+    return {nullptr, nullptr};
+  }
+  const Guide* guides = guides_.data();
+  return {guides + range->begin, guides + range->end};
+}
+
+bool dbGuideStore::hasGuides(dbNet* net) const
+{
+  return findRange(net->getId()) != nullptr;
+}
+
+Rect dbGuideStore::getBox(const Guide& guide) const
+{
+  // Matches the boxes the global router made of its gcell routes.
+  const int half_tile = tile_size_ / 2;
+  const int x_lo = grid_area_.xMin() + guide.x_lo * tile_size_;
+  const int y_lo = grid_area_.yMin() + guide.y_lo * tile_size_;
+  int x_hi = grid_area_.xMin() + guide.x_hi * tile_size_ + 2 * half_tile;
+  int y_hi = grid_area_.yMin() + guide.y_hi * tile_size_ + 2 * half_tile;
+  if ((grid_area_.xMax() - x_hi) / tile_size_ < 1) {
+    x_hi = grid_area_.xMax();
+  }
+  if ((grid_area_.yMax() - y_hi) / tile_size_ < 1) {
+    y_hi = grid_area_.yMax();
+  }
+  Rect box(x_lo, y_lo, x_hi, y_hi);
+  box.moveDelta(offset_.x(), offset_.y());
+  return box;
+}
+
+dbTechLayer* dbGuideStore::getLayer(const Guide& guide) const
+{
+  return dbTechLayer::getTechLayer(block_->getTech(), guide.layer);
+}
+
+dbTechLayer* dbGuideStore::getViaLayer(const Guide& guide) const
+{
+  return dbTechLayer::getTechLayer(block_->getTech(), guide.via_layer);
+}
+
+void dbGuideStore::materialize(dbNet* net)
+{
+  const Range range = getGuides(net);
+  if (range.empty()) {
+    return;
+  }
+  const std::vector<Guide> guides(range.begin(), range.end());
+  clear(net);
+  // dbGuide::create prepends, so create in reverse to keep the order.
+  for (auto guide = guides.rbegin(); guide != guides.rend(); ++guide) {
+    dbGuide::create(
+        net, getLayer(*guide), getViaLayer(*guide), getBox(*guide));
+  }
+}
+
+void dbGuideStore::materializeAll()
+{
+  for (uint net_id = 0; net_id < ranges_.size() && live_guides_ > 0;
+       ++net_id) {
+    if (ranges_[net_id].begin != ranges_[net_id].end) {
+      materialize(dbNet::getNet(block_, net_id));
+    }
+  }
+  guides_.clear();
+  ranges_.clear();
+}
+
+void dbGuideStore::clear(dbNet* net)
+{
+  NetRange* range = findRange(net->getId());
+  if (range == nullptr) {
+    return;
+  }
+  live_guides_ -= range->end - range->begin;
+  *range = NetRange();
+}
+
+int64_t dbGuideStore::getMemoryUsage() const
+{
+  return guides_.capacity() * sizeof(Guide)
+         + ranges_.capacity() * sizeof(NetRange);
+}
+
+dbGuideStore::NetRange* dbGuideStore::findRange(const uint net_id)
+{
+  if (net_id >= ranges_.size()) {
+    return nullptr;
+  }
+  NetRange& range = ranges_[net_id];
+  return range.begin == range.end ? nullptr : &range;
+}
+
+const dbGuideStore::NetRange* dbGuideStore::findRange(const uint net_id) const
+{
+  if (net_id >= ranges_.size()) {
+    return nullptr;
+  }
+  const NetRange& range = ranges_[net_id];
+  return range.begin == range.end ? nullptr : &range;
+}
+
+// Drops the space left by the nets whose guides were cleared.
+void dbGuideStore::compact()
+{
+  std::vector<Guide> guides;
+  guides.reserve(live_guides_);
+  for (NetRange& range : ranges_) {
+    const uint32_t begin = guides.size();
+    guides.insert(guides.end(),
+                  guides_.begin() + range.begin,
+                  guides_.begin() + range.end);
+    range.begin = begin;
+    range.end = guides.size();
+  }
+  guides_ = std::move(guides);
+}
+
+}  // namespace odb
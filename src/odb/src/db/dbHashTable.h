@@ -57,9 +57,12 @@ template <class T>
 class dbHashTable
 {
  public:
+  // Average number of entries per bucket before the table grows.  Every
+  // entry walked costs an object lookup and a strcmp, so find() is kept
+  // close to a single probe at the price of 4 bytes per slot.
   enum Params
   {
-    CHAIN_LENGTH = 4
+    CHAIN_LENGTH = 1
   };
 
   // PERSISTANT-MEMBERS
@@ -83,8 +86,10 @@ class dbHashTable
   void out(dbDiff& diff, char side, const char* field) const;
 
   void setTable(dbTable<T>* table) { _obj_tbl = table; }
-  T* find(const char* name);
-  int hasMember(const char* name);
+  // find() and hasMember() don't modify the table and may be called from
+  // many threads as long as no thread inserts or removes.
+  T* find(const char* name) const;
+  int hasMember(const char* name) const;
   void insert(T* object);
   void remove(T* object);
 };
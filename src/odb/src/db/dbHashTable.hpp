@@ -179,13 +179,9 @@ void dbHashTable<T>::insert(T* object)
     dbId<T> nullId;
     _hash_tbl.push_back(nullId);
     sz = 1;
-  } else {
-    uint r = _num_entries / sz;
-
-    if (r > CHAIN_LENGTH) {
-      growTable();
-      sz = _hash_tbl.size();
-    }
+  } else if (_num_entries > sz * CHAIN_LENGTH) {
+    growTable();
+    sz = _hash_tbl.size();
   }
 
   uint hid = hash_string(object->_name) & (sz - 1);
@@ -195,7 +191,7 @@ void dbHashTable<T>::insert(T* object)
 }
 
 template <class T>
-T* dbHashTable<T>::find(const char* name)
+T* dbHashTable<T>::find(const char* name) const
 {
   uint sz = _hash_tbl.size();
 
@@ -220,7 +216,7 @@ T* dbHashTable<T>::find(const char* name)
 }
 
 template <class T>
-int dbHashTable<T>::hasMember(const char* name)
+int dbHashTable<T>::hasMember(const char* name) const
 {
   uint sz = _hash_tbl.size();
 
@@ -265,9 +261,9 @@ void dbHashTable<T>::remove(T* object)
 
       --_num_entries;
 
-      uint r = (_num_entries + _num_entries / 10) / sz;
-
-      if ((r < (CHAIN_LENGTH >> 1)) && (sz > 1)) {
+      // shrink below a quarter full, with 10% hysteresis
+      if (((_num_entries + _num_entries / 10) * 4 < sz * CHAIN_LENGTH)
+          && (sz > 1)) {
         shrinkTable();
       }
 
@@ -33,6 +33,9 @@
 #include "dbInst.h"
 
 #include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
 
 #include "dbArrayTable.h"
 #include "dbArrayTable.hpp"
@@ -168,7 +171,7 @@ dbOStream& operator<<(dbOStream& stream, const _dbInst& inst)
 {
   uint* bit_field = (uint*) &inst._flags;
   stream << *bit_field;
-  stream << inst._name;
+  stream.writeName(inst._name);
   stream << inst._x;
   stream << inst._y;
   stream << inst._weight;
@@ -194,7 +197,11 @@ dbIStream& operator>>(dbIStream& stream, _dbInst& inst)
 {
   uint* bit_field = (uint*) &inst._flags;
   stream >> *bit_field;
-  stream >> inst._name;
+  if (stream.getDatabase()->isSchema(db_schema_name_prefix)) {
+    stream.readName(inst._name);
+  } else {
+    stream >> inst._name;
+  }
   stream >> inst._x;
   stream >> inst._y;
   stream >> inst._weight;
@@ -499,6 +506,32 @@ Point dbInst::getOrigin()
   return {inst->_x, inst->_y};
 }
 
+// Within a dbInstMoveBatch the pre-move callbacks fire only on the first
+// move of each instance and the post-move callbacks are deferred.
+static void notifyPreMove(_dbBlock* block, dbInst* inst)
+{
+  if (block->_move_batch_depth > 0
+      && block->_moved_inst_set.find(inst) != block->_moved_inst_set.end()) {
+    return;
+  }
+  for (auto callback : block->_callbacks) {
+    callback->inDbPreMoveInst(inst);
+  }
+}
+
+static void notifyPostMove(_dbBlock* block, dbInst* inst)
+{
+  if (block->_move_batch_depth > 0) {
+    if (block->_moved_inst_set.insert(inst).second) {
+      block->_moved_insts.push_back(inst);
+    }
+    return;
+  }
+  for (auto callback : block->_callbacks) {
+    callback->inDbPostMoveInst(inst);
+  }
+}
+
 void dbInst::setOrigin(int x, int y)
 {
   _dbInst* inst = (_dbInst*) this;
@@ -517,9 +550,7 @@ void dbInst::setOrigin(int x, int y)
                              getName());
   }
 
-  for (auto callback : block->_callbacks) {
-    callback->inDbPreMoveInst(this);
-  }
+  notifyPreMove(block, this);
 
   inst->_x = x;
   inst->_y = y;
@@ -545,9 +576,7 @@ void dbInst::setOrigin(int x, int y)
   }
 
   block->_flags._valid_bbox = 0;
-  for (auto callback : block->_callbacks) {
-    callback->inDbPostMoveInst(this);
-  }
+  notifyPostMove(block, this);
 }
 
 void dbInst::setLocationOrient(dbOrientType orient)
@@ -614,9 +643,7 @@ void dbInst::setOrient(dbOrientType orient)
         getPlacementStatus().getString(),
         getName());
   }
-  for (auto callback : block->_callbacks) {
-    callback->inDbPreMoveInst(this);
-  }
+  notifyPreMove(block, this);
   uint prev_flags = flagsToUInt(inst);
   inst->_flags._orient = orient.getValue();
   _dbInst::setInstBBox(inst);
@@ -633,9 +660,7 @@ void dbInst::setOrient(dbOrientType orient)
   }
 
   block->_flags._valid_bbox = 0;
-  for (auto callback : block->_callbacks) {
-    callback->inDbPostMoveInst(this);
-  }
+  notifyPostMove(block, this);
 }
 
 dbPlacementStatus dbInst::getPlacementStatus()
@@ -1362,6 +1387,133 @@ bool dbInst::swapMaster(dbMaster* new_master_)
   return true;
 }
 
+namespace {
+
+// What an instance swapped by dbInst::swapMasters keeps, with the nets
+// indexed by the mterms of the new master.
+struct SwappedInst
+{
+  int swap_idx;
+  std::string name;
+  dbMaster* master;
+  dbRegion* region;
+  dbModule* module;
+  Point origin;
+  dbOrientType orient;
+  dbPlacementStatus status;
+  dbSourceType source;
+  std::vector<dbNet*> nets;
+  std::vector<dbModNet*> mod_nets;
+};
+
+}  // namespace
+
+std::vector<dbInst*> dbInst::swapMasters(
+    dbBlock* block_,
+    const std::vector<std::pair<dbInst*, dbMaster*>>& swaps,
+    const std::function<dbMTerm*(dbMTerm*, dbMaster*)>& map_mterm)
+{
+  _dbBlock* block = (_dbBlock*) block_;
+  utl::Logger* logger = block->getImpl()->getLogger();
+
+  // For each (old master, new master) pair, the index of the new mterm
+  // taking over each old mterm, or -1.
+  std::map<std::pair<dbMaster*, dbMaster*>, std::vector<int>> pin_maps;
+
+  std::vector<dbInst*> result;
+  result.reserve(swaps.size());
+  std::vector<SwappedInst> swapped;
+  swapped.reserve(swaps.size());
+  for (const auto& [inst, new_master] : swaps) {
+    result.push_back(inst);
+    if (inst->isDoNotTouch()) {
+      logger->error(utl::ODB,
+                    447,
+                    "Attempt to change master of dont_touch instance {}",
+                    inst->getConstName());
+    }
+    if (inst->isHierarchical()) {
+      logger->warn(utl::ODB,
+                   448,
+                   "Failed(_hierarchy) to swap: {} -> {} {}",
+                   inst->getMaster()->getConstName(),
+                   new_master->getConstName(),
+                   inst->getConstName());
+      continue;
+    }
+
+    dbMaster* old_master = inst->getMaster();
+    auto [it, inserted] = pin_maps.try_emplace({old_master, new_master});
+    std::vector<int>& pin_map = it->second;
+    if (inserted) {
+      pin_map.resize(old_master->getMTermCount(), -1);
+      for (dbMTerm* mterm : old_master->getMTerms()) {
+        dbMTerm* new_mterm = map_mterm(mterm, new_master);
+        if (new_mterm != nullptr) {
+          pin_map[mterm->getIndex()] = new_mterm->getIndex();
+        }
+      }
+    }
+
+    SwappedInst& saved = swapped.emplace_back();
+    saved.swap_idx = result.size() - 1;
+    saved.name = inst->getName();
+    saved.master = new_master;
+    saved.region = inst->getRegion();
+    saved.module = inst->getModule();
+    saved.origin = inst->getOrigin();
+    saved.orient = inst->getOrient();
+    saved.status = inst->getPlacementStatus();
+    saved.source = inst->getSourceType();
+    saved.nets.resize(new_master->getMTermCount(), nullptr);
+    saved.mod_nets.resize(new_master->getMTermCount(), nullptr);
+    for (dbITerm* iterm : inst->getITerms()) {
+      const int new_idx = pin_map[iterm->getMTerm()->getIndex()];
+      if (new_idx >= 0) {
+        saved.nets[new_idx] = iterm->getNet();
+        saved.mod_nets[new_idx] = iterm->getModNet();
+      }
+    }
+  }
+
+  for (const SwappedInst& saved : swapped) {
+    destroy(result[saved.swap_idx]);
+  }
+
+  {
+    dbInstMoveBatch move_batch(block_);
+    for (const SwappedInst& saved : swapped) {
+      dbInst* inst = create(block_,
+                            saved.master,
+                            saved.name.c_str(),
+                            saved.region,
+                            /* physical_only */ false,
+                            saved.module);
+      inst->setSourceType(saved.source);
+      if (saved.status != dbPlacementStatus::NONE) {
+        inst->setOrient(saved.orient);
+        inst->setOrigin(saved.origin.x(), saved.origin.y());
+        inst->setPlacementStatus(saved.status);
+      }
+      result[saved.swap_idx] = inst;
+    }
+  }
+
+  for (const SwappedInst& saved : swapped) {
+    dbInst* inst = result[saved.swap_idx];
+    for (uint i = 0; i < saved.nets.size(); ++i) {
+      if (saved.nets[i] != nullptr) {
+        inst->getITerm(i)->connect(saved.nets[i]);
+      }
+      if (saved.mod_nets[i] != nullptr) {
+        inst->getITerm(i)->connect(saved.mod_nets[i]);
+      }
+    }
+  }
+
+  return result;
+}
+
 void dbInst::setPinAccessIdx(uint idx)
 {
   _dbInst* inst = (_dbInst*) this;
@@ -1622,6 +1774,11 @@ void dbInst::destroy(dbInst* inst_)
     (**cbitr)().inDbInstDestroy(inst_);  // client ECO optimization - payam
   }
 
+  if (block->_moved_inst_set.erase(inst_)) {
+    auto& moved = block->_moved_insts;
+    moved.erase(std::find(moved.begin(), moved.end(), inst_));
+  }
+
   _dbMaster* master = (_dbMaster*) inst_->getMaster();
   _dbInstHdr* inst_hdr = block->_inst_hdr_hash.find(master->_id);
   inst_hdr->_inst_cnt--;
@@ -1408,9 +1408,9 @@ dbObjectType dbJournal::popObjectType()
 //
 // WORK-IN-PROGRESS undo does not yet work.
 //
-void dbJournal::undo()
+void dbJournal::undo(uint savepoint)
 {
-  if (_log.empty()) {
+  if (_log.size() <= savepoint) {
     return;
   }
 
@@ -1452,13 +1452,15 @@ void dbJournal::undo()
         break;
     }
 
-    if (action_idx == 0) {
+    if (action_idx <= savepoint) {
       break;
     }
 
     _log.set(action_idx);
     _log.moveBackOneInt();
   }
+
+  _log.truncate(savepoint);
 }
 
 void dbJournal::undo_createObject()
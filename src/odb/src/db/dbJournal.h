@@ -137,8 +137,9 @@ class dbJournal
   // redo the transaction log
   void redo();
 
-  // undo the transaction log
-  void undo();
+  // undo the transaction log back to savepoint (a previous size()) and
+  // drop the undone actions from the log
+  void undo(uint savepoint = 0);
 
   bool empty() const { return _log.empty(); }
 
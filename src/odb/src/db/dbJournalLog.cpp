@@ -69,6 +69,14 @@ void dbJournalLog::clear()
   idx_ = 0;
 }
 
+void dbJournalLog::truncate(uint size)
+{
+  data_.truncate(size);
+  if (idx_ > (int) size) {
+    idx_ = size;
+  }
+}
+
 void dbJournalLog::push(bool value)
 {
   set_type(LOG_BOOL);
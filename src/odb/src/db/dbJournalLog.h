@@ -46,6 +46,7 @@ class dbJournalLog
   dbJournalLog(utl::Logger* logger);
 
   void clear();
+  void truncate(uint size);
   bool empty() const { return data_.size() == 0; }
 
   uint idx() const { return idx_; }
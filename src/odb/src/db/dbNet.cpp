@@ -66,6 +66,7 @@
 #include "odb/db.h"
 #include "odb/dbBlockCallBackObj.h"
 #include "odb/dbExtControl.h"
+#include "odb/dbGuideStore.h"
 #include "odb/dbSet.h"
 #include "odb/dbShape.h"
 #include "utl/Logger.h"
@@ -153,7 +154,7 @@ dbOStream& operator<<(dbOStream& stream, const _dbNet& net)
 {
   uint* bit_field = (uint*) &net._flags;
   stream << *bit_field;
-  stream << net._name;
+  stream.writeName(net._name);
   stream << net._gndc_calibration_factor;
   stream << net._cc_calibration_factor;
   stream << net._next_entry;
@@ -179,7 +180,11 @@ dbIStream& operator>>(dbIStream& stream, _dbNet& net)
 {
   uint* bit_field = (uint*) &net._flags;
   stream >> *bit_field;
-  stream >> net._name;
+  if (stream.getDatabase()->isSchema(db_schema_name_prefix)) {
+    stream.readName(net._name);
+  } else {
+    stream >> net._name;
+  }
   stream >> net._gndc_calibration_factor;
   stream >> net._cc_calibration_factor;
   stream >> net._next_entry;
@@ -3142,6 +3147,9 @@ void dbNet::destroy(dbNet* net_)
     group->removeNet(net_);
   }
 
+  if (block->_guide_store) {
+    block->_guide_store->clear(net_);
+  }
   dbSet<dbGuide> guides = net_->getGuides();
   for (auto gitr = guides.begin(); gitr != guides.end();) {
     gitr = dbGuide::destroy(gitr);
@@ -3283,11 +3291,18 @@ dbSet<dbGuide> dbNet::getGuides() const
 {
   _dbNet* net = (_dbNet*) this;
   _dbBlock* block = (_dbBlock*) net->getOwner();
+  if (block->_guide_store) {
+    block->_guide_store->materialize((dbNet*) this);
+  }
   return dbSet<dbGuide>(net, block->_guide_itr);
 }
 
 void dbNet::clearGuides()
 {
+  _dbBlock* block = (_dbBlock*) getImpl()->getOwner();
+  if (block->_guide_store) {
+    block->_guide_store->clear(this);
+  }
   auto guides = getGuides();
   dbSet<dbGuide>::iterator itr = guides.begin();
   while (itr != guides.end()) {
@@ -87,6 +87,12 @@ class dbPagedVector
   unsigned int getIdx(uint chunkSize, const T& ival);  // DKF - to delete
   void freeIdx(uint idx);                              // DKF - to delete
   void clear();
+  // Drops the entries at and after size, keeping the pages for reuse.
+  void truncate(unsigned int size)
+  {
+    ZASSERT(size <= _next_idx);
+    _next_idx = size;
+  }
 
   T& operator[](unsigned int id)
   {
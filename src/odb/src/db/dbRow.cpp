@@ -318,6 +318,25 @@ dbRow* dbRow::create(dbBlock* block_,
   return (dbRow*) row;
 }
 
+std::vector<dbRow*> dbRow::create(dbBlock* block,
+                                  const std::vector<Params>& rows)
+{
+  std::vector<dbRow*> created;
+  created.reserve(rows.size());
+  for (const Params& row : rows) {
+    created.push_back(create(block,
+                             row.name.c_str(),
+                             row.site,
+                             row.origin_x,
+                             row.origin_y,
+                             row.orient,
+                             row.direction,
+                             row.num_sites,
+                             row.spacing));
+  }
+  return created;
+}
+
 void dbRow::destroy(dbRow* row_)
 {
   _dbRow* row = (_dbRow*) row_;
@@ -32,6 +32,8 @@
 
 #include "odb/dbStream.h"
 
+#include <algorithm>
+#include <exception>
 #include <iostream>
 #include <sstream>
 
@@ -40,6 +42,20 @@
 
 namespace odb {
 
+namespace {
+
+// Read only stream buffer over a chunk that is already in memory
+class dbChunkBuffer : public std::streambuf
+{
+ public:
+  explicit dbChunkBuffer(std::vector<char>& data)
+  {
+    setg(data.data(), data.data(), data.data() + data.size());
+  }
+};
+
+}  // namespace
+
 void dbOStream::pushScope(const std::string& name)
 {
   _scopes.push_back({name, pos()});
@@ -65,6 +81,54 @@ void dbOStream::popScope()
   _scopes.pop_back();
 }
 
+std::vector<std::string> dbOStream::encodeChunks(
+    const std::vector<std::function<void(dbOStream&)>>& writers)
+{
+  const int chunk_cnt = writers.size();
+  std::vector<std::string> chunks(chunk_cnt);
+  std::vector<std::exception_ptr> errors(chunk_cnt);
+#pragma omp parallel for schedule(dynamic)
+  for (int i = 0; i < chunk_cnt; i++) {
+    try {
+      std::ostringstream chunk_stream(std::ios::binary);
+      chunk_stream.exceptions(_f.exceptions());
+      dbOStream chunk(_db, chunk_stream);
+      writers[i](chunk);
+      chunks[i] = chunk_stream.str();
+    } catch (...) {
+      errors[i] = std::current_exception();
+    }
+  }
+  for (const std::exception_ptr& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+  return chunks;
+}
+
+void dbOStream::writeChunk(const std::string& chunk)
+{
+  *this << (uint64_t) chunk.size();
+  _f.write(chunk.data(), chunk.size());
+}
+
+void dbOStream::writeName(const char* name)
+{
+  if (name == nullptr) {
+    *this << -1;
+    return;
+  }
+  const int prev_size = _prev_name.size();
+  int prefix = 0;
+  while (prefix < prev_size && name[prefix] == _prev_name[prefix]) {
+    ++prefix;
+  }
+  *this << prefix;
+  *this << (name + prefix);
+  _prev_name = name;
+}
+
 dbOStream& operator<<(dbOStream& stream, const Rect& r)
 {
   stream << r.xlo_;
@@ -154,6 +218,67 @@ dbIStream::dbIStream(_dbDatabase* db, std::istream& f) : _f(f)
   }
 }
 
+void dbIStream::readChunk(std::function<void(dbIStream&)> reader)
+{
+  uint64_t size;
+  *this >> size;
+  Chunk& chunk = _chunks.emplace_back();
+  chunk.data.resize(size);
+  readBytes(chunk.data.data(), size);
+  chunk.reader = std::move(reader);
+}
+
+void dbIStream::decodeChunks()
+{
+  const int chunk_cnt = _chunks.size();
+  std::vector<char> failed(chunk_cnt, false);
+  std::vector<std::exception_ptr> errors(chunk_cnt);
+#pragma omp parallel for schedule(dynamic)
+  for (int i = 0; i < chunk_cnt; i++) {
+    try {
+      dbChunkBuffer buffer(_chunks[i].data);
+      std::istream chunk_stream(&buffer);
+      chunk_stream.exceptions(_f.exceptions());
+      dbIStream chunk(_db, chunk_stream);
+      _chunks[i].reader(chunk);
+      failed[i] = chunk_stream.fail() || buffer.in_avail() != 0;
+    } catch (...) {
+      errors[i] = std::current_exception();
+    }
+  }
+  _chunks.clear();
+  for (const std::exception_ptr& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+  if (std::find(failed.begin(), failed.end(), true) != failed.end()) {
+    _f.setstate(std::ios::failbit);
+  }
+}
+
+void dbIStream::readName(char*& name)
+{
+  int prefix;
+  *this >> prefix;
+  if (prefix < 0) {
+    name = nullptr;
+    return;
+  }
+  int length;
+  *this >> length;
+  if (prefix > (int) _prev_name.size() || length <= 0) {
+    _f.setstate(std::ios::failbit);
+    name = nullptr;
+    return;
+  }
+  name = (char*) malloc(prefix + length);
+  memcpy(name, _prev_name.data(), prefix);
+  readBytes(name + prefix, length);
+  name[prefix + length - 1] = '\0';
+  _prev_name.assign(name, prefix + length - 1);
+}
+
 std::ostream& operator<<(std::ostream& os, const Rect& box)
 {
   os << "( " << box.xMin() << " " << box.yMin() << " ) ( " << box.xMax() << " "
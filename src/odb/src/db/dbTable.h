@@ -32,6 +32,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <vector>
 
 #include "dbCore.h"
@@ -69,6 +70,8 @@ class dbTable : public dbObjectTable, public dbIterator
   dbTablePage** _pages;  // page-table
 
   void resizePageTbl();
+  void resizePageTbl(uint tbl_size);
+  dbTablePage* allocPage();
   void newPage();
   void pushQ(uint& Q, _dbFreeObject* e);
   _dbFreeObject* popQ(uint& Q);
@@ -94,6 +97,15 @@ class dbTable : public dbObjectTable, public dbIterator
   // Create a "T", calls T( _dbDatabase * )
   T* create();
 
+  // Make room in the page table for "n" more objects so a following
+  // createRange() of that size doesn't need to grow it.
+  void reserve(uint n);
+
+  // Create "n" objects with the consecutive ids [first, first + n) on fresh
+  // pages, calls T( _dbDatabase * ) for each.  Bypasses the free-list, which
+  // only receives the unused tail of the last page.
+  void createRange(uint n, std::vector<T*>& objects);
+
   // Duplicate a "T", calls T( _dbDatabase *, const T & )
   T* duplicate(T* c);
 
@@ -159,6 +171,16 @@ class dbTable : public dbObjectTable, public dbIterator
   void differences(dbDiff& diff, const dbTable<T>& rhs) const;
   void out(dbDiff& diff, char side) const;
 
+  // Content hash of one page.  Free slots hash the same regardless of the
+  // free-list order, so only the allocated objects are compared.
+  uint64_t pageHash(uint page_id) const;
+
+  // Hash of the page hashes (filled into page_hashes), computed in parallel.
+  uint64_t contentHash(std::vector<uint64_t>& page_hashes) const;
+
+  // Same as differences() but restricted to the ids of one page.
+  void pageDifferences(dbDiff& diff, const dbTable<T>& rhs, uint page_id) const;
+
   // dbIterator interface methods
   bool reversible() override;
   bool orderReversed() override;
@@ -169,6 +191,7 @@ class dbTable : public dbObjectTable, public dbIterator
   uint end(dbObject* parent) override;
   uint next(uint id, ...) override;
   dbObject* getObject(uint id, ...) override;
+  uint seek(dbObject* parent, uint id) override;
   void getObjects(std::vector<T*>& objects);
 
  private:
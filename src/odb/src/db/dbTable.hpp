@@ -32,8 +32,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstring>
+#include <functional>
 #include <new>
+#include <sstream>
+#include <string>
+#include <string_view>
 
 #include "dbDatabase.h"
 #include "dbTable.h"
@@ -115,6 +120,8 @@ void dbTable<T>::clear()
 
     free((void*) page);
   }
+  _page_bytes -= static_cast<int64_t>(_page_cnt)
+                 * (page_size() * sizeof(T) + sizeof(dbObjectPage));
 
   delete[] _pages;
 
@@ -171,11 +178,17 @@ dbTable<T>::~dbTable()
 
 template <class T>
 void dbTable<T>::resizePageTbl()
+{
+  resizePageTbl(_page_tbl_size * 2);
+}
+
+template <class T>
+void dbTable<T>::resizePageTbl(uint tbl_size)
 {
   uint i;
   dbTablePage** old_tbl = _pages;
   uint old_tbl_size = _page_tbl_size;
-  _page_tbl_size *= 2;
+  _page_tbl_size = tbl_size;
 
   _pages = new dbTablePage*[_page_tbl_size];
 
@@ -191,12 +204,13 @@ void dbTable<T>::resizePageTbl()
 }
 
 template <class T>
-void dbTable<T>::newPage()
+dbTablePage* dbTable<T>::allocPage()
 {
   uint size = page_size() * sizeof(T) + sizeof(dbObjectPage);
   dbTablePage* page = (dbTablePage*) malloc(size);
   ZALLOCATED(page);
   memset(page, 0, size);
+  _page_bytes += size;
 
   uint page_id = _page_cnt;
 
@@ -212,6 +226,14 @@ void dbTable<T>::newPage()
   page->_page_addr = page_id << _page_shift;
   page->_alloccnt = 0;
   _pages[page_id] = page;
+  return page;
+}
+
+template <class T>
+void dbTable<T>::newPage()
+{
+  dbTablePage* page = allocPage();
+  uint page_id = page->_page_addr >> _page_shift;
 
   // The objects are put on the list in reverse order, so they can be removed
   // in low-to-high order.
@@ -270,6 +292,62 @@ T* dbTable<T>::create()
   return t;
 }
 
+template <class T>
+void dbTable<T>::reserve(uint n)
+{
+  // page 0 holds the zero-object, which is never handed out
+  const uint ids = (_page_cnt == 0) ? n + 1 : n;
+  const uint tbl_size = _page_cnt + (ids + _page_mask) / page_size();
+
+  if (tbl_size > _page_tbl_size) {
+    resizePageTbl(tbl_size);
+  }
+}
+
+template <class T>
+void dbTable<T>::createRange(uint n, std::vector<T*>& objects)
+{
+  objects.clear();
+
+  if (n == 0) {
+    return;
+  }
+
+  objects.reserve(n);
+  reserve(n);
+  _alloc_cnt += n;
+
+  uint remaining = n;
+
+  while (remaining) {
+    dbTablePage* page = allocPage();
+    T* b = (T*) page->_objects;
+    T* t = (page->_page_addr == 0) ? &b[1] : b;  // skip the zero-object
+    T* e = &b[page_size()];
+
+    for (; (t < e) && remaining; ++t, --remaining) {
+      new (t) T(_db);
+      t->_oid = (uint) ((char*) t - (char*) b) | DB_ALLOC_BIT;
+      page->_alloccnt++;
+      objects.push_back(t);
+    }
+
+    // Link the unused tail in reverse order so create() takes it low-to-high.
+    for (T* f = e - 1; f >= t; --f) {
+      _dbFreeObject* o = (_dbFreeObject*) f;
+      o->_oid = (uint) ((char*) f - (char*) b);
+      pushQ(_free_list, o);
+    }
+  }
+
+  // Fresh pages are above every existing id.
+  _top_idx = objects.back()->getOID();
+
+  if (_bottom_idx == 0) {
+    _bottom_idx = objects.front()->getOID();
+  }
+}
+
 template <class T>
 T* dbTable<T>::duplicate(T* c)
 {
@@ -524,6 +602,18 @@ next_obj:
   return 0;
 }
 
+template <class T>
+uint dbTable<T>::seek(dbObject* /* unused: parent */, uint id)
+{
+  if (id < _bottom_idx) {
+    return _bottom_idx;
+  }
+  if (id > _top_idx) {
+    return 0;
+  }
+  return validId(id) ? id : next(id);
+}
+
 template <class T>
 dbObject* dbTable<T>::getObject(uint id, ...)
 {
@@ -592,9 +682,12 @@ void dbTable<T>::copy_pages(const dbTable<T>& t)
     _pages[i] = nullptr;
   }
 
-  for (i = 0; i < _page_cnt; ++i) {
-    dbTablePage* page = t._pages[i];
-    copy_page(i, page);
+  // Pages are independent so large tables (insts, nets, wires) are copied
+  // in parallel.  Nested tables copy serially inside the outer region.
+  const int page_cnt = _page_cnt;
+#pragma omp parallel for schedule(dynamic) if (page_cnt > 1)
+  for (int page_id = 0; page_id < page_cnt; ++page_id) {
+    copy_page(page_id, t._pages[page_id]);
   }
 }
 
@@ -605,6 +698,7 @@ void dbTable<T>::copy_page(uint page_id, dbTablePage* page)
   dbTablePage* p = (dbTablePage*) malloc(size);
   ZALLOCATED(p);
   memset(p, 0, size);
+  _page_bytes += size;
   p->_table = this;
   p->_page_addr = page_id << _page_shift;
   p->_alloccnt = page->_alloccnt;
@@ -682,6 +776,7 @@ dbIStream& operator>>(dbIStream& stream, dbTable<T>& table)
     dbTablePage* page = (dbTablePage*) malloc(size);
     ZALLOCATED(page);
     memset(page, 0, size);
+    dbObjectTable::_page_bytes += size;
     page->_page_addr = i << table._page_shift;
     page->_table = &table;
     table._pages[i] = page;
@@ -818,6 +913,73 @@ void dbTable<T>::differences(dbDiff& diff, const dbTable<T>& rhs) const
   }
 }
 
+template <class T>
+uint64_t dbTable<T>::pageHash(uint page_id) const
+{
+  std::ostringstream bytes;
+  dbOStream stream(_db, bytes);
+
+  const dbTablePage* page = _pages[page_id];
+  const T* t = (T*) page->_objects;
+  const T* e = &t[page_size()];
+
+  for (; t < e; t++) {
+    const char allocated = (t->_oid & DB_ALLOC_BIT) ? 1 : 0;
+    stream << allocated;
+    if (allocated) {
+      stream << *t;
+    }
+  }
+
+  return std::hash<std::string>()(bytes.str());
+}
+
+template <class T>
+uint64_t dbTable<T>::contentHash(std::vector<uint64_t>& page_hashes) const
+{
+  page_hashes.resize(_page_cnt);
+
+  const int page_cnt = _page_cnt;
+#pragma omp parallel for schedule(dynamic) if (page_cnt > 1)
+  for (int page_id = 0; page_id < page_cnt; ++page_id) {
+    page_hashes[page_id] = pageHash(page_id);
+  }
+
+  const std::string_view hashes((const char*) page_hashes.data(),
+                                page_hashes.size() * sizeof(uint64_t));
+  return std::hash<std::string_view>()(hashes);
+}
+
+template <class T>
+void dbTable<T>::pageDifferences(dbDiff& diff,
+                                 const dbTable<T>& rhs,
+                                 uint page_id) const
+{
+  const dbTable<T>& lhs = *this;
+  const char* name = dbObject::getTypeName(_type);
+  const uint first = std::max(page_id << _page_shift, 1U);
+  const uint last = (page_id + 1) << _page_shift;
+
+  for (uint i = first; i < last; ++i) {
+    bool lhs_valid_o = lhs.validId(i);
+    bool rhs_valid_o = rhs.validId(i);
+
+    if (lhs_valid_o && rhs_valid_o) {
+      T* l = lhs.getPtr(i);
+      T* r = rhs.getPtr(i);
+      l->differences(diff, nullptr, *r);
+    } else if (lhs_valid_o) {
+      T* l = lhs.getPtr(i);
+      l->out(diff, dbDiff::LEFT, nullptr);
+      diff.report("> %s [%u] FREE\n", name, i);
+    } else if (rhs_valid_o) {
+      T* r = rhs.getPtr(i);
+      diff.report("< %s [%u] FREE\n", name, i);
+      r->out(diff, dbDiff::RIGHT, nullptr);
+    }
+  }
+}
+
 template <class T>
 void dbTable<T>::out(dbDiff& diff, char side) const
 {
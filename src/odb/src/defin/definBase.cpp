@@ -55,6 +55,7 @@ void definBase::init()
   _logger = nullptr;
   _errors = 0;
   _dist_factor = 10;
+  _layer_cache.clear();
 }
 
 void definBase::units(int d)
@@ -66,6 +67,7 @@ void definBase::units(int d)
 void definBase::setTech(dbTech* tech)
 {
   _tech = tech;
+  _layer_cache.clear();
   int dbu = _tech->getDbUnitsPerMicron();
   _dist_factor = dbu / 100;
 }
@@ -85,6 +87,19 @@ void definBase::setMode(defin::MODE mode)
   _mode = mode;
 }
 
+dbTechLayer* definBase::findLayer(const char* name)
+{
+  auto it = _layer_cache.find(name);
+  if (it != _layer_cache.end()) {
+    return it->second;
+  }
+  dbTechLayer* layer = _tech->findLayer(name);
+  if (layer != nullptr) {
+    _layer_cache[name] = layer;
+  }
+  return layer;
+}
+
 dbOrientType definBase::translate_orientation(int orient)
 {
   switch (orient) {
@@ -33,6 +33,8 @@
 #pragma once
 
 #include <cmath>
+#include <map>
+#include <string>
 #include <vector>
 
 #include "defiMisc.hpp"
@@ -50,6 +52,7 @@ namespace odb {
 
 class dbBlock;
 class dbTech;
+class dbTechLayer;
 
 class definBase
 {
@@ -100,6 +103,12 @@ class definBase
   }
 
   static dbOrientType translate_orientation(int orient);
+
+  // Cached dbTech::findLayer, which is a linear scan over the layers.
+  dbTechLayer* findLayer(const char* name);
+
+ private:
+  std::map<std::string, dbTechLayer*> _layer_cache;
 };
 
 }  // namespace odb
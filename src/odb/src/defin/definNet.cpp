@@ -379,7 +379,7 @@ void definNet::pathBegin(const char* layer_name)
     return;
   }
 
-  _cur_layer = _tech->findLayer(layer_name);
+  _cur_layer = findLayer(layer_name);
 
   if (_cur_layer == nullptr) {
     _logger->warn(
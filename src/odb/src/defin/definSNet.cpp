@@ -255,7 +255,7 @@ void definSNet::rect(const char* layer_name,
     return;
   }
 
-  dbTechLayer* layer = _tech->findLayer(layer_name);
+  dbTechLayer* layer = findLayer(layer_name);
 
   if (layer == nullptr) {
     _logger->warn(
@@ -275,7 +275,7 @@ void definSNet::rect(const char* layer_name,
 
 void definSNet::polygon(const char* layer_name, std::vector<defPoint>& points)
 {
-  dbTechLayer* layer = _tech->findLayer(layer_name);
+  dbTechLayer* layer = findLayer(layer_name);
 
   if (layer == nullptr) {
     _logger->warn(
@@ -330,7 +330,7 @@ void definSNet::path(const char* layer_name, int width)
     return;
   }
 
-  _cur_layer = _tech->findLayer(layer_name);
+  _cur_layer = findLayer(layer_name);
 
   if (_cur_layer == nullptr) {
     _logger->warn(
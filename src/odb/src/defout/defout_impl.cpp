@@ -35,8 +35,12 @@
 #include <stdio.h>
 #include <sys/stat.h>
 
+#include <algorithm>
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <limits>
+#include <memory>
 #include <optional>
 #include <set>
 #include <string>
@@ -62,6 +66,17 @@ std::string getPinName(dbITerm* iterm)
 
 static const int max_name_length = 256;
 
+// Objects per buffer handed to a thread by defout_impl::writeParallel.
+static const int write_chunk_size = 512;
+
+static bool hasSuffix(const char* str, const char* suffix)
+{
+  const size_t str_len = strlen(str);
+  const size_t suffix_len = strlen(suffix);
+  return str_len >= suffix_len
+         && strcmp(str + str_len - suffix_len, suffix) == 0;
+}
+
 template <typename T>
 std::vector<T*> sortedSet(dbSet<T>& to_sort)
 {
@@ -167,8 +182,17 @@ bool defout_impl::writeBlock(dbBlock* block, const char* def_file)
 
   _dist_factor
       = (double) block->getDefUnits() / (double) block->getDbUnitsPerMicron();
-  utl::FileHandler fileHandler(def_file);
-  _out = fileHandler.getFile();
+  // A .gz file, which definReader reads back directly, is piped through
+  // gzip the same way extSpef compresses SPEF.
+  const bool gzip = hasSuffix(def_file, ".gz");
+  std::unique_ptr<utl::FileHandler> fileHandler;
+  if (gzip) {
+    std::string cmd = fmt::format("gzip -c > '{}'", def_file);
+    _out = popen(cmd.c_str(), "w");
+  } else {
+    fileHandler = std::make_unique<utl::FileHandler>(def_file);
+    _out = fileHandler->getFile();
+  }
 
   if (_out == nullptr) {
     _logger->warn(
@@ -258,6 +282,10 @@ bool defout_impl::writeBlock(dbBlock* block, const char* def_file)
   writeScanChains(block);
 
   fprintf(_out, "END DESIGN\n");
+  if (gzip) {
+    pclose(_out);
+  }
+  _out = nullptr;
   {
     delete _select_net_map;
   }
@@ -267,6 +295,56 @@ bool defout_impl::writeBlock(dbBlock* block, const char* def_file)
   return true;
 }
 
+template <typename T>
+void defout_impl::writeParallel(const std::vector<T*>& objects,
+                                void (defout_impl::*write)(T*))
+{
+  // Only a bounded number of chunks are held in memory at once.
+  const int batch_chunks = 64;
+  const int num_objects = objects.size();
+  const int batch_size = batch_chunks * write_chunk_size;
+  std::vector<std::string> chunks(batch_chunks);
+
+  for (int batch_begin = 0; batch_begin < num_objects;
+       batch_begin += batch_size) {
+    const int batch_end = std::min(batch_begin + batch_size, num_objects);
+    const int num_chunks
+        = (batch_end - batch_begin + write_chunk_size - 1) / write_chunk_size;
+
+#pragma omp parallel for schedule(dynamic)
+    for (int i = 0; i < num_chunks; ++i) {
+      const int begin = batch_begin + i * write_chunk_size;
+      const int end = std::min(begin + write_chunk_size, batch_end);
+
+      // Each thread gets its own copy of the per object write state.
+      defout_impl writer(_logger);
+      writer._dist_factor = _dist_factor;
+      writer._use_net_inst_ids = _use_net_inst_ids;
+      writer._use_master_ids = _use_master_ids;
+      writer._use_alias = _use_alias;
+      writer._select_net_map = _select_net_map;
+      writer._select_inst_map = _select_inst_map;
+      writer._version = _version;
+      std::copy(
+          std::begin(_prop_defs), std::end(_prop_defs), writer._prop_defs);
+
+      char* buffer = nullptr;
+      size_t size = 0;
+      writer._out = open_memstream(&buffer, &size);
+      for (int j = begin; j < end; ++j) {
+        (writer.*write)(objects[j]);
+      }
+      fclose(writer._out);
+      chunks[i].assign(buffer, size);
+      free(buffer);
+    }
+
+    for (int i = 0; i < num_chunks; ++i) {
+      fwrite(chunks[i].data(), 1, chunks[i].size(), _out);
+    }
+  }
+}
+
 void defout_impl::writeRows(dbBlock* block)
 {
   dbSet<dbRow> rows = block->getRows();
@@ -531,12 +609,14 @@ void defout_impl::writeInsts(dbBlock* block)
   fprintf(_out, "COMPONENTS %u ;\n", insts.size());
 
   // Sort the components for consistent output
+  std::vector<dbInst*> sorted_insts;
   for (dbInst* inst : sortedSet(insts)) {
     if (_select_inst_map && !(*_select_inst_map)[inst]) {
       continue;
     }
-    writeInst(inst);
+    sorted_insts.push_back(inst);
   }
+  writeParallel(sorted_insts, &defout_impl::writeInst);
 
   fprintf(_out, "END COMPONENTS\n");
 }
@@ -1447,29 +1527,33 @@ void defout_impl::writeNets(dbBlock* block)
   if (snet_cnt > 0) {
     fprintf(_out, "SPECIALNETS %d ;\n", snet_cnt);
 
+    std::vector<dbNet*> snets;
     for (dbNet* net : sorted_nets) {
       if (_select_net_map && !(*_select_net_map)[net]) {
         continue;
       }
       if (net->isSpecial()) {
-        writeSNet(net);
+        snets.push_back(net);
       }
     }
+    writeParallel(snets, &defout_impl::writeSNet);
 
     fprintf(_out, "END SPECIALNETS\n");
   }
 
   fprintf(_out, "NETS %d ;\n", net_cnt);
 
+  std::vector<dbNet*> nets_to_write;
   for (dbNet* net : sorted_nets) {
     if (_select_net_map && !(*_select_net_map)[net]) {
       continue;
     }
 
     if (regular_net[net] == 1) {
-      writeNet(net);
+      nets_to_write.push_back(net);
     }
   }
+  writeParallel(nets_to_write, &defout_impl::writeNet);
 
   fprintf(_out, "END NETS\n");
 }
@@ -35,6 +35,7 @@
 #include <list>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "odb/db.h"
 #include "odb/dbMap.h"
@@ -116,6 +117,12 @@ class defout_impl
   void writePinProperties(dbBlock* block);
   bool hasProperties(dbObject* object, ObjType type);
 
+  // Formats objects in parallel into memory buffers and writes them to _out
+  // in their original order.
+  template <typename T>
+  void writeParallel(const std::vector<T*>& objects,
+                     void (defout_impl::*write)(T*));
+
  public:
   defout_impl(utl::Logger* logger)
   {
@@ -32,7 +32,10 @@
 
 #include "odb/gdsin.h"
 
+#include <cstring>
+#include <exception>
 #include <iostream>
+#include <map>
 
 #include "../db/dbGDSBoundary.h"
 #include "../db/dbGDSBox.h"
@@ -63,26 +66,41 @@ GDSReader::~GDSReader()
   }
 }
 
-dbGDSLib* GDSReader::read_gds(const std::string& filename, dbDatabase* db)
+dbGDSLib* GDSReader::read_gds(const std::string& filename,
+                              dbDatabase* db,
+                              const std::vector<std::string>& cells)
 {
   _db = db;
-  _file.open(filename, std::ios::binary);
-  if (!_file) {
-    throw std::runtime_error("Could not open file");
-  }
+  openFile(filename);
   readRecord();
   checkRType(RecordType::HEADER);
 
-  processLib();
+  processLib(filename, cells);
   if (_file.is_open()) {
     _file.close();
   }
   _db = nullptr;
 
-  bindAllSRefs();
+  if (_lib != nullptr) {
+    bindAllSRefs();
+  }
   return _lib;
 }
 
+void GDSReader::openFile(const std::string& filename)
+{
+  if (_file.is_open()) {
+    _file.close();
+  }
+  // The buffer must be set before the file is opened.
+  _file_buffer.resize(1 << 20);
+  _file.rdbuf()->pubsetbuf(_file_buffer.data(), _file_buffer.size());
+  _file.open(filename, std::ios::binary);
+  if (!_file) {
+    throw std::runtime_error("Could not open file");
+  }
+}
+
 bool GDSReader::checkRType(RecordType expect)
 {
   if (_r.type != expect) {
@@ -106,79 +124,76 @@ bool GDSReader::checkRData(DataType eType, size_t eSize)
   return true;
 }
 
-double GDSReader::readReal8()
-{
-  uint64_t value;
-  _file.read(reinterpret_cast<char*>(&value), 8);
-  return real8_to_double(htobe64(value));
-}
-
-int32_t GDSReader::readInt32()
-{
-  int32_t value;
-  _file.read(reinterpret_cast<char*>(&value), 4);
-  return htobe32(value);
-}
-
-int16_t GDSReader::readInt16()
-{
-  int16_t value;
-  _file.read(reinterpret_cast<char*>(&value), 2);
-  return htobe16(value);
-}
-
-int8_t GDSReader::readInt8()
+bool GDSReader::readRecord()
 {
-  int8_t value;
-  _file.read(reinterpret_cast<char*>(&value), 1);
-  return value;
+  return readRecordHeader() && readRecordData();
 }
 
-bool GDSReader::readRecord()
+bool GDSReader::readRecordHeader()
 {
-  uint16_t recordLength = readInt16();
-  uint8_t recordType = readInt8();
-  DataType dataType = toDataType(readInt8());
+  uint8_t header[4];
+  if (!_file.read(reinterpret_cast<char*>(header), 4)) {
+    return false;
+  }
+  uint16_t recordLength;
+  memcpy(&recordLength, header, 2);
+  recordLength = htobe16(recordLength);
+  uint8_t recordType = header[2];
+  DataType dataType = toDataType(header[3]);
   _r.type = toRecordType(recordType);
   _r.dataType = dataType;
   // printf("Record Length: %d Record Type: %s Data Type: %d\n", recordLength,
   // recordNames[recordType], dataType);
-  if ((recordLength - 4) % dataTypeSize[(int) dataType] != 0) {
+  if (recordLength < 4
+      || (recordLength - 4) % dataTypeSize[(int) dataType] != 0) {
     throw std::runtime_error(
         "Corrupted GDS, Data size is not a multiple of data type size!");
   }
   _r.length = recordLength;
-  int length = recordLength - 4;
+  return true;
+}
+
+bool GDSReader::readRecordData()
+{
+  // The whole record is read at once and then converted from big endian.
+  const int length = _r.length - 4;
+  _data.resize(length);
+  if (!_file.read(_data.data(), length)) {
+    return false;
+  }
+  const char* data = _data.data();
+  const DataType dataType = _r.dataType;
   if (dataType == DataType::INT_2) {
-    _r.data16.clear();
+    _r.data16.resize(length / 2);
     for (int i = 0; i < length; i += 2) {
-      _r.data16.push_back(readInt16());
+      uint16_t value;
+      memcpy(&value, data + i, 2);
+      _r.data16[i / 2] = htobe16(value);
     }
   } else if (dataType == DataType::INT_4 || dataType == DataType::REAL_4) {
-    _r.data32.clear();
+    _r.data32.resize(length / 4);
     for (int i = 0; i < length; i += 4) {
-      _r.data32.push_back(readInt32());
+      uint32_t value;
+      memcpy(&value, data + i, 4);
+      _r.data32[i / 4] = htobe32(value);
     }
   } else if (dataType == DataType::REAL_8) {
-    _r.data64.clear();
+    _r.data64.resize(length / 8);
     for (int i = 0; i < length; i += 8) {
-      _r.data64.push_back(readReal8());
+      uint64_t value;
+      memcpy(&value, data + i, 8);
+      _r.data64[i / 8] = real8_to_double(htobe64(value));
     }
   } else if (dataType == DataType::ASCII_STRING
              || dataType == DataType::BIT_ARRAY) {
-    _r.data8.clear();
-    for (int i = 0; i < length; i++) {
-      _r.data8.push_back(readInt8());
-    }
+    _r.data8.assign(data, length);
   }
 
-  if (_file) {
-    return true;
-  }
-  return false;
+  return true;
 }
 
-bool GDSReader::processLib()
+bool GDSReader::processLib(const std::string& filename,
+                           const std::vector<std::string>& cells)
 {
   readRecord();
   checkRType(RecordType::BGNLIB);
@@ -220,48 +235,132 @@ bool GDSReader::processLib()
   // printf("UNITS: %f %f\n", _r.data64[0], _r.data64[1]);
   _lib->setUnits(_r.data64[0], _r.data64[1]);
 
-  while (readRecord()) {
-    if (_r.type == RecordType::ENDLIB) {
-      return true;
+  std::vector<StructureIndex> index;
+  if (!indexStructs(index)) {
+    delete _lib;
+    _lib = nullptr;
+    return false;
+  }
+
+  std::map<std::string, int> index_map;
+  for (int i = 0; i < index.size(); ++i) {
+    if (!index_map.emplace(index[i].name, i).second) {
+      throw std::runtime_error("Corrupted GDS, Duplicate structure name");
     }
-    if (_r.type == RecordType::BGNSTR) {
-      if (!processStruct()) {
-        break;
+  }
+
+  // Select the requested cells and everything they reference.
+  std::vector<bool> selected(index.size(), cells.empty());
+  std::vector<int> queue;
+  for (const std::string& cell : cells) {
+    auto it = index_map.find(cell);
+    if (it == index_map.end()) {
+      throw std::runtime_error("GDS structure " + cell + " not found");
+    }
+    queue.push_back(it->second);
+  }
+  while (!queue.empty()) {
+    const int i = queue.back();
+    queue.pop_back();
+    if (selected[i]) {
+      continue;
+    }
+    selected[i] = true;
+    for (const std::string& ref : index[i].refs) {
+      auto it = index_map.find(ref);
+      if (it != index_map.end()) {
+        queue.push_back(it->second);
       }
     }
   }
 
-  delete _lib;
-  _lib = nullptr;
-  return false;
-}
+  std::vector<int> to_read;
+  for (int i = 0; i < index.size(); ++i) {
+    if (selected[i]) {
+      to_read.push_back(i);
+    }
+  }
 
-bool GDSReader::processStruct()
-{
-  readRecord();
-  checkRType(RecordType::STRNAME);
+  // Each thread decodes whole structures with its own stream.
+  const int num_structs = to_read.size();
+  std::vector<std::vector<dbGDSElement*>> elements(num_structs);
+  std::vector<char> complete(num_structs, false);
+  std::vector<std::exception_ptr> errors(num_structs);
+#pragma omp parallel for schedule(dynamic)
+  for (int i = 0; i < num_structs; ++i) {
+    try {
+      GDSReader reader;
+      reader._db = _db;
+      reader.openFile(filename);
+      reader._file.seekg(index[to_read[i]].offset);
+      complete[i] = reader.processStruct(elements[i]);
+    } catch (...) {
+      errors[i] = std::current_exception();
+    }
+  }
 
-  std::string name = std::string(_r.data8.begin(), _r.data8.end());
+  for (int i = 0; i < num_structs; ++i) {
+    if (errors[i]) {
+      std::rethrow_exception(errors[i]);
+    }
+  }
 
-  if (_lib->findGDSStructure(name.c_str()) != nullptr) {
-    throw std::runtime_error("Corrupted GDS, Duplicate structure name");
+  for (int i = 0; i < num_structs; ++i) {
+    if (!complete[i]) {
+      delete _lib;
+      _lib = nullptr;
+      return false;
+    }
+    const std::string& name = index[to_read[i]].name;
+    dbGDSStructure* str = dbGDSStructure::create(_lib, name.c_str());
+    for (dbGDSElement* el : elements[i]) {
+      str->addElement(el);
+    }
+    if (DEBUG) {
+      std::cout << ((_dbGDSStructure*) str)->to_string() << std::endl;
+    }
   }
 
-  dbGDSStructure* str = dbGDSStructure::create(_lib, name.c_str());
+  return true;
+}
 
+bool GDSReader::indexStructs(std::vector<StructureIndex>& index)
+{
+  while (readRecordHeader()) {
+    switch (_r.type) {
+      case RecordType::ENDLIB:
+        return true;
+      case RecordType::STRNAME:
+        if (!readRecordData()) {
+          return false;
+        }
+        index.push_back({_r.data8.c_str(), _file.tellg(), {}});
+        break;
+      case RecordType::SNAME:
+        if (!readRecordData()) {
+          return false;
+        }
+        if (!index.empty()) {
+          index.back().refs.emplace_back(_r.data8.c_str());
+        }
+        break;
+      default:
+        _file.seekg(_r.length - 4, std::ios::cur);
+        break;
+    }
+  }
+  return false;
+}
+
+bool GDSReader::processStruct(std::vector<dbGDSElement*>& elements)
+{
   while (readRecord()) {
     if (_r.type == RecordType::ENDSTR) {
-      if (DEBUG) {
-        std::cout << ((_dbGDSStructure*) str)->to_string() << std::endl;
-      }
       return true;
     }
-    if (!processElement(*str)) {
-      break;
-    }
+    elements.push_back(processElement());
   }
 
-  delete str;
   return false;
 }
 
@@ -272,8 +371,10 @@ bool GDSReader::processXY(dbGDSElement* elem)
     throw std::runtime_error(
         "Corrupted GDS, XY data size is not a multiple of 2");
   }
+  std::vector<Point>& xy = ((_dbGDSElement*) elem)->_xy;
+  xy.reserve(_r.data32.size() / 2);
   for (int i = 0; i < _r.data32.size(); i += 2) {
-    ((_dbGDSElement*) elem)->_xy.emplace_back(_r.data32[i], _r.data32[i + 1]);
+    xy.emplace_back(_r.data32[i], _r.data32[i + 1]);
   }
   return true;
 }
@@ -296,7 +397,7 @@ void GDSReader::processPropAttr(dbGDSElement* elem)
   }
 }
 
-bool GDSReader::processElement(dbGDSStructure& str)
+dbGDSElement* GDSReader::processElement()
 {
   dbGDSElement* el = nullptr;
 
@@ -327,9 +428,8 @@ bool GDSReader::processElement(dbGDSStructure& str)
 
   processPropAttr(el);
   checkRType(RecordType::ENDEL);
-  str.addElement(el);
 
-  return true;
+  return el;
 }
 
 dbGDSElement* GDSReader::processPath()
@@ -83,6 +83,54 @@ using namespace odb;
 %include "dbtypes.i"
 %include "dbtypes_common.i"
 
+#ifdef SWIGPYTHON
+// The bulk accessors of dbBlock return one int32 memoryview shaped
+// (objects, values per object) rather than a tuple of ints, so
+// numpy.asarray() wraps it without another copy.
+%{
+static PyObject* intArrayView(const std::vector<int>& values, int columns)
+{
+  PyObject* bytes = PyByteArray_FromStringAndSize(
+      reinterpret_cast<const char*>(values.data()),
+      values.size() * sizeof(int));
+  if (bytes == nullptr) {
+    return nullptr;
+  }
+  PyObject* view = PyMemoryView_FromObject(bytes);
+  Py_DECREF(bytes);
+  if (view == nullptr) {
+    return nullptr;
+  }
+  // memoryview can't be cast to a shape with a zero extent.
+  PyObject* array = (columns == 1 || values.empty())
+      ? PyObject_CallMethod(view, "cast", "s", "i")
+      : PyObject_CallMethod(
+          view,
+          "cast",
+          "s(ni)",
+          "i",
+          static_cast<Py_ssize_t>(values.size() / columns),
+          columns);
+  Py_DECREF(view);
+  return array;
+}
+%}
+
+%typemap(out) std::vector<int> getInstBBoxes {
+  $result = intArrayView($1, 4);
+}
+%typemap(out) std::vector<int> getInstOrients,
+              std::vector<int> getInstMasterIds {
+  $result = intArrayView($1, 1);
+}
+%typemap(out) std::vector<int> getNetPinLocations {
+  $result = intArrayView($1, 3);
+}
+%typemap(out) std::vector<int> getWireSegments {
+  $result = intArrayView($1, 6);
+}
+#endif
+
 %include "odb/geom.h"
 %include "polygon.i"
 %include "odb/db.h"
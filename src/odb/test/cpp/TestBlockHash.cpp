@@ -0,0 +1,56 @@
+#define BOOST_TEST_MODULE TestBlockHash
+#include <boost/test/included/unit_test.hpp>
+
+#include "helper.h"
+#include "odb/db.h"
+
+namespace odb {
+namespace {
+
+BOOST_AUTO_TEST_SUITE(test_suite)
+
+BOOST_AUTO_TEST_CASE(test_equal_blocks)
+{
+  auto block1 = create2LevetDbWithBTerms()->getChip()->getBlock();
+  auto block2 = create2LevetDbWithBTerms()->getChip()->getBlock();
+
+  BOOST_TEST(block1->getContentHash() == block2->getContentHash());
+  BOOST_TEST(!dbBlock::hashDifferences(block1, block2, nullptr));
+}
+
+BOOST_AUTO_TEST_CASE(test_changed_block)
+{
+  auto block1 = create2LevetDbWithBTerms()->getChip()->getBlock();
+  auto block2 = create2LevetDbWithBTerms()->getChip()->getBlock();
+  const uint64_t hash = block2->getContentHash();
+
+  block2->findInst("i1")->setLocation(100, 200);
+  BOOST_TEST(block2->getContentHash() != hash);
+  BOOST_TEST(block1->getContentHash() != block2->getContentHash());
+  BOOST_TEST(dbBlock::hashDifferences(block1, block2, nullptr));
+
+  block2->findInst("i1")->setLocation(0, 0);
+  BOOST_TEST(block2->getContentHash() == hash);
+  BOOST_TEST(!dbBlock::hashDifferences(block1, block2, nullptr));
+}
+
+BOOST_AUTO_TEST_CASE(test_destroy_history)
+{
+  auto block1 = create2LevetDbWithBTerms()->getChip()->getBlock();
+  auto block2 = create2LevetDbWithBTerms()->getChip()->getBlock();
+
+  // A net that is created and destroyed again leaves a free slot, which
+  // hashes the same as one that was never allocated.
+  dbNet::destroy(dbNet::create(block2, "tmp"));
+  BOOST_TEST(block1->getContentHash() == block2->getContentHash());
+  BOOST_TEST(!dbBlock::hashDifferences(block1, block2, nullptr));
+
+  dbNet::create(block2, "extra");
+  BOOST_TEST(block1->getContentHash() != block2->getContentHash());
+  BOOST_TEST(dbBlock::hashDifferences(block1, block2, nullptr));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace
+}  // namespace odb
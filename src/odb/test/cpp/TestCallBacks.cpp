@@ -1,10 +1,14 @@
 #define BOOST_TEST_MODULE TestCallbacks
 #include <boost/test/included/unit_test.hpp>
+#include <algorithm>
 #include <iostream>
+#include <string>
+#include <vector>
 
 #include "CallBack.h"
 #include "helper.h"
 #include "odb/db.h"
+#include "odb/dbBlockShapeIndex.h"
 
 namespace odb {
 namespace {
@@ -62,6 +66,16 @@ BOOST_AUTO_TEST_CASE(test_inst_and_iterm)
   BOOST_TEST(cb->events[0] == "PreMove inst i1");
   BOOST_TEST(cb->events[1] == "PostMove inst i1");
   cb->clearEvents();
+  {
+    dbInstMoveBatch move_batch(block);
+    i1->setOrigin(200, 200);
+    i1->setOrigin(300, 300);
+    BOOST_TEST(cb->events.size() == 1);
+    BOOST_TEST(cb->events[0] == "PreMove inst i1");
+  }
+  BOOST_TEST(cb->events.size() == 2);
+  BOOST_TEST(cb->events[1] == "PostMove inst i1");
+  cb->clearEvents();
   i1->findITerm("a")->connect(n1);
   BOOST_TEST(cb->events.size() == 2);
   BOOST_TEST(cb->events[0] == "PreConnect iterm to net n1");
@@ -86,6 +100,45 @@ BOOST_AUTO_TEST_CASE(test_inst_and_iterm)
   BOOST_TEST(cb->events[3] == "Destroy inst i1");
   tearDown();
 }
+BOOST_AUTO_TEST_CASE(test_swap_masters)
+{
+  setup();
+  db = create2LevetDbNoBTerms();
+  block = db->getChip()->getBlock();
+  dbMaster* or2 = db->findMaster("or2");
+  dbInst* i1 = block->findInst("i1");
+  dbInst* i2 = block->findInst("i2");
+  i1->setOrigin(100, 200);
+  i1->setPlacementStatus(dbPlacementStatus::PLACED);
+  cb->addOwner(block);
+  int mapped = 0;
+  auto map_mterm = [&](dbMTerm* mterm, dbMaster* master) {
+    ++mapped;
+    const std::string name = mterm->getName();
+    const char* new_name = name == "a" ? "b" : name == "b" ? "a" : "o";
+    return master->findMTerm(new_name);
+  };
+  std::vector<dbInst*> insts
+      = dbInst::swapMasters(block, {{i1, or2}, {i2, or2}}, map_mterm);
+  BOOST_TEST(mapped == 3);
+  BOOST_TEST(insts.size() == 2);
+  BOOST_TEST(insts[0]->getName() == "i1");
+  BOOST_TEST(insts[0]->getMaster() == or2);
+  BOOST_TEST(insts[0]->getOrigin() == Point(100, 200));
+  BOOST_TEST(insts[0]->getPlacementStatus() == dbPlacementStatus::PLACED);
+  BOOST_TEST(insts[0]->findITerm("b")->getNet()->getName() == "n1");
+  BOOST_TEST(insts[0]->findITerm("a")->getNet()->getName() == "n2");
+  BOOST_TEST(insts[0]->findITerm("o")->getNet()->getName() == "n5");
+  BOOST_TEST(insts[1]->getName() == "i2");
+  BOOST_TEST(insts[1]->findITerm("b")->getNet()->getName() == "n3");
+  auto event = [&](const std::string& name) {
+    return std::find(cb->events.begin(), cb->events.end(), name)
+           - cb->events.begin();
+  };
+  BOOST_TEST(event("Destroy inst i2") < event("Create inst i1"));
+  BOOST_TEST(event("Create inst i2") < event("PostMove inst i1"));
+  tearDown();
+}
 BOOST_AUTO_TEST_CASE(test_net)
 {
   setup();
@@ -202,6 +255,22 @@ BOOST_AUTO_TEST_CASE(test_row)
   dbRow::destroy(row);
   BOOST_TEST(cb->events.size() == 1);
   BOOST_TEST(cb->events[0] == "Destroy row row1");
+  cb->clearEvents();
+  std::vector<dbRow::Params> params(2);
+  for (int i = 0; i < 2; ++i) {
+    params[i].name = fmt::format("row{}", i + 2);
+    params[i].site = site;
+    params[i].origin_y = i * 10;
+    params[i].direction = dbRowDir::HORIZONTAL;
+    params[i].num_sites = 1;
+    params[i].spacing = 20;
+  }
+  std::vector<dbRow*> rows = dbRow::create(block, params);
+  BOOST_TEST(rows.size() == 2);
+  BOOST_TEST(rows[1]->getOrigin() == Point(0, 10));
+  BOOST_TEST(cb->events.size() == 2);
+  BOOST_TEST(cb->events[0] == "Create row row2");
+  BOOST_TEST(cb->events[1] == "Create row row3");
   tearDown();
 }
 BOOST_AUTO_TEST_CASE(test_wire)
@@ -265,6 +334,45 @@ BOOST_AUTO_TEST_CASE(test_swire)
   BOOST_TEST(cb->events[1] == "PostDestroySBoxes");
   BOOST_TEST(cb->events[2] == "Destroy swire");
 }
+BOOST_AUTO_TEST_CASE(test_shape_index)
+{
+  db = create2LevetDbNoBTerms();
+  block = db->getChip()->getBlock();
+  dbInst* i1 = block->findInst("i1");
+  i1->setLocation(0, 0);
+  i1->setPlacementStatus(dbPlacementStatus::PLACED);
+  dbBlockShapeIndex index(block);
+  std::vector<dbInst*> insts;
+  index.queryInsts(Rect(500, 500, 600, 600), insts);
+  BOOST_TEST(insts.size() == 1);
+  BOOST_TEST(insts[0] == i1);
+  i1->setLocation(5000, 5000);
+  insts.clear();
+  index.queryInsts(Rect(500, 500, 600, 600), insts);
+  BOOST_TEST(insts.empty());
+  index.queryInsts(Rect(5500, 5500, 5600, 5600), insts);
+  BOOST_TEST(insts.size() == 1);
+
+  dbTechLayer* layer = db->getTech()->findLayer("L1");
+  dbSWire* wire = dbSWire::create(block->findNet("n1"), dbWireType::NOSHIELD);
+  dbSBox::create(wire,
+                 layer,
+                 0,
+                 100,
+                 100,
+                 100,
+                 dbWireShapeType::IOWIRE,
+                 dbSBox::Direction::HORIZONTAL);
+  std::vector<dbSBox*> sboxes;
+  index.querySBoxes(layer, Rect(50, 50, 60, 150), sboxes);
+  BOOST_TEST(sboxes.size() == 1);
+  dbSWire::destroy(wire);
+  sboxes.clear();
+  index.querySBoxes(layer, Rect(50, 50, 60, 150), sboxes);
+  BOOST_TEST(sboxes.empty());
+  index.removeOwner();
+  dbDatabase::destroy(db);
+}
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace
@@ -0,0 +1,102 @@
+#define BOOST_TEST_MODULE TestDbSet
+#include <boost/test/included/unit_test.hpp>
+#include <string>
+#include <vector>
+
+#include "helper.h"
+#include "odb/db.h"
+
+namespace odb {
+namespace {
+
+std::vector<dbNet*> joinRanges(const std::vector<dbSetRange<dbNet>>& ranges)
+{
+  std::vector<dbNet*> nets;
+  for (const auto& range : ranges) {
+    for (dbNet* net : range) {
+      nets.push_back(net);
+    }
+  }
+  return nets;
+}
+
+BOOST_AUTO_TEST_SUITE(test_suite)
+
+BOOST_AUTO_TEST_CASE(test_split)
+{
+  dbDatabase* db;
+  db = createSimpleDB();
+  auto block = db->getChip()->getBlock();
+  for (int i = 0; i < 1000; i++) {
+    dbNet::create(block, ("n" + std::to_string(i)).c_str());
+  }
+  dbSet<dbNet> nets = block->getNets();
+  const std::vector<dbNet*> all(nets.begin(), nets.end());
+
+  auto ranges = nets.split(4);
+  BOOST_TEST(ranges.size() == 4);
+  BOOST_TEST((joinRanges(ranges) == all));
+  for (const auto& range : ranges) {
+    BOOST_TEST((range.begin() != range.end()));
+  }
+
+  BOOST_TEST(nets.split(1).size() == 1);
+  BOOST_TEST((joinRanges(nets.split(1)) == all));
+  BOOST_TEST((joinRanges(nets.split(3000)) == all));
+}
+
+BOOST_AUTO_TEST_CASE(test_split_gaps)
+{
+  dbDatabase* db;
+  db = createSimpleDB();
+  auto block = db->getChip()->getBlock();
+  std::vector<dbNet*> created;
+  for (int i = 0; i < 1000; i++) {
+    created.push_back(dbNet::create(block, ("n" + std::to_string(i)).c_str()));
+  }
+  // Leave holes in the id space, including a fully destroyed id span, the
+  // first and the last net.
+  for (int i = 0; i < 1000; i++) {
+    if (i % 3 == 0 || (i > 200 && i < 500) || i == 999) {
+      dbNet::destroy(created[i]);
+    }
+  }
+  dbSet<dbNet> nets = block->getNets();
+  const std::vector<dbNet*> all(nets.begin(), nets.end());
+
+  auto ranges = nets.split(5);
+  BOOST_TEST(ranges.size() <= 5);
+  BOOST_TEST((joinRanges(ranges) == all));
+  for (const auto& range : ranges) {
+    BOOST_TEST((range.begin() != range.end()));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_split_single_range)
+{
+  dbDatabase* db;
+  db = create2LevetDbNoBTerms();
+  auto block = db->getChip()->getBlock();
+
+  // Empty and non-sequential sets come back as one range.
+  dbSet<dbBTerm> bterms = block->getBTerms();
+  auto ranges = bterms.split(4);
+  BOOST_TEST(ranges.size() == 1);
+  BOOST_TEST((ranges[0].begin() == ranges[0].end()));
+
+  dbInst* inst = block->findInst("i1");
+  dbSet<dbITerm> iterms = inst->getITerms();
+  auto iterm_ranges = iterms.split(4);
+  BOOST_TEST(iterm_ranges.size() == 1);
+  int count = 0;
+  for (dbITerm* iterm : iterm_ranges[0]) {
+    BOOST_TEST(iterm->getInst() == inst);
+    count++;
+  }
+  BOOST_TEST(count == iterms.size());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace
+}  // namespace odb
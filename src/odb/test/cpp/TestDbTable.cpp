@@ -0,0 +1,123 @@
+#define BOOST_TEST_MODULE TestDbTable
+#include <boost/test/included/unit_test.hpp>
+#include <set>
+#include <vector>
+
+#include "dbBlock.h"
+#include "dbGuide.h"
+#include "dbNet.h"
+#include "dbTable.h"
+#include "dbTable.hpp"
+#include "helper.h"
+#include "odb/db.h"
+
+namespace odb {
+namespace {
+
+BOOST_AUTO_TEST_SUITE(test_suite)
+
+BOOST_AUTO_TEST_CASE(test_create_range)
+{
+  dbDatabase* db;
+  db = createSimpleDB();
+  auto block = db->getChip()->getBlock();
+  dbNet::create(block, "n1");
+  dbNet* n2 = dbNet::create(block, "n2");
+  dbNet::create(block, "n3");
+  const uint hole = n2->getId();
+  dbNet::destroy(n2);
+
+  dbTable<_dbNet>* tbl = ((_dbBlock*) block)->_net_tbl;
+  const uint page_size = tbl->page_size();
+  const uint count = 2 * page_size + 10;
+  std::vector<_dbNet*> nets;
+  tbl->createRange(count, nets);
+  BOOST_TEST(nets.size() == count);
+  BOOST_TEST(tbl->size() == 2 + count);
+
+  // The ids are consecutive and start on a fresh page.
+  const uint first = nets[0]->getOID();
+  BOOST_TEST(first % page_size == 0);
+  BOOST_TEST(first > 3);
+  for (uint i = 0; i < count; i++) {
+    BOOST_TEST(nets[i]->getOID() == first + i);
+    BOOST_TEST(tbl->validId(first + i));
+  }
+
+  // The set iterates the old nets followed by the range.
+  uint iterated = 0;
+  uint last_id = 0;
+  for (dbNet* net : block->getNets()) {
+    BOOST_TEST(net->getId() > last_id);
+    last_id = net->getId();
+    iterated++;
+  }
+  BOOST_TEST(iterated == tbl->size());
+  BOOST_TEST(last_id == first + count - 1);
+
+  // create() hands out free ids, from the reused hole or the tail of the
+  // last page, never one of the range.
+  std::set<uint> created;
+  for (uint i = 0; i < page_size; i++) {
+    _dbNet* net = tbl->create();
+    const uint id = net->getOID();
+    BOOST_TEST((id < first || id >= first + count));
+    BOOST_TEST(created.insert(id).second);
+  }
+  BOOST_TEST(created.count(hole) == 1);
+
+  for (_dbNet* net : nets) {
+    tbl->destroy(net);
+  }
+  BOOST_TEST(tbl->size() == 2 + page_size);
+  BOOST_TEST(!tbl->validId(first));
+}
+
+BOOST_AUTO_TEST_CASE(test_create_range_empty_table)
+{
+  dbDatabase* db;
+  db = createSimpleDB();
+  auto block = db->getChip()->getBlock();
+  dbTable<_dbGuide>* tbl = ((_dbBlock*) block)->_guide_tbl;
+  BOOST_TEST(tbl->size() == 0);
+
+  std::vector<_dbGuide*> guides;
+  tbl->createRange(0, guides);
+  BOOST_TEST(guides.empty());
+  BOOST_TEST(tbl->size() == 0);
+
+  // Id 0 is never handed out.
+  tbl->createRange(5, guides);
+  BOOST_TEST(guides.size() == 5);
+  for (uint i = 0; i < guides.size(); i++) {
+    BOOST_TEST(guides[i]->getOID() == i + 1);
+  }
+  BOOST_TEST(tbl->create()->getOID() == 6);
+}
+
+BOOST_AUTO_TEST_CASE(test_reserve)
+{
+  dbDatabase* db;
+  db = createSimpleDB();
+  auto block = db->getChip()->getBlock();
+  dbNet::create(block, "n1");
+  dbTable<_dbNet>* tbl = ((_dbBlock*) block)->_net_tbl;
+
+  const uint count = 100 * tbl->page_size();
+  tbl->reserve(count);
+  dbTablePage** pages = tbl->_pages;
+  const uint page_tbl_size = tbl->_page_tbl_size;
+
+  // The reserved range fits without growing the page table again.
+  std::vector<_dbNet*> nets;
+  tbl->createRange(count, nets);
+  BOOST_TEST(nets.size() == count);
+  BOOST_TEST(tbl->_pages == pages);
+  BOOST_TEST(tbl->_page_tbl_size == page_tbl_size);
+  BOOST_TEST(tbl->size() == count + 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace
+}  // namespace odb
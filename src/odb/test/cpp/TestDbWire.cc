@@ -130,4 +130,38 @@ TEST_F(OdbMultiPatternedTest, WireColorIsClearedOnNewPath)
   EXPECT_EQ(decoder.getColor().value(), /*mask_color=*/2);
 }
 
+TEST_F(OdbMultiPatternedTest, BlockWireSegments)
+{
+  // Arrange
+  dbNet* net = dbNet::create(block_.get(), "net0");
+  dbTech* tech = lib_->getTech();
+  dbTechLayer* met1 = tech->findLayer("met1");
+  dbTechLayer* met2 = tech->findLayer("met2");
+  dbTechVia* met1_met2 = tech->findVia("M1M2_PR_MR");
+  dbWire* wire = dbWire::create(net);
+
+  dbWireEncoder encoder;
+  encoder.begin(wire);
+  encoder.newPath(met1, dbWireType::ROUTED);
+  encoder.addPoint(50, 50);
+  encoder.addPoint(100, 50);
+  encoder.addTechVia(met1_met2);
+  encoder.addPoint(100, 130);
+  encoder.end();
+
+  // Act
+  std::vector<int> segments = block_->getWireSegments();
+
+  // Assert: the via is skipped, each segment is net, level and box
+  ASSERT_EQ(segments.size(), 2 * 6);
+  EXPECT_EQ(segments[0], net->getId());
+  EXPECT_EQ(segments[1], met1->getRoutingLevel());
+  EXPECT_LE(segments[2], 50);
+  EXPECT_GE(segments[4], 100);
+  EXPECT_EQ(segments[6], net->getId());
+  EXPECT_EQ(segments[7], met2->getRoutingLevel());
+  EXPECT_LE(segments[9], 50);
+  EXPECT_GE(segments[11], 130);
+}
+
 }  // namespace odb
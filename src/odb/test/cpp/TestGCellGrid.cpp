@@ -31,6 +31,32 @@ BOOST_AUTO_TEST_CASE(test_default)
   BOOST_TEST(grid->getCapacity(l1, 0, 0) == 0);
 }
 
+BOOST_AUTO_TEST_CASE(test_layer_congestion_map)
+{
+  dbDatabase* db;
+  db = createSimpleDB();
+  auto block = db->getChip()->getBlock();
+  auto l1 = db->getTech()->findLayer("L1");
+  dbGCellGrid* grid = dbGCellGrid::create(block);
+  grid->addGridPatternX(0, 4, 10);
+  grid->addGridPatternY(0, 3, 10);
+
+  dbMatrix<dbGCellGrid::GCellData> congestion(4, 3);
+  congestion(3, 2).capacity = 300;
+  congestion(3, 2).usage = 310;
+  congestion(1, 0).capacity = 7;
+  grid->setLayerCongestionMap(l1, congestion);
+
+  BOOST_TEST(grid->getCapacity(l1, 3, 2) == 300);
+  BOOST_TEST(grid->getUsage(l1, 3, 2) == 310);
+  BOOST_TEST(grid->getCapacity(l1, 1, 0) == 7);
+  BOOST_TEST(grid->getUsage(l1, 1, 0) == 0);
+  auto layer_map = grid->getLayerCongestionMap(l1);
+  BOOST_TEST(layer_map.numRows() == 4);
+  BOOST_TEST(layer_map.numCols() == 3);
+  BOOST_TEST(layer_map(3, 2).usage == 310);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace
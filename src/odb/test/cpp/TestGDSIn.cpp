@@ -186,6 +186,54 @@ BOOST_AUTO_TEST_CASE(edit)
   BOOST_TEST(ref_str == str1_read);
 }
 
+BOOST_AUTO_TEST_CASE(subset)
+{
+  dbDatabase* db = dbDatabase::create();
+  dbGDSLib* lib = createEmptyGDSLib(db, "subset_lib");
+
+  dbGDSStructure* leaf = createEmptyGDSStructure(lib, "leaf");
+  dbGDSStructure* top = createEmptyGDSStructure(lib, "top");
+  dbGDSStructure* other = createEmptyGDSStructure(lib, "other");
+
+  for (dbGDSStructure* str : {leaf, other}) {
+    dbGDSBox* box = createEmptyGDSBox(db);
+    box->setLayer(1);
+    box->setDatatype(0);
+    box->getXY().emplace_back(0, 0);
+    box->getXY().emplace_back(0, 100);
+    box->getXY().emplace_back(100, 100);
+    box->getXY().emplace_back(100, 0);
+    str->addElement(box);
+  }
+
+  dbGDSSRef* sref = createEmptyGDSSRef(db);
+  sref->set_sName("leaf");
+  top->addElement(sref);
+
+  std::string outpath = testTmpPath("results", "subset_test_out.gds");
+
+  stampGDSLib(lib);
+
+  GDSWriter writer;
+  writer.write_gds(lib, outpath);
+
+  GDSReader reader;
+  dbGDSLib* lib2 = reader.read_gds(outpath, db, {"top"});
+
+  BOOST_TEST(lib2->getGDSStructures().size() == 2);
+  BOOST_TEST(lib2->findGDSStructure("other") == nullptr);
+
+  dbGDSStructure* top_read = lib2->findGDSStructure("top");
+  BOOST_TEST(top_read != nullptr);
+  BOOST_TEST(top_read->getNumElements() == 1);
+
+  dbGDSSRef* sref_read = (dbGDSSRef*) top_read->getElement(0);
+  BOOST_TEST(sref_read->getStructure() == lib2->findGDSStructure("leaf"));
+
+  BOOST_CHECK_THROW(reader.read_gds(outpath, db, {"missing"}),
+                    std::runtime_error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace
@@ -1,8 +1,10 @@
 #define BOOST_TEST_MODULE TestGuide
 #include <boost/test/included/unit_test.hpp>
+#include <sstream>
 
 #include "helper.h"
 #include "odb/db.h"
+#include "odb/dbGuideStore.h"
 
 namespace odb {
 namespace {
@@ -45,6 +47,74 @@ BOOST_AUTO_TEST_CASE(test_clear_guides)
   BOOST_TEST(net->getGuides().size() == 0);
 }
 
+BOOST_AUTO_TEST_CASE(test_guide_store)
+{
+  dbDatabase* db;
+  db = createSimpleDB();
+  auto tech = db->getTech();
+  auto block = db->getChip()->getBlock();
+  auto layer = tech->findLayer("L1");
+  auto net = dbNet::create(block, "n1");
+  dbGuide::create(net, layer, layer, {0, 0, 10, 10});
+
+  dbGuideStore* store = block->getGuideStore();
+  store->setGrid({0, 0, 1000, 1000}, 100, {0, 0});
+  const uint16_t layer_id = layer->getId();
+  store->setGuides(net,
+                   {{0, 0, 2, 0, layer_id, layer_id},
+                    {2, 0, 2, 9, layer_id, layer_id}});
+  BOOST_TEST(store->hasGuides(net));
+  BOOST_TEST(store->getGuides(net).size() == 2);
+  BOOST_TEST(store->getBox(*store->getGuides(net).begin())
+             == Rect(0, 0, 300, 100));
+
+  // The packed guides become dbGuides, in order, when the net is asked.
+  BOOST_TEST(net->getGuides().size() == 2);
+  BOOST_TEST(!store->hasGuides(net));
+  dbGuide* guide = (dbGuide*) *net->getGuides().begin();
+  BOOST_TEST(guide->getLayer() == layer);
+  BOOST_TEST(guide->getBox() == Rect(0, 0, 300, 100));
+
+  store->setGuides(net, {{1, 1, 1, 1, layer_id, layer_id}});
+  net->clearGuides();
+  BOOST_TEST(!store->hasGuides(net));
+  BOOST_TEST(net->getGuides().size() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_guide_store_write_read)
+{
+  dbDatabase* db;
+  db = createSimpleDB();
+  auto tech = db->getTech();
+  auto block = db->getChip()->getBlock();
+  auto layer = tech->findLayer("L1");
+  auto net = dbNet::create(block, "n1");
+
+  dbGuideStore* store = block->getGuideStore();
+  store->setGrid({0, 0, 1000, 1000}, 100, {0, 0});
+  const uint16_t layer_id = layer->getId();
+  store->setGuides(net,
+                   {{0, 0, 2, 0, layer_id, layer_id},
+                    {2, 0, 2, 9, layer_id, layer_id}});
+
+  // The packed guides are written as dbGuides.
+  std::stringstream stream;
+  db->write(stream);
+  BOOST_TEST(!store->hasGuides(net));
+  dbDatabase::destroy(db);
+
+  dbDatabase* db2 = dbDatabase::create();
+  db2->read(stream);
+  auto net2 = db2->getChip()->getBlock()->findNet("n1");
+  BOOST_TEST(net2->getGuides().size() == 2);
+  auto guide = net2->getGuides().begin();
+  BOOST_TEST(guide->getLayer()->getName() == "L1");
+  BOOST_TEST(guide->getBox() == Rect(0, 0, 300, 100));
+  ++guide;
+  BOOST_TEST(guide->getBox() == Rect(200, 0, 300, 1000));
+  dbDatabase::destroy(db2);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace
@@ -178,6 +178,25 @@ BOOST_FIXTURE_TEST_CASE(test_undo_iterm_disconnect, F_DEFAULT)
   BOOST_TEST(iterm->getNet() == net);
 }
 
+BOOST_FIXTURE_TEST_CASE(test_undo_savepoint, F_DEFAULT)
+{
+  dbDatabase::beginEco(block);
+  dbInst::create(block, and2, "a");
+  const int outer = dbDatabase::ecoSavepoint(block);
+  dbInst::create(block, and2, "b");
+  const int inner = dbDatabase::ecoSavepoint(block);
+  dbNet::create(block, "n");
+  dbDatabase::undoEcoToSavepoint(block, inner);
+  BOOST_TEST(block->findNet("n") == nullptr);
+  BOOST_TEST(block->findInst("b") != nullptr);
+  dbDatabase::undoEcoToSavepoint(block, outer);
+  BOOST_TEST(block->findInst("b") == nullptr);
+  BOOST_TEST(block->findInst("a") != nullptr);
+  dbDatabase::endEco(block);
+  dbDatabase::undoEco(block);
+  BOOST_TEST(block->findInst("a") == nullptr);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }  // namespace
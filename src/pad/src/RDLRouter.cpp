@@ -47,6 +47,7 @@
 #include "Utilities.h"
 #include "odb/db.h"
 #include "odb/dbTransform.h"
+#include "ord/OpenRoad.hh"
 #include "pad/ICeWall.h"
 #include "utl/Logger.h"
 
@@ -804,21 +805,17 @@ void RDLRouter::makeGraph()
              "Added {} vertices to graph",
              boost::num_vertices(graph_));
 
+  // collect each grid edge once, in the order they are added to the graph
+  std::vector<Edge> grid_edges;
   for (size_t i = 0; i < x_grid_.size(); i++) {
     for (size_t j = 0; j < y_grid_.size(); j++) {
       const odb::Point center(x_grid_[i], y_grid_[j]);
 
       if (j + 1 < y_grid_.size()) {
-        addGraphEdge(center, {x_grid_[i], y_grid_[j + 1]});
-      }
-      if (j != 0) {
-        addGraphEdge(center, {x_grid_[i], y_grid_[j - 1]});
-      }
-      if (i != 0) {
-        addGraphEdge(center, {x_grid_[i - 1], y_grid_[j]});
+        grid_edges.push_back({center, {x_grid_[i], y_grid_[j + 1]}});
       }
       if (i + 1 < x_grid_.size()) {
-        addGraphEdge(center, {x_grid_[i + 1], y_grid_[j]});
+        grid_edges.push_back({center, {x_grid_[i + 1], y_grid_[j]}});
       }
 
       if (allow45_) {
@@ -827,21 +824,47 @@ void RDLRouter::makeGraph()
           continue;
         }
         if (i + 1 < x_grid_.size() && j + 1 < y_grid_.size()) {
-          addGraphEdge(center, {x_grid_[i + 1], y_grid_[j + 1]});
+          grid_edges.push_back({center, {x_grid_[i + 1], y_grid_[j + 1]}});
         }
         if (i + 1 < x_grid_.size() && j != 0) {
-          addGraphEdge(center, {x_grid_[i + 1], y_grid_[j - 1]});
+          grid_edges.push_back({center, {x_grid_[i + 1], y_grid_[j - 1]}});
         }
         if (i != 0 && j + 1 < y_grid_.size()) {
-          addGraphEdge(center, {x_grid_[i - 1], y_grid_[j + 1]});
+          grid_edges.push_back({center, {x_grid_[i - 1], y_grid_[j + 1]}});
         }
         if (i != 0 && j != 0) {
-          addGraphEdge(center, {x_grid_[i - 1], y_grid_[j - 1]});
+          grid_edges.push_back({center, {x_grid_[i - 1], y_grid_[j - 1]}});
         }
       }
     }
   }
 
+  // the obstruction tree is only read, so the edges are checked in parallel
+  std::vector<char> obstructed(grid_edges.size(), false);
+  const int thread_count = ord::OpenRoad::openRoad()->getThreadCount();
+#pragma omp parallel for num_threads(thread_count) schedule(dynamic, 1024)
+  for (int i = 0; i < (int) grid_edges.size(); i++) {  // NOLINT
+    obstructed[i] = isEdgeObstructed(grid_edges[i].pt0, grid_edges[i].pt1);
+  }
+
+  for (size_t i = 0; i < grid_edges.size(); i++) {
+    const auto& [pt0, pt1] = grid_edges[i];
+    if (obstructed[i]) {
+      debugPrint(logger_,
+                 utl::PAD,
+                 "Router_edge",
+                 1,
+                 "Failed to add edge ({}, {}) -> ({}, {}) intersects "
+                 "obstruction",
+                 pt0.x(),
+                 pt0.y(),
+                 pt1.x(),
+                 pt1.y());
+      continue;
+    }
+    addGraphEdge(pt0, pt1, 1.0, false);
+  }
+
   std::vector<GridValue> grid_tree;
   for (const auto& [point, vertex] : point_vertex_map_) {
     odb::Rect rect(point, point);
@@ -945,15 +945,15 @@ HGraphPtr Coarsener::Contraction(
                                      hgraph->GetPlacementDimensions(),
                                      hyperedges_c,
                                      vertex_weights_c,
-                                     hyperedges_weights_c,
+                                     std::move(hyperedges_weights_c),
                                      // vertex attributes
                                      fixed_attr_c,
                                      community_attr_c,
                                      placement_attr_c,
-                                     vertex_types_c,
+                                     std::move(vertex_types_c),
                                      // timing information
-                                     hyperedge_slack_c,
-                                     hyperedge_arc_set_c,
+                                     std::move(hyperedge_slack_c),
+                                     std::move(hyperedge_arc_set_c),
                                      timing_paths_c,
                                      logger_);
 
@@ -103,6 +103,20 @@ Matrix<float> GoldenEvaluator::GetBlockBalance(const HGraphPtr& hgraph,
   return block_balance;
 }
 
+// Get the block balance, net degrees and path costs of a solution
+SolutionStats GoldenEvaluator::GetSolutionStats(
+    const HGraphPtr& hgraph,
+    const Partitions& solution) const
+{
+  SolutionStats stats;
+  stats.block_balance = GetBlockBalance(hgraph, solution);
+  stats.net_degs = GetNetDegrees(hgraph, solution);
+  if (hgraph->HasTiming()) {
+    stats.paths_cost = GetPathsCost(hgraph, solution);
+  }
+  return stats;
+}
+
 // calculate timing cost of a path
 float GoldenEvaluator::GetPathTimingScore(int path_id,
                                           const HGraphPtr& hgraph) const
@@ -592,6 +606,29 @@ PartitionToken GoldenEvaluator::CutEvaluator(const HGraphPtr& hgraph,
   return PartitionToken{cost, block_balance};
 }
 
+// A hyperedge is cut if its vertices are in more than one block
+PartitionToken GoldenEvaluator::CutEvaluator(const HGraphPtr& hgraph,
+                                             const SolutionStats& stats) const
+{
+  float edge_cost = 0.0;
+  float path_cost = 0.0;
+  for (int e = 0; e < hgraph->GetNumHyperedges(); ++e) {
+    int connectivity = 0;
+    for (const int num_v : stats.net_degs[e]) {
+      if (num_v > 0) {
+        connectivity++;
+      }
+    }
+    if (connectivity > 1) {
+      edge_cost += CalculateHyperedgeCost(e, hgraph);
+    }
+  }
+  for (const float cost : stats.paths_cost) {
+    path_cost += cost;
+  }
+  return PartitionToken{edge_cost + path_cost, stats.block_balance};
+}
+
 // check the constraints
 // balance constraint, group constraint, fixed vertices constraint
 bool GoldenEvaluator::ConstraintAndCutEvaluator(
@@ -70,6 +70,16 @@ struct PartitionToken
   Matrix<float> block_balance;  // balance for each block
 };
 
+// SolutionStats is the state of a partition that the refiners keep up to
+// date move by move.  It can be handed from one refiner to the next and
+// evaluated without traversing the hypergraph again.
+struct SolutionStats
+{
+  Matrix<float> block_balance;    // balance for each block
+  Matrix<int> net_degs;           // vertex distribution of each net
+  std::vector<float> paths_cost;  // cost of each path (only with timing)
+};
+
 // GoldenEvaluator
 class GoldenEvaluator;
 using EvaluatorPtr = std::shared_ptr<GoldenEvaluator>;
@@ -109,6 +119,10 @@ class GoldenEvaluator
   Matrix<float> GetBlockBalance(const HGraphPtr& hgraph,
                                 const Partitions& solution) const;
 
+  // Get the block balance, net degrees and path costs of a solution
+  SolutionStats GetSolutionStats(const HGraphPtr& hgraph,
+                                 const Partitions& solution) const;
+
   // calculate timing cost of a path
   float GetPathTimingScore(int path_id, const HGraphPtr& hgraph) const;
 
@@ -193,6 +207,11 @@ class GoldenEvaluator
                               const std::vector<int>& solution,
                               bool print_flag = false) const;
 
+  // Same as above, but from statistics kept up to date with the solution.
+  // This only visits the hyperedges and paths, not their vertices.
+  PartitionToken CutEvaluator(const HGraphPtr& hgraph,
+                              const SolutionStats& stats) const;
+
   // check the constraints
   // balance constraint, group constraint, fixed vertices constraint
   bool ConstraintAndCutEvaluator(
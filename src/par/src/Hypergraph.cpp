@@ -37,6 +37,7 @@
 
 #include <iostream>
 #include <string>
+#include <utility>
 
 #include "Utilities.h"
 #include "utl/Logger.h"
@@ -48,24 +49,30 @@ Hypergraph::Hypergraph(
     const int hyperedge_dimensions,
     const int placement_dimensions,
     const std::vector<std::vector<int>>& hyperedges,
-    const std::vector<std::vector<float>>& vertex_weights,
-    const std::vector<std::vector<float>>& hyperedge_weights,
+    std::vector<std::vector<float>> vertex_weights,
+    std::vector<std::vector<float>> hyperedge_weights,
     // fixed vertices
-    const std::vector<int>& fixed_attr,  // the block id of fixed vertices.
+    std::vector<int> fixed_attr,  // the block id of fixed vertices.
     // community attribute
-    const std::vector<int>& community_attr,
+    std::vector<int> community_attr,
     // placement information
-    const std::vector<std::vector<float>>& placement_attr,
+    std::vector<std::vector<float>> placement_attr,
     utl::Logger* logger)
     : num_vertices_(static_cast<int>(vertex_weights.size())),
       num_hyperedges_(static_cast<int>(hyperedge_weights.size())),
       vertex_dimensions_(vertex_dimensions),
       hyperedge_dimensions_(hyperedge_dimensions),
-      vertex_weights_(vertex_weights),
-      hyperedge_weights_(hyperedge_weights)
+      vertex_weights_(std::move(vertex_weights)),
+      hyperedge_weights_(std::move(hyperedge_weights))
 {
   // add hyperedge
   // hyperedges: each hyperedge is a set of vertices
+  size_t num_pins = 0;
+  for (const auto& hyperedge : hyperedges) {
+    num_pins += hyperedge.size();
+  }
+  eind_.reserve(num_pins);
+  eptr_.reserve(hyperedges.size() + 1);
   eptr_.push_back(0);
   for (const auto& hyperedge : hyperedges) {
     eind_.insert(eind_.end(), hyperedge.begin(), hyperedge.end());
@@ -74,29 +81,18 @@ Hypergraph::Hypergraph(
 
   // add vertex
   // create vertices from hyperedges
-  std::vector<std::vector<int>> vertices(num_vertices_);
-  for (int e = 0; e < num_hyperedges_; e++) {
-    for (auto v : hyperedges[e]) {
-      vertices[v].push_back(e);  // e is the hyperedge id
-    }
-  }
-
-  vptr_.push_back(0);
-  for (const auto& vertex : vertices) {
-    vind_.insert(vind_.end(), vertex.begin(), vertex.end());
-    vptr_.push_back(static_cast<int>(vind_.size()));
-  }
+  FillIncidence(num_hyperedges_, eptr_, eind_, vptr_, vind_);
 
   // fixed vertices
   fixed_vertex_flag_ = (fixed_attr.size() == num_vertices_);
   if (fixed_vertex_flag_) {
-    fixed_attr_ = fixed_attr;
+    fixed_attr_ = std::move(fixed_attr);
   }
 
   // community information
   community_flag_ = (community_attr.size() == num_vertices_);
   if (community_flag_) {
-    community_attr_ = community_attr;
+    community_attr_ = std::move(community_attr);
   }
 
   // placement information
@@ -104,7 +100,7 @@ Hypergraph::Hypergraph(
       = (placement_dimensions > 0 && placement_attr.size() == num_vertices_);
   if (placement_flag_) {
     placement_dimensions_ = placement_dimensions;
-    placement_attr_ = placement_attr;
+    placement_attr_ = std::move(placement_attr);
   } else {
     placement_dimensions_ = 0;
   }
@@ -117,46 +113,44 @@ Hypergraph::Hypergraph(
     const int hyperedge_dimensions,
     const int placement_dimensions,
     const std::vector<std::vector<int>>& hyperedges,
-    const std::vector<std::vector<float>>& vertex_weights,
-    const std::vector<std::vector<float>>& hyperedge_weights,
+    std::vector<std::vector<float>> vertex_weights,
+    std::vector<std::vector<float>> hyperedge_weights,
     // fixed vertices
-    const std::vector<int>& fixed_attr,  // the block id of fixed vertices.
+    std::vector<int> fixed_attr,  // the block id of fixed vertices.
     // community attribute
-    const std::vector<int>& community_attr,
+    std::vector<int> community_attr,
     // placement information
-    const std::vector<std::vector<float>>& placement_attr,
+    std::vector<std::vector<float>> placement_attr,
     // the type of each vertex
-    const std::vector<VertexType>&
+    std::vector<VertexType>
         vertex_types,  // except the original timing graph,
                        // users do not need to specify this
     // slack information
-    const std::vector<float>& hyperedges_slack,
-    const std::vector<std::set<int>>& hyperedges_arc_set,
+    std::vector<float> hyperedges_slack,
+    std::vector<std::set<int>> hyperedges_arc_set,
     const std::vector<TimingPath>& timing_paths,
     utl::Logger* logger)
     : Hypergraph(vertex_dimensions,
                  hyperedge_dimensions,
                  placement_dimensions,
                  hyperedges,
-                 vertex_weights,
-                 hyperedge_weights,
-                 fixed_attr,
-                 community_attr,
-                 placement_attr,
+                 std::move(vertex_weights),
+                 std::move(hyperedge_weights),
+                 std::move(fixed_attr),
+                 std::move(community_attr),
+                 std::move(placement_attr),
                  logger)
 {
   // add vertex types
-  vertex_types_ = vertex_types;
+  vertex_types_ = std::move(vertex_types);
 
   // slack information
   if (hyperedges_slack.size() == num_hyperedges_
       && hyperedges_arc_set.size() == num_hyperedges_) {
     timing_flag_ = true;
     num_timing_paths_ = static_cast<int>(timing_paths.size());
-    hyperedge_timing_attr_ = hyperedges_slack;
-    hyperedge_arc_set_ = hyperedges_arc_set;
-    // create the vertex Matrix which stores the paths incident to vertex
-    std::vector<std::vector<int>> incident_paths(num_vertices_);
+    hyperedge_timing_attr_ = std::move(hyperedges_slack);
+    hyperedge_arc_set_ = std::move(hyperedges_arc_set);
     vptr_p_.push_back(0);
     eptr_p_.push_back(0);
     for (int path_id = 0; path_id < num_timing_paths_; path_id++) {
@@ -164,9 +158,6 @@ Hypergraph::Hypergraph(
       const auto& timing_path = timing_paths[path_id].path;
       vind_p_.insert(vind_p_.end(), timing_path.begin(), timing_path.end());
       vptr_p_.push_back(static_cast<int>(vind_p_.size()));
-      for (const int v : timing_path) {
-        incident_paths[v].push_back(path_id);
-      }
       // view each path as a sequence of hyperedge
       const auto& timing_arc = timing_paths[path_id].arcs;
       eind_p_.insert(eind_p_.end(), timing_arc.begin(), timing_arc.end());
@@ -174,10 +165,33 @@ Hypergraph::Hypergraph(
       // add the timing attribute
       path_timing_attr_.push_back(timing_paths[path_id].slack);
     }
-    pptr_v_.push_back(0);
-    for (auto& paths : incident_paths) {
-      pind_v_.insert(pind_v_.end(), paths.begin(), paths.end());
-      pptr_v_.push_back(static_cast<int>(pind_v_.size()));
+    // create the vertex Matrix which stores the paths incident to vertex
+    FillIncidence(num_timing_paths_, vptr_p_, vind_p_, pptr_v_, pind_v_);
+  }
+}
+
+// Builds the transpose of a CSR incidence: for each of the num_vertices_
+// vertices, the ids of the first num_sets sets (hyperedges or paths) that
+// contain it, in increasing order.  The degrees are counted first so the
+// lists are filled in place rather than through per-vertex vectors.
+void Hypergraph::FillIncidence(const int num_sets,
+                               const std::vector<int>& set_ptr,
+                               const std::vector<int>& set_ind,
+                               std::vector<int>& vertex_ptr,
+                               std::vector<int>& vertex_ind) const
+{
+  vertex_ptr.assign(num_vertices_ + 1, 0);
+  for (int i = 0; i < set_ptr[num_sets]; i++) {
+    vertex_ptr[set_ind[i] + 1]++;
+  }
+  for (int v = 0; v < num_vertices_; v++) {
+    vertex_ptr[v + 1] += vertex_ptr[v];
+  }
+  vertex_ind.resize(vertex_ptr[num_vertices_]);
+  std::vector<int> next(vertex_ptr.begin(), vertex_ptr.end() - 1);
+  for (int set_id = 0; set_id < num_sets; set_id++) {
+    for (int i = set_ptr[set_id]; i < set_ptr[set_id + 1]; i++) {
+      vertex_ind[next[set_ind[i]]++] = set_id;
     }
   }
 }
@@ -92,14 +92,14 @@ class Hypergraph
       int hyperedge_dimensions,
       int placement_dimensions,
       const std::vector<std::vector<int>>& hyperedges,
-      const std::vector<std::vector<float>>& vertex_weights,
-      const std::vector<std::vector<float>>& hyperedge_weights,
+      std::vector<std::vector<float>> vertex_weights,
+      std::vector<std::vector<float>> hyperedge_weights,
       // fixed vertices
-      const std::vector<int>& fixed_attr,  // the block id of fixed vertices.
+      std::vector<int> fixed_attr,  // the block id of fixed vertices.
       // community attribute
-      const std::vector<int>& community_attr,
+      std::vector<int> community_attr,
       // placement information
-      const std::vector<std::vector<float>>& placement_attr,
+      std::vector<std::vector<float>> placement_attr,
       utl::Logger* logger);
 
   Hypergraph(
@@ -107,21 +107,21 @@ class Hypergraph
       int hyperedge_dimensions,
       int placement_dimensions,
       const std::vector<std::vector<int>>& hyperedges,
-      const std::vector<std::vector<float>>& vertex_weights,
-      const std::vector<std::vector<float>>& hyperedge_weights,
+      std::vector<std::vector<float>> vertex_weights,
+      std::vector<std::vector<float>> hyperedge_weights,
       // fixed vertices
-      const std::vector<int>& fixed_attr,  // the block id of fixed vertices.
+      std::vector<int> fixed_attr,  // the block id of fixed vertices.
       // community attribute
-      const std::vector<int>& community_attr,
+      std::vector<int> community_attr,
       // placement information
-      const std::vector<std::vector<float>>& placement_attr,
+      std::vector<std::vector<float>> placement_attr,
       // the type of each vertex
-      const std::vector<VertexType>&
+      std::vector<VertexType>
           vertex_types,  // except the original timing graph, users do not need
                          // to specify this
       // slack information
-      const std::vector<float>& hyperedges_slack,
-      const std::vector<std::set<int>>& hyperedges_arc_set,
+      std::vector<float> hyperedges_slack,
+      std::vector<std::set<int>> hyperedges_arc_set,
       const std::vector<TimingPath>& timing_paths,
       utl::Logger* logger);
 
@@ -317,6 +317,12 @@ class Hypergraph
       std::vector<float> base_balance) const;
 
  private:
+  void FillIncidence(int num_sets,
+                     const std::vector<int>& set_ptr,
+                     const std::vector<int>& set_ind,
+                     std::vector<int>& vertex_ptr,
+                     std::vector<int>& vertex_ind) const;
+
   // basic hypergraph
   const int num_vertices_ = 0;
   const int num_hyperedges_ = 0;
@@ -34,11 +34,20 @@
 ///////////////////////////////////////////////////////////////////////////////
 #include "KWayFMRefine.h"
 
+#include <algorithm>
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <future>
+#include <numeric>
 #include <thread>
 
 // Implement the direct k-way FM refinement
 namespace par {
 
+// The fewest vertices worth handing to a pool thread.  Most moves only
+// touch a handful of neighbors, which are cheaper to update inline.
+static constexpr int kMinVerticesPerTask = 32;
+
 KWayFMRefine::KWayFMRefine(const int num_parts,
                            const int refiner_iters,
                            const float path_wt_factor,
@@ -56,6 +65,13 @@ KWayFMRefine::KWayFMRefine(const int num_parts,
               logger),
       total_corking_passes_(total_corking_passes)
 {
+  num_threads_ = std::max(1U, std::thread::hardware_concurrency());
+  pool_ = std::make_unique<boost::asio::thread_pool>(num_threads_);
+}
+
+KWayFMRefine::~KWayFMRefine()
+{
+  pool_->join();
 }
 
 // In each pass, we only move the boundary vertices
@@ -89,6 +105,8 @@ float KWayFMRefine::Pass(
   // each block has its own max heap
   InitializeGainBucketsKWay(
       buckets, hgraph, boundary_vertices, net_degs, cur_paths_cost, solution);
+  std::vector<int> all_blocks(num_parts_);
+  std::iota(all_blocks.begin(), all_blocks.end(), 0);
   // Here we do not store the vertex directly,
   // because we need to restore the status to the status with   best_gain
   // Based on our experiments, the moves is usually very limited.
@@ -133,24 +151,14 @@ float KWayFMRefine::Pass(
                    solution);
     std::vector<int> neighbors
         = FindNeighbors(hgraph, vertex, visited_vertices_flag);
-    // update the neighbors of v for all gain buckets in parallel
-    std::vector<std::thread> threads;
-    threads.reserve(num_parts_);
-    for (int to_pid = 0; to_pid < num_parts_; to_pid++) {
-      threads.emplace_back(&KWayFMRefine::UpdateSingleGainBucket,
-                           this,
-                           to_pid,
-                           std::ref(buckets),
-                           hgraph,
-                           std::ref(neighbors),
-                           std::ref(net_degs),
-                           std::ref(cur_paths_cost),
-                           std::ref(solution));
-    }
-    for (auto& t : threads) {
-      t.join();  // wait for all threads to finish
-    }
-    threads.clear();
+    // update the neighbors of v for all gain buckets
+    UpdateGainBuckets(buckets,
+                      all_blocks,
+                      hgraph,
+                      neighbors,
+                      net_degs,
+                      cur_paths_cost,
+                      solution);
     if (total_delta_gain >= best_gain) {
       best_gain = total_delta_gain;
       best_vertex_id = vertex;
@@ -196,52 +204,73 @@ void KWayFMRefine::InitializeGainBucketsKWay(
     const std::vector<float>& cur_paths_cost,
     const Partitions& solution) const
 {
-  std::vector<std::thread> threads;  // for parallel updating
-  threads.reserve(num_parts_);
-  // parallel initialize the num_parts gain_buckets
-  for (int to_pid = 0; to_pid < num_parts_; to_pid++) {
-    threads.emplace_back(
-        &KWayFMRefine::InitializeSingleGainBucket,
-        this,
-        std::ref(buckets),
-        to_pid,
-        hgraph,
-        std::ref(boundary_vertices),  // we only consider boundary vertices
-        std::ref(net_degs),
-        std::ref(cur_paths_cost),
-        std::ref(solution));
-  }
-  for (auto& t : threads) {
-    t.join();  // wait for all threads to finish
-  }
-  threads.clear();
+  std::vector<int> blocks(num_parts_);
+  std::iota(blocks.begin(), blocks.end(), 0);
+  InitializeGainBuckets(buckets,
+                        blocks,
+                        hgraph,
+                        boundary_vertices,
+                        net_degs,
+                        cur_paths_cost,
+                        solution);
+}
+
+// Calculate the gains in parallel over the vertices.  The buckets are not
+// thread safe, so the callers fill them afterwards in the vertex order.
+std::vector<GainCell> KWayFMRefine::CalculateGainCells(
+    const std::vector<int>& blocks,
+    const HGraphPtr& hgraph,
+    const std::vector<int>& vertices,
+    const Matrix<int>& net_degs,
+    const std::vector<float>& cur_paths_cost,
+    const Partitions& solution) const
+{
+  const int num_blocks = blocks.size();
+  std::vector<GainCell> gain_cells(vertices.size() * num_blocks);
+  ParallelFor(vertices.size(), [&](const int begin, const int end) {
+    for (int i = begin; i < end; i++) {
+      const int v = vertices[i];
+      const int from_part = solution[v];
+      for (int j = 0; j < num_blocks; j++) {
+        if (blocks[j] == from_part) {
+          continue;  // the vertex is already in this block
+        }
+        gain_cells[i * num_blocks + j] = CalculateVertexGain(
+            v, from_part, blocks[j], hgraph, solution, cur_paths_cost, net_degs);
+      }
+    }
+  });
+  return gain_cells;
 }
 
-// Initialize the single bucket
-void KWayFMRefine::InitializeSingleGainBucket(
+// Initialize the buckets of the blocks
+void KWayFMRefine::InitializeGainBuckets(
     GainBuckets& buckets,
-    int to_pid,  // move the vertex into this block (block_id = to_pid)
+    const std::vector<int>& blocks,
     const HGraphPtr& hgraph,
-    const std::vector<int>& boundary_vertices,
+    const std::vector<int>& boundary_vertices,  // we only consider boundary
+                                                // vertices
     const Matrix<int>& net_degs,
     const std::vector<float>& cur_paths_cost,
     const Partitions& solution) const
 {
-  // set current bucket to active
-  buckets[to_pid]->SetActive();
-  // traverse the boundary vertices
-  for (const int& v : boundary_vertices) {
-    const int from_part = solution[v];
-    if (from_part == to_pid) {
-      continue;  // the boundary vertex is the current bucket
+  const std::vector<GainCell> gain_cells = CalculateGainCells(
+      blocks, hgraph, boundary_vertices, net_degs, cur_paths_cost, solution);
+  const int num_blocks = blocks.size();
+  for (int j = 0; j < num_blocks; j++) {
+    auto& bucket = buckets[blocks[j]];
+    // set current bucket to active
+    bucket->SetActive();
+    for (size_t i = 0; i < boundary_vertices.size(); i++) {
+      const GainCell& gain_cell = gain_cells[i * num_blocks + j];
+      if (gain_cell != nullptr) {
+        bucket->InsertIntoPQ(gain_cell);
+      }
+    }
+    // if the current bucket is empty, set the bucket to deactive
+    if (bucket->GetTotalElements() == 0) {
+      bucket->SetDeactive();
     }
-    auto gain_cell = CalculateVertexGain(
-        v, from_part, to_pid, hgraph, solution, cur_paths_cost, net_degs);
-    buckets[to_pid]->InsertIntoPQ(gain_cell);
-  }
-  // if the current bucket is empty, set the bucket to deactive
-  if (buckets[to_pid]->GetTotalElements() == 0) {
-    buckets[to_pid]->SetDeactive();
   }
 }
 
@@ -324,17 +353,8 @@ void KWayFMRefine::AcceptKWayMove(const std::shared_ptr<VertexGain>& gain_cell,
                    curr_block_balance,
                    net_degs);
   // Remove vertex from all buckets where vertex is present
-  std::vector<std::thread> deletion_threads;
-  deletion_threads.reserve(num_parts_);
   for (int i = 0; i < num_parts_; ++i) {
-    deletion_threads.emplace_back(&par::KWayFMRefine::HeapEleDeletion,
-                                  this,
-                                  vertex_id,
-                                  i,
-                                  std::ref(gain_buckets));
-  }
-  for (auto& th : deletion_threads) {
-    th.join();
+    HeapEleDeletion(vertex_id, i, gain_buckets);
   }
 }
 
@@ -351,32 +371,62 @@ void KWayFMRefine::HeapEleDeletion(int vertex_id,
 // to be updated. This function is used to update the gain of neighbor vertices
 // notices that the neighbors has been calculated based on solution, visited
 // status, boundary vertices status
-void KWayFMRefine::UpdateSingleGainBucket(
-    int part,
-    GainBuckets& buckets,
-    const HGraphPtr& hgraph,
-    const std::vector<int>& neighbors,
-    const Matrix<int>& net_degs,
-    const std::vector<float>& cur_paths_cost,
-    const Partitions& solution) const
+void KWayFMRefine::UpdateGainBuckets(GainBuckets& buckets,
+                                     const std::vector<int>& blocks,
+                                     const HGraphPtr& hgraph,
+                                     const std::vector<int>& neighbors,
+                                     const Matrix<int>& net_degs,
+                                     const std::vector<float>& cur_paths_cost,
+                                     const Partitions& solution) const
 {
-  std::set<int> neighboring_hyperedges;
-  for (const int& v : neighbors) {
-    const int from_part = solution[v];
-    if (from_part == part) {
-      continue;
-    }
-    // recalculate the current gain of the vertex v
-    auto gain_cell = CalculateVertexGain(
-        v, from_part, part, hgraph, solution, cur_paths_cost, net_degs);
-    // check if the vertex exists in current bucket
-    if (buckets[part]->CheckIfVertexExists(v) == true) {
-      // update the bucket with new gain
-      buckets[part]->ChangePriority(v, gain_cell);
-    } else {
-      buckets[part]->InsertIntoPQ(gain_cell);
+  // recalculate the current gain of the neighbors
+  const std::vector<GainCell> gain_cells = CalculateGainCells(
+      blocks, hgraph, neighbors, net_degs, cur_paths_cost, solution);
+  const int num_blocks = blocks.size();
+  for (int j = 0; j < num_blocks; j++) {
+    auto& bucket = buckets[blocks[j]];
+    for (size_t i = 0; i < neighbors.size(); i++) {
+      const GainCell& gain_cell = gain_cells[i * num_blocks + j];
+      if (gain_cell == nullptr) {
+        continue;
+      }
+      // check if the vertex exists in current bucket
+      if (bucket->CheckIfVertexExists(neighbors[i]) == true) {
+        // update the bucket with new gain
+        bucket->ChangePriority(neighbors[i], gain_cell);
+      } else {
+        bucket->InsertIntoPQ(gain_cell);
+      }
     }
   }
 }
 
+void KWayFMRefine::ParallelFor(const int num_items,
+                               const std::function<void(int, int)>& fn) const
+{
+  const int num_tasks
+      = std::min(num_threads_, num_items / kMinVerticesPerTask);
+  if (num_tasks <= 1) {
+    fn(0, num_items);
+    return;
+  }
+  // the calling thread takes the first chunk itself
+  std::vector<std::future<void>> tasks;
+  tasks.reserve(num_tasks - 1);
+  for (int t = 1; t < num_tasks; t++) {
+    const int begin = static_cast<long>(num_items) * t / num_tasks;
+    const int end = static_cast<long>(num_items) * (t + 1) / num_tasks;
+    auto task
+        = std::make_shared<std::packaged_task<void()>>([&fn, begin, end] {
+            fn(begin, end);
+          });
+    tasks.push_back(task->get_future());
+    boost::asio::post(*pool_, [task] { (*task)(); });
+  }
+  fn(0, num_items / num_tasks);
+  for (auto& task : tasks) {
+    task.get();
+  }
+}
+
 }  // namespace par
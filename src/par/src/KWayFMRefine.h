@@ -34,10 +34,16 @@
 ///////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <functional>
+#include <memory>
 #include <set>
 
 #include "Refiner.h"
 
+namespace boost::asio {
+class thread_pool;
+}
+
 namespace par {
 
 class KWayFMRefine;
@@ -61,29 +67,7 @@ class KWayFMRefine : public Refiner
       EvaluatorPtr evaluator,
       utl::Logger* logger);
 
-  // Mark these two functions as public.
-  // Because they will be called by multi-threading
-  // Initialize the single bucket
-  void InitializeSingleGainBucket(
-      GainBuckets& buckets,
-      int to_pid,  // move the vertex into this block (block_id = to_pid)
-      const HGraphPtr& hgraph,
-      const std::vector<int>& boundary_vertices,
-      const Matrix<int>& net_degs,
-      const std::vector<float>& cur_paths_cost,
-      const Partitions& solution) const;
-
-  // After moving one vertex, the gain of its neighbors will also need
-  // to be updated. This function is used to update the gain of neighbor
-  // vertices notices that the neighbors has been calculated based on solution,
-  // visited status, boundary vertices status
-  void UpdateSingleGainBucket(int part,
-                              GainBuckets& buckets,
-                              const HGraphPtr& hgraph,
-                              const std::vector<int>& neighbors,
-                              const Matrix<int>& net_degs,
-                              const std::vector<float>& cur_paths_cost,
-                              const Partitions& solution) const;
+  ~KWayFMRefine() override;
 
  protected:
   // The main function for the FM-based refinement
@@ -106,6 +90,43 @@ class KWayFMRefine : public Refiner
                                  const std::vector<float>& cur_paths_cost,
                                  const Partitions& solution) const;
 
+  // Calculate the gain of moving each vertex into each of the blocks.
+  // The result is indexed by vertex_idx * blocks.size() + block_idx and
+  // holds nullptr where the vertex already sits in the block.
+  std::vector<GainCell> CalculateGainCells(
+      const std::vector<int>& blocks,
+      const HGraphPtr& hgraph,
+      const std::vector<int>& vertices,
+      const Matrix<int>& net_degs,
+      const std::vector<float>& cur_paths_cost,
+      const Partitions& solution) const;
+
+  // Initialize the buckets of the blocks with the boundary vertices
+  void InitializeGainBuckets(GainBuckets& buckets,
+                             const std::vector<int>& blocks,
+                             const HGraphPtr& hgraph,
+                             const std::vector<int>& boundary_vertices,
+                             const Matrix<int>& net_degs,
+                             const std::vector<float>& cur_paths_cost,
+                             const Partitions& solution) const;
+
+  // After moving one vertex, the gain of its neighbors will also need
+  // to be updated. This function is used to update the gain of neighbor
+  // vertices in the buckets of the blocks. Notice that the neighbors has been
+  // calculated based on solution, visited status, boundary vertices status
+  void UpdateGainBuckets(GainBuckets& buckets,
+                         const std::vector<int>& blocks,
+                         const HGraphPtr& hgraph,
+                         const std::vector<int>& neighbors,
+                         const Matrix<int>& net_degs,
+                         const std::vector<float>& cur_paths_cost,
+                         const Partitions& solution) const;
+
+  // Run fn(begin, end) over chunks of [0, num_items) on the thread pool.
+  // Small batches are run on the calling thread.
+  void ParallelFor(int num_items,
+                   const std::function<void(int, int)>& fn) const;
+
   // Determine which vertex gain to be picked
   std::shared_ptr<VertexGain> PickMoveKWay(
       GainBuckets& buckets,
@@ -133,6 +154,11 @@ class KWayFMRefine : public Refiner
   // variables
   int total_corking_passes_ = 25;  // the maximum level of traversing the
                                    // buckets to solve the "corking effect"
+
+  // The gain calculations are shared out over a persistent pool rather than
+  // over threads spawned per bucket for each move
+  int num_threads_ = 1;
+  std::unique_ptr<boost::asio::thread_pool> pool_;
 };
 
 }  // namespace par
@@ -35,15 +35,16 @@
 
 #include "Multilevel.h"
 
+#include <algorithm>
 #include <functional>
 #include <queue>
 #include <random>
-#include <thread>
 
 #include "Evaluator.h"
 #include "Hypergraph.h"
 #include "Partitioner.h"
 #include "utl/Logger.h"
+#include "utl/ThreadPool.h"
 
 namespace par {
 
@@ -303,61 +304,55 @@ void MultilevelPartitioner::InitialPartition(
     // random partitioning + Vile
     initial_solutions.resize(num_initial_random_solutions_ * 2 + 1);
   }
+  // generate random seed
+  // The seeds are drawn up front in the order of the solutions, so the
+  // solutions do not depend on how the work below is spread over threads.
+  const int num_random_solutions = num_initial_random_solutions_ * 2;
+  std::vector<int> seeds(num_random_solutions);
+  for (int& seed : seeds) {
+    seed = std::numeric_limits<int>::max() * dist(gen);
+  }
   // We need k_way_fm_refiner to generate a balanced partitioning
   k_way_fm_refiner_->SetMaxMove(hgraph->GetNumVertices());
-  // generate random seed
-  for (int i = 0; i < num_initial_random_solutions_; ++i) {
-    const int seed = std::numeric_limits<int>::max() * dist(gen);
+  // Random and random vile solutions are independent of each other, so they
+  // are generated in parallel. Each one uses its own copy of the partitioner
+  // for its seed; the refiner is shared as in RefinePartition.
+  std::vector<float> random_solutions_cost(num_random_solutions);
+  std::vector<char> random_solutions_flag(num_random_solutions);
+  auto lambda_random_part = [&](int i) -> void {
     auto& solution = initial_solutions[i];
+    Partitioner partitioner = *partitioner_;
+    partitioner.SetRandomSeed(seeds[i]);
     // call random partitioning
-    partitioner_->SetRandomSeed(seed);
-    partitioner_->Partition(hgraph,
-                            upper_block_balance,
-                            lower_block_balance,
-                            solution,
-                            PartitionType::INIT_RANDOM);
-    // call FM refiner to improve the solution
-    k_way_fm_refiner_->Refine(
-        hgraph, upper_block_balance, lower_block_balance, solution);
-    const auto token = evaluator_->CutEvaluator(hgraph, solution, false);
-    initial_solutions_cost.push_back(token.cost);
-    // Here we only check the upper bound to make sure more possible solutions
-    initial_solutions_flag.push_back(token.block_balance
-                                     <= upper_block_balance);
-    debugPrint(logger_,
-               PAR,
-               "initial_partitioning",
-               1,
-               "{} :: Random part cutcost = {}, balance_flag = {}",
-               i,
-               initial_solutions_cost.back(),
-               (bool) initial_solutions_flag.back());
-  }
-  // generate random vile solution
-  for (int i = 0; i < num_initial_random_solutions_; ++i) {
-    const int seed = std::numeric_limits<int>::max() * dist(gen);
-    auto& solution = initial_solutions[i + num_initial_random_solutions_];
-    // call random partitioning
-    partitioner_->SetRandomSeed(seed);
-    partitioner_->Partition(hgraph,
-                            upper_block_balance,
-                            lower_block_balance,
-                            solution,
-                            PartitionType::INIT_RANDOM_VILE);
+    partitioner.Partition(hgraph,
+                          upper_block_balance,
+                          lower_block_balance,
+                          solution,
+                          i < num_initial_random_solutions_
+                              ? PartitionType::INIT_RANDOM
+                              : PartitionType::INIT_RANDOM_VILE);
     // call FM refiner to improve the solution
+    SolutionStats stats = evaluator_->GetSolutionStats(hgraph, solution);
     k_way_fm_refiner_->Refine(
-        hgraph, upper_block_balance, lower_block_balance, solution);
-    const auto token = evaluator_->CutEvaluator(hgraph, solution, false);
-    initial_solutions_cost.push_back(token.cost);
+        hgraph, upper_block_balance, lower_block_balance, solution, stats);
+    const auto token = evaluator_->CutEvaluator(hgraph, stats);
+    random_solutions_cost[i] = token.cost;
     // Here we only check the upper bound to make sure more possible solutions
-    initial_solutions_flag.push_back(token.block_balance
-                                     <= upper_block_balance);
+    random_solutions_flag[i] = token.block_balance <= upper_block_balance;
+  };
+  utl::ThreadPool::get().parallelFor(
+      0, num_random_solutions, lambda_random_part);
+  for (int i = 0; i < num_random_solutions; ++i) {
+    initial_solutions_cost.push_back(random_solutions_cost[i]);
+    initial_solutions_flag.push_back(random_solutions_flag[i]);
+    const bool vile = i >= num_initial_random_solutions_;
     debugPrint(logger_,
                PAR,
                "initial_partitioning",
                1,
-               "{} :: Random VILE part cutcost = {}, balance_flag = {}",
-               i,
+               "{} :: Random {}part cutcost = {}, balance_flag = {}",
+               vile ? i - num_initial_random_solutions_ : i,
+               vile ? "VILE " : "",
                initial_solutions_cost.back(),
                (bool) initial_solutions_flag.back());
   }
@@ -371,11 +366,15 @@ void MultilevelPartitioner::InitialPartition(
                           vile_solution,
                           PartitionType::INIT_VILE);
   // We need k_way_fm_refiner to generate a balanced partitioning
-  k_way_fm_refiner_->Refine(
-      hgraph, upper_block_balance, lower_block_balance, vile_solution);
+  SolutionStats vile_stats
+      = evaluator_->GetSolutionStats(hgraph, vile_solution);
+  k_way_fm_refiner_->Refine(hgraph,
+                            upper_block_balance,
+                            lower_block_balance,
+                            vile_solution,
+                            vile_stats);
   k_way_fm_refiner_->RestoreDefaultParameters();
-  const auto vile_token
-      = evaluator_->CutEvaluator(hgraph, vile_solution, false);
+  const auto vile_token = evaluator_->CutEvaluator(hgraph, vile_stats);
   initial_solutions_cost.push_back(vile_token.cost);
   initial_solutions_flag.push_back(vile_token.block_balance
                                    <= upper_block_balance);
@@ -519,26 +518,16 @@ void MultilevelPartitioner::RefinePartition(
     }
 
     // Parallel refine all the solutions
-    std::vector<std::thread> threads;
-    threads.reserve(top_solutions.size());
-    for (auto& top_solution : top_solutions) {
-      threads.emplace_back(&par::MultilevelPartitioner::CallRefiner,
-                           this,
-                           hgraph,
-                           std::ref(upper_block_balance),
-                           std::ref(lower_block_balance),
-                           std::ref(top_solution));
-    }
-    for (auto& th : threads) {
-      th.join();
-    }
-    threads.clear();
+    std::vector<float> top_solutions_cost(top_solutions.size());
+    utl::ThreadPool::get().parallelFor(0, top_solutions.size(), [&](int i) {
+      top_solutions_cost[i] = CallRefiner(
+          hgraph, upper_block_balance, lower_block_balance, top_solutions[i]);
+    });
 
     // update the best_solution_id
     float best_cost = std::numeric_limits<float>::max();
     for (auto i = 0; i < top_solutions.size(); i++) {
-      const float cost
-          = evaluator_->CutEvaluator(hgraph, top_solutions[i], false).cost;
+      const float cost = top_solutions_cost[i];
       if (best_cost > cost) {
         best_cost = cost;
         best_solution_id = i;
@@ -561,20 +550,25 @@ void MultilevelPartitioner::RefinePartition(
 // Refine function
 // k_way_pm_refinement,
 // k_way_fm_refinement and greedy refinement
-void MultilevelPartitioner::CallRefiner(
+// The refiners share the statistics of the solution, which are evaluated
+// once here and then kept up to date move by move.  Returns the cost of the
+// refined solution.
+float MultilevelPartitioner::CallRefiner(
     const HGraphPtr& hgraph,
     const Matrix<float>& upper_block_balance,
     const Matrix<float>& lower_block_balance,
     std::vector<int>& solution) const
 {
+  SolutionStats stats = evaluator_->GetSolutionStats(hgraph, solution);
   if (num_parts_ > 1) {  // Pair-wise FM only used for multi-way partitioning
     k_way_pm_refiner_->Refine(
-        hgraph, upper_block_balance, lower_block_balance, solution);
+        hgraph, upper_block_balance, lower_block_balance, solution, stats);
   }
   k_way_fm_refiner_->Refine(
-      hgraph, upper_block_balance, lower_block_balance, solution);
+      hgraph, upper_block_balance, lower_block_balance, solution, stats);
   greedy_refiner_->Refine(
-      hgraph, upper_block_balance, lower_block_balance, solution);
+      hgraph, upper_block_balance, lower_block_balance, solution, stats);
+  return evaluator_->CutEvaluator(hgraph, stats).cost;
 }
 
 // Perform cut-overlay clustering and ILP-based partitioning
@@ -120,10 +120,11 @@ class MultilevelPartitioner
   // Refine function
   // Ilp refinement, k_way_pm_refinement,
   // k_way_fm_refinement and greedy refinement
-  void CallRefiner(const HGraphPtr& hgraph,
-                   const Matrix<float>& upper_block_balance,
-                   const Matrix<float>& lower_block_balance,
-                   std::vector<int>& solution) const;
+  // Returns the cost of the refined solution
+  float CallRefiner(const HGraphPtr& hgraph,
+                    const Matrix<float>& upper_block_balance,
+                    const Matrix<float>& lower_block_balance,
+                    std::vector<int>& solution) const;
 
   // Perform cut-overlay clustering and ILP-based partitioning
   // The ILP-based partitioning uses top_solutions[best_solution_id] as a hint,
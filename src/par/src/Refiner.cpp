@@ -124,6 +124,17 @@ void Refiner::Refine(const HGraphPtr& hgraph,
                      const Matrix<float>& upper_block_balance,
                      const Matrix<float>& lower_block_balance,
                      Partitions& solution)
+{
+  // calculate the basic statistics of current solution
+  SolutionStats stats = evaluator_->GetSolutionStats(hgraph, solution);
+  Refine(hgraph, upper_block_balance, lower_block_balance, solution, stats);
+}
+
+void Refiner::Refine(const HGraphPtr& hgraph,
+                     const Matrix<float>& upper_block_balance,
+                     const Matrix<float>& lower_block_balance,
+                     Partitions& solution,
+                     SolutionStats& stats)
 {
   if (max_move_ <= 0) {
     debugPrint(logger_,
@@ -134,14 +145,6 @@ void Refiner::Refine(const HGraphPtr& hgraph,
                max_move_);
     return;
   }
-  // calculate the basic statistics of current solution
-  Matrix<float> cur_block_balance
-      = evaluator_->GetBlockBalance(hgraph, solution);
-  Matrix<int> net_degs = evaluator_->GetNetDegrees(hgraph, solution);
-  std::vector<float> cur_paths_cost;
-  if (hgraph->HasTiming()) {
-    cur_paths_cost = evaluator_->GetPathsCost(hgraph, solution);
-  }
   for (int i = 0; i < refiner_iters_; ++i) {
     // the main function for improving the solution
     // mark the vertices can be moved as unvisited
@@ -157,9 +160,9 @@ void Refiner::Refine(const HGraphPtr& hgraph,
     const float gain = Pass(hgraph,
                             upper_block_balance,
                             lower_block_balance,
-                            cur_block_balance,
-                            net_degs,
-                            cur_paths_cost,
+                            stats.block_balance,
+                            stats.net_degs,
+                            stats.paths_cost,
                             solution,
                             visited_vertices_flag);
     if (gain <= 0.0) {
@@ -123,6 +123,15 @@ class Refiner
               const Matrix<float>& lower_block_balance,
               Partitions& solution);
 
+  // Same as above, for a solution whose statistics are already known.
+  // stats is kept up to date with the solution, so it can be passed on to
+  // the next refiner.
+  void Refine(const HGraphPtr& hgraph,
+              const Matrix<float>& upper_block_balance,
+              const Matrix<float>& lower_block_balance,
+              Partitions& solution,
+              SolutionStats& stats);
+
   void SetMaxMove(int max_move);
   void SetRefineIters(int refiner_iters);
 
@@ -43,6 +43,8 @@
 #include <iostream>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <utility>
 
 #include "Coarsener.h"
 #include "Hypergraph.h"
@@ -1607,6 +1609,44 @@ void TritonPart::BuildTimingPaths()
       false,
       false);
 
+  // Map a pin on a path to its vertex and hyperedge, or -1 if they are not
+  // part of the hypergraph. The critical paths share most of their pins, so
+  // each pin is looked up in the database once and reused by later paths.
+  std::unordered_map<const sta::Pin*, std::pair<int, int>> pin_ids;
+  auto lambda_pin_ids = [&](const sta::Pin* pin) -> std::pair<int, int> {
+    auto iter = pin_ids.find(pin);
+    if (iter != pin_ids.end()) {
+      return iter->second;
+    }
+    std::pair<int, int> ids(-1, -1);
+    // Nets connect pins at a level of the hierarchy
+    const sta::Net* net = network_->net(pin);
+    // Check if the pin is connected to a net
+    if (net != nullptr) {
+      odb::dbObject* vertex = nullptr;
+      if (network_->isTopLevelPort(pin) == true) {
+        odb::dbITerm* iterm = nullptr;
+        odb::dbBTerm* bterm = nullptr;
+        odb::dbModITerm* moditerm = nullptr;
+        odb::dbModBTerm* modbterm = nullptr;
+        network_->staToDb(pin, iterm, bterm, moditerm, modbterm);
+        vertex = bterm;
+      } else {
+        vertex = network_->staToDb(network_->instance(pin));
+      }
+      odb::dbNet* db_net = network_->staToDb(net);
+      if (vertex != nullptr) {
+        ids.first = odb::dbIntProperty::find(vertex, "vertex_id")->getValue();
+      }
+      if (ids.first != -1 && db_net != nullptr) {
+        ids.second
+            = odb::dbIntProperty::find(db_net, "hyperedge_id")->getValue();
+      }
+    }
+    pin_ids[pin] = ids;
+    return ids;
+  };
+
   // check all the timing paths
   for (auto& path_end : path_ends) {
     // Printing timing paths to logger
@@ -1626,41 +1666,15 @@ void TritonPart::BuildTimingPaths()
     for (size_t i = 0; i < expand.size(); i++) {
       // PathRef is reference to a path vertex
       sta::PathRef* ref = expand.path(i);
-      sta::Pin* pin = ref->vertex(sta_)->pin();
-      // Nets connect pins at a level of the hierarchy
-      auto net = network_->net(pin);  // sta::Net*
-      // Check if the pin is connected to a net
-      if (net == nullptr) {
-        continue;  // check if the net exists
+      const sta::Pin* pin = ref->vertex(sta_)->pin();
+      const auto [vertex_id, hyperedge_id] = lambda_pin_ids(pin);
+      if (vertex_id == -1) {
+        continue;
       }
-      if (network_->isTopLevelPort(pin) == true) {
-        auto bterm = block_->findBTerm(network_->pathName(pin));
-        const int vertex_id
-            = odb::dbIntProperty::find(bterm, "vertex_id")->getValue();
-        if (vertex_id == -1) {
-          continue;
-        }
-        if (timing_path.path.empty() == true
-            || timing_path.path.back() != vertex_id) {
-          timing_path.path.push_back(vertex_id);
-        }
-      } else {
-        auto inst = network_->instance(pin);
-        auto db_inst = block_->findInst(network_->pathName(inst));
-        const int vertex_id
-            = odb::dbIntProperty::find(db_inst, "vertex_id")->getValue();
-        if (vertex_id == -1) {
-          continue;
-        }
-        if (timing_path.path.empty() == true
-            || timing_path.path.back() != vertex_id) {
-          timing_path.path.push_back(vertex_id);
-        }
+      if (timing_path.path.empty() == true
+          || timing_path.path.back() != vertex_id) {
+        timing_path.path.push_back(vertex_id);
       }
-      auto db_net = block_->findNet(
-          network_->pathName(net));  // convert sta::Net* to dbNet*
-      const int hyperedge_id
-          = odb::dbIntProperty::find(db_net, "hyperedge_id")->getValue();
       if (hyperedge_id == -1) {
         continue;
       }
@@ -42,6 +42,10 @@
 #include "odb/db.h"
 #include "utl/Logger.h"
 
+namespace odb {
+class dbBlockShapeIndex;
+}
+
 namespace pdn {
 
 using odb::dbBlock;
@@ -232,6 +236,8 @@ class PdnGen
   bool importUPF(VoltageDomain* domain);
   bool importUPF(Grid* grid, PowerSwitchNetworkType type) const;
 
+  const odb::dbBlockShapeIndex* getShapeIndex(odb::dbBlock* block);
+
   odb::dbDatabase* db_;
   utl::Logger* logger_;
 
@@ -241,6 +247,10 @@ class PdnGen
   std::unique_ptr<VoltageDomain> core_domain_;
   std::vector<std::unique_ptr<VoltageDomain>> domains_;
   std::vector<std::unique_ptr<PowerCell>> switched_power_cells_;
+
+  // shared index of the block shapes, kept current by the block callbacks
+  std::unique_ptr<odb::dbBlockShapeIndex> shape_index_;
+  odb::dbBlock* shape_index_block_ = nullptr;
 };
 
 }  // namespace pdn
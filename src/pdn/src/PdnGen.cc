@@ -42,6 +42,7 @@
 #include "domain.h"
 #include "grid.h"
 #include "odb/db.h"
+#include "odb/dbBlockShapeIndex.h"
 #include "odb/dbTransform.h"
 #include "ord/OpenRoad.hh"
 #include "power_cells.h"
@@ -951,11 +952,26 @@ void PdnGen::checkSetup() const
 
 void PdnGen::repairVias(const std::set<odb::dbNet*>& nets)
 {
-  ViaRepair repair(logger_, nets);
+  if (nets.empty()) {
+    return;
+  }
+
+  ViaRepair repair(logger_, nets, getShapeIndex((*nets.begin())->getBlock()));
   repair.repair();
   repair.report();
 }
 
+const odb::dbBlockShapeIndex* PdnGen::getShapeIndex(odb::dbBlock* block)
+{
+  // the index detaches itself when its block is destroyed
+  if (shape_index_ == nullptr || !shape_index_->hasOwner()
+      || shape_index_block_ != block) {
+    shape_index_ = std::make_unique<odb::dbBlockShapeIndex>(block);
+    shape_index_block_ = block;
+  }
+  return shape_index_.get();
+}
+
 bool PdnGen::importUPF(VoltageDomain* domain)
 {
   auto* block = db_->getChip()->getBlock();
@@ -455,13 +455,43 @@ void Connect::makeVia(odb::dbSWire* wire,
     return;
   }
 
+  const ViaGenerator::Constraint lower_shape_constraint
+      = getShapeConstraint(lower);
+  const ViaGenerator::Constraint upper_shape_constraint
+      = getShapeConstraint(upper);
+
+  auto constraint_index = [](const ViaGenerator::Constraint& constraint) {
+    return (constraint.must_fit_x ? 1 : 0) | (constraint.must_fit_y ? 2 : 0)
+           | (constraint.intersection_only ? 4 : 0);
+  };
+  // shapes the via must fit into are part of the index, relative to the via
+  // center, since their extent determines which vias can be built
+  const odb::dbTransform via_xfm({-x, -y});
+  odb::Rect lower_index_rect;
+  if (!lower_shape_constraint.intersection_only) {
+    lower_index_rect = lower_rect;
+    via_xfm.apply(lower_index_rect);
+  }
+  odb::Rect upper_index_rect;
+  if (!upper_shape_constraint.intersection_only) {
+    upper_index_rect = upper_rect;
+    via_xfm.apply(upper_index_rect);
+  }
   const ViaIndex via_index
-      = std::make_pair(intersection.dx(), intersection.dy());
+      = std::make_tuple(intersection.dx(),
+                        intersection.dy(),
+                        constraint_index(lower_shape_constraint),
+                        constraint_index(upper_shape_constraint),
+                        lower_index_rect,
+                        upper_index_rect);
   auto& via = vias_[via_index];
 
-  bool skip_caching = false;
   // make the via stack if one is not available for the given size
-  if (via == nullptr) {
+  if (via != nullptr) {
+    via_cache_hits_++;
+  } else {
+    via_cache_misses_++;
+
     std::vector<ViaLayerRects> stack_rects;
     if (isComplexStackedVia(lower_rect, upper_rect)) {
       debugPrint(grid_->getLogger(),
@@ -491,29 +521,11 @@ void Connect::makeVia(odb::dbSWire* wire,
 
       ViaGenerator::Constraint lower_constraint{false, false, true};
       if (lower->getLayer() == l0) {
-        if (!lower->isModifiable() || lower->hasITermConnections()) {
-          // lower is not modifiable to all sides must fit
-          skip_caching = true;
-          lower_constraint.must_fit_x = true;
-          lower_constraint.must_fit_y = true;
-          lower_constraint.intersection_only = false;
-        } else {
-          lower_constraint.must_fit_x = !lower->isHorizontal();
-          lower_constraint.must_fit_y = !lower->isVertical();
-        }
+        lower_constraint = lower_shape_constraint;
       }
       ViaGenerator::Constraint upper_constraint{false, false, true};
       if (upper->getLayer() == l1) {
-        if (!upper->isModifiable() || upper->hasITermConnections()) {
-          // upper is not modifiable to all sides must fit
-          skip_caching = true;
-          upper_constraint.must_fit_x = true;
-          upper_constraint.must_fit_y = true;
-          upper_constraint.intersection_only = false;
-        } else {
-          upper_constraint.must_fit_x = !upper->isHorizontal();
-          upper_constraint.must_fit_y = !upper->isVertical();
-        }
+        upper_constraint = upper_shape_constraint;
       }
 
       auto* new_via = makeSingleLayerVia(wire->getBlock(),
@@ -547,15 +559,21 @@ void Connect::makeVia(odb::dbSWire* wire,
   shapes = via->generate(
       wire->getBlock(), wire, type, x, y, ongrid_, grid_->getLogger());
 
-  if (skip_caching) {
-    via = nullptr;
-  }
-
   if (shapes.bottom.empty() && shapes.top.empty()) {
     addFailedVia(failedViaReason::RECHECK, intersection, wire->getNet());
   }
 }
 
+ViaGenerator::Constraint Connect::getShapeConstraint(
+    const ShapePtr& shape) const
+{
+  if (!shape->isModifiable() || shape->hasITermConnections()) {
+    // shape is not modifiable so all sides must fit
+    return {true, true, false};
+  }
+  return {!shape->isHorizontal(), !shape->isVertical(), true};
+}
+
 DbVia* Connect::generateDbVia(
     const std::vector<std::shared_ptr<ViaGenerator>>& generators,
     odb::dbBlock* block) const
@@ -850,6 +868,8 @@ int Connect::getSplitCut(odb::dbTechLayer* layer) const
 void Connect::clearShapes()
 {
   vias_.clear();
+  via_cache_hits_ = 0;
+  via_cache_misses_ = 0;
   failed_vias_.clear();
 }
 
@@ -902,6 +922,19 @@ void Connect::printViaReport() const
              layer0_->getName(),
              layer1_->getName(),
              report.size());
+  debugPrint(logger,
+             utl::PDN,
+             "Write",
+             1,
+             "Via stacks ({}) from {} -> {}: {} built, {} reused ({:.1f}% hit "
+             "rate)",
+             grid_->getLongName(),
+             layer0_->getName(),
+             layer1_->getName(),
+             via_cache_misses_,
+             via_cache_hits_,
+             100.0 * via_cache_hits_
+                 / std::max(1, via_cache_hits_ + via_cache_misses_));
 
   for (const auto& [via_name, count] : report) {
     debugPrint(logger, utl::PDN, "Write", 2, "Via \"{}\": {}", via_name, count);
@@ -35,6 +35,7 @@
 #include <fstream>
 #include <map>
 #include <set>
+#include <tuple>
 #include <vector>
 
 #include "odb/db.h"
@@ -128,9 +129,13 @@ class Connect
   std::map<odb::dbTechLayer*, int> split_cuts_;
 
   // map of built vias, where the key is the width and height of the via
-  // intersection, and the value points of the associated via stack.
-  using ViaIndex = std::pair<int, int>;
+  // intersection, the fit constraints of the lower and upper shapes and,
+  // when those shapes must fully contain the via, their rects relative to the
+  // via center.  The value points of the associated via stack.
+  using ViaIndex = std::tuple<int, int, int, int, odb::Rect, odb::Rect>;
   std::map<ViaIndex, std::unique_ptr<DbGenerateStackedVia>> vias_;
+  int via_cache_hits_ = 0;
+  int via_cache_misses_ = 0;
   std::vector<odb::dbTechViaGenerateRule*> generate_via_rules_;
   std::vector<odb::dbTechVia*> tech_vias_;
 
@@ -162,6 +167,8 @@ class Connect
 
   int getSplitCut(odb::dbTechLayer* layer) const;
 
+  ViaGenerator::Constraint getShapeConstraint(const ShapePtr& shape) const;
+
   DbVia* generateDbVia(
       const std::vector<std::shared_ptr<ViaGenerator>>& generators,
       odb::dbBlock* block) const;
@@ -39,6 +39,7 @@
 #include "odb/db.h"
 #include "odb/dbShape.h"
 #include "odb/dbTransform.h"
+#include "ord/OpenRoad.hh"
 #include "power_cells.h"
 #include "rings.h"
 #include "straps.h"
@@ -504,7 +505,8 @@ void Grid::getIntersections(std::vector<ViaPtr>& shape_intersections,
     comp->getConnectableShapes(shapes);
   }
 
-  // loop over connect statements
+  // find the connect statements with shapes on both layers
+  std::vector<Connect*> connects;
   for (const auto& connect : connect_) {
     odb::dbTechLayer* lower_layer = connect->getLowerLayer();
     odb::dbTechLayer* upper_layer = connect->getUpperLayer();
@@ -517,9 +519,6 @@ void Grid::getIntersections(std::vector<ViaPtr>& shape_intersections,
       continue;
     }
 
-    const auto& lower_shapes = shapes.at(lower_layer);
-    const auto& upper_shapes = shapes.at(upper_layer);
-
     debugPrint(getLogger(),
                utl::PDN,
                "Via",
@@ -528,9 +527,23 @@ void Grid::getIntersections(std::vector<ViaPtr>& shape_intersections,
                "{} ({} shapes)",
                name_,
                lower_layer->getName(),
-               lower_shapes.size(),
+               shapes.at(lower_layer).size(),
                upper_layer->getName(),
-               upper_shapes.size());
+               shapes.at(upper_layer).size());
+
+    connects.push_back(connect.get());
+  }
+
+  // the layer pairs only read the shape trees, so they are searched in
+  // parallel and their vias appended in the order of the connect statements
+  std::vector<std::vector<ViaPtr>> connect_intersections(connects.size());
+  const int thread_count = ord::OpenRoad::openRoad()->getThreadCount();
+#pragma omp parallel for num_threads(thread_count) schedule(dynamic)
+  for (int i = 0; i < (int) connects.size(); i++) {  // NOLINT
+    Connect* connect = connects[i];
+    const auto& lower_shapes = shapes.at(connect->getLowerLayer());
+    const auto& upper_shapes = shapes.at(connect->getUpperLayer());
+    auto& intersections = connect_intersections[i];
 
     // loop over lower layer shapes
     for (const auto& lower_shape : lower_shapes) {
@@ -552,15 +565,18 @@ void Grid::getIntersections(std::vector<ViaPtr>& shape_intersections,
 
         const odb::Rect via_rect
             = lower_shape->getRect().intersect(upper_shape->getRect());
-        auto* via = new Via(connect.get(),
-                            lower_shape->getNet(),
-                            via_rect,
-                            lower_shape,
-                            upper_shape);
-        shape_intersections.push_back(ViaPtr(via));
+        auto* via = new Via(
+            connect, lower_shape->getNet(), via_rect, lower_shape, upper_shape);
+        intersections.push_back(ViaPtr(via));
       }
     }
   }
+
+  for (auto& intersections : connect_intersections) {
+    shape_intersections.insert(shape_intersections.end(),
+                               std::make_move_iterator(intersections.begin()),
+                               std::make_move_iterator(intersections.end()));
+  }
   debugPrint(getLogger(),
              utl::PDN,
              "Via",
@@ -746,18 +762,32 @@ void Grid::makeVias(const Shape::ShapeTreeMap& global_shapes,
 
   std::set<ViaPtr> remove_vias;
   // remove vias with obstructions in their stack
-  for (const auto& via : vias) {
+  // the obstruction trees are only read here, so the vias are checked in
+  // parallel and marked as failed afterwards
+  std::vector<char> obstructed(vias.size(), false);
+  const int thread_count = ord::OpenRoad::openRoad()->getThreadCount();
+#pragma omp parallel for num_threads(thread_count) schedule(dynamic, 256)
+  for (int i = 0; i < (int) vias.size(); i++) {  // NOLINT
+    const auto& via = vias[i];
     for (auto* layer : via->getConnect()->getIntermediteLayers()) {
-      auto& search_obs = search_obstructions[layer];
-      if (search_obs.qbegin(bgi::intersects(via->getArea())
-                            && bgi::satisfies(obs_filter))
-          != search_obs.qend()) {
-        remove_vias.insert(via);
-        via->markFailed(failedViaReason::OBSTRUCTED);
+      auto search_obs = search_obstructions.find(layer);
+      if (search_obs == search_obstructions.end()) {
+        continue;
+      }
+      if (search_obs->second.qbegin(bgi::intersects(via->getArea())
+                                    && bgi::satisfies(obs_filter))
+          != search_obs->second.qend()) {
+        obstructed[i] = true;
         break;
       }
     }
   }
+  for (int i = 0; i < (int) vias.size(); i++) {  // NOLINT
+    if (obstructed[i]) {
+      remove_vias.insert(vias[i]);
+      vias[i]->markFailed(failedViaReason::OBSTRUCTED);
+    }
+  }
   debugPrint(getLogger(),
              utl::PDN,
              "Via",
@@ -32,87 +32,49 @@
 
 #include "via_repair.h"
 
-#include <boost/polygon/polygon.hpp>
 #include <set>
 
 #include "grid.h"
 #include "odb/db.h"
+#include "odb/dbBlockShapeIndex.h"
 #include "odb/dbShape.h"
 #include "utl/Logger.h"
 #include "via.h"
 
 namespace pdn {
 
-ViaRepair::ViaRepair(utl::Logger* logger, const std::set<odb::dbNet*>& nets)
-    : logger_(logger), nets_(nets)
+ViaRepair::ViaRepair(utl::Logger* logger,
+                     const std::set<odb::dbNet*>& nets,
+                     const odb::dbBlockShapeIndex* shape_index)
+    : logger_(logger), nets_(nets), shape_index_(shape_index)
 {
 }
 
 void ViaRepair::repair()
 {
-  LayerViaTree vias = collectVias();
+  LayerVias vias = collectVias();
   removal_count_.clear();
 
-  ObsRect combined_obs;
-  if (use_obs_) {
-    for (const auto& [layer, obs] :
-         collectBlockObstructions((*nets_.begin())->getBlock())) {
-      combined_obs[layer].insert(obs.begin(), obs.end());
-    }
-  }
-  if (use_nets_) {
-    for (const auto& [layer, obs] :
-         collectInstanceObstructions((*nets_.begin())->getBlock())) {
-      combined_obs[layer].insert(obs.begin(), obs.end());
-    }
-  }
-  if (use_inst_) {
-    for (const auto& [layer, obs] :
-         collectNetObstructions((*nets_.begin())->getBlock())) {
-      combined_obs[layer].insert(obs.begin(), obs.end());
-    }
-  }
-
-  // find via violations
-  using namespace boost::polygon::operators;
-  using Rectangle = boost::polygon::rectangle_data<int>;
-  using Polygon90 = boost::polygon::polygon_90_with_holes_data<int>;
-  using Polygon90Set = boost::polygon::polygon_90_set_data<int>;
-  using Pt = Polygon90::point_type;
-
+  // find via violations by querying the block shape index for each via on
+  // its cut layer
+  std::map<odb::dbInst*, ObsRect> inst_obstructions;
   std::map<odb::dbTechLayer*, std::set<odb::dbSBox*>> tech_vias_to_remove;
   std::map<odb::dbTechLayer*, std::set<odb::dbSBox*>> block_vias_to_remove;
-  for (const auto& [layer, layer_obs] : combined_obs) {
-    Polygon90Set layer_obstructions;
-    for (const auto& obs : layer_obs) {
-      std::array<Pt, 4> pts = {Pt(obs.xMin(), obs.yMin()),
-                               Pt(obs.xMax(), obs.yMin()),
-                               Pt(obs.xMax(), obs.yMax()),
-                               Pt(obs.xMin(), obs.yMax())};
-
-      Polygon90 poly;
-      poly.set(pts.begin(), pts.end());
-      layer_obstructions.insert(poly);
-    }
-
-    std::vector<Rectangle> layer_obstructions_rect;
-    layer_obstructions.get_rectangles(layer_obstructions_rect);
-
-    const auto& layer_vias = vias[layer];
+  for (const auto& [layer, layer_vias] : vias) {
     auto& tech_vias = tech_vias_to_remove[layer];
     auto& block_vias = block_vias_to_remove[layer];
 
-    for (const auto& obs : layer_obstructions_rect) {
-      const odb::Rect obs_rect(xl(obs), yl(obs), xh(obs), yh(obs));
-      for (auto itr = layer_vias.qbegin(bgi::intersects(obs_rect));
-           itr != layer_vias.qend();
-           itr++) {
-        odb::dbSBox* box = itr->second;
-        if (box->getTechVia() != nullptr) {
-          tech_vias.insert(box);
-        } else {
-          block_vias.insert(box);
-        }
+    for (const auto& [via_rect, box] : layer_vias) {
+      if (tech_vias.count(box) != 0 || block_vias.count(box) != 0) {
+        continue;
+      }
+      if (!isObstructed(layer, via_rect, inst_obstructions)) {
+        continue;
+      }
+      if (box->getTechVia() != nullptr) {
+        tech_vias.insert(box);
+      } else {
+        block_vias.insert(box);
       }
     }
   }
@@ -136,9 +98,9 @@ void ViaRepair::repair()
   }
 }
 
-ViaRepair::LayerViaTree ViaRepair::collectVias()
+ViaRepair::LayerVias ViaRepair::collectVias()
 {
-  LayerViaTree vias;
+  LayerVias vias;
   via_count_.clear();
 
   // collect vias
@@ -166,7 +128,7 @@ ViaRepair::LayerViaTree ViaRepair::collectVias()
           wire->getViaXY(x, y);
           for (const auto& obs : TechViaGenerator::getViaObstructionRects(
                    logger_, tech_via, x, y)) {
-            vias[cut_layer].insert({obs, wire});
+            vias[cut_layer].emplace_back(obs, wire);
           }
         } else {
           // TODO: implement generate via
@@ -178,84 +140,78 @@ ViaRepair::LayerViaTree ViaRepair::collectVias()
   return vias;
 }
 
-ViaRepair::ObsRect ViaRepair::collectBlockObstructions(odb::dbBlock* block)
+bool ViaRepair::isObstructed(
+    odb::dbTechLayer* layer,
+    const odb::Rect& rect,
+    std::map<odb::dbInst*, ObsRect>& inst_obstructions) const
 {
-  ObsRect obstructions;
-
-  for (auto* obs : block->getObstructions()) {
-    auto* box = obs->getBBox();
-    if (box->getTechLayer()->getType() != odb::dbTechLayerType::CUT) {
-      continue;
+  if (use_obs_) {
+    std::vector<odb::dbObstruction*> obstructions;
+    shape_index_->queryObstructions(layer, rect, obstructions);
+    if (!obstructions.empty()) {
+      return true;
     }
-    obstructions[box->getTechLayer()].insert(box->getBox());
   }
 
-  return obstructions;
-}
-
-ViaRepair::ObsRect ViaRepair::collectNetObstructions(odb::dbBlock* block)
-{
-  ObsRect obstructions;
-
-  for (auto* net : block->getNets()) {
-    auto* wire = net->getWire();
-    if (wire == nullptr) {
-      continue;
+  if (use_nets_) {
+    // only vias have shapes on cut layers
+    std::vector<odb::dbWire*> wires;
+    shape_index_->queryWires(layer, rect, wires);
+    if (!wires.empty()) {
+      return true;
     }
+  }
 
-    odb::dbWireShapeItr itr;
-    odb::dbShape shape;
-
-    for (itr.begin(wire); itr.next(shape);) {
-      if (!shape.isVia()) {
+  if (use_inst_) {
+    std::vector<odb::dbInst*> insts;
+    shape_index_->queryInsts(rect, insts);
+    for (auto* inst : insts) {
+      auto inst_obs = inst_obstructions.find(inst);
+      if (inst_obs == inst_obstructions.end()) {
+        inst_obs = inst_obstructions
+                       .emplace(inst, collectInstanceObstructions(inst))
+                       .first;
+      }
+      auto layer_obs = inst_obs->second.find(layer);
+      if (layer_obs == inst_obs->second.end()) {
         continue;
       }
-
-      std::vector<odb::dbShape> via_boxes;
-      odb::dbShape::getViaBoxes(shape, via_boxes);
-      for (const auto& via_box : via_boxes) {
-        auto* layer = via_box.getTechLayer();
-        if (layer->getType() != odb::dbTechLayerType::CUT) {
-          continue;
+      for (const auto& obs : layer_obs->second) {
+        if (obs.intersects(rect)) {
+          return true;
         }
-        obstructions[layer].insert(via_box.getBox());
       }
     }
   }
 
-  return obstructions;
+  return false;
 }
 
-ViaRepair::ObsRect ViaRepair::collectInstanceObstructions(odb::dbBlock* block)
+ViaRepair::ObsRect ViaRepair::collectInstanceObstructions(
+    odb::dbInst* inst) const
 {
   ObsRect obstructions;
 
-  for (auto* inst : block->getInsts()) {
-    if (!inst->getPlacementStatus().isPlaced()) {
+  const odb::dbTransform xform = inst->getTransform();
+
+  odb::dbMaster* master = inst->getMaster();
+  for (auto* obs : master->getObstructions()) {
+    auto* layer = obs->getTechLayer();
+    if (layer->getType() != odb::dbTechLayerType::CUT) {
       continue;
     }
+    odb::Rect obs_rect = obs->getBox();
+    xform.apply(obs_rect);
+    obstructions[layer].push_back(obs_rect);
+  }
 
-    const odb::dbTransform xform = inst->getTransform();
-
-    odb::dbMaster* master = inst->getMaster();
-    for (auto* obs : master->getObstructions()) {
-      auto* layer = obs->getTechLayer();
-      if (layer->getType() != odb::dbTechLayerType::CUT) {
-        continue;
-      }
-      odb::Rect obs_rect = obs->getBox();
-      xform.apply(obs_rect);
-      obstructions[layer].insert(obs_rect);
+  for (const auto& [layer, shapes] : InstanceGrid::getInstancePins(inst)) {
+    if (layer->getType() != odb::dbTechLayerType::CUT) {
+      continue;
     }
-
-    for (const auto& [layer, shapes] : InstanceGrid::getInstancePins(inst)) {
-      if (layer->getType() != odb::dbTechLayerType::CUT) {
-        continue;
-      }
-      auto& layer_obs = obstructions[layer];
-      for (const auto& shape : shapes) {
-        layer_obs.insert(shape->getRect());
-      }
+    auto& layer_obs = obstructions[layer];
+    for (const auto& shape : shapes) {
+      layer_obs.push_back(shape->getRect());
     }
   }
 
@@ -34,10 +34,15 @@
 
 #include <map>
 #include <set>
+#include <vector>
 
 #include "odb/db.h"
 #include "shape.h"
 
+namespace odb {
+class dbBlockShapeIndex;
+}
+
 namespace utl {
 class Logger;
 }
@@ -47,11 +52,12 @@ namespace pdn {
 class ViaRepair
 {
   using ViaValue = std::pair<odb::Rect, odb::dbSBox*>;
-  using ViaTree = bgi::rtree<ViaValue, bgi::quadratic<16>>;
-  using LayerViaTree = std::map<odb::dbTechLayer*, ViaTree>;
+  using LayerVias = std::map<odb::dbTechLayer*, std::vector<ViaValue>>;
 
  public:
-  ViaRepair(utl::Logger* logger, const std::set<odb::dbNet*>& nets);
+  ViaRepair(utl::Logger* logger,
+            const std::set<odb::dbNet*>& nets,
+            const odb::dbBlockShapeIndex* shape_index);
 
   void repair();
 
@@ -60,6 +66,7 @@ class ViaRepair
  private:
   utl::Logger* logger_;
   std::set<odb::dbNet*> nets_;
+  const odb::dbBlockShapeIndex* shape_index_;
 
   bool use_obs_ = true;
   bool use_nets_ = true;
@@ -68,13 +75,14 @@ class ViaRepair
   std::map<odb::dbTechLayer*, int> via_count_;
   std::map<odb::dbTechLayer*, int> removal_count_;
 
-  LayerViaTree collectVias();
+  LayerVias collectVias();
 
-  using ObsRect = std::map<odb::dbTechLayer*, std::set<odb::Rect>>;
+  using ObsRect = std::map<odb::dbTechLayer*, std::vector<odb::Rect>>;
 
-  ObsRect collectBlockObstructions(odb::dbBlock* block);
-  ObsRect collectInstanceObstructions(odb::dbBlock* block);
-  ObsRect collectNetObstructions(odb::dbBlock* block);
+  bool isObstructed(odb::dbTechLayer* layer,
+                    const odb::Rect& rect,
+                    std::map<odb::dbInst*, ObsRect>& inst_obstructions) const;
+  ObsRect collectInstanceObstructions(odb::dbInst* inst) const;
 };
 
 }  // namespace pdn
@@ -50,6 +50,7 @@
 #include "ppl/AbstractIOPlacerRenderer.h"
 #include "utl/Logger.h"
 #include "utl/algorithms.h"
+#include "utl/exception.h"
 
 namespace ppl {
 
@@ -2007,9 +2008,19 @@ void IOPlacer::findPinAssignment(std::vector<Section>& sections,
     }
   }
 
-  for (auto& match : hg_vec) {
-    match.findAssignmentForGroups();
+  // The matrices of the sections only read the shared slots and netlist,
+  // so the sections are solved in parallel.
+  const int thread_count = ord::OpenRoad::openRoad()->getThreadCount();
+  utl::ThreadException exception;
+#pragma omp parallel for num_threads(thread_count) schedule(dynamic)
+  for (int i = 0; i < (int) hg_vec.size(); i++) {  // NOLINT
+    try {
+      hg_vec[i].findAssignmentForGroups();
+    } catch (...) {
+      exception.capture();
+    }
   }
+  exception.rethrow();
 
   for (auto& match : hg_vec) {
     match.getAssignmentForGroups(
@@ -2022,8 +2033,9 @@ void IOPlacer::findPinAssignment(std::vector<Section>& sections,
     updateSection(sec, slots);
   }
 
-  for (auto& match : hg_vec) {
-    match.findAssignment();
+#pragma omp parallel for num_threads(thread_count) schedule(dynamic)
+  for (int i = 0; i < (int) hg_vec.size(); i++) {  // NOLINT
+    hg_vec[i].findAssignment();
   }
 
   if (!mirrored_pins_.empty()) {
@@ -2152,12 +2164,14 @@ void IOPlacer::run(bool random_mode)
 void IOPlacer::setAnnealingConfig(float temperature,
                                   int max_iterations,
                                   int perturb_per_iter,
-                                  float alpha)
+                                  float alpha,
+                                  int chains)
 {
   init_temperature_ = temperature;
   max_iterations_ = max_iterations;
   perturb_per_iter_ = perturb_per_iter;
   alpha_ = alpha;
+  annealing_chains_ = std::max(1, chains);
 }
 
 void IOPlacer::setRenderer(
@@ -2204,18 +2218,75 @@ void IOPlacer::runAnnealing(bool random)
   initMirroredPins(true);
   initConstraints(true);
 
-  ppl::SimulatedAnnealing annealing(
-      netlist_io_pins_.get(), core_.get(), slots_, constraints_, logger_, db_);
+  // Independent annealing chains with fixed seeds run in parallel, each on
+  // its own copy of the netlist and slots, and the cheapest one is kept (the
+  // lowest index on ties). The number of chains comes from
+  // set_simulated_annealing -chains, not from the thread count, so the result
+  // does not depend on the number of threads. The first chain works on the
+  // originals, so a single chain gives the same result as before.
+  const int num_chains
+      = (random || isAnnealingDebugOn()) ? 1 : annealing_chains_;
+  const int thread_count = std::max(
+      1, std::min(num_chains, ord::OpenRoad::openRoad()->getThreadCount()));
+  std::vector<std::unique_ptr<Netlist>> chain_netlists(num_chains);
+  std::vector<std::vector<Slot>> chain_slots(num_chains);
+  std::vector<std::unique_ptr<ppl::SimulatedAnnealing>> chains;
+  chains.reserve(num_chains);
+  for (int i = 0; i < num_chains; i++) {
+    Netlist* netlist = netlist_io_pins_.get();
+    std::vector<Slot>* slots = &slots_;
+    if (i > 0) {
+      chain_netlists[i] = std::make_unique<Netlist>(*netlist_io_pins_);
+      chain_slots[i] = slots_;
+      netlist = chain_netlists[i].get();
+      slots = &chain_slots[i];
+    }
+    chains.push_back(std::make_unique<ppl::SimulatedAnnealing>(
+        netlist, core_.get(), *slots, constraints_, logger_, db_));
+  }
 
   if (isAnnealingDebugOn()) {
-    annealing.setDebugOn(std::move(ioplacer_renderer_));
+    chains[0]->setDebugOn(std::move(ioplacer_renderer_));
   }
 
   printConfig(true);
 
-  annealing.run(
-      init_temperature_, max_iterations_, perturb_per_iter_, alpha_, random);
-  annealing.getAssignment(assignment_);
+  std::vector<int64> chain_costs(num_chains);
+  utl::ThreadException exception;
+#pragma omp parallel for num_threads(thread_count) schedule(dynamic)
+  for (int i = 0; i < num_chains; i++) {
+    try {
+      ppl::SimulatedAnnealing& annealing = *chains[i];
+      annealing.setSeed(annealing.getSeed() + i);
+      annealing.run(init_temperature_,
+                    max_iterations_,
+                    perturb_per_iter_,
+                    alpha_,
+                    random);
+      chain_costs[i] = annealing.getAssignmentCost();
+    } catch (...) {
+      exception.capture();
+    }
+  }
+  exception.rethrow();
+
+  const int best_chain
+      = std::min_element(chain_costs.begin(), chain_costs.end())
+        - chain_costs.begin();
+  chains[best_chain]->getAssignment(assignment_);
+  if (best_chain > 0) {
+    *netlist_io_pins_ = *chain_netlists[best_chain];
+    slots_ = chain_slots[best_chain];
+  }
+  if (num_chains > 1) {
+    debugPrint(logger_,
+               utl::PPL,
+               "annealing",
+               1,
+               "Kept annealing chain {} of {}.",
+               best_chain,
+               num_chains);
+  }
 
   for (auto& pin : assignment_) {
     updateOrientation(pin);
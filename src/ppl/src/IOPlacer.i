@@ -327,9 +327,10 @@ void
 set_simulated_annealing(float temperature,
                         int max_iterations,
                         int perturb_per_iter,
-                        float alpha)
+                        float alpha,
+                        int chains)
 {
-  getIOPlacer()->setAnnealingConfig(temperature, max_iterations, perturb_per_iter, alpha);
+  getIOPlacer()->setAnnealingConfig(temperature, max_iterations, perturb_per_iter, alpha, chains);
 }
 
 void
@@ -81,6 +81,10 @@ class SimulatedAnnealing
            float alpha,
            bool random);
   void getAssignment(std::vector<IOPin>& assignment);
+  int64 getAssignmentCost();
+  // Chains with different seeds explore different assignments
+  int getSeed() const { return seed_; }
+  void setSeed(int seed) { seed_ = seed; }
 
   // debug functions
   void setDebugOn(std::unique_ptr<AbstractIOPlacerRenderer> renderer);
@@ -100,7 +104,6 @@ class SimulatedAnnealing
   void randomAssignment();
   int randomAssignmentForGroups(std::set<int>& placed_pins,
                                 const std::vector<int>& slot_indices);
-  int64 getAssignmentCost();
   int getDeltaCost(int prev_cost);
   int getPinCost(int pin_idx);
   int64 getGroupCost(int group_idx);
@@ -160,7 +163,7 @@ class SimulatedAnnealing
   Logger* logger_ = nullptr;
   odb::dbDatabase* db_;
   const int fail_cost_ = std::numeric_limits<int>::max();
-  const int seed_ = 42;
+  int seed_ = 42;
 
   // debug variables
   std::unique_ptr<DebugSettings> debug_;
@@ -18,6 +18,10 @@
 
 using int64 = std::int64_t;
 
+// A shortest augmenting path solver finds assignments of the same cost
+// faster, but it breaks ties between equal-cost matchings differently and
+// so changes the pin placement. This Munkres implementation is kept so
+// that place_pins results stay the same.
 class HungarianAlgorithm
 {
  public:
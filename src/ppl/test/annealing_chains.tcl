@@ -0,0 +1,21 @@
+# annealing with several chains gives the same pin placement with one and
+# four threads
+source "helpers.tcl"
+read_lef Nangate45/Nangate45.lef
+read_def gcd.def
+
+set_simulated_annealing -chains 4
+
+set_thread_count 1
+place_pins -hor_layers metal3 -ver_layers metal2 -corner_avoidance 0 \
+  -min_distance 0.12 -annealing
+set def_file1 [make_result_file annealing_chains_t1.def]
+write_def $def_file1
+
+set_thread_count 4
+place_pins -hor_layers metal3 -ver_layers metal2 -corner_avoidance 0 \
+  -min_distance 0.12 -annealing
+set def_file4 [make_result_file annealing_chains_t4.def]
+write_def $def_file4
+
+diff_files $def_file1 $def_file4
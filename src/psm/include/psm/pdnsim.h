@@ -128,7 +128,10 @@ class PDNSim : public odb::dbBlockCallBackObj
 
   // from dbBlockCallBackObj
   void inDbPostMoveInst(odb::dbInst*) override;
+  void inDbInstSwapMasterAfter(odb::dbInst*) override;
   void inDbNetDestroy(odb::dbNet*) override;
+  void inDbITermPostConnect(odb::dbITerm*) override;
+  void inDbITermPostDisconnect(odb::dbITerm*, odb::dbNet*) override;
   void inDbBTermPostConnect(odb::dbBTerm*) override;
   void inDbBTermPostDisConnect(odb::dbBTerm*, odb::dbNet*) override;
   void inDbBPinDestroy(odb::dbBPin*) override;
@@ -150,6 +153,10 @@ class PDNSim : public odb::dbBlockCallBackObj
   odb::dbNet* findPowerNet(const char* net_name);
 
   IRSolver* getIRSolver(odb::dbNet* net, bool floorplanning);
+  // Edits only invalidate the solvers of the nets they touch, so the
+  // network and factorization of the other nets stay valid.
+  void clearSolver(odb::dbNet* net);
+  void clearSolvers(odb::dbInst* inst);
 
   odb::dbDatabase* db_ = nullptr;
   sta::dbSta* sta_ = nullptr;
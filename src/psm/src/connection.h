@@ -101,6 +101,9 @@ class Connection
   bool compare(const Connection* other) const;
   bool compare(const std::unique_ptr<Connection>& other) const;
 
+  void setID(std::size_t id) { id_ = id; }
+  std::size_t getID() const { return id_; }
+
  protected:
   int getDBUs() const;
 
@@ -112,6 +115,8 @@ class Connection
 
   template <typename T>
   bool hasNodeOfType() const;
+
+  std::size_t id_ = 0;
 };
 
 class LayerConnection : public Connection
@@ -32,6 +32,7 @@
 
 #include "ir_network.h"
 
+#include <algorithm>
 #include <fstream>
 #include <list>
 
@@ -44,8 +45,14 @@
 
 namespace psm {
 
-IRNetwork::IRNetwork(odb::dbNet* net, utl::Logger* logger, bool floorplanning)
-    : net_(net), logger_(logger), floorplanning_(floorplanning)
+IRNetwork::IRNetwork(odb::dbNet* net,
+                     utl::Logger* logger,
+                     bool floorplanning,
+                     int threads)
+    : net_(net),
+      logger_(logger),
+      floorplanning_(floorplanning),
+      threads_(std::max(1, threads))
 {
   if (!net_->getSigType().isSupply()) {
     logger_->error(utl::PSM, 87, "{} is not a supply net.", net_->getName());
@@ -98,6 +105,7 @@ void IRNetwork::reset()
 
   iterm_nodes_.clear();
   bpin_nodes_.clear();
+  node_id_count_ = 0;
 
   recoverMemory();
 }
@@ -134,6 +142,8 @@ void IRNetwork::construct()
     dumpNodes("after_connection_cleanup");
   }
 
+  assignIDs();
+
   if (logger_->debugCheck(utl::PSM, "construct", 1)) {
     reportStats();
   }
@@ -493,64 +503,72 @@ void IRNetwork::generateRoutingLayerShapesAndNodes()
 
   const TerminalTree terminal_nodes = getTerminalTree(terminals);
 
-  // Simplify shapes
-  std::vector<std::pair<odb::dbTechLayer*, Polygon90>> all_poly_shapes;
+  // Simplify shapes, the layers are independent
+  std::vector<std::pair<odb::dbTechLayer*, Polygon90Set*>> layer_shapes;
   for (auto& [layer, shapes] : shapes_by_layer) {
-    const utl::DebugScopedTimer layer_timer(
-        logger_,
-        utl::PSM,
-        "timer",
-        1,
-        fmt::format("Convert shapes to polygons shapes on {}: {{}}",
-                    layer->getName()));
-
-    std::vector<Polygon90> shape_polygons;
-    shapes.get_polygons(shape_polygons);
-
-    debugPrint(logger_,
-               utl::PSM,
-               "timer",
-               1,
-               "Shape reduction on {}: {}",
-               layer->getName(),
-               layer_timer);
+    layer_shapes.emplace_back(layer, &shapes);
+  }
+  std::vector<std::vector<Polygon90>> layer_polygons(layer_shapes.size());
+  const utl::Timer reduction_timer;
+#pragma omp parallel for num_threads(threads_) schedule(dynamic)
+  for (std::size_t i = 0; i < layer_shapes.size(); i++) {
+    layer_shapes[i].second->get_polygons(layer_polygons[i]);
+  }
+  debugPrint(
+      logger_, utl::PSM, "timer", 1, "Shape reduction: {}", reduction_timer);
 
+  std::vector<std::pair<odb::dbTechLayer*, Polygon90>> all_poly_shapes;
+  for (std::size_t i = 0; i < layer_shapes.size(); i++) {
+    auto* layer = layer_shapes[i].first;
     debugPrint(logger_,
                utl::PSM,
                "construct",
                1,
                "Shapes on {}: {} reduced to {}",
                layer->getName(),
-               shapes.size(),
-               shape_polygons.size());
+               layer_shapes[i].second->size(),
+               layer_polygons[i].size());
 
-    for (const auto& shape_poly : shape_polygons) {
+    for (const auto& shape_poly : layer_polygons[i]) {
       all_poly_shapes.emplace_back(layer, shape_poly);
     }
   }
+  layer_polygons.clear();
+  layer_shapes.clear();
   shapes_by_layer.clear();
 
+  // Each thread works on a contiguous run of polygons and the results are
+  // appended in polygon order so the network does not depend on threads_.
   const utl::Timer generate_timer;
-  std::vector<std::unique_ptr<Node>> poly_nodes;
-  std::vector<std::unique_ptr<Shape>> poly_shapes;
-  std::map<Shape*, std::set<Node*>> shape_term_nodes;
-  for (const auto& [layer, shape_poly] : all_poly_shapes) {
-    processPolygonToRectangles(layer,
-                               shape_poly,
-                               terminal_nodes,
-                               poly_shapes,
-                               poly_nodes,
-                               shape_term_nodes);
+  std::vector<std::vector<std::unique_ptr<Node>>> poly_nodes(threads_);
+  std::vector<std::vector<std::unique_ptr<Shape>>> poly_shapes(threads_);
+  std::vector<std::map<Shape*, std::set<Node*>>> shape_term_nodes(threads_);
+#pragma omp parallel for num_threads(threads_) schedule(static, 1)
+  for (int chunk = 0; chunk < threads_; chunk++) {
+    const std::size_t begin = all_poly_shapes.size() * chunk / threads_;
+    const std::size_t end = all_poly_shapes.size() * (chunk + 1) / threads_;
+    for (std::size_t i = begin; i < end; i++) {
+      processPolygonToRectangles(all_poly_shapes[i].first,
+                                 all_poly_shapes[i].second,
+                                 terminal_nodes,
+                                 poly_shapes[chunk],
+                                 poly_nodes[chunk],
+                                 shape_term_nodes[chunk]);
+    }
   }
 
   debugPrint(
       logger_, utl::PSM, "timer", 1, "Shape generation: {}", generate_timer);
 
-  for (auto& node : poly_nodes) {
-    nodes_[node->getLayer()].push_back(std::move(node));
+  for (auto& chunk_nodes : poly_nodes) {
+    for (auto& node : chunk_nodes) {
+      nodes_[node->getLayer()].push_back(std::move(node));
+    }
   }
-  for (auto& shape : poly_shapes) {
-    shapes_[shape->getLayer()].push_back(std::move(shape));
+  for (auto& chunk_shapes : poly_shapes) {
+    for (auto& shape : chunk_shapes) {
+      shapes_[shape->getLayer()].push_back(std::move(shape));
+    }
   }
 
   sortShapes();
@@ -595,7 +613,7 @@ void IRNetwork::generateCutNodesForSBox(
   }
 
   const int min_pitch_
-      = std::min(min_node_pitch_[bottom], min_node_pitch_[top]);
+      = std::min(min_node_pitch_.at(bottom), min_node_pitch_.at(top));
   const bool use_single_via = box->getBox().maxDXDY() < min_pitch_;
 
   if (single_via || use_single_via) {
@@ -668,20 +686,34 @@ void IRNetwork::generateCutLayerNodes()
     }
   }
 
-  std::vector<std::unique_ptr<Node>> loop_via_nodes;
-  std::vector<std::unique_ptr<Connection>> loop_via_connections;
-  for (odb::dbSBox* box : boxes) {
-    generateCutNodesForSBox(
-        box, use_single_via, loop_via_nodes, loop_via_connections);
+  // Split the boxes into contiguous runs so the results can be appended in
+  // box order.
+  std::vector<std::vector<std::unique_ptr<Node>>> loop_via_nodes(threads_);
+  std::vector<std::vector<std::unique_ptr<Connection>>> loop_via_connections(
+      threads_);
+#pragma omp parallel for num_threads(threads_) schedule(static, 1)
+  for (int chunk = 0; chunk < threads_; chunk++) {
+    const std::size_t begin = boxes.size() * chunk / threads_;
+    const std::size_t end = boxes.size() * (chunk + 1) / threads_;
+    for (std::size_t i = begin; i < end; i++) {
+      generateCutNodesForSBox(boxes[i],
+                              use_single_via,
+                              loop_via_nodes[chunk],
+                              loop_via_connections[chunk]);
+    }
   }
   boxes.clear();
 
   LayerMap<std::vector<std::unique_ptr<Node>>> via_nodes;
-  for (auto& node : loop_via_nodes) {
-    via_nodes[node->getLayer()].push_back(std::move(node));
+  for (auto& chunk_nodes : loop_via_nodes) {
+    for (auto& node : chunk_nodes) {
+      via_nodes[node->getLayer()].push_back(std::move(node));
+    }
   }
-  for (auto& connection : loop_via_connections) {
-    connections_.push_back(std::move(connection));
+  for (auto& chunk_connections : loop_via_connections) {
+    for (auto& connection : chunk_connections) {
+      connections_.push_back(std::move(connection));
+    }
   }
   loop_via_nodes.clear();
   loop_via_connections.clear();
@@ -832,6 +864,34 @@ void IRNetwork::sortConnections()
       [](const auto& lhs, const auto& rhs) { return lhs->compare(rhs); });
 }
 
+void IRNetwork::assignIDs()
+{
+  std::vector<Node*> nodes;
+  nodes.reserve(getNodeCount(true) + bpin_nodes_.size());
+  for (const auto& [layer, layer_nodes] : nodes_) {
+    for (const auto& node : layer_nodes) {
+      nodes.push_back(node.get());
+    }
+  }
+  for (const auto& node : iterm_nodes_) {
+    nodes.push_back(node.get());
+  }
+  for (const auto& node : bpin_nodes_) {
+    nodes.push_back(node.get());
+  }
+  std::stable_sort(nodes.begin(), nodes.end(), Node::Compare());
+
+  for (std::size_t id = 0; id < nodes.size(); id++) {
+    nodes[id]->setID(id);
+  }
+  node_id_count_ = nodes.size();
+
+  // connections_ are already sorted
+  for (std::size_t id = 0; id < connections_.size(); id++) {
+    connections_[id]->setID(id);
+  }
+}
+
 int IRNetwork::getEffectiveNumberOfCuts(const odb::dbShape& shape) const
 {
   auto* layer = shape.getTechLayer();
@@ -1118,8 +1178,14 @@ void IRNetwork::connectLayerNodes()
 
   for (const auto& [layer, layer_shapes] : shapes_) {
     const auto layer_nodes = getNodeTree(layer);
-    for (const auto& shape : layer_shapes) {
-      for (auto& conn : shape->connectNodes(layer_nodes)) {
+    std::vector<std::vector<std::unique_ptr<Connection>>> shape_connections(
+        layer_shapes.size());
+#pragma omp parallel for num_threads(threads_) schedule(dynamic, 64)
+    for (std::size_t i = 0; i < layer_shapes.size(); i++) {
+      shape_connections[i] = layer_shapes[i]->connectNodes(layer_nodes);
+    }
+    for (auto& connections : shape_connections) {
+      for (auto& conn : connections) {
         connections_.push_back(std::move(conn));
       }
     }
@@ -1200,7 +1266,7 @@ void IRNetwork::copy(Node* keep,
   remove_connections.shrink_to_fit();
 }
 
-void IRNetwork::dumpNodes(const std::map<Node*, std::size_t>& node_map,
+void IRNetwork::dumpNodes(const std::vector<Node*>& nodes,
                           const std::string& name) const
 {
   const std::string report_file = fmt::format("psm_{}.txt", name);
@@ -1210,27 +1276,21 @@ void IRNetwork::dumpNodes(const std::map<Node*, std::size_t>& node_map,
     return;
   }
 
-  std::map<std::size_t, Node*> nodeidx_map;
-  for (const auto& [node, idx] : node_map) {
-    nodeidx_map[idx] = node;
-  }
-
-  for (const auto& [idx, node] : nodeidx_map) {
-    report << std::to_string(idx) << ": " << node->describe("") << '\n';
+  for (std::size_t idx = 0; idx < nodes.size(); idx++) {
+    report << std::to_string(idx) << ": " << nodes[idx]->describe("") << '\n';
   }
 }
 
 void IRNetwork::dumpNodes(const std::string& name) const
 {
-  std::map<Node*, std::size_t> node_idx;
-  std::size_t idx = 0;
+  std::vector<Node*> nodes;
   for (const auto& [layer, layer_nodes] : nodes_) {
     for (const auto& node : layer_nodes) {
-      node_idx[node.get()] = idx++;
+      nodes.push_back(node.get());
     }
   }
 
-  dumpNodes(node_idx, name);
+  dumpNodes(nodes, name);
 }
 
 bool IRNetwork::belongsTo(Node* node) const
@@ -90,7 +90,10 @@ class IRNetwork
   using Polygon90 = boost::polygon::polygon_90_with_holes_data<int>;
   using Polygon90Set = boost::polygon::polygon_90_set_data<int>;
 
-  IRNetwork(odb::dbNet* net, utl::Logger* logger, bool floorplanning);
+  IRNetwork(odb::dbNet* net,
+            utl::Logger* logger,
+            bool floorplanning,
+            int threads = 1);
 
   odb::dbNet* getNet() const { return net_; };
 
@@ -128,6 +131,8 @@ class IRNetwork
   NodeTree getTopLayerNodeTree() const;
 
   std::size_t getNodeCount(bool include_iterms = false) const;
+  // Node ids run from 0 to getNodeIDCount() - 1 and follow Node::compare
+  std::size_t getNodeIDCount() const { return node_id_count_; }
 
   const std::vector<std::unique_ptr<Connection>>& getConnections() const
   {
@@ -138,7 +143,7 @@ class IRNetwork
   std::map<odb::dbInst*, Node::NodeSet> getInstanceNodeMapping() const;
 
   // For debug only
-  void dumpNodes(const std::map<Node*, std::size_t>& node_map,
+  void dumpNodes(const std::vector<Node*>& nodes,
                  const std::string& name = "nodes") const;
   void dumpNodes(const std::string& name = "nodes") const;
 
@@ -164,6 +169,7 @@ class IRNetwork
   void cleanupInvalidConnections();
   void cleanupDuplicateConnections();
   void sortConnections();
+  void assignIDs();
 
   void removeNodes(std::set<Node*>& removes,
                    odb::dbTechLayer* layer,
@@ -216,6 +222,8 @@ class IRNetwork
 
   bool floorplanning_;
 
+  int threads_;
+
   LayerMap<std::vector<std::unique_ptr<Shape>>> shapes_;
   LayerMap<std::vector<std::unique_ptr<Node>>> nodes_;
 
@@ -224,6 +232,8 @@ class IRNetwork
   std::vector<std::unique_ptr<ITermNode>> iterm_nodes_;
   std::vector<std::unique_ptr<BPinNode>> bpin_nodes_;
 
+  std::size_t node_id_count_ = 0;
+
   std::map<odb::dbTechLayer*, int> min_node_pitch_;
 
   static constexpr int min_node_pitch_multiplier_ = 10;
@@ -33,7 +33,9 @@
 #include "ir_solver.h"
 
 #include <Eigen/SparseLU>
+#include <algorithm>
 #include <fstream>
+#include <limits>
 #include <list>
 #include <queue>
 
@@ -64,7 +66,7 @@ IRSolver::IRSolver(
       logger_(logger),
       resizer_(resizer),
       sta_(sta),
-      network_(new IRNetwork(net_, logger_, floorplanning)),
+      network_(new IRNetwork(net_, logger_, floorplanning, sta->threadCount())),
       gui_(nullptr),
       user_voltages_(user_voltages),
       generated_source_settings_(generated_source_settings)
@@ -352,18 +354,19 @@ Connection::ResistanceMap IRSolver::getResistanceMap(sta::Corner* corner) const
   return resistance;
 }
 
-std::map<Connection*, Connection::Conductance> IRSolver::generateConductanceMap(
+std::vector<Connection::Conductance> IRSolver::generateConductances(
     sta::Corner* corner) const
 {
   const utl::DebugScopedTimer timer(
-      logger_, utl::PSM, "timer", 1, "Generate conductance map: {}");
+      logger_, utl::PSM, "timer", 1, "Generate conductances: {}");
 
   const Connection::ResistanceMap resistance = getResistanceMap(corner);
 
-  std::map<Connection*, Connection::Conductance> conductance;
-  for (const auto& conn : network_->getConnections()) {
+  const auto& connections = network_->getConnections();
+  std::vector<Connection::Conductance> conductance(connections.size());
+  for (const auto& conn : connections) {
     const auto res = conn->getResistance(resistance);
-    conductance[conn.get()] = 1.0 / res;
+    conductance[conn->getID()] = 1.0 / res;
   }
 
   return conductance;
@@ -731,53 +734,71 @@ void IRSolver::buildNodeCurrentMap(sta::Corner* corner,
   }
 }
 
-std::map<Node*, Connection::ConnectionSet> IRSolver::getNodeConnectionMap(
-    const std::map<psm::Connection*, Connection::Conductance>& conductance)
-    const
+IRSolver::RowConnections IRSolver::getRowConnections(
+    const std::vector<std::size_t>& node_rows,
+    std::size_t rows) const
 {
   const utl::DebugScopedTimer timer(
       logger_, utl::PSM, "timer", 1, "Build node/connection mapping: {}");
 
-  std::map<Node*, Connection::ConnectionSet> node_connections;
-  for (const auto& [connection, cond] : conductance) {
-    Node* node0 = connection->getNode0();
-    Node* node1 = connection->getNode1();
+  const auto& connections = network_->getConnections();
 
-    node_connections[node0].insert(connection);
-    node_connections[node1].insert(connection);
+  RowConnections row_connections;
+  auto& offsets = row_connections.offsets;
+  offsets.assign(rows + 1, 0);
+  for (const auto& connection : connections) {
+    offsets[node_rows[connection->getNode0()->getID()] + 1]++;
+    offsets[node_rows[connection->getNode1()->getID()] + 1]++;
+  }
+  for (std::size_t row = 0; row < rows; row++) {
+    offsets[row + 1] += offsets[row];
   }
 
-  return node_connections;
+  // Connections are sorted, so each row keeps them in Connection::compare
+  // order
+  row_connections.connections.resize(offsets[rows]);
+  std::vector<std::size_t> next(offsets.begin(), offsets.end() - 1);
+  for (const auto& connection : connections) {
+    for (Node* node : {connection->getNode0(), connection->getNode1()}) {
+      const std::size_t row = node_rows[node->getID()];
+      row_connections.connections[next[row]++] = connection.get();
+    }
+  }
+
+  return row_connections;
 }
 
-std::map<Node*, std::size_t> IRSolver::assignNodeIDs(const Node::NodeSet& nodes,
-                                                     std::size_t start) const
+std::vector<Node*> IRSolver::assignNodeRows(
+    std::vector<std::size_t>& node_rows) const
 {
-  std::size_t idx = start;
-  std::map<Node*, std::size_t> node_index;
-  for (auto* node : nodes) {
-    node_index[node] = idx++;
+  constexpr std::size_t no_row = std::numeric_limits<std::size_t>::max();
+
+  std::vector<Node*> id_nodes(network_->getNodeIDCount(), nullptr);
+  for (const auto& connection : network_->getConnections()) {
+    for (Node* node : {connection->getNode0(), connection->getNode1()}) {
+      id_nodes[node->getID()] = node;
+    }
   }
-  return node_index;
-}
 
-std::map<Node*, std::size_t> IRSolver::assignNodeIDs(
-    const std::vector<std::unique_ptr<SourceNode>>& nodes,
-    std::size_t start) const
-{
-  Node::NodeSet node_set;
-  for (const auto& node : nodes) {
-    node_set.insert(node.get());
+  std::vector<Node*> row_nodes;
+  node_rows.assign(id_nodes.size(), no_row);
+  for (Node* node : id_nodes) {
+    if (node != nullptr) {
+      node_rows[node->getID()] = row_nodes.size();
+      row_nodes.push_back(node);
+    }
   }
-  return assignNodeIDs(node_set, start);
+
+  return row_nodes;
 }
 
 void IRSolver::buildCondMatrixAndVoltages(
     bool is_ground,
-    const std::map<Node*, Connection::ConnectionSet>& node_connections,
+    const std::vector<Node*>& row_nodes,
+    const RowConnections& row_connections,
     const ValueNodeMap<Current>& currents,
-    const std::map<psm::Connection*, Connection::Conductance>& conductance,
-    const std::map<Node*, std::size_t>& node_index,
+    const std::vector<Connection::Conductance>& conductance,
+    const std::vector<std::size_t>& node_rows,
     Eigen::SparseMatrix<Connection::Conductance>& G,
     Eigen::VectorXd& J) const
 {
@@ -787,8 +808,9 @@ void IRSolver::buildCondMatrixAndVoltages(
   const bool print_progress = logger_->debugCheck(utl::PSM, "progress", 1);
   std::size_t count = 0;
   std::vector<Eigen::Triplet<Connection::Conductance>> cond_values;
-  for (const auto& [node, connections] : node_connections) {
-    const std::size_t node_idx = node_index.at(node);
+  cond_values.reserve(row_connections.connections.size() + row_nodes.size());
+  for (std::size_t node_idx = 0; node_idx < row_nodes.size(); node_idx++) {
+    Node* node = row_nodes[node_idx];
 
     auto find_node = currents.find(node);
     if (find_node == currents.end()) {
@@ -798,19 +820,21 @@ void IRSolver::buildCondMatrixAndVoltages(
     }
 
     Connection::Conductance node_cond = 0.0;
-    for (auto* conn : connections) {
+    for (std::size_t i = row_connections.offsets[node_idx];
+         i < row_connections.offsets[node_idx + 1];
+         i++) {
+      const Connection* conn = row_connections.connections[i];
       Node* other = conn->getOtherNode(node);
-      const std::size_t other_idx = node_index.at(other);
+      const std::size_t other_idx = node_rows[other->getID()];
 
-      const Connection::Conductance cond = conductance.at(conn);
+      const Connection::Conductance cond = conductance[conn->getID()];
       node_cond += cond;
 
       cond_values.emplace_back(node_idx, other_idx, -cond);
     }
     cond_values.emplace_back(node_idx, node_idx, node_cond);
     if (print_progress && count % 1000 == 0) {
-      logger_->report(
-          "Processed nodes: {} of {}", count, node_connections.size());
+      logger_->report("Processed nodes: {} of {}", count, row_nodes.size());
     }
     count++;
   }
@@ -826,7 +850,8 @@ void IRSolver::buildCondMatrixAndVoltages(
 void IRSolver::addSourcesToMatrixAndVoltages(
     Voltage src_voltage,
     const std::vector<std::unique_ptr<psm::SourceNode>>& sources,
-    const std::map<Node*, std::size_t>& node_index,
+    const std::vector<std::size_t>& node_rows,
+    std::size_t first_row,
     Eigen::SparseMatrix<Connection::Conductance>& G,
     Eigen::VectorXd& J) const
 {
@@ -834,14 +859,13 @@ void IRSolver::addSourcesToMatrixAndVoltages(
   constexpr Connection::Resistance src_res = 1.0;
   const Connection::Conductance src_cond = 1.0 / src_res;
 
+  std::size_t idx = first_row;
   for (const auto& src_node : sources) {
-    const std::size_t idx = node_index.at(src_node.get());
-
     J[idx] = src_voltage / src_res;
 
     Node* real_node = src_node->getSource();
 
-    const std::size_t real_node_idx = node_index.at(real_node);
+    const std::size_t real_node_idx = node_rows.at(real_node->getID());
 
     debugPrint(logger_,
                utl::PSM,
@@ -853,6 +877,7 @@ void IRSolver::addSourcesToMatrixAndVoltages(
 
     G.insert(idx, real_node_idx) = src_cond;
     G.insert(real_node_idx, idx) = src_cond;
+    idx++;
   }
 }
 
@@ -873,8 +898,9 @@ void IRSolver::solve(sta::Corner* corner,
 
   voltages.clear();
   currents.clear();
+  em_currents_.erase(corner);
 
-  const auto conductance = generateConductanceMap(corner);
+  const auto conductance = generateConductances(corner);
   debugPrint(logger_,
              utl::PSM,
              "stats",
@@ -886,11 +912,11 @@ void IRSolver::solve(sta::Corner* corner,
     dumpConductance(conductance, "cond");
   }
 
-  const auto node_connections = getNodeConnectionMap(conductance);
-  Node::NodeSet all_nodes;
-  for (const auto& [node, conns] : node_connections) {
-    all_nodes.insert(node);
-  }
+  // Rows of G: the connected network nodes, then the sources
+  std::vector<std::size_t> node_rows;
+  const std::vector<Node*> row_nodes = assignNodeRows(node_rows);
+  const RowConnections row_connections
+      = getRowConnections(node_rows, row_nodes.size());
 
   buildNodeCurrentMap(corner, currents);
 
@@ -898,23 +924,27 @@ void IRSolver::solve(sta::Corner* corner,
   std::vector<std::unique_ptr<SourceNode>> src_nodes;
   Voltage src_voltage
       = generateSourceNodes(source_type, source_file, corner, src_nodes);
-
-  // Solve
-  // create vector of nodes
-  std::map<Node*, std::size_t> node_index = assignNodeIDs(all_nodes);
-  const std::map<Node*, std::size_t> real_node_index = node_index;
-  for (const auto& [node, id] : assignNodeIDs(src_nodes, node_index.size())) {
-    node_index[node] = id;
-  }
-
-  const std::size_t num_nodes = node_index.size();
+  std::stable_sort(src_nodes.begin(),
+                   src_nodes.end(),
+                   [](const auto& lhs, const auto& rhs) {
+                     return lhs->compare(rhs.get());
+                   });
+
+  const std::size_t num_nodes = row_nodes.size() + src_nodes.size();
+  auto dump_nodes = [&]() {
+    std::vector<Node*> nodes = row_nodes;
+    for (const auto& src_node : src_nodes) {
+      nodes.push_back(src_node.get());
+    }
+    network_->dumpNodes(nodes);
+  };
 
   debugPrint(logger_,
              utl::PSM,
              "stats",
              1,
              "Nodes in all nodes: {}",
-             all_nodes.size());
+             row_nodes.size());
   debugPrint(logger_, utl::PSM, "stats", 1, "Nodes in matrix: {}", num_nodes);
 
   // create sparse matrix and vector
@@ -923,37 +953,56 @@ void IRSolver::solve(sta::Corner* corner,
 
   // Build G and J
   buildCondMatrixAndVoltages(src_voltage == 0.0,
-                             node_connections,
+                             row_nodes,
+                             row_connections,
                              currents,
                              conductance,
-                             node_index,
+                             node_rows,
                              G,
                              J);
-  addSourcesToMatrixAndVoltages(src_voltage, src_nodes, node_index, G, J);
-
-  Eigen::SparseLU<Eigen::SparseMatrix<Connection::Conductance>> eigen_solver;
-
-  debugPrint(logger_, utl::PSM, "solve", 1, "Factorizing the G matrix");
-  eigen_solver.compute(G);
-  if (eigen_solver.info() != Eigen::ComputationInfo::Success) {
+  addSourcesToMatrixAndVoltages(
+      src_voltage, src_nodes, node_rows, row_nodes.size(), G, J);
+  G.makeCompressed();
+
+  // The pattern of G only changes with the network, and its values only
+  // change with the corner, so keep whatever factorization work still
+  // applies from the previous solve.
+  const bool same_pattern = hasSameSolverPattern(G);
+  if (!same_pattern) {
+    debugPrint(logger_, utl::PSM, "solve", 1, "Analyzing the G matrix");
+    solver_.analyzePattern(G);
+  }
+  if (!same_pattern || !hasSameSolverValues(G)) {
+    debugPrint(logger_, utl::PSM, "solve", 1, "Factorizing the G matrix");
+    solver_matrix_.reset();
+    solver_.factorize(G);
+    if (solver_.info() == Eigen::ComputationInfo::Success) {
+      solver_matrix_
+          = std::make_unique<Eigen::SparseMatrix<Connection::Conductance>>(G);
+    }
+  } else {
+    debugPrint(
+        logger_, utl::PSM, "solve", 1, "Reusing the G matrix factorization");
+  }
+  if (solver_.info() != Eigen::ComputationInfo::Success) {
     // decomposition failed
     if (logger_->debugCheck(utl::PSM, "dump", 1)) {
-      network_->dumpNodes(node_index);
+      dump_nodes();
       dumpMatrix(G, "G");
     }
     logger_->error(
         utl::PSM,
         10,
         "LU factorization of the G Matrix failed. SparseLU solver message: {}.",
-        eigen_solver.lastErrorMessage());
+        solver_.lastErrorMessage());
   }
 
   debugPrint(logger_, utl::PSM, "solve", 1, "Solving system of equations GV=J");
-  const Eigen::VectorXd V = eigen_solver.solve(J);
-  if (eigen_solver.info() != Eigen::ComputationInfo::Success) {
+  const Eigen::VectorXd V = solver_.solve(J);
+  if (solver_.info() != Eigen::ComputationInfo::Success) {
     // solving failed
     if (logger_->debugCheck(utl::PSM, "dump", 1)) {
-      network_->dumpNodes(node_index);
+      dump_nodes();
       dumpMatrix(G, "G");
       dumpVector(J, "J");
     }
@@ -966,15 +1015,43 @@ void IRSolver::solve(sta::Corner* corner,
              "Solving system of equations GV=J complete");
 
   if (logger_->debugCheck(utl::PSM, "dump", 2)) {
-    network_->dumpNodes(node_index);
+    dump_nodes();
     dumpMatrix(G, "G");
     dumpVector(J, "J");
     dumpVector(V, "V");
   }
-  for (const auto& [node, node_idx] : real_node_index) {
-    voltages[node] = V[node_idx];
+  for (std::size_t node_idx = 0; node_idx < row_nodes.size(); node_idx++) {
+    voltages[row_nodes[node_idx]] = V[node_idx];
   }
   solution_voltages_[corner] = src_voltage;
+
+  em_currents_[corner] = generateEMCurrents(V, node_rows, conductance);
+}
+
+bool IRSolver::hasSameSolverPattern(
+    const Eigen::SparseMatrix<Connection::Conductance>& G) const
+{
+  if (solver_matrix_ == nullptr) {
+    return false;
+  }
+  const auto& prev = *solver_matrix_;
+  if (prev.rows() != G.rows() || prev.cols() != G.cols()
+      || prev.nonZeros() != G.nonZeros()) {
+    return false;
+  }
+  return std::equal(G.outerIndexPtr(),
+                    G.outerIndexPtr() + G.outerSize() + 1,
+                    prev.outerIndexPtr())
+         && std::equal(G.innerIndexPtr(),
+                       G.innerIndexPtr() + G.nonZeros(),
+                       prev.innerIndexPtr());
+}
+
+bool IRSolver::hasSameSolverValues(
+    const Eigen::SparseMatrix<Connection::Conductance>& G) const
+{
+  return std::equal(
+      G.valuePtr(), G.valuePtr() + G.nonZeros(), solver_matrix_->valuePtr());
 }
 
 std::map<odb::dbInst*, IRSolver::Power> IRSolver::getInstancePower(
@@ -1218,23 +1295,11 @@ IRSolver::EMResults IRSolver::getEMSolution(sta::Corner* corner) const
   const utl::DebugScopedTimer timer(
       logger_, utl::PSM, "timer", 1, "EM solution: {}");
 
-  EMResults results;
   if (!hasSolution(corner)) {
-    return results;
+    return EMResults();
   }
 
-  Current total_current = 0.0;
-  for (const auto& [connection, current] : generateCurrentMap(corner)) {
-    results.resistors++;
-    total_current += current;
-    results.max_current = std::max(results.max_current, current);
-  }
-
-  if (results.resistors > 0) {
-    results.avg_current = total_current / results.resistors;
-  }
-
-  return results;
+  return em_currents_.at(corner).results;
 }
 
 std::string IRSolver::getMetricKey(const std::string& key,
@@ -1396,12 +1461,13 @@ void IRSolver::writeEMFile(const std::string& em_file,
   report << "Node0 Layer,Node0 X location,Node0 Y location,Node1 Layer,Node1 X "
             "location,Node1 Y location,Current\n";
 
-  const auto current_map = generateCurrentMap(corner);
-  const std::map<Connection*, Current, Connection::Compare> sorted_current_map(
-      current_map.begin(), current_map.end());
+  // Connections are kept sorted, so the currents are already in report order
+  const auto& em_currents = em_currents_.at(corner);
 
   const double dbus = getBlock()->getDbUnitsPerMicron();
-  for (const auto& [connection, current] : sorted_current_map) {
+  for (std::size_t i = 0; i < em_currents.connections.size(); i++) {
+    const Connection* connection = em_currents.connections[i];
+    const Current current = em_currents.currents[i];
     const Node* node0 = connection->getNode0();
     const Node* node1 = connection->getNode1();
 
@@ -1492,22 +1558,46 @@ void IRSolver::writeSpiceFile(GeneratedSourceType source_type,
   spice << ".END\n\n";
 }
 
-std::map<Connection*, IRSolver::Current> IRSolver::generateCurrentMap(
-    sta::Corner* corner) const
+IRSolver::EMCurrents IRSolver::generateEMCurrents(
+    const Eigen::VectorXd& V,
+    const std::vector<std::size_t>& node_rows,
+    const std::vector<Connection::Conductance>& conductance) const
 {
-  const auto& voltages = voltages_.at(corner);
-  std::map<Connection*, IRSolver::Current> currents;
-  for (const auto& [connection, cond] : generateConductanceMap(corner)) {
-    if (connection->hasITermNode() || connection->hasBPinNode()) {
+  const utl::DebugScopedTimer timer(
+      logger_, utl::PSM, "timer", 1, "EM currents: {}");
+
+  EMCurrents em;
+  for (const auto& conn : network_->getConnections()) {
+    if (conn->hasITermNode() || conn->hasBPinNode()) {
       continue;
     }
+    em.connections.push_back(conn.get());
+  }
 
-    const Voltage node0_v = voltages.at(connection->getNode0());
-    const Voltage node1_v = voltages.at(connection->getNode1());
+  const int resistors = em.connections.size();
+  em.currents.resize(resistors);
+  Current total_current = 0.0;
+  Current max_current = 0.0;
+#pragma omp parallel for num_threads(sta_->threadCount()) \
+    reduction(+ : total_current) reduction(max : max_current)
+  for (int i = 0; i < resistors; i++) {
+    const Connection* connection = em.connections[i];
+    const Voltage node0_v = V[node_rows[connection->getNode0()->getID()]];
+    const Voltage node1_v = V[node_rows[connection->getNode1()->getID()]];
     const Voltage voltage_drop = std::abs(node0_v - node1_v);
-    currents[connection] = voltage_drop * cond;
+    const Current current = voltage_drop * conductance[connection->getID()];
+    em.currents[i] = current;
+    total_current += current;
+    max_current = std::max(max_current, current);
+  }
+
+  em.results.resistors = resistors;
+  em.results.max_current = max_current;
+  if (resistors > 0) {
+    em.results.avg_current = total_current / resistors;
   }
-  return currents;
+
+  return em;
 }
 
 void IRSolver::dumpVector(const Eigen::VectorXd& vector,
@@ -1547,7 +1637,7 @@ void IRSolver::dumpMatrix(
 }
 
 void IRSolver::dumpConductance(
-    const std::map<Connection*, Connection::Conductance>& cond,
+    const std::vector<Connection::Conductance>& cond,
     const std::string& name) const
 {
   const std::string report_file = fmt::format("psm_{}.txt", name);
@@ -1556,14 +1646,14 @@ void IRSolver::dumpConductance(
     logger_->report("Failed to open {} for {}", report_file, name);
     return;
   }
-  const std::map<Connection*, Connection::Conductance, Connection::Compare>
-      sorted_cond(cond.begin(), cond.end());
-
-  for (const auto& [connection, cond] : sorted_cond) {
+  // connections are stored sorted
+  for (const auto& connection : network_->getConnections()) {
     const Node* node0 = connection->getNode0();
     const Node* node1 = connection->getNode1();
-    report << fmt::format(
-        "{} -> {}: {:.15e}", node0->describe(""), node1->describe(""), cond)
+    report << fmt::format("{} -> {}: {:.15e}",
+                          node0->describe(""),
+                          node1->describe(""),
+                          cond[connection->getID()])
            << '\n';
   }
 }
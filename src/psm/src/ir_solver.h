@@ -33,6 +33,7 @@
 #pragma once
 
 #include <Eigen/Sparse>
+#include <Eigen/SparseLU>
 #include <boost/geometry.hpp>
 #include <boost/polygon/polygon.hpp>
 #include <map>
@@ -149,6 +150,23 @@ class IRSolver
   template <typename T>
   using ValueNodeMap = std::map<const Node*, T>;
 
+  // Connections of every row of G, stored flat: row r owns
+  // connections[offsets[r]] up to connections[offsets[r + 1]].
+  struct RowConnections
+  {
+    std::vector<std::size_t> offsets;
+    std::vector<Connection*> connections;
+  };
+
+  // Current of every resistor that does not end on an iterm or bpin node,
+  // stored flat in connection order, with the EM summary of those currents.
+  struct EMCurrents
+  {
+    std::vector<Connection*> connections;
+    std::vector<Current> currents;
+    EMResults results;
+  };
+
   odb::dbBlock* getBlock() const;
   odb::dbTech* getTech() const;
 
@@ -158,9 +176,15 @@ class IRSolver
   std::map<odb::dbInst*, Power> getInstancePower(sta::Corner* corner) const;
   Voltage getPowerNetVoltage(sta::Corner* corner) const;
 
-  std::map<Connection*, Current> generateCurrentMap(sta::Corner* corner) const;
+  // Currents through the resistors of the solved network, from V indexed by
+  // the rows in node_rows.
+  EMCurrents generateEMCurrents(
+      const Eigen::VectorXd& V,
+      const std::vector<std::size_t>& node_rows,
+      const std::vector<Connection::Conductance>& conductance) const;
 
-  std::map<Connection*, Connection::Conductance> generateConductanceMap(
+  // Indexed by connection id
+  std::vector<Connection::Conductance> generateConductances(
       sta::Corner* corner) const;
   Voltage generateSourceNodes(
       GeneratedSourceType source_type,
@@ -187,39 +211,44 @@ class IRSolver
   bool wasNodeVisited(const std::unique_ptr<Node>& node) const;
   bool wasNodeVisited(const Node* node) const;
 
-  std::map<Node*, Connection::ConnectionSet> getNodeConnectionMap(
-      const std::map<psm::Connection*, Connection::Conductance>& conductance)
-      const;
+  RowConnections getRowConnections(const std::vector<std::size_t>& node_rows,
+                                   std::size_t rows) const;
   void buildNodeCurrentMap(sta::Corner* corner,
                            ValueNodeMap<Current>& currents) const;
-  std::map<Node*, std::size_t> assignNodeIDs(const Node::NodeSet& nodes,
-                                             std::size_t start = 0) const;
-  std::map<Node*, std::size_t> assignNodeIDs(
-      const std::vector<std::unique_ptr<SourceNode>>& nodes,
-      std::size_t start = 0) const;
+  // Returns the node of each row of G and fills node_rows (indexed by node
+  // id) with the row of each connected node.
+  std::vector<Node*> assignNodeRows(std::vector<std::size_t>& node_rows) const;
   void buildCondMatrixAndVoltages(
       bool is_ground,
-      const std::map<Node*, Connection::ConnectionSet>& node_connections,
+      const std::vector<Node*>& row_nodes,
+      const RowConnections& row_connections,
       const ValueNodeMap<Current>& currents,
-      const std::map<psm::Connection*, Connection::Conductance>& conductance,
-      const std::map<Node*, std::size_t>& node_index,
+      const std::vector<Connection::Conductance>& conductance,
+      const std::vector<std::size_t>& node_rows,
       Eigen::SparseMatrix<Connection::Conductance>& G,
       Eigen::VectorXd& J) const;
+  // sources take the rows after the network nodes, in order
   void addSourcesToMatrixAndVoltages(
       Voltage src_voltage,
       const std::vector<std::unique_ptr<psm::SourceNode>>& sources,
-      const std::map<Node*, std::size_t>& node_index,
+      const std::vector<std::size_t>& node_rows,
+      std::size_t first_row,
       Eigen::SparseMatrix<Connection::Conductance>& G,
       Eigen::VectorXd& J) const;
 
+  // Callers must check hasSameSolverPattern before hasSameSolverValues.
+  bool hasSameSolverPattern(
+      const Eigen::SparseMatrix<Connection::Conductance>& G) const;
+  bool hasSameSolverValues(
+      const Eigen::SparseMatrix<Connection::Conductance>& G) const;
+
   std::string getMetricKey(const std::string& key, sta::Corner* corner) const;
 
   void dumpVector(const Eigen::VectorXd& vector, const std::string& name) const;
   void dumpMatrix(const Eigen::SparseMatrix<Connection::Conductance>& matrix,
                   const std::string& name) const;
-  void dumpConductance(
-      const std::map<Connection*, Connection::Conductance>& cond,
-      const std::string& name) const;
+  void dumpConductance(const std::vector<Connection::Conductance>& cond,
+                       const std::string& name) const;
 
   odb::dbNet* net_;
 
@@ -242,6 +271,11 @@ class IRSolver
 
   std::map<sta::Corner*, ValueNodeMap<Voltage>> voltages_;
   std::map<sta::Corner*, ValueNodeMap<Current>> currents_;
+  std::map<sta::Corner*, EMCurrents> em_currents_;
+
+  // Factorization of the last G matrix solved and a copy of that matrix
+  Eigen::SparseLU<Eigen::SparseMatrix<Connection::Conductance>> solver_;
+  std::unique_ptr<Eigen::SparseMatrix<Connection::Conductance>> solver_matrix_;
 
   static constexpr Current spice_file_min_current_ = 1e-18;
 };
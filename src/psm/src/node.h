@@ -90,6 +90,9 @@ class Node
   std::string getName() const;
   std::string getTypeName() const;
 
+  void setID(std::size_t id) { id_ = id; }
+  std::size_t getID() const { return id_; }
+
  protected:
   virtual NodeType getType() const { return NodeType::Node; }
 
@@ -100,6 +103,7 @@ class Node
 
   odb::Point pt_;
   odb::dbTechLayer* layer_;
+  std::size_t id_ = 0;
 };
 
 class SourceNode : public Node
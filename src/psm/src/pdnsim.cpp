@@ -225,44 +225,73 @@ void PDNSim::clearSolvers()
   solvers_.clear();
 }
 
-void PDNSim::inDbPostMoveInst(odb::dbInst*)
+void PDNSim::clearSolver(odb::dbNet* net)
 {
-  clearSolvers();
+  if (net != nullptr) {
+    solvers_.erase(net);
+  }
+}
+
+void PDNSim::clearSolvers(odb::dbInst* inst)
+{
+  for (odb::dbITerm* iterm : inst->getITerms()) {
+    clearSolver(iterm->getNet());
+  }
+}
+
+void PDNSim::inDbPostMoveInst(odb::dbInst* inst)
+{
+  clearSolvers(inst);
+}
+
+void PDNSim::inDbInstSwapMasterAfter(odb::dbInst* inst)
+{
+  clearSolvers(inst);
+}
+
+void PDNSim::inDbNetDestroy(odb::dbNet* net)
+{
+  clearSolver(net);
+}
+
+void PDNSim::inDbITermPostConnect(odb::dbITerm* iterm)
+{
+  clearSolver(iterm->getNet());
 }
 
-void PDNSim::inDbNetDestroy(odb::dbNet*)
+void PDNSim::inDbITermPostDisconnect(odb::dbITerm*, odb::dbNet* net)
 {
-  clearSolvers();
+  clearSolver(net);
 }
 
-void PDNSim::inDbBTermPostConnect(odb::dbBTerm*)
+void PDNSim::inDbBTermPostConnect(odb::dbBTerm* bterm)
 {
-  clearSolvers();
+  clearSolver(bterm->getNet());
 }
 
-void PDNSim::inDbBTermPostDisConnect(odb::dbBTerm*, odb::dbNet*)
+void PDNSim::inDbBTermPostDisConnect(odb::dbBTerm*, odb::dbNet* net)
 {
-  clearSolvers();
+  clearSolver(net);
 }
 
-void PDNSim::inDbBPinDestroy(odb::dbBPin*)
+void PDNSim::inDbBPinDestroy(odb::dbBPin* bpin)
 {
-  clearSolvers();
+  clearSolver(bpin->getBTerm()->getNet());
 }
 
-void PDNSim::inDbSWireAddSBox(odb::dbSBox*)
+void PDNSim::inDbSWireAddSBox(odb::dbSBox* sbox)
 {
-  clearSolvers();
+  clearSolver(sbox->getSWire()->getNet());
 }
 
-void PDNSim::inDbSWireRemoveSBox(odb::dbSBox*)
+void PDNSim::inDbSWireRemoveSBox(odb::dbSBox* sbox)
 {
-  clearSolvers();
+  clearSolver(sbox->getSWire()->getNet());
 }
 
-void PDNSim::inDbSWirePostDestroySBoxes(odb::dbSWire*)
+void PDNSim::inDbSWirePostDestroySBoxes(odb::dbSWire* swire)
 {
-  clearSolvers();
+  clearSolver(swire->getNet());
 }
 
 // Functions of decap cells
@@ -118,6 +118,7 @@ class Ext
     int context_depth = 5;
     int cc_model = 10;
     bool lef_res = false;
+    bool incremental = false;
   };
 
   void extract(ExtractOptions options);
@@ -149,7 +150,7 @@ class Ext
     const bool term_junction_xy = false;
     const bool single_pi = false;
     const char* file = nullptr;
-    const bool gz = false;
+    bool gz = false;
     const bool stop_after_map = false;
     const bool w_clock = false;
     const bool w_conn = false;
@@ -33,10 +33,13 @@
 #pragma once
 
 #include <map>
+#include <set>
+#include <vector>
 
 #include "ext2dBox.h"
 #include "extprocess.h"
 #include "odb/db.h"
+#include "odb/dbBlockCallBackObj.h"
 #include "odb/dbExtControl.h"
 #include "odb/dbShape.h"
 #include "odb/odb.h"
@@ -182,11 +185,15 @@ class extDistRCTable
  private:
   void makeCapTableOver();
   void makeCapTableUnder();
+  extDistRC* allocComputeRC(uint n, AthPool<extDistRC>* rcPool);
 
   Ath__array1D<extDistRC*>* _measureTable;
   Ath__array1D<extDistRC*>* _computeTable;
   Ath__array1D<extDistRC*>* _measureTableR[16];
   Ath__array1D<extDistRC*>* _computeTableR[16];  // OPTIMIZE
+  // Storage for each compute table's entries, indexed like the table so
+  // neighboring distances are adjacent in memory.
+  std::vector<std::vector<extDistRC>> _computeRCs;
   int _maxDist;
   uint _distCnt;
   uint _unit;
@@ -1230,6 +1237,31 @@ class extCorner
   extCorner* _extCornerPtr;
 };
 
+// Records the nets whose wires changed after an extraction so that the
+// next incremental extraction only redoes those nets.
+class extNetTracker : public odb::dbBlockCallBackObj
+{
+ public:
+  void track(odb::dbBlock* block);
+  bool isTracking() const { return hasOwner(); }
+  // Changed signal nets ordered by id
+  std::vector<odb::dbNet*> getChangedNets() const;
+  void clear() { _changedNets.clear(); }
+
+  void inDbNetDestroy(odb::dbNet* net) override;
+  void inDbWireCreate(odb::dbWire* wire) override;
+  void inDbWireDestroy(odb::dbWire* wire) override;
+  void inDbWirePostModify(odb::dbWire* wire) override;
+  void inDbWirePostAttach(odb::dbWire* wire) override;
+  void inDbWirePreDetach(odb::dbWire* wire) override;
+
+ private:
+  void addNet(odb::dbNet* net);
+
+  odb::dbBlock* _block = nullptr;
+  std::set<odb::dbNet*> _changedNets;
+};
+
 class extMain
 {
  public:
@@ -1313,6 +1345,13 @@ class extMain
                      int* bb_ur,
                      uint wtype,
                      dbCreateNetUtil* createDbNet = nullptr);
+  // Same as addSignalNets without a createDbNet, but only visits the shapes
+  // of dir collected by initSignalShapes instead of every net's wire.
+  void initSignalShapes(uint dir);
+  uint addSignalShapes(uint dir,
+                       const int* bb_ll,
+                       const int* bb_ur,
+                       uint wtype);
   uint addNets(uint dir,
                int* bb_ll,
                int* bb_ur,
@@ -1452,6 +1491,7 @@ class extMain
   void unlinkRSeg(std::vector<odb::dbNet*>& nets);
   void unlinkCapNode(std::vector<odb::dbNet*>& nets);
   void removeExt(std::vector<odb::dbNet*>& nets);
+  bool getIncrementalNets(std::vector<odb::dbNet*>& nets);
   void removeRSeg(std::vector<odb::dbNet*>& nets);
   void removeCapNode(std::vector<odb::dbNet*>& nets);
   void adjustRC(double resFactor, double ccFactor, double gndcFactor);
@@ -1465,7 +1505,8 @@ class extMain
                        bool mergeViaRes,
                        double ccThres,
                        int contextDepth,
-                       const char* extRules);
+                       const char* extRules,
+                       bool incremental = false);
 
   uint getShortSrcJid(uint jid);
   void make1stRSeg(odb::dbNet* net,
@@ -2022,6 +2063,7 @@ class extMain
   odb::dbBlock* _block = nullptr;
   uint _blockId;
   extSpef* _spef = nullptr;
+  extNetTracker _netTracker;
   bool _writeNameMap = true;
   bool _fullIncrSpef = false;
   bool _noFullIncrSpef = false;
@@ -2214,6 +2256,19 @@ class extMain
   uint _debug_net_id = 0;
   float _previous_percent_extracted = 0;
 
+  struct SearchShape
+  {
+    odb::Rect rect;
+    int lo;  // lower coordinate along the search direction
+    uint level;
+    uint netId;
+    int shapeId;
+  };
+  // Signal wire shapes of one direction in net and shape order, and their
+  // indices sorted by lower coordinate along that direction.
+  std::vector<SearchShape> _signalShapes;
+  std::vector<uint> _signalShapeOrder;
+
   double _minCapTable[64][64];
   double _maxCapTable[64][64];
   double _minResTable[64][64];
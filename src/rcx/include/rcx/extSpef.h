@@ -33,6 +33,7 @@
 #pragma once
 
 #include <map>
+#include <vector>
 
 #include "extRCap.h"
 #include "odb/array1.h"
@@ -303,7 +304,9 @@ class extSpef
   void createName(uint n, const char* name);
   const char* makeName(const char* name);
   odb::dbNet* getDbNet(uint* id, uint spefId = 0);
+  odb::dbNet* findDbNet(uint* id);
   odb::dbInst* getDbInst(uint id);
+  odb::dbInst* findDbInst();
   odb::dbCapNode* createCapNode(uint nodeId, char* capWord = nullptr);
   void addCouplingCaps(odb::dbNet* net, double* totCap);
   void addCouplingCaps(odb::dbSet<odb::dbCCSeg>& capSet, double* totCap);
@@ -388,6 +391,10 @@ class extSpef
   Ath__array1D<uint>* _idMapTable;
   Ath__array1D<const char*>* _nameMapTable = nullptr;
   uint _lastNameMapIndex = 0;
+  // Nets and instances found for each name map id, so the many references
+  // to a mapped name skip the name conversions and block lookups.
+  std::vector<odb::dbNet*> _mapIdNets;
+  std::vector<odb::dbInst*> _mapIdInsts;
 
   uint _cCnt;
   uint _rCnt;
@@ -247,7 +247,8 @@ void Ext::extract(ExtractOptions options)
                         !options.no_merge_via_res,
                         options.coupling_threshold,
                         options.context_depth,
-                        options.ext_model_file);
+                        options.ext_model_file,
+                        options.incremental);
 }
 
 void Ext::adjust_rc(float res_factor, float cc_factor, float gndc_factor)
@@ -70,7 +70,8 @@ extract(const char* ext_model_file,
         int context_depth,
         const char* debug_net_id,
         bool lef_res,
-        bool no_merge_via_res)
+        bool no_merge_via_res,
+        bool incremental)
 {
   Ext* ext = getOpenRCX();
   Ext::ExtractOptions opts;
@@ -84,6 +85,7 @@ extract(const char* ext_model_file,
   opts.lef_res = lef_res;
   opts.debug_net = debug_net_id;
   opts.no_merge_via_res = no_merge_via_res;
+  opts.incremental = incremental;
   
   ext->extract(opts);
 }
@@ -92,13 +94,15 @@ void
 write_spef(const char* file,
            const char* nets,
            int net_id,
-           bool write_coordinates)
+           bool write_coordinates,
+           bool gzip)
 {
   Ext* ext = getOpenRCX();
   Ext::SpefOptions opts;
   opts.file = file;
   opts.nets = nets;
   opts.net_id = net_id;
+  opts.gz = gzip;
   if (write_coordinates) {
     opts.N = "Y";
   }
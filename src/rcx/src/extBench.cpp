@@ -37,6 +37,7 @@
 #include "rcx/extSpef.h"
 #include "rcx/extprocess.h"
 #include "utl/Logger.h"
+#include "utl/timer.h"
 
 namespace rcx {
 
@@ -256,6 +257,12 @@ uint extRCModel::linesOverBench(extMainOptions* opt)
       continue;
     }
 
+    const utl::DebugScopedTimer timer(
+        logger_,
+        RCX,
+        "bench",
+        1,
+        fmt::format("{} M{}: {{}}", _patternName, met));
     measure._met = met;
 
     if (!opt->_db_only) {
@@ -321,6 +328,12 @@ uint extRCModel::linesUnderBench(extMainOptions* opt)
       continue;
     }
 
+    const utl::DebugScopedTimer timer(
+        logger_,
+        RCX,
+        "bench",
+        1,
+        fmt::format("{} M{}: {{}}", _patternName, met));
     measure._met = met;
 
     if (!opt->_db_only) {
@@ -382,6 +395,12 @@ uint extRCModel::linesDiagUnderBench(extMainOptions* opt)
       continue;
     }
 
+    const utl::DebugScopedTimer timer(
+        logger_,
+        RCX,
+        "bench",
+        1,
+        fmt::format("{} M{}: {{}}", _patternName, met));
     measure._met = met;
     if (!opt->_db_only) {
       computeTables(&measure, opt->_wireCnt + 1, 1000, 1000, 1000);
@@ -443,6 +462,12 @@ uint extRCModel::linesOverUnderBench(extMainOptions* opt)
       continue;
     }
 
+    const utl::DebugScopedTimer timer(
+        logger_,
+        RCX,
+        "bench",
+        1,
+        fmt::format("{} M{}: {{}}", _patternName, met));
     measure._met = met;
 
     if (!opt->_db_only) {
@@ -94,19 +94,39 @@ uint extMain::genExtRules(const char* rulesFileName, int pattern)
   int prev_width = 0;
   int n = 0;
 
-  dbSet<dbNet> nets = _block->getNets();
-  dbSet<dbNet>::iterator itr;
-  for (itr = nets.begin(); itr != nets.end(); ++itr) {
-    dbNet* net = *itr;
-    const char* netName = net->getConstName();
-
+  // Gathering the pattern parasitics only reads the db, so do it for all
+  // nets in parallel and build the model serially in net order.
+  struct PatternCaps
+  {
+    uint len = 0;
+    double totCC = 0.0;
+    double totGnd = 0.0;
+    double res = 0.0;
+    double contextCoupling = 0.0;
+  };
+  std::vector<dbNet*> netList;
+  for (dbNet* net : _block->getNets()) {
+    netList.push_back(net);
+  }
+  std::vector<PatternCaps> patternCaps(netList.size());
+#pragma omp parallel for schedule(dynamic)
+  for (int ii = 0; ii < (int) netList.size(); ii++) {
+    dbNet* net = netList[ii];
+    PatternCaps& caps = patternCaps[ii];
     uint wireCnt = 0;
     uint viaCnt = 0;
-    uint len = 0;
     uint layerCnt = 0;
-    uint layerTable[20];
+    net->getNetStats(wireCnt, viaCnt, caps.len, layerCnt, nullptr);
+    caps.totCC = net->getTotalCouplingCap();
+    caps.totGnd = net->getTotalCapacitance();
+    caps.res = net->getTotalResistance();
+    caps.contextCoupling = getTotalCouplingCap(net, "cntxM", 0);
+  }
 
-    net->getNetStats(wireCnt, viaCnt, len, layerCnt, layerTable);
+  for (size_t ii = 0; ii < netList.size(); ii++) {
+    dbNet* net = netList[ii];
+    const PatternCaps& caps = patternCaps[ii];
+    const char* netName = net->getConstName();
 
     uint wcnt = p->mkWords(netName, "_");
     if (wcnt < 5) {
@@ -215,12 +235,12 @@ uint extMain::genExtRules(const char* rulesFileName, int pattern)
     m._s2_m = s2;
     m._s2_nm = lround(m._s2_m * 1000);
 
-    double wLen = GetDBcoords2(len) * 1.0;
-    double totCC = net->getTotalCouplingCap();
-    double totGnd = net->getTotalCapacitance();
-    double res = net->getTotalResistance();
+    double wLen = GetDBcoords2(caps.len) * 1.0;
+    double totCC = caps.totCC;
+    double totGnd = caps.totGnd;
+    double res = caps.res;
 
-    double contextCoupling = getTotalCouplingCap(net, "cntxM", 0);
+    double contextCoupling = caps.contextCoupling;
     if (contextCoupling > 0) {
       totGnd += contextCoupling;
       totCC -= contextCoupling;
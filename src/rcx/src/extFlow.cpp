@@ -30,6 +30,7 @@
 // ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+#include <algorithm>
 #include <map>
 #include <vector>
 
@@ -828,6 +829,96 @@ uint extMain::addSignalNets(uint dir,
   return cnt;
 }
 
+void extMain::initSignalShapes(uint dir)
+{
+  _signalShapes.clear();
+  for (dbNet* net : _block->getNets()) {
+    if ((net->getSigType().isSupply())) {
+      continue;
+    }
+    dbWire* wire = net->getWire();
+    if (wire == nullptr) {
+      continue;
+    }
+    dbWireShapeItr shapes;
+    dbShape s;
+    for (shapes.begin(wire); shapes.next(s);) {
+      if (s.isVia()) {
+        continue;
+      }
+      Rect r = s.getBox();
+      if (!matchDir(dir, r)) {
+        continue;
+      }
+      _signalShapes.push_back({r,
+                               dir == 0 ? r.xMin() : r.yMin(),
+                               s.getTechLayer()->getRoutingLevel(),
+                               net->getId(),
+                               shapes.getShapeId()});
+    }
+  }
+
+  _signalShapeOrder.resize(_signalShapes.size());
+  for (uint ii = 0; ii < _signalShapeOrder.size(); ii++) {
+    _signalShapeOrder[ii] = ii;
+  }
+  std::stable_sort(_signalShapeOrder.begin(),
+                   _signalShapeOrder.end(),
+                   [this](uint a, uint b) {
+                     return _signalShapes[a].lo < _signalShapes[b].lo;
+                   });
+}
+
+uint extMain::addSignalShapes(uint dir,
+                              const int* bb_ll,
+                              const int* bb_ur,
+                              uint wtype)
+{
+  auto lower = [this](uint idx, int coord) {
+    return _signalShapes[idx].lo < coord;
+  };
+  auto begin = std::lower_bound(_signalShapeOrder.begin(),
+                                _signalShapeOrder.end(),
+                                bb_ll[dir],
+                                lower);
+  auto end = std::lower_bound(
+      begin, _signalShapeOrder.end(), bb_ur[dir], lower);
+
+  // Add in net and shape order, as addSignalNets does
+  std::vector<uint> band(begin, end);
+  std::sort(band.begin(), band.end());
+
+  for (uint idx : band) {
+    const SearchShape& shape = _signalShapes[idx];
+    const Rect& r = shape.rect;
+    const uint trackNum = _search->addBox(r.xMin(),
+                                          r.yMin(),
+                                          r.xMax(),
+                                          r.yMax(),
+                                          shape.level,
+                                          shape.netId,
+                                          shape.shapeId,
+                                          wtype);
+    if (shape.netId == _debug_net_id) {
+      debugPrint(logger_,
+                 RCX,
+                 "debug_net",
+                 1,
+                 "\t[Search:W]\tonSearch: tr={} L{}  {} {}  {} {} net {}",
+                 trackNum,
+                 shape.level,
+                 r.xMin(),
+                 r.yMin(),
+                 r.xMax(),
+                 r.yMax(),
+                 shape.netId);
+    }
+  }
+  _search->adjustOverlapMakerEnd();
+
+  return band.size();
+}
+
 void extMain::resetNetSpefFlag(Ath__array1D<uint>* tmpNetIdTable)
 {
   for (uint ii = 0; ii < tmpNetIdTable->getCnt(); ii++) {
@@ -1277,6 +1368,7 @@ uint extMain::couplingFlow(Rect& extRect,
     int gs_limit = ll[dir];
 
     _search->initCouplingCapLoops(dir, ccFlag, coupleAndCompute, m);
+    initSignalShapes(dir);
 
     lo_sdb[dir] = ll[dir] - step_nm[dir];
     int hiXY = ll[dir] + step_nm[dir];
@@ -1311,7 +1403,7 @@ uint extMain::couplingFlow(Rect& extRect,
 
       uint processWireCnt = 0;
       processWireCnt += addPowerNets(dir, lo_sdb, hi_sdb, pwrtype);
-      processWireCnt += addSignalNets(dir, lo_sdb, hi_sdb, sigtype);
+      processWireCnt += addSignalShapes(dir, lo_sdb, hi_sdb, sigtype);
 
       uint extractedWireCnt = 0;
       int extractLimit = hiXY - ccDist * maxPitch;
@@ -1362,6 +1454,10 @@ uint extMain::couplingFlow(Rect& extRect,
   if (_printBandInfo) {
     fclose(bandinfo);
   }
+  _signalShapes.clear();
+  _signalShapes.shrink_to_fit();
+  _signalShapeOrder.clear();
+  _signalShapeOrder.shrink_to_fit();
 
   delete _geomSeq;
   _geomSeq = nullptr;
@@ -217,15 +217,14 @@ uint extDistRCTable::mapExtrapolate(uint loDist,
   uint d2 = rc2->_sep;
 
   for (uint d = d1; d <= d2; d += distUnit) {
-    extDistRC* rc = rcPool->alloc();
+    uint n = d / distUnit;
+    extDistRC* rc = allocComputeRC(n, rcPool);
 
     rc->_sep = d;
     rc->_coupling = rc2->_coupling;
     rc->_fringe = rc2->_fringe;
     rc->_res = rc2->_res;
 
-    uint n = d / distUnit;
-
     _computeTable->set(n, rc);
 
     cnt++;
@@ -248,13 +247,12 @@ uint extDistRCTable::mapInterpolate(extDistRC* rc1,
   }
 
   for (uint d = d1; d <= d2; d += distUnit) {
-    extDistRC* rc = rcPool->alloc();
+    uint n = d / distUnit;
+    extDistRC* rc = allocComputeRC(n, rcPool);
 
     rc->_sep = d;
     rc->interpolate(rc->_sep, rc1, rc2);
 
-    uint n = d / distUnit;
-
     _computeTable->set(n, rc);
 
     cnt++;
@@ -290,6 +288,7 @@ uint extDistRCTable::interpolate(uint distUnit,
   }
 
   makeComputeTable(maxDist, distUnit);
+  _computeRCs.emplace_back(_computeTable->getSize());
 
   mapExtrapolate(0, _measureTable->get(0), distUnit, rcPool);
 
@@ -301,14 +300,26 @@ uint extDistRCTable::interpolate(uint distUnit,
   }
   if (Cnt != cnt) {
     extDistRC* rc1 = _measureTable->get(Cnt);
-    extDistRC* rc = rcPool->alloc();
+    const uint n = _computeTable->getSize() - 1;
+    extDistRC* rc = allocComputeRC(n, rcPool);
     rc->set(rc1->_sep, rc1->_coupling, rc1->_fringe, 0.0, rc1->_res);
-    _computeTable->set(_computeTable->getSize() - 1, rc);
+    _computeTable->set(n, rc);
   }
 
   return _computeTable->getCnt();
 }
 
+extDistRC* extDistRCTable::allocComputeRC(uint n, AthPool<extDistRC>* rcPool)
+{
+  // A distance past the preallocated table (the table grew) falls back to
+  // the pool; a slot written twice reuses its entry.
+  std::vector<extDistRC>& rcs = _computeRCs.back();
+  if (n < rcs.size()) {
+    return &rcs[n];
+  }
+  return rcPool->alloc();
+}
+
 uint extDistRCTable::writeRules(FILE* fp,
                                 Ath__array1D<extDistRC*>* table,
                                 double w,
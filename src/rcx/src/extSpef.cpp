@@ -1251,6 +1251,8 @@ bool extSpef::setOutSpef(const char* filename)
     fprintf(stderr, "Cannot open file %s with permissions \"w\"", filename);
     return false;
   }
+  // net sections are written as many small fprintf calls
+  setvbuf(_outFP, nullptr, _IOFBF, 1 << 20);
   return true;
 }
 
@@ -55,6 +55,19 @@ using odb::dbWirePathShape;
 using utl::RCX;
 
 dbInst* extSpef::getDbInst(const uint id)
+{
+  const bool mapped = id > 0 && id < _mapIdInsts.size();
+  if (mapped && _mapIdInsts[id] != nullptr) {
+    return _mapIdInsts[id];
+  }
+  dbInst* inst = findDbInst();
+  if (mapped) {
+    _mapIdInsts[id] = inst;
+  }
+  return inst;
+}
+
+dbInst* extSpef::findDbInst()
 {
   uint ii = 0;
   const char hierD = _block->getHierarchyDelimeter();
@@ -733,6 +746,20 @@ dbNet* extSpef::getDbNet(uint* id, const uint spefId)
     return nullptr;
   }
 
+  const bool mapped = spefId > 0 && spefId < _mapIdNets.size();
+  if (mapped && _mapIdNets[spefId] != nullptr) {
+    *id = _mapIdNets[spefId]->getId();
+    return _mapIdNets[spefId];
+  }
+  dbNet* net = findDbNet(id);
+  if (mapped) {
+    _mapIdNets[spefId] = net;
+  }
+  return net;
+}
+
+dbNet* extSpef::findDbNet(uint* id)
+{
   const char hierD = _block->getHierarchyDelimeter();
   const char* netName = _spefName;
   const char* nName;
@@ -2142,6 +2169,8 @@ void extSpef::resetNameTable(const uint n)
   _nameMapTable = new Ath__array1D<const char*>(128000);
   _nameMapTable->resize(n);
   _lastNameMapIndex = 0;
+  _mapIdNets.assign(n, nullptr);
+  _mapIdInsts.assign(n, nullptr);
 }
 
 const char* extSpef::makeName(const char* name)
@@ -2157,6 +2186,10 @@ void extSpef::createName(const uint n, const char* name)
   const char* newName = makeName(name);
   _nameMapTable->set(n, newName);
   _lastNameMapIndex = n;
+  if (n < _mapIdNets.size()) {
+    _mapIdNets[n] = nullptr;
+    _mapIdInsts[n] = nullptr;
+  }
 }
 
 void extSpef::addNetNodeHash(dbNet* net)
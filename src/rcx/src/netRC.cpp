@@ -30,6 +30,7 @@
 // ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+#include <algorithm>
 #include <limits>
 #include <map>
 #include <vector>
@@ -1015,6 +1016,96 @@ void extMain::removeExt(std::vector<dbNet*>& nets)
   }
 }
 
+// Collects the nets changed since the last extraction and the nets
+// coupled to them, and destroys their parasitics so they can be redone.
+bool extMain::getIncrementalNets(std::vector<dbNet*>& nets)
+{
+  std::vector<dbNet*> changedNets = _netTracker.getChangedNets();
+  _netTracker.clear();
+  if (changedNets.empty()) {
+    return false;
+  }
+  std::vector<dbNet*> haloNets;
+  _block->getCcHaloNets(changedNets, haloNets);
+  logger_->info(RCX,
+                498,
+                "Incremental extraction of {} changed nets and {} coupled "
+                "nets.",
+                changedNets.size(),
+                haloNets.size());
+
+  nets = std::move(changedNets);
+  nets.insert(nets.end(), haloNets.begin(), haloNets.end());
+  removeExt(nets);
+  return true;
+}
+
+void extNetTracker::track(dbBlock* block)
+{
+  if (block != _block) {
+    removeOwner();
+    addOwner(block);
+    _block = block;
+  }
+  _changedNets.clear();
+}
+
+std::vector<dbNet*> extNetTracker::getChangedNets() const
+{
+  std::vector<dbNet*> nets;
+  for (dbNet* net : _changedNets) {
+    if (!net->getSigType().isSupply()) {
+      nets.push_back(net);
+    }
+  }
+  std::sort(nets.begin(), nets.end(), [](dbNet* a, dbNet* b) {
+    return a->getId() < b->getId();
+  });
+  return nets;
+}
+
+void extNetTracker::addNet(dbNet* net)
+{
+  if (net != nullptr) {
+    _changedNets.insert(net);
+  }
+}
+
+void extNetTracker::inDbNetDestroy(dbNet* net)
+{
+  _changedNets.erase(net);
+  // the nets coupled to a removed net lose their coupling caps
+  std::vector<dbNet*> nets{net};
+  std::vector<dbNet*> haloNets;
+  _block->getCcHaloNets(nets, haloNets);
+  _changedNets.insert(haloNets.begin(), haloNets.end());
+}
+
+void extNetTracker::inDbWireCreate(dbWire* wire)
+{
+  addNet(wire->getNet());
+}
+
+void extNetTracker::inDbWireDestroy(dbWire* wire)
+{
+  addNet(wire->getNet());
+}
+
+void extNetTracker::inDbWirePostModify(dbWire* wire)
+{
+  addNet(wire->getNet());
+}
+
+void extNetTracker::inDbWirePostAttach(dbWire* wire)
+{
+  addNet(wire->getNet());
+}
+
+void extNetTracker::inDbWirePreDetach(dbWire* wire)
+{
+  addNet(wire->getNet());
+}
+
 void extCompute(CoupleOptions& inputTable, void* extModel);
 void extCompute1(CoupleOptions& inputTable, void* extModel);
 
@@ -1715,7 +1806,8 @@ void extMain::makeBlockRCsegs(const char* netNames,
                               bool mergeViaRes,
                               double ccThres,
                               int contextDepth,
-                              const char* extRules)
+                              const char* extRules,
+                              bool incremental)
 {
   uint debugNetId = 0;
 
@@ -1755,7 +1847,15 @@ void extMain::makeBlockRCsegs(const char* netNames,
   }
   _foreign = false;  // extract after read_spef
 
-  _allNet = !((dbBlock*) _block)->findSomeNet(netNames, inets);
+  if (incremental && _netTracker.isTracking()) {
+    if (!getIncrementalNets(inets)) {
+      logger_->info(RCX, 499, "No nets changed since the last extraction.");
+      return;
+    }
+    _allNet = false;
+  } else {
+    _allNet = !((dbBlock*) _block)->findSomeNet(netNames, inets);
+  }
 
   if (_ccContextDepth) {
     initContextArray();
@@ -1941,6 +2041,7 @@ void extMain::makeBlockRCsegs(const char* netNames,
       net->setWireAltered(false);
     }
   }
+  _netTracker.track(_block);
 
   _modelTable->resetCnt(0);
   if (_batchScaleExt) {
@@ -0,0 +1,37 @@
+# read_db_parasitics gives the same timing as a write_spef/read_spef round
+# trip of the extracted parasitics
+source helpers.tcl
+
+read_lef Nangate45/Nangate45.lef
+read_liberty Nangate45/Nangate45_typ.lib
+read_def 45_gcd.def
+create_clock -name clk -period 0.5 [get_ports clk]
+set_propagated_clock [all_clocks]
+
+# Load via resistance info
+source 45_via_resistance.tcl
+
+define_process_corner -ext_model_index 0 X
+extract_parasitics -ext_model_file 45_patterns.rules \
+      -max_res 0 -coupling_threshold 0.1
+
+proc report_timing_to { filename } {
+  sta::redirect_file_begin $filename
+  report_checks -path_delay max -fields {slew cap} -digits 3
+  report_checks -path_delay min -fields {slew cap} -digits 3
+  report_wns -digits 3
+  report_tns -digits 3
+  sta::redirect_file_end
+}
+
+read_db_parasitics
+set db_report [make_result_file db_parasitics_db.rpt]
+report_timing_to $db_report
+
+set spef_file [make_result_file db_parasitics.spef]
+write_spef $spef_file
+read_spef $spef_file
+set spef_report [make_result_file db_parasitics_spef.rpt]
+report_timing_to $spef_report
+
+diff_files $db_report $spef_report
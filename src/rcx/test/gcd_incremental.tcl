@@ -0,0 +1,30 @@
+# extract_parasitics -incremental extracts only the nets changed since the
+# previous extraction and the nets coupled to them
+source helpers.tcl
+
+read_lef sky130hs/sky130hs.tlef
+read_lef sky130hs/sky130hs_std_cell.lef
+read_liberty sky130hs/sky130hs_tt.lib
+
+read_def gcd.def
+
+# Load via resistance info
+source sky130hs/sky130hs.rc
+
+define_process_corner -ext_model_index 0 X
+extract_parasitics -ext_model_file ext_pattern.rules \
+      -max_res 0 -coupling_threshold 0.1
+
+# nothing changed
+extract_parasitics -ext_model_file ext_pattern.rules \
+      -max_res 0 -coupling_threshold 0.1 -incremental
+
+# remove the wire of one net, its coupled nets are extracted again
+set block [ord::get_db_block]
+set net [$block findNet _000_]
+odb::dbWire_destroy [$net getWire]
+extract_parasitics -ext_model_file ext_pattern.rules \
+      -max_res 0 -coupling_threshold 0.1 -incremental
+
+set spef_file [make_result_file gcd_incremental.spef]
+write_spef $spef_file
@@ -19,7 +19,8 @@ def extract_parasitics(
     lef_res=False,
     cc_model=10,
     context_depth=5,
-    no_merge_via_res=False
+    no_merge_via_res=False,
+    incremental=False
 ):
     # NOTE: This is position dependent
     rcx.extract(
@@ -32,11 +33,14 @@ def extract_parasitics(
         debug_net_id,
         lef_res,
         no_merge_via_res,
+        incremental,
     )
 
 
-def write_spef(*, filename="", nets="", net_id=0, coordinates=False):
-    rcx.write_spef(filename, nets, net_id, coordinates)
+def write_spef(
+    *, filename="", nets="", net_id=0, coordinates=False, gzip=False
+):
+    rcx.write_spef(filename, nets, net_id, coordinates, gzip)
 
 
 def bench_verilog(*, filename=""):
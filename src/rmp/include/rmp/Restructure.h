@@ -37,11 +37,15 @@
 
 #include <functional>
 #include <string>
+#include <vector>
 
 #include "db_sta/dbSta.hh"
 #include "rsz/Resizer.hh"
+#include "utl/deleter.h"
 
 namespace abc {
+typedef struct Abc_Frame_t_ Abc_Frame_t;
+typedef struct Abc_Ntk_t_ Abc_Ntk_t;
 }  // namespace abc
 
 namespace utl {
@@ -54,6 +58,7 @@ class dbBlock;
 class dbInst;
 class dbNet;
 class dbITerm;
+class dbMTerm;
 }  // namespace odb
 
 namespace sta {
@@ -62,6 +67,9 @@ class dbSta;
 
 namespace rmp {
 
+class AbcLibrary;
+class LogicCut;
+
 using utl::Logger;
 
 enum class Mode
@@ -86,11 +94,7 @@ class Restructure
             odb::dbDatabase* db,
             rsz::Resizer* resizer);
   void reset();
-  void run(char* liberty_file_name,
-           float slack_threshold,
-           unsigned max_depth,
-           char* workdir_name,
-           char* abc_logfile);
+  void run(float slack_threshold, unsigned max_depth, char* workdir_name);
 
   void setMode(const char* mode_name);
   void setTieLoPort(sta::LibertyPort* loport);
@@ -100,18 +104,23 @@ class Restructure
   void deleteComponents();
   void getBlob(unsigned max_depth);
   void runABC();
+  // Returns the best ABC netlist for the cut, or null if all runs failed.
+  utl::deleted_unique_ptr<abc::Abc_Ntk_t> optimizeCut(LogicCut& cut,
+                                                     AbcLibrary& abc_library,
+                                                     abc::Abc_Frame_t* frame,
+                                                     size_t cut_idx);
   void postABC(float worst_slack);
-  bool writeAbcScript(std::string file_name);
-  void writeOptCommands(std::ofstream& script);
+  std::string makeAbcScript(size_t cut_idx, size_t mode_idx);
+  void writeOptCommands(std::ostream& script);
   void initDB();
   void getEndPoints(sta::PinSet& ends, bool area_mode, unsigned max_depth);
   int countConsts(odb::dbBlock* top_block);
   void removeConstCells();
   void removeConstCell(odb::dbInst* inst);
-  bool readAbcLog(std::string abc_file_name, int& level_gain, float& delay_val);
+  odb::dbMTerm* findTieTerm(const std::string& cell_name,
+                            const std::string& port_name);
 
   Logger* logger_;
-  std::string logfile_;
   std::string locell_;
   std::string loport_;
   std::string hicell_;
@@ -124,10 +133,7 @@ class Restructure
   rsz::Resizer* resizer_;
   odb::dbBlock* block_ = nullptr;
 
-  std::string input_blif_file_name_;
-  std::string output_blif_file_name_;
-  std::vector<std::string> lib_file_names_;
-  std::set<odb::dbInst*> path_insts_;
+  std::vector<sta::Vertex*> end_points_;
 
   Mode opt_mode_;
   bool is_area_mode_;
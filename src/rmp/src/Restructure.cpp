@@ -44,13 +44,17 @@
 #include <iostream>
 #include <sstream>
 
+#include "abc_library_factory.h"
 #include "base/abc/abc.h"
 #include "base/main/abcapis.h"
 #include "db_sta/dbNetwork.hh"
 #include "db_sta/dbSta.hh"
+#include "logic_cut.h"
+#include "logic_extractor.h"
+#include "map/mio/mio.h"
+#include "map/scl/sclLib.h"
 #include "odb/db.h"
 #include "ord/OpenRoad.hh"
-#include "rmp/blif.h"
 #include "sta/Graph.hh"
 #include "sta/Liberty.hh"
 #include "sta/Network.hh"
@@ -63,12 +67,38 @@
 #include "sta/Search.hh"
 #include "sta/Sta.hh"
 #include "utl/Logger.h"
+#include "utl/deleter.h"
+
+// Headers have duplicate declarations so we include
+// forward ones to get at these functions without angering
+// gcc.
+namespace abc {
+Abc_Ntk_t* Abc_FrameReadNtk(Abc_Frame_t* p);
+void Abc_FrameReplaceCurrentNetwork(Abc_Frame_t* p, Abc_Ntk_t* pNet);
+void Abc_FrameSetLibScl(void* pLib);
+}  // namespace abc
 
 using utl::RMP;
 using namespace abc;
 
 namespace rmp {
 
+namespace {
+
+// Starts the global ABC frame and stops it again, freeing everything the
+// frame owns, when the scope is left, also on errors.
+class AbcFrame
+{
+ public:
+  AbcFrame() { Abc_Start(); }
+  ~AbcFrame() { Abc_Stop(); }
+
+  AbcFrame(const AbcFrame&) = delete;
+  AbcFrame& operator=(const AbcFrame&) = delete;
+};
+
+}  // namespace
+
 void Restructure::init(utl::Logger* logger,
                        sta::dbSta* open_sta,
                        odb::dbDatabase* db,
@@ -91,25 +121,20 @@ Restructure::~Restructure()
 
 void Restructure::reset()
 {
-  lib_file_names_.clear();
-  path_insts_.clear();
+  end_points_.clear();
 }
 
-void Restructure::run(char* liberty_file_name,
-                      float slack_threshold,
+void Restructure::run(float slack_threshold,
                       unsigned max_depth,
-                      char* workdir_name,
-                      char* abc_logfile)
+                      char* workdir_name)
 {
   reset();
   block_ = db_->getChip()->getBlock();
   if (!block_)
     return;
 
-  logfile_ = abc_logfile;
   sta::Slack worst_slack = slack_threshold;
 
-  lib_file_names_.emplace_back(liberty_file_name);
   work_dir_name_ = workdir_name;
   work_dir_name_ = work_dir_name_ + "/";
 
@@ -118,7 +143,7 @@ void Restructure::run(char* liberty_file_name,
 
   getBlob(max_depth);
 
-  if (path_insts_.size()) {
+  if (!end_points_.empty()) {
     runABC();
 
     postABC(worst_slack);
@@ -134,33 +159,14 @@ void Restructure::getBlob(unsigned max_depth)
   sta::PinSet ends(open_sta_->getDbNetwork());
 
   getEndPoints(ends, is_area_mode_, max_depth);
-  if (ends.size()) {
-    sta::PinSet boundary_points = !is_area_mode_
-                                      ? resizer_->findFanins(ends)
-                                      : resizer_->findFaninFanouts(ends);
-    // fanin_fanouts.insert(ends.begin(), ends.end()); // Add seq cells
-    logger_->report("Found {} pins in extracted logic.",
-                    boundary_points.size());
-    for (const sta::Pin* pin : boundary_points) {
-      odb::dbITerm* term = nullptr;
-      odb::dbBTerm* port = nullptr;
-      odb::dbModITerm* moditerm = nullptr;
-      odb::dbModBTerm* modbterm = nullptr;
-      open_sta_->getDbNetwork()->staToDb(pin, term, port, moditerm, modbterm);
-      if (term && !term->getInst()->getMaster()->isBlock())
-        path_insts_.insert(term->getInst());
-    }
-    logger_->report("Found {} instances for restructuring.",
-                    path_insts_.size());
+  sta::Graph* graph = open_sta_->graph();
+  for (const sta::Pin* pin : ends) {
+    end_points_.push_back(graph->pinLoadVertex(pin));
   }
 }
 
 void Restructure::runABC()
 {
-  input_blif_file_name_ = work_dir_name_ + std::string(block_->getConstName())
-                          + "_crit_path.blif";
-  std::vector<std::string> files_to_remove;
-
   debugPrint(logger_,
              utl::RMP,
              "remap",
@@ -168,16 +174,101 @@ void Restructure::runABC()
              "Constants before remap {}",
              countConsts(block_));
 
-  Blif blif_(logger_, open_sta_, locell_, loport_, hicell_, hiport_);
-  blif_.setReplaceableInstances(path_insts_);
-  blif_.writeBlif(input_blif_file_name_.c_str(), !is_area_mode_);
-  debugPrint(
-      logger_, RMP, "remap", 1, "Writing blif file {}", input_blif_file_name_);
-  files_to_remove.emplace_back(input_blif_file_name_);
+  sta::dbNetwork* network = open_sta_->getDbNetwork();
+  AbcLibraryFactory factory(logger_);
+  factory.AddDbSta(open_sta_);
+  AbcLibrary abc_library = factory.Build();
+
+  LogicExtractorFactory logic_extractor(open_sta_);
+  for (sta::Vertex* end_point : end_points_) {
+    logic_extractor.AppendEndpoint(end_point);
+  }
+  // In timing mode every critical end point gets its own cut, merged only
+  // with cuts it overlaps, so that each cut stays small. Area mode
+  // optimizes all of the logic as one.
+  std::vector<LogicCut> cuts;
+  if (is_area_mode_) {
+    cuts.push_back(logic_extractor.BuildLogicCut(abc_library));
+  } else {
+    cuts = logic_extractor.BuildNonOverlappingLogicCuts(abc_library);
+  }
+  size_t cut_insts = 0;
+  for (const LogicCut& cut : cuts) {
+    cut_insts += cut.cut_instances().size();
+  }
+  logger_->report("Found {} instances for restructuring in {} cuts.",
+                  cut_insts,
+                  cuts.size());
+  if (cut_insts == 0) {
+    return;
+  }
+
+  // The frame takes over the library and frees it in Abc_Stop, so it must
+  // not be used after the frame is stopped. The cell ids have to be
+  // transferred after the genlib is derived from it. The netlists below
+  // are freed before the frame is stopped.
+  AbcFrame frame;
+  Abc_Frame_t* abc_frame = Abc_FrameGetGlobalFrame();
+  SC_Lib* frame_library = abc_library.TransferOwnership();
+  Abc_FrameSetLibScl(frame_library);
+  Abc_SclInstallGenlib(frame_library, /*Slew=*/0, /*Gain=*/0, /*nGatesMin=*/0);
+  Mio_LibraryTransferCellIds();
+
+  // All cuts are optimized before any of them is written back, as they
+  // refer to the netlist they were extracted from. As the cuts do not
+  // overlap, writing one back leaves the others intact.
+  int replaced = 0;
+  {
+    std::vector<utl::deleted_unique_ptr<Abc_Ntk_t>> netlists;
+    for (size_t cut_idx = 0; cut_idx < cuts.size(); cut_idx++) {
+      netlists.push_back(
+          optimizeCut(cuts[cut_idx], abc_library, abc_frame, cut_idx));
+    }
+
+    odb::dbMTerm* tie_lo = findTieTerm(locell_, loport_);
+    odb::dbMTerm* tie_hi = findTieTerm(hicell_, hiport_);
+    for (size_t cut_idx = 0; cut_idx < cuts.size(); cut_idx++) {
+      if (netlists[cut_idx]) {
+        cuts[cut_idx].InsertMappedAbcNetwork(
+            netlists[cut_idx].get(), network, tie_lo, tie_hi, logger_);
+        replaced++;
+      }
+    }
+  }
+
+  if (replaced == 0) {
+    logger_->info(
+        RMP, 21, "All re-synthesis runs discarded, keeping original netlist.");
+    return;
+  }
+  debugPrint(logger_,
+             utl::RMP,
+             "remap",
+             1,
+             "Replaced {} of {} cuts.",
+             replaced,
+             cuts.size());
+  debugPrint(logger_,
+             utl::RMP,
+             "remap",
+             1,
+             "Number constants after restructure {}.",
+             countConsts(block_));
+}
+
+utl::deleted_unique_ptr<Abc_Ntk_t> Restructure::optimizeCut(
+    LogicCut& cut,
+    AbcLibrary& abc_library,
+    Abc_Frame_t* abc_frame,
+    size_t cut_idx)
+{
+  utl::deleted_unique_ptr<Abc_Ntk_t> best_network(nullptr, &Abc_NtkDelete);
+  if (cut.cut_instances().empty()) {
+    return best_network;
+  }
 
   // abc optimization
   std::vector<Mode> modes;
-  std::vector<pid_t> child_proc;
 
   if (is_area_mode_) {
     // Area Mode
@@ -187,120 +278,71 @@ void Restructure::runABC()
     modes = {Mode::DELAY_1, Mode::DELAY_2, Mode::DELAY_3, Mode::DELAY_4};
   }
 
-  child_proc.resize(modes.size(), 0);
-
-  std::string best_blif;
+  utl::deleted_unique_ptr<Abc_Ntk_t> mapped_network = cut.BuildMappedAbcNetwork(
+      abc_library, open_sta_->getDbNetwork(), logger_);
+  utl::deleted_unique_ptr<Abc_Ntk_t> logic_network(
+      Abc_NtkToLogic(mapped_network.get()), &Abc_NtkDelete);
+  const int start_level = Abc_NtkLevel(logic_network.get());
   int best_inst_count = std::numeric_limits<int>::max();
-  float best_delay_gain = std::numeric_limits<float>::max();
 
   debugPrint(
       logger_, RMP, "remap", 1, "Running ABC with {} modes.", modes.size());
 
+  // ABC keeps its state in the global frame, so the modes run one after
+  // the other, each on its own copy of the cut.
   for (size_t curr_mode_idx = 0; curr_mode_idx < modes.size();
        curr_mode_idx++) {
-    output_blif_file_name_
-        = work_dir_name_ + std::string(block_->getConstName())
-          + std::to_string(curr_mode_idx) + "_crit_path_out.blif";
-
     opt_mode_ = modes[curr_mode_idx];
-
-    const std::string abc_script_file
-        = work_dir_name_ + std::to_string(curr_mode_idx) + "ord_abc_script.tcl";
-    if (logfile_ == "")
-      logfile_ = work_dir_name_ + "abc.log";
-
-    debugPrint(logger_,
-               RMP,
-               "remap",
-               1,
-               "Writing ABC script file {}.",
-               abc_script_file);
-
-    if (writeAbcScript(abc_script_file)) {
-      // call linked abc
-      Abc_Start();
-      Abc_Frame_t* abc_frame = Abc_FrameGetGlobalFrame();
-      const std::string command = "source " + abc_script_file;
-      child_proc[curr_mode_idx]
-          = Cmd_CommandExecute(abc_frame, command.c_str());
-      if (child_proc[curr_mode_idx]) {
-        logger_->error(RMP, 26, "Error executing ABC command {}.", command);
-        return;
+    Abc_FrameReplaceCurrentNetwork(abc_frame, Abc_NtkDup(logic_network.get()));
+
+    std::istringstream script(makeAbcScript(cut_idx, curr_mode_idx));
+    std::string command;
+    bool success = true;
+    while (success && std::getline(script, command)) {
+      if (Cmd_CommandExecute(abc_frame, command.c_str())) {
+        logger_->warn(RMP,
+                      25,
+                      "ABC command {} failed in iteration {}.",
+                      command,
+                      curr_mode_idx);
+        success = false;
       }
-      Abc_Stop();
-      // exit linked abc
-      files_to_remove.emplace_back(abc_script_file);
     }
-  }  // end modes
 
-  // Inspect ABC results to choose blif with least instance count
-  for (int curr_mode_idx = 0; curr_mode_idx < modes.size(); curr_mode_idx++) {
     // Skip failed ABC runs
-    if (child_proc[curr_mode_idx] != 0) {
+    Abc_Ntk_t* result = Abc_FrameReadNtk(abc_frame);
+    if (!success || result == nullptr || !Abc_NtkHasMapping(result)) {
       continue;
     }
 
-    output_blif_file_name_
-        = work_dir_name_ + std::string(block_->getConstName())
-          + std::to_string(curr_mode_idx) + "_crit_path_out.blif";
-    const std::string abc_log_name = logfile_ + std::to_string(curr_mode_idx);
-
-    int level_gain = 0;
-    float delay = std::numeric_limits<float>::max();
-    int num_instances = 0;
-    bool success = readAbcLog(abc_log_name, level_gain, delay);
-    if (success) {
-      success
-          = blif_.inspectBlif(output_blif_file_name_.c_str(), num_instances);
-      logger_->report(
-          "Optimized to {} instances in iteration {} with max path depth "
-          "decrease of {}, delay of {}.",
-          num_instances,
-          curr_mode_idx,
-          level_gain,
-          delay);
-
-      if (success) {
-        if (is_area_mode_) {
-          if (num_instances < best_inst_count) {
-            best_inst_count = num_instances;
-            best_blif = output_blif_file_name_;
-          }
-        } else {
-          // Using only DELAY_4 for delay based gain since other modes not
-          // showing good gains
-          if (modes[curr_mode_idx] == Mode::DELAY_4) {
-            best_delay_gain = delay;
-            best_blif = output_blif_file_name_;
-          }
-        }
+    const int num_instances = Abc_NtkNodeNum(result);
+    const int level_gain = start_level - Abc_NtkLevel(result);
+    logger_->report(
+        "Optimized cut {} to {} instances in iteration {} with max path "
+        "depth decrease of {}.",
+        cut_idx,
+        num_instances,
+        curr_mode_idx,
+        level_gain);
+
+    if (is_area_mode_) {
+      if (num_instances < best_inst_count) {
+        best_inst_count = num_instances;
+        best_network.reset(Abc_NtkDup(result));
+      }
+    } else {
+      // Using only DELAY_4 for delay based gain since other modes not
+      // showing good gains
+      if (modes[curr_mode_idx] == Mode::DELAY_4) {
+        best_network.reset(Abc_NtkDup(result));
       }
     }
-    files_to_remove.emplace_back(output_blif_file_name_);
-  }
-
-  if (best_inst_count < std::numeric_limits<int>::max()
-      || best_delay_gain < std::numeric_limits<float>::max()) {
-    // read back netlist
-    debugPrint(logger_, RMP, "remap", 1, "Reading blif file {}.", best_blif);
-    blif_.readBlif(best_blif.c_str(), block_);
-    debugPrint(logger_,
-               utl::RMP,
-               "remap",
-               1,
-               "Number constants after restructure {}.",
-               countConsts(block_));
-  } else {
-    logger_->info(
-        RMP, 21, "All re-synthesis runs discarded, keeping original netlist.");
-  }
+  }  // end modes
 
-  for (const auto& file_to_remove : files_to_remove) {
-    if (!logger_->debugCheck(RMP, "remap", 1))
-      if (std::remove(file_to_remove.c_str()) != 0) {
-        logger_->error(RMP, 37, "Fail to remove file {}", file_to_remove);
-      }
+  if (best_network) {
+    best_network.reset(Abc_NtkToNetlist(best_network.get()));
   }
+  return best_network;
 }
 
 void Restructure::postABC(float worst_slack)
@@ -323,11 +365,15 @@ void Restructure::getEndPoints(sta::PinSet& ends,
       sta::Path* path = path_ref.path();
       sta::PathExpanded expanded(path, open_sta_);
       // Members in expanded include gate output and net so divide by 2
-      logger_->report("Found path of depth {}", expanded.size() / 2);
+      debugPrint(logger_,
+                 RMP,
+                 "remap",
+                 1,
+                 "Found path of depth {}",
+                 expanded.size() / 2);
       if (expanded.size() / 2 > max_depth) {
+        // Each end point gets a cut of its own to limit blob size for timing
         ends.insert(end_point->pin());
-        // Use only one end point to limit blob size for timing
-        break;
       }
     } else {
       ends.insert(end_point->pin());
@@ -479,42 +525,26 @@ void Restructure::removeConstCell(odb::dbInst* inst)
   odb::dbInst::destroy(inst);
 }
 
-bool Restructure::writeAbcScript(std::string file_name)
+std::string Restructure::makeAbcScript(size_t cut_idx, size_t mode_idx)
 {
-  std::ofstream script(file_name.c_str());
-
-  if (!script.is_open()) {
-    logger_->error(RMP, 20, "Cannot open file {} for writing.", file_name);
-    return false;
-  }
-
-  for (const auto& lib_name : lib_file_names_) {
-    // abc read_lib prints verbose by default, -v toggles to off to avoid read
-    // time being printed
-    std::string read_lib_str = "read_lib -v " + lib_name + "\n";
-    script << read_lib_str;
-  }
-
-  script << "read_blif -n " << input_blif_file_name_ << std::endl;
+  std::ostringstream script;
+  const std::string file_prefix
+      = work_dir_name_ + std::string(block_->getConstName()) + "_cut"
+        + std::to_string(cut_idx) + "_" + std::to_string(mode_idx)
+        + "_crit_path";
 
   if (logger_->debugCheck(RMP, "remap", 1))
-    script << "write_verilog " << input_blif_file_name_ + std::string(".v")
-           << std::endl;
+    script << "write_verilog " << file_prefix << ".v" << std::endl;
 
   writeOptCommands(script);
 
-  script << "write_blif " << output_blif_file_name_ << std::endl;
-
   if (logger_->debugCheck(RMP, "remap", 1))
-    script << "write_verilog " << output_blif_file_name_ + std::string(".v")
-           << std::endl;
+    script << "write_verilog " << file_prefix << "_out.v" << std::endl;
 
-  script.close();
-
-  return true;
+  return script.str();
 }
 
-void Restructure::writeOptCommands(std::ofstream& script)
+void Restructure::writeOptCommands(std::ostream& script)
 {
   std::string choice
       = "alias choice \"fraig_store; resyn2; fraig_store; resyn2; fraig_store; "
@@ -613,67 +643,17 @@ void Restructure::setTieLoPort(sta::LibertyPort* tieLoPort)
   }
 }
 
-bool Restructure::readAbcLog(std::string abc_file_name,
-                             int& level_gain,
-                             float& final_delay)
+odb::dbMTerm* Restructure::findTieTerm(const std::string& cell_name,
+                                       const std::string& port_name)
 {
-  std::ifstream abc_file(abc_file_name);
-  if (abc_file.bad()) {
-    logger_->error(RMP, 16, "cannot open file {}", abc_file_name);
-    return false;
-  }
-  logger_->report("Reading ABC log {}.", abc_file_name);
-  std::string buf;
-  const char delimiter = ' ';
-  bool status = true;
-  std::vector<double> level;
-  std::vector<float> delay;
-
-  // read the file line by line
-  while (std::getline(abc_file, buf)) {
-    // convert the line in to stream:
-    std::istringstream ss(buf);
-    std::vector<std::string> tokens;
-
-    // read the line, word by word
-    while (std::getline(ss, buf, delimiter))
-      tokens.push_back(buf);
-
-    if (!tokens.empty() && tokens[0] == "Error:") {
-      status = false;
-      logger_->warn(RMP,
-                    25,
-                    "ABC run failed, see log file {} for details.",
-                    abc_file_name);
-      break;
-    }
-    if (tokens.size() > 7 && tokens[tokens.size() - 3] == "lev"
-        && tokens[tokens.size() - 2] == "=") {
-      level.emplace_back(std::stoi(tokens[tokens.size() - 1]));
-    }
-    if (tokens.size() > 7) {
-      std::string prev_token = "";
-      for (std::string token : tokens) {
-        if (prev_token == "delay" && token.at(0) == '=') {
-          std::string delay_str = token;
-          if (delay_str.size() > 1) {
-            delay_str.erase(
-                delay_str.begin());  // remove first char which is '='
-            delay.emplace_back(std::stof(delay_str));
-          }
-          break;
-        }
-        prev_token = std::move(token);
-      }
-    }
-  }
+  if (cell_name.empty())
+    return nullptr;
 
-  if (level.size() > 1) {
-    level_gain = level[0] - level[level.size() - 1];
-  }
-  if (delay.size() > 0) {
-    final_delay = delay[delay.size() - 1];  // last value in file
+  for (auto&& lib : block_->getDb()->getLibs()) {
+    odb::dbMaster* master = lib->findMaster(cell_name.c_str());
+    if (master)
+      return master->findMTerm(port_name.c_str());
   }
-  return status;
+  return nullptr;
 }
 }  // namespace rmp
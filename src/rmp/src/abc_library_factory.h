@@ -28,6 +28,14 @@ class AbcLibrary
   }
   ~AbcLibrary() = default;
   abc::SC_Lib* abc_library() { return abc_library_.get(); }
+  // Gives up ownership of the library, e.g. to ABC's global frame which
+  // frees the library it holds itself. abc_library() stays usable for as
+  // long as the new owner keeps the library.
+  abc::SC_Lib* TransferOwnership()
+  {
+    abc_library_.get_deleter() = [](abc::SC_Lib*) {};
+    return abc_library_.get();
+  }
   bool IsSupportedCell(const std::string& cell_name);
 
  private:
@@ -0,0 +1,377 @@
+// Copyright 2024 Google LLC
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file or at
+// https://developers.google.com/open-source/licenses/bsd
+
+#include "logic_cut.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "abc_library_factory.h"
+#include "base/abc/abc.h"
+#include "db_sta/dbNetwork.hh"
+#include "map/mio/mio.h"
+#include "odb/db.h"
+#include "sta/Liberty.hh"
+#include "sta/Network.hh"
+#include "sta/PortDirection.hh"
+#include "utl/Logger.h"
+#include "utl/deleter.h"
+
+// Headers have duplicate declarations so we include
+// a forward one to get at this function without angering
+// gcc.
+namespace abc {
+void* Abc_FrameReadLibGen();
+}
+
+namespace rmp {
+
+// Top level pins have no net of their own, only their term has.
+static sta::Net* PinNet(sta::dbNetwork* network, const sta::Pin* pin)
+{
+  sta::Net* net = network->net(pin);
+  if (net == nullptr) {
+    sta::Term* term = network->term(pin);
+    if (term != nullptr) {
+      net = network->net(term);
+    }
+  }
+  return net;
+}
+
+static odb::dbMaster* FindMaster(odb::dbBlock* block, const char* name)
+{
+  for (odb::dbLib* lib : block->getDb()->getLibs()) {
+    odb::dbMaster* master = lib->findMaster(name);
+    if (master != nullptr) {
+      return master;
+    }
+  }
+  return nullptr;
+}
+
+static odb::dbInst* CreateInstance(odb::dbBlock* block,
+                                   odb::dbMaster* master,
+                                   int& index)
+{
+  std::string name;
+  do {
+    name = "rmp_abc_" + std::to_string(index++);
+  } while (block->findInst(name.c_str()));
+  return odb::dbInst::create(block, master, name.c_str());
+}
+
+static odb::dbNet* CreateNet(odb::dbBlock* block, int& index)
+{
+  std::string name;
+  do {
+    name = "rmp_abc_net_" + std::to_string(index++);
+  } while (block->findNet(name.c_str()));
+  return odb::dbNet::create(block, name.c_str());
+}
+
+static abc::Mio_Library_t* InstalledGateLibrary(utl::Logger* logger)
+{
+  abc::Mio_Library_t* library
+      = static_cast<abc::Mio_Library_t*>(abc::Abc_FrameReadLibGen());
+  if (library == nullptr) {
+    logger->error(utl::RMP, 38, "No gate library is installed in ABC.");
+  }
+  return library;
+}
+
+std::vector<sta::Instance*> LogicCut::SortedCutInstances(
+    sta::dbNetwork* network) const
+{
+  std::vector<sta::Instance*> instances(cut_instances_.begin(),
+                                        cut_instances_.end());
+  std::sort(instances.begin(),
+            instances.end(),
+            [network](const sta::Instance* a, const sta::Instance* b) {
+              return network->id(a) < network->id(b);
+            });
+  return instances;
+}
+
+void LogicCut::GetCutNets(sta::dbNetwork* network,
+                          std::vector<sta::Net*>& input_nets,
+                          std::vector<sta::Net*>& output_nets) const
+{
+  std::vector<sta::Instance*> instances = SortedCutInstances(network);
+
+  std::unordered_set<sta::Net*> driven_nets;
+  for (sta::Instance* instance : instances) {
+    std::unique_ptr<sta::InstancePinIterator> pin_iter(
+        network->pinIterator(instance));
+    while (pin_iter->hasNext()) {
+      sta::Pin* pin = pin_iter->next();
+      sta::Net* net = network->net(pin);
+      if (net != nullptr && network->direction(pin)->isOutput()) {
+        driven_nets.insert(net);
+      }
+    }
+  }
+
+  std::unordered_set<sta::Net*> inputs;
+  for (sta::Instance* instance : instances) {
+    std::unique_ptr<sta::InstancePinIterator> pin_iter(
+        network->pinIterator(instance));
+    while (pin_iter->hasNext()) {
+      sta::Pin* pin = pin_iter->next();
+      sta::Net* net = network->net(pin);
+      if (net != nullptr && network->direction(pin)->isInput()
+          && driven_nets.find(net) == driven_nets.end()
+          && inputs.insert(net).second) {
+        input_nets.push_back(net);
+      }
+    }
+  }
+
+  std::unordered_set<sta::Net*> outputs;
+  for (sta::Pin* pin : primary_outputs_) {
+    sta::Net* net = PinNet(network, pin);
+    if (net != nullptr && driven_nets.find(net) != driven_nets.end()
+        && outputs.insert(net).second) {
+      output_nets.push_back(net);
+    }
+  }
+}
+
+utl::deleted_unique_ptr<abc::Abc_Ntk_t> LogicCut::BuildMappedAbcNetwork(
+    AbcLibrary& abc_library,
+    sta::dbNetwork* network,
+    utl::Logger* logger)
+{
+  abc::Mio_Library_t* library = InstalledGateLibrary(logger);
+
+  std::vector<sta::Net*> input_nets;
+  std::vector<sta::Net*> output_nets;
+  GetCutNets(network, input_nets, output_nets);
+
+  utl::deleted_unique_ptr<abc::Abc_Ntk_t> abc_network(
+      abc::Abc_NtkAlloc(abc::Abc_NtkType_t::ABC_NTK_NETLIST,
+                        abc::Abc_NtkFunc_t::ABC_FUNC_MAP,
+                        /*fUseMemMan=*/1),
+      &abc::Abc_NtkDelete);
+  abc::Abc_NtkSetName(abc_network.get(), strdup("logic_cut"));
+
+  std::unordered_map<sta::Net*, abc::Abc_Obj_t*> abc_nets;
+  auto create_net = [&](sta::Net* net, const std::string& name) {
+    abc::Abc_Obj_t* abc_net = abc::Abc_NtkCreateNet(abc_network.get());
+    std::string net_name = name;
+    abc::Abc_ObjAssignName(abc_net, net_name.data(), /*pSuffix=*/nullptr);
+    if (net != nullptr) {
+      abc_nets[net] = abc_net;
+    }
+    return abc_net;
+  };
+
+  for (sta::Net* net : input_nets) {
+    abc::Abc_Obj_t* input = abc::Abc_NtkCreatePi(abc_network.get());
+    abc::Abc_ObjAddFanin(create_net(net, network->pathName(net)), input);
+  }
+
+  // Drivers first so that every fanin net exists when it is connected.
+  std::vector<sta::Instance*> instances = SortedCutInstances(network);
+  std::vector<std::pair<abc::Abc_Obj_t*, abc::Mio_Gate_t*>> nodes;
+  for (sta::Instance* instance : instances) {
+    const char* cell_name = network->libertyCell(instance)->name();
+    abc::Mio_Gate_t* gate = abc::Mio_LibraryReadGateByName(
+        library, const_cast<char*>(cell_name), /*pOutName=*/nullptr);
+    if (gate == nullptr || !abc_library.IsSupportedCell(cell_name)) {
+      logger->error(utl::RMP,
+                    39,
+                    "Cell {} of instance {} is not in the ABC library.",
+                    cell_name,
+                    network->pathName(instance));
+    }
+    abc::Abc_Obj_t* node = abc::Abc_NtkCreateNode(abc_network.get());
+    abc::Abc_ObjSetData(node, gate);
+    nodes.emplace_back(node, gate);
+
+    sta::Pin* output
+        = network->findPin(instance, abc::Mio_GateReadOutName(gate));
+    sta::Net* net = network->net(output);
+    // A dangling output still needs a net in the netlist.
+    abc::Abc_Obj_t* abc_net = create_net(
+        net, net ? network->pathName(net) : network->pathName(output));
+    abc::Abc_ObjAddFanin(abc_net, node);
+  }
+
+  for (size_t i = 0; i < instances.size(); i++) {
+    auto [node, gate] = nodes[i];
+    for (abc::Mio_Pin_t* pin = abc::Mio_GateReadPins(gate); pin != nullptr;
+         pin = abc::Mio_PinReadNext(pin)) {
+      sta::Pin* input
+          = network->findPin(instances[i], abc::Mio_PinReadName(pin));
+      sta::Net* net = input ? network->net(input) : nullptr;
+      auto abc_net = abc_nets.find(net);
+      if (abc_net == abc_nets.end()) {
+        logger->error(utl::RMP,
+                      40,
+                      "Pin {} of instance {} is not connected.",
+                      abc::Mio_PinReadName(pin),
+                      network->pathName(instances[i]));
+      }
+      abc::Abc_ObjAddFanin(node, abc_net->second);
+    }
+  }
+
+  for (sta::Net* net : output_nets) {
+    abc::Abc_Obj_t* output = abc::Abc_NtkCreatePo(abc_network.get());
+    abc::Abc_ObjAddFanin(output, abc_nets.at(net));
+  }
+
+  return abc_network;
+}
+
+void LogicCut::InsertMappedAbcNetwork(abc::Abc_Ntk_t* abc_network,
+                                      sta::dbNetwork* network,
+                                      odb::dbMTerm* tie_lo,
+                                      odb::dbMTerm* tie_hi,
+                                      utl::Logger* logger)
+{
+  abc::Mio_Library_t* library = InstalledGateLibrary(logger);
+  odb::dbBlock* block = network->block();
+
+  std::vector<sta::Net*> input_nets;
+  std::vector<sta::Net*> output_nets;
+  GetCutNets(network, input_nets, output_nets);
+  if (!abc::Abc_NtkIsNetlist(abc_network)
+      || abc::Abc_NtkPiNum(abc_network) != static_cast<int>(input_nets.size())
+      || abc::Abc_NtkPoNum(abc_network)
+             != static_cast<int>(output_nets.size())) {
+    logger->error(
+        utl::RMP, 41, "ABC network does not match the cut it was built from.");
+  }
+
+  std::unordered_map<abc::Abc_Obj_t*, odb::dbNet*> db_nets;
+  std::unordered_set<odb::dbNet*> boundary_nets;
+  for (size_t i = 0; i < input_nets.size(); i++) {
+    odb::dbNet* net = network->staToDb(input_nets[i]);
+    db_nets[abc::Abc_ObjFanout0(abc::Abc_NtkPi(abc_network, i))] = net;
+    boundary_nets.insert(net);
+  }
+  // ABC may drive several outputs, or an output and an input, from one
+  // net. The outputs keep their nets and get a buffer from the shared one.
+  std::vector<std::pair<abc::Abc_Obj_t*, odb::dbNet*>> buffered_outputs;
+  for (size_t i = 0; i < output_nets.size(); i++) {
+    odb::dbNet* net = network->staToDb(output_nets[i]);
+    abc::Abc_Obj_t* abc_net
+        = abc::Abc_ObjFanin0(abc::Abc_NtkPo(abc_network, i));
+    if (!db_nets.emplace(abc_net, net).second) {
+      buffered_outputs.emplace_back(abc_net, net);
+    }
+    boundary_nets.insert(net);
+  }
+
+  std::unordered_set<odb::dbNet*> cut_nets;
+  for (sta::Instance* instance : cut_instances_) {
+    odb::dbInst* inst = network->staToDb(instance);
+    for (odb::dbITerm* iterm : inst->getITerms()) {
+      odb::dbNet* net = iterm->getNet();
+      if (net != nullptr) {
+        cut_nets.insert(net);
+        iterm->disconnect();
+      }
+    }
+    odb::dbInst::destroy(inst);
+  }
+  for (odb::dbNet* net : cut_nets) {
+    if (boundary_nets.find(net) == boundary_nets.end() && !net->isSpecial()
+        && net->getITerms().empty() && net->getBTerms().empty()) {
+      odb::dbNet::destroy(net);
+    }
+  }
+  cut_instances_.clear();
+  primary_inputs_.clear();
+  primary_outputs_.clear();
+
+  int inst_index = 0;
+  int net_index = 0;
+  auto get_net = [&](abc::Abc_Obj_t* abc_net) {
+    auto net = db_nets.find(abc_net);
+    if (net != db_nets.end()) {
+      return net->second;
+    }
+    odb::dbNet* db_net = CreateNet(block, net_index);
+    db_nets[abc_net] = db_net;
+    return db_net;
+  };
+  auto find_master = [&](abc::Mio_Gate_t* gate) {
+    odb::dbMaster* master = FindMaster(block, abc::Mio_GateReadName(gate));
+    if (master == nullptr) {
+      logger->error(utl::RMP,
+                    42,
+                    "Cannot find master {} of ABC gate.",
+                    abc::Mio_GateReadName(gate));
+    }
+    return master;
+  };
+
+  for (int i = 0; i < abc::Abc_NtkObjNumMax(abc_network); i++) {
+    abc::Abc_Obj_t* node = abc::Abc_NtkObj(abc_network, i);
+    if (node == nullptr || !abc::Abc_ObjIsNode(node)) {
+      continue;
+    }
+    abc::Mio_Gate_t* gate
+        = static_cast<abc::Mio_Gate_t*>(abc::Abc_ObjData(node));
+    odb::dbNet* output = get_net(abc::Abc_ObjFanout0(node));
+
+    // ABC adds constant gates of its own that are not library cells.
+    if (abc::Abc_ObjFaninNum(node) == 0
+        && FindMaster(block, abc::Mio_GateReadName(gate)) == nullptr) {
+      odb::dbMTerm* tie
+          = gate == abc::Mio_LibraryReadConst1(library) ? tie_hi : tie_lo;
+      if (tie == nullptr) {
+        logger->error(utl::RMP,
+                      43,
+                      "No tie cell to implement constant gate {}.",
+                      abc::Mio_GateReadName(gate));
+      }
+      odb::dbInst* inst = CreateInstance(block, tie->getMaster(), inst_index);
+      inst->getITerm(tie)->connect(output);
+      continue;
+    }
+
+    odb::dbMaster* master = find_master(gate);
+    odb::dbInst* inst = CreateInstance(block, master, inst_index);
+    int fanin = 0;
+    for (abc::Mio_Pin_t* pin = abc::Mio_GateReadPins(gate); pin != nullptr;
+         pin = abc::Mio_PinReadNext(pin)) {
+      odb::dbMTerm* mterm = master->findMTerm(abc::Mio_PinReadName(pin));
+      inst->getITerm(mterm)->connect(
+          get_net(abc::Abc_ObjFanin(node, fanin++)));
+    }
+    odb::dbMTerm* mterm = master->findMTerm(abc::Mio_GateReadOutName(gate));
+    inst->getITerm(mterm)->connect(output);
+  }
+
+  if (buffered_outputs.empty()) {
+    return;
+  }
+  abc::Mio_Gate_t* buffer = abc::Mio_LibraryReadBuf(library);
+  if (buffer == nullptr) {
+    logger->error(utl::RMP, 44, "ABC gate library has no buffer.");
+  }
+  odb::dbMaster* master = find_master(buffer);
+  odb::dbMTerm* input
+      = master->findMTerm(abc::Mio_PinReadName(abc::Mio_GateReadPins(buffer)));
+  odb::dbMTerm* output = master->findMTerm(abc::Mio_GateReadOutName(buffer));
+  for (auto [abc_net, net] : buffered_outputs) {
+    odb::dbInst* inst = CreateInstance(block, master, inst_index);
+    inst->getITerm(input)->connect(get_net(abc_net));
+    inst->getITerm(output)->connect(net);
+  }
+}
+
+}  // namespace rmp
@@ -10,10 +10,21 @@
 #include <utility>
 #include <vector>
 
+#include "abc_library_factory.h"
+#include "base/abc/abc.h"
 #include "sta/GraphClass.hh"
 #include "sta/NetworkClass.hh"
+#include "utl/Logger.h"
 #include "utl/deleter.h"
 
+namespace odb {
+class dbMTerm;
+}  // namespace odb
+
+namespace sta {
+class dbNetwork;
+}  // namespace sta
+
 namespace rmp {
 class LogicCut
 {
@@ -48,7 +59,33 @@ class LogicCut
            && cut_instances_.empty();
   }
 
+  // Builds a mapped ABC netlist of the cut. Every net driven from outside
+  // of the cut becomes a primary input and every net leaving it a primary
+  // output, in the order InsertMappedAbcNetwork expects them back. Requires
+  // the library to be installed as ABC's current genlib.
+  utl::deleted_unique_ptr<abc::Abc_Ntk_t> BuildMappedAbcNetwork(
+      AbcLibrary& abc_library,
+      sta::dbNetwork* network,
+      utl::Logger* logger);
+
+  // Replaces the cut instances by the gates of a mapped ABC netlist built
+  // from BuildMappedAbcNetwork. Constant gates without a library cell are
+  // implemented with the tie cells, which may be null if there are none.
+  void InsertMappedAbcNetwork(abc::Abc_Ntk_t* abc_network,
+                              sta::dbNetwork* network,
+                              odb::dbMTerm* tie_lo,
+                              odb::dbMTerm* tie_hi,
+                              utl::Logger* logger);
+
  private:
+  // Nets feeding the cut from outside and nets it drives out, in a
+  // deterministic order.
+  void GetCutNets(sta::dbNetwork* network,
+                  std::vector<sta::Net*>& input_nets,
+                  std::vector<sta::Net*>& output_nets) const;
+  std::vector<sta::Instance*> SortedCutInstances(
+      sta::dbNetwork* network) const;
+
   std::vector<sta::Pin*> primary_inputs_;
   std::vector<sta::Pin*> primary_outputs_;
   std::unordered_set<sta::Instance*> cut_instances_;
@@ -1,6 +1,8 @@
 #include "logic_extractor.h"
 
 #include <memory>
+#include <numeric>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -207,6 +209,73 @@ LogicCut LogicExtractorFactory::BuildLogicCut(AbcLibrary& abc_network)
   open_sta_->ensureLevelized();
 
   std::vector<sta::Vertex*> cut_vertices = GetCutVertices(abc_network);
+  return BuildLogicCutFromVertices(cut_vertices);
+}
+
+std::vector<LogicCut> LogicExtractorFactory::BuildNonOverlappingLogicCuts(
+    AbcLibrary& abc_network)
+{
+  open_sta_->ensureGraph();
+  open_sta_->ensureLevelized();
+
+  // Union find over the endpoints, joining those whose cones meet.
+  std::vector<size_t> group(endpoints_.size());
+  std::iota(group.begin(), group.end(), 0);
+  auto find_group = [&group](size_t i) {
+    while (group[i] != i) {
+      group[i] = group[group[i]];
+      i = group[i];
+    }
+    return i;
+  };
+
+  std::vector<std::vector<sta::Vertex*>> cones;
+  cones.reserve(endpoints_.size());
+  std::unordered_map<sta::Vertex*, size_t> vertex_endpoint;
+  for (size_t i = 0; i < endpoints_.size(); i++) {
+    LogicExtractorFactory cone_extractor(open_sta_);
+    cone_extractor.AppendEndpoint(endpoints_[i]);
+    cones.push_back(cone_extractor.GetCutVertices(abc_network));
+    for (sta::Vertex* vertex : cones.back()) {
+      auto [owner, inserted] = vertex_endpoint.emplace(vertex, i);
+      if (!inserted) {
+        group[find_group(i)] = find_group(owner->second);
+      }
+    }
+  }
+
+  // Groups are ordered by their first endpoint.
+  std::vector<size_t> group_cut(endpoints_.size(), endpoints_.size());
+  std::vector<LogicExtractorFactory> group_extractors;
+  std::vector<std::vector<sta::Vertex*>> group_vertices;
+  for (size_t i = 0; i < endpoints_.size(); i++) {
+    size_t& cut = group_cut[find_group(i)];
+    if (cut == endpoints_.size()) {
+      cut = group_extractors.size();
+      group_extractors.emplace_back(open_sta_);
+      group_vertices.emplace_back();
+    }
+    group_extractors[cut].AppendEndpoint(endpoints_[i]);
+    for (sta::Vertex* vertex : cones[i]) {
+      // Only the first endpoint reaching a vertex lists it.
+      if (vertex_endpoint[vertex] == i) {
+        group_vertices[cut].push_back(vertex);
+      }
+    }
+  }
+
+  std::vector<LogicCut> cuts;
+  cuts.reserve(group_extractors.size());
+  for (size_t cut = 0; cut < group_extractors.size(); cut++) {
+    cuts.push_back(
+        group_extractors[cut].BuildLogicCutFromVertices(group_vertices[cut]));
+  }
+  return cuts;
+}
+
+LogicCut LogicExtractorFactory::BuildLogicCutFromVertices(
+    std::vector<sta::Vertex*>& cut_vertices)
+{
   std::vector<sta::Pin*> primary_inputs = GetPrimaryInputs(cut_vertices);
   std::vector<sta::Pin*> primary_outputs = GetPrimaryOutputs(cut_vertices);
   std::unordered_set<sta::Instance*> cut_instances
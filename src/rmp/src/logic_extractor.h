@@ -48,8 +48,13 @@ class LogicExtractorFactory
   LogicExtractorFactory(sta::dbSta* open_sta) : open_sta_(open_sta) {}
   LogicExtractorFactory& AppendEndpoint(sta::Vertex* vertex);
   LogicCut BuildLogicCut(AbcLibrary& abc_network);
+  // Builds a cut per group of endpoints whose fanin cones share a vertex.
+  // The cuts have no instances in common and none of them feeds another,
+  // so each one can be replaced without invalidating the rest.
+  std::vector<LogicCut> BuildNonOverlappingLogicCuts(AbcLibrary& abc_network);
 
  private:
+  LogicCut BuildLogicCutFromVertices(std::vector<sta::Vertex*>& cut_vertices);
   // Process vertificies from BFS STA output to find the primary inputs.
   std::vector<sta::Pin*> GetPrimaryInputs(
       std::vector<sta::Vertex*>& cut_vertices);
@@ -73,12 +73,11 @@ void set_tiehi_port_cmd(LibertyPort* tieHiport)
 }
 
 void
-restructure_cmd(char* liberty_file_name, char* target, float slack_threshold,
-                int depth_threshold, char* workdir_name, char* abc_logfile)
+restructure_cmd(char* target, float slack_threshold, int depth_threshold,
+                char* workdir_name)
 {
   getRestructure()->setMode(target);
-  getRestructure()->run(liberty_file_name, slack_threshold, depth_threshold,
-                        workdir_name, abc_logfile);
+  getRestructure()->run(slack_threshold, depth_threshold, workdir_name);
 }
 
 // Locally Exposed for testing only..
@@ -56,8 +56,6 @@ sta::define_cmd_args "restructure" { \
                                       [-slack_threshold slack]\
                                       [-depth_threshold depth]\
                                       [-target area|timing]\
-                                      [-abc_logfile logfile]\
-                                      [-liberty_file liberty_file]\
                                       [-tielo_port tielow_port]\
                                       [-tiehi_port tiehigh_port]\
                                       [-work_dir workdir_name]
@@ -73,7 +71,6 @@ proc restructure { args } {
   set depth_threshold_value 16
   set target "area"
   set workdir_name "."
-  set abc_logfile ""
 
   if { [info exists keys(-slack_threshold)] } {
     set slack_threshold_value $keys(-slack_threshold)
@@ -88,13 +85,12 @@ proc restructure { args } {
   }
 
   if { [info exists keys(-abc_logfile)] } {
-    set abc_logfile $keys(-abc_logfile)
+    utl::warn RMP 45 "-abc_logfile is deprecated."
   }
 
   if { [info exists keys(-liberty_file)] } {
-    set liberty_file_name $keys(-liberty_file)
-  } else {
-    utl::error RMP 12 "Missing argument -liberty_file"
+    utl::warn RMP 46 "-liberty_file is deprecated. The libraries loaded in\
+      STA are used."
   }
 
   if { [info exists keys(-tielo_port)] } {
@@ -133,6 +129,6 @@ proc restructure { args } {
     set workdir_name $keys(-work_dir)
   }
 
-  rmp::restructure_cmd $liberty_file_name $target $slack_threshold_value \
-    $depth_threshold_value $workdir_name $abc_logfile
+  rmp::restructure_cmd $target $slack_threshold_value \
+    $depth_threshold_value $workdir_name
 }
@@ -23,9 +23,11 @@
 #include "db_sta/dbSta.hh"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
+#include "logic_cut.h"
 #include "logic_extractor.h"
 #include "map/mio/mio.h"
 #include "map/scl/sclLib.h"
+#include "odb/db.h"
 #include "odb/lefin.h"
 #include "sta/FuncExpr.hh"
 #include "sta/Graph.hh"
@@ -359,4 +361,122 @@ TEST_F(AbcTest, ExtractSideOutputsCorrectly)
   EXPECT_THAT(primary_output_names, Contains("output_flop/D"));
   EXPECT_THAT(primary_output_names, Contains("output_flop2/D"));
 }
+
+TEST_F(AbcTest, MergesOverlappingCuts)
+{
+  AbcLibraryFactory factory(&logger_);
+  factory.AddDbSta(sta_.get());
+  AbcLibrary abc_library = factory.Build();
+
+  LoadVerilog("side_outputs_extract.v");
+
+  sta::dbNetwork* network = sta_->getDbNetwork();
+  LogicExtractorFactory logic_extractor(sta_.get());
+  for (sta::Vertex* vertex : *sta_->endpoints()) {
+    std::string name = vertex->name(network);
+    if (name == "output_flop/D" || name == "output_flop2/D") {
+      logic_extractor.AppendEndpoint(vertex);
+    }
+  }
+  std::vector<LogicCut> cuts
+      = logic_extractor.BuildNonOverlappingLogicCuts(abc_library);
+
+  ASSERT_EQ(cuts.size(), 1);
+  std::unordered_set<std::string> primary_output_names;
+  for (sta::Pin* pin : cuts[0].primary_outputs()) {
+    primary_output_names.insert(network->name(pin));
+  }
+  EXPECT_THAT(primary_output_names, Contains("output_flop/D"));
+  EXPECT_THAT(primary_output_names, Contains("output_flop2/D"));
+}
+
+TEST_F(AbcTest, BuildsMappedNetworkOfCut)
+{
+  AbcLibraryFactory factory(&logger_);
+  factory.AddDbSta(sta_.get());
+  AbcLibrary abc_library = factory.Build();
+  abc::Abc_SclInstallGenlib(
+      abc_library.abc_library(), /*Slew=*/0, /*Gain=*/0, /*nGatesMin=*/0);
+  abc::Mio_LibraryTransferCellIds();
+
+  LoadVerilog("simple_and_gate_extract.v");
+
+  sta::dbNetwork* network = sta_->getDbNetwork();
+  sta::Vertex* flop_input_vertex = nullptr;
+  for (sta::Vertex* vertex : *sta_->endpoints()) {
+    if (std::string(vertex->name(network)) == "output_flop/D") {
+      flop_input_vertex = vertex;
+    }
+  }
+  EXPECT_NE(flop_input_vertex, nullptr);
+
+  LogicExtractorFactory logic_extractor(sta_.get());
+  logic_extractor.AppendEndpoint(flop_input_vertex);
+  LogicCut cut = logic_extractor.BuildLogicCut(abc_library);
+
+  utl::deleted_unique_ptr<abc::Abc_Ntk_t> mapped_network
+      = cut.BuildMappedAbcNetwork(abc_library, network, &logger_);
+  EXPECT_EQ(abc::Abc_NtkPiNum(mapped_network.get()), 2);
+  EXPECT_EQ(abc::Abc_NtkPoNum(mapped_network.get()), 1);
+
+  utl::deleted_unique_ptr<abc::Abc_Ntk_t> logic_network(
+      abc::Abc_NtkToLogic(mapped_network.get()), &abc::Abc_NtkDelete);
+
+  std::array<int, 2> input_vector = {1, 1};
+  utl::deleted_unique_ptr<int> output_vector(
+      abc::Abc_NtkVerifySimulatePattern(logic_network.get(),
+                                        input_vector.data()),
+      &free);
+  EXPECT_EQ(output_vector.get()[0], 1);
+
+  input_vector = {0, 1};
+  output_vector.reset(abc::Abc_NtkVerifySimulatePattern(logic_network.get(),
+                                                        input_vector.data()));
+  EXPECT_EQ(output_vector.get()[0], 0);
+}
+
+TEST_F(AbcTest, InsertsMappedNetworkOfCut)
+{
+  AbcLibraryFactory factory(&logger_);
+  factory.AddDbSta(sta_.get());
+  AbcLibrary abc_library = factory.Build();
+  abc::Abc_SclInstallGenlib(
+      abc_library.abc_library(), /*Slew=*/0, /*Gain=*/0, /*nGatesMin=*/0);
+  abc::Mio_LibraryTransferCellIds();
+
+  LoadVerilog("simple_and_gate_extract.v");
+
+  sta::dbNetwork* network = sta_->getDbNetwork();
+  sta::Vertex* flop_input_vertex = nullptr;
+  for (sta::Vertex* vertex : *sta_->endpoints()) {
+    if (std::string(vertex->name(network)) == "output_flop/D") {
+      flop_input_vertex = vertex;
+    }
+  }
+  EXPECT_NE(flop_input_vertex, nullptr);
+
+  LogicExtractorFactory logic_extractor(sta_.get());
+  logic_extractor.AppendEndpoint(flop_input_vertex);
+  LogicCut cut = logic_extractor.BuildLogicCut(abc_library);
+
+  utl::deleted_unique_ptr<abc::Abc_Ntk_t> mapped_network
+      = cut.BuildMappedAbcNetwork(abc_library, network, &logger_);
+  odb::dbBlock* block = network->block();
+  const auto inst_count = block->getInsts().size();
+  cut.InsertMappedAbcNetwork(mapped_network.get(),
+                             network,
+                             /*tie_lo=*/nullptr,
+                             /*tie_hi=*/nullptr,
+                             &logger_);
+
+  EXPECT_EQ(block->getInsts().size(), inst_count);
+  EXPECT_EQ(block->findInst("_403_"), nullptr);
+  odb::dbInst* and_gate = block->findInst("rmp_abc_0");
+  ASSERT_NE(and_gate, nullptr);
+  EXPECT_EQ(and_gate->getMaster()->getName(),
+            network->libertyCell(network->dbToSta(and_gate))->name());
+  odb::dbInst* flop = block->findInst("output_flop");
+  EXPECT_EQ(and_gate->getFirstOutput()->getNet(),
+            flop->findITerm("D")->getNet());
+}
 }  // namespace rmp
@@ -36,8 +36,12 @@
 #pragma once
 
 #include <array>
+#include <map>
 #include <optional>
 #include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 #include "db_sta/dbSta.hh"
 #include "dpl/Opendp.h"
@@ -133,6 +137,7 @@ using PinVector = std::vector<PinPtr>;
 
 class RecoverPower;
 class RepairDesign;
+class SteinerTreeCache;
 class RepairSetup;
 class RepairHold;
 
@@ -147,6 +152,22 @@ class NetHash
 using CellTargetLoadMap = Map<LibertyCell*, float>;
 using TgtSlews = array<Slew, RiseFall::index_count>;
 
+// Max rise/fall gateDelay at target slews sampled every cap_step of load.
+// Empty when the samples are not non-decreasing in load.
+struct GateDelayTable
+{
+  float cap_step = 0.0;
+  std::vector<ArcDelay> delays;
+};
+using GateDelayTableMap
+    = std::map<std::pair<const LibertyPort*, const DcalcAnalysisPt*>,
+               GateDelayTable>;
+// Max wire lengths found with scratch block stas by driver port, corner
+// and the corner's wire resistance and capacitance.
+using MaxWireLengthMap
+    = std::map<std::tuple<const LibertyPort*, const Corner*, double, double>,
+               double>;
+
 enum class ParasiticsSrc
 {
   none,
@@ -264,6 +285,9 @@ class Resizer : public dbStaState
   bool dontTouch(const Net* net);
 
   void setMaxUtilization(double max_utilization);
+  // Directory where the buffer target slews and cell target loads are
+  // saved, keyed by the libraries, corners and dont use cells.
+  void setCharacterizationCacheDir(const char* dir);
   // Remove all or selected buffers from the netlist.
   void removeBuffers(InstanceSeq insts, bool recordJournal = false);
   void bufferInputs();
@@ -344,7 +368,8 @@ class Resizer : public dbStaState
       double slew_margin,      // 0.0-1.0
       double cap_margin,       // 0.0-1.0
       double buffer_gain,
-      bool verbose);
+      bool verbose,
+      int num_threads);
   int repairDesignBufferCount() const;
   // for debugging
   void repairNet(Net* net,
@@ -382,8 +407,10 @@ class Resizer : public dbStaState
   //  remove inserted buffers
   //  restore resized gates
   // resizeSlackPreamble must be called before the first findResizeSlacks.
+  // With incremental_parasitics only the nets marked by parasiticsInvalid
+  // since the previous pass are re-estimated.
   void resizeSlackPreamble();
-  void findResizeSlacks();
+  void findResizeSlacks(bool incremental_parasitics = false);
   // Return nets with worst slack.
   NetSeq& resizeWorstSlackNets();
   // Return net slack, if any (indicated by the bool).
@@ -425,6 +452,9 @@ class Resizer : public dbStaState
   void findBuffers();
   bool isLinkCell(LibertyCell* cell);
   void findTargetLoads();
+  std::string characterizationKey();
+  bool readCharacterization(const std::string& cache_file);
+  void writeCharacterization(const std::string& cache_file);
   void balanceBin(const vector<odb::dbInst*>& bin);
 
   //==============================
@@ -510,6 +540,15 @@ class Resizer : public dbStaState
                      const RiseFall* rf,
                      float load_cap,
                      const DcalcAnalysisPt* dcalc_ap);
+  // Bounds of gateDelay from the samples of a per port table around
+  // load_cap, used to prune equivalent cells before dcalc.  Returns false
+  // when there are no bounds: input slews are annotated, load_cap is off the
+  // table or the sampled delays are not non-decreasing in load.
+  bool gateDelayBounds(const LibertyPort* drvr_port,
+                       float load_cap,
+                       const DcalcAnalysisPt* dcalc_ap,
+                       ArcDelay& lower,
+                       ArcDelay& upper);
   float bufferDelay(LibertyCell* buffer_cell,
                     float load_cap,
                     const DcalcAnalysisPt* dcalc_ap);
@@ -580,6 +619,10 @@ class Resizer : public dbStaState
   void estimateWireParasiticSteiner(const Pin* drvr_pin,
                                     const Net* net,
                                     SpefWriter* spef_writer);
+  void makeSteinerParasitic(const Net* net,
+                            SteinerTree* tree,
+                            SpefWriter* spef_writer);
+  bool needsWireParasitic(const Pin* drvr_pin, const Net* net) const;
   float totalLoad(SteinerTree* tree) const;
   float subtreeLoad(SteinerTree* tree,
                     float cap_per_micron,
@@ -702,6 +745,7 @@ class Resizer : public dbStaState
 
   ParasiticsSrc parasitics_src_ = ParasiticsSrc::none;
   UnorderedSet<const Net*, NetHash> parasitics_invalid_;
+  SteinerTreeCache* steiner_tree_cache_;
 
   double design_area_ = 0.0;
   const MinMax* min_ = MinMax::min();
@@ -710,11 +754,19 @@ class Resizer : public dbStaState
   LibertyCell* buffer_lowest_drive_ = nullptr;
 
   CellTargetLoadMap* target_load_map_ = nullptr;
+  // characterizationKey() of target_load_map_.
+  std::string characterization_key_;
+  std::string characterization_cache_dir_;
+  // Libraries of the last makeEquivCells.
+  LibertyLibrarySeq equiv_cell_libs_;
+  bool equiv_cells_valid_ = false;
   VertexSeq level_drvr_vertices_;
   bool level_drvr_vertices_valid_ = false;
   TgtSlews tgt_slews_;
   Corner* tgt_slew_corner_ = nullptr;
   const DcalcAnalysisPt* tgt_slew_dcalc_ap_ = nullptr;
+  GateDelayTableMap gate_delay_tables_;
+  MaxWireLengthMap max_wire_lengths_;
   // Instances with multiple output ports that have been resized.
   InstanceSet resized_multi_output_insts_;
   int unique_net_index_ = 1;
@@ -752,6 +804,12 @@ class Resizer : public dbStaState
 
   // "factor debatable"
   static constexpr float tgt_slew_load_cap_factor = 10.0;
+  // Gate delay table samples per target load and table length.
+  static constexpr int gate_delay_table_steps_ = 4;
+  static constexpr int gate_delay_table_size_ = 33;
+  // Nets per batch of Steiner trees built in parallel by
+  // estimateWireParasitics.
+  static constexpr size_t estimate_batch_size_ = 10000;
 
   // Use actual input slews for accurate delay/slew estimation
   sta::UnorderedMap<LibertyPort*, InputSlews> input_slew_map_;
@@ -101,6 +101,8 @@ BufferedNet::BufferedNet(const BufferedNetType type,
 
   required_path_.init();
   required_delay_ = 0.0;
+  buffer_count_ = 0;
+  area_ = 0.0;
 }
 
 // junc
@@ -128,6 +130,8 @@ BufferedNet::BufferedNet(const BufferedNetType type,
 
   required_path_.init();
   required_delay_ = 0.0;
+  buffer_count_ = ref->bufferCount() + ref2->bufferCount();
+  area_ = ref->area() + ref2->area();
 }
 
 // wire
@@ -158,6 +162,8 @@ BufferedNet::BufferedNet(const BufferedNetType type,
 
   required_path_.init();
   required_delay_ = 0.0;
+  buffer_count_ = ref->bufferCount();
+  area_ = ref->area();
 }
 
 // buffer
@@ -188,6 +194,8 @@ BufferedNet::BufferedNet(const BufferedNetType type,
 
   required_path_.init();
   required_delay_ = 0.0;
+  buffer_count_ = ref->bufferCount() + 1;
+  area_ = ref->area() + buffer_cell->area();
 }
 
 void BufferedNet::reportTree(const Resizer* resizer) const
@@ -295,21 +303,6 @@ void BufferedNet::setRequiredDelay(Delay delay)
   required_delay_ = delay;
 }
 
-int BufferedNet::bufferCount() const
-{
-  switch (type_) {
-    case BufferedNetType::buffer:
-      return ref_->bufferCount() + 1;
-    case BufferedNetType::wire:
-      return ref_->bufferCount();
-    case BufferedNetType::junction:
-      return ref_->bufferCount() + ref2_->bufferCount();
-    case BufferedNetType::load:
-      return 0;
-  }
-  return 0;
-}
-
 int BufferedNet::maxLoadWireLength() const
 {
   switch (type_) {
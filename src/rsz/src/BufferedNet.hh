@@ -159,7 +159,9 @@ class BufferedNet
   Delay requiredDelay() const { return required_delay_; }
   void setRequiredDelay(Delay delay);
   // Downstream buffer count.
-  int bufferCount() const;
+  int bufferCount() const { return buffer_count_; }
+  // Downstream buffer area.
+  float area() const { return area_; }
 
   static constexpr int null_layer = -1;
 
@@ -187,6 +189,10 @@ class BufferedNet
   PathRef required_path_;
   // Max delay from here to the loads.
   Delay required_delay_;
+  // Downstream buffer count and area, set when the node is made so they
+  // don't require walking the tree.
+  int buffer_count_;
+  float area_;
 };
 
 }  // namespace rsz
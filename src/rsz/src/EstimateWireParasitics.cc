@@ -33,6 +33,9 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <vector>
+
 #include "SteinerTree.hh"
 #include "db_sta/dbNetwork.hh"
 #include "grt/GlobalRouter.h"
@@ -46,6 +49,7 @@
 #include "sta/Sdc.hh"
 #include "sta/Units.hh"
 #include "utl/Logger.h"
+#include "utl/exception.h"
 
 namespace rsz {
 
@@ -407,12 +411,61 @@ void Resizer::estimateWireParasitics(SpefWriter* spef_writer)
     // Make separate parasitics for each corner, same for min/max.
     sta_->setParasiticAnalysisPts(true);
 
+    // Nets in a batch get their Steiner trees built on sta's threads; the
+    // parasitics are made in net order because sta::Parasitics and the
+    // delay calculator reduction are not thread safe.
+    struct WireNet
+    {
+      const Pin* drvr_pin;
+      const Net* net;
+      bool is_pad;
+    };
+    const int thread_count = std::max(1, sta_->threadCount());
+    vector<WireNet> wire_nets;
+    vector<SteinerTree*> trees;
+    auto make_parasitics = [&]() {
+      trees.assign(wire_nets.size(), nullptr);
+      utl::ThreadException exception;
+#pragma omp parallel for num_threads(thread_count) schedule(dynamic, 64)
+      for (int i = 0; i < wire_nets.size(); i++) {  // NOLINT
+        try {
+          if (!wire_nets[i].is_pad) {
+            trees[i] = makeSteinerTree(wire_nets[i].drvr_pin);
+          }
+        } catch (...) {
+          exception.capture();
+        }
+      }
+      exception.rethrow();
+
+      for (int i = 0; i < wire_nets.size(); i++) {
+        if (wire_nets[i].is_pad) {
+          makePadParasitic(wire_nets[i].net, spef_writer);
+        } else if (trees[i]) {
+          makeSteinerParasitic(wire_nets[i].net, trees[i], spef_writer);
+          delete trees[i];
+        }
+      }
+      wire_nets.clear();
+    };
+
     NetIterator* net_iter = network_->netIterator(network_->topInstance());
     while (net_iter->hasNext()) {
       Net* net = net_iter->next();
-      estimateWireParasitic(net, spef_writer);
+      PinSet* drivers = network_->drivers(net);
+      if (drivers && !drivers->empty()) {
+        PinSet::Iterator drvr_iter(drivers);
+        const Pin* drvr_pin = drvr_iter.next();
+        if (needsWireParasitic(drvr_pin, net)) {
+          wire_nets.push_back({drvr_pin, net, isPadNet(net)});
+          if (wire_nets.size() == estimate_batch_size_) {
+            make_parasitics();
+          }
+        }
+      }
     }
     delete net_iter;
+    make_parasitics();
 
     parasitics_src_ = ParasiticsSrc::placement;
     parasitics_invalid_.clear();
@@ -429,13 +482,18 @@ void Resizer::estimateWireParasitic(const Net* net, SpefWriter* spef_writer)
   }
 }
 
+bool Resizer::needsWireParasitic(const Pin* drvr_pin, const Net* net) const
+{
+  return !network_->isPower(net) && !network_->isGround(net)
+         && !sta_->isIdealClock(drvr_pin)
+         && !db_network_->staToDb(net)->isSpecial();
+}
+
 void Resizer::estimateWireParasitic(const Pin* drvr_pin,
                                     const Net* net,
                                     SpefWriter* spef_writer)
 {
-  if (!network_->isPower(net) && !network_->isGround(net)
-      && !sta_->isIdealClock(drvr_pin)
-      && !db_network_->staToDb(net)->isSpecial()) {
+  if (needsWireParasitic(drvr_pin, net)) {
     if (isPadNet(net)) {
       // When an input port drives a pad instance with huge input
       // cap the elmore delay is gigantic. Annotate with zero
@@ -487,89 +545,96 @@ void Resizer::estimateWireParasiticSteiner(const Pin* drvr_pin,
 {
   SteinerTree* tree = makeSteinerTree(drvr_pin);
   if (tree) {
-    debugPrint(logger_,
-               RSZ,
-               "resizer_parasitics",
-               1,
-               "estimate wire {}",
-               sdc_network_->pathName(net));
-    for (Corner* corner : *sta_->corners()) {
-      const ParasiticAnalysisPt* parasitics_ap
-          = corner->findParasiticAnalysisPt(max_);
-      Parasitic* parasitic
-          = sta_->makeParasiticNetwork(net, false, parasitics_ap);
-      bool is_clk = global_router_->isNonLeafClock(db_network_->staToDb(net));
-      double wire_cap = 0.0;
-      double wire_res = 0.0;
-      int branch_count = tree->branchCount();
-      size_t resistor_id = 1;
-      for (int i = 0; i < branch_count; i++) {
-        Point pt1, pt2;
-        SteinerPt steiner_pt1, steiner_pt2;
-        int wire_length_dbu;
-        tree->branch(i, pt1, steiner_pt1, pt2, steiner_pt2, wire_length_dbu);
-        if (wire_length_dbu) {
-          double dx = dbuToMeters(abs(pt1.x() - pt2.x()))
-                      / dbuToMeters(wire_length_dbu);
-          double dy = dbuToMeters(abs(pt1.y() - pt2.y()))
-                      / dbuToMeters(wire_length_dbu);
-
-          if (is_clk) {
-            wire_cap = dx * wireClkHCapacitance(corner)
-                       + dy * wireClkVCapacitance(corner);
-            wire_res = dx * wireClkHResistance(corner)
-                       + dy * wireClkVResistance(corner);
-          } else {
-            wire_cap = dx * wireSignalHCapacitance(corner)
-                       + dy * wireSignalVCapacitance(corner);
-            wire_res = dx * wireSignalHResistance(corner)
-                       + dy * wireSignalVResistance(corner);
-          }
-        } else {
-          wire_cap = is_clk ? wireClkCapacitance(corner)
-                            : wireSignalCapacitance(corner);
-          wire_res = is_clk ? wireClkResistance(corner)
-                            : wireSignalResistance(corner);
-        }
-        ParasiticNode* n1 = parasitics_->ensureParasiticNode(
-            parasitic, net, steiner_pt1, network_);
-        ParasiticNode* n2 = parasitics_->ensureParasiticNode(
-            parasitic, net, steiner_pt2, network_);
-        if (wire_length_dbu == 0) {
-          // Use a small resistor to keep the connectivity intact.
-          parasitics_->makeResistor(parasitic, resistor_id++, 1.0e-3, n1, n2);
+    makeSteinerParasitic(net, tree, spef_writer);
+    delete tree;
+  }
+}
+
+void Resizer::makeSteinerParasitic(const Net* net,
+                                   SteinerTree* tree,
+                                   SpefWriter* spef_writer)
+{
+  debugPrint(logger_,
+             RSZ,
+             "resizer_parasitics",
+             1,
+             "estimate wire {}",
+             sdc_network_->pathName(net));
+  for (Corner* corner : *sta_->corners()) {
+    const ParasiticAnalysisPt* parasitics_ap
+        = corner->findParasiticAnalysisPt(max_);
+    Parasitic* parasitic
+        = sta_->makeParasiticNetwork(net, false, parasitics_ap);
+    bool is_clk = global_router_->isNonLeafClock(db_network_->staToDb(net));
+    double wire_cap = 0.0;
+    double wire_res = 0.0;
+    int branch_count = tree->branchCount();
+    size_t resistor_id = 1;
+    for (int i = 0; i < branch_count; i++) {
+      Point pt1, pt2;
+      SteinerPt steiner_pt1, steiner_pt2;
+      int wire_length_dbu;
+      tree->branch(i, pt1, steiner_pt1, pt2, steiner_pt2, wire_length_dbu);
+      if (wire_length_dbu) {
+        double dx = dbuToMeters(abs(pt1.x() - pt2.x()))
+                    / dbuToMeters(wire_length_dbu);
+        double dy = dbuToMeters(abs(pt1.y() - pt2.y()))
+                    / dbuToMeters(wire_length_dbu);
+
+        if (is_clk) {
+          wire_cap = dx * wireClkHCapacitance(corner)
+                     + dy * wireClkVCapacitance(corner);
+          wire_res = dx * wireClkHResistance(corner)
+                     + dy * wireClkVResistance(corner);
         } else {
-          double length = dbuToMeters(wire_length_dbu);
-          double cap = length * wire_cap;
-          double res = length * wire_res;
-          // Make pi model for the wire.
-          debugPrint(logger_,
-                     RSZ,
-                     "resizer_parasitics",
-                     2,
-                     " pi {} l={} c2={} rpi={} c1={} {}",
-                     parasitics_->name(n1),
-                     units_->distanceUnit()->asString(length),
-                     units_->capacitanceUnit()->asString(cap / 2.0),
-                     units_->resistanceUnit()->asString(res),
-                     units_->capacitanceUnit()->asString(cap / 2.0),
-                     parasitics_->name(n2));
-          parasitics_->incrCap(n1, cap / 2.0);
-          parasitics_->makeResistor(parasitic, resistor_id++, res, n1, n2);
-          parasitics_->incrCap(n2, cap / 2.0);
+          wire_cap = dx * wireSignalHCapacitance(corner)
+                     + dy * wireSignalVCapacitance(corner);
+          wire_res = dx * wireSignalHResistance(corner)
+                     + dy * wireSignalVResistance(corner);
         }
-        parasiticNodeConnectPins(parasitic, n1, tree, steiner_pt1, resistor_id);
-        parasiticNodeConnectPins(parasitic, n2, tree, steiner_pt2, resistor_id);
+      } else {
+        wire_cap = is_clk ? wireClkCapacitance(corner)
+                          : wireSignalCapacitance(corner);
+        wire_res = is_clk ? wireClkResistance(corner)
+                          : wireSignalResistance(corner);
       }
-      if (spef_writer) {
-        spef_writer->writeNet(corner, net, parasitic);
+      ParasiticNode* n1 = parasitics_->ensureParasiticNode(
+          parasitic, net, steiner_pt1, network_);
+      ParasiticNode* n2 = parasitics_->ensureParasiticNode(
+          parasitic, net, steiner_pt2, network_);
+      if (wire_length_dbu == 0) {
+        // Use a small resistor to keep the connectivity intact.
+        parasitics_->makeResistor(parasitic, resistor_id++, 1.0e-3, n1, n2);
+      } else {
+        double length = dbuToMeters(wire_length_dbu);
+        double cap = length * wire_cap;
+        double res = length * wire_res;
+        // Make pi model for the wire.
+        debugPrint(logger_,
+                   RSZ,
+                   "resizer_parasitics",
+                   2,
+                   " pi {} l={} c2={} rpi={} c1={} {}",
+                   parasitics_->name(n1),
+                   units_->distanceUnit()->asString(length),
+                   units_->capacitanceUnit()->asString(cap / 2.0),
+                   units_->resistanceUnit()->asString(res),
+                   units_->capacitanceUnit()->asString(cap / 2.0),
+                   parasitics_->name(n2));
+        parasitics_->incrCap(n1, cap / 2.0);
+        parasitics_->makeResistor(parasitic, resistor_id++, res, n1, n2);
+        parasitics_->incrCap(n2, cap / 2.0);
       }
-      arc_delay_calc_->reduceParasitic(
-          parasitic, net, corner, sta::MinMaxAll::all());
+      parasiticNodeConnectPins(parasitic, n1, tree, steiner_pt1, resistor_id);
+      parasiticNodeConnectPins(parasitic, n2, tree, steiner_pt2, resistor_id);
     }
-    parasitics_->deleteParasiticNetworks(net);
-    delete tree;
+    if (spef_writer) {
+      spef_writer->writeNet(corner, net, parasitic);
+    }
+    arc_delay_calc_->reduceParasitic(
+        parasitic, net, corner, sta::MinMaxAll::all());
   }
+  parasitics_->deleteParasiticNetworks(net);
 }
 
 float Resizer::pinCapacitance(const Pin* pin,
@@ -743,6 +808,7 @@ bool Resizer::isPad(const Instance* inst) const
 
 void Resizer::parasiticsInvalid(const Net* net)
 {
+  steiner_tree_cache_->erase(net);
   if (haveEstimatedParasitics()) {
     debugPrint(logger_,
                RSZ,
@@ -33,6 +33,10 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <tuple>
+#include <unordered_map>
+
 #include "BufferedNet.hh"
 #include "RepairSetup.hh"
 #include "db_sta/dbNetwork.hh"
@@ -280,6 +284,10 @@ BufferedNetSeq RepairSetup::rebufferBottomUp(const BufferedNetPtr& bnet,
         }
       }
       Z.resize(si);
+      if (Z.size() > rebuffer_max_options_) {
+        // Z is sorted by penalized slack.
+        Z.resize(rebuffer_max_options_);
+      }
       return Z;
     }
     case BufferedNetType::load: {
@@ -316,6 +324,8 @@ BufferedNetSeq RepairSetup::addWireAndBuffer(const BufferedNetSeq& Z,
   BufferedNetSeq Z1;
   Z1.reserve(Z.size());
   Point wire_end = bnet_wire->location();
+  // The options share the wire, so its RC only depends on the corner.
+  vector<std::tuple<const Corner*, double, double>> wire_rcs;
   for (const BufferedNetPtr& p : Z) {
     Point p_loc = p->location();
     int wire_length_dbu
@@ -327,7 +337,17 @@ BufferedNetSeq RepairSetup::addWireAndBuffer(const BufferedNetSeq& Z,
                                : req_path.dcalcAnalysisPt(sta_)->corner();
     int wire_layer = bnet_wire->layer();
     double layer_res, layer_cap;
-    bnet_wire->wireRC(corner, resizer_, layer_res, layer_cap);
+    auto wire_rc = std::find_if(
+        wire_rcs.begin(), wire_rcs.end(), [corner](const auto& rc) {
+          return std::get<0>(rc) == corner;
+        });
+    if (wire_rc != wire_rcs.end()) {
+      layer_res = std::get<1>(*wire_rc);
+      layer_cap = std::get<2>(*wire_rc);
+    } else {
+      bnet_wire->wireRC(corner, resizer_, layer_res, layer_cap);
+      wire_rcs.emplace_back(corner, layer_res, layer_cap);
+    }
     double wire_res = wire_length * layer_res;
     double wire_cap = wire_length * layer_cap;
     double wire_delay = wire_res * wire_cap;
@@ -353,6 +373,7 @@ BufferedNetSeq RepairSetup::addWireAndBuffer(const BufferedNetSeq& Z,
     BufferedNetSeq buffered_options;
     for (LibertyCell* buffer_cell : resizer_->buffer_cells_) {
       Required best_req = -INF;
+      Delay best_buffer_delay = 0.0;
       BufferedNetPtr best_option = nullptr;
       for (const BufferedNetPtr& z : Z1) {
         PathRef req_path = z->requiredPath();
@@ -364,6 +385,7 @@ BufferedNetSeq RepairSetup::addWireAndBuffer(const BufferedNetSeq& Z,
           Required req = z->required(sta_) - buffer_delay;
           if (fuzzyGreater(req, best_req)) {
             best_req = req;
+            best_buffer_delay = buffer_delay;
             best_option = z;
           }
         }
@@ -376,10 +398,7 @@ BufferedNetSeq RepairSetup::addWireAndBuffer(const BufferedNetSeq& Z,
         if (!req_path.isNull()) {
           const DcalcAnalysisPt* dcalc_ap = req_path.dcalcAnalysisPt(sta_);
           buffer_cap = bufferInputCapacitance(buffer_cell, dcalc_ap);
-          buffer_delay = resizer_->bufferDelay(buffer_cell,
-                                               req_path.transition(sta_),
-                                               best_option->cap(),
-                                               dcalc_ap);
+          buffer_delay = best_buffer_delay;
           required = req_path.required(sta_) - buffer_delay;
         }
         // Don't add this buffer option if it has worse input cap and req than
@@ -421,10 +440,69 @@ BufferedNetSeq RepairSetup::addWireAndBuffer(const BufferedNetSeq& Z,
     for (const BufferedNetPtr& z : buffered_options) {
       Z1.push_back(z);
     }
+    pruneOptions(Z1);
   }
   return Z1;
 }
 
+// Remove the options that another option dominates with a later or equal
+// required time, smaller or equal cap and smaller or equal buffer area.
+// At most rebuffer_max_options_ of the survivors with the best penalized
+// slack are kept.
+void RepairSetup::pruneOptions(BufferedNetSeq& Z)
+{
+  std::unordered_map<BufferedNet*, Required> requireds;
+  for (const BufferedNetPtr& p : Z) {
+    requireds[p.get()] = p->required(sta_);
+  }
+  std::stable_sort(
+      Z.begin(),
+      Z.end(),
+      [&requireds](const BufferedNetPtr& option1,
+                   const BufferedNetPtr& option2) {
+        const Required req1 = requireds[option1.get()];
+        const Required req2 = requireds[option2.get()];
+        if (req1 != req2) {
+          return req1 > req2;
+        }
+        if (option1->cap() != option2->cap()) {
+          return option1->cap() < option2->cap();
+        }
+        return option1->area() < option2->area();
+      });
+  // Options are sorted by required, so only the survivors ahead of an option
+  // can dominate it.
+  BufferedNetSeq survivors;
+  survivors.reserve(Z.size());
+  for (const BufferedNetPtr& p : Z) {
+    bool dominated = false;
+    for (const BufferedNetPtr& q : survivors) {
+      if (fuzzyLessEqual(q->cap(), p->cap())
+          && fuzzyLessEqual(q->area(), p->area())) {
+        dominated = true;
+        break;
+      }
+    }
+    if (!dominated) {
+      survivors.push_back(p);
+    }
+  }
+  if (survivors.size() > rebuffer_max_options_) {
+    std::unordered_map<BufferedNet*, Slack> slacks;
+    for (const BufferedNetPtr& p : survivors) {
+      slacks[p.get()] = slackPenalized(p);
+    }
+    std::stable_sort(survivors.begin(),
+                     survivors.end(),
+                     [&slacks](const BufferedNetPtr& option1,
+                               const BufferedNetPtr& option2) {
+                       return slacks[option1.get()] > slacks[option2.get()];
+                     });
+    survivors.resize(rebuffer_max_options_);
+  }
+  Z = std::move(survivors);
+}
+
 float RepairSetup::bufferInputCapacitance(LibertyCell* buffer_cell,
                                           const DcalcAnalysisPt* dcalc_ap)
 {
@@ -427,8 +427,17 @@ LibertyCell* RecoverPower::downsizeCell(const LibertyPort* in_port,
         = resizer_->gateDelay(drvr_port, load_cap, resizer_->tgt_slew_dcalc_ap_)
           + prev_drive * in_port->cornerPort(lib_ap)->capacitance();
 
-    LibertyCell* best_cell = nullptr;
-    for (LibertyCell* equiv : *equiv_cells) {
+    auto meets_delay = [=](const float current_delay) {
+      return current_delay > delay
+             && (current_delay - delay) * delay_margin < path_slack;
+    };
+    // The weakest acceptable cell is the last one in sort order.  The bounds
+    // from the delay table skip cells dcalc would reject; only dcalc accepts
+    // a cell.
+    for (auto equiv_iter = equiv_cells->rbegin();
+         equiv_iter != equiv_cells->rend();
+         equiv_iter++) {
+      LibertyCell* equiv = *equiv_iter;
       const LibertyCell* equiv_corner = equiv->cornerCell(lib_ap);
       const LibertyPort* equiv_drvr
           = equiv_corner->findLibertyPort(drvr_port_name);
@@ -436,19 +445,23 @@ LibertyCell* RecoverPower::downsizeCell(const LibertyPort* in_port,
           = equiv_corner->findLibertyPort(in_port_name);
       const float current_drive = equiv_drvr->driveResistance();
       // Include delay of previous driver into equiv gate.
-      const float current_delay
-          = resizer_->gateDelay(equiv_drvr, load_cap, dcalc_ap)
-            + prev_drive * equiv_input->capacitance();
-
-      if (!resizer_->dontUse(equiv) && current_drive > drive
-          && current_delay > delay
-          && (current_delay - delay) * delay_margin < path_slack  // add margin
-          && meetsSizeCriteria(cell, equiv, match_size)) {
-        best_cell = equiv;
+      const float prev_delay = prev_drive * equiv_input->capacitance();
+
+      if (resizer_->dontUse(equiv) || current_drive <= drive
+          || !meetsSizeCriteria(cell, equiv, match_size)) {
+        continue;
+      }
+      ArcDelay lower, upper;
+      if (resizer_->gateDelayBounds(
+              equiv_drvr, load_cap, dcalc_ap, lower, upper)
+          && (upper + prev_delay <= delay
+              || (lower + prev_delay - delay) * delay_margin >= path_slack)) {
+        continue;
+      }
+      if (meets_delay(resizer_->gateDelay(equiv_drvr, load_cap, dcalc_ap)
+                      + prev_delay)) {
+        return equiv;
       }
-    }
-    if (best_cell != nullptr) {
-      return best_cell;
     }
   }
   return nullptr;
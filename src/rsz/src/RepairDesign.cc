@@ -35,6 +35,9 @@
 
 #include "RepairDesign.hh"
 
+#include <unordered_set>
+#include <vector>
+
 #include "BufferedNet.hh"
 #include "db_sta/dbNetwork.hh"
 #include "rsz/Resizer.hh"
@@ -51,6 +54,7 @@
 #include "sta/Search.hh"
 #include "sta/SearchPred.hh"
 #include "sta/Units.hh"
+#include "utl/exception.h"
 
 namespace rsz {
 
@@ -91,7 +95,8 @@ void RepairDesign::repairDesign(double max_wire_length,
                                 double slew_margin,
                                 double cap_margin,
                                 double buffer_gain,
-                                bool verbose)
+                                bool verbose,
+                                int num_threads)
 {
   init();
   int repaired_net_count, slew_violations, cap_violations;
@@ -101,6 +106,7 @@ void RepairDesign::repairDesign(double max_wire_length,
                cap_margin,
                buffer_gain,
                verbose,
+               num_threads,
                repaired_net_count,
                slew_violations,
                cap_violations,
@@ -137,6 +143,7 @@ void RepairDesign::repairDesign(
     double cap_margin,
     double buffer_gain,
     bool verbose,
+    int num_threads,
     int& repaired_net_count,
     int& slew_violations,
     int& cap_violations,
@@ -147,6 +154,7 @@ void RepairDesign::repairDesign(
   slew_margin_ = slew_margin;
   cap_margin_ = cap_margin;
   buffer_gain_ = buffer_gain;
+  num_threads_ = num_threads;
   bool gain_buffering = (buffer_gain_ != 0.0);
 
   slew_violations = 0;
@@ -198,7 +206,11 @@ void RepairDesign::repairDesign(
     printProgress(print_iteration, false, false, repaired_net_count);
   }
   int max_length = resizer_->metersToDbu(max_wire_length);
+  int batch_begin = resizer_->level_drvr_vertices_.size();
   for (int i = resizer_->level_drvr_vertices_.size() - 1; i >= 0; i--) {
+    if (num_threads_ > 1 && i < batch_begin) {
+      batch_begin = prebuildBufferedNets(i);
+    }
     print_iteration++;
     if (verbose) {
       printProgress(print_iteration, false, false, repaired_net_count);
@@ -250,6 +262,7 @@ void RepairDesign::repairDesign(
       }
     }
   }
+  prebuilt_bnets_.clear();
   resizer_->updateParasitics();
   if (verbose) {
     printProgress(print_iteration, true, true, repaired_net_count);
@@ -667,6 +680,9 @@ void RepairDesign::repairNet(Net* net,
                sdc_network_->pathName(drvr_pin));
     const Corner* corner = sta_->cmdCorner();
     bool repaired_net = false;
+    // Any change to the net or its driver before the buffered net is made
+    // makes a prebuilt one stale.
+    bool net_changed = false;
 
     if (buffer_gain_ != 0.0) {
       float fanout, max_fanout, fanout_slack;
@@ -682,6 +698,7 @@ void RepairDesign::repairNet(Net* net,
         repaired_net = true;
         resize_count_ += 1;
       }
+      net_changed = repaired_net;
     }
 
     if (check_fanout) {
@@ -690,6 +707,7 @@ void RepairDesign::repairNet(Net* net,
       if (max_fanout > 0.0 && fanout_slack < 0.0) {
         fanout_violations++;
         repaired_net = true;
+        net_changed = true;
 
         debugPrint(logger_, RSZ, "repair_net", 3, "fanout violation");
         LoadRegion region = findLoadRegions(drvr_pin, max_fanout);
@@ -707,11 +725,19 @@ void RepairDesign::repairNet(Net* net,
 
     // Resize the driver to normalize slews before repairing limit violations.
     if (parasitics_src_ == ParasiticsSrc::placement && resize_drvr) {
-      resize_count_ += resizer_->resizeToTargetSlew(drvr_pin);
+      const int resized = resizer_->resizeToTargetSlew(drvr_pin);
+      resize_count_ += resized;
+      net_changed |= resized > 0;
     }
     // For tristate nets all we can do is resize the driver.
     if (!resizer_->isTristateDriver(drvr_pin)) {
-      BufferedNetPtr bnet = resizer_->makeBufferedNetSteiner(drvr_pin, corner);
+      BufferedNetPtr bnet;
+      auto prebuilt = prebuilt_bnets_.find(drvr_pin);
+      if (prebuilt != prebuilt_bnets_.end() && !net_changed) {
+        bnet = prebuilt->second;
+      } else {
+        bnet = resizer_->makeBufferedNetSteiner(drvr_pin, corner);
+      }
       if (bnet) {
         resizer_->ensureWireParasitic(drvr_pin, net);
         graph_delay_calc_->findDelays(drvr);
@@ -774,6 +800,59 @@ void RepairDesign::repairNet(Net* net,
   }
 }
 
+// Build the Steiner buffered nets for the drivers from last_index down that
+// are on the same level on num_threads_ threads and save them for repairNet.
+// Repairing a net only edits that net and resizes its driver, so nets with
+// drivers on the same level and on different instances don't see each
+// other's repairs and their buffered nets stay valid.  Returns the index of
+// the first driver in the batch.
+int RepairDesign::prebuildBufferedNets(const int last_index)
+{
+  prebuilt_bnets_.clear();
+  const int level = resizer_->level_drvr_vertices_[last_index]->level();
+  std::vector<const Pin*> drvr_pins;
+  std::unordered_set<const Instance*> drvr_insts;
+  int index = last_index;
+  for (; index >= 0 && drvr_pins.size() < prebuild_batch_size_; index--) {
+    Vertex* drvr = resizer_->level_drvr_vertices_[index];
+    if (drvr->level() != level) {
+      break;
+    }
+    const Pin* drvr_pin = drvr->pin();
+    if (network_->isTopLevelPort(drvr_pin) || drvr->isConstant()
+        || resizer_->isTristateDriver(drvr_pin)) {
+      continue;
+    }
+    const Net* net = network_->net(drvr_pin);
+    if (net == nullptr || resizer_->dontTouch(net)
+        || db_network_->isSpecial(net) || sta_->isClock(drvr_pin)) {
+      continue;
+    }
+    // Resizing a multi-output driver moves its other output pins.
+    if (drvr_insts.insert(network_->instance(drvr_pin)).second) {
+      drvr_pins.push_back(drvr_pin);
+    }
+  }
+
+  const Corner* corner = sta_->cmdCorner();
+  std::vector<BufferedNetPtr> bnets(drvr_pins.size());
+  utl::ThreadException exception;
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic)
+  for (int i = 0; i < drvr_pins.size(); i++) {  // NOLINT
+    try {
+      bnets[i] = resizer_->makeBufferedNetSteiner(drvr_pins[i], corner);
+    } catch (...) {
+      exception.capture();
+    }
+  }
+  exception.rethrow();
+
+  for (int i = 0; i < drvr_pins.size(); i++) {
+    prebuilt_bnets_[drvr_pins[i]] = bnets[i];
+  }
+  return index + 1;
+}
+
 bool RepairDesign::needRepairSlew(const Pin* drvr_pin,
                                   int& slew_violations,
                                   float& max_cap,
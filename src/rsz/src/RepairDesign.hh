@@ -35,6 +35,8 @@
 
 #pragma once
 
+#include <unordered_map>
+
 #include "BufferedNet.hh"
 #include "PreChecks.hh"
 #include "db_sta/dbSta.hh"
@@ -89,12 +91,14 @@ class RepairDesign : dbStaState
                     double slew_margin,
                     double cap_margin,
                     double buffer_gain,
-                    bool verbose);
+                    bool verbose,
+                    int num_threads);
   void repairDesign(double max_wire_length,  // zero for none (meters)
                     double slew_margin,
                     double cap_margin,
                     double buffer_gain,
                     bool verbose,
+                    int num_threads,
                     int& repaired_net_count,
                     int& slew_violations,
                     int& cap_violations,
@@ -114,6 +118,7 @@ class RepairDesign : dbStaState
   bool getCin(const Pin* drvr_pin, float& cin);
   void findBufferSizes();
   bool performGainBuffering(Net* net, const Pin* drvr_pin, int max_fanout);
+  int prebuildBufferedNets(int last_index);
 
   void repairNet(Net* net,
                  const Pin* drvr_pin,
@@ -274,10 +279,15 @@ class RepairDesign : dbStaState
 
   int print_interval_ = 0;
 
+  int num_threads_ = 1;
+  // Steiner buffered nets built ahead of repairNet for a batch of drivers.
+  std::unordered_map<const Pin*, BufferedNetPtr> prebuilt_bnets_;
+
   // Elmore factor for 20-80% slew thresholds.
   static constexpr float elmore_skew_factor_ = 1.39;
   static constexpr int min_print_interval_ = 10;
   static constexpr int max_print_interval_ = 100;
+  static constexpr int prebuild_batch_size_ = 1024;
 };
 
 }  // namespace rsz
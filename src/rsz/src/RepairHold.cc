@@ -35,6 +35,9 @@
 
 #include "RepairHold.hh"
 
+#include <cmath>
+#include <map>
+
 #include "RepairDesign.hh"
 #include "db_sta/dbNetwork.hh"
 #include "rsz/Resizer.hh"
@@ -358,24 +361,126 @@ void RepairHold::repairHoldPass(VertexSeq& hold_failures,
   sort(hold_failures, [=](Vertex* end1, Vertex* end2) {
     return sta_->vertexSlack(end1, min_) < sta_->vertexSlack(end2, min_);
   });
+  if (!allow_setup_violations
+      && hold_failures.size() >= hold_batch_min_ends_) {
+    repairHoldBatches(hold_failures,
+                      buffer_cell,
+                      setup_margin,
+                      hold_margin,
+                      max_buffer_count);
+    return;
+  }
   for (Vertex* end_vertex : hold_failures) {
     resizer_->updateParasitics();
     repairEndHold(end_vertex,
                   buffer_cell,
                   setup_margin,
                   hold_margin,
-                  allow_setup_violations);
+                  allow_setup_violations,
+                  false);
     if (inserted_buffer_count_ > max_buffer_count) {
       break;
     }
   }
 }
 
+// Checking the setup slack after every hold buffer forces a full required
+// time update per insertion. Instead, group endpoints whose hold paths share
+// a driver, repair a batch of groups with buffer chains sized to the hold
+// violation and check the setup slack once for the whole batch. A batch that
+// hurts setup is backed out and its endpoints repaired one at a time.
+void RepairHold::repairHoldBatches(VertexSeq& hold_failures,
+                                   LibertyCell* buffer_cell,
+                                   const double setup_margin,
+                                   const double hold_margin,
+                                   const int max_buffer_count)
+{
+  vector<VertexSeq> groups;
+  std::map<Vertex*, size_t> drvr_groups;
+  for (Vertex* end_vertex : hold_failures) {
+    PathRef end_path = sta_->vertexWorstSlackPath(end_vertex, min_);
+    if (end_path.isNull()) {
+      continue;
+    }
+    PathExpanded expanded(&end_path, sta_);
+    VertexSeq drvrs;
+    size_t group_index = groups.size();
+    const int path_length = expanded.size();
+    for (int i = expanded.startIndex(); i < path_length; i++) {
+      Vertex* path_vertex = expanded.path(i)->vertex(sta_);
+      if (path_vertex->isDriver(network_)) {
+        auto drvr_group = drvr_groups.find(path_vertex);
+        if (drvr_group != drvr_groups.end()) {
+          group_index = drvr_group->second;
+        }
+        drvrs.push_back(path_vertex);
+      }
+    }
+    if (group_index == groups.size()) {
+      groups.emplace_back();
+    }
+    groups[group_index].push_back(end_vertex);
+    for (Vertex* drvr : drvrs) {
+      drvr_groups.emplace(drvr, group_index);
+    }
+  }
+
+  size_t group_index = 0;
+  while (group_index < groups.size()
+         && inserted_buffer_count_ <= max_buffer_count) {
+    VertexSeq batch;
+    while (group_index < groups.size() && batch.size() < hold_batch_size_) {
+      const VertexSeq& group = groups[group_index++];
+      batch.insert(batch.end(), group.begin(), group.end());
+    }
+    resizer_->journalBegin();
+    const Slack setup_slack_before = sta_->worstSlack(max_);
+    const int inserted_buffer_count_before = inserted_buffer_count_;
+    for (Vertex* end_vertex : batch) {
+      resizer_->updateParasitics();
+      repairEndHold(
+          end_vertex, buffer_cell, setup_margin, hold_margin, false, true);
+    }
+    bool restored = false;
+    if (inserted_buffer_count_ > inserted_buffer_count_before) {
+      resizer_->updateParasitics();
+      const Slack setup_slack_after = sta_->worstSlack(max_);
+      if (fuzzyLess(setup_slack_after, setup_slack_before)
+          && setup_slack_after < setup_margin) {
+        debugPrint(logger_,
+                   RSZ,
+                   "repair_hold",
+                   2,
+                   "restore batch of {} endpoints setup slack {}",
+                   batch.size(),
+                   delayAsString(setup_slack_after, sta_, 3));
+        resizer_->journalRestore(resize_count_,
+                                 inserted_buffer_count_,
+                                 cloned_gate_count_,
+                                 removed_buffer_count_);
+        restored = true;
+      }
+    }
+    resizer_->journalEnd();
+    if (restored) {
+      for (Vertex* end_vertex : batch) {
+        resizer_->updateParasitics();
+        repairEndHold(
+            end_vertex, buffer_cell, setup_margin, hold_margin, false, false);
+        if (inserted_buffer_count_ > max_buffer_count) {
+          break;
+        }
+      }
+    }
+  }
+}
+
 void RepairHold::repairEndHold(Vertex* end_vertex,
                                LibertyCell* buffer_cell,
                                const double setup_margin,
                                const double hold_margin,
-                               const bool allow_setup_violations)
+                               const bool allow_setup_violations,
+                               const bool batched)
 {
   PathRef end_path = sta_->vertexWorstSlackPath(end_vertex, min_);
   if (!end_path.isNull()) {
@@ -468,13 +573,28 @@ void RepairHold::repairEndHold(Vertex* end_vertex,
               Point drvr_loc = db_network_->location(path_vertex->pin());
               Point buffer_loc((drvr_loc.x() + path_load_loc.x()) / 2,
                                (drvr_loc.y() + path_load_loc.y()) / 2);
+              if (batched) {
+                // The caller checks the setup slack for the whole batch.
+                const int chain_length = holdChainLength(
+                    slacks, buffer_delays, setup_margin, hold_margin);
+                Vertex* chain_drvr = path_vertex;
+                for (int j = 0; j < chain_length; j++) {
+                  chain_drvr = makeHoldDelay(chain_drvr,
+                                             load_pins,
+                                             loads_have_out_port,
+                                             buffer_cell,
+                                             buffer_loc);
+                }
+                continue;
+              }
               // Despite checking for setup slack to insert the bufffer,
               // increased slews downstream can increase delays and
               // reduce setup slack in ways that are too expensive to
               // predict. Use the journal to back out the change if
               // the hold buffer blows through the setup margin.
               resizer_->journalBegin();
-              Slack setup_slack_before = sta_->worstSlack(max_);
+              Slack setup_slack_before
+                  = allow_setup_violations ? 0.0 : sta_->worstSlack(max_);
               Slew slew_before = sta_->vertexSlew(path_vertex, max_);
               makeHoldDelay(path_vertex,
                             load_pins,
@@ -482,7 +602,8 @@ void RepairHold::repairEndHold(Vertex* end_vertex,
                             buffer_cell,
                             buffer_loc);
               Slew slew_after = sta_->vertexSlew(path_vertex, max_);
-              Slack setup_slack_after = sta_->worstSlack(max_);
+              Slack setup_slack_after
+                  = allow_setup_violations ? 0.0 : sta_->worstSlack(max_);
               float slew_factor
                   = (slew_before > 0) ? slew_after / slew_before : 1.0;
 
@@ -504,6 +625,27 @@ void RepairHold::repairEndHold(Vertex* end_vertex,
   }
 }
 
+// Number of hold buffers needed to cover the worst hold violation, limited
+// by the setup slack left for them.
+int RepairHold::holdChainLength(const Slacks& slacks,
+                                const Delay buffer_delays[],
+                                const double setup_margin,
+                                const double hold_margin)
+{
+  const Delay buffer_delay
+      = max(buffer_delays[rise_index_], buffer_delays[fall_index_]);
+  if (buffer_delay <= 0.0) {
+    return 1;
+  }
+  const Slack hold_slack
+      = min(slacks[rise_index_][min_index_], slacks[fall_index_][min_index_]);
+  const Slack setup_slack
+      = min(slacks[rise_index_][max_index_], slacks[fall_index_][max_index_]);
+  const int hold_count = std::ceil((hold_margin - hold_slack) / buffer_delay);
+  const int setup_count = (setup_slack - setup_margin) / buffer_delay;
+  return std::max(1, min({hold_count, setup_count, hold_max_chain_length_}));
+}
+
 void RepairHold::mergeInit(Slacks& slacks)
 {
   slacks[rise_index_][min_index_] = INF;
@@ -524,11 +666,11 @@ void RepairHold::mergeInto(Slacks& from, Slacks& result)
       = max(result[fall_index_][max_index_], from[fall_index_][max_index_]);
 }
 
-void RepairHold::makeHoldDelay(Vertex* drvr,
-                               PinSeq& load_pins,
-                               bool loads_have_out_port,  // top level port
-                               LibertyCell* buffer_cell,
-                               const Point& loc)
+Vertex* RepairHold::makeHoldDelay(Vertex* drvr,
+                                  PinSeq& load_pins,
+                                  bool loads_have_out_port,  // top level port
+                                  LibertyCell* buffer_cell,
+                                  const Point& loc)
 {
   Pin* drvr_pin = drvr->pin();
   odb::dbModNet* mod_drvr_net = nullptr;  // hierarchical driver, default none
@@ -695,6 +837,7 @@ void RepairHold::makeHoldDelay(Vertex* drvr,
     resizer_->updateParasitics();
     resize_count_++;
   }
+  return buffer_out_vertex;
 }
 
 bool RepairHold::checkMaxSlewCap(const Pin* drvr_pin)
@@ -108,16 +108,28 @@ class RepairHold : public sta::dbStaState
                       double hold_margin,
                       bool allow_setup_violations,
                       int max_buffer_count);
+  void repairHoldBatches(VertexSeq& hold_failures,
+                         LibertyCell* buffer_cell,
+                         double setup_margin,
+                         double hold_margin,
+                         int max_buffer_count);
+  // batched skips the per buffer setup check and inserts buffer chains.
   void repairEndHold(Vertex* end_vertex,
                      LibertyCell* buffer_cell,
                      double setup_margin,
                      double hold_margin,
-                     bool allow_setup_violations);
-  void makeHoldDelay(Vertex* drvr,
-                     PinSeq& load_pins,
-                     bool loads_have_out_port,
-                     LibertyCell* buffer_cell,
-                     const Point& loc);
+                     bool allow_setup_violations,
+                     bool batched);
+  int holdChainLength(const Slacks& slacks,
+                      const Delay buffer_delays[],
+                      double setup_margin,
+                      double hold_margin);
+  // Returns the buffer output vertex.
+  Vertex* makeHoldDelay(Vertex* drvr,
+                        PinSeq& load_pins,
+                        bool loads_have_out_port,
+                        LibertyCell* buffer_cell,
+                        const Point& loc);
   bool checkMaxSlewCap(const Pin* drvr_pin);
   void mergeInit(Slacks& slacks);
   void mergeInto(Slacks& from, Slacks& result);
@@ -141,6 +153,10 @@ class RepairHold : public sta::dbStaState
 
   static constexpr float hold_slack_limit_ratio_max_ = 0.2;
   static constexpr int print_interval_ = 10;
+  // Hold failure count to repair endpoint groups in batches.
+  static constexpr size_t hold_batch_min_ends_ = 100;
+  static constexpr size_t hold_batch_size_ = 32;
+  static constexpr int hold_max_chain_length_ = 4;
 };
 
 }  // namespace rsz
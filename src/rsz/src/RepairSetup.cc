@@ -69,10 +69,12 @@ using sta::fuzzyGreater;
 using sta::fuzzyGreaterEqual;
 using sta::fuzzyLess;
 using sta::GraphDelayCalc;
+using sta::INF;
 using sta::InstancePinIterator;
 using sta::NetConnectedPinIterator;
 using sta::PathExpanded;
 using sta::Slew;
+using sta::Unit;
 using sta::VertexOutEdgeIterator;
 
 RepairSetup::RepairSetup(Resizer* resizer) : resizer_(resizer)
@@ -164,6 +166,15 @@ void RepairSetup::repairSetup(const float setup_slack_margin,
   sta_->checkFanoutLimitPreamble();
 
   resizer_->incrementalParasiticsBegin();
+  if (max_end_count >= independent_path_min_ends_) {
+    repairIndependentPaths(violating_ends,
+                           max_end_count,
+                           setup_slack_margin,
+                           skip_pin_swap,
+                           skip_gate_cloning,
+                           skip_buffering,
+                           skip_buffer_removal);
+  }
   int opto_iteration = 0;
   bool prev_termination = false;
   bool two_cons_terminations = false;
@@ -520,6 +531,14 @@ bool RepairSetup::repairPath(PathRef& path,
           return pair1.second > pair2.second
                  || (pair1.second == pair2.second && pair1.first > pair2.first);
         });
+    int best_upsize_index;
+    LibertyCell* best_upsize_cell;
+    findBestUpsize(load_delays,
+                   &expanded,
+                   path_slack,
+                   best_upsize_index,
+                   best_upsize_cell);
+    int drvr_count = 0;
     // Attack gates with largest load delays first.
     for (const auto& [drvr_index, ignored] : load_delays) {
       PathRef* drvr_path = expanded.path(drvr_index);
@@ -550,9 +569,21 @@ bool RepairSetup::repairPath(PathRef& path,
         }
       }
 
-      if (upsizeDrvr(drvr_path, drvr_index, &expanded)) {
-        changed = true;
-        break;
+      // The upsizes of the first drivers were already estimated; only the
+      // best of them is worth committing.
+      if (drvr_count++ < upsize_eval_drivers_) {
+        if (best_upsize_cell
+            && upsizeDrvr(expanded.path(best_upsize_index), best_upsize_cell)) {
+          changed = true;
+          break;
+        }
+      } else {
+        LibertyCell* upsize
+            = upsizeCandidate(drvr_path, drvr_index, &expanded);
+        if (upsize && upsizeDrvr(drvr_path, upsize)) {
+          changed = true;
+          break;
+        }
       }
 
       // Pin swapping
@@ -1046,54 +1077,209 @@ bool RepairSetup::estimateInputSlewImpact(
   return true;
 }
 
-bool RepairSetup::upsizeDrvr(PathRef* drvr_path,
-                             const int drvr_index,
-                             PathExpanded* expanded)
+LibertyCell* RepairSetup::upsizeCandidate(PathRef* drvr_path,
+                                          const int drvr_index,
+                                          PathExpanded* expanded)
 {
   Pin* drvr_pin = drvr_path->pin(this);
   Instance* drvr = network_->instance(drvr_pin);
+  if (resizer_->dontTouch(drvr)) {
+    return nullptr;
+  }
   const DcalcAnalysisPt* dcalc_ap = drvr_path->dcalcAnalysisPt(sta_);
   const float load_cap = graph_delay_calc_->loadCap(drvr_pin, dcalc_ap);
   const int in_index = drvr_index - 1;
   PathRef* in_path = expanded->path(in_index);
   Pin* in_pin = in_path->pin(sta_);
   LibertyPort* in_port = network_->libertyPort(in_pin);
-  if (!resizer_->dontTouch(drvr)
-      || resizer_->cloned_inst_set_.find(drvr)
-             != resizer_->cloned_inst_set_.end()) {
-    float prev_drive;
-    if (drvr_index >= 2) {
-      const int prev_drvr_index = drvr_index - 2;
-      PathRef* prev_drvr_path = expanded->path(prev_drvr_index);
-      Pin* prev_drvr_pin = prev_drvr_path->pin(sta_);
-      prev_drive = 0.0;
-      LibertyPort* prev_drvr_port = network_->libertyPort(prev_drvr_pin);
-      if (prev_drvr_port) {
-        prev_drive = prev_drvr_port->driveResistance();
-      }
-    } else {
-      prev_drive = 0.0;
+  float prev_drive = 0.0;
+  if (drvr_index >= 2) {
+    const int prev_drvr_index = drvr_index - 2;
+    PathRef* prev_drvr_path = expanded->path(prev_drvr_index);
+    Pin* prev_drvr_pin = prev_drvr_path->pin(sta_);
+    LibertyPort* prev_drvr_port = network_->libertyPort(prev_drvr_pin);
+    if (prev_drvr_port) {
+      prev_drive = prev_drvr_port->driveResistance();
     }
-    LibertyPort* drvr_port = network_->libertyPort(drvr_pin);
-    LibertyCell* upsize
-        = upsizeCell(in_port, drvr_port, load_cap, prev_drive, dcalc_ap);
-    if (upsize) {
-      debugPrint(logger_,
-                 RSZ,
-                 "repair_setup",
-                 3,
-                 "resize {} {} -> {}",
-                 network_->pathName(drvr_pin),
-                 drvr_port->libertyCell()->name(),
-                 upsize->name());
-      if (!resizer_->dontTouch(drvr)
-          && resizer_->replaceCell(drvr, upsize, true)) {
-        resize_count_++;
-        return true;
+  }
+  LibertyPort* drvr_port = network_->libertyPort(drvr_pin);
+  return upsizeCell(in_port, drvr_port, load_cap, prev_drive, dcalc_ap);
+}
+
+bool RepairSetup::upsizeDrvr(PathRef* drvr_path, LibertyCell* upsize)
+{
+  Pin* drvr_pin = drvr_path->pin(this);
+  Instance* drvr = network_->instance(drvr_pin);
+  LibertyPort* drvr_port = network_->libertyPort(drvr_pin);
+  debugPrint(logger_,
+             RSZ,
+             "repair_setup",
+             3,
+             "resize {} {} -> {}",
+             network_->pathName(drvr_pin),
+             drvr_port->libertyCell()->name(),
+             upsize->name());
+  if (resizer_->replaceCell(drvr, upsize, true)) {
+    resize_count_++;
+    return true;
+  }
+  return false;
+}
+
+// Pick the upsize that helps the path the most among the drivers with the
+// largest load delays.  Each candidate is estimated in a local timing window
+// (see estimateResizeDelta) so nothing is changed until the best one is
+// committed.  Candidates that would make a side fanout of the previous driver
+// worse than the path slack are rejected.
+bool RepairSetup::findBestUpsize(
+    const vector<pair<int, Delay>>& load_delays,
+    PathExpanded* expanded,
+    const Slack path_slack,
+    // Return values.
+    int& best_index,
+    LibertyCell*& best_cell)
+{
+  best_index = -1;
+  best_cell = nullptr;
+  Delay best_delta = 0.0;
+  const int eval_count
+      = std::min(static_cast<int>(load_delays.size()), upsize_eval_drivers_);
+  for (int i = 0; i < eval_count; i++) {
+    const int drvr_index = load_delays[i].first;
+    PathRef* drvr_path = expanded->path(drvr_index);
+    LibertyCell* upsize = upsizeCandidate(drvr_path, drvr_index, expanded);
+    if (upsize == nullptr) {
+      continue;
+    }
+    Slack side_slack;
+    const Delay delta = estimateResizeDelta(
+        drvr_path, drvr_index, expanded, upsize, side_slack);
+    debugPrint(logger_,
+               RSZ,
+               "repair_setup",
+               3,
+               "resize {} -> {} delta = {} side slack = {}",
+               network_->pathName(drvr_path->pin(this)),
+               upsize->name(),
+               delayAsString(delta, sta_, 3),
+               delayAsString(side_slack, sta_, 3));
+    if (fuzzyLess(delta, best_delta)
+        && fuzzyGreaterEqual(side_slack, path_slack)) {
+      best_delta = delta;
+      best_index = drvr_index;
+      best_cell = upsize;
+    }
+  }
+  return best_cell != nullptr;
+}
+
+// Estimate the path delay change from swapping the driver at drvr_index to
+// cell.  The timing window is the previous driver stage (input pin cap
+// change), the driver stage and the next driver on the path (output slew
+// change).  Wire delays and slew degradation are ignored.  A negative result
+// is an improvement.  side_slack returns the worst slack of the other loads
+// of the previous driver after the change.
+Delay RepairSetup::estimateResizeDelta(PathRef* drvr_path,
+                                       const int drvr_index,
+                                       PathExpanded* expanded,
+                                       LibertyCell* cell,
+                                       // Return value.
+                                       Slack& side_slack)
+{
+  side_slack = INF;
+  const DcalcAnalysisPt* dcalc_ap = drvr_path->dcalcAnalysisPt(sta_);
+  const Corner* corner = dcalc_ap->corner();
+  Pin* drvr_pin = drvr_path->pin(sta_);
+  LibertyPort* drvr_port = network_->libertyPort(drvr_pin);
+  LibertyPort* new_drvr_port = cell->findLibertyPort(drvr_port->name());
+  Pin* in_pin = expanded->path(drvr_index - 1)->pin(sta_);
+  LibertyPort* in_port = network_->libertyPort(in_pin);
+  LibertyPort* new_in_port
+      = in_port ? cell->findLibertyPort(in_port->name()) : nullptr;
+  if (new_drvr_port == nullptr || new_in_port == nullptr) {
+    return INF;
+  }
+  Delay delta = 0.0;
+
+  // Previous driver sees the input pin cap change.
+  if (drvr_index >= 2) {
+    PathRef* prev_drvr_path = expanded->path(drvr_index - 2);
+    Pin* prev_drvr_pin = prev_drvr_path->pin(sta_);
+    LibertyPort* prev_drvr_port = network_->libertyPort(prev_drvr_pin);
+    if (prev_drvr_port) {
+      const int prev_rf = prev_drvr_path->transition(sta_)->index();
+      ArcDelay old_delay[RiseFall::index_count];
+      ArcDelay new_delay[RiseFall::index_count];
+      Slew old_slew[RiseFall::index_count], new_slew[RiseFall::index_count];
+      const float old_cap = graph_delay_calc_->loadCap(prev_drvr_pin, dcalc_ap);
+      const float new_cap = old_cap
+                            - resizer_->portCapacitance(in_port, corner)
+                            + resizer_->portCapacitance(new_in_port, corner);
+      resizer_->annotateInputSlews(network_->instance(prev_drvr_pin),
+                                   dcalc_ap);
+      resizer_->gateDelays(
+          prev_drvr_port, old_cap, dcalc_ap, old_delay, old_slew);
+      resizer_->gateDelays(
+          prev_drvr_port, new_cap, dcalc_ap, new_delay, new_slew);
+      resizer_->resetInputSlews();
+      const Delay prev_delta = new_delay[prev_rf] - old_delay[prev_rf];
+      delta += prev_delta;
+
+      Net* prev_net = network_->net(prev_drvr_pin);
+      std::unique_ptr<NetConnectedPinIterator> pin_iter(
+          network_->connectedPinIterator(prev_net));
+      while (pin_iter->hasNext()) {
+        const Pin* side_pin = pin_iter->next();
+        if (side_pin != prev_drvr_pin && side_pin != in_pin
+            && network_->isLoad(side_pin)) {
+          const Slack slack = sta_->pinSlack(side_pin, max_) - prev_delta;
+          side_slack = std::min(side_slack, slack);
+        }
       }
     }
   }
-  return false;
+
+  // Driver stage with the new cell at the current load.
+  const int drvr_rf = drvr_path->transition(sta_)->index();
+  const float load_cap = graph_delay_calc_->loadCap(drvr_pin, dcalc_ap);
+  ArcDelay old_delay[RiseFall::index_count], new_delay[RiseFall::index_count];
+  Slew old_slew[RiseFall::index_count], new_slew[RiseFall::index_count];
+  resizer_->annotateInputSlews(network_->instance(drvr_pin), dcalc_ap);
+  resizer_->gateDelays(drvr_port, load_cap, dcalc_ap, old_delay, old_slew);
+  resizer_->gateDelays(new_drvr_port, load_cap, dcalc_ap, new_delay, new_slew);
+  resizer_->resetInputSlews();
+  delta += new_delay[drvr_rf] - old_delay[drvr_rf];
+
+  // Next driver on the path sees the output slew change.
+  const int next_index = drvr_index + 2;
+  if (next_index < expanded->size()) {
+    PathRef* next_drvr_path = expanded->path(next_index);
+    const Pin* next_drvr_pin = next_drvr_path->pin(sta_);
+    LibertyPort* next_drvr_port = network_->libertyPort(next_drvr_pin);
+    if (next_drvr_port && network_->isDriver(next_drvr_pin)
+        && !network_->isTopLevelPort(next_drvr_pin)) {
+      const int next_rf = next_drvr_path->transition(sta_)->index();
+      const float next_cap
+          = graph_delay_calc_->loadCap(next_drvr_pin, dcalc_ap);
+      ArcDelay old_next_delay[RiseFall::index_count];
+      ArcDelay new_next_delay[RiseFall::index_count];
+      Slew next_slew[RiseFall::index_count];
+      resizer_->gateDelays(next_drvr_port,
+                           next_cap,
+                           old_slew,
+                           dcalc_ap,
+                           old_next_delay,
+                           next_slew);
+      resizer_->gateDelays(next_drvr_port,
+                           next_cap,
+                           new_slew,
+                           dcalc_ap,
+                           new_next_delay,
+                           next_slew);
+      delta += new_next_delay[next_rf] - old_next_delay[next_rf];
+    }
+  }
+  return delta;
 }
 
 LibertyCell* RepairSetup::upsizeCell(LibertyPort* in_port,
@@ -1132,12 +1318,22 @@ LibertyCell* RepairSetup::upsizeCell(LibertyPort* in_port,
       LibertyPort* equiv_drvr = equiv_corner->findLibertyPort(drvr_port_name);
       LibertyPort* equiv_input = equiv_corner->findLibertyPort(in_port_name);
       const float equiv_drive = equiv_drvr->driveResistance();
+      if (resizer_->dontUse(equiv) || equiv_drive >= drive) {
+        continue;
+      }
       // Include delay of previous driver into equiv gate.
+      const float prev_delay = prev_drive * equiv_input->capacitance();
+      // The lower bound from the delay table skips cells dcalc would
+      // reject; only dcalc accepts a cell.
+      ArcDelay lower, upper;
+      if (resizer_->gateDelayBounds(
+              equiv_drvr, load_cap, dcalc_ap, lower, upper)
+          && lower + prev_delay >= delay) {
+        continue;
+      }
       const float equiv_delay
-          = resizer_->gateDelay(equiv_drvr, load_cap, dcalc_ap)
-            + prev_drive * equiv_input->capacitance();
-      if (!resizer_->dontUse(equiv) && equiv_drive < drive
-          && equiv_delay < delay) {
+          = resizer_->gateDelay(equiv_drvr, load_cap, dcalc_ap) + prev_delay;
+      if (equiv_delay < delay) {
         return equiv;
       }
     }
@@ -1664,6 +1860,13 @@ void RepairSetup::printProgress(const int iteration,
         delayAsString(tns, sta_, 1),
         max(0, num_viols),
         worst_vertex != nullptr ? worst_vertex->name(network_) : "");
+
+    const Unit* time_unit = sta_->units()->timeUnit();
+    logger_->metricSeries("timing__repair_setup__iteration",
+                          {{"iteration", iteration},
+                           {"wns", time_unit->staToUser(wns)},
+                           {"tns", time_unit->staToUser(tns)},
+                           {"violating_endpoints", max(0, num_viols)}});
   }
 
   if (end) {
@@ -1708,6 +1911,109 @@ bool RepairSetup::terminateProgress(const int iteration,
 // Perform some last fixing based on sizing only.
 // This is a greedy opto that does not degrade WNS or TNS.
 // TODO: add VT swap
+// Repair the worst paths of violating endpoints in batches.  The paths in a
+// batch share no instances, so their moves are independent and one required
+// time update covers the whole batch instead of one per move.  A batch is
+// kept only if it makes neither WNS nor TNS worse; otherwise it is rolled
+// back with the journal and its endpoints are left to the per-endpoint passes.
+void RepairSetup::repairIndependentPaths(
+    const vector<pair<Vertex*, Slack>>& violating_ends,
+    const int max_end_count,
+    const float setup_slack_margin,
+    const bool skip_pin_swap,
+    const bool skip_gate_cloning,
+    const bool skip_buffering,
+    const bool skip_buffer_removal)
+{
+  Slack prev_worst_slack = sta_->worstSlack(max_);
+  float prev_tns = sta_->totalNegativeSlack(max_);
+  int accepted_batches = 0;
+  int rejected_batches = 0;
+  int end_index = 0;
+  while (end_index < max_end_count && !resizer_->overMaxArea()) {
+    resizer_->journalBegin();
+    std::unordered_set<const Instance*> batch_insts;
+    int batch_paths = 0;
+    for (; end_index < max_end_count
+           && batch_paths < independent_path_batch_size_;
+         end_index++) {
+      Vertex* end = violating_ends[end_index].first;
+      const Slack end_slack = sta_->vertexSlack(end, max_);
+      if (end_slack > setup_slack_margin) {
+        continue;
+      }
+      PathRef end_path = sta_->vertexWorstSlackPath(end, max_);
+      PathExpanded expanded(&end_path, sta_);
+      vector<const Instance*> path_insts;
+      bool overlaps = false;
+      for (int i = expanded.startIndex(); i < expanded.size(); i++) {
+        const Pin* pin = expanded.path(i)->pin(sta_);
+        if (network_->isTopLevelPort(pin)) {
+          continue;
+        }
+        const Instance* inst = network_->instance(pin);
+        if (batch_insts.find(inst) != batch_insts.end()) {
+          overlaps = true;
+          break;
+        }
+        path_insts.push_back(inst);
+      }
+      if (overlaps) {
+        continue;
+      }
+      if (repairPath(end_path,
+                     end_slack,
+                     skip_pin_swap,
+                     skip_gate_cloning,
+                     skip_buffering,
+                     skip_buffer_removal,
+                     setup_slack_margin)) {
+        batch_insts.insert(path_insts.begin(), path_insts.end());
+        batch_paths++;
+        // Keep the wires of the changed nets current for the next path.
+        resizer_->updateParasitics();
+      }
+    }
+    if (batch_paths == 0) {
+      break;
+    }
+    sta_->findRequireds();
+    const Slack worst_slack = sta_->worstSlack(max_);
+    const float tns = sta_->totalNegativeSlack(max_);
+    const bool better = fuzzyGreaterEqual(worst_slack, prev_worst_slack)
+                        && fuzzyGreaterEqual(tns, prev_tns);
+    debugPrint(logger_,
+               RSZ,
+               "repair_setup",
+               2,
+               "independent batch of {} paths worst_slack = {} tns = {} {}",
+               batch_paths,
+               delayAsString(worst_slack, sta_, 3),
+               delayAsString(tns, sta_, 3),
+               better ? "save" : "restore");
+    if (better) {
+      prev_worst_slack = worst_slack;
+      prev_tns = tns;
+      accepted_batches++;
+    } else {
+      resizer_->journalRestore(resize_count_,
+                               inserted_buffer_count_,
+                               cloned_gate_count_,
+                               removed_buffer_count_);
+      resizer_->updateParasitics();
+      sta_->findRequireds();
+      rejected_batches++;
+    }
+  }
+  debugPrint(logger_,
+             RSZ,
+             "repair_setup",
+             1,
+             "independent paths: {} batches accepted, {} rejected",
+             accepted_batches,
+             rejected_batches);
+}
+
 void RepairSetup::repairSetupLastGasp(const OptoParams& params, int& num_viols)
 {
   // Sort remaining failing endpoints
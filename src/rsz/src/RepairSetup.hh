@@ -181,7 +181,22 @@ class RepairSetup : public sta::dbStaState
                                float delay_adjust,
                                SlackEstimatorParams params,
                                bool accept_if_slack_improves);
-  bool upsizeDrvr(PathRef* drvr_path, int drvr_index, PathExpanded* expanded);
+  LibertyCell* upsizeCandidate(PathRef* drvr_path,
+                               int drvr_index,
+                               PathExpanded* expanded);
+  bool upsizeDrvr(PathRef* drvr_path, LibertyCell* upsize);
+  bool findBestUpsize(const vector<pair<int, Delay>>& load_delays,
+                      PathExpanded* expanded,
+                      Slack path_slack,
+                      // Return values.
+                      int& best_index,
+                      LibertyCell*& best_cell);
+  Delay estimateResizeDelta(PathRef* drvr_path,
+                            int drvr_index,
+                            PathExpanded* expanded,
+                            LibertyCell* cell,
+                            // Return value.
+                            Slack& side_slack);
   Point computeCloneGateLocation(
       const Pin* drvr_pin,
       const vector<pair<Vertex*, Slack>>& fanout_slacks);
@@ -207,6 +222,7 @@ class RepairSetup : public sta::dbStaState
   BufferedNetSeq addWireAndBuffer(const BufferedNetSeq& Z,
                                   const BufferedNetPtr& bnet_wire,
                                   int level);
+  void pruneOptions(BufferedNetSeq& Z);
   float bufferInputCapacitance(LibertyCell* buffer_cell,
                                const DcalcAnalysisPt* dcalc_ap);
   Slack slackPenalized(const BufferedNetPtr& bnet);
@@ -223,6 +239,14 @@ class RepairSetup : public sta::dbStaState
                          float& fix_rate_threshold,
                          int endpt_index,
                          int num_endpts);
+  void repairIndependentPaths(
+      const vector<pair<Vertex*, Slack>>& violating_ends,
+      int max_end_count,
+      float setup_slack_margin,
+      bool skip_pin_swap,
+      bool skip_gate_cloning,
+      bool skip_buffering,
+      bool skip_buffer_removal);
   void repairSetupLastGasp(const OptoParams& params, int& num_viols);
 
   Logger* logger_ = nullptr;
@@ -251,6 +275,8 @@ class RepairSetup : public sta::dbStaState
   static constexpr int rebuffer_max_fanout_ = 20;
   static constexpr int split_load_min_fanout_ = 8;
   static constexpr double rebuffer_buffer_penalty_ = .01;
+  // Most buffering options kept at each rebuffer tree node.
+  static constexpr size_t rebuffer_max_options_ = 32;
   static constexpr int print_interval_ = 10;
   static constexpr int opto_small_interval_ = 100;
   static constexpr int opto_large_interval_ = 1000;
@@ -258,6 +284,11 @@ class RepairSetup : public sta::dbStaState
   static constexpr float inc_fix_rate_threshold_
       = 0.0001;  // default fix rate threshold = 0.01%
   static constexpr int max_last_gasp_passes_ = 10;
+  // Drivers on the path whose upsizes are estimated against each other.
+  static constexpr int upsize_eval_drivers_ = 4;
+  // Violating endpoints needed before paths are repaired in batches.
+  static constexpr int independent_path_min_ends_ = 100;
+  static constexpr int independent_path_batch_size_ = 16;
 };
 
 }  // namespace rsz
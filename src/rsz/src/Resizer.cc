@@ -35,9 +35,15 @@
 
 #include "rsz/Resizer.hh"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
 #include <limits>
 #include <optional>
+#include <sstream>
 
 #include "AbstractSteinerRenderer.h"
 #include "BufferedNet.hh"
@@ -45,6 +51,7 @@
 #include "RepairDesign.hh"
 #include "RepairHold.hh"
 #include "RepairSetup.hh"
+#include "SteinerTree.hh"
 #include "boost/multi_array.hpp"
 #include "db_sta/dbNetwork.hh"
 #include "sta/ArcDelayCalc.hh"
@@ -134,6 +141,7 @@ Resizer::Resizer()
       wire_signal_cap_(0.0),
       wire_clk_res_(0.0),
       wire_clk_cap_(0.0),
+      steiner_tree_cache_(new SteinerTreeCache),
       tgt_slews_{0.0, 0.0}
 {
 }
@@ -144,6 +152,8 @@ Resizer::~Resizer()
   delete repair_design_;
   delete repair_setup_;
   delete repair_hold_;
+  delete steiner_tree_cache_;
+  delete target_load_map_;
 }
 
 void Resizer::init(Logger* logger,
@@ -387,6 +397,7 @@ bool Resizer::removeBuffer(Instance* buffer,
 
       sta_->deleteNet(removed);
       parasitics_invalid_.erase(removed);
+      steiner_tree_cache_->erase(removed);
     }
     parasiticsInvalid(survivor);
     updateParasitics();
@@ -1022,7 +1033,20 @@ void Resizer::makeEquivCells()
     }
   }
   delete lib_iter;
+  if (equiv_cells_valid_ && libs == equiv_cell_libs_) {
+    return;
+  }
   sta_->makeEquivCells(&libs, nullptr);
+  if (equiv_cells_valid_) {
+    // The libraries changed so the buffers and target loads refer to
+    // cells that may no longer exist.
+    buffer_cells_.clear();
+    buffer_lowest_drive_ = nullptr;
+    delete target_load_map_;
+    target_load_map_ = nullptr;
+  }
+  equiv_cell_libs_ = libs;
+  equiv_cells_valid_ = true;
 }
 
 int Resizer::resizeToTargetSlew(const Pin* drvr_pin)
@@ -1258,10 +1282,15 @@ void Resizer::resizeSlackPreamble()
 
 // Run repair_design to repair long wires and max slew, capacitance and fanout
 // violations. Find the slacks, and then undo all changes to the netlist.
-void Resizer::findResizeSlacks()
+void Resizer::findResizeSlacks(bool incremental_parasitics)
 {
   journalBegin();
-  estimateWireParasitics();
+  if (incremental_parasitics && parasitics_src_ == ParasiticsSrc::placement) {
+    // Keep the parasitics of the nets that did not move.
+    updateParasitics();
+  } else {
+    estimateWireParasitics();
+  }
   int repaired_net_count, slew_violations, cap_violations;
   int fanout_violations, length_violations;
   repair_design_->repairDesign(max_wire_length_,
@@ -1269,6 +1298,7 @@ void Resizer::findResizeSlacks()
                                0.0,
                                0.0,
                                false,
+                               1,
                                repaired_net_count,
                                slew_violations,
                                cap_violations,
@@ -1563,36 +1593,219 @@ bool Resizer::dontTouch(const Net* net)
 // a target load for each cell that gives the target slew.
 void Resizer::findTargetLoads()
 {
-  if (target_load_map_ == nullptr) {
-    // Find target slew across all buffers in the libraries.
-    findBufferTargetSlews();
+  // The target loads only depend on the libraries, corners and dont use
+  // cells, so they are reused until one of those changes.
+  const string key = characterizationKey();
+  if (target_load_map_ != nullptr && key == characterization_key_) {
+    return;
+  }
+  delete target_load_map_;
+  target_load_map_ = new CellTargetLoadMap;
+  characterization_key_ = key;
 
-    target_load_map_ = new CellTargetLoadMap;
-    // Find target loads at the tgt_slew_corner.
-    int lib_ap_index = tgt_slew_corner_->libertyIndex(max_);
-    LibertyLibraryIterator* lib_iter = network_->libertyLibraryIterator();
-    while (lib_iter->hasNext()) {
-      LibertyLibrary* lib = lib_iter->next();
-      LibertyCellIterator cell_iter(lib);
-      while (cell_iter.hasNext()) {
-        LibertyCell* cell = cell_iter.next();
-        if (isLinkCell(cell) && !dontUse(cell)) {
-          LibertyCell* corner_cell = cell->cornerCell(lib_ap_index);
-          float tgt_load;
-          bool exists;
-          target_load_map_->findKey(corner_cell, tgt_load, exists);
-          if (!exists) {
-            tgt_load = findTargetLoad(corner_cell);
-            (*target_load_map_)[corner_cell] = tgt_load;
-          }
-          // Map link cell to corner cell target load.
-          if (cell != corner_cell) {
-            (*target_load_map_)[cell] = tgt_load;
-          }
+  string cache_file;
+  if (!characterization_cache_dir_.empty()) {
+    cache_file = fmt::format("{}/{}.rsz", characterization_cache_dir_, key);
+    if (readCharacterization(cache_file)) {
+      logger_->info(
+          RSZ, 145, "Loaded buffer target loads from {}.", cache_file);
+      return;
+    }
+    target_load_map_->clear();
+  }
+
+  // Find target slew across all buffers in the libraries.
+  findBufferTargetSlews();
+
+  // Find target loads at the tgt_slew_corner.
+  int lib_ap_index = tgt_slew_corner_->libertyIndex(max_);
+  LibertyLibraryIterator* lib_iter = network_->libertyLibraryIterator();
+  while (lib_iter->hasNext()) {
+    LibertyLibrary* lib = lib_iter->next();
+    LibertyCellIterator cell_iter(lib);
+    while (cell_iter.hasNext()) {
+      LibertyCell* cell = cell_iter.next();
+      if (isLinkCell(cell) && !dontUse(cell)) {
+        LibertyCell* corner_cell = cell->cornerCell(lib_ap_index);
+        float tgt_load;
+        bool exists;
+        target_load_map_->findKey(corner_cell, tgt_load, exists);
+        if (!exists) {
+          tgt_load = findTargetLoad(corner_cell);
+          (*target_load_map_)[corner_cell] = tgt_load;
+        }
+        // Map link cell to corner cell target load.
+        if (cell != corner_cell) {
+          (*target_load_map_)[cell] = tgt_load;
         }
       }
     }
-    delete lib_iter;
+  }
+  delete lib_iter;
+
+  if (!cache_file.empty()) {
+    writeCharacterization(cache_file);
+  }
+}
+
+void Resizer::setCharacterizationCacheDir(const char* dir)
+{
+  characterization_cache_dir_ = dir;
+}
+
+// FNV-1a hash of everything the buffer target slews and cell target
+// loads depend on.  Library files are identified by name, size and
+// modification time rather than contents to keep the key cheap.
+string Resizer::characterizationKey()
+{
+  uint64_t hash = 14695981039346656037ULL;
+  auto add_string = [&hash](const string& str) {
+    // Include the terminator so adjacent strings stay distinct.
+    for (size_t i = 0; i <= str.size(); i++) {
+      hash = (hash ^ static_cast<unsigned char>(str.c_str()[i]))
+             * 1099511628211ULL;
+    }
+  };
+
+  add_string("rsz_characterization_1");
+  add_string(fmt::format("{}", tgt_slew_load_cap_factor));
+  LibertyLibraryIterator* lib_iter = network_->libertyLibraryIterator();
+  while (lib_iter->hasNext()) {
+    LibertyLibrary* lib = lib_iter->next();
+    add_string(lib->name());
+    const char* filename = lib->filename();
+    if (filename) {
+      add_string(filename);
+      std::error_code error;
+      const auto size = std::filesystem::file_size(filename, error);
+      add_string(error ? "" : std::to_string(size));
+      const auto time = std::filesystem::last_write_time(filename, error);
+      add_string(error ? ""
+                       : std::to_string(time.time_since_epoch().count()));
+    }
+  }
+  delete lib_iter;
+
+  for (Corner* corner : *sta_->corners()) {
+    add_string(corner->name());
+    add_string(std::to_string(corner->libertyIndex(max_)));
+    const DcalcAnalysisPt* dcalc_ap = corner->findDcalcAnalysisPt(max_);
+    const Pvt* pvt = dcalc_ap->operatingConditions();
+    if (pvt) {
+      add_string(fmt::format(
+          "{} {} {}", pvt->process(), pvt->voltage(), pvt->temperature()));
+    }
+  }
+
+  vector<string> dont_use;
+  for (LibertyCell* cell : dont_use_) {
+    dont_use.push_back(
+        fmt::format("{}/{}", cell->libertyLibrary()->name(), cell->name()));
+  }
+  std::sort(dont_use.begin(), dont_use.end());
+  for (const string& name : dont_use) {
+    add_string(name);
+  }
+  return fmt::format("{:016x}", hash);
+}
+
+// The cache file holds the key, the target slew corner and slews and the
+// target load of each usable link cell, by library and cell name.
+bool Resizer::readCharacterization(const string& cache_file)
+{
+  std::ifstream stream(cache_file);
+  if (!stream) {
+    return false;
+  }
+  string key, corner_name;
+  string slew_rise, slew_fall;
+  if (!std::getline(stream, key) || key != characterization_key_
+      || !std::getline(stream, corner_name)
+      || !(stream >> slew_rise >> slew_fall)) {
+    return false;
+  }
+  Corner* corner = sta_->findCorner(corner_name.c_str());
+  if (corner == nullptr) {
+    return false;
+  }
+
+  std::map<string, float> loads;
+  string lib_name, cell_name, load;
+  while (stream >> lib_name >> cell_name >> load) {
+    loads[lib_name + '/' + cell_name] = std::strtof(load.c_str(), nullptr);
+  }
+
+  const int lib_ap_index = corner->libertyIndex(max_);
+  LibertyLibraryIterator* lib_iter = network_->libertyLibraryIterator();
+  bool complete = true;
+  while (complete && lib_iter->hasNext()) {
+    LibertyLibrary* lib = lib_iter->next();
+    LibertyCellIterator cell_iter(lib);
+    while (cell_iter.hasNext()) {
+      LibertyCell* cell = cell_iter.next();
+      if (isLinkCell(cell) && !dontUse(cell)) {
+        auto load_iter
+            = loads.find(fmt::format("{}/{}", lib->name(), cell->name()));
+        if (load_iter == loads.end()) {
+          complete = false;
+          break;
+        }
+        (*target_load_map_)[cell] = load_iter->second;
+        (*target_load_map_)[cell->cornerCell(lib_ap_index)]
+            = load_iter->second;
+      }
+    }
+  }
+  delete lib_iter;
+  if (!complete) {
+    return false;
+  }
+
+  tgt_slews_[RiseFall::riseIndex()] = std::strtof(slew_rise.c_str(), nullptr);
+  tgt_slews_[RiseFall::fallIndex()] = std::strtof(slew_fall.c_str(), nullptr);
+  tgt_slew_corner_ = corner;
+  tgt_slew_dcalc_ap_ = corner->findDcalcAnalysisPt(max_);
+  gate_delay_tables_.clear();
+  max_wire_lengths_.clear();
+  return true;
+}
+
+void Resizer::writeCharacterization(const string& cache_file)
+{
+  std::ostringstream out;
+  // Hex floats round trip exactly.
+  out << characterization_key_ << '\n' << tgt_slew_corner_->name() << '\n'
+      << fmt::format("{:a} {:a}\n",
+                     tgt_slews_[RiseFall::riseIndex()],
+                     tgt_slews_[RiseFall::fallIndex()]);
+  LibertyLibraryIterator* lib_iter = network_->libertyLibraryIterator();
+  while (lib_iter->hasNext()) {
+    LibertyLibrary* lib = lib_iter->next();
+    LibertyCellIterator cell_iter(lib);
+    while (cell_iter.hasNext()) {
+      LibertyCell* cell = cell_iter.next();
+      if (isLinkCell(cell) && !dontUse(cell)) {
+        out << fmt::format(
+            "{} {} {:a}\n", lib->name(), cell->name(), targetLoadCap(cell));
+      }
+    }
+  }
+  delete lib_iter;
+
+  // Write through a temporary file so an interrupted run does not leave
+  // a partial cache.
+  const string tmp_file = cache_file + ".tmp";
+  std::ofstream stream(tmp_file);
+  stream << out.str();
+  stream.close();
+  std::error_code error;
+  if (stream) {
+    std::filesystem::rename(tmp_file, cache_file, error);
+  }
+  if (!stream || error) {
+    std::filesystem::remove(tmp_file, error);
+    logger_->warn(
+        RSZ, 146, "Unable to write characterization cache {}.", cache_file);
   }
 }
 
@@ -1719,6 +1932,8 @@ void Resizer::findBufferTargetSlews()
 {
   tgt_slews_ = {0.0};
   tgt_slew_corner_ = nullptr;
+  gate_delay_tables_.clear();
+  max_wire_lengths_.clear();
 
   for (Corner* corner : *sta_->corners()) {
     int lib_ap_index = corner->libertyIndex(max_);
@@ -1847,6 +2062,7 @@ void Resizer::repairTieFanout(LibertyPort* tie_port,
           Net* tie_net = network_->net(tie_pin);
           sta_->deleteNet(tie_net);
           parasitics_invalid_.erase(tie_net);
+          steiner_tree_cache_->erase(tie_net);
           // Delete the tie instance if no other ports are in use.
           // A tie cell can have both tie hi and low outputs.
           bool has_other_fanout = false;
@@ -2347,6 +2563,56 @@ ArcDelay Resizer::gateDelay(const LibertyPort* drvr_port,
   return max(delays[RiseFall::riseIndex()], delays[RiseFall::fallIndex()]);
 }
 
+bool Resizer::gateDelayBounds(const LibertyPort* drvr_port,
+                              const float load_cap,
+                              const DcalcAnalysisPt* dcalc_ap,
+                              ArcDelay& lower,
+                              ArcDelay& upper)
+{
+  if (!input_slew_map_.empty() || load_cap < 0.0) {
+    return false;
+  }
+  auto [table_iter, inserted]
+      = gate_delay_tables_.try_emplace({drvr_port, dcalc_ap});
+  GateDelayTable& table = table_iter->second;
+  if (inserted) {
+    float tgt_load = 0.0;
+    bool exists = false;
+    if (target_load_map_) {
+      target_load_map_->findKey(drvr_port->libertyCell(), tgt_load, exists);
+    }
+    if (exists && tgt_load > 0.0) {
+      table.cap_step = tgt_load / gate_delay_table_steps_;
+      for (int i = 0; i < gate_delay_table_size_; i++) {
+        const ArcDelay delay
+            = gateDelay(drvr_port, i * table.cap_step, dcalc_ap);
+        if (!table.delays.empty() && delay < table.delays.back()) {
+          // The bounds only hold for a delay that grows with the load.
+          table.delays.clear();
+          break;
+        }
+        table.delays.push_back(delay);
+      }
+    }
+  }
+  if (table.delays.empty()) {
+    return false;
+  }
+  const int index = load_cap / table.cap_step;
+  if (index >= gate_delay_table_size_ - 1) {
+    return false;
+  }
+  // Use the same sample loads as the table so rounding can't put load_cap
+  // outside of them.
+  if (index * table.cap_step > load_cap
+      || (index + 1) * table.cap_step < load_cap) {
+    return false;
+  }
+  lower = table.delays[index];
+  upper = table.delays[index + 1];
+  return true;
+}
+
 ////////////////////////////////////////////////////////////////
 
 double Resizer::findMaxWireLength()
@@ -2405,6 +2671,16 @@ double Resizer::findMaxWireLength(LibertyPort* drvr_port, const Corner* corner)
   if (db_network_->staToDb(cell) == nullptr) {
     logger_->error(RSZ, 70, "no LEF cell for {}.", cell->name());
   }
+  // The result only depends on the cell and the wire RC, so reuse it
+  // across repair_design and timing driven placement calls.
+  const auto key = std::make_tuple(drvr_port,
+                                   corner,
+                                   wireSignalResistance(corner),
+                                   wireSignalCapacitance(corner));
+  auto length_iter = max_wire_lengths_.find(key);
+  if (length_iter != max_wire_lengths_.end()) {
+    return length_iter->second;
+  }
   // Make a (hierarchical) block to use as a scratchpad.
   dbBlock* block
       = dbBlock::create(block_, "wire_delay", block_->getTech(), '/');
@@ -2437,6 +2713,7 @@ double Resizer::findMaxWireLength(LibertyPort* drvr_port, const Corner* corner)
     }
   }
   dbBlock::destroy(block);
+  max_wire_lengths_[key] = wire_length1;
   return wire_length1;
 }
 
@@ -2620,14 +2897,19 @@ void Resizer::repairDesign(double max_wire_length,
                            double slew_margin,
                            double cap_margin,
                            double buffer_gain,
-                           bool verbose)
+                           bool verbose,
+                           int num_threads)
 {
   resizePreamble();
   if (parasitics_src_ == ParasiticsSrc::global_routing) {
     opendp_->initMacrosAndGrid();
   }
-  repair_design_->repairDesign(
-      max_wire_length, slew_margin, cap_margin, buffer_gain, verbose);
+  repair_design_->repairDesign(max_wire_length,
+                               slew_margin,
+                               cap_margin,
+                               buffer_gain,
+                               verbose,
+                               num_threads);
 }
 
 int Resizer::repairDesignBufferCount() const
@@ -2754,6 +3036,7 @@ void Resizer::cloneClkInverter(Instance* inv)
       sta_->disconnectPin(out_pin);
       sta_->deleteNet(out_net);
       parasitics_invalid_.erase(out_net);
+      steiner_tree_cache_->erase(out_net);
       sta_->deleteInstance(inv);
     }
   }
@@ -3001,6 +3284,7 @@ void Resizer::journalUndoGateCloning(int& cloned_gate_count)
     //=========================================================================
     // Final cleanup
     if (clone_out_net != nullptr) {
+      steiner_tree_cache_->erase(clone_out_net);
       sta_->deleteNet(clone_out_net);
     }
     sta_->deleteInstance(cloned_inst);
@@ -3146,6 +3430,7 @@ void Resizer::journalRestoreBuffers(int& removed_buffer_count)
     sta_->disconnectPin(const_cast<Pin*>(drvr_pin));
     sta_->connectPin(drvr_inst, drvr_port, input_net);
     sta_->connectPin(buffer, input, input_net);
+    steiner_tree_cache_->erase(orig_input_net);
     db_network_->deleteNet(orig_input_net);
 
     // Reconnect buffer output pin to prevoius load pins
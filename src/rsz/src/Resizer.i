@@ -44,6 +44,7 @@
 #include "sta/Delay.hh"
 #include "sta/Liberty.hh"
 #include "db_sta/dbNetwork.hh"
+#include "ord/OpenRoad.hh"
 
 namespace ord {
 // Defined in OpenRoad.i
@@ -436,6 +437,13 @@ set_max_utilization(double max_utilization)
   resizer->setMaxUtilization(max_utilization);
 }
 
+void
+set_characterization_cache_dir(const char *dir)
+{
+  Resizer *resizer = getResizer();
+  resizer->setCharacterizationCacheDir(dir);
+}
+
 void
 set_dont_use(LibertyCell *lib_cell,
              bool dont_use)
@@ -546,7 +554,9 @@ repair_design_cmd(double max_length,
 {
   ensureLinked();
   Resizer *resizer = getResizer();
-  resizer->repairDesign(max_length, slew_margin, cap_margin, buffer_gain, verbose);
+  const int num_threads = ord::OpenRoad::openRoad()->getThreadCount();
+  resizer->repairDesign(max_length, slew_margin, cap_margin, buffer_gain,
+                        verbose, num_threads);
 }
 
 int
@@ -362,6 +362,18 @@ proc set_dont_use_cmd { cmd cmd_args dont_use } {
   }
 }
 
+sta::define_cmd_args "set_resizer_cache_dir" {dir}
+
+proc set_resizer_cache_dir { args } {
+  sta::parse_key_args "set_resizer_cache_dir" args keys {} flags {}
+  sta::check_argc_eq1 "set_resizer_cache_dir" $args
+  set dir [file nativename [lindex $args 0]]
+  if { ![file isdirectory $dir] } {
+    utl::error RSZ 144 "$dir is not a directory."
+  }
+  rsz::set_characterization_cache_dir $dir
+}
+
 sta::define_cmd_args "set_dont_touch" {nets_instances}
 
 proc set_dont_touch { args } {
@@ -108,8 +108,13 @@ SteinerTree* Resizer::makeSteinerTree(const Pin* drvr_pin)
       tree->locAddPin(pinloc.loc, pinloc.pin);
     }
     if (is_placed) {
-      stt::Tree ftree = stt_builder_->makeSteinerTree(
-          db_network_->staToDb(net), x, y, drvr_idx);
+      dbNet* db_net = db_network_->staToDb(net);
+      const float alpha = stt_builder_->getAlpha(db_net);
+      stt::Tree ftree;
+      if (!steiner_tree_cache_->find(net, x, y, drvr_idx, alpha, ftree)) {
+        ftree = stt_builder_->makeSteinerTree(db_net, x, y, drvr_idx);
+        steiner_tree_cache_->insert(net, x, y, drvr_idx, alpha, ftree);
+      }
 
       tree->setTree(ftree, db_network_);
       tree->createSteinerPtToPinMap();
@@ -120,6 +125,55 @@ SteinerTree* Resizer::makeSteinerTree(const Pin* drvr_pin)
   return nullptr;
 }
 
+////////////////////////////////////////////////////////////////
+
+bool SteinerTreeCache::find(const Net* net,
+                            const vector<int>& x,
+                            const vector<int>& y,
+                            const int drvr_index,
+                            const float alpha,
+                            // Return value.
+                            stt::Tree& tree)
+{
+  std::lock_guard<std::mutex> lock(lock_);
+  auto itr = entries_.find(net);
+  if (itr == entries_.end()) {
+    return false;
+  }
+  const Entry& entry = itr->second;
+  if (entry.drvr_index != drvr_index || entry.alpha != alpha || entry.x != x
+      || entry.y != y) {
+    return false;
+  }
+  tree = entry.tree;
+  return true;
+}
+
+void SteinerTreeCache::insert(const Net* net,
+                              const vector<int>& x,
+                              const vector<int>& y,
+                              const int drvr_index,
+                              const float alpha,
+                              const stt::Tree& tree)
+{
+  std::lock_guard<std::mutex> lock(lock_);
+  entries_[net] = {x, y, drvr_index, alpha, tree};
+}
+
+void SteinerTreeCache::erase(const Net* net)
+{
+  std::lock_guard<std::mutex> lock(lock_);
+  entries_.erase(net);
+}
+
+void SteinerTreeCache::clear()
+{
+  std::lock_guard<std::mutex> lock(lock_);
+  entries_.clear();
+}
+
+////////////////////////////////////////////////////////////////
+
 static void connectedPins(const Net* net,
                           Network* network,
                           dbNetwork* db_network,
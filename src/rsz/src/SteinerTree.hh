@@ -35,7 +35,10 @@
 
 #pragma once
 
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "odb/geom.h"
 #include "rsz/Resizer.hh"
@@ -86,6 +89,46 @@ using LocPinMap = std::unordered_map<Point, PinSeq, PointHash, PointEqual>;
 
 class SteinerTree;
 
+// Steiner trees of nets saved with the pin locations and alpha they were
+// built from.  A net whose pins did not move or change gets its tree back
+// without running flute/pdr again, so parasitics estimation, the repair
+// passes and timing-driven placement share the trees of unchanged nets.
+// Moved pins are caught by the location check; parasiticsInvalid and net
+// deletion drop the entries.  Thread safe.
+class SteinerTreeCache
+{
+ public:
+  // Returns false if there is no tree for these pins.
+  bool find(const Net* net,
+            const vector<int>& x,
+            const vector<int>& y,
+            int drvr_index,
+            float alpha,
+            // Return value.
+            stt::Tree& tree);
+  void insert(const Net* net,
+              const vector<int>& x,
+              const vector<int>& y,
+              int drvr_index,
+              float alpha,
+              const stt::Tree& tree);
+  void erase(const Net* net);
+  void clear();
+
+ private:
+  struct Entry
+  {
+    vector<int> x;
+    vector<int> y;
+    int drvr_index;
+    float alpha;
+    stt::Tree tree;
+  };
+
+  std::unordered_map<const Net*, Entry> entries_;
+  std::mutex lock_;
+};
+
 // Wrapper for stt::Tree
 //
 // Flute
@@ -0,0 +1,28 @@
+# set_resizer_cache_dir saves the buffer target loads, and they are loaded
+# from the cache when the same libraries and dont use cells come back
+source "helpers.tcl"
+read_liberty Nangate45/Nangate45_typ.lib
+read_lef Nangate45/Nangate45.lef
+read_def repair_design1.def
+
+source Nangate45/Nangate45.rc
+set_wire_rc -layer metal3
+estimate_parasitics -placement
+
+set cache_dir [make_result_file characterization_cache]
+file delete -force $cache_dir
+file mkdir $cache_dir
+set_resizer_cache_dir $cache_dir
+
+# characterizes and writes the cache
+repair_design
+puts "cache files: [llength [glob -nocomplain -directory $cache_dir *.rsz]]"
+
+# a different dont use set is characterized and cached separately
+set_dont_use BUF_X1
+repair_design
+puts "cache files: [llength [glob -nocomplain -directory $cache_dir *.rsz]]"
+
+# back to the first setup, which is loaded from its cache file (RSZ-0145)
+unset_dont_use BUF_X1
+repair_design
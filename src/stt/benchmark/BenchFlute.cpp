@@ -0,0 +1,74 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Microbenchmark of FLUTE on random nets.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "stt/flute.h"
+
+namespace stt {
+
+// Builds the Steiner tree of random nets of state.range(0) pins with the
+// accuracy SteinerTreeBuilder uses.  Degrees above FLUTE_D go through the
+// net breaking path instead of the lookup tables.
+static void BM_Flute(benchmark::State& state)
+{
+  const int degree = state.range(0);
+  constexpr int num_nets = 256;
+  constexpr int flute_accuracy = 3;
+
+  std::mt19937 rng(1);
+  std::uniform_int_distribution<int> dist(0, 100000);
+  std::vector<std::vector<int>> xs(num_nets);
+  std::vector<std::vector<int>> ys(num_nets);
+  for (int net = 0; net < num_nets; net++) {
+    for (int pin = 0; pin < degree; pin++) {
+      xs[net].push_back(dist(rng));
+      ys[net].push_back(dist(rng));
+    }
+  }
+
+  int net = 0;
+  for (auto _ : state) {
+    Tree tree = flt::flute(xs[net], ys[net], flute_accuracy);
+    benchmark::DoNotOptimize(tree.length);
+    net = (net + 1) % num_nets;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Flute)->Arg(4)->Arg(9)->Arg(32)->Arg(128);
+
+}  // namespace stt
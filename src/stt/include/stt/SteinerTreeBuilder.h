@@ -35,8 +35,12 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <map>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -94,6 +98,16 @@ class SteinerTreeBuilder
                        const std::vector<int>& x,
                        const std::vector<int>& y,
                        int drvr_index);
+  // Builds the trees of many nets on num_threads threads.  Net i has the
+  // pins [pin_offsets[i], pin_offsets[i + 1]) of x and y, with its driver at
+  // drvr_indices[i] among them, and gets its alpha as in
+  // makeSteinerTree(net, ...).
+  std::vector<Tree> makeSteinerTrees(const std::vector<odb::dbNet*>& nets,
+                                     const std::vector<int>& x,
+                                     const std::vector<int>& y,
+                                     const std::vector<int>& pin_offsets,
+                                     const std::vector<int>& drvr_indices,
+                                     int num_threads);
   // API only for FastRoute, that requires the use of flutes in its
   // internal flute implementation
   Tree makeSteinerTree(const std::vector<int>& x,
@@ -109,8 +123,35 @@ class SteinerTreeBuilder
   void setMinFanoutAlpha(int min_fanout, float alpha);
   void setMinHPWLAlpha(int min_hpwl, float alpha);
 
+  // Keep up to size trees made from pins, driver and alpha so nets with the
+  // same pins up to translation reuse them; 0 disables the cache.
+  void setTreeCacheSize(size_t size);
+  size_t getTreeCacheHits() const;
+  size_t getTreeCacheMisses() const;
+  void reportTreeCache() const;
+
  private:
-  int computeHPWL(odb::dbNet* net);
+  int computeHPWL(odb::dbNet* net) const;
+  float getNetAlpha(odb::dbNet* net) const;
+  Tree buildSteinerTree(const std::vector<int>& x,
+                        const std::vector<int>& y,
+                        int drvr_index,
+                        float alpha);
+  static void translateTree(Tree& tree, int dx, int dy);
+
+  // Pins relative to their lower left bound (x then y), driver and alpha.
+  struct TreeCacheKey
+  {
+    std::vector<int> pins;
+    int drvr_index;
+    float alpha;
+
+    bool operator==(const TreeCacheKey& other) const;
+  };
+  struct TreeCacheKeyHash
+  {
+    size_t operator()(const TreeCacheKey& key) const;
+  };
 
   const int flute_accuracy = 3;
   float alpha_;
@@ -118,6 +159,15 @@ class SteinerTreeBuilder
   std::pair<int, float> min_fanout_alpha_;
   std::pair<int, float> min_hpwl_alpha_;
 
+  // Trees are stored relative to the lower left of their pins.
+  std::unordered_map<TreeCacheKey, Tree, TreeCacheKeyHash> tree_cache_;
+  std::atomic<size_t> tree_cache_size_ = 0;
+  size_t tree_cache_hits_ = 0;
+  size_t tree_cache_misses_ = 0;
+  mutable std::mutex tree_cache_mutex_;
+  // Smaller nets are cheaper to build than to look up.
+  static constexpr size_t min_cached_pins_ = 4;
+
   Logger* logger_;
   odb::dbDatabase* db_;
 };
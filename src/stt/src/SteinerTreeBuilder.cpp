@@ -35,12 +35,15 @@
 
 #include "stt/SteinerTreeBuilder.h"
 
+#include <algorithm>
+#include <functional>
 #include <map>
 #include <vector>
 
 #include "odb/db.h"
 #include "stt/flute.h"
 #include "stt/pd.h"
+#include "utl/exception.h"
 
 namespace stt {
 
@@ -74,13 +77,47 @@ Tree SteinerTreeBuilder::makeSteinerTree(odb::dbNet* net,
                                          const std::vector<int>& x,
                                          const std::vector<int>& y,
                                          const int drvr_index)
+{
+  return makeSteinerTree(x, y, drvr_index, getNetAlpha(net));
+}
+
+std::vector<Tree> SteinerTreeBuilder::makeSteinerTrees(
+    const std::vector<odb::dbNet*>& nets,
+    const std::vector<int>& x,
+    const std::vector<int>& y,
+    const std::vector<int>& pin_offsets,
+    const std::vector<int>& drvr_indices,
+    const int num_threads)
+{
+  std::vector<Tree> trees(nets.size());
+  utl::ThreadException exception;
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic, 64)
+  for (int i = 0; i < (int) nets.size(); i++) {  // NOLINT
+    try {
+      const std::vector<int> net_x(x.begin() + pin_offsets[i],
+                                   x.begin() + pin_offsets[i + 1]);
+      const std::vector<int> net_y(y.begin() + pin_offsets[i],
+                                   y.begin() + pin_offsets[i + 1]);
+      trees[i] = makeSteinerTree(
+          net_x, net_y, drvr_indices[i], getNetAlpha(nets[i]));
+    } catch (...) {
+      exception.capture();
+    }
+  }
+  exception.rethrow();
+
+  return trees;
+}
+
+float SteinerTreeBuilder::getNetAlpha(odb::dbNet* net) const
 {
   float net_alpha = alpha_;
   int min_fanout = min_fanout_alpha_.first;
   int min_hpwl = min_hpwl_alpha_.first;
 
-  if (net_alpha_map_.find(net) != net_alpha_map_.end()) {
-    net_alpha = net_alpha_map_[net];
+  auto net_alpha_itr = net_alpha_map_.find(net);
+  if (net_alpha_itr != net_alpha_map_.end()) {
+    net_alpha = net_alpha_itr->second;
   } else if (min_hpwl > 0) {
     if (computeHPWL(net) >= min_hpwl) {
       net_alpha = min_hpwl_alpha_.second;
@@ -91,13 +128,59 @@ Tree SteinerTreeBuilder::makeSteinerTree(odb::dbNet* net,
     }
   }
 
-  return makeSteinerTree(x, y, drvr_index, net_alpha);
+  return net_alpha;
 }
 
 Tree SteinerTreeBuilder::makeSteinerTree(const std::vector<int>& x,
                                          const std::vector<int>& y,
                                          const int drvr_index,
                                          const float alpha)
+{
+  if (tree_cache_size_ == 0 || x.size() < min_cached_pins_) {
+    return buildSteinerTree(x, y, drvr_index, alpha);
+  }
+
+  const int min_x = *std::min_element(x.begin(), x.end());
+  const int min_y = *std::min_element(y.begin(), y.end());
+  TreeCacheKey key{{}, drvr_index, alpha};
+  key.pins.reserve(x.size() + y.size());
+  for (const int pin_x : x) {
+    key.pins.push_back(pin_x - min_x);
+  }
+  for (const int pin_y : y) {
+    key.pins.push_back(pin_y - min_y);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(tree_cache_mutex_);
+    auto cached = tree_cache_.find(key);
+    if (cached != tree_cache_.end()) {
+      tree_cache_hits_++;
+      Tree tree = cached->second;
+      translateTree(tree, min_x, min_y);
+      return tree;
+    }
+    tree_cache_misses_++;
+  }
+
+  Tree tree = buildSteinerTree(x, y, drvr_index, alpha);
+
+  Tree cached_tree = tree;
+  translateTree(cached_tree, -min_x, -min_y);
+  std::lock_guard<std::mutex> lock(tree_cache_mutex_);
+  if (tree_cache_.size() >= tree_cache_size_) {
+    // bound the cache by starting over
+    tree_cache_.clear();
+  }
+  tree_cache_.emplace(std::move(key), std::move(cached_tree));
+
+  return tree;
+}
+
+Tree SteinerTreeBuilder::buildSteinerTree(const std::vector<int>& x,
+                                          const std::vector<int>& y,
+                                          const int drvr_index,
+                                          const float alpha)
 {
   if (alpha > 0.0) {
     Tree tree = pdr::primDijkstra(x, y, drvr_index, alpha, logger_);
@@ -117,6 +200,68 @@ Tree SteinerTreeBuilder::makeSteinerTree(const std::vector<int>& x,
   return flt::flutes(x, y, s, accuracy);
 }
 
+void SteinerTreeBuilder::translateTree(Tree& tree, const int dx, const int dy)
+{
+  for (Branch& branch : tree.branch) {
+    branch.x += dx;
+    branch.y += dy;
+  }
+}
+
+bool SteinerTreeBuilder::TreeCacheKey::operator==(
+    const TreeCacheKey& other) const
+{
+  return drvr_index == other.drvr_index && alpha == other.alpha
+         && pins == other.pins;
+}
+
+size_t SteinerTreeBuilder::TreeCacheKeyHash::operator()(
+    const TreeCacheKey& key) const
+{
+  size_t hash = std::hash<int>()(key.drvr_index);
+  auto combine = [&hash](const size_t value) {
+    hash ^= value + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  };
+  combine(std::hash<float>()(key.alpha));
+  for (const int pin : key.pins) {
+    combine(std::hash<int>()(pin));
+  }
+  return hash;
+}
+
+void SteinerTreeBuilder::setTreeCacheSize(const size_t size)
+{
+  std::lock_guard<std::mutex> lock(tree_cache_mutex_);
+  tree_cache_size_ = size;
+  tree_cache_.clear();
+  tree_cache_hits_ = 0;
+  tree_cache_misses_ = 0;
+}
+
+size_t SteinerTreeBuilder::getTreeCacheHits() const
+{
+  std::lock_guard<std::mutex> lock(tree_cache_mutex_);
+  return tree_cache_hits_;
+}
+
+size_t SteinerTreeBuilder::getTreeCacheMisses() const
+{
+  std::lock_guard<std::mutex> lock(tree_cache_mutex_);
+  return tree_cache_misses_;
+}
+
+void SteinerTreeBuilder::reportTreeCache() const
+{
+  std::lock_guard<std::mutex> lock(tree_cache_mutex_);
+  const size_t lookups = tree_cache_hits_ + tree_cache_misses_;
+  logger_->report(
+      "Steiner tree cache: {} trees, {} hits, {} misses ({:.1f}% hit rate)",
+      tree_cache_.size(),
+      tree_cache_hits_,
+      tree_cache_misses_,
+      lookups == 0 ? 0.0 : 100.0 * tree_cache_hits_ / lookups);
+}
+
 static bool rectAreaZero(const odb::Rect& rect)
 {
   return rect.xMin() == rect.xMax() && rect.yMin() == rect.yMax();
@@ -227,7 +372,7 @@ void SteinerTreeBuilder::setMinHPWLAlpha(int min_hpwl, float alpha)
   min_hpwl_alpha_ = {min_hpwl, alpha};
 }
 
-int SteinerTreeBuilder::computeHPWL(odb::dbNet* net)
+int SteinerTreeBuilder::computeHPWL(odb::dbNet* net) const
 {
   int min_x = std::numeric_limits<int>::max();
   int min_y = std::numeric_limits<int>::max();
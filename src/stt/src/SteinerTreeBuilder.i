@@ -90,6 +90,18 @@ set_min_hpwl_alpha(int hpwl, float alpha)
   getSteinerTreeBuilder()->setMinHPWLAlpha(hpwl, alpha);
 }
 
+void
+set_tree_cache_size(int size)
+{
+  getSteinerTreeBuilder()->setTreeCacheSize(size);
+}
+
+void
+report_tree_cache()
+{
+  getSteinerTreeBuilder()->reportTreeCache();
+}
+
 void report_flute_tree(std::vector<int> x,
                        std::vector<int> y,
                        int drvr_index)
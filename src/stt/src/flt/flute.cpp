@@ -33,12 +33,14 @@
 #include "stt/flute.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <climits>
 #include <cmath>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <mutex>
 #include <string>
 
 // Use flute LUT file reader.
@@ -94,6 +96,30 @@ struct point
   int o;
 };
 
+// Buffers for sorting the pins of a net, kept per thread and reused across
+// nets so flute() and flute_wl() do not allocate them for every net.
+struct PinScratch
+{
+  std::vector<int> xs, ys, s;
+  std::vector<point> pt;
+  std::vector<point*> ptp;
+
+  void resize(int d)
+  {
+    xs.resize(d);
+    ys.resize(d);
+    s.resize(d);
+    pt.resize(d + 1);
+    ptp.resize(d + 1);
+  }
+};
+
+static PinScratch& pinScratch()
+{
+  thread_local static PinScratch scratch;
+  return scratch;
+}
+
 Tree dmergetree(Tree t1, Tree t2);
 Tree hmergetree(Tree t1, Tree t2, const std::vector<int>& s);
 Tree vmergetree(Tree t1, Tree t2);
@@ -215,7 +241,9 @@ static void checkLUT(LUT_TYPE LUT1,
 
 // LUTs are initialized to this order at startup.
 static constexpr int lut_initial_d = 8;
-static int lut_valid_d = 0;
+static std::atomic<int> lut_valid_d = 0;
+// Serializes the lazy LUT init for callers on multiple threads.
+static std::mutex lut_mutex;
 
 extern std::string post9;
 extern std::string powv9;
@@ -378,6 +406,10 @@ static void initLUT(int to_d, LUT_TYPE LUT, NUMSOLN_TYPE numsoln)
 
 static void ensureLUT(int d)
 {
+  if (std::min(d, FLUTE_D) <= lut_valid_d) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(lut_mutex);
   if (LUT == nullptr) {
     readLUT();
   }
@@ -522,18 +554,16 @@ int flute_wl(int d,
              int acc)
 {
   int minval, l, xu, xl, yu, yl;
-  std::vector<int> xs, ys;
   int i, j, minidx;
-  std::vector<int> s;
-  struct point **ptp, *tmpp;
-  struct point* pt;
+  struct point* tmpp;
 
-  /* allocate the dynamic pieces on the heap rather than the stack */
-  xs.resize(d);
-  ys.resize(d);
-  s.resize(d);
-  pt = (struct point*) malloc(sizeof(struct point) * (d + 1));
-  ptp = (struct point**) malloc(sizeof(struct point*) * (d + 1));
+  PinScratch& scratch = pinScratch();
+  scratch.resize(d);
+  std::vector<int>& xs = scratch.xs;
+  std::vector<int>& ys = scratch.ys;
+  std::vector<int>& s = scratch.s;
+  std::vector<point>& pt = scratch.pt;
+  std::vector<point*>& ptp = scratch.ptp;
 
   if (d == 2) {
     l = ADIFF(x[0], x[1]) + ADIFF(y[0], y[1]);
@@ -615,8 +645,6 @@ int flute_wl(int d,
 
     l = flutes_wl(d, xs, ys, s, acc);
   }
-  free(pt);
-  free(ptp);
 
   return l;
 }
@@ -1046,11 +1074,9 @@ static bool ordery(const point* a, const point* b)
 
 Tree flute(const std::vector<int>& x, const std::vector<int>& y, int acc)
 {
-  std::vector<int> xs, ys;
   int minval;
-  std::vector<int> s;
   int i, j, minidx;
-  struct point *pt, *tmpp;
+  struct point* tmpp;
   Tree t;
   int d = x.size();
 
@@ -1074,11 +1100,13 @@ Tree flute(const std::vector<int>& x, const std::vector<int>& y, int acc)
   } else {
     ensureLUT(d);
 
-    xs.resize(d);
-    ys.resize(d);
-    s.resize(d);
-    pt = (struct point*) malloc(sizeof(struct point) * (d + 1));
-    std::vector<point*> ptp(d + 1);
+    PinScratch& scratch = pinScratch();
+    scratch.resize(d);
+    std::vector<int>& xs = scratch.xs;
+    std::vector<int>& ys = scratch.ys;
+    std::vector<int>& s = scratch.s;
+    std::vector<point>& pt = scratch.pt;
+    std::vector<point*>& ptp = scratch.ptp;
 
     for (i = 0; i < d; i++) {
       pt[i].x = x[i];
@@ -1150,8 +1178,6 @@ Tree flute(const std::vector<int>& x, const std::vector<int>& y, int acc)
     }
 
     t = flutes(xs, ys, s, acc);
-
-    free(pt);
   }
 
   return t;
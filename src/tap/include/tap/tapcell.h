@@ -174,7 +174,7 @@ class Tapcell
   std::optional<int> findValidLocation(int x,
                                        int width,
                                        const odb::dbOrientType& orient,
-                                       const std::set<odb::dbInst*>& row_insts,
+                                       const std::vector<odb::Rect>& row_insts,
                                        int site_width,
                                        int tap_width,
                                        int row_urx,
@@ -182,15 +182,16 @@ class Tapcell
   bool isOverlapping(int x,
                      int width,
                      const odb::dbOrientType& orient,
-                     const std::set<odb::dbInst*>& row_insts);
+                     const std::vector<odb::Rect>& row_insts);
   int placeTapcells(odb::dbMaster* tapcell_master,
                     int dist,
                     bool disallow_one_site_gaps);
-  int placeTapcells(odb::dbMaster* tapcell_master,
-                    int dist,
-                    odb::dbRow* row,
-                    bool is_edge,
-                    bool disallow_one_site_gaps);
+  std::vector<int> findTapcellLocations(odb::dbMaster* tapcell_master,
+                                        int dist,
+                                        odb::dbRow* row,
+                                        bool is_edge,
+                                        bool disallow_one_site_gaps,
+                                        std::vector<odb::Rect> row_insts);
 
   int defaultDistance() const;
 
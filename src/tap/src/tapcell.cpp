@@ -35,6 +35,7 @@
 
 #include "tap/tapcell.h"
 
+#include <algorithm>
 #include <map>
 #include <optional>
 #include <string>
@@ -160,31 +161,104 @@ int Tapcell::placeTapcells(odb::dbMaster* tapcell_master,
     edge_rows.insert(rows.begin(), rows.end());
   }
 
-  int inst = 0;
-  for (auto* row : db_->getChip()->getBlock()->getRows()) {
+  odb::dbBlock* block = db_->getChip()->getBlock();
+
+  // Fixed instances sorted by their bottom so each row only looks at the
+  // instances starting within its height.
+  std::vector<std::pair<odb::dbInst*, odb::Rect>> fixed_insts;
+  for (auto* inst : block->getInsts()) {
+    if (inst->isFixed()) {
+      fixed_insts.emplace_back(inst, inst->getBBox()->getBox());
+    }
+  }
+  std::stable_sort(
+      fixed_insts.begin(), fixed_insts.end(), [](const auto& a, const auto& b) {
+        return a.second.yMin() < b.second.yMin();
+      });
+
+  std::vector<odb::dbRow*> rows;
+  for (auto* row : block->getRows()) {
+    rows.push_back(row);
+  }
+
+  // Rows are independent, so the locations are computed in parallel and the
+  // instances are created afterwards in row order.
+  std::vector<std::vector<int>> locations(rows.size());
+  const int row_cnt = rows.size();
+#pragma omp parallel for schedule(dynamic) \
+    num_threads(ord::OpenRoad::openRoad()->getThreadCount())
+  for (int i = 0; i < row_cnt; ++i) {
+    odb::dbRow* row = rows[i];
+    const odb::Rect row_bb = row->getBBox();
+
+    std::vector<std::pair<odb::dbInst*, odb::Rect>> row_fixed;
+    auto itr = std::lower_bound(
+        fixed_insts.begin(),
+        fixed_insts.end(),
+        row_bb.yMin(),
+        [](const auto& entry, int y) { return entry.second.yMin() < y; });
+    for (; itr != fixed_insts.end() && itr->second.yMin() <= row_bb.yMax();
+         ++itr) {
+      if (row_bb.contains(itr->second)) {
+        row_fixed.push_back(*itr);
+      }
+    }
+    // keep the instance ordering of the former std::set<dbInst*>
+    std::sort(row_fixed.begin(),
+              row_fixed.end(),
+              [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    std::vector<odb::Rect> row_insts;
+    row_insts.reserve(row_fixed.size());
+    for (const auto& [inst, bbox] : row_fixed) {
+      row_insts.push_back(bbox);
+    }
+
     const bool is_edge = edge_rows.find(row) != edge_rows.end();
-    inst += placeTapcells(
-        tapcell_master, dist, row, is_edge, disallow_one_site_gaps);
+    locations[i] = findTapcellLocations(tapcell_master,
+                                        dist,
+                                        row,
+                                        is_edge,
+                                        disallow_one_site_gaps,
+                                        std::move(row_insts));
+  }
+
+  int inst = 0;
+  for (int i = 0; i < row_cnt; ++i) {
+    odb::dbRow* row = rows[i];
+    const std::string prefix
+        = fmt::format("{}TAPCELL_{}_", tap_prefix_, row->getName());
+    const int lly = row->getBBox().yMin();
+    for (const int x : locations[i]) {
+      if (makeInstance(
+              block, tapcell_master, row->getOrient(), x, lly, prefix)) {
+        inst++;
+      }
+    }
   }
   logger_->info(utl::TAP, 5, "Inserted {} tapcells.", inst);
   return inst;
 }
 
-int Tapcell::placeTapcells(odb::dbMaster* tapcell_master,
-                           const int dist,
-                           odb::dbRow* row,
-                           const bool is_edge,
-                           const bool disallow_one_site_gaps)
+std::vector<int> Tapcell::findTapcellLocations(
+    odb::dbMaster* tapcell_master,
+    const int dist,
+    odb::dbRow* row,
+    const bool is_edge,
+    const bool disallow_one_site_gaps,
+    std::vector<odb::Rect> row_insts)
 {
+  std::vector<int> locations;
+
   if (row->getSite()->getName() != tapcell_master->getSite()->getName()) {
-    return 0;
+    return locations;
   }
   if (!checkSymmetry(tapcell_master, row->getOrient())) {
-    return 0;
+    return locations;
   }
 
   const int tap_width = tapcell_master->getWidth();
-  int insts = 0;
+  const int tap_height = tapcell_master->getHeight();
 
   int offset = 0;
   int pitch_mult = 2;
@@ -202,17 +276,6 @@ int Tapcell::placeTapcells(odb::dbMaster* tapcell_master,
 
   const odb::Rect row_bb = row->getBBox();
 
-  std::set<odb::dbInst*> row_insts;
-  for (auto* inst : db_->getChip()->getBlock()->getInsts()) {
-    if (!inst->isFixed()) {
-      continue;
-    }
-
-    if (row_bb.contains(inst->getBBox()->getBox())) {
-      row_insts.insert(inst);
-    }
-  }
-
   const int llx = row_bb.xMin();
   const int urx = row_bb.xMax();
 
@@ -231,20 +294,14 @@ int Tapcell::placeTapcells(odb::dbMaster* tapcell_master,
                                                  disallow_one_site_gaps);
     if (x_loc) {
       const int lly = row_bb.yMin();
-      auto* inst = makeInstance(
-          db_->getChip()->getBlock(),
-          tapcell_master,
-          ori,
-          *x_loc,
-          lly,
-          fmt::format("{}TAPCELL_{}_", tap_prefix_, row->getName()));
-      row_insts.insert(inst);
-      insts++;
+      row_insts.emplace_back(
+          *x_loc, lly, *x_loc + tap_width, lly + tap_height);
+      locations.push_back(*x_loc);
       x = *x_loc;
     }
   }
 
-  return insts;
+  return locations;
 }
 
 inline void findStartEnd(int x,
@@ -266,7 +323,7 @@ std::optional<int> Tapcell::findValidLocation(
     const int x,
     const int width,
     const odb::dbOrientType& orient,
-    const std::set<odb::dbInst*>& row_insts,
+    const std::vector<odb::Rect>& row_insts,
     const int site_width,
     const int tap_width,
     const int row_urx,
@@ -284,8 +341,7 @@ std::optional<int> Tapcell::findValidLocation(
 
   PartialOverlap partially_overlap;
   bool overlap = false;
-  for (const auto& inst : row_insts) {
-    const odb::Rect inst_bb = inst->getBBox()->getBox();
+  for (const odb::Rect& inst_bb : row_insts) {
     if (x_end > inst_bb.xMin() && x_start < inst_bb.xMax()) {
       partially_overlap.left = x_end > inst_bb.xMax();
       partially_overlap.x_start_left = inst_bb.xMax();
@@ -321,14 +377,13 @@ std::optional<int> Tapcell::findValidLocation(
 bool Tapcell::isOverlapping(const int x,
                             const int width,
                             const odb::dbOrientType& orient,
-                            const std::set<odb::dbInst*>& row_insts)
+                            const std::vector<odb::Rect>& row_insts)
 {
   int x_start;
   int x_end;
   findStartEnd(x, width, orient, x_start, x_end);
 
-  for (const auto& inst : row_insts) {
-    const odb::Rect inst_bb = inst->getBBox()->getBox();
+  for (const odb::Rect& inst_bb : row_insts) {
     if (x_end > inst_bb.xMin() && x_start < inst_bb.xMax()) {
       return true;
     }
@@ -35,10 +35,17 @@
 
 #include "upf/upf.h"
 
+#include <map>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
 #include "db_sta/dbNetwork.hh"
 #include "db_sta/dbSta.hh"
 #include "sta/FuncExpr.hh"
 #include "sta/Liberty.hh"
+#include "utl/ThreadPool.h"
 #include "writer.h"
 
 namespace upf {
@@ -582,17 +589,19 @@ static bool add_insts_to_group(
   return true;
 }
 
-static bool find_smallest_inverter(sta::dbNetwork* network,
-                                   odb::dbBlock* block,
-                                   odb::dbMaster*& inverter_m,
-                                   odb::dbMTerm*& input_m,
-                                   odb::dbMTerm*& output_m)
+// The smallest inverter of the libraries
+struct Inverter
 {
-  float smallest_area = std::numeric_limits<float>::max();
-  sta::LibertyCell* smallest_inverter = nullptr;
-  sta::LibertyPort *inverter_input = nullptr, *inverter_output = nullptr;
+  odb::dbMaster* master = nullptr;
+  odb::dbMTerm* input = nullptr;
+  odb::dbMTerm* output = nullptr;
+};
 
-  bool found = false;
+static Inverter find_smallest_inverter(sta::dbNetwork* network,
+                                       odb::dbBlock* block)
+{
+  float smallest_area = std::numeric_limits<float>::max();
+  Inverter inverter;
 
   auto libs = block->getDataBase()->getLibs();
   for (auto&& lib : libs) {
@@ -604,17 +613,16 @@ static bool find_smallest_inverter(sta::dbNetwork* network,
       if (libcell_ && libcell_->isInverter()
           && libcell_->area() < smallest_area) {
         smallest_area = libcell_->area();
-        smallest_inverter = libcell_;
-        smallest_inverter->bufferPorts(inverter_input, inverter_output);
-        inverter_m = network->staToDb(smallest_inverter);
-        input_m = network->staToDb(inverter_input);
-        output_m = network->staToDb(inverter_output);
-        found = true;
+        sta::LibertyPort *inverter_input = nullptr, *inverter_output = nullptr;
+        libcell_->bufferPorts(inverter_input, inverter_output);
+        inverter.master = network->staToDb(libcell_);
+        inverter.input = network->staToDb(inverter_input);
+        inverter.output = network->staToDb(inverter_output);
       }
     }
   }
 
-  return found;
+  return inverter;
 }
 
 static bool find_smallest_isolation(sta::dbNetwork* network,
@@ -903,9 +911,43 @@ static bool isolate_port(utl::Logger* logger,
   return true;
 }
 
+// Power domain of every instance, indexed by the instance id, so the
+// domain of a connected instance is not looked up by its group name.
+class DomainIndex
+{
+ public:
+  explicit DomainIndex(odb::dbBlock* block)
+  {
+    uint max_id = 0;
+    for (odb::dbInst* inst : block->getInsts()) {
+      max_id = std::max(max_id, inst->getId());
+    }
+    domains_.resize(max_id + 1, nullptr);
+    for (odb::dbPowerDomain* domain : block->getPowerDomains()) {
+      odb::dbGroup* group = domain->getGroup();
+      if (!group) {
+        continue;
+      }
+      for (odb::dbInst* inst : group->getInsts()) {
+        domains_[inst->getId()] = domain;
+      }
+    }
+  }
+
+  // nullptr for the instances of the top domain
+  odb::dbPowerDomain* getDomain(odb::dbInst* inst) const
+  {
+    const uint id = inst->getId();
+    return id < domains_.size() ? domains_[id] : nullptr;
+  }
+
+ private:
+  std::vector<odb::dbPowerDomain*> domains_;
+};
+
 // Returns all connected iterms that are not in the same power domain
 static std::vector<std::pair<odb::dbITerm*, odb::dbPowerDomain*>>
-get_connected_terms(odb::dbBlock* block, odb::dbITerm* iterm)
+get_connected_terms(const DomainIndex& domains, odb::dbITerm* iterm)
 {
   std::vector<std::pair<odb::dbITerm*, odb::dbPowerDomain*>> external_iterms;
   auto net = iterm->getNet();
@@ -920,21 +962,15 @@ get_connected_terms(odb::dbBlock* block, odb::dbITerm* iterm)
     return external_iterms;
   }
 
+  odb::dbPowerDomain* domain = domains.getDomain(iterm->getInst());
   for (auto&& connectedIterm : connectedIterms) {
     if (connectedIterm == iterm) {
       continue;
     }
 
-    auto connectedInst = connectedIterm->getInst();
-    // TODO: if connectedInst is isolation cell or level shifting cell
-    // then ignore it
-
-    if (connectedInst->getGroup() != iterm->getInst()->getGroup()) {
-      odb::dbPowerDomain* connectedDomain = nullptr;
-      if (connectedInst->getGroup()) {
-        connectedDomain
-            = block->findPowerDomain(connectedInst->getGroup()->getName());
-      }
+    odb::dbPowerDomain* connectedDomain
+        = domains.getDomain(connectedIterm->getInst());
+    if (connectedDomain != domain) {
       external_iterms.emplace_back(connectedIterm, connectedDomain);
     }
   }
@@ -942,25 +978,28 @@ get_connected_terms(odb::dbBlock* block, odb::dbITerm* iterm)
   return external_iterms;
 }
 
-static bool isolate_connection(odb::dbITerm* src_term,
-                               odb::dbITerm* target_term,
-                               odb::dbPowerDomain* domain,
-                               odb::dbBlock* block,
-                               utl::Logger* logger,
-                               sta::dbNetwork* network)
+// The isolation strategy of a power domain and the cell it inserts
+struct DomainIsolation
 {
-  odb::dbInst* src_inst = src_term->getInst();
-
-  // find the smallest possible inverter in advance
-  odb::dbMaster* inverter_m = nullptr;
-  odb::dbMTerm *input_m = nullptr, *output_m = nullptr;
-  bool inverter_found
-      = find_smallest_inverter(network, block, inverter_m, input_m, output_m);
-
+  odb::dbIsolation* iso = nullptr;  // nullptr if the domain isn't isolated
+  odb::dbMaster* master = nullptr;
+  odb::dbMTerm* enable_term = nullptr;
+  odb::dbMTerm* data_term = nullptr;
+  odb::dbMTerm* output_term = nullptr;
+  bool invert_output = false;
+  bool invert_control = false;
+};
+
+static DomainIsolation find_domain_isolation(odb::dbPowerDomain* domain,
+                                             const Inverter& inverter,
+                                             utl::Logger* logger,
+                                             sta::dbNetwork* network)
+{
+  DomainIsolation isolation;
   auto isos = domain->getIsolations();
 
   if (isos.empty()) {
-    return false;
+    return isolation;
   }
 
   if (isos.size() > 1) {
@@ -973,45 +1012,56 @@ static bool isolate_connection(odb::dbITerm* src_term,
 
   odb::dbIsolation* iso = isos[0];
 
-  odb::dbMTerm* enable_term = nullptr;
-  odb::dbMTerm* data_term = nullptr;
-  odb::dbMTerm* output_term = nullptr;
-  odb::dbMaster* smallest_iso_m = nullptr;
-  bool invert_output, invert_control;
-
   if (!find_smallest_isolation(network,
                                logger,
                                iso,
-                               smallest_iso_m,
-                               enable_term,
-                               data_term,
-                               output_term,
-                               invert_output,
-                               invert_control)) {
-    return false;
+                               isolation.master,
+                               isolation.enable_term,
+                               isolation.data_term,
+                               isolation.output_term,
+                               isolation.invert_output,
+                               isolation.invert_control)) {
+    return isolation;
   }
 
-  if ((invert_output || invert_control) && !inverter_found) {
+  if ((isolation.invert_output || isolation.invert_control)
+      && !inverter.master) {
     logger->warn(utl::UPF, 31, "can't find any inverters");
+    return isolation;
+  }
+
+  isolation.iso = iso;
+  return isolation;
+}
+
+static bool isolate_connection(odb::dbITerm* src_term,
+                               odb::dbITerm* target_term,
+                               odb::dbPowerDomain* domain,
+                               const DomainIsolation& isolation,
+                               const Inverter& inverter,
+                               odb::dbBlock* block,
+                               utl::Logger* logger)
+{
+  if (!isolation.iso) {
     return false;
   }
 
   return isolate_port(logger,
                       block,
-                      src_inst,
+                      src_term->getInst(),
                       src_term,
                       target_term,
                       domain,
-                      iso,
-                      enable_term,
-                      data_term,
-                      output_term,
-                      smallest_iso_m,
-                      invert_output,
-                      invert_control,
-                      inverter_m,
-                      input_m,
-                      output_m);
+                      isolation.iso,
+                      isolation.enable_term,
+                      isolation.data_term,
+                      isolation.output_term,
+                      isolation.master,
+                      isolation.invert_output,
+                      isolation.invert_control,
+                      inverter.master,
+                      inverter.input,
+                      inverter.output);
 }
 
 static odb::dbLevelShifter* find_shift_strategy(odb::dbBlock* block,
@@ -1234,6 +1284,84 @@ static bool insert_level_shifter(utl::Logger* logger,
   return true;
 }
 
+// A connection of an instance of a power domain to one of another domain,
+// to be isolated or level shifted
+struct DomainCrossing
+{
+  odb::dbPowerDomain* domain;
+  odb::dbITerm* iterm;
+  odb::dbITerm* target_iterm;
+  odb::dbPowerDomain* target_domain;
+  // The level shifting strategy, nullptr to isolate the connection
+  odb::dbLevelShifter* strategy;
+};
+
+// Finds the connections to isolate or level shift of the instances of all
+// the domains but the top one, in one parallel pass over the instances.
+// The netlist is only read, so the cells inserted for the crossings are
+// not crossings themselves.  The crossings are in the order of the
+// domains, their instances and their iterms.
+static std::vector<DomainCrossing> find_domain_crossings(
+    odb::dbBlock* block,
+    odb::dbPowerDomain* top_domain,
+    const DomainIndex& domain_index,
+    const std::unordered_set<std::string>& level_shifter_cells)
+{
+  auto is_level_shifter = [&](odb::dbInst* inst) {
+    return level_shifter_cells.find(inst->getMaster()->getName())
+           != level_shifter_cells.end();
+  };
+
+  std::vector<std::pair<odb::dbPowerDomain*, odb::dbInst*>> sources;
+  for (auto&& domain : block->getPowerDomains()) {
+    if (domain == top_domain) {
+      continue;
+    }
+    for (auto&& inst : domain->getGroup()->getInsts()) {
+      if (!is_level_shifter(inst)) {
+        sources.emplace_back(domain, inst);
+      }
+    }
+  }
+
+  std::vector<std::vector<DomainCrossing>> inst_crossings(sources.size());
+  utl::ThreadPool::get().parallelFor(0, sources.size(), [&](const int i) {
+    auto [domain, inst] = sources[i];
+    for (auto&& iterm : inst->getITerms()) {
+      for (auto [target_iterm, target_domain] :
+           get_connected_terms(domain_index, iterm)) {
+        // if target instance is a level shifter then skip
+        if (is_level_shifter(target_iterm->getInst())) {
+          continue;
+        }
+
+        // if iterm is output and both domains have same voltage then isolate
+        if (iterm->getIoType() == odb::dbIoType::OUTPUT
+            && (!target_domain
+                || domain->getVoltage() == target_domain->getVoltage())) {
+          inst_crossings[i].push_back(
+              {domain, iterm, target_iterm, target_domain, nullptr});
+          continue;
+        }
+
+        odb::dbLevelShifter* strategy
+            = find_shift_strategy(block, domain, iterm);
+        if (strategy) {
+          inst_crossings[i].push_back(
+              {domain, iterm, target_iterm, target_domain, strategy});
+        }
+      }
+    }
+  });
+
+  std::vector<DomainCrossing> crossings;
+  for (auto& crossings_of_inst : inst_crossings) {
+    crossings.insert(
+        crossings.end(), crossings_of_inst.begin(), crossings_of_inst.end());
+  }
+  return crossings;
+}
+
 bool eval_upf(sta::dbNetwork* network, utl::Logger* logger, odb::dbBlock* block)
 {
   // TODO: NEXT: Lock any further UPF reads
@@ -1271,79 +1399,68 @@ bool eval_upf(sta::dbNetwork* network, utl::Logger* logger, odb::dbBlock* block)
   // get all cell names for level shifter
   // TODO: should be replaced later by querying lib to find if inst is level
   // shifter
-  std::unordered_map<std::string, bool> level_shifter_cells;
+  std::unordered_set<std::string> level_shifter_cells;
   auto shifters = block->getLevelShifters();
   for (auto&& shifter : shifters) {
-    level_shifter_cells[shifter->getCellName()] = true;
+    level_shifter_cells.insert(shifter->getCellName());
   }
 
-  for (auto&& domain : pds) {
-    if (domain == top_domain) {
+  const DomainIndex domain_index(block);
+  const std::vector<DomainCrossing> crossings = find_domain_crossings(
+      block, top_domain, domain_index, level_shifter_cells);
+
+  const Inverter inverter = find_smallest_inverter(network, block);
+  std::map<odb::dbPowerDomain*, DomainIsolation> isolations;
+
+  for (const DomainCrossing& crossing : crossings) {
+    odb::dbITerm* iterm = crossing.iterm;
+    odb::dbITerm* target_iterm = crossing.target_iterm;
+
+    // An earlier isolation or level shifter moved the target off the net
+    if (target_iterm->getNet() != iterm->getNet()) {
       continue;
     }
 
-    odb::dbGroup* curr_group = domain->getGroup();
-    auto insts = curr_group->getInsts();
-
-    for (auto&& inst : insts) {
-      if (level_shifter_cells[inst->getMaster()->getName()]) {
-        continue;
-      }
-      auto iterms = inst->getITerms();
-      for (auto&& iterm : iterms) {
-        // get all connected iterms as well
-        auto connected_iterms = get_connected_terms(block, iterm);
-        for (auto&& connected_iterm : connected_iterms) {
-          odb::dbITerm* target_iterm = connected_iterm.first;
-          odb::dbPowerDomain* target_domain = connected_iterm.second;
-
-          // if target instance is a level shifter then skip
-          if (level_shifter_cells
-                  [target_iterm->getInst()->getMaster()->getName()]) {
-            continue;
-          }
-
-          // if iterm is output and both domains have same voltage then isolate
-          if (iterm->getIoType() == odb::dbIoType::OUTPUT
-              && (!target_domain
-                  || domain->getVoltage() == target_domain->getVoltage())) {
-            isolate_connection(
-                iterm, target_iterm, domain, block, logger, network);
-            continue;
-          }
-
-          odb::dbLevelShifter* strategy
-              = find_shift_strategy(block, domain, iterm);
-
-          if (!strategy) {
-            continue;
-          }
-
-          // check if strategy could be insterted between the two ports
-          bool should_shift = validate_shifting_strategy(block,
-                                                         logger,
-                                                         strategy,
-                                                         iterm,
-                                                         domain,
-                                                         target_iterm,
-                                                         target_domain);
-
-          if (!should_shift) {
-            continue;
-          }
-
-          // insert level shifter between the two ports
-          insert_level_shifter(logger,
-                               block,
-                               inst,
-                               iterm,
-                               target_iterm,
-                               domain,
-                               target_domain,
-                               strategy);
-        }
+    if (!crossing.strategy) {
+      // The isolation cell of a domain is looked up once
+      auto isolation = isolations.find(crossing.domain);
+      if (isolation == isolations.end()) {
+        DomainIsolation domain_isolation = find_domain_isolation(
+            crossing.domain, inverter, logger, network);
+        isolation = isolations.emplace(crossing.domain, domain_isolation).first;
       }
+      isolate_connection(iterm,
+                         target_iterm,
+                         crossing.domain,
+                         isolation->second,
+                         inverter,
+                         block,
+                         logger);
+      continue;
     }
+
+    // check if strategy could be insterted between the two ports
+    bool should_shift = validate_shifting_strategy(block,
+                                                   logger,
+                                                   crossing.strategy,
+                                                   iterm,
+                                                   crossing.domain,
+                                                   target_iterm,
+                                                   crossing.target_domain);
+
+    if (!should_shift) {
+      continue;
+    }
+
+    // insert level shifter between the two ports
+    insert_level_shifter(logger,
+                         block,
+                         iterm->getInst(),
+                         iterm,
+                         target_iterm,
+                         crossing.domain,
+                         crossing.target_domain,
+                         crossing.strategy);
   }
 
   return true;
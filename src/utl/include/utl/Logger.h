@@ -39,7 +39,9 @@
 #include <atomic>
 #include <cstdlib>
 #include <iomanip>
+#include <iterator>
 #include <map>
+#include <memory>
 #include <sstream>
 #include <stack>
 #include <string>
@@ -52,6 +54,10 @@
 #include "spdlog/fmt/ostr.h"
 #include "spdlog/spdlog.h"
 
+namespace spdlog::details {
+class thread_pool;
+}
+
 namespace utl {
 
 // Keep this sorted
@@ -103,6 +109,9 @@ enum ToolId
       SIZE  // the number of tools, do not put anything after this
 };
 
+class MemoryRegistry;
+class Profiler;
+
 class Logger
 {
  public:
@@ -112,6 +121,7 @@ class Logger
   Logger(const Logger& logger) = delete;
   ~Logger();
   static ToolId findToolId(const char* tool_name);
+  static const char* getToolName(ToolId tool) { return tool_names_[tool]; }
 
   template <typename... Args>
   inline void report(const std::string& message, const Args&... args)
@@ -128,13 +138,16 @@ class Logger
                     const Args&... args)
   {
     // Message counters do NOT apply to debug messages.
-    logger_->log(spdlog::level::level_enum::debug,
-                 FMT_RUNTIME("[{} {}-{}] " + message),
-                 level_names[spdlog::level::level_enum::debug],
-                 tool_names_[tool],
-                 group,
-                 args...);
-    logger_->flush();
+    fmt::memory_buffer buffer;
+    fmt::format_to(std::back_inserter(buffer),
+                   "[{} {}-{}] ",
+                   level_names[spdlog::level::level_enum::debug],
+                   tool_names_[tool],
+                   group);
+    logBuffer(spdlog::level::level_enum::debug, buffer, message, args...);
+    if (!async_pool_) {
+      logger_->flush();
+    }
   }
 
   template <typename... Args>
@@ -164,6 +177,7 @@ class Logger
   {
     error_count_++;
     log(tool, spdlog::level::err, id, message, args...);
+    flush();
     char tool_id[32];
     sprintf(tool_id, "%s-%04d", tool_names_[tool], id);
     std::runtime_error except(tool_id);
@@ -178,6 +192,7 @@ class Logger
                                           const Args&... args)
   {
     log(tool, spdlog::level::level_enum::critical, id, message, args...);
+    flush();
     exit(EXIT_FAILURE);
   }
 
@@ -209,11 +224,20 @@ class Logger
     log_metric(std::string(metric), '"' + value + '"');
   }
 
+  // Adds one point to a series metric, eg
+  //   logger->metricSeries("route__iteration",
+  //                        {{"drc_errors", errors}, {"runtime", seconds}});
+  // The name is prefixed by the metrics stage like metric().  Each series
+  // is written as a single entry with one array of values per column.
+  void metricSeries(std::string_view series_name, MetricsSeries::Point point);
+
   void setDebugLevel(ToolId tool, const char* group, int level);
 
   bool debugCheck(ToolId tool, const char* group, int level) const
   {
-    if (!debug_on_) {
+    // Most calls are for tools without any debug group enabled at this
+    // level; reject those without touching the group map.
+    if (level > debug_max_level_[tool].load(std::memory_order_relaxed)) {
       return false;
     }
     auto& groups = debug_group_level_[tool];
@@ -227,6 +251,16 @@ class Logger
   void addSink(spdlog::sink_ptr sink);
   void removeSink(spdlog::sink_ptr sink);
   void addMetricsSink(const char* metrics_filename);
+
+  // Messages are formatted by the calling thread and written to the sinks
+  // by a background thread, in the order they were logged.  Errors and
+  // criticals still wait until they are written.  Neither call may run
+  // while other threads are logging.
+  void startAsyncLogging(size_t queue_size = default_async_queue_size);
+  void stopAsyncLogging();
+  bool isAsyncLogging() const { return async_pool_ != nullptr; }
+  // Returns once every message logged so far is written to the sinks.
+  void flush();
   void removeMetricsSink(const char* metrics_filename);
 
   void setMetricsStage(std::string_view format);
@@ -234,9 +268,24 @@ class Logger
   void pushMetricsStage(std::string_view format);
   std::string popMetricsStage();
 
+  // Records utl::ProfileScopes until stopProfiling, which reports them as
+  // metrics.  A Chrome/Perfetto trace is also written if a filename is
+  // given.
+  void startProfiling(const char* trace_filename = nullptr);
+  void stopProfiling();
+  bool isProfiling() const
+  {
+    return profiling_.load(std::memory_order_relaxed);
+  }
+  Profiler* getProfiler() const { return profiler_.get(); }
+
+  // Memory owned by the tools, see report_memory_usage.
+  MemoryRegistry* getMemoryRegistry() const { return memory_registry_.get(); }
+
  private:
   std::vector<std::string> metrics_sinks_;
   std::list<MetricsEntry> metrics_entries_;
+  std::map<std::string, MetricsSeries> metrics_series_;
   std::vector<MetricsPolicy> metrics_policies_;
 
   template <typename... Args>
@@ -250,12 +299,13 @@ class Logger
     auto& counter = message_counters_[tool][id];
     auto count = counter++;
     if (count < max_message_print) {
-      logger_->log(level,
-                   FMT_RUNTIME("[{} {}-{:04d}] " + message),
-                   level_names[level],
-                   tool_names_[tool],
-                   id,
-                   args...);
+      fmt::memory_buffer buffer;
+      fmt::format_to(std::back_inserter(buffer),
+                     "[{} {}-{:04d}] ",
+                     level_names[level],
+                     tool_names_[tool],
+                     id);
+      logBuffer(level, buffer, message, args...);
       return;
     }
 
@@ -271,18 +321,39 @@ class Logger
     }
   }
 
+  // Appends the message to the already formatted prefix in buffer.  This
+  // avoids building a prefixed format string on the heap for every call.
+  template <typename... Args>
+  inline void logBuffer(spdlog::level::level_enum level,
+                        fmt::memory_buffer& buffer,
+                        const std::string& message,
+                        const Args&... args)
+  {
+    try {
+      fmt::format_to(std::back_inserter(buffer), FMT_RUNTIME(message), args...);
+    } catch (const std::exception&) {
+      // Let spdlog report the bad format string as it always has.
+      logger_->log(level, FMT_RUNTIME(message), args...);
+      return;
+    }
+    logger_->log(level, spdlog::string_view_t(buffer.data(), buffer.size()));
+  }
+
   inline void log_metric(const std::string metric, const std::string value)
   {
-    std::string key;
+    metrics_entries_.push_back({metricKey(metric), value});
+  }
+
+  std::string metricKey(std::string_view metric) const
+  {
     if (metrics_stages_.empty())
-      key = metric;
-    else
-      key = fmt::format(FMT_RUNTIME(metrics_stages_.top()), metric);
-    metrics_entries_.push_back({std::move(key), value});
+      return std::string(metric);
+    return fmt::format(FMT_RUNTIME(metrics_stages_.top()), metric);
   }
 
   void flushMetrics();
   void finalizeMetrics();
+  void makeLogger();
 
   // Allows for lookup by a compatible key (ie string_view)
   // to avoid constructing a key (string) just for lookup
@@ -301,6 +372,10 @@ class Logger
   // Stop issuing messages of a given tool/id when this limit is hit.
   static constexpr int max_message_print = 1000;
 
+  static constexpr size_t default_async_queue_size = 8192;
+
+  class FlushWaiter;
+
   std::vector<spdlog::sink_ptr> sinks_;
   std::shared_ptr<spdlog::logger> logger_;
   std::stack<std::string> metrics_stages_;
@@ -310,9 +385,15 @@ class Logger
   using MessageCounter = std::array<std::atomic_int16_t, max_message_id + 1>;
   std::array<MessageCounter, ToolId::SIZE> message_counters_;
   std::array<DebugGroups, ToolId::SIZE> debug_group_level_;
-  bool debug_on_;
+  // Highest level of any debug group of the tool, 0 if none is enabled.
+  std::array<std::atomic_int, ToolId::SIZE> debug_max_level_;
+  std::shared_ptr<spdlog::details::thread_pool> async_pool_;
+  std::shared_ptr<FlushWaiter> flush_waiter_;
   std::atomic_int warning_count_;
   std::atomic_int error_count_;
+  std::atomic_bool profiling_;
+  std::unique_ptr<Profiler> profiler_;
+  std::unique_ptr<MemoryRegistry> memory_registry_;
   static constexpr const char* level_names[]
       = {"TRACE", "DEBUG", "INFO", "WARNING", "ERROR", "CRITICAL", "OFF"};
   static constexpr const char* pattern_ = "%v";
@@ -0,0 +1,133 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "utl/Logger.h"
+
+namespace utl {
+
+class MemoryRegistry;
+
+// An entry of the MemoryRegistry.  It removes the entry when destroyed, so
+// a tool keeps it as a member.
+class MemoryRegistration
+{
+ public:
+  MemoryRegistration() = default;
+  MemoryRegistration(MemoryRegistration&& other) noexcept;
+  MemoryRegistration& operator=(MemoryRegistration&& other) noexcept;
+  ~MemoryRegistration();
+
+  MemoryRegistration(const MemoryRegistration&) = delete;
+  MemoryRegistration& operator=(const MemoryRegistration&) = delete;
+
+ private:
+  MemoryRegistration(MemoryRegistry* registry, int id)
+      : registry_(registry), id_(id)
+  {
+  }
+
+  MemoryRegistry* registry_ = nullptr;
+  int id_ = 0;
+
+  friend class MemoryRegistry;
+};
+
+// Tools register the memory they own here so report_memory_usage can show
+// which of them holds memory at peak.  The counters are called when the
+// usage is reported, so they should be cheap estimates (container
+// capacities times element sizes) rather than exact heap accounting.
+//
+// The registry also holds the release on exit mode: when it is on, tools
+// free their internal structures once their results are committed to the
+// db instead of keeping them for a later incremental call.
+class MemoryRegistry
+{
+ public:
+  // Returns the bytes currently owned.
+  using Counter = std::function<int64_t()>;
+
+  struct Usage
+  {
+    ToolId tool;
+    std::string name;
+    int64_t bytes;
+  };
+
+  [[nodiscard]] MemoryRegistration add(ToolId tool,
+                                       const std::string& name,
+                                       Counter counter);
+
+  // Usage of every entry, ordered by tool and name.
+  std::vector<Usage> getUsage() const;
+
+  // Reports the usage and the process RSS and emits them as
+  // memory__<tool>__<name>__bytes metrics.
+  void report(Logger* logger) const;
+
+  void setReleaseOnExit(bool release) { release_on_exit_ = release; }
+  bool releaseOnExit() const
+  {
+    return release_on_exit_.load(std::memory_order_relaxed);
+  }
+
+  static int64_t currentRSS();  // kB
+
+ private:
+  struct Entry
+  {
+    ToolId tool;
+    std::string name;
+    Counter counter;
+  };
+
+  void remove(int id);
+
+  friend class MemoryRegistration;
+
+  mutable std::mutex lock_;
+  std::map<int, Entry> entries_;
+  int next_id_ = 1;
+  std::atomic_bool release_on_exit_{false};
+};
+
+}  // namespace utl
@@ -35,9 +35,13 @@
 
 #pragma once
 
+#include <initializer_list>
 #include <list>
 #include <regex>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 namespace utl {
 
@@ -49,6 +53,27 @@ struct MetricsEntry
   static std::string assembleJSON(const std::list<MetricsEntry>& entries);
 };
 
+// A metric recorded once per iteration of a long running stage, eg the
+// violations and runtime of each detailed routing iteration.  Values are
+// stored by column and written as one JSON object holding an array per
+// column.
+class MetricsSeries
+{
+ public:
+  using Point = std::initializer_list<std::pair<std::string_view, double>>;
+
+  // Columns missing from a point, or not seen in earlier points, are
+  // filled with null.
+  void append(Point point);
+  size_t size() const { return size_; }
+  std::string toJSON() const;
+
+ private:
+  std::vector<std::string> columns_;
+  std::vector<std::vector<double>> values_;
+  size_t size_ = 0;
+};
+
 enum class MetricsPolicyType
 {
   KeepFirst,
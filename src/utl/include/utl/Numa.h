@@ -0,0 +1,92 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#pragma once
+
+namespace utl {
+
+// NUMA placement for runs spanning several sockets, set by set_thread_count.
+//
+// The binding pins the worker threads (utl::ThreadPool and the OpenMP
+// threads) to CPUs, either filling one node before the next (CLOSE) or
+// round robin over the nodes (SPREAD), so the data a thread first touches
+// stays on its node.  The calling thread is never pinned, so the threads
+// it starts later keep the whole process mask.
+//
+// With interleaving on, a ScopedInterleave spreads the pages of the
+// read-mostly structures one thread builds for all of them, such as the
+// drt region query and rule tables, over the nodes instead of leaving
+// them all on the node of the building thread.
+class Numa
+{
+ public:
+  enum class Binding
+  {
+    NONE,
+    CLOSE,
+    SPREAD
+  };
+
+  static void setBinding(Binding binding);
+  static Binding getBinding();
+  static void setInterleave(bool interleave);
+  static bool interleaveEnabled();
+
+  // Nodes of the CPUs this process may run on; 1 when unknown.
+  static int nodeCount();
+
+  // CPU the thread of the given index is bound to, -1 for NONE.  Index 0
+  // is the calling thread, which is not pinned.
+  static int cpuForThread(int index, Binding binding);
+
+  // Pins the calling thread to cpu, or releases it to the process mask
+  // for -1.  Returns false if the system refused.
+  static bool bindCurrentThread(int cpu);
+};
+
+// While alive, and if interleaving is on, the pages the calling thread
+// first touches are interleaved over the NUMA nodes.  Scopes nest.
+class ScopedInterleave
+{
+ public:
+  ScopedInterleave();
+  ~ScopedInterleave();
+
+  ScopedInterleave(const ScopedInterleave&) = delete;
+  ScopedInterleave& operator=(const ScopedInterleave&) = delete;
+
+ private:
+  bool active_ = false;
+};
+
+}  // namespace utl
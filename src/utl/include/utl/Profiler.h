@@ -0,0 +1,140 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "utl/Logger.h"
+
+namespace utl {
+
+// Collects the measurements of ProfileScopes while the Logger is
+// profiling (see Logger::startProfiling).  The aggregated results are
+// reported as metrics and, optionally, every scope is written as an event
+// of a Chrome/Perfetto trace when profiling stops.
+class Profiler
+{
+ public:
+  struct Stats
+  {
+    int64_t calls = 0;
+    double wall_time = 0.0;  // seconds
+    double cpu_time = 0.0;   // seconds, of the thread running the scope
+    int64_t peak_rss_growth = 0;  // kB, largest growth of the peak RSS
+  };
+
+  // The tool and the '/' separated names of the nested scopes
+  using Key = std::pair<ToolId, std::string>;
+
+  void start(const char* trace_filename);
+  void stop(Logger* logger);
+
+  void record(ToolId tool,
+              const std::string& path,
+              const char* name,
+              std::chrono::steady_clock::time_point start,
+              double wall_time,
+              double cpu_time,
+              int64_t peak_rss_growth);
+
+  std::map<Key, Stats> getStats() const;
+
+  static double threadCpuTime();  // seconds
+  static int64_t peakRSS();       // kB
+
+ private:
+  struct TraceEvent
+  {
+    ToolId tool;
+    std::string name;
+    int thread;
+    int64_t start;     // us since profiling started
+    int64_t duration;  // us
+    double cpu_time;
+    int64_t peak_rss_growth;
+  };
+
+  void writeTrace(Logger* logger) const;
+
+  mutable std::mutex lock_;
+  std::map<Key, Stats> stats_;
+  std::string trace_filename_;
+  std::vector<TraceEvent> trace_;
+  std::chrono::steady_clock::time_point epoch_;
+};
+
+// Measures the wall time, CPU time and peak RSS growth of the enclosing
+// scope and records it under the given tool.  Scopes nest per thread, so
+// "route" opened inside "global_route" is reported as
+// "global_route/route".  When profiling is off a scope only costs a
+// relaxed atomic load.
+class ProfileScope
+{
+ public:
+  ProfileScope(Logger* logger, ToolId tool, const char* name)
+      : profiler_(nullptr), tool_(tool), name_(name)
+  {
+    if (logger->isProfiling()) {
+      begin(logger->getProfiler());
+    }
+  }
+  ~ProfileScope()
+  {
+    if (profiler_ != nullptr) {
+      end();
+    }
+  }
+
+  ProfileScope(const ProfileScope&) = delete;
+  ProfileScope& operator=(const ProfileScope&) = delete;
+
+ private:
+  void begin(Profiler* profiler);
+  void end();
+
+  Profiler* profiler_;
+  ToolId tool_;
+  const char* name_;
+  std::chrono::steady_clock::time_point start_;
+  double cpu_start_ = 0.0;
+  int64_t peak_rss_start_ = 0;
+};
+
+}  // namespace utl
@@ -0,0 +1,153 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "utl/Numa.h"
+
+namespace utl {
+
+class TaskGroup;
+
+// Process wide pool of worker threads shared by the tools so that tools
+// calling each other do not each start their own threads.  Its size is set
+// by OpenRoad::setThreadCount, and the workers are pinned per the
+// Numa::Binding in effect then.
+//
+// A thread waiting on a TaskGroup runs queued tasks while it waits, so
+// parallelFor and TaskGroups may be nested inside tasks without deadlock
+// and without using more than the configured number of threads.
+class ThreadPool
+{
+ public:
+  ~ThreadPool();
+
+  static ThreadPool& get();
+
+  // The number of threads including the thread that waits on the work.
+  // Must not be called while tasks are running.
+  void setThreadCount(int threads);
+  int getThreadCount() const { return static_cast<int>(workers_.size()) + 1; }
+
+  // Calls func(i) for every i in [begin, end) in parallel and returns once
+  // all calls finished.  The first exception thrown by func is rethrown.
+  template <typename Func>
+  void parallelFor(int begin, int end, const Func& func);
+
+ private:
+  friend class TaskGroup;
+
+  struct GroupState
+  {
+    int pending = 0;  // guarded by the pool lock
+    std::exception_ptr exception;
+  };
+
+  struct Task
+  {
+    std::function<void()> func;
+    std::shared_ptr<GroupState> group;
+  };
+
+  void submit(Task task);
+  void wait(GroupState& group);
+  void execute(Task& task);
+  void workerLoop();
+  void stopWorkers();
+
+  std::vector<std::thread> workers_;
+  std::deque<Task> queue_;
+  std::mutex lock_;
+  std::condition_variable changed_;
+  bool stop_ = false;
+  Numa::Binding binding_ = Numa::Binding::NONE;
+};
+
+// A set of tasks run on a ThreadPool.  wait() returns once every task ran
+// and rethrows the first exception a task threw.  The destructor waits.
+class TaskGroup
+{
+ public:
+  explicit TaskGroup(ThreadPool& pool = ThreadPool::get());
+  ~TaskGroup();
+
+  TaskGroup(const TaskGroup&) = delete;
+  TaskGroup& operator=(const TaskGroup&) = delete;
+
+  void run(std::function<void()> func);
+  void wait();
+
+ private:
+  ThreadPool& pool_;
+  std::shared_ptr<ThreadPool::GroupState> state_;
+};
+
+template <typename Func>
+void ThreadPool::parallelFor(const int begin, const int end, const Func& func)
+{
+  const int count = end - begin;
+  if (count <= 0) {
+    return;
+  }
+
+  // A few chunks per thread balance uneven iterations, chunks are handed
+  // out from a counter so they run roughly in order.
+  const int chunks = std::min(count, getThreadCount() * 4);
+  const int chunk_size = (count + chunks - 1) / chunks;
+  auto next = std::make_shared<std::atomic_int>(begin);
+
+  TaskGroup group(*this);
+  for (int chunk = 0; chunk < chunks; chunk++) {
+    group.run([next, end, chunk_size, &func]() {
+      const int first = next->fetch_add(chunk_size);
+      const int last = std::min(first + chunk_size, end);
+      for (int i = first; i < last; i++) {
+        func(i);
+      }
+    });
+  }
+  group.wait();
+}
+
+}  // namespace utl
@@ -35,18 +35,68 @@
 
 #include "utl/Logger.h"
 
+#include <algorithm>
 #include <atomic>
+#include <condition_variable>
+#include <cstdint>
 #include <fstream>
 #include <mutex>
 
+#include "spdlog/async.h"
 #include "spdlog/sinks/basic_file_sink.h"
 #include "spdlog/sinks/stdout_color_sinks.h"
 #include "spdlog/spdlog.h"
+#include "utl/MemoryRegistry.h"
+#include "utl/Profiler.h"
 
 namespace utl {
 
+// The last sink of the async logger.  The pool thread writes and flushes
+// the queued messages in order, so once a flush reaches this sink every
+// message logged before the flush was requested has been written.
+class Logger::FlushWaiter : public spdlog::sinks::sink
+{
+ public:
+  void log(const spdlog::details::log_msg& /* msg */) override {}
+  void flush() override
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    flushed_++;
+    changed_.notify_all();
+  }
+  void set_pattern(const std::string& /* pattern */) override {}
+  void set_formatter(
+      std::unique_ptr<spdlog::formatter> /* formatter */) override
+  {
+  }
+
+  // Returns the number of flushes to wait for, including the one the
+  // caller is about to request.
+  uint64_t request()
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return ++requested_;
+  }
+
+  void wait(uint64_t ticket)
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    changed_.wait(lock, [&] { return flushed_ >= ticket; });
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable changed_;
+  uint64_t requested_ = 0;
+  uint64_t flushed_ = 0;
+};
+
 Logger::Logger(const char* log_filename, const char* metrics_filename)
-    : debug_on_(false), warning_count_(0), error_count_(0)
+    : warning_count_(0),
+      error_count_(0),
+      profiling_(false),
+      profiler_(std::make_unique<Profiler>()),
+      memory_registry_(std::make_unique<MemoryRegistry>())
 
 {
   sinks_.push_back(std::make_shared<spdlog::sinks::stdout_color_sink_mt>());
@@ -54,10 +104,7 @@ Logger::Logger(const char* log_filename, const char* metrics_filename)
     sinks_.push_back(
         std::make_shared<spdlog::sinks::basic_file_sink_mt>(log_filename));
 
-  logger_ = std::make_shared<spdlog::logger>(
-      "logger", sinks_.begin(), sinks_.end());
-  logger_->set_pattern(pattern_);
-  logger_->set_level(spdlog::level::level_enum::debug);
+  makeLogger();
 
   if (metrics_filename)
     addMetricsSink(metrics_filename);
@@ -69,11 +116,68 @@ Logger::Logger(const char* log_filename, const char* metrics_filename)
       counter = 0;
     }
   }
+  for (auto& level : debug_max_level_) {
+    level = 0;
+  }
 }
 
 Logger::~Logger()
 {
   finalizeMetrics();
+  stopAsyncLogging();
+}
+
+void Logger::makeLogger()
+{
+  if (async_pool_) {
+    std::vector<spdlog::sink_ptr> sinks = sinks_;
+    sinks.push_back(flush_waiter_);
+    logger_ = std::make_shared<spdlog::async_logger>(
+        "logger",
+        sinks.begin(),
+        sinks.end(),
+        async_pool_,
+        spdlog::async_overflow_policy::block);
+  } else {
+    logger_ = std::make_shared<spdlog::logger>(
+        "logger", sinks_.begin(), sinks_.end());
+  }
+  logger_->set_pattern(pattern_);
+  logger_->set_level(spdlog::level::level_enum::debug);
+}
+
+void Logger::startAsyncLogging(size_t queue_size)
+{
+  if (async_pool_) {
+    return;
+  }
+  logger_->flush();
+  // A single thread keeps the messages in order.
+  async_pool_ = std::make_shared<spdlog::details::thread_pool>(queue_size, 1);
+  flush_waiter_ = std::make_shared<FlushWaiter>();
+  makeLogger();
+}
+
+void Logger::stopAsyncLogging()
+{
+  if (!async_pool_) {
+    return;
+  }
+  flush();
+  async_pool_.reset();
+  flush_waiter_.reset();
+  makeLogger();
+}
+
+void Logger::flush()
+{
+  if (!async_pool_) {
+    logger_->flush();
+    return;
+  }
+  const uint64_t ticket = flush_waiter_->request();
+  logger_->flush();
+  flush_waiter_->wait(ticket);
 }
 
 void Logger::addMetricsSink(const char* metrics_filename)
@@ -111,25 +215,34 @@ void Logger::setDebugLevel(ToolId tool, const char* group, int level)
     auto it = groups.find(group);
     if (it != groups.end()) {
       groups.erase(it);
-      debug_on_ = std::any_of(debug_group_level_.begin(),
-                              debug_group_level_.end(),
-                              [](auto& group) { return !group.empty(); });
     }
   } else {
-    debug_on_ = true;
     debug_group_level_.at(tool)[group] = level;
   }
+
+  int max_level = 0;
+  for (const auto& [name, group_level] : debug_group_level_[tool]) {
+    max_level = std::max(max_level, group_level);
+  }
+  debug_max_level_[tool] = max_level;
 }
 
 void Logger::addSink(spdlog::sink_ptr sink)
 {
+  // Let the async thread finish with the sinks before they change.
+  flush();
   sinks_.push_back(sink);
-  logger_->sinks().push_back(sink);
-  logger_->set_pattern(pattern_);  // updates the new sink
+  if (async_pool_) {
+    makeLogger();
+  } else {
+    logger_->sinks().push_back(sink);
+    logger_->set_pattern(pattern_);  // updates the new sink
+  }
 }
 
 void Logger::removeSink(spdlog::sink_ptr sink)
 {
+  flush();
   // remove from local list of sinks_
   auto sinks_find = std::find(sinks_.begin(), sinks_.end(), sink);
   if (sinks_find != sinks_.end()) {
@@ -143,6 +256,17 @@ void Logger::removeSink(spdlog::sink_ptr sink)
   }
 }
 
+void Logger::metricSeries(std::string_view series_name,
+                          MetricsSeries::Point point)
+{
+  const std::string key = metricKey(series_name);
+  auto it = metrics_series_.find(key);
+  if (it == metrics_series_.end()) {
+    it = metrics_series_.emplace(key, MetricsSeries()).first;
+  }
+  it->second.append(point);
+}
+
 void Logger::setMetricsStage(std::string_view format)
 {
   if (metrics_stages_.empty())
@@ -175,7 +299,11 @@ std::string Logger::popMetricsStage()
 
 void Logger::flushMetrics()
 {
-  const std::string json = MetricsEntry::assembleJSON(metrics_entries_);
+  std::list<MetricsEntry> entries = metrics_entries_;
+  for (const auto& [key, series] : metrics_series_) {
+    entries.push_back({key, series.toJSON()});
+  }
+  const std::string json = MetricsEntry::assembleJSON(entries);
 
   for (std::string sink_path : metrics_sinks_) {
     std::ofstream sink_file(sink_path);
@@ -187,8 +315,27 @@ void Logger::flushMetrics()
   }
 }
 
+void Logger::startProfiling(const char* trace_filename)
+{
+  if (profiling_) {
+    stopProfiling();
+  }
+  profiler_->start(trace_filename);
+  profiling_ = true;
+}
+
+void Logger::stopProfiling()
+{
+  if (!profiling_) {
+    return;
+  }
+  profiling_ = false;
+  profiler_->stop(this);
+}
+
 void Logger::finalizeMetrics()
 {
+  stopProfiling();
   log_metric("flow__warnings__count", std::to_string(warning_count_));
   log_metric("flow__errors__count", std::to_string(error_count_));
 
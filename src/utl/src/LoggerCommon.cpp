@@ -36,6 +36,7 @@
 #include "LoggerCommon.h"
 
 #include "utl/Logger.h"
+#include "utl/MemoryRegistry.h"
 
 namespace ord {
 // Defined in OpenRoad.i
@@ -130,6 +131,30 @@ std::string pop_metrics_stage()
   return logger->popMetricsStage();
 }
 
+void start_profiling(const char* trace_filename)
+{
+  Logger* logger = getLogger();
+  logger->startProfiling(trace_filename[0] != '\0' ? trace_filename : nullptr);
+}
+
+void stop_profiling()
+{
+  Logger* logger = getLogger();
+  logger->stopProfiling();
+}
+
+void start_async_logging()
+{
+  Logger* logger = getLogger();
+  logger->startAsyncLogging();
+}
+
+void stop_async_logging()
+{
+  Logger* logger = getLogger();
+  logger->stopAsyncLogging();
+}
+
 void suppress_message(utl::ToolId tool, int id)
 {
   Logger* logger = getLogger();
@@ -142,4 +167,16 @@ void unsuppress_message(utl::ToolId tool, int id)
   logger->unsuppressMessage(tool, id);
 }
 
+void report_memory_usage()
+{
+  Logger* logger = getLogger();
+  logger->getMemoryRegistry()->report(logger);
+}
+
+void set_release_memory_on_exit(bool release)
+{
+  Logger* logger = getLogger();
+  logger->getMemoryRegistry()->setReleaseOnExit(release);
+}
+
 }  // namespace utl
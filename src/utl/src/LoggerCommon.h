@@ -51,7 +51,13 @@ void set_metrics_stage(const char* fmt);
 void clear_metrics_stage();
 void push_metrics_stage(const char* fmt);
 std::string pop_metrics_stage();
+void start_profiling(const char* trace_filename);
+void stop_profiling();
+void start_async_logging();
+void stop_async_logging();
 void suppress_message(utl::ToolId tool, int id);
 void unsuppress_message(utl::ToolId tool, int id);
+void report_memory_usage();
+void set_release_memory_on_exit(bool release);
 
 }  // namespace utl
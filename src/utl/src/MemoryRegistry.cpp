@@ -0,0 +1,150 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "utl/MemoryRegistry.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <tuple>
+#include <utility>
+
+#include "utl/Profiler.h"
+
+namespace utl {
+
+MemoryRegistration::MemoryRegistration(MemoryRegistration&& other) noexcept
+    : registry_(std::exchange(other.registry_, nullptr)), id_(other.id_)
+{
+}
+
+MemoryRegistration& MemoryRegistration::operator=(
+    MemoryRegistration&& other) noexcept
+{
+  if (this != &other) {
+    if (registry_ != nullptr) {
+      registry_->remove(id_);
+    }
+    registry_ = std::exchange(other.registry_, nullptr);
+    id_ = other.id_;
+  }
+  return *this;
+}
+
+MemoryRegistration::~MemoryRegistration()
+{
+  if (registry_ != nullptr) {
+    registry_->remove(id_);
+  }
+}
+
+MemoryRegistration MemoryRegistry::add(const ToolId tool,
+                                       const std::string& name,
+                                       Counter counter)
+{
+  std::lock_guard<std::mutex> lock(lock_);
+  const int id = next_id_++;
+  entries_[id] = {tool, name, std::move(counter)};
+  return MemoryRegistration(this, id);
+}
+
+void MemoryRegistry::remove(const int id)
+{
+  std::lock_guard<std::mutex> lock(lock_);
+  entries_.erase(id);
+}
+
+std::vector<MemoryRegistry::Usage> MemoryRegistry::getUsage() const
+{
+  std::vector<Usage> usage;
+  {
+    std::lock_guard<std::mutex> lock(lock_);
+    usage.reserve(entries_.size());
+    for (const auto& [id, entry] : entries_) {
+      usage.push_back({entry.tool, entry.name, entry.counter()});
+    }
+  }
+  std::sort(usage.begin(), usage.end(), [](const Usage& a, const Usage& b) {
+    return std::tie(a.tool, a.name) < std::tie(b.tool, b.name);
+  });
+  return usage;
+}
+
+void MemoryRegistry::report(Logger* logger) const
+{
+  constexpr double mb = 1024.0 * 1024.0;
+  const std::vector<Usage> usage = getUsage();
+  int64_t total = 0;
+  logger->report("{:<6} {:<24} {:>12}", "Tool", "Owner", "Memory (MB)");
+  logger->report("{:-<44}", "");
+  for (const Usage& entry : usage) {
+    const char* tool = Logger::getToolName(entry.tool);
+    logger->report(
+        "{:<6} {:<24} {:>12.1f}", tool, entry.name, entry.bytes / mb);
+    std::string metric_tool = tool;
+    std::transform(metric_tool.begin(),
+                   metric_tool.end(),
+                   metric_tool.begin(),
+                   [](unsigned char c) { return std::tolower(c); });
+    logger->metric(
+        fmt::format("memory__{}__{}__bytes", metric_tool, entry.name),
+        entry.bytes);
+    total += entry.bytes;
+  }
+  logger->report("{:-<44}", "");
+  logger->report("{:<31} {:>12.1f}", "Total", total / mb);
+
+  const int64_t rss = currentRSS() * 1024;
+  const int64_t peak_rss = Profiler::peakRSS() * 1024;
+  logger->report("{:<31} {:>12.1f}", "Process RSS", rss / mb);
+  logger->report("{:<31} {:>12.1f}", "Process peak RSS", peak_rss / mb);
+  logger->metric("memory__total__bytes", total);
+  logger->metric("memory__process__rss_bytes", rss);
+  logger->metric("memory__process__peak_rss_bytes", peak_rss);
+}
+
+int64_t MemoryRegistry::currentRSS()
+{
+  // The second field of statm is the resident set in pages.
+  std::ifstream statm("/proc/self/statm");
+  int64_t size = 0;
+  int64_t resident = 0;
+  if (!(statm >> size >> resident)) {
+    return 0;
+  }
+  return resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+}  // namespace utl
@@ -35,6 +35,11 @@
 
 #include "utl/Metrics.h"
 
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+
 #include "spdlog/fmt/fmt.h"
 #include "spdlog/fmt/ostr.h"
 #include "spdlog/spdlog.h"
@@ -53,6 +58,51 @@ std::string MetricsEntry::assembleJSON(const std::list<MetricsEntry>& entries)
   return json + "\n}";
 }
 
+void MetricsSeries::append(Point point)
+{
+  for (const auto& [name, value] : point) {
+    auto it = std::find(columns_.begin(), columns_.end(), name);
+    if (it == columns_.end()) {
+      columns_.emplace_back(name);
+      values_.emplace_back(size_, std::numeric_limits<double>::quiet_NaN());
+      it = columns_.end() - 1;
+    }
+    std::vector<double>& column = values_[it - columns_.begin()];
+    if (column.size() > size_) {
+      // Repeated in this point, the last value wins.
+      column.back() = value;
+    } else {
+      column.push_back(value);
+    }
+  }
+  size_++;
+  for (std::vector<double>& column : values_) {
+    column.resize(size_, std::numeric_limits<double>::quiet_NaN());
+  }
+}
+
+std::string MetricsSeries::toJSON() const
+{
+  fmt::memory_buffer buffer;
+  auto out = std::back_inserter(buffer);
+  fmt::format_to(out, "{{");
+  for (size_t i = 0; i < columns_.size(); i++) {
+    fmt::format_to(out, "{}\"{}\": [", i == 0 ? "" : ", ", columns_[i]);
+    const char* separator = "";
+    for (const double value : values_[i]) {
+      if (std::isfinite(value)) {
+        fmt::format_to(out, "{}{}", separator, value);
+      } else {
+        fmt::format_to(out, "{}null", separator);
+      }
+      separator = ", ";
+    }
+    fmt::format_to(out, "]");
+  }
+  fmt::format_to(out, "}}");
+  return fmt::to_string(buffer);
+}
+
 MetricsPolicy::MetricsPolicy(const std::string& key_pattern,
                              MetricsPolicyType policy,
                              bool repeating_use_regex)
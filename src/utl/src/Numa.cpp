@@ -0,0 +1,258 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "utl/Numa.h"
+
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace utl {
+
+namespace {
+
+std::atomic<Numa::Binding> binding = Numa::Binding::NONE;
+std::atomic_bool interleave = false;
+thread_local int interleave_depth = 0;
+
+struct Topology
+{
+  // CPUs of each node the process may run on, nodes without any skipped.
+  std::vector<std::vector<int>> node_cpus;
+  std::vector<int> node_ids;
+#ifdef __linux__
+  cpu_set_t process_mask;
+#endif
+};
+
+// Parses a sysfs CPU list such as "0-31,64-95".
+std::vector<int> parseCpuList(const std::string& list)
+{
+  std::vector<int> cpus;
+  std::stringstream stream(list);
+  std::string range;
+  while (std::getline(stream, range, ',')) {
+    if (range.empty() || range == "\n") {
+      continue;
+    }
+    const size_t dash = range.find('-');
+    const int first = std::stoi(range.substr(0, dash));
+    const int last
+        = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+    for (int cpu = first; cpu <= last; cpu++) {
+      cpus.push_back(cpu);
+    }
+  }
+  return cpus;
+}
+
+// Read once, from the first caller, which is the main thread when
+// set_thread_count runs and so still has the process mask.
+const Topology& topology()
+{
+  static Topology topo;
+  static std::once_flag once;
+  std::call_once(once, [] {
+    std::vector<int> allowed;
+#ifdef __linux__
+    CPU_ZERO(&topo.process_mask);
+    sched_getaffinity(0, sizeof(topo.process_mask), &topo.process_mask);
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+      if (CPU_ISSET(cpu, &topo.process_mask)) {
+        allowed.push_back(cpu);
+      }
+    }
+
+    std::error_code error;
+    const std::filesystem::path nodes_dir("/sys/devices/system/node");
+    std::vector<std::pair<int, std::vector<int>>> nodes;
+    for (const auto& entry :
+         std::filesystem::directory_iterator(nodes_dir, error)) {
+      const std::string name = entry.path().filename().string();
+      if (name.rfind("node", 0) != 0 || name.size() == 4
+          || name.find_first_not_of("0123456789", 4) != std::string::npos) {
+        continue;
+      }
+      std::ifstream file(entry.path() / "cpulist");
+      std::string list;
+      std::getline(file, list);
+      std::vector<int> cpus;
+      for (const int cpu : parseCpuList(list)) {
+        if (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &topo.process_mask)) {
+          cpus.push_back(cpu);
+        }
+      }
+      if (!cpus.empty()) {
+        nodes.emplace_back(std::stoi(name.substr(4)), std::move(cpus));
+      }
+    }
+    std::sort(nodes.begin(), nodes.end());
+    for (auto& [id, cpus] : nodes) {
+      topo.node_ids.push_back(id);
+      topo.node_cpus.push_back(std::move(cpus));
+    }
+#endif
+    if (topo.node_cpus.empty() && !allowed.empty()) {
+      topo.node_ids.push_back(0);
+      topo.node_cpus.push_back(allowed);
+    }
+  });
+  return topo;
+}
+
+#ifdef __linux__
+bool setMemoryPolicy(const int mode, const std::vector<unsigned long>& mask)
+{
+  constexpr int bits = 8 * sizeof(unsigned long);
+  // The kernel reads one bit less than maxnode.
+  const unsigned long max_node = mask.size() * bits + 1;
+  return syscall(SYS_set_mempolicy,
+                 mode,
+                 mask.empty() ? nullptr : mask.data(),
+                 mask.empty() ? 0 : max_node)
+         == 0;
+}
+#endif
+
+}  // namespace
+
+void Numa::setBinding(const Binding new_binding)
+{
+  binding = new_binding;
+}
+
+Numa::Binding Numa::getBinding()
+{
+  return binding;
+}
+
+void Numa::setInterleave(const bool new_interleave)
+{
+  interleave = new_interleave;
+}
+
+bool Numa::interleaveEnabled()
+{
+  return interleave;
+}
+
+int Numa::nodeCount()
+{
+  return std::max(1, static_cast<int>(topology().node_cpus.size()));
+}
+
+int Numa::cpuForThread(const int index, const Binding how)
+{
+  const Topology& topo = topology();
+  if (how == Binding::NONE || topo.node_cpus.empty()) {
+    return -1;
+  }
+  if (how == Binding::SPREAD) {
+    const int nodes = topo.node_cpus.size();
+    const std::vector<int>& cpus = topo.node_cpus[index % nodes];
+    return cpus[(index / nodes) % cpus.size()];
+  }
+  int total = 0;
+  for (const std::vector<int>& cpus : topo.node_cpus) {
+    total += cpus.size();
+  }
+  int remaining = index % total;
+  for (const std::vector<int>& cpus : topo.node_cpus) {
+    if (remaining < static_cast<int>(cpus.size())) {
+      return cpus[remaining];
+    }
+    remaining -= cpus.size();
+  }
+  return -1;
+}
+
+bool Numa::bindCurrentThread(const int cpu)
+{
+#ifdef __linux__
+  cpu_set_t mask = topology().process_mask;
+  if (cpu >= 0) {
+    CPU_ZERO(&mask);
+    CPU_SET(cpu, &mask);
+  }
+  return pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask) == 0;
+#else
+  return false;
+#endif
+}
+
+ScopedInterleave::ScopedInterleave()
+{
+  if (!Numa::interleaveEnabled() || Numa::nodeCount() < 2) {
+    return;
+  }
+  active_ = true;
+  if (interleave_depth++ > 0) {
+    return;
+  }
+#ifdef __linux__
+  constexpr int bits = 8 * sizeof(unsigned long);
+  std::vector<unsigned long> mask;
+  for (const int node : topology().node_ids) {
+    if (node / bits >= static_cast<int>(mask.size())) {
+      mask.resize(node / bits + 1, 0);
+    }
+    mask[node / bits] |= 1UL << (node % bits);
+  }
+  setMemoryPolicy(MPOL_INTERLEAVE, mask);
+#endif
+}
+
+ScopedInterleave::~ScopedInterleave()
+{
+  if (!active_ || --interleave_depth > 0) {
+    return;
+  }
+#ifdef __linux__
+  setMemoryPolicy(MPOL_DEFAULT, {});
+#endif
+}
+
+}  // namespace utl
@@ -0,0 +1,218 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "utl/Profiler.h"
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <ctime>
+#include <fstream>
+
+namespace utl {
+
+namespace {
+
+// Paths of the open scopes of this thread, innermost last
+thread_local std::vector<std::string> scope_paths;
+
+int threadIndex()
+{
+  static std::atomic_int next_thread = 0;
+  thread_local const int thread = next_thread++;
+  return thread;
+}
+
+std::string escapeJSON(const std::string& text)
+{
+  std::string escaped;
+  for (const char c : text) {
+    if (c == '"' || c == '\\') {
+      escaped += '\\';
+    }
+    escaped += c;
+  }
+  return escaped;
+}
+
+}  // namespace
+
+void Profiler::start(const char* trace_filename)
+{
+  std::unique_lock<std::mutex> guard(lock_);
+  stats_.clear();
+  trace_.clear();
+  trace_filename_ = trace_filename != nullptr ? trace_filename : "";
+  epoch_ = std::chrono::steady_clock::now();
+}
+
+void Profiler::stop(Logger* logger)
+{
+  for (const auto& [key, stats] : getStats()) {
+    const auto& [tool, path] = key;
+    const std::string prefix
+        = fmt::format("profile__{}__{}__", Logger::getToolName(tool), path);
+    logger->metric(prefix + "calls", stats.calls);
+    logger->metric(prefix + "wall_time", stats.wall_time);
+    logger->metric(prefix + "cpu_time", stats.cpu_time);
+    logger->metric(prefix + "peak_rss_growth", stats.peak_rss_growth);
+  }
+
+  if (!trace_filename_.empty()) {
+    writeTrace(logger);
+  }
+}
+
+void Profiler::record(ToolId tool,
+                      const std::string& path,
+                      const char* name,
+                      std::chrono::steady_clock::time_point start,
+                      double wall_time,
+                      double cpu_time,
+                      int64_t peak_rss_growth)
+{
+  std::unique_lock<std::mutex> guard(lock_);
+  Stats& stats = stats_[{tool, path}];
+  stats.calls++;
+  stats.wall_time += wall_time;
+  stats.cpu_time += cpu_time;
+  stats.peak_rss_growth = std::max(stats.peak_rss_growth, peak_rss_growth);
+
+  if (!trace_filename_.empty()) {
+    using std::chrono::microseconds;
+    const auto since_epoch
+        = std::chrono::duration_cast<microseconds>(start - epoch_);
+    trace_.push_back({tool,
+                      std::string(name),
+                      threadIndex(),
+                      since_epoch.count(),
+                      static_cast<int64_t>(wall_time * 1e6),
+                      cpu_time,
+                      peak_rss_growth});
+  }
+}
+
+std::map<Profiler::Key, Profiler::Stats> Profiler::getStats() const
+{
+  std::unique_lock<std::mutex> guard(lock_);
+  return stats_;
+}
+
+void Profiler::writeTrace(Logger* logger) const
+{
+  std::ofstream trace_file(trace_filename_);
+  if (!trace_file) {
+    logger->warn(UTL, 10, "Unable to open {} to write trace", trace_filename_);
+    return;
+  }
+
+  std::unique_lock<std::mutex> guard(lock_);
+  const int pid = getpid();
+  trace_file << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+  bool first = true;
+  for (const TraceEvent& event : trace_) {
+    if (!first) {
+      trace_file << ",";
+    }
+    first = false;
+    trace_file << fmt::format(
+        "\n{{\"name\": \"{}\", \"cat\": \"{}\", \"ph\": \"X\", \"ts\": {}, "
+        "\"dur\": {}, \"pid\": {}, \"tid\": {}, \"args\": {{\"cpu_time\": "
+        "{}, \"peak_rss_growth\": {}}}}}",
+        escapeJSON(event.name),
+        Logger::getToolName(event.tool),
+        event.start,
+        event.duration,
+        pid,
+        event.thread,
+        event.cpu_time,
+        event.peak_rss_growth);
+  }
+  trace_file << "\n]}\n";
+}
+
+double Profiler::threadCpuTime()
+{
+  timespec time;
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time) != 0) {
+    return 0.0;
+  }
+  return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+int64_t Profiler::peakRSS()
+{
+  rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+#ifdef __APPLE__
+  return usage.ru_maxrss / 1024;  // bytes
+#else
+  return usage.ru_maxrss;  // kB
+#endif
+}
+
+//////////////////////////
+
+void ProfileScope::begin(Profiler* profiler)
+{
+  profiler_ = profiler;
+
+  std::string path = scope_paths.empty() ? "" : scope_paths.back() + "/";
+  path += name_;
+  scope_paths.push_back(std::move(path));
+
+  peak_rss_start_ = Profiler::peakRSS();
+  cpu_start_ = Profiler::threadCpuTime();
+  start_ = std::chrono::steady_clock::now();
+}
+
+void ProfileScope::end()
+{
+  const auto end = std::chrono::steady_clock::now();
+  const double cpu_time = Profiler::threadCpuTime() - cpu_start_;
+  const int64_t peak_rss_growth = Profiler::peakRSS() - peak_rss_start_;
+
+  profiler_->record(tool_,
+                    scope_paths.back(),
+                    name_,
+                    start_,
+                    std::chrono::duration<double>(end - start_).count(),
+                    cpu_time,
+                    peak_rss_growth);
+  scope_paths.pop_back();
+}
+
+}  // namespace utl
@@ -0,0 +1,192 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "utl/ThreadPool.h"
+
+#include "utl/Numa.h"
+
+namespace utl {
+
+ThreadPool::~ThreadPool()
+{
+  stopWorkers();
+}
+
+ThreadPool& ThreadPool::get()
+{
+  static ThreadPool pool;
+  return pool;
+}
+
+void ThreadPool::setThreadCount(const int threads)
+{
+  const Numa::Binding binding = Numa::getBinding();
+  if (threads == getThreadCount() && binding == binding_) {
+    return;
+  }
+
+  stopWorkers();
+
+  std::unique_lock<std::mutex> guard(lock_);
+  stop_ = false;
+  binding_ = binding;
+  for (int i = 1; i < threads; i++) {
+    const int cpu = Numa::cpuForThread(i, binding);
+    workers_.emplace_back([this, cpu] {
+      if (cpu >= 0) {
+        Numa::bindCurrentThread(cpu);
+      }
+      workerLoop();
+    });
+  }
+}
+
+void ThreadPool::stopWorkers()
+{
+  {
+    std::unique_lock<std::mutex> guard(lock_);
+    stop_ = true;
+  }
+  changed_.notify_all();
+  for (std::thread& worker : workers_) {
+    worker.join();
+  }
+  workers_.clear();
+}
+
+void ThreadPool::submit(Task task)
+{
+  {
+    std::unique_lock<std::mutex> guard(lock_);
+    task.group->pending++;
+    queue_.push_back(std::move(task));
+  }
+  changed_.notify_one();
+}
+
+void ThreadPool::execute(Task& task)
+{
+  try {
+    task.func();
+  } catch (...) {
+    std::unique_lock<std::mutex> guard(lock_);
+    if (!task.group->exception) {
+      task.group->exception = std::current_exception();
+    }
+  }
+
+  {
+    std::unique_lock<std::mutex> guard(lock_);
+    task.group->pending--;
+  }
+  // waiters of any group may be sleeping on the same condition
+  changed_.notify_all();
+}
+
+void ThreadPool::wait(GroupState& group)
+{
+  std::unique_lock<std::mutex> guard(lock_);
+  while (group.pending > 0) {
+    if (queue_.empty()) {
+      changed_.wait(guard);
+      continue;
+    }
+    // help with any queued task instead of blocking a thread
+    Task task = std::move(queue_.front());
+    queue_.pop_front();
+    guard.unlock();
+    execute(task);
+    guard.lock();
+  }
+
+  if (group.exception) {
+    std::exception_ptr exception = group.exception;
+    group.exception = nullptr;
+    std::rethrow_exception(exception);
+  }
+}
+
+void ThreadPool::workerLoop()
+{
+  std::unique_lock<std::mutex> guard(lock_);
+  while (true) {
+    changed_.wait(guard, [this]() { return stop_ || !queue_.empty(); });
+    if (queue_.empty()) {
+      return;  // stopping
+    }
+    Task task = std::move(queue_.front());
+    queue_.pop_front();
+    guard.unlock();
+    execute(task);
+    guard.lock();
+  }
+}
+
+//////////////////////////
+
+TaskGroup::TaskGroup(ThreadPool& pool)
+    : pool_(pool), state_(std::make_shared<ThreadPool::GroupState>())
+{
+}
+
+TaskGroup::~TaskGroup()
+{
+  try {
+    wait();
+  } catch (...) {
+    // an unobserved exception can not leave a destructor
+  }
+}
+
+void TaskGroup::run(std::function<void()> func)
+{
+  if (pool_.getThreadCount() == 1) {
+    // nothing to run it in parallel with, avoid the queue
+    try {
+      func();
+    } catch (...) {
+      if (!state_->exception) {
+        state_->exception = std::current_exception();
+      }
+    }
+    return;
+  }
+  pool_.submit({std::move(func), state_});
+}
+
+void TaskGroup::wait()
+{
+  pool_.wait(*state_);
+}
+
+}  // namespace utl
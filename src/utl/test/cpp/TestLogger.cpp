@@ -0,0 +1,166 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "spdlog/sinks/ostream_sink.h"
+#include "utl/Logger.h"
+
+namespace utl {
+
+static std::vector<std::string> lines(const std::ostringstream& stream)
+{
+  std::vector<std::string> result;
+  std::istringstream in(stream.str());
+  std::string line;
+  while (std::getline(in, line)) {
+    result.push_back(line);
+  }
+  return result;
+}
+
+TEST(Logger, message_prefix)
+{
+  Logger logger;
+  std::ostringstream out;
+  logger.addSink(std::make_shared<spdlog::sinks::ostream_sink_mt>(out));
+  logger.info(GRT, 12, "routed {} nets", 3);
+  logger.setDebugLevel(GRT, "maze", 1);
+  Logger* debug_logger = &logger;
+  debugPrint(debug_logger, GRT, "maze", 1, "cost {}", 2.5);
+  logger.report("plain {{}}");
+  EXPECT_EQ(lines(out),
+            (std::vector<std::string>{"[INFO GRT-0012] routed 3 nets",
+                                      "[DEBUG GRT-maze] cost 2.5",
+                                      "plain {}"}));
+}
+
+TEST(Logger, debug_check)
+{
+  Logger logger;
+  EXPECT_FALSE(logger.debugCheck(GRT, "maze", 1));
+  logger.setDebugLevel(GRT, "maze", 2);
+  logger.setDebugLevel(GRT, "layer", 1);
+  EXPECT_TRUE(logger.debugCheck(GRT, "maze", 2));
+  EXPECT_FALSE(logger.debugCheck(GRT, "maze", 3));
+  EXPECT_FALSE(logger.debugCheck(GRT, "layer", 2));
+  EXPECT_FALSE(logger.debugCheck(DRT, "maze", 1));
+  logger.setDebugLevel(GRT, "maze", 0);
+  EXPECT_FALSE(logger.debugCheck(GRT, "maze", 1));
+  EXPECT_TRUE(logger.debugCheck(GRT, "layer", 1));
+}
+
+TEST(Logger, async_keeps_order)
+{
+  Logger logger;
+  std::ostringstream out;
+  logger.addSink(std::make_shared<spdlog::sinks::ostream_sink_mt>(out));
+  logger.startAsyncLogging(16);
+  EXPECT_TRUE(logger.isAsyncLogging());
+
+  constexpr int threads = 4;
+  constexpr int messages = 500;
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; t++) {
+    workers.emplace_back([&logger, t] {
+      for (int i = 0; i < messages; i++) {
+        logger.report("{} {}", t, i);
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  logger.flush();
+
+  const auto result = lines(out);
+  ASSERT_EQ(result.size(), threads * messages);
+  std::vector<int> next(threads, 0);
+  for (const std::string& line : result) {
+    std::istringstream in(line);
+    int t, i;
+    in >> t >> i;
+    EXPECT_EQ(i, next[t]++);
+  }
+
+  logger.stopAsyncLogging();
+  EXPECT_FALSE(logger.isAsyncLogging());
+}
+
+TEST(Logger, async_error_is_written)
+{
+  Logger logger;
+  std::ostringstream out;
+  logger.addSink(std::make_shared<spdlog::sinks::ostream_sink_mt>(out));
+  logger.startAsyncLogging();
+  logger.info(GRT, 1, "before");
+  EXPECT_THROW(logger.error(GRT, 2, "failed"), std::runtime_error);
+  EXPECT_EQ(lines(out),
+            (std::vector<std::string>{"[INFO GRT-0001] before",
+                                      "[ERROR GRT-0002] failed"}));
+}
+
+TEST(Logger, metric_series)
+{
+  const std::string metrics_file
+      = (std::filesystem::temp_directory_path() / "utl_metric_series.json")
+            .string();
+  {
+    Logger logger(nullptr, metrics_file.c_str());
+    logger.setMetricsStage("detailedroute__{}");
+    logger.metricSeries("route__iteration",
+                        {{"drc_errors", 10}, {"runtime", 1.5}});
+    logger.metricSeries("route__iteration", {{"drc_errors", 2}});
+    logger.metricSeries("route__iteration",
+                        {{"drc_errors", 0}, {"runtime", 3}, {"vias", 7}});
+  }
+  std::ifstream in(metrics_file);
+  std::stringstream json;
+  json << in.rdbuf();
+  std::filesystem::remove(metrics_file);
+  EXPECT_NE(json.str().find("\"detailedroute__route__iteration\": "
+                            "{\"drc_errors\": [10, 2, 0], "
+                            "\"runtime\": [1.5, null, 3], "
+                            "\"vias\": [null, null, 7]}"),
+            std::string::npos)
+      << json.str();
+}
+
+}  // namespace utl
@@ -0,0 +1,89 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <utility>
+
+#include "gtest/gtest.h"
+#include "utl/Logger.h"
+#include "utl/MemoryRegistry.h"
+
+namespace utl {
+
+TEST(MemoryRegistry, reports_registered_counters)
+{
+  Logger logger;
+  MemoryRegistry* registry = logger.getMemoryRegistry();
+  int64_t bytes = 100;
+  MemoryRegistration grt
+      = registry->add(GRT, "fastroute", [&bytes]() { return bytes; });
+  MemoryRegistration drt = registry->add(DRT, "design", []() { return 7; });
+
+  auto usage = registry->getUsage();
+  ASSERT_EQ(usage.size(), 2);
+  // Ordered by tool
+  EXPECT_EQ(usage[0].tool, DRT);
+  EXPECT_EQ(usage[0].bytes, 7);
+  EXPECT_EQ(usage[1].name, "fastroute");
+  EXPECT_EQ(usage[1].bytes, 100);
+
+  // Counters are evaluated when the usage is asked for.
+  bytes = 0;
+  EXPECT_EQ(registry->getUsage()[1].bytes, 0);
+}
+
+TEST(MemoryRegistry, registration_removes_entry)
+{
+  Logger logger;
+  MemoryRegistry* registry = logger.getMemoryRegistry();
+  {
+    MemoryRegistration first = registry->add(ODB, "a", []() { return 1; });
+    MemoryRegistration moved = std::move(first);
+    EXPECT_EQ(registry->getUsage().size(), 1);
+  }
+  EXPECT_TRUE(registry->getUsage().empty());
+}
+
+TEST(MemoryRegistry, release_on_exit)
+{
+  Logger logger;
+  MemoryRegistry* registry = logger.getMemoryRegistry();
+  EXPECT_FALSE(registry->releaseOnExit());
+  registry->setReleaseOnExit(true);
+  EXPECT_TRUE(registry->releaseOnExit());
+}
+
+TEST(MemoryRegistry, current_rss)
+{
+  EXPECT_GT(MemoryRegistry::currentRSS(), 0);
+}
+
+}  // namespace utl
@@ -0,0 +1,125 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include "gtest/gtest.h"
+#include "utl/Logger.h"
+#include "utl/Profiler.h"
+
+namespace utl {
+
+TEST(Profiler, disabled_records_nothing)
+{
+  Logger logger;
+  { ProfileScope scope(&logger, GRT, "route"); }
+  EXPECT_TRUE(logger.getProfiler()->getStats().empty());
+}
+
+TEST(Profiler, nested_scopes)
+{
+  Logger logger;
+  logger.startProfiling();
+  for (int i = 0; i < 3; i++) {
+    ProfileScope outer(&logger, GRT, "global_route");
+    ProfileScope inner(&logger, GRT, "maze");
+  }
+  { ProfileScope other(&logger, DRT, "maze"); }
+  const auto stats = logger.getProfiler()->getStats();
+  logger.stopProfiling();
+
+  ASSERT_EQ(stats.size(), 3);
+  EXPECT_EQ(stats.at({GRT, "global_route"}).calls, 3);
+  EXPECT_EQ(stats.at({GRT, "global_route/maze"}).calls, 3);
+  EXPECT_EQ(stats.at({DRT, "maze"}).calls, 1);
+  EXPECT_GE(stats.at({GRT, "global_route"}).wall_time,
+            stats.at({GRT, "global_route/maze"}).wall_time);
+}
+
+TEST(Profiler, threads_have_separate_scopes)
+{
+  Logger logger;
+  logger.startProfiling();
+  {
+    ProfileScope outer(&logger, GPL, "place");
+    std::thread worker(
+        [&logger]() { ProfileScope scope(&logger, GPL, "bin"); });
+    worker.join();
+  }
+  const auto stats = logger.getProfiler()->getStats();
+  logger.stopProfiling();
+
+  EXPECT_EQ(stats.count({GPL, "bin"}), 1);
+  EXPECT_EQ(stats.count({GPL, "place/bin"}), 0);
+}
+
+TEST(Profiler, writes_trace)
+{
+  Logger logger;
+  const std::string trace_file
+      = std::filesystem::temp_directory_path() / "utl_profiler_trace.json";
+  logger.startProfiling(trace_file.c_str());
+  { ProfileScope scope(&logger, PDN, "grid"); }
+  logger.stopProfiling();
+
+  std::ifstream trace(trace_file);
+  std::stringstream contents;
+  contents << trace.rdbuf();
+  EXPECT_NE(contents.str().find("\"name\": \"grid\""), std::string::npos);
+  EXPECT_NE(contents.str().find("\"cat\": \"PDN\""), std::string::npos);
+  std::filesystem::remove(trace_file);
+}
+
+TEST(Profiler, trace_keeps_runtime_names)
+{
+  Logger logger;
+  const std::string trace_file
+      = std::filesystem::temp_directory_path() / "utl_profiler_names.json";
+  logger.startProfiling(trace_file.c_str());
+  for (int i = 0; i < 2; i++) {
+    const std::string name = "batch" + std::to_string(i);
+    ProfileScope scope(&logger, DRT, name.c_str());
+  }
+  logger.stopProfiling();
+
+  std::ifstream trace(trace_file);
+  std::stringstream contents;
+  contents << trace.rdbuf();
+  EXPECT_NE(contents.str().find("\"name\": \"batch0\""), std::string::npos);
+  EXPECT_NE(contents.str().find("\"name\": \"batch1\""), std::string::npos);
+  std::filesystem::remove(trace_file);
+}
+
+}  // namespace utl
@@ -0,0 +1,129 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "utl/ThreadPool.h"
+
+namespace utl {
+
+TEST(ThreadPool, parallel_for_visits_every_index)
+{
+  ThreadPool pool;
+  pool.setThreadCount(4);
+  std::vector<int> visits(1000, 0);
+  pool.parallelFor(0, visits.size(), [&visits](int i) { visits[i]++; });
+  EXPECT_EQ(std::accumulate(visits.begin(), visits.end(), 0), visits.size());
+  EXPECT_EQ(*std::min_element(visits.begin(), visits.end()), 1);
+}
+
+TEST(ThreadPool, single_thread_runs_inline)
+{
+  ThreadPool pool;
+  pool.setThreadCount(1);
+  int sum = 0;
+  pool.parallelFor(0, 10, [&sum](int i) { sum += i; });
+  EXPECT_EQ(sum, 45);
+}
+
+TEST(ThreadPool, nested_parallel_for)
+{
+  ThreadPool pool;
+  pool.setThreadCount(2);
+  std::atomic_int count = 0;
+  pool.parallelFor(0, 8, [&](int) {
+    pool.parallelFor(0, 8, [&](int) {
+      pool.parallelFor(0, 8, [&](int) { count++; });
+    });
+  });
+  EXPECT_EQ(count, 8 * 8 * 8);
+}
+
+TEST(ThreadPool, task_group_rethrows)
+{
+  ThreadPool pool;
+  pool.setThreadCount(3);
+  TaskGroup group(pool);
+  std::atomic_int ran = 0;
+  for (int i = 0; i < 10; i++) {
+    group.run([&ran, i]() {
+      ran++;
+      if (i == 5) {
+        throw std::runtime_error("task failed");
+      }
+    });
+  }
+  EXPECT_THROW(group.wait(), std::runtime_error);
+  EXPECT_EQ(ran, 10);
+}
+
+TEST(ThreadPool, resize)
+{
+  ThreadPool pool;
+  pool.setThreadCount(4);
+  EXPECT_EQ(pool.getThreadCount(), 4);
+  pool.setThreadCount(2);
+  EXPECT_EQ(pool.getThreadCount(), 2);
+  std::atomic_int count = 0;
+  pool.parallelFor(0, 100, [&count](int) { count++; });
+  EXPECT_EQ(count, 100);
+}
+
+TEST(ThreadPool, bound_workers)
+{
+  ThreadPool pool;
+  pool.setThreadCount(4);
+  Numa::setBinding(Numa::Binding::SPREAD);
+  // Same count, new binding: the workers are restarted pinned.
+  pool.setThreadCount(4);
+  Numa::setBinding(Numa::Binding::NONE);
+  EXPECT_EQ(pool.getThreadCount(), 4);
+  std::atomic_int count = 0;
+  pool.parallelFor(0, 100, [&count](int) { count++; });
+  EXPECT_EQ(count, 100);
+}
+
+TEST(Numa, cpu_for_thread)
+{
+  EXPECT_GE(Numa::nodeCount(), 1);
+  EXPECT_EQ(Numa::cpuForThread(1, Numa::Binding::NONE), -1);
+  for (int i = 0; i < 8; i++) {
+    EXPECT_GE(Numa::cpuForThread(i, Numa::Binding::CLOSE), 0);
+    EXPECT_GE(Numa::cpuForThread(i, Numa::Binding::SPREAD), 0);
+  }
+}
+
+}  // namespace utl